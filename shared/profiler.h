@@ -1,6 +1,25 @@
 #ifndef PROFILER_H
 #define PROFILER_H
 
+// Section timer for the profiler panel, plus an optional Chrome trace.
+//
+// PROFILE_BEGIN/END time named sections on a monotonic nanosecond clock.
+// Each macro call site caches its section index in a static ProfileSite, so
+// the name lookup runs once per site instead of every call. Section stats
+// (the panel's 120-frame history) belong to the first thread that profiles
+// anything; sections begun on other threads only go to the trace.
+//
+// Trace: every thread records spans into its own ring buffer (single
+// writer, no locks). ProfileFrameEnd adds the frame's counters and drains
+// all rings into the trace file, so runs of any length stream to disk with
+// fixed memory. The file is Chrome trace-event JSON (chrome://tracing,
+// Perfetto). Spans are "X" events, PROFILE_COUNT counters are "C" events.
+//
+// Usage:
+//   ProfileTraceStart("trace.json");   // e.g. from --trace <file>
+//   ... frames, each ending with PROFILE_FRAME_END() ...
+//   ProfileTraceStop();                 // final drain + closing bracket
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <time.h>
@@ -10,10 +29,13 @@
 
 #define PROFILER_MAX_SECTIONS 64
 #define PROFILER_HISTORY_FRAMES 120
+#define PROFILER_MAX_THREADS 32           // threads that can record trace spans
+#define PROFILER_TRACE_RING 16384         // spans per thread between frame-end drains
+#define PROFILER_TRACE_DEPTH 32           // open spans per thread
 
 typedef struct {
     const char* name;
-    clock_t startTime;
+    uint64_t startNs;
     double lastTimeMs;
     double accumTimeMs;  // Accumulated time for sections called multiple times per frame
     double history[PROFILER_HISTORY_FRAMES];
@@ -37,6 +59,14 @@ typedef struct {
     int historyCount;
 } ProfileCounter;
 
+// Per-call-site cache of the section/counter index, valid for one
+// ProfileReset generation
+typedef struct {
+    const char* name;
+    int index;
+    int generation;
+} ProfileSite;
+
 #if PROFILER_ENABLED
 
 // Global state
@@ -44,6 +74,8 @@ extern ProfileSection profilerSections[PROFILER_MAX_SECTIONS];
 extern int profilerSectionCount;
 extern ProfileCounter profilerCounters[PROFILER_MAX_COUNTERS];
 extern int profilerCounterCount;
+extern bool profilerTraceEnabled;
+extern uint64_t profilerTraceDropped;   // spans overwritten before a drain
 
 void ProfileBegin(const char* name);
 void ProfileEnd(const char* name);
@@ -52,6 +84,19 @@ void ProfileAccumEnd(const char* name);
 void ProfileFrameEnd(void);
 void ProfileReset(void);
 
+void ProfileBeginSite(ProfileSite* site);
+void ProfileEndSite(ProfileSite* site);
+void ProfileAccumBeginSite(ProfileSite* site);
+void ProfileAccumEndSite(ProfileSite* site);
+void ProfileCountSite(ProfileSite* site, int n);
+void ProfileCountSetSite(ProfileSite* site, int n);
+
+uint64_t ProfileNowNs(void);
+bool ProfileTraceStart(const char* path);
+void ProfileTraceStop(void);
+void ProfileThreadName(const char* name);  // label the calling thread in the trace
+void ProfileThreadExit(void);              // worker thread done: free its trace lane for reuse
+
 void ProfileCount(const char* name, int n);
 void ProfileCountSet(const char* name, int n);
 uint64_t ProfileCountGetLast(int counterIndex);
@@ -66,13 +111,18 @@ double ProfileGetLast(int sectionIndex);
 bool ProfileIsHidden(int sectionIndex);  // Returns true if any ancestor is collapsed
 bool ProfileHasChildren(int sectionIndex);  // Returns true if this section has children
 
-#define PROFILE_BEGIN(name) ProfileBegin(#name)
-#define PROFILE_END(name) ProfileEnd(#name)
-#define PROFILE_ACCUM_BEGIN(name) ProfileAccumBegin(#name)
-#define PROFILE_ACCUM_END(name) ProfileAccumEnd(#name)
+#define PROFILE_SITE_CALL(fn, name) \
+    do { static ProfileSite profileSite_ = {#name, -1, -1}; fn(&profileSite_); } while (0)
+#define PROFILE_SITE_COUNT(fn, name, n) \
+    do { static ProfileSite profileSite_ = {#name, -1, -1}; fn(&profileSite_, n); } while (0)
+
+#define PROFILE_BEGIN(name) PROFILE_SITE_CALL(ProfileBeginSite, name)
+#define PROFILE_END(name) PROFILE_SITE_CALL(ProfileEndSite, name)
+#define PROFILE_ACCUM_BEGIN(name) PROFILE_SITE_CALL(ProfileAccumBeginSite, name)
+#define PROFILE_ACCUM_END(name) PROFILE_SITE_CALL(ProfileAccumEndSite, name)
 #define PROFILE_FRAME_END() ProfileFrameEnd()
-#define PROFILE_COUNT(name, n) ProfileCount(#name, n)
-#define PROFILE_COUNT_SET(name, n) ProfileCountSet(#name, n)
+#define PROFILE_COUNT(name, n) PROFILE_SITE_COUNT(ProfileCountSite, name, n)
+#define PROFILE_COUNT_SET(name, n) PROFILE_SITE_COUNT(ProfileCountSetSite, name, n)
 
 #else
 
@@ -96,12 +146,229 @@ bool ProfileHasChildren(int sectionIndex);  // Returns true if this section has
 
 #if PROFILER_ENABLED
 
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
 ProfileSection profilerSections[PROFILER_MAX_SECTIONS];
 int profilerSectionCount = 0;
 ProfileCounter profilerCounters[PROFILER_MAX_COUNTERS];
 int profilerCounterCount = 0;
+bool profilerTraceEnabled = false;
+uint64_t profilerTraceDropped = 0;
 static int profilerCurrentDepth = 0;
 static int profilerParentStack[PROFILER_MAX_SECTIONS];  // Stack of parent indices
+static int profilerGeneration = 0;  // bumped by ProfileReset, invalidates ProfileSite caches
+
+// --- Clock ---
+
+uint64_t ProfileNowNs(void) {
+    struct timespec ts;
+#ifdef CLOCK_MONOTONIC
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+    timespec_get(&ts, TIME_UTC);  // strict C11 headers hide clock_gettime
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static double ProfileElapsedMs(uint64_t startNs) {
+    return (double)(ProfileNowNs() - startNs) / 1e6;
+}
+
+// --- Threads and trace rings ---
+// A thread gets an id on its first profiler call; id 0 owns the section
+// table. Only the owning thread writes a ring's events and head; only the
+// thread calling ProfileFrameEnd (the owner) reads them and moves tail.
+
+typedef struct {
+    const char* name;
+    uint64_t startNs;
+    uint64_t durNs;
+} ProfileTraceSpan;
+
+typedef struct {
+    ProfileTraceSpan spans[PROFILER_TRACE_RING];
+    _Atomic uint64_t head;            // spans written
+    uint64_t tail;                    // spans drained
+    const char* openNames[PROFILER_TRACE_DEPTH];
+    uint64_t openStart[PROFILER_TRACE_DEPTH];
+    int openDepth;
+    const char* threadName;
+} ProfileTraceRing;
+
+static ProfileTraceRing* _Atomic profilerTraceRings[PROFILER_MAX_THREADS];
+static _Atomic int profilerThreadCount = 0;
+static _Atomic int profilerThreadSlotFree[PROFILER_MAX_THREADS];  // released by ProfileThreadExit
+static _Thread_local int profilerThreadId = -1;
+static FILE* profilerTraceFile = NULL;
+static uint64_t profilerTraceOriginNs = 0;
+static bool profilerTraceFirstEvent = true;
+
+// Short-lived workers hand their id (and ring) back on exit, so a pool
+// that is respawned every build keeps reusing the same trace lanes
+static int ProfileThreadId(void) {
+    if (profilerThreadId >= 0) return profilerThreadId;
+    int count = atomic_load(&profilerThreadCount);
+    if (count > PROFILER_MAX_THREADS) count = PROFILER_MAX_THREADS;
+    for (int t = 1; t < count; t++) {
+        int expected = 1;
+        if (atomic_compare_exchange_strong(&profilerThreadSlotFree[t], &expected, 0)) {
+            profilerThreadId = t;
+            return t;
+        }
+    }
+    profilerThreadId = atomic_fetch_add(&profilerThreadCount, 1);
+    return profilerThreadId;
+}
+
+void ProfileThreadExit(void) {
+    int id = profilerThreadId;
+    if (id <= 0 || id >= PROFILER_MAX_THREADS) return;
+    ProfileTraceRing* ring = atomic_load(&profilerTraceRings[id]);
+    if (ring) ring->openDepth = 0;
+    profilerThreadId = -1;
+    atomic_store(&profilerThreadSlotFree[id], 1);
+}
+
+static bool ProfileOwnsSections(void) {
+    return ProfileThreadId() == 0;
+}
+
+static ProfileTraceRing* ProfileThreadRing(void) {
+    int id = ProfileThreadId();
+    if (id >= PROFILER_MAX_THREADS) return NULL;
+    ProfileTraceRing* ring = atomic_load(&profilerTraceRings[id]);
+    if (!ring) {
+        ring = calloc(1, sizeof(ProfileTraceRing));
+        if (!ring) return NULL;
+        atomic_store(&profilerTraceRings[id], ring);
+    }
+    return ring;
+}
+
+void ProfileThreadName(const char* name) {
+    ProfileTraceRing* ring = ProfileThreadRing();
+    if (ring) ring->threadName = name;
+}
+
+static void ProfileTraceOpen(const char* name) {
+    if (!profilerTraceEnabled) return;
+    ProfileTraceRing* ring = ProfileThreadRing();
+    if (!ring || ring->openDepth >= PROFILER_TRACE_DEPTH) return;
+    ring->openNames[ring->openDepth] = name;
+    ring->openStart[ring->openDepth] = ProfileNowNs();
+    ring->openDepth++;
+}
+
+static void ProfileTraceClose(const char* name) {
+    if (!profilerTraceEnabled) return;
+    ProfileTraceRing* ring = ProfileThreadRing();
+    if (!ring || ring->openDepth == 0) return;
+    // Unwind to the matching open span (an unmatched END just closes the innermost)
+    int d = ring->openDepth - 1;
+    while (d > 0 && ring->openNames[d] != name) d--;
+    if (ring->openNames[d] != name) d = ring->openDepth - 1;
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    ProfileTraceSpan* span = &ring->spans[head % PROFILER_TRACE_RING];
+    span->name = name;
+    span->startNs = ring->openStart[d];
+    span->durNs = ProfileNowNs() - ring->openStart[d];
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    ring->openDepth = d;
+}
+
+static void ProfileTraceWriteEvent(const char* json) {
+    fputs(profilerTraceFirstEvent ? "\n" : ",\n", profilerTraceFile);
+    fputs(json, profilerTraceFile);
+    profilerTraceFirstEvent = false;
+}
+
+static double ProfileTraceUs(uint64_t ns) {
+    return ns >= profilerTraceOriginNs ? (double)(ns - profilerTraceOriginNs) / 1000.0 : 0.0;
+}
+
+static void ProfileTraceDrain(void) {
+    if (!profilerTraceFile) return;
+    char line[256];
+    int threads = atomic_load(&profilerThreadCount);
+    if (threads > PROFILER_MAX_THREADS) threads = PROFILER_MAX_THREADS;
+    for (int t = 0; t < threads; t++) {
+        ProfileTraceRing* ring = atomic_load(&profilerTraceRings[t]);
+        if (!ring) continue;
+        uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (head - ring->tail > PROFILER_TRACE_RING) {
+            profilerTraceDropped += head - ring->tail - PROFILER_TRACE_RING;
+            ring->tail = head - PROFILER_TRACE_RING;
+        }
+        for (; ring->tail < head; ring->tail++) {
+            ProfileTraceSpan* span = &ring->spans[ring->tail % PROFILER_TRACE_RING];
+            snprintf(line, sizeof(line),
+                     "{\"name\":\"%s\",\"cat\":\"section\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                     span->name, t, ProfileTraceUs(span->startNs), (double)span->durNs / 1000.0);
+            ProfileTraceWriteEvent(line);
+        }
+    }
+}
+
+// Counters are sampled once per frame on the owner thread
+static void ProfileTraceCounters(void) {
+    if (!profilerTraceFile) return;
+    char line[256];
+    double ts = ProfileTraceUs(ProfileNowNs());
+    for (int i = 0; i < profilerCounterCount; i++) {
+        snprintf(line, sizeof(line),
+                 "{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"args\":{\"value\":%llu}}",
+                 profilerCounters[i].name, ts, (unsigned long long)profilerCounters[i].frameCount);
+        ProfileTraceWriteEvent(line);
+    }
+}
+
+bool ProfileTraceStart(const char* path) {
+    ProfileTraceStop();
+    profilerTraceFile = fopen(path, "w");
+    if (!profilerTraceFile) return false;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", profilerTraceFile);
+    profilerTraceFirstEvent = true;
+    profilerTraceDropped = 0;
+    profilerTraceOriginNs = ProfileNowNs();
+    // Skip anything recorded before this trace started
+    int threads = atomic_load(&profilerThreadCount);
+    if (threads > PROFILER_MAX_THREADS) threads = PROFILER_MAX_THREADS;
+    for (int t = 0; t < threads; t++) {
+        ProfileTraceRing* ring = atomic_load(&profilerTraceRings[t]);
+        if (ring) ring->tail = atomic_load(&ring->head);
+    }
+    if (ProfileOwnsSections() && !ProfileThreadRing()->threadName) ProfileThreadName("main");
+    profilerTraceEnabled = true;
+    return true;
+}
+
+void ProfileTraceStop(void) {
+    if (!profilerTraceFile) return;
+    ProfileTraceDrain();
+    char line[256];
+    int threads = atomic_load(&profilerThreadCount);
+    if (threads > PROFILER_MAX_THREADS) threads = PROFILER_MAX_THREADS;
+    for (int t = 0; t < threads; t++) {
+        ProfileTraceRing* ring = atomic_load(&profilerTraceRings[t]);
+        if (!ring) continue;
+        if (ring->threadName) {
+            snprintf(line, sizeof(line),
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                     t, ring->threadName);
+        } else {
+            snprintf(line, sizeof(line),
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"worker %d\"}}",
+                     t, t);
+        }
+        ProfileTraceWriteEvent(line);
+    }
+    fputs("\n]}\n", profilerTraceFile);
+    fclose(profilerTraceFile);
+    profilerTraceFile = NULL;
+    profilerTraceEnabled = false;
+}
 
 static int ProfileFindOrCreate(const char* name, int depth, int parent, bool accumulating) {
     // Find existing section
@@ -114,7 +381,7 @@ static int ProfileFindOrCreate(const char* name, int depth, int parent, bool acc
     if (profilerSectionCount < PROFILER_MAX_SECTIONS) {
         int idx = profilerSectionCount++;
         profilerSections[idx].name = name;
-        profilerSections[idx].startTime = 0;
+        profilerSections[idx].startNs = 0;
         profilerSections[idx].lastTimeMs = 0.0;
         profilerSections[idx].accumTimeMs = 0.0;
         profilerSections[idx].historyIndex = 0;
@@ -132,48 +399,108 @@ static int ProfileFindOrCreate(const char* name, int depth, int parent, bool acc
     return -1;  // No space
 }
 
-void ProfileBegin(const char* name) {
-    int parent = (profilerCurrentDepth > 0) ? profilerParentStack[profilerCurrentDepth - 1] : -1;
-    int idx = ProfileFindOrCreate(name, profilerCurrentDepth, parent, false);
+static void ProfileBeginIndex(int idx) {
     if (idx >= 0) {
-        profilerSections[idx].startTime = clock();
+        profilerSections[idx].startNs = ProfileNowNs();
         profilerSections[idx].active = true;
         profilerParentStack[profilerCurrentDepth] = idx;
         profilerCurrentDepth++;
     }
 }
 
-void ProfileEnd(const char* name) {
-    int idx = ProfileFindOrCreate(name, 0, -1, false);  // depth/parent don't matter for lookup
+static void ProfileEndIndex(int idx) {
     if (idx >= 0 && profilerSections[idx].active) {
-        clock_t end = clock();
-        double ms = (double)(end - profilerSections[idx].startTime) / CLOCKS_PER_SEC * 1000.0;
-        profilerSections[idx].lastTimeMs = ms;
+        profilerSections[idx].lastTimeMs = ProfileElapsedMs(profilerSections[idx].startNs);
         profilerSections[idx].active = false;
         if (profilerCurrentDepth > 0) profilerCurrentDepth--;
     }
 }
 
-void ProfileAccumBegin(const char* name) {
-    int parent = (profilerCurrentDepth > 0) ? profilerParentStack[profilerCurrentDepth - 1] : -1;
-    int idx = ProfileFindOrCreate(name, profilerCurrentDepth, parent, true);
+static void ProfileAccumBeginIndex(int idx) {
     if (idx >= 0) {
-        profilerSections[idx].startTime = clock();
+        profilerSections[idx].startNs = ProfileNowNs();
         profilerSections[idx].active = true;
         // Don't push to parent stack - accum sections don't affect hierarchy during measurement
     }
 }
 
-void ProfileAccumEnd(const char* name) {
-    int idx = ProfileFindOrCreate(name, 0, -1, true);  // depth/parent don't matter for lookup
+static void ProfileAccumEndIndex(int idx) {
     if (idx >= 0 && profilerSections[idx].active) {
-        clock_t end = clock();
-        double ms = (double)(end - profilerSections[idx].startTime) / CLOCKS_PER_SEC * 1000.0;
-        profilerSections[idx].accumTimeMs += ms;  // Accumulate instead of replace
+        profilerSections[idx].accumTimeMs += ProfileElapsedMs(profilerSections[idx].startNs);  // Accumulate instead of replace
         profilerSections[idx].active = false;
     }
 }
 
+static int ProfileBeginLookup(const char* name, bool accumulating) {
+    int parent = (profilerCurrentDepth > 0) ? profilerParentStack[profilerCurrentDepth - 1] : -1;
+    return ProfileFindOrCreate(name, profilerCurrentDepth, parent, accumulating);
+}
+
+void ProfileBegin(const char* name) {
+    ProfileTraceOpen(name);
+    if (ProfileOwnsSections()) ProfileBeginIndex(ProfileBeginLookup(name, false));
+}
+
+void ProfileEnd(const char* name) {
+    // depth/parent don't matter for lookup
+    if (ProfileOwnsSections()) ProfileEndIndex(ProfileFindOrCreate(name, 0, -1, false));
+    ProfileTraceClose(name);
+}
+
+void ProfileAccumBegin(const char* name) {
+    ProfileTraceOpen(name);
+    if (ProfileOwnsSections()) ProfileAccumBeginIndex(ProfileBeginLookup(name, true));
+}
+
+void ProfileAccumEnd(const char* name) {
+    if (ProfileOwnsSections()) ProfileAccumEndIndex(ProfileFindOrCreate(name, 0, -1, true));
+    ProfileTraceClose(name);
+}
+
+// Site versions: resolve the index once per call site (and per ProfileReset)
+
+void ProfileBeginSite(ProfileSite* site) {
+    ProfileTraceOpen(site->name);
+    if (!ProfileOwnsSections()) return;
+    if (site->generation != profilerGeneration) {
+        site->index = ProfileBeginLookup(site->name, false);
+        site->generation = profilerGeneration;
+    }
+    ProfileBeginIndex(site->index);
+}
+
+void ProfileEndSite(ProfileSite* site) {
+    if (ProfileOwnsSections()) {
+        if (site->generation != profilerGeneration) {
+            site->index = ProfileFindOrCreate(site->name, 0, -1, false);
+            site->generation = profilerGeneration;
+        }
+        ProfileEndIndex(site->index);
+    }
+    ProfileTraceClose(site->name);
+}
+
+void ProfileAccumBeginSite(ProfileSite* site) {
+    ProfileTraceOpen(site->name);
+    if (!ProfileOwnsSections()) return;
+    if (site->generation != profilerGeneration) {
+        site->index = ProfileBeginLookup(site->name, true);
+        site->generation = profilerGeneration;
+    }
+    ProfileAccumBeginIndex(site->index);
+}
+
+void ProfileAccumEndSite(ProfileSite* site) {
+    if (ProfileOwnsSections()) {
+        if (site->generation != profilerGeneration) {
+            site->index = ProfileFindOrCreate(site->name, 0, -1, true);
+            site->generation = profilerGeneration;
+        }
+        ProfileAccumEndIndex(site->index);
+    }
+    ProfileTraceClose(site->name);
+}
+
 static int ProfileCounterFindOrCreate(const char* name) {
     for (int i = 0; i < profilerCounterCount; i++) {
         if (profilerCounters[i].name == name) return i;  // Pointer comparison
@@ -194,15 +521,37 @@ static int ProfileCounterFindOrCreate(const char* name) {
 }
 
 void ProfileCount(const char* name, int n) {
+    if (!ProfileOwnsSections()) return;
     int idx = ProfileCounterFindOrCreate(name);
     if (idx >= 0) profilerCounters[idx].frameCount += (uint64_t)n;
 }
 
 void ProfileCountSet(const char* name, int n) {
+    if (!ProfileOwnsSections()) return;
     int idx = ProfileCounterFindOrCreate(name);
     if (idx >= 0) profilerCounters[idx].frameCount = (uint64_t)n;
 }
 
+static int ProfileCounterSiteIndex(ProfileSite* site) {
+    if (site->generation != profilerGeneration) {
+        site->index = ProfileCounterFindOrCreate(site->name);
+        site->generation = profilerGeneration;
+    }
+    return site->index;
+}
+
+void ProfileCountSite(ProfileSite* site, int n) {
+    if (!ProfileOwnsSections()) return;
+    int idx = ProfileCounterSiteIndex(site);
+    if (idx >= 0) profilerCounters[idx].frameCount += (uint64_t)n;
+}
+
+void ProfileCountSetSite(ProfileSite* site, int n) {
+    if (!ProfileOwnsSections()) return;
+    int idx = ProfileCounterSiteIndex(site);
+    if (idx >= 0) profilerCounters[idx].frameCount = (uint64_t)n;
+}
+
 uint64_t ProfileCountGetLast(int counterIndex) {
     if (counterIndex < 0 || counterIndex >= profilerCounterCount) return 0;
     ProfileCounter* c = &profilerCounters[counterIndex];
@@ -245,6 +594,10 @@ double ProfileCountGetAvg(int counterIndex) {
 }
 
 void ProfileFrameEnd(void) {
+    if (profilerTraceEnabled) {
+        ProfileTraceCounters();
+        ProfileTraceDrain();
+    }
     // Store lastTimeMs (or accumTimeMs) into history for each section
     for (int i = 0; i < profilerSectionCount; i++) {
         ProfileSection* s = &profilerSections[i];
@@ -274,6 +627,7 @@ void ProfileFrameEnd(void) {
 void ProfileReset(void) {
     profilerSectionCount = 0;
     profilerCounterCount = 0;
+    profilerGeneration++;
 }
 
 double ProfileGetMin(int sectionIndex) {
@@ -3,21 +3,273 @@
 #include "../simulation/weather.h"
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
 
-static char eventLogBuffer[EVENT_LOG_MAX_ENTRIES][EVENT_LOG_MAX_LENGTH];
-static int eventLogHead = 0;   // next write position
-static int eventLogCount = 0;  // total entries (capped at MAX_ENTRIES)
+#define EVENT_LOG_MAGIC   0x5645564E  // "NVEV"
+#define EVENT_LOG_VERSION 1
+#define EVENT_LOG_GET_BUFFERS 4       // EventLogGet results alive at once
 
-void EventLog(const char* fmt, ...) {
-    char* entry = eventLogBuffer[eventLogHead];
+typedef enum {
+    EVARG_INT,          // int, char, short (promoted), '*' width/precision
+    EVARG_LONG,         // l, ll, j, z, t
+    EVARG_DOUBLE,
+    EVARG_LONG_DOUBLE,  // packed as a double
+    EVARG_STRING,       // uint8 length + bytes
+    EVARG_POINTER,
+} EventArgType;
 
-    // Timestamp prefix: [Season Dd HH:MM]
-    int hour = (int)timeOfDay;
-    int minute = (int)((timeOfDay - hour) * 60.0f);
-    Season season = GetCurrentSeason();
-    int dayInSeason = (GetYearDay() % daysPerSeason) + 1;
-    const char* seasonName = GetSeasonName(season);
+typedef struct {
+    const char* fmt;
+    uint8_t argTypes[EVENT_LOG_MAX_ARGS];
+    int argCount;
+} EventFormat;
+
+typedef struct {
+    uint64_t seq;
+    float timeOfDay;
+    uint16_t formatId;
+    uint16_t argBytes;
+    uint16_t dayInSeason;
+    uint8_t season;
+    uint8_t args[EVENT_LOG_ARG_BYTES];
+} EventRecord;
+
+typedef struct {
+    atomic_uint_fast64_t head;  // records ever written; slot = index % EVENT_LOG_MAX_ENTRIES
+    EventRecord records[EVENT_LOG_MAX_ENTRIES];
+} EventRing;
+
+// A record in merged order: ring + absolute index
+typedef struct {
+    uint64_t seq;
+    uint64_t index;
+    int ring;
+} EventRef;
+
+typedef struct {
+    EventRef* refs;
+    int count;
+    int capacity;
+} EventRefList;
+
+static EventFormat formats[EVENT_LOG_MAX_FORMATS];
+static atomic_bool formatReady[EVENT_LOG_MAX_FORMATS];
+static atomic_int formatCount;
+
+static _Atomic(EventRing*) rings[EVENT_LOG_MAX_THREADS];
+static atomic_int ringCount;
+static atomic_int ringFree[EVENT_LOG_MAX_THREADS];  // released by EventLogThreadExit
+static _Thread_local EventRing* threadRing = NULL;
+static _Thread_local int threadRingIndex = -1;
+static _Thread_local bool threadRingFailed = false;
+
+static atomic_uint_fast64_t nextSeq;
+static uint64_t clearedSeq = 0;  // records before this were cleared
+
+// Reader snapshot for Count/Get/Dump, rebuilt when new records arrive
+static EventRefList snapshot;
+static uint64_t snapshotNextSeq = UINT64_MAX;
+static uint64_t snapshotClearedSeq = 0;
+static char getBuffers[EVENT_LOG_GET_BUFFERS][EVENT_LOG_MAX_LENGTH];
+static int getBufferNext = 0;
+
+static FILE* streamFile = NULL;
+static uint64_t streamSeq = 0;       // next sequence number the stream expects
+static int streamFormats = 0;        // format strings written so far
+static uint64_t streamRingFrom[EVENT_LOG_MAX_THREADS];
+static EventRefList streamRefs;
+
+// ============================================================================
+// Formats
+// ============================================================================
+
+// Argument types of a printf format, in order. Returns the count.
+static int ParseEventFormat(const char* fmt, uint8_t* types) {
+    int n = 0;
+    const char* p = fmt;
+    while (*p) {
+        if (*p++ != '%') continue;
+        if (*p == '%') { p++; continue; }
+        while (*p && strchr("-+ #0'", *p)) p++;
+        if (*p == '*') { if (n < EVENT_LOG_MAX_ARGS) types[n++] = EVARG_INT; p++; }
+        while (*p >= '0' && *p <= '9') p++;
+        if (*p == '.') {
+            p++;
+            if (*p == '*') { if (n < EVENT_LOG_MAX_ARGS) types[n++] = EVARG_INT; p++; }
+            while (*p >= '0' && *p <= '9') p++;
+        }
+        bool isLong = false, isLongDouble = false;
+        while (*p && strchr("hlLqjzt", *p)) {
+            if (*p == 'L') isLongDouble = true;
+            else if (*p != 'h') isLong = true;
+            p++;
+        }
+        if (!*p) break;
+        uint8_t type;
+        switch (*p++) {
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                type = isLongDouble ? EVARG_LONG_DOUBLE : EVARG_DOUBLE; break;
+            case 's': type = EVARG_STRING; break;
+            case 'p': case 'n': type = EVARG_POINTER; break;
+            default: type = isLong ? EVARG_LONG : EVARG_INT; break;
+        }
+        if (n < EVENT_LOG_MAX_ARGS) types[n++] = type;
+    }
+    return n;
+}
+
+static int InternEventFormat(const char* fmt) {
+    int id = atomic_fetch_add(&formatCount, 1);
+    if (id >= EVENT_LOG_MAX_FORMATS) return -1;
+    formats[id].fmt = fmt;
+    formats[id].argCount = ParseEventFormat(fmt, formats[id].argTypes);
+    atomic_store_explicit(&formatReady[id], true, memory_order_release);
+    return id;
+}
+
+static const EventFormat* GetEventFormat(int id) {
+    if (id < 0 || id >= EVENT_LOG_MAX_FORMATS) return NULL;
+    if (!atomic_load_explicit(&formatReady[id], memory_order_acquire)) return NULL;
+    return &formats[id];
+}
+
+// ============================================================================
+// Append
+// ============================================================================
+
+// Rings of exited threads are reused before new ones are made. A reused ring
+// keeps its older records; the new owner's sequence numbers are all later,
+// so the ring stays in order.
+static EventRing* GetThreadRing(void) {
+    if (threadRing || threadRingFailed) return threadRing;
+    int count = atomic_load(&ringCount);
+    if (count > EVENT_LOG_MAX_THREADS) count = EVENT_LOG_MAX_THREADS;
+    for (int r = 0; r < count; r++) {
+        int expected = 1;
+        if (atomic_compare_exchange_strong(&ringFree[r], &expected, 0)) {
+            threadRing = atomic_load_explicit(&rings[r], memory_order_acquire);
+            threadRingIndex = r;
+            return threadRing;
+        }
+    }
+
+    int idx = atomic_fetch_add(&ringCount, 1);
+    EventRing* ring = idx < EVENT_LOG_MAX_THREADS ? calloc(1, sizeof(EventRing)) : NULL;
+    if (!ring) {
+        threadRingFailed = true;
+        return NULL;
+    }
+    atomic_store_explicit(&rings[idx], ring, memory_order_release);
+    threadRing = ring;
+    threadRingIndex = idx;
+    return ring;
+}
+
+void EventLogThreadExit(void) {
+    if (threadRing) atomic_store(&ringFree[threadRingIndex], 1);
+    threadRing = NULL;
+    threadRingIndex = -1;
+    threadRingFailed = false;
+}
+
+static int PackEventArgs(const EventFormat* f, uint8_t* out, va_list args) {
+    int used = 0;
+    for (int i = 0; i < f->argCount; i++) {
+        switch (f->argTypes[i]) {
+            case EVARG_INT: {
+                int v = va_arg(args, int);
+                if (used + (int)sizeof(v) > EVENT_LOG_ARG_BYTES) return used;
+                memcpy(out + used, &v, sizeof(v));
+                used += sizeof(v);
+                break;
+            }
+            case EVARG_LONG: {
+                long long v = va_arg(args, long long);
+                if (used + (int)sizeof(v) > EVENT_LOG_ARG_BYTES) return used;
+                memcpy(out + used, &v, sizeof(v));
+                used += sizeof(v);
+                break;
+            }
+            case EVARG_DOUBLE:
+            case EVARG_LONG_DOUBLE: {
+                double v = f->argTypes[i] == EVARG_DOUBLE ? va_arg(args, double) : (double)va_arg(args, long double);
+                if (used + (int)sizeof(v) > EVENT_LOG_ARG_BYTES) return used;
+                memcpy(out + used, &v, sizeof(v));
+                used += sizeof(v);
+                break;
+            }
+            case EVARG_STRING: {
+                const char* s = va_arg(args, const char*);
+                if (!s) s = "(null)";
+                int room = EVENT_LOG_ARG_BYTES - used - 1;
+                if (room < 0) return used;
+                if (room > 255) room = 255;
+                int len = 0;
+                while (len < room && s[len]) {
+                    out[used + 1 + len] = (uint8_t)s[len];
+                    len++;
+                }
+                out[used] = (uint8_t)len;
+                used += 1 + len;
+                break;
+            }
+            case EVARG_POINTER: {
+                uint64_t v = (uint64_t)(uintptr_t)va_arg(args, void*);
+                if (used + (int)sizeof(v) > EVENT_LOG_ARG_BYTES) return used;
+                memcpy(out + used, &v, sizeof(v));
+                used += sizeof(v);
+                break;
+            }
+        }
+    }
+    return used;
+}
+
+void EventLogWrite(atomic_int* siteId, const char* fmt, ...) {
+    int site = atomic_load_explicit(siteId, memory_order_acquire);
+    if (site == 0) {
+        int id = InternEventFormat(fmt);
+        site = id >= 0 ? id + 1 : -1;
+        atomic_store_explicit(siteId, site, memory_order_release);
+    }
+    if (site < 0) return;
+
+    EventRing* ring = GetThreadRing();
+    if (!ring) return;
+
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    EventRecord* r = &ring->records[head % EVENT_LOG_MAX_ENTRIES];
+    r->seq = atomic_fetch_add_explicit(&nextSeq, 1, memory_order_relaxed);
+    r->formatId = (uint16_t)(site - 1);
+    r->timeOfDay = timeOfDay;
+    r->season = (uint8_t)GetCurrentSeason();
+    r->dayInSeason = (uint16_t)((GetYearDay() % daysPerSeason) + 1);
+
+    va_list args;
+    va_start(args, fmt);
+    r->argBytes = (uint16_t)PackEventArgs(&formats[site - 1], r->args, args);
+    va_end(args);
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+// ============================================================================
+// Read
+// ============================================================================
+
+static bool TakeEventArg(const uint8_t** a, const uint8_t* end, void* v, size_t size) {
+    if (*a + size > end) return false;
+    memcpy(v, *a, size);
+    *a += size;
+    return true;
+}
+
+// Renders "[Sea Dd HH:MM] message" with the record's packed arguments
+static void RenderEvent(const EventRecord* r, const EventFormat* f, char* out, size_t size) {
+    int hour = (int)r->timeOfDay;
+    int minute = (int)((r->timeOfDay - hour) * 60.0f);
+    const char* seasonName = GetSeasonName((Season)r->season);
     // Abbreviate season to 3 chars
     char seasonAbbr[4] = {0};
     if (seasonName) {
@@ -26,24 +278,176 @@ void EventLog(const char* fmt, ...) {
         seasonAbbr[2] = seasonName[2];
     }
 
-    int prefixLen = snprintf(entry, EVENT_LOG_MAX_LENGTH, "[%s D%d %02d:%02d] ",
-                             seasonAbbr, dayInSeason, hour, minute);
+    int prefixLen = snprintf(out, size, "[%s D%d %02d:%02d] ", seasonAbbr, r->dayInSeason, hour, minute);
     if (prefixLen < 0) prefixLen = 0;
-    if (prefixLen >= EVENT_LOG_MAX_LENGTH) prefixLen = EVENT_LOG_MAX_LENGTH - 1;
+    size_t len = (size_t)prefixLen < size ? (size_t)prefixLen : size - 1;
+    if (!f) {
+        snprintf(out + len, size - len, "<unknown event %d>", r->formatId);
+        return;
+    }
 
-    // User message
-    va_list args;
-    va_start(args, fmt);
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wformat-nonliteral"
-    vsnprintf(entry + prefixLen, EVENT_LOG_MAX_LENGTH - prefixLen, fmt, args);
-#pragma clang diagnostic pop
-    va_end(args);
+    const uint8_t* a = r->args;
+    const uint8_t* end = r->args + r->argBytes;
+    int argIndex = 0;
+    const char* p = f->fmt;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    while (*p && len < size - 1) {
+        if (*p != '%') { out[len++] = *p++; continue; }
+        if (p[1] == '%') { out[len++] = '%'; p += 2; continue; }
+
+        // Rebuild the conversion without length modifiers; '*' becomes its packed value
+        char spec[48];
+        int sl = 0;
+        bool ok = true;
+        spec[sl++] = *p++;
+        while (*p && strchr("-+ #0'", *p) && sl < 8) spec[sl++] = *p++;
+        for (int part = 0; part < 2; part++) {
+            if (part == 1) {
+                if (*p != '.') break;
+                spec[sl++] = *p++;
+            }
+            if (*p == '*') {
+                int v = 0;
+                ok = ok && argIndex < f->argCount && TakeEventArg(&a, end, &v, sizeof(v));
+                argIndex++;
+                sl += snprintf(spec + sl, sizeof(spec) - (size_t)sl, "%d", v);
+                p++;
+            }
+            while (*p >= '0' && *p <= '9') {
+                if (sl < 40) spec[sl++] = *p;
+                p++;
+            }
+        }
+        while (*p && strchr("hlLqjzt", *p)) p++;
+        if (!*p) break;
+        char conv = *p++;
+
+        uint8_t type = argIndex < f->argCount ? f->argTypes[argIndex] : EVARG_INT;
+        ok = ok && argIndex < f->argCount;
+        argIndex++;
+
+        int written = 0;
+        switch (type) {
+            case EVARG_INT: {
+                int v;
+                if (!(ok = ok && TakeEventArg(&a, end, &v, sizeof(v)))) break;
+                spec[sl] = conv; spec[sl + 1] = '\0';
+                written = snprintf(out + len, size - len, spec, v);
+                break;
+            }
+            case EVARG_LONG: {
+                long long v;
+                if (!(ok = ok && TakeEventArg(&a, end, &v, sizeof(v)))) break;
+                spec[sl] = 'l'; spec[sl + 1] = 'l'; spec[sl + 2] = conv; spec[sl + 3] = '\0';
+                written = snprintf(out + len, size - len, spec, v);
+                break;
+            }
+            case EVARG_DOUBLE:
+            case EVARG_LONG_DOUBLE: {
+                double v;
+                if (!(ok = ok && TakeEventArg(&a, end, &v, sizeof(v)))) break;
+                spec[sl] = conv; spec[sl + 1] = '\0';
+                written = snprintf(out + len, size - len, spec, v);
+                break;
+            }
+            case EVARG_STRING: {
+                uint8_t n;
+                char s[256];
+                if (!(ok = ok && TakeEventArg(&a, end, &n, 1) && TakeEventArg(&a, end, s, n))) break;
+                s[n] = '\0';
+                spec[sl] = 's'; spec[sl + 1] = '\0';
+                written = snprintf(out + len, size - len, spec, s);
+                break;
+            }
+            case EVARG_POINTER: {
+                uint64_t v;
+                if (!(ok = ok && TakeEventArg(&a, end, &v, sizeof(v)))) break;
+                if (conv == 'n') break;
+                spec[sl] = 'p'; spec[sl + 1] = '\0';
+                written = snprintf(out + len, size - len, spec, (void*)(uintptr_t)v);
+                break;
+            }
+        }
+        // Arguments cut off by EVENT_LOG_ARG_BYTES
+        if (!ok) written = snprintf(out + len, size - len, "?");
+        if (written > 0) len += (size_t)written;
+        if (len > size - 1) len = size - 1;
+    }
+#pragma GCC diagnostic pop
+    out[len] = '\0';
+}
+
+// Copies a record unless the ring has overwritten it since ref was taken
+static bool ReadEventRecord(const EventRef* ref, EventRecord* out) {
+    EventRing* ring = atomic_load_explicit(&rings[ref->ring], memory_order_acquire);
+    if (!ring) return false;
+    *out = ring->records[ref->index % EVENT_LOG_MAX_ENTRIES];
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - ref->index <= EVENT_LOG_MAX_ENTRIES && out->seq == ref->seq;
+}
+
+// Merges every ring's records with seq >= fromSeq into list, oldest first.
+// ringFrom (optional) holds the first index to look at per ring and is
+// advanced past what was collected.
+static void CollectEvents(uint64_t fromSeq, uint64_t* ringFrom, EventRefList* list) {
+    uint64_t cursor[EVENT_LOG_MAX_THREADS], end[EVENT_LOG_MAX_THREADS];
+    int ringTotal = atomic_load(&ringCount);
+    if (ringTotal > EVENT_LOG_MAX_THREADS) ringTotal = EVENT_LOG_MAX_THREADS;
 
-    entry[EVENT_LOG_MAX_LENGTH - 1] = '\0';
+    list->count = 0;
+    for (int r = 0; r < ringTotal; r++) {
+        EventRing* ring = atomic_load_explicit(&rings[r], memory_order_acquire);
+        cursor[r] = end[r] = 0;
+        if (!ring) continue;
+        end[r] = atomic_load_explicit(&ring->head, memory_order_acquire);
+        cursor[r] = end[r] > EVENT_LOG_MAX_ENTRIES ? end[r] - EVENT_LOG_MAX_ENTRIES : 0;
+        if (ringFrom && ringFrom[r] > cursor[r]) cursor[r] = ringFrom[r];
+        while (cursor[r] < end[r] && ring->records[cursor[r] % EVENT_LOG_MAX_ENTRIES].seq < fromSeq) cursor[r]++;
+    }
+
+    for (;;) {
+        int best = -1;
+        uint64_t bestSeq = UINT64_MAX;
+        for (int r = 0; r < ringTotal; r++) {
+            if (cursor[r] >= end[r]) continue;
+            EventRing* ring = atomic_load_explicit(&rings[r], memory_order_relaxed);
+            uint64_t seq = ring->records[cursor[r] % EVENT_LOG_MAX_ENTRIES].seq;
+            if (seq < bestSeq) { bestSeq = seq; best = r; }
+        }
+        if (best < 0) break;
+        if (list->count == list->capacity) {
+            int newCap = list->capacity ? list->capacity * 2 : EVENT_LOG_MAX_ENTRIES;
+            EventRef* grown = realloc(list->refs, (size_t)newCap * sizeof(EventRef));
+            if (!grown) break;
+            list->refs = grown;
+            list->capacity = newCap;
+        }
+        list->refs[list->count++] = (EventRef){ bestSeq, cursor[best], best };
+        cursor[best]++;
+    }
+
+    if (ringFrom) {
+        for (int r = 0; r < ringTotal; r++) ringFrom[r] = cursor[r];
+    }
+}
 
-    eventLogHead = (eventLogHead + 1) % EVENT_LOG_MAX_ENTRIES;
-    if (eventLogCount < EVENT_LOG_MAX_ENTRIES) eventLogCount++;
+static void EnsureEventSnapshot(void) {
+    uint64_t seq = atomic_load(&nextSeq);
+    if (seq == snapshotNextSeq && clearedSeq == snapshotClearedSeq) return;
+    CollectEvents(clearedSeq, NULL, &snapshot);
+    snapshotNextSeq = seq;
+    snapshotClearedSeq = clearedSeq;
+}
+
+static void RenderEventRef(const EventRef* ref, char* out, size_t size) {
+    EventRecord r;
+    if (!ReadEventRecord(ref, &r)) {
+        snprintf(out, size, "<overwritten>");
+        return;
+    }
+    RenderEvent(&r, GetEventFormat(r.formatId), out, size);
 }
 
 void EventLogDump(const char* filepath) {
@@ -51,39 +455,170 @@ void EventLogDump(const char* filepath) {
     if (!f) return;
 
     // Write from oldest to newest
-    int start;
-    if (eventLogCount < EVENT_LOG_MAX_ENTRIES) {
-        start = 0;
-    } else {
-        start = eventLogHead;  // oldest entry is at head (was overwritten next)
-    }
-
-    for (int i = 0; i < eventLogCount; i++) {
-        int idx = (start + i) % EVENT_LOG_MAX_ENTRIES;
-        fprintf(f, "%s\n", eventLogBuffer[idx]);
+    EnsureEventSnapshot();
+    char line[EVENT_LOG_MAX_LENGTH];
+    for (int i = 0; i < snapshot.count; i++) {
+        RenderEventRef(&snapshot.refs[i], line, sizeof(line));
+        fprintf(f, "%s\n", line);
     }
 
     fclose(f);
 }
 
 void EventLogClear(void) {
-    eventLogHead = 0;
-    eventLogCount = 0;
+    clearedSeq = atomic_load(&nextSeq);
 }
 
 int EventLogCount(void) {
-    return eventLogCount;
+    EnsureEventSnapshot();
+    return snapshot.count;
 }
 
 const char* EventLogGet(int index) {
-    if (index < 0 || index >= eventLogCount) return NULL;
+    EnsureEventSnapshot();
+    if (index < 0 || index >= snapshot.count) return NULL;
 
-    int start;
-    if (eventLogCount < EVENT_LOG_MAX_ENTRIES) {
-        start = 0;
-    } else {
-        start = eventLogHead;
+    char* out = getBuffers[getBufferNext];
+    getBufferNext = (getBufferNext + 1) % EVENT_LOG_GET_BUFFERS;
+    RenderEventRef(&snapshot.refs[index], out, EVENT_LOG_MAX_LENGTH);
+    return out;
+}
+
+// ============================================================================
+// Binary stream
+// ============================================================================
+// Header: uint32 magic, uint32 version. Then tagged records:
+//   'F' uint16 id, uint16 length, format text    (before its first event)
+//   'E' uint64 seq, uint16 formatId, float timeOfDay, uint8 season,
+//       uint16 dayInSeason, uint16 argBytes, packed args
+//   'D' uint64 count                              (events lost to ring overrun)
+
+static void StreamWrite(const void* data, size_t size) {
+    fwrite(data, size, 1, streamFile);
+}
+
+static void StreamWriteFormats(int upToId) {
+    while (streamFormats <= upToId) {
+        const EventFormat* f = GetEventFormat(streamFormats);
+        if (f) {
+            uint16_t id = (uint16_t)streamFormats;
+            uint16_t length = (uint16_t)strlen(f->fmt);
+            fputc('F', streamFile);
+            StreamWrite(&id, sizeof(id));
+            StreamWrite(&length, sizeof(length));
+            StreamWrite(f->fmt, length);
+        }
+        streamFormats++;
+    }
+}
+
+bool EventLogStreamStart(const char* filepath) {
+    EventLogStreamStop();
+    streamFile = fopen(filepath, "wb");
+    if (!streamFile) return false;
+    uint32_t magic = EVENT_LOG_MAGIC, version = EVENT_LOG_VERSION;
+    StreamWrite(&magic, sizeof(magic));
+    StreamWrite(&version, sizeof(version));
+    streamSeq = clearedSeq;
+    streamFormats = 0;
+    memset(streamRingFrom, 0, sizeof(streamRingFrom));
+    return true;
+}
+
+void EventLogStreamFlush(void) {
+    if (!streamFile) return;
+    CollectEvents(streamSeq, streamRingFrom, &streamRefs);
+    for (int i = 0; i < streamRefs.count; i++) {
+        EventRecord r;
+        if (!ReadEventRecord(&streamRefs.refs[i], &r)) continue;
+        if (r.seq > streamSeq) {
+            uint64_t dropped = r.seq - streamSeq;
+            fputc('D', streamFile);
+            StreamWrite(&dropped, sizeof(dropped));
+        }
+        StreamWriteFormats(r.formatId);
+        fputc('E', streamFile);
+        StreamWrite(&r.seq, sizeof(r.seq));
+        StreamWrite(&r.formatId, sizeof(r.formatId));
+        StreamWrite(&r.timeOfDay, sizeof(r.timeOfDay));
+        StreamWrite(&r.season, sizeof(r.season));
+        StreamWrite(&r.dayInSeason, sizeof(r.dayInSeason));
+        StreamWrite(&r.argBytes, sizeof(r.argBytes));
+        StreamWrite(r.args, r.argBytes);
+        streamSeq = r.seq + 1;
+    }
+    if (streamRefs.count > 0) fflush(streamFile);
+}
+
+void EventLogStreamStop(void) {
+    if (!streamFile) return;
+    EventLogStreamFlush();
+    fclose(streamFile);
+    streamFile = NULL;
+}
+
+static bool ReadField(FILE* f, void* v, size_t size) {
+    return fread(v, size, 1, f) == 1;
+}
+
+bool EventLogDecodeFile(const char* filepath, FILE* out, const char* filter) {
+    FILE* f = fopen(filepath, "rb");
+    if (!f) return false;
+    uint32_t magic, version;
+    if (!ReadField(f, &magic, sizeof(magic)) || !ReadField(f, &version, sizeof(version)) ||
+        magic != EVENT_LOG_MAGIC || version != EVENT_LOG_VERSION) {
+        fclose(f);
+        return false;
     }
-    int idx = (start + index) % EVENT_LOG_MAX_ENTRIES;
-    return eventLogBuffer[idx];
+
+    EventFormat* decoded = calloc(EVENT_LOG_MAX_FORMATS, sizeof(EventFormat));
+    char** texts = calloc(EVENT_LOG_MAX_FORMATS, sizeof(char*));
+    if (!decoded || !texts) {
+        free(decoded);
+        free(texts);
+        fclose(f);
+        return false;
+    }
+    bool ok = true;
+    char line[EVENT_LOG_MAX_LENGTH];
+    int tag;
+    while (ok && (tag = fgetc(f)) != EOF) {
+        if (tag == 'F') {
+            uint16_t id, length;
+            ok = ReadField(f, &id, sizeof(id)) && ReadField(f, &length, sizeof(length)) && id < EVENT_LOG_MAX_FORMATS;
+            char* text = ok ? malloc((size_t)length + 1) : NULL;
+            if (!text || (length > 0 && !ReadField(f, text, length))) {
+                free(text);
+                ok = false;
+                break;
+            }
+            text[length] = '\0';
+            free(texts[id]);
+            texts[id] = text;
+            decoded[id].fmt = text;
+            decoded[id].argCount = ParseEventFormat(text, decoded[id].argTypes);
+        } else if (tag == 'E') {
+            EventRecord r;
+            ok = ReadField(f, &r.seq, sizeof(r.seq)) && ReadField(f, &r.formatId, sizeof(r.formatId)) &&
+                 ReadField(f, &r.timeOfDay, sizeof(r.timeOfDay)) && ReadField(f, &r.season, sizeof(r.season)) &&
+                 ReadField(f, &r.dayInSeason, sizeof(r.dayInSeason)) && ReadField(f, &r.argBytes, sizeof(r.argBytes)) &&
+                 r.argBytes <= EVENT_LOG_ARG_BYTES && (r.argBytes == 0 || ReadField(f, r.args, r.argBytes));
+            if (!ok) break;
+            const EventFormat* fmt = r.formatId < EVENT_LOG_MAX_FORMATS && decoded[r.formatId].fmt ? &decoded[r.formatId] : NULL;
+            RenderEvent(&r, fmt, line, sizeof(line));
+            if (!filter || strstr(line, filter)) fprintf(out, "%s\n", line);
+        } else if (tag == 'D') {
+            uint64_t dropped;
+            ok = ReadField(f, &dropped, sizeof(dropped));
+            if (ok && !filter) fprintf(out, "... %llu events dropped ...\n", (unsigned long long)dropped);
+        } else {
+            ok = false;
+        }
+    }
+
+    for (int i = 0; i < EVENT_LOG_MAX_FORMATS; i++) free(texts[i]);
+    free(texts);
+    free(decoded);
+    fclose(f);
+    return ok;
 }
@@ -1,17 +1,70 @@
+// event_log.h - Binary event log
+//
+// EventLog() keeps the printf-style call sites but doesn't format anything.
+// Each call site interns its format string once (a small id), and every call
+// writes a fixed-size record: id, game time and the packed arguments (ints,
+// doubles, copied strings) into the calling thread's ring. The text,
+// "[Spr D3 08:15] Job 12 DONE type=HAUL mover=4", is only rendered when
+// something reads the log: EventLogGet, EventLogDump, or the offline decoder.
+//
+// Each thread owns its ring, so appends take no lock. A global sequence
+// number orders records across rings; readers merge them. Worker threads
+// call EventLogThreadExit before returning so the next thread reuses the
+// ring (like ProfileThreadExit for trace lanes).
+//
+// Streaming: EventLogStreamStart writes every record to a binary file (the
+// format strings go in once, as they're first seen). EventLogStreamFlush
+// drains the rings into it and runs once per sim tick, so a long headless
+// run keeps its full history, not just the last EVENT_LOG_MAX_ENTRIES.
+// Decode with: ./bin/path --events <file> [--grep TEXT]
+//
+// Usage:
+//   EventLog("Job %d DONE type=%s mover=%d", id, JobTypeName(type), i);
+//   EventLogDump("navkit_events.log");       // text, oldest first
+
 #ifndef EVENT_LOG_H
 #define EVENT_LOG_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdatomic.h>
+
+#define EVENT_LOG_MAX_ENTRIES 4096   // records per thread ring
+#define EVENT_LOG_MAX_LENGTH  200    // rendered line, prefix included
+#define EVENT_LOG_MAX_THREADS 32     // rings in use at once (see EventLogThreadExit)
+#define EVENT_LOG_MAX_FORMATS 1024   // interned call sites
+#define EVENT_LOG_MAX_ARGS    16
+#define EVENT_LOG_ARG_BYTES   104    // packed arguments per record (strings are truncated to fit)
+
+// Format string must be a literal: it's kept by pointer, not copied
+#define EventLog(...) do { \
+        static atomic_int eventLogId_; \
+        EventLogWrite(&eventLogId_, __VA_ARGS__); \
+    } while (0)
 
-#define EVENT_LOG_MAX_ENTRIES 4096
-#define EVENT_LOG_MAX_LENGTH  200
+void EventLogWrite(atomic_int* siteId, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// Worker thread done: hand its ring back for reuse. Threads that log and
+// exit without calling this keep their ring; past EVENT_LOG_MAX_THREADS
+// rings, new threads' events are dropped.
+void EventLogThreadExit(void);
 
-void EventLog(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
 void EventLogDump(const char* filepath);
 void EventLogClear(void);
 int  EventLogCount(void);
 
 // Get entry by index (0 = oldest in buffer). Returns NULL if out of range.
+// The text is rendered on demand and stays valid for the next few calls only.
 const char* EventLogGet(int index);
 
+// --- Binary stream ---
+bool EventLogStreamStart(const char* filepath);
+void EventLogStreamFlush(void);   // between ticks, when no other thread is logging
+void EventLogStreamStop(void);    // flushes and closes
+
+// Renders a stream file as text, one event per line. Lines not containing
+// `filter` are skipped (NULL = all). Returns false if the file can't be read.
+bool EventLogDecodeFile(const char* filepath, FILE* out, const char* filter);
+
 #endif
@@ -2,6 +2,7 @@
 #include "../game_state.h"
 #include "../world/cell_defs.h"
 #include "../world/designations.h"
+#include "../world/cell_edits.h"
 #include "../world/material.h"
 #include "../entities/workshops.h"
 #include "../simulation/smoke.h"
@@ -15,6 +16,7 @@
 #include "input_mode.h"
 #include "action_registry.h"
 #include "pie_menu.h"
+#include "replay.h"
 
 // Forward declaration
 void HandleInput(void);
@@ -930,10 +932,10 @@ static void ExecuteCancelKnap(int x1, int y1, int x2, int y2, int z) {
     for (int dy = y1; dy <= y2; dy++) {
         for (int dx = x1; dx <= x2; dx++) {
             // Check both z and z-1 (designation lives on the wall, not the air above)
-            if (z >= 0 && z < gridDepth && designations[z][dy][dx].type == DESIGNATION_KNAP) {
+            if (z >= 0 && z < gridDepth && DesignationAt(dx, dy, z)->type == DESIGNATION_KNAP) {
                 CancelDesignation(dx, dy, z);
                 count++;
-            } else if (z > 0 && designations[z-1][dy][dx].type == DESIGNATION_KNAP) {
+            } else if (z > 0 && DesignationAt(dx, dy, z-1)->type == DESIGNATION_KNAP) {
                 CancelDesignation(dx, dy, z - 1);
                 count++;
             }
@@ -1434,7 +1436,7 @@ static void ExecuteRemoveFire(int x1, int y1, int x2, int y2, int z, bool shift)
                 fireZ = z - 1;
             }
             
-            FireCell* cell = &fireGrid[fireZ][dy][dx];
+            const FireCell* cell = FireCellAt(dx, dy, fireZ);
             if (cell->isSource) { SetFireSource(dx, dy, fireZ, false); removedSources++; }
             if (!shift && cell->level > 0) { ExtinguishCell(dx, dy, fireZ); extinguished++; }
         }
@@ -1572,7 +1574,7 @@ static void ExecutePlaceGrass(int x1, int y1, int x2, int y2, int z) {
             if (grid[z][dy][dx] == CELL_WALL && GetWallMaterial(dx, dy, z) == MAT_DIRT) {
                 // Set tall grass overlay and reset wear
                 SetVegetation(dx, dy, z, VEG_GRASS_TALL);
-                wearGrid[z][dy][dx] = 0;
+                SetGroundWear(dx, dy, z, 0);
                 CLEAR_CELL_FLAG(dx, dy, z, CELL_FLAG_BURNED);
                 count++;
             }
@@ -1592,7 +1594,7 @@ static void ExecuteRemoveGrass(int x1, int y1, int x2, int y2, int z) {
                 int surface = GET_CELL_SURFACE(dx, dy, z);
                 if (surface != SURFACE_BARE) {
                     SET_CELL_SURFACE(dx, dy, z, SURFACE_BARE);
-                    wearGrid[z][dy][dx] = wearMax;  // Set max wear so grass doesn't regrow immediately
+                    SetGroundWear(dx, dy, z, wearMax);  // Set max wear so grass doesn't regrow immediately
                     count++;
                 }
             }
@@ -1929,6 +1931,489 @@ static void InterpolateBrushStroke(int x0, int y0, int x1, int y1, int z, int ra
 // ============================================================================
 
 // Helper to check key press OR pending key from mouse click
+// ============================================================================
+// Drag actions
+// ============================================================================
+
+static void RunDragCommand(const DragCommand* cmd);
+
+// Runs a finished drag. Everything the action reads comes from the command,
+// so a replay issues exactly what the player did. The cells it edits are one
+// transaction: invalidations fan out once at the end, not per cell.
+void ExecuteDragCommand(const DragCommand* cmd) {
+    ReplayRecordDrag(cmd);
+    BeginCellEdits();
+    RunDragCommand(cmd);
+    CommitCellEdits();
+}
+
+static void RunDragCommand(const DragCommand* cmd) {
+    selectedMaterial = cmd->material;
+    selectedWallRecipe = cmd->wallRecipe;
+    selectedFloorRecipe = cmd->floorRecipe;
+    selectedLadderRecipe = cmd->ladderRecipe;
+    selectedFurnitureRecipe = cmd->furnitureRecipe;
+    selectedDoorRecipe = cmd->doorRecipe;
+    selectedRampDirection = (CellType)cmd->rampDirection;
+    currentTreeType = (MaterialType)cmd->treeType;
+
+    InputAction action = (InputAction)cmd->action;
+    bool leftClick = cmd->leftClick;
+    bool shift = cmd->shift;
+    int x1 = cmd->x1, y1 = cmd->y1, x2 = cmd->x2, y2 = cmd->y2;
+    int z = cmd->z1;
+
+    // In front view: drag covers X range + Z range at fixed world Y
+    if (cmd->frontView) {
+        for (int fz = cmd->z1; fz <= cmd->z2; fz++) {
+            switch (action) {
+                case ACTION_DRAW_WALL:
+                    if (leftClick) ExecuteBuildWall(x1, y1, x2, y2, fz);
+                    else ExecuteErase(x1, y1, x2, y2, fz);
+                    break;
+                case ACTION_DRAW_FLOOR:
+                    if (leftClick) ExecuteBuildFloor(x1, y1, x2, y2, fz);
+                    else ExecuteErase(x1, y1, x2, y2, fz);
+                    break;
+                case ACTION_DRAW_LADDER:
+                    if (leftClick) ExecuteBuildLadder(x1, y1, x2, y2, fz);
+                    else ExecuteErase(x1, y1, x2, y2, fz);
+                    break;
+                case ACTION_DRAW_SOIL_DIRT:
+                    if (leftClick) ExecuteBuildSoil(x1, y1, x2, y2, fz, CELL_WALL, MAT_DIRT, "dirt");
+                    else ExecuteErase(x1, y1, x2, y2, fz);
+                    break;
+                case ACTION_DRAW_SOIL_ROCK:
+                    if (leftClick) ExecuteBuildRock(x1, y1, x2, y2, fz);
+                    else ExecuteErase(x1, y1, x2, y2, fz);
+                    break;
+                default: break;
+            }
+        }
+        return;
+    }
+
+    switch (action) {
+        // Draw actions
+        case ACTION_DRAW_WALL:
+            if (leftClick) ExecuteBuildWall(x1, y1, x2, y2, z);
+            else ExecuteErase(x1, y1, x2, y2, z);
+            break;
+        case ACTION_DRAW_FLOOR:
+            if (leftClick) ExecuteBuildFloor(x1, y1, x2, y2, z);
+            else ExecuteErase(x1, y1, x2, y2, z);
+            break;
+        case ACTION_DRAW_LADDER:
+            if (leftClick) ExecuteBuildLadder(x1, y1, x2, y2, z);
+            else ExecuteErase(x1, y1, x2, y2, z);
+            break;
+        case ACTION_DRAW_RAMP:
+            if (leftClick) ExecuteBuildRamp(x1, y1, x2, y2, z);
+            else ExecuteEraseRamp(x1, y1, x2, y2, z);
+            break;
+        case ACTION_DRAW_STOCKPILE:
+            if (leftClick) ExecuteCreateStockpile(x1, y1, x2, y2, z);
+            else ExecuteEraseStockpile(x1, y1, x2, y2, z);
+            break;
+        case ACTION_DRAW_REFUSE_PILE:
+            if (leftClick) ExecuteCreateRefusePile(x1, y1, x2, y2, z);
+            else ExecuteEraseStockpile(x1, y1, x2, y2, z);
+            break;
+        case ACTION_DRAW_WORKSHOP_STONECUTTER:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_STONECUTTER);
+            break;
+        case ACTION_DRAW_WORKSHOP_SAWMILL:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_SAWMILL);
+            break;
+        case ACTION_DRAW_WORKSHOP_KILN:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_KILN);
+            break;
+        case ACTION_DRAW_WORKSHOP_CHARCOAL_PIT:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_CHARCOAL_PIT);
+            break;
+        case ACTION_DRAW_WORKSHOP_HEARTH:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_HEARTH);
+            break;
+        case ACTION_DRAW_WORKSHOP_DRYING_RACK:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_DRYING_RACK);
+            break;
+        case ACTION_DRAW_WORKSHOP_ROPE_MAKER:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_ROPE_MAKER);
+            break;
+        case ACTION_DRAW_WORKSHOP_CARPENTER:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_CARPENTER);
+            break;
+        case ACTION_DRAW_WORKSHOP_CAMPFIRE:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_CAMPFIRE);
+            break;
+        case ACTION_DRAW_WORKSHOP_GROUND_FIRE:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_GROUND_FIRE);
+            break;
+        case ACTION_DRAW_WORKSHOP_BUTCHER:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_BUTCHER);
+            break;
+        case ACTION_DRAW_WORKSHOP_COMPOST_PILE:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_COMPOST_PILE);
+            break;
+        case ACTION_DRAW_WORKSHOP_QUERN:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_QUERN);
+            break;
+        case ACTION_DRAW_WORKSHOP_LOOM:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_LOOM);
+            break;
+        case ACTION_DRAW_WORKSHOP_TANNING_RACK:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_TANNING_RACK);
+            break;
+        case ACTION_DRAW_WORKSHOP_TAILOR:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_TAILOR);
+            break;
+        case ACTION_DRAW_WORKSHOP_MUD_MIXER:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_MUD_MIXER);
+            break;
+        case ACTION_DRAW_WORKSHOP_STOVE:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_STOVE);
+            break;
+        case ACTION_DRAW_WORKSHOP_COUNTER:
+            if (leftClick) ExecutePlaceWorkshop(cmd->dragX, cmd->dragY, z, WORKSHOP_COUNTER);
+            break;
+        case ACTION_DRAW_SOIL_DIRT:
+            if (leftClick) {
+                if (shift) {
+                    // Pile mode - place single block at drag start with gravity/spreading
+                    ExecutePileSoil(cmd->dragX, cmd->dragY, z, CELL_WALL, MAT_DIRT, "dirt");
+                } else {
+                    ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_DIRT, "dirt");
+                }
+            }
+            break;
+        case ACTION_DRAW_SOIL_CLAY:
+            if (leftClick) {
+            if (shift) {
+                ExecutePileSoil(cmd->dragX, cmd->dragY, z, CELL_WALL, MAT_CLAY, "clay");
+            } else {
+                ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_CLAY, "clay");
+            }
+            }
+            break;
+        case ACTION_DRAW_SOIL_GRAVEL:
+            if (leftClick) {
+            if (shift) {
+                ExecutePileSoil(cmd->dragX, cmd->dragY, z, CELL_WALL, MAT_GRAVEL, "gravel");
+            } else {
+                ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_GRAVEL, "gravel");
+            }
+            }
+            break;
+        case ACTION_DRAW_SOIL_SAND:
+            if (leftClick) {
+            if (shift) {
+                ExecutePileSoil(cmd->dragX, cmd->dragY, z, CELL_WALL, MAT_SAND, "sand");
+            } else {
+                ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_SAND, "sand");
+            }
+            }
+            break;
+        case ACTION_DRAW_SOIL_PEAT:
+            if (leftClick) {
+            if (shift) {
+                ExecutePileSoil(cmd->dragX, cmd->dragY, z, CELL_WALL, MAT_PEAT, "peat");
+            } else {
+                ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_PEAT, "peat");
+            }
+            }
+            break;
+        case ACTION_DRAW_SOIL_ROCK:
+            if (leftClick) {
+            if (shift) {
+                ExecutePileSoil(cmd->dragX, cmd->dragY, z, CELL_WALL, MAT_GRANITE, "rock");
+            } else {
+                ExecuteBuildRock(x1, y1, x2, y2, z);
+            }
+            }
+            break;
+        // Work actions
+        case ACTION_WORK_MINE:
+            if (leftClick) ExecuteDesignateMine(x1, y1, x2, y2, z);
+            else ExecuteCancelMine(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_CHANNEL:
+            if (leftClick) ExecuteDesignateChannel(x1, y1, x2, y2, z);
+            else ExecuteCancelChannel(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_DIG_RAMP:
+            if (leftClick) ExecuteDesignateDigRamp(x1, y1, x2, y2, z);
+            else ExecuteCancelDigRamp(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_REMOVE_FLOOR:
+            if (leftClick) ExecuteDesignateRemoveFloor(x1, y1, x2, y2, z);
+            else ExecuteCancelRemoveFloor(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_REMOVE_RAMP:
+            if (leftClick) ExecuteDesignateRemoveRamp(x1, y1, x2, y2, z);
+            else ExecuteCancelRemoveRamp(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_CONSTRUCT:
+            if (leftClick) ExecuteDesignateBuild(x1, y1, x2, y2, z);
+            else ExecuteCancelBuild(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_LADDER:
+            if (leftClick) ExecuteDesignateLadder(x1, y1, x2, y2, z);
+            else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
+            break;
+        case ACTION_WORK_FLOOR:
+            if (leftClick) ExecuteDesignateFloor(x1, y1, x2, y2, z);
+            else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
+            break;
+        case ACTION_WORK_RAMP:
+            if (leftClick) ExecuteDesignateRamp(x1, y1, x2, y2, z);
+            else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
+            break;
+        case ACTION_WORK_FURNITURE:
+            if (leftClick) ExecuteDesignateFurniture(x1, y1, x2, y2, z);
+            else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
+            break;
+        case ACTION_WORK_DOOR:
+            if (leftClick) ExecuteDesignateDoor(x1, y1, x2, y2, z);
+            else ExecuteCancelBuild(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_WORKSHOP_CAMPFIRE:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_CAMPFIRE);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_GROUND_FIRE:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_GROUND_FIRE);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_BUTCHER:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_BUTCHER);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_COMPOST_PILE:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_COMPOST_PILE);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_QUERN:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_QUERN);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_LOOM:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_LOOM);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_TANNING_RACK:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_TANNING_RACK);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_TAILOR:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_TAILOR);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_MUD_MIXER:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_MUD_MIXER);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_STOVE:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_STOVE);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_COUNTER:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_COUNTER);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_DRYING_RACK:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_DRYING_RACK);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_ROPE_MAKER:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_ROPE_MAKER);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_CHARCOAL_PIT:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_CHARCOAL_PIT);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_HEARTH:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_HEARTH);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_STONECUTTER:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_STONECUTTER);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_SAWMILL:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_SAWMILL);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_KILN:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_KILN);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_WORKSHOP_CARPENTER:
+            if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_CARPENTER);
+            else ExecuteCancelWorkshopBlueprint(x1, y1, z);
+            break;
+        case ACTION_WORK_GATHER:
+            if (leftClick) ExecuteCreateGatherZone(x1, y1, x2, y2, z);
+            else ExecuteEraseGatherZone(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_CHOP:
+            if (leftClick) ExecuteDesignateChop(x1, y1, x2, y2, z);
+            else ExecuteCancelChop(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_CHOP_FELLED:
+            if (leftClick) ExecuteDesignateChopFelled(x1, y1, x2, y2, z);
+            else ExecuteCancelChopFelled(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_GATHER_SAPLING:
+            if (leftClick) ExecuteDesignateGatherSapling(x1, y1, x2, y2, z);
+            else ExecuteCancelGatherSapling(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_GATHER_GRASS:
+            if (leftClick) ExecuteDesignateGatherGrass(x1, y1, x2, y2, z);
+            else ExecuteCancelGatherGrass(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_GATHER_REEDS:
+            if (leftClick) ExecuteDesignateGatherReeds(x1, y1, x2, y2, z);
+            else ExecuteCancelGatherReeds(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_GATHER_TREE:
+            if (leftClick) ExecuteDesignateGatherTree(x1, y1, x2, y2, z);
+            else ExecuteCancelGatherTree(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_PLANT_SAPLING:
+            if (leftClick) ExecuteDesignatePlantSapling(x1, y1, x2, y2, z);
+            else ExecuteCancelPlantSapling(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_CLEAN:
+            if (leftClick) ExecuteDesignateClean(x1, y1, x2, y2, z);
+            else ExecuteCancelClean(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_HARVEST_BERRY:
+            if (leftClick) ExecuteDesignateHarvestBerry(x1, y1, x2, y2, z);
+            else ExecuteCancelHarvestBerry(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_KNAP:
+            if (leftClick) ExecuteDesignateKnap(x1, y1, x2, y2, z);
+            else ExecuteCancelKnap(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_DIG_ROOTS:
+            if (leftClick) ExecuteDesignateDigRoots(x1, y1, x2, y2, z);
+            else ExecuteCancelDigRoots(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_EXPLORE:
+            if (leftClick) ExecuteDesignateExplore(x1, y1, z);
+            else ExecuteCancelExplore(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_HUNT:
+            if (leftClick) ExecuteMarkHunt(x1, y1, x2, y2, z);
+            else ExecuteUnmarkHunt(x1, y1, x2, y2, z);
+            break;
+        case ACTION_WORK_FARM:
+            if (leftClick) ExecuteDesignateFarm(x1, y1, x2, y2, z);
+            else ExecuteCancelFarm(x1, y1, x2, y2, z);
+            break;
+        // Sandbox actions
+        case ACTION_SANDBOX_WATER:
+            if (leftClick) ExecutePlaceWater(x1, y1, x2, y2, z, shift);
+            else ExecuteRemoveWater(x1, y1, x2, y2, z, shift);
+            break;
+        case ACTION_SANDBOX_FIRE:
+            if (leftClick) ExecutePlaceFire(x1, y1, x2, y2, z, shift);
+            else ExecuteRemoveFire(x1, y1, x2, y2, z, shift);
+            break;
+        case ACTION_SANDBOX_HEAT:
+            if (leftClick) ExecutePlaceHeat(x1, y1, x2, y2, z);
+            else ExecuteRemoveHeat(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_COLD:
+            if (leftClick) ExecutePlaceCold(x1, y1, x2, y2, z);
+            else ExecuteRemoveCold(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_SMOKE:
+            if (leftClick) ExecutePlaceSmoke(x1, y1, x2, y2, z);
+            else ExecuteRemoveSmoke(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_STEAM:
+            if (leftClick) ExecutePlaceSteam(x1, y1, x2, y2, z);
+            else ExecuteRemoveSteam(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_GRASS:
+            if (leftClick) ExecutePlaceGrass(x1, y1, x2, y2, z);
+            else ExecuteRemoveGrass(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_TREE:
+            if (leftClick) ExecutePlaceTree(x1, y1, z);  // Single click for tree placement
+            else ExecuteRemoveTree(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_SCULPT:
+        case ACTION_SANDBOX_LOWER:
+        case ACTION_SANDBOX_RAISE:
+            // Brush sculpting handled in continuous stroke mode above
+            break;
+        case ACTION_SANDBOX_LIGHT:
+            if (leftClick) {
+                AddLightSource(x1, y1, z,
+                    (uint8_t)lightDefaultR, (uint8_t)lightDefaultG, (uint8_t)lightDefaultB,
+                    (uint8_t)lightDefaultIntensity);
+            } else {
+                RemoveLightSource(x1, y1, z);
+            }
+            break;
+        case ACTION_SANDBOX_BUSH:
+            if (leftClick) ExecutePlaceBush(x1, y1, x2, y2, z);
+            else ExecuteRemoveBush(x1, y1, x2, y2, z);
+            break;
+        case ACTION_SANDBOX_MOVER:
+            if (leftClick) SpawnMoverAt(x1, y1, z);
+            break;
+        case ACTION_DRAW_TRACK:
+            if (leftClick) ExecutePlaceTrack(x1, y1, x2, y2, z);
+            else ExecuteRemoveTrack(x1, y1, x2, y2, z);
+            RebuildStations();
+            break;
+        case ACTION_DRAW_PLATFORM:
+            if (leftClick) ExecutePlacePlatform(x1, y1, x2, y2, z);
+            else ExecuteRemovePlatform(x1, y1, x2, y2, z);
+            RebuildStations();
+            break;
+        case ACTION_DRAW_TRAIN:
+            if (leftClick) {
+                // Spawn train on track cell
+                if (grid[z][cmd->mouseY][cmd->mouseX] == CELL_TRACK) {
+                    int idx = SpawnTrain(cmd->mouseX, cmd->mouseY, z);
+                    if (idx >= 0) {
+                        AddMessage(TextFormat("Spawned train #%d", idx), GREEN);
+                    } else {
+                        AddMessage("Max trains reached!", RED);
+                    }
+                } else {
+                    AddMessage("Must place train on track", RED);
+                }
+            } else {
+                // Remove nearest train at clicked cell
+                int removeIdx = -1;
+                for (int i = 0; i < MAX_TRAINS; i++) {
+                    if (!trains[i].active) continue;
+                    if (trains[i].cellX == cmd->mouseX && trains[i].cellY == cmd->mouseY && trains[i].z == z) {
+                        removeIdx = i;
+                        break;
+                    }
+                }
+                if (removeIdx >= 0) {
+                    if (trains[removeIdx].lightCellX >= 0) {
+                        RemoveLightSource(trains[removeIdx].lightCellX, trains[removeIdx].lightCellY, trains[removeIdx].z);
+                    }
+                    trains[removeIdx].active = false;
+                    trainCount--;
+                    AddMessage(TextFormat("Removed train #%d", removeIdx), ORANGE);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 static int currentPendingKey = 0;
 static bool CheckKey(int key) {
     if (IsKeyPressed(key)) return true;
@@ -2290,8 +2775,9 @@ void HandleInput(void) {
             if (ws->markedForDeconstruct) {
                 // Cancel deconstruction
                 if (ws->assignedDeconstructor >= 0) {
-                    Mover* dm = &movers[ws->assignedDeconstructor];
-                    if (dm->active && dm->currentJobId >= 0) {
+                    int moverIdx = ws->assignedDeconstructor;
+                    Mover* dm = &movers[moverIdx];
+                    if (moverActive[moverIdx] && dm->currentJobId >= 0) {
                         CancelJob(dm, ws->assignedDeconstructor);
                     }
                     ws->assignedDeconstructor = -1;
@@ -2360,33 +2846,34 @@ void HandleInput(void) {
     // Only in normal mode to avoid consuming draw/work/sandbox action keys.
     if (inputMode == MODE_NORMAL && IsKeyPressed(KEY_F)) {
         if (hoveredMover >= 0 && hoveredMover < moverCount) {
-            if (followMoverIdx == hoveredMover) {
-                followMoverIdx = -1;
+            if (MoverIndexFromHandle(followMoverHandle) == hoveredMover) {
+                followMoverHandle = -1;
                 AddMessage("Follow: off", GRAY);
             } else {
-                followMoverIdx = hoveredMover;
-                currentViewZ = (int)movers[hoveredMover].z;
+                followMoverHandle = MoverHandleFromIndex(hoveredMover);
+                currentViewZ = (int)moverPosZ[hoveredMover];
                 AddMessage(TextFormat("Follow: %s", MoverDisplayName(hoveredMover)), GREEN);
             }
-        } else if (followMoverIdx >= 0) {
-            followMoverIdx = -1;
+        } else if (followMoverHandle >= 0) {
+            followMoverHandle = -1;
             AddMessage("Follow: off", GRAY);
         }
     }
 
     // Click-to-move for drafted movers (right-click while following a drafted mover)
-    if (followMoverIdx >= 0 && followMoverIdx < moverCount
-        && movers[followMoverIdx].isDrafted
+    int followIdx = MoverIndexFromHandle(followMoverHandle);
+    if (followIdx >= 0 && followIdx < moverCount
+        && movers[followIdx].isDrafted
         && IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) {
         Vector2 gp = ScreenToGrid(GetMousePosition());
         int gx = (int)gp.x, gy = (int)gp.y;
         int gz = currentViewZ;
         if (gx >= 0 && gx < gridWidth && gy >= 0 && gy < gridHeight
             && IsCellWalkableAt(gz, gy, gx)) {
-            Mover* dm = &movers[followMoverIdx];
+            Mover* dm = &movers[followIdx];
             dm->goal = (Point){gx, gy, gz};
-            dm->needsRepath = true;
-            AddMessage(TextFormat("%s: move to (%d,%d)", MoverDisplayName(followMoverIdx), gx, gy), YELLOW);
+            moverNeedsRepath[followIdx] = true;
+            AddMessage(TextFormat("%s: move to (%d,%d)", MoverDisplayName(followIdx), gx, gy), YELLOW);
         }
     }
 
@@ -2404,8 +2891,8 @@ void HandleInput(void) {
 
     // Pan
     if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE)) {
-        if (followMoverIdx >= 0) {
-            followMoverIdx = -1;
+        if (followMoverHandle >= 0) {
+            followMoverHandle = -1;
             AddMessage("Follow: off", GRAY);
         }
         Vector2 d = GetMouseDelta();
@@ -2577,11 +3064,10 @@ void HandleInput(void) {
                             SetWallFinish(x, y, z, FINISH_SMOOTH);
                             MarkChunkDirty(x, y, z);
                             for (int i = 0; i < moverCount; i++) {
-                                Mover* m = &movers[i];
-                                if (!m->active) continue;
-                                for (int j = m->pathIndex; j >= 0; j--) {
+                                if (!moverActive[i]) continue;
+                                for (int j = moverPathIndex[i]; j >= 0; j--) {
                                     if (moverPaths[i][j].x == x && moverPaths[i][j].y == y && moverPaths[i][j].z == z) {
-                                        m->needsRepath = true;
+                                        moverNeedsRepath[i] = true;
                                         break;
                                     }
                                 }
@@ -2973,462 +3459,38 @@ void HandleInput(void) {
     // End drag - execute action
     if (isDragging && (IsMouseButtonReleased(MOUSE_BUTTON_LEFT) || IsMouseButtonReleased(MOUSE_BUTTON_RIGHT))) {
         isDragging = false;
-        bool leftClick = IsMouseButtonReleased(MOUSE_BUTTON_LEFT);
-
-        // In front view: drag covers X range + Z range at fixed world Y
-        if (frontViewMode) {
-            int fx1, fy1, fx2, fy2, fz1, fz2;
-            GetDragRectFrontView(&fx1, &fy1, &fx2, &fy2, &fz1, &fz2, gx, gy, gz);
-            for (int fz = fz1; fz <= fz2; fz++) {
-                switch (inputAction) {
-                    case ACTION_DRAW_WALL:
-                        if (leftClick) ExecuteBuildWall(fx1, fy1, fx2, fy2, fz);
-                        else ExecuteErase(fx1, fy1, fx2, fy2, fz);
-                        break;
-                    case ACTION_DRAW_FLOOR:
-                        if (leftClick) ExecuteBuildFloor(fx1, fy1, fx2, fy2, fz);
-                        else ExecuteErase(fx1, fy1, fx2, fy2, fz);
-                        break;
-                    case ACTION_DRAW_LADDER:
-                        if (leftClick) ExecuteBuildLadder(fx1, fy1, fx2, fy2, fz);
-                        else ExecuteErase(fx1, fy1, fx2, fy2, fz);
-                        break;
-                    case ACTION_DRAW_SOIL_DIRT:
-                        if (leftClick) ExecuteBuildSoil(fx1, fy1, fx2, fy2, fz, CELL_WALL, MAT_DIRT, "dirt");
-                        else ExecuteErase(fx1, fy1, fx2, fy2, fz);
-                        break;
-                    case ACTION_DRAW_SOIL_ROCK:
-                        if (leftClick) ExecuteBuildRock(fx1, fy1, fx2, fy2, fz);
-                        else ExecuteErase(fx1, fy1, fx2, fy2, fz);
-                        break;
-                    default: break;
-                }
-            }
-            goto done_execute;
-        }
-
+        DragCommand cmd = {
+            .action = (int16_t)inputAction,
+            .dragX = (int16_t)dragStartX,
+            .dragY = (int16_t)dragStartY,
+            .mouseX = (int16_t)mouseGrid.x,
+            .mouseY = (int16_t)mouseGrid.y,
+            .material = (int16_t)selectedMaterial,
+            .wallRecipe = (int16_t)selectedWallRecipe,
+            .floorRecipe = (int16_t)selectedFloorRecipe,
+            .ladderRecipe = (int16_t)selectedLadderRecipe,
+            .furnitureRecipe = (int16_t)selectedFurnitureRecipe,
+            .doorRecipe = (int16_t)selectedDoorRecipe,
+            .rampDirection = (int16_t)selectedRampDirection,
+            .treeType = (int16_t)currentTreeType,
+            .leftClick = IsMouseButtonReleased(MOUSE_BUTTON_LEFT),
+            .shift = shift,
+            .frontView = frontViewMode,
+        };
         int x1, y1, x2, y2;
-        GetDragRect(&x1, &y1, &x2, &y2);
-
-        switch (inputAction) {
-            // Draw actions
-            case ACTION_DRAW_WALL:
-                if (leftClick) ExecuteBuildWall(x1, y1, x2, y2, z);
-                else ExecuteErase(x1, y1, x2, y2, z);
-                break;
-            case ACTION_DRAW_FLOOR:
-                if (leftClick) ExecuteBuildFloor(x1, y1, x2, y2, z);
-                else ExecuteErase(x1, y1, x2, y2, z);
-                break;
-            case ACTION_DRAW_LADDER:
-                if (leftClick) ExecuteBuildLadder(x1, y1, x2, y2, z);
-                else ExecuteErase(x1, y1, x2, y2, z);
-                break;
-            case ACTION_DRAW_RAMP:
-                if (leftClick) ExecuteBuildRamp(x1, y1, x2, y2, z);
-                else ExecuteEraseRamp(x1, y1, x2, y2, z);
-                break;
-            case ACTION_DRAW_STOCKPILE:
-                if (leftClick) ExecuteCreateStockpile(x1, y1, x2, y2, z);
-                else ExecuteEraseStockpile(x1, y1, x2, y2, z);
-                break;
-            case ACTION_DRAW_REFUSE_PILE:
-                if (leftClick) ExecuteCreateRefusePile(x1, y1, x2, y2, z);
-                else ExecuteEraseStockpile(x1, y1, x2, y2, z);
-                break;
-            case ACTION_DRAW_WORKSHOP_STONECUTTER:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_STONECUTTER);
-                break;
-            case ACTION_DRAW_WORKSHOP_SAWMILL:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_SAWMILL);
-                break;
-            case ACTION_DRAW_WORKSHOP_KILN:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_KILN);
-                break;
-            case ACTION_DRAW_WORKSHOP_CHARCOAL_PIT:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_CHARCOAL_PIT);
-                break;
-            case ACTION_DRAW_WORKSHOP_HEARTH:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_HEARTH);
-                break;
-            case ACTION_DRAW_WORKSHOP_DRYING_RACK:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_DRYING_RACK);
-                break;
-            case ACTION_DRAW_WORKSHOP_ROPE_MAKER:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_ROPE_MAKER);
-                break;
-            case ACTION_DRAW_WORKSHOP_CARPENTER:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_CARPENTER);
-                break;
-            case ACTION_DRAW_WORKSHOP_CAMPFIRE:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_CAMPFIRE);
-                break;
-            case ACTION_DRAW_WORKSHOP_GROUND_FIRE:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_GROUND_FIRE);
-                break;
-            case ACTION_DRAW_WORKSHOP_BUTCHER:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_BUTCHER);
-                break;
-            case ACTION_DRAW_WORKSHOP_COMPOST_PILE:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_COMPOST_PILE);
-                break;
-            case ACTION_DRAW_WORKSHOP_QUERN:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_QUERN);
-                break;
-            case ACTION_DRAW_WORKSHOP_LOOM:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_LOOM);
-                break;
-            case ACTION_DRAW_WORKSHOP_TANNING_RACK:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_TANNING_RACK);
-                break;
-            case ACTION_DRAW_WORKSHOP_TAILOR:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_TAILOR);
-                break;
-            case ACTION_DRAW_WORKSHOP_MUD_MIXER:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_MUD_MIXER);
-                break;
-            case ACTION_DRAW_WORKSHOP_STOVE:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_STOVE);
-                break;
-            case ACTION_DRAW_WORKSHOP_COUNTER:
-                if (leftClick) ExecutePlaceWorkshop(dragStartX, dragStartY, z, WORKSHOP_COUNTER);
-                break;
-            case ACTION_DRAW_SOIL_DIRT:
-                if (leftClick) {
-                    if (shift) {
-                        // Pile mode - place single block at drag start with gravity/spreading
-                        ExecutePileSoil(dragStartX, dragStartY, z, CELL_WALL, MAT_DIRT, "dirt");
-                    } else {
-                        ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_DIRT, "dirt");
-                    }
-                }
-                break;
-            case ACTION_DRAW_SOIL_CLAY:
-                if (leftClick) {
-                if (shift) {
-                    ExecutePileSoil(dragStartX, dragStartY, z, CELL_WALL, MAT_CLAY, "clay");
-                } else {
-                    ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_CLAY, "clay");
-                }
-                }
-                break;
-            case ACTION_DRAW_SOIL_GRAVEL:
-                if (leftClick) {
-                if (shift) {
-                    ExecutePileSoil(dragStartX, dragStartY, z, CELL_WALL, MAT_GRAVEL, "gravel");
-                } else {
-                    ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_GRAVEL, "gravel");
-                }
-                }
-                break;
-            case ACTION_DRAW_SOIL_SAND:
-                if (leftClick) {
-                if (shift) {
-                    ExecutePileSoil(dragStartX, dragStartY, z, CELL_WALL, MAT_SAND, "sand");
-                } else {
-                    ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_SAND, "sand");
-                }
-                }
-                break;
-            case ACTION_DRAW_SOIL_PEAT:
-                if (leftClick) {
-                if (shift) {
-                    ExecutePileSoil(dragStartX, dragStartY, z, CELL_WALL, MAT_PEAT, "peat");
-                } else {
-                    ExecuteBuildSoil(x1, y1, x2, y2, z, CELL_WALL, MAT_PEAT, "peat");
-                }
-                }
-                break;
-            case ACTION_DRAW_SOIL_ROCK:
-                if (leftClick) {
-                if (shift) {
-                    ExecutePileSoil(dragStartX, dragStartY, z, CELL_WALL, MAT_GRANITE, "rock");
-                } else {
-                    ExecuteBuildRock(x1, y1, x2, y2, z);
-                }
-                }
-                break;
-            // Work actions
-            case ACTION_WORK_MINE:
-                if (leftClick) ExecuteDesignateMine(x1, y1, x2, y2, z);
-                else ExecuteCancelMine(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_CHANNEL:
-                if (leftClick) ExecuteDesignateChannel(x1, y1, x2, y2, z);
-                else ExecuteCancelChannel(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_DIG_RAMP:
-                if (leftClick) ExecuteDesignateDigRamp(x1, y1, x2, y2, z);
-                else ExecuteCancelDigRamp(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_REMOVE_FLOOR:
-                if (leftClick) ExecuteDesignateRemoveFloor(x1, y1, x2, y2, z);
-                else ExecuteCancelRemoveFloor(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_REMOVE_RAMP:
-                if (leftClick) ExecuteDesignateRemoveRamp(x1, y1, x2, y2, z);
-                else ExecuteCancelRemoveRamp(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_CONSTRUCT:
-                if (leftClick) ExecuteDesignateBuild(x1, y1, x2, y2, z);
-                else ExecuteCancelBuild(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_LADDER:
-                if (leftClick) ExecuteDesignateLadder(x1, y1, x2, y2, z);
-                else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
-                break;
-            case ACTION_WORK_FLOOR:
-                if (leftClick) ExecuteDesignateFloor(x1, y1, x2, y2, z);
-                else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
-                break;
-            case ACTION_WORK_RAMP:
-                if (leftClick) ExecuteDesignateRamp(x1, y1, x2, y2, z);
-                else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
-                break;
-            case ACTION_WORK_FURNITURE:
-                if (leftClick) ExecuteDesignateFurniture(x1, y1, x2, y2, z);
-                else ExecuteCancelBuild(x1, y1, x2, y2, z);  // Reuse cancel logic
-                break;
-            case ACTION_WORK_DOOR:
-                if (leftClick) ExecuteDesignateDoor(x1, y1, x2, y2, z);
-                else ExecuteCancelBuild(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_WORKSHOP_CAMPFIRE:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_CAMPFIRE);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_GROUND_FIRE:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_GROUND_FIRE);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_BUTCHER:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_BUTCHER);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_COMPOST_PILE:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_COMPOST_PILE);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_QUERN:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_QUERN);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_LOOM:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_LOOM);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_TANNING_RACK:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_TANNING_RACK);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_TAILOR:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_TAILOR);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_MUD_MIXER:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_MUD_MIXER);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_STOVE:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_STOVE);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_COUNTER:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_COUNTER);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_DRYING_RACK:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_DRYING_RACK);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_ROPE_MAKER:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_ROPE_MAKER);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_CHARCOAL_PIT:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_CHARCOAL_PIT);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_HEARTH:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_HEARTH);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_STONECUTTER:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_STONECUTTER);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_SAWMILL:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_SAWMILL);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_KILN:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_KILN);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_WORKSHOP_CARPENTER:
-                if (leftClick) ExecutePlaceWorkshopBlueprint(x1, y1, z, WORKSHOP_CARPENTER);
-                else ExecuteCancelWorkshopBlueprint(x1, y1, z);
-                break;
-            case ACTION_WORK_GATHER:
-                if (leftClick) ExecuteCreateGatherZone(x1, y1, x2, y2, z);
-                else ExecuteEraseGatherZone(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_CHOP:
-                if (leftClick) ExecuteDesignateChop(x1, y1, x2, y2, z);
-                else ExecuteCancelChop(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_CHOP_FELLED:
-                if (leftClick) ExecuteDesignateChopFelled(x1, y1, x2, y2, z);
-                else ExecuteCancelChopFelled(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_GATHER_SAPLING:
-                if (leftClick) ExecuteDesignateGatherSapling(x1, y1, x2, y2, z);
-                else ExecuteCancelGatherSapling(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_GATHER_GRASS:
-                if (leftClick) ExecuteDesignateGatherGrass(x1, y1, x2, y2, z);
-                else ExecuteCancelGatherGrass(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_GATHER_REEDS:
-                if (leftClick) ExecuteDesignateGatherReeds(x1, y1, x2, y2, z);
-                else ExecuteCancelGatherReeds(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_GATHER_TREE:
-                if (leftClick) ExecuteDesignateGatherTree(x1, y1, x2, y2, z);
-                else ExecuteCancelGatherTree(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_PLANT_SAPLING:
-                if (leftClick) ExecuteDesignatePlantSapling(x1, y1, x2, y2, z);
-                else ExecuteCancelPlantSapling(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_CLEAN:
-                if (leftClick) ExecuteDesignateClean(x1, y1, x2, y2, z);
-                else ExecuteCancelClean(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_HARVEST_BERRY:
-                if (leftClick) ExecuteDesignateHarvestBerry(x1, y1, x2, y2, z);
-                else ExecuteCancelHarvestBerry(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_KNAP:
-                if (leftClick) ExecuteDesignateKnap(x1, y1, x2, y2, z);
-                else ExecuteCancelKnap(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_DIG_ROOTS:
-                if (leftClick) ExecuteDesignateDigRoots(x1, y1, x2, y2, z);
-                else ExecuteCancelDigRoots(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_EXPLORE:
-                if (leftClick) ExecuteDesignateExplore(x1, y1, z);
-                else ExecuteCancelExplore(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_HUNT:
-                if (leftClick) ExecuteMarkHunt(x1, y1, x2, y2, z);
-                else ExecuteUnmarkHunt(x1, y1, x2, y2, z);
-                break;
-            case ACTION_WORK_FARM:
-                if (leftClick) ExecuteDesignateFarm(x1, y1, x2, y2, z);
-                else ExecuteCancelFarm(x1, y1, x2, y2, z);
-                break;
-            // Sandbox actions
-            case ACTION_SANDBOX_WATER:
-                if (leftClick) ExecutePlaceWater(x1, y1, x2, y2, z, shift);
-                else ExecuteRemoveWater(x1, y1, x2, y2, z, shift);
-                break;
-            case ACTION_SANDBOX_FIRE:
-                if (leftClick) ExecutePlaceFire(x1, y1, x2, y2, z, shift);
-                else ExecuteRemoveFire(x1, y1, x2, y2, z, shift);
-                break;
-            case ACTION_SANDBOX_HEAT:
-                if (leftClick) ExecutePlaceHeat(x1, y1, x2, y2, z);
-                else ExecuteRemoveHeat(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_COLD:
-                if (leftClick) ExecutePlaceCold(x1, y1, x2, y2, z);
-                else ExecuteRemoveCold(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_SMOKE:
-                if (leftClick) ExecutePlaceSmoke(x1, y1, x2, y2, z);
-                else ExecuteRemoveSmoke(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_STEAM:
-                if (leftClick) ExecutePlaceSteam(x1, y1, x2, y2, z);
-                else ExecuteRemoveSteam(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_GRASS:
-                if (leftClick) ExecutePlaceGrass(x1, y1, x2, y2, z);
-                else ExecuteRemoveGrass(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_TREE:
-                if (leftClick) ExecutePlaceTree(x1, y1, z);  // Single click for tree placement
-                else ExecuteRemoveTree(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_SCULPT:
-            case ACTION_SANDBOX_LOWER:
-            case ACTION_SANDBOX_RAISE:
-                // Brush sculpting handled in continuous stroke mode above
-                break;
-            case ACTION_SANDBOX_LIGHT:
-                if (leftClick) {
-                    AddLightSource(x1, y1, z,
-                        (uint8_t)lightDefaultR, (uint8_t)lightDefaultG, (uint8_t)lightDefaultB,
-                        (uint8_t)lightDefaultIntensity);
-                } else {
-                    RemoveLightSource(x1, y1, z);
-                }
-                break;
-            case ACTION_SANDBOX_BUSH:
-                if (leftClick) ExecutePlaceBush(x1, y1, x2, y2, z);
-                else ExecuteRemoveBush(x1, y1, x2, y2, z);
-                break;
-            case ACTION_SANDBOX_MOVER:
-                if (leftClick) SpawnMoverAt(x1, y1, z);
-                break;
-            case ACTION_DRAW_TRACK:
-                if (leftClick) ExecutePlaceTrack(x1, y1, x2, y2, z);
-                else ExecuteRemoveTrack(x1, y1, x2, y2, z);
-                RebuildStations();
-                break;
-            case ACTION_DRAW_PLATFORM:
-                if (leftClick) ExecutePlacePlatform(x1, y1, x2, y2, z);
-                else ExecuteRemovePlatform(x1, y1, x2, y2, z);
-                RebuildStations();
-                break;
-            case ACTION_DRAW_TRAIN:
-                if (leftClick) {
-                    // Spawn train on track cell
-                    if (grid[z][(int)mouseGrid.y][(int)mouseGrid.x] == CELL_TRACK) {
-                        int idx = SpawnTrain((int)mouseGrid.x, (int)mouseGrid.y, z);
-                        if (idx >= 0) {
-                            AddMessage(TextFormat("Spawned train #%d", idx), GREEN);
-                        } else {
-                            AddMessage("Max trains reached!", RED);
-                        }
-                    } else {
-                        AddMessage("Must place train on track", RED);
-                    }
-                } else {
-                    // Remove nearest train at clicked cell
-                    int removeIdx = -1;
-                    for (int i = 0; i < MAX_TRAINS; i++) {
-                        if (!trains[i].active) continue;
-                        if (trains[i].cellX == (int)mouseGrid.x && trains[i].cellY == (int)mouseGrid.y && trains[i].z == z) {
-                            removeIdx = i;
-                            break;
-                        }
-                    }
-                    if (removeIdx >= 0) {
-                        if (trains[removeIdx].lightCellX >= 0) {
-                            RemoveLightSource(trains[removeIdx].lightCellX, trains[removeIdx].lightCellY, trains[removeIdx].z);
-                        }
-                        trains[removeIdx].active = false;
-                        trainCount--;
-                        AddMessage(TextFormat("Removed train #%d", removeIdx), ORANGE);
-                    }
-                }
-                break;
-            default:
-                break;
-        }
-        done_execute:;
+        if (frontViewMode) {
+            int fz1, fz2;
+            GetDragRectFrontView(&x1, &y1, &x2, &y2, &fz1, &fz2, gx, gy, gz);
+            cmd.z1 = (int16_t)fz1;
+            cmd.z2 = (int16_t)fz2;
+        } else {
+            GetDragRect(&x1, &y1, &x2, &y2);
+            cmd.z1 = cmd.z2 = (int16_t)z;
+        }
+        cmd.x1 = (int16_t)x1;
+        cmd.y1 = (int16_t)y1;
+        cmd.x2 = (int16_t)x2;
+        cmd.y2 = (int16_t)y2;
+        ExecuteDragCommand(&cmd);
     }
 }
@@ -13,6 +13,7 @@
 #include "../simulation/farming.h"
 #include "../entities/items.h"
 #include "../entities/item_defs.h"
+#include "../entities/item_ledger.h"
 #include "../entities/stockpiles.h"
 #include "../world/designations.h"
 #include "../entities/mover.h"
@@ -42,7 +43,7 @@
 #define MARKER_SETTINGS 0x53455454  // "SETT"
 #define MARKER_END      0x454E4421  // "END!"
 
-static const char* InspectItemName(const Item* item, char* buffer, size_t bufferSize) {
+static const char* InspectItemName(const ItemRecord* item, char* buffer, size_t bufferSize) {
     const char* base = (item->type < ITEM_TYPE_COUNT) ? ItemName(item->type) : "?";
     MaterialType mat = (MaterialType)item->material;
     if (mat == MAT_NONE) {
@@ -82,14 +83,14 @@ static uint8_t* insp_floorFinish = NULL;
 static TempCell* insp_tempCells = NULL;
 static Designation* insp_designations = NULL;
 static int insp_itemHWM = 0;
-static Item* insp_items = NULL;
+static ItemRecord* insp_items = NULL;
 static Stockpile* insp_stockpiles = NULL;
 static int insp_gatherZoneCount = 0;
 static GatherZone* insp_gatherZones = NULL;
 static Blueprint* insp_blueprints = NULL;
 static Workshop* insp_workshops = NULL;
 static int insp_moverCount = 0;
-static Mover* insp_movers = NULL;
+static MoverRecord* insp_movers = NULL;
 static Point (*insp_moverPaths)[MAX_MOVER_PATH] = NULL;
 static int insp_animalCount = 0;
 static Animal* insp_animals = NULL;
@@ -106,7 +107,7 @@ static void print_mover(int idx) {
         printf("Mover %d out of range (0-%d)\n", idx, insp_moverCount-1);
         return;
     }
-    Mover* m = &insp_movers[idx];
+    MoverRecord* m = &insp_movers[idx];
     printf("\n=== MOVER %d: %s ===\n", idx, m->name[0] ? m->name : "(unnamed)");
     printf("Gender: %s, Age: %d, AppearanceSeed: %u\n",
            m->gender == 1 ? "F" : "M", m->age, m->appearanceSeed);
@@ -145,8 +146,10 @@ static void print_mover(int idx) {
         printf("\n");
     }
 
-    // Mood
-    printf("Mood: %.2f (%s), speed mult: %.2fx\n", m->mood, MoodLevelName(m->mood), GetMoodSpeedMult(m));
+    // Mood (GetMoodSpeedMult reads only the mood of a Mover)
+    Mover moodView = {0};
+    moodView.mood = m->mood;
+    printf("Mood: %.2f (%s), speed mult: %.2fx\n", m->mood, MoodLevelName(m->mood), GetMoodSpeedMult(&moodView));
     if (m->traits[0] != TRAIT_NONE || m->traits[1] != TRAIT_NONE) {
         printf("Traits:");
         for (int t = 0; t < MAX_TRAITS; t++) {
@@ -224,7 +227,7 @@ static void print_item(int idx) {
         printf("Item %d out of range (0-%d)\n", idx, insp_itemHWM-1);
         return;
     }
-    Item* item = &insp_items[idx];
+    ItemRecord* item = &insp_items[idx];
     printf("\n=== ITEM %d ===\n", idx);
     printf("Position: (%.2f, %.2f, z%.0f) -> cell (%d, %d)\n",
            item->x, item->y, item->z, (int)(item->x / CELL_SIZE), (int)(item->y / CELL_SIZE));
@@ -832,7 +835,7 @@ static void print_transport(void) {
     printf("\n-- Movers with active transport --\n");
     int moverFound = 0;
     for (int i = 0; i < insp_moverCount; i++) {
-        Mover* m = &insp_movers[i];
+        MoverRecord* m = &insp_movers[i];
         if (!m->active || m->transportState == TRANSPORT_NONE) continue;
         int ts = m->transportState;
         printf("Mover %d (%s): %s, station=%d, exitStation=%d, trainIdx=%d\n",
@@ -955,7 +958,7 @@ static void print_orphaned(void) {
                            (mi < insp_moverCount && insp_movers[mi].active)
                                ? insp_movers[mi].currentJobId : -1);
                     if (mi >= 0 && mi < insp_moverCount && insp_movers[mi].active) {
-                        Mover* m = &insp_movers[mi];
+                        MoverRecord* m = &insp_movers[mi];
                         printf("  mover %d lastJob: type=%s result=%s target=(%d,%d,z%d) endTick=%lu\n",
                                mi, JobTypeName(m->lastJobType),
                                m->lastJobResult == 0 ? "DONE" : "FAIL",
@@ -1008,7 +1011,7 @@ static void print_items(const char* filterType) {
     int found = 0;
     for (int i = 0; i < insp_itemHWM; i++) {
         if (!insp_items[i].active) continue;
-        Item* item = &insp_items[i];
+        ItemRecord* item = &insp_items[i];
         char nameBuf[64];
         const char* typeName = InspectItemName(item, nameBuf, sizeof(nameBuf));
         
@@ -1109,6 +1112,26 @@ static void print_temp(int filterZ) {
     }
 }
 
+// Sparse layers (fire, smoke, steam, snow, designations, floor dirt):
+// allocated pages since v94, dense rows before. defaultCell NULL = zeros.
+static void read_sparse_grid(FILE* f, uint32_t version, void* dense, size_t cellSize, const void* defaultCell) {
+    int totalCells = insp_gridW * insp_gridH * insp_gridD;
+    if (version < 94) {
+        fread(dense, cellSize, totalCells, f);
+        return;
+    }
+    for (int i = 0; i < totalCells; i++) {
+        if (defaultCell) memcpy((uint8_t*)dense + (size_t)i * cellSize, defaultCell, cellSize);
+        else memset((uint8_t*)dense + (size_t)i * cellSize, 0, cellSize);
+    }
+    ReadPagedLayerDense(f, cellSize, dense, insp_gridW, insp_gridH, insp_gridD);
+}
+
+static void skip_sparse_grid(FILE* f, uint32_t version, size_t cellSize) {
+    if (version >= 94) SkipPagedLayer(f, cellSize);
+    else fseek(f, (long)insp_gridW * insp_gridH * insp_gridD * (long)cellSize, SEEK_CUR);
+}
+
 static void cleanup(void) {
     free(insp_gridCells);
     free(insp_waterCells);
@@ -1323,9 +1346,9 @@ int InspectSaveFile(int argc, char** argv) {
     
     fread(insp_gridCells, sizeof(CellType), totalCells, f);
     fread(insp_waterCells, sizeof(WaterCell), totalCells, f);
-    fread(insp_fireCells, sizeof(FireCell), totalCells, f);
-    fread(insp_smokeCells, sizeof(SmokeCell), totalCells, f);
-    fread(insp_steamCells, sizeof(SteamCell), totalCells, f);
+    read_sparse_grid(f, version, insp_fireCells, sizeof(FireCell), NULL);
+    read_sparse_grid(f, version, insp_smokeCells, sizeof(SmokeCell), NULL);
+    read_sparse_grid(f, version, insp_steamCells, sizeof(SteamCell), NULL);
     fread(insp_cellFlags, sizeof(uint8_t), totalCells, f);
     fread(insp_wallMaterials, sizeof(uint8_t), totalCells, f);
     fread(insp_floorMaterials, sizeof(uint8_t), totalCells, f);
@@ -1345,10 +1368,11 @@ int InspectSaveFile(int argc, char** argv) {
     fseek(f, totalCells * sizeof(uint8_t), SEEK_CUR);
 
     // Snow grid (skip - not inspected)
-    fseek(f, totalCells * sizeof(uint8_t), SEEK_CUR);
+    skip_sparse_grid(f, version, sizeof(uint8_t));
 
     fread(insp_tempCells, sizeof(TempCell), totalCells, f);
-    fread(insp_designations, sizeof(Designation), totalCells, f);
+    Designation noDesignation = { DESIGNATION_NONE, -1, 0.0f, 0.0f };
+    read_sparse_grid(f, version, insp_designations, sizeof(Designation), &noDesignation);
     
     // Wear grid (skip - not inspected)
     fseek(f, totalCells * sizeof(int), SEEK_CUR);
@@ -1363,7 +1387,7 @@ int InspectSaveFile(int argc, char** argv) {
     fseek(f, totalCells * sizeof(uint8_t), SEEK_CUR);  // treeHarvestState
 
     // Floor dirt grid (skip - not inspected)
-    fseek(f, totalCells * sizeof(uint8_t), SEEK_CUR);  // floorDirtGrid
+    skip_sparse_grid(f, version, sizeof(uint8_t));  // floorDirtLayer
 
     // Explored grid (skip - not inspected)
     fseek(f, totalCells * sizeof(uint8_t), SEEK_CUR);  // exploredGrid
@@ -1387,10 +1411,10 @@ int InspectSaveFile(int argc, char** argv) {
     
     // Items
     fread(&insp_itemHWM, 4, 1, f);
-    insp_items = malloc(insp_itemHWM > 0 ? insp_itemHWM * sizeof(Item) : sizeof(Item));
+    insp_items = malloc(insp_itemHWM > 0 ? insp_itemHWM * sizeof(ItemRecord) : sizeof(ItemRecord));
     if (insp_itemHWM > 0) {
         if (version >= 92) {
-            fread(insp_items, sizeof(Item), insp_itemHWM, f);
+            fread(insp_items, sizeof(ItemRecord), insp_itemHWM, f);
         } else {
             for (int i = 0; i < insp_itemHWM; i++) {
                 ItemV91 old;
@@ -1454,18 +1478,18 @@ int InspectSaveFile(int argc, char** argv) {
     
     // Movers
     fread(&insp_moverCount, 4, 1, f);
-    insp_movers = malloc(insp_moverCount > 0 ? insp_moverCount * sizeof(Mover) : sizeof(Mover));
+    insp_movers = malloc(insp_moverCount > 0 ? insp_moverCount * sizeof(MoverRecord) : sizeof(MoverRecord));
     insp_moverPaths = malloc(insp_moverCount > 0 ? insp_moverCount * sizeof(Point) * MAX_MOVER_PATH : sizeof(Point) * MAX_MOVER_PATH);
     if (version >= 93) {
-        // v93+: Mover struct with bladder
-        if (insp_moverCount > 0) fread(insp_movers, sizeof(Mover), insp_moverCount, f);
+        // v93+: Mover records with bladder
+        if (insp_moverCount > 0) fread(insp_movers, sizeof(MoverRecord), insp_moverCount, f);
         for (int i = 0; i < insp_moverCount; i++) {
             fread(insp_moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
         }
     } else if (version >= 90) {
         // v90-v92: Mover without bladder
         for (int i = 0; i < insp_moverCount; i++) {
-            fread(&insp_movers[i], sizeof(Mover) - sizeof(float), 1, f);
+            fread(&insp_movers[i], sizeof(MoverRecord) - sizeof(float), 1, f);
             fread(insp_moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
             insp_movers[i].bladder = 1.0f;
         }
@@ -1475,7 +1499,7 @@ int InspectSaveFile(int argc, char** argv) {
             MoverV89 old;
             fread(&old, sizeof(MoverV89), 1, f);
             fread(insp_moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
-            Mover* m = &insp_movers[i];
+            MoverRecord* m = &insp_movers[i];
             m->x = old.x; m->y = old.y; m->z = old.z;
             m->goal = old.goal;
             m->pathLength = old.pathLength;
@@ -1528,7 +1552,7 @@ int InspectSaveFile(int argc, char** argv) {
             MoverV85 old;
             fread(&old, sizeof(MoverV85), 1, f);
             fread(insp_moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
-            Mover* m = &insp_movers[i];
+            MoverRecord* m = &insp_movers[i];
             m->x = old.x; m->y = old.y; m->z = old.z;
             m->goal = old.goal;
             m->pathLength = old.pathLength;
@@ -1581,7 +1605,7 @@ int InspectSaveFile(int argc, char** argv) {
             MoverV82 old;
             fread(&old, sizeof(MoverV82), 1, f);
             fread(insp_moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
-            Mover* m = &insp_movers[i];
+            MoverRecord* m = &insp_movers[i];
             m->x = old.x; m->y = old.y; m->z = old.z;
             m->goal = old.goal;
             m->pathLength = old.pathLength;
@@ -1858,10 +1882,11 @@ int InspectSaveFile(int argc, char** argv) {
     if (opt_audit) {
         // Bridge inspect data to game globals so audit functions work
         setup_pathfinding_globals();
-        memcpy(items, insp_items, sizeof(Item) * insp_itemHWM);
+        for (int i = 0; i < insp_itemHWM; i++) UnpackItemRecord(i, &insp_items[i]);
         itemHighWaterMark = insp_itemHWM;
+        RebuildItemLedger();
         memcpy(stockpiles, insp_stockpiles, sizeof(Stockpile) * MAX_STOCKPILES);
-        memcpy(movers, insp_movers, sizeof(Mover) * insp_moverCount);
+        for (int i = 0; i < insp_moverCount; i++) UnpackMoverRecord(i, &insp_movers[i]);
         memcpy(moverPaths, insp_moverPaths, sizeof(Point) * MAX_MOVER_PATH * insp_moverCount);
         moverCount = insp_moverCount;
         // Init job pool (allocates activeJobList) then copy data
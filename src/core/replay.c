@@ -0,0 +1,270 @@
+// core/replay.c - Command recording and headless replay
+#include "replay.h"
+#include "sim_rng.h"
+#include "time.h"
+#include "../world/grid.h"
+#include "../entities/mover.h"
+#include "../entities/items.h"
+#include "../ui/console.h"
+#include <stdio.h>
+#include <string.h>
+
+bool SaveWorld(const char* filename);
+bool LoadWorld(const char* filename);
+
+_Static_assert(sizeof(DragCommand) == 42, "DragCommand is written to replay files as is");
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t seed;
+} ReplayHeader;
+
+typedef struct {
+    uint32_t tick;
+    uint8_t type;
+    uint16_t length;
+} ReplayRecordHeader;
+
+static FILE* recordFile = NULL;
+static FILE* playFile = NULL;
+static bool applying = false;   // Re-issuing a recorded command: don't record it again
+static uint32_t replayTick = 0;
+static float lastSpeed = 1.0f;
+static float lastDt = TICK_DT;
+
+static bool pendingValid = false;
+static ReplayRecordHeader pending;
+static float playDt = TICK_DT;
+static uint32_t endTick = 0;
+static bool hasEndHash = false;
+static uint64_t endHash = 0;
+
+static void SavePathFor(const char* path, char* out, size_t size) {
+    snprintf(out, size, "%s.sav", path);
+}
+
+// A wall-clock repath budget decides how many movers repath per tick from
+// timing, so two runs would diverge. Both sides use the fixed count.
+static void UseDeterministicBudgets(void) {
+    repathBudgetMs = 0.0f;
+}
+
+// --- Binary helpers (little-endian, field by field) ---
+
+static void WriteRecordHeader(uint8_t type, uint16_t length) {
+    fwrite(&replayTick, sizeof(replayTick), 1, recordFile);
+    fwrite(&type, sizeof(type), 1, recordFile);
+    fwrite(&length, sizeof(length), 1, recordFile);
+}
+
+static bool ReadRecordHeader(ReplayRecordHeader* rec) {
+    return fread(&rec->tick, sizeof(rec->tick), 1, playFile) == 1 &&
+           fread(&rec->type, sizeof(rec->type), 1, playFile) == 1 &&
+           fread(&rec->length, sizeof(rec->length), 1, playFile) == 1;
+}
+
+// --- Recording ---
+
+bool ReplayStartRecording(const char* path, uint64_t seed) {
+    char savePath[512];
+    SavePathFor(path, savePath, sizeof(savePath));
+
+    // Round-trip through the save so recording and replay start from the
+    // same post-load state (caches, spatial grids, graph) rather than the
+    // live one the save was taken from.
+    if (!SaveWorld(savePath) || !LoadWorld(savePath)) return false;
+
+    recordFile = fopen(path, "wb");
+    if (!recordFile) return false;
+
+    SeedSimRng(seed);
+    UseDeterministicBudgets();
+    ReplayHeader header = { REPLAY_MAGIC, REPLAY_VERSION, seed };
+    fwrite(&header.magic, sizeof(header.magic), 1, recordFile);
+    fwrite(&header.version, sizeof(header.version), 1, recordFile);
+    fwrite(&header.seed, sizeof(header.seed), 1, recordFile);
+
+    replayTick = 0;
+    lastSpeed = gameSpeed;
+    lastDt = TICK_DT;
+    WriteRecordHeader(REPLAY_CMD_SPEED, sizeof(float));
+    fwrite(&lastSpeed, sizeof(lastSpeed), 1, recordFile);
+    return true;
+}
+
+void ReplayStopRecording(void) {
+    if (!recordFile) return;
+    uint64_t hash = ComputeSimStateHash();
+    WriteRecordHeader(REPLAY_CMD_END, sizeof(hash));
+    fwrite(&hash, sizeof(hash), 1, recordFile);
+    fclose(recordFile);
+    recordFile = NULL;
+}
+
+bool ReplayIsRecording(void) {
+    return recordFile != NULL;
+}
+
+void ReplayRecordDrag(const DragCommand* cmd) {
+    if (!recordFile || applying) return;
+    WriteRecordHeader(REPLAY_CMD_DRAG, sizeof(DragCommand));
+    fwrite(cmd, sizeof(DragCommand), 1, recordFile);
+}
+
+void ReplayRecordConsole(const char* line, int x, int y, int z) {
+    if (!recordFile || applying) return;
+    int16_t cell[3] = { (int16_t)x, (int16_t)y, (int16_t)z };
+    size_t len = strlen(line);
+    WriteRecordHeader(REPLAY_CMD_CONSOLE, (uint16_t)(sizeof(cell) + len));
+    fwrite(cell, sizeof(cell), 1, recordFile);
+    fwrite(line, 1, len, recordFile);
+}
+
+void ReplayBeginTick(float dt) {
+    if (!recordFile) return;
+    if (gameSpeed != lastSpeed) {
+        lastSpeed = gameSpeed;
+        WriteRecordHeader(REPLAY_CMD_SPEED, sizeof(float));
+        fwrite(&lastSpeed, sizeof(lastSpeed), 1, recordFile);
+    }
+    if (dt != lastDt) {
+        lastDt = dt;
+        WriteRecordHeader(REPLAY_CMD_DT, sizeof(float));
+        fwrite(&lastDt, sizeof(lastDt), 1, recordFile);
+    }
+}
+
+void ReplayEndTick(void) {
+    replayTick++;
+}
+
+// --- Playback ---
+
+bool ReplayOpen(const char* path) {
+    playFile = fopen(path, "rb");
+    if (!playFile) return false;
+
+    ReplayHeader header;
+    if (fread(&header.magic, sizeof(header.magic), 1, playFile) != 1 ||
+        fread(&header.version, sizeof(header.version), 1, playFile) != 1 ||
+        fread(&header.seed, sizeof(header.seed), 1, playFile) != 1 ||
+        header.magic != REPLAY_MAGIC || header.version != REPLAY_VERSION) {
+        ReplayClose();
+        return false;
+    }
+
+    char savePath[512];
+    SavePathFor(path, savePath, sizeof(savePath));
+    if (!LoadWorld(savePath)) {
+        ReplayClose();
+        return false;
+    }
+    SeedSimRng(header.seed);
+    UseDeterministicBudgets();
+
+    replayTick = 0;
+    playDt = TICK_DT;
+    endTick = 0;
+    hasEndHash = false;
+    pendingValid = ReadRecordHeader(&pending);
+    return true;
+}
+
+bool ReplayApplyTick(float* dt) {
+    while (pendingValid && pending.tick <= replayTick) {
+        ReplayRecordHeader rec = pending;
+        switch (rec.type) {
+            case REPLAY_CMD_DRAG: {
+                DragCommand cmd;
+                if (rec.length != sizeof(cmd) || fread(&cmd, sizeof(cmd), 1, playFile) != 1) return false;
+                applying = true;
+                ExecuteDragCommand(&cmd);
+                applying = false;
+                break;
+            }
+            case REPLAY_CMD_CONSOLE: {
+                int16_t cell[3];
+                char line[CON_MAX_LINE];
+                size_t len = rec.length - sizeof(cell);
+                if (rec.length < sizeof(cell) || len >= sizeof(line)) return false;
+                if (fread(cell, sizeof(cell), 1, playFile) != 1) return false;
+                if (fread(line, 1, len, playFile) != len) return false;
+                line[len] = '\0';
+                applying = true;
+                Console_ExecuteAt(line, cell[0], cell[1], cell[2]);
+                applying = false;
+                break;
+            }
+            case REPLAY_CMD_SPEED:
+                if (fread(&gameSpeed, sizeof(gameSpeed), 1, playFile) != 1) return false;
+                break;
+            case REPLAY_CMD_DT:
+                if (fread(&playDt, sizeof(playDt), 1, playFile) != 1) return false;
+                break;
+            case REPLAY_CMD_END:
+                if (fread(&endHash, sizeof(endHash), 1, playFile) != 1) return false;
+                hasEndHash = true;
+                endTick = rec.tick;
+                return false;
+            default:
+                // Unknown record from a newer build: skip its payload
+                if (fseek(playFile, rec.length, SEEK_CUR) != 0) return false;
+                break;
+        }
+        pendingValid = ReadRecordHeader(&pending);
+    }
+    if (!pendingValid) {
+        // Truncated recording (game crashed before the END record)
+        endTick = replayTick;
+        return false;
+    }
+    *dt = playDt;
+    return true;
+}
+
+void ReplayClose(void) {
+    if (playFile) fclose(playFile);
+    playFile = NULL;
+    pendingValid = false;
+}
+
+uint32_t ReplayGetTick(void) { return replayTick; }
+uint32_t ReplayGetEndTick(void) { return endTick; }
+bool ReplayHasEndHash(void) { return hasEndHash; }
+uint64_t ReplayGetEndHash(void) { return endHash; }
+
+// --- State hash ---
+
+static uint64_t HashBytes(uint64_t h, const void* data, size_t size) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
+uint64_t ComputeSimStateHash(void) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (int z = 0; z < gridDepth; z++)
+        for (int y = 0; y < gridHeight; y++)
+            h = HashBytes(h, grid[z][y], gridWidth * sizeof(CellType));
+    for (int i = 0; i < moverCount; i++) {
+        if (!moverActive[i]) continue;
+        h = HashBytes(h, &i, sizeof(i));
+        h = HashBytes(h, &moverPosX[i], sizeof(moverPosX[i]));
+        h = HashBytes(h, &moverPosY[i], sizeof(moverPosY[i]));
+        h = HashBytes(h, &moverPosZ[i], sizeof(moverPosZ[i]));
+    }
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        const Item* it = &items[i];
+        if (!itemActive[i]) continue;
+        h = HashBytes(h, &i, sizeof(i));
+        h = HashBytes(h, &it->type, sizeof(it->type));
+        h = HashBytes(h, &itemPosX[i], sizeof(itemPosX[i]));
+        h = HashBytes(h, &itemPosY[i], sizeof(itemPosY[i]));
+        h = HashBytes(h, &itemPosZ[i], sizeof(itemPosZ[i]));
+    }
+    return h;
+}
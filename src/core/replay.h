@@ -0,0 +1,81 @@
+// replay.h - Record player commands and replay them headless
+//
+// A recording is a save (<file>.sav) plus a command log (<file>): the
+// simulation seed, then one record per player command stamped with the tick
+// it was issued before. Replaying loads the save, reseeds the simulation
+// streams (sim_rng.h) and re-issues each command at its tick, so the same
+// ticks run on the same state and a slow tick can be timed again at will.
+//
+// Recorded: drag actions (designations, builds, zones, sandbox placement),
+// console commands, game speed and variable-timestep dt changes.
+// Not recorded: brush strokes (pile/sculpt), UI panel edits (filters,
+// bills, workshop settings) and hotkeys outside the drag/console paths.
+//
+// Usage:
+//   ./game --record run.nvr       // play, quit to finish the recording
+//   ./game --replay run.nvr [--trace trace.json]
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define REPLAY_MAGIC   0x5052564Eu  // "NVRP"
+#define REPLAY_VERSION 1
+
+typedef enum {
+    REPLAY_CMD_DRAG = 1,    // DragCommand
+    REPLAY_CMD_CONSOLE,     // int16 x, y, z target cell + command line
+    REPLAY_CMD_SPEED,       // float gameSpeed
+    REPLAY_CMD_DT,          // float tick dt (variable timestep only)
+    REPLAY_CMD_END,         // uint64 state hash after the last tick
+} ReplayCmdType;
+
+// A finished drag, with the selection state the action reads.
+// Fixed-width fields only; written to the log as is.
+typedef struct {
+    int16_t action;
+    int16_t x1, y1, x2, y2;
+    int16_t z1, z2;             // equal except for front-view drags
+    int16_t dragX, dragY;       // drag start (workshop placement, soil piles)
+    int16_t mouseX, mouseY;     // release cell (trains)
+    int16_t material;
+    int16_t wallRecipe, floorRecipe, ladderRecipe, furnitureRecipe, doorRecipe;
+    int16_t rampDirection;
+    int16_t treeType;
+    uint8_t leftClick;
+    uint8_t shift;
+    uint8_t frontView;
+    uint8_t reserved;
+} DragCommand;
+
+// Runs a drag action (core/input.c). Records it when recording.
+void ExecuteDragCommand(const DragCommand* cmd);
+
+// --- Recording ---
+bool ReplayStartRecording(const char* path, uint64_t seed);
+void ReplayStopRecording(void);
+bool ReplayIsRecording(void);
+void ReplayRecordDrag(const DragCommand* cmd);
+void ReplayRecordConsole(const char* line, int x, int y, int z);
+
+// Wrap every simulation tick while recording or replaying
+void ReplayBeginTick(float dt);
+void ReplayEndTick(void);
+
+// --- Playback ---
+// Loads <path>.sav and reseeds; the caller then loops ReplayApplyTick
+bool ReplayOpen(const char* path);
+// Issues this tick's commands; returns false once the recording is over
+bool ReplayApplyTick(float* dt);
+void ReplayClose(void);
+uint32_t ReplayGetTick(void);
+uint32_t ReplayGetEndTick(void);
+bool ReplayHasEndHash(void);
+uint64_t ReplayGetEndHash(void);
+
+// FNV-1a over grid cells, mover and item positions
+uint64_t ComputeSimStateHash(void);
+
+#endif // REPLAY_H
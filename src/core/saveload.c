@@ -6,6 +6,7 @@ bool SaveWorld(const char* filename);
 bool LoadWorld(const char* filename);
 void RebuildPostLoadState(void);
 #include "../entities/workshops.h"
+#include "../entities/item_ledger.h"
 #include "../entities/furniture.h"
 #include "../simulation/fire.h"
 #include "../simulation/smoke.h"
@@ -14,13 +15,16 @@ void RebuildPostLoadState(void);
 #include "../simulation/groundwear.h"
 #include "../simulation/floordirt.h"
 #include "../simulation/lighting.h"
+#include "../simulation/rooms.h"
 #include "../simulation/weather.h"
 #include "../simulation/plants.h"
+#include "../simulation/area_sums.h"
 #include "../simulation/farming.h"
 #include "../simulation/balance.h"
 #include "../core/sim_manager.h"
 #include "../world/material.h"
 #include "../world/biome.h"
+#include "../world/reach_cache.h"
 #include "../entities/tool_quality.h"
 #include "../entities/namegen.h"
 #include "save_migrations.h"
@@ -203,25 +207,13 @@ bool SaveWorld(const char* filename) {
     }
     
     // Fire grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fwrite(fireGrid[z][y], sizeof(FireCell), gridWidth, f);
-        }
-    }
+    SavePagedLayer(f, &fireLayer);
     
     // Smoke grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fwrite(smokeGrid[z][y], sizeof(SmokeCell), gridWidth, f);
-        }
-    }
+    SavePagedLayer(f, &smokeLayer);
     
     // Steam grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fwrite(steamGrid[z][y], sizeof(SteamCell), gridWidth, f);
-        }
-    }
+    SavePagedLayer(f, &steamLayer);
     
     // Cell flags
     for (int z = 0; z < gridDepth; z++) {
@@ -294,11 +286,7 @@ bool SaveWorld(const char* filename) {
     }
     
     // Snow grid (V45)
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fwrite(snowGrid[z][y], sizeof(uint8_t), gridWidth, f);
-        }
-    }
+    SavePagedLayer(f, &snowLayer);
     
     // Temperature grid
     for (int z = 0; z < gridDepth; z++) {
@@ -308,11 +296,7 @@ bool SaveWorld(const char* filename) {
     }
     
     // Designations
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fwrite(designations[z][y], sizeof(Designation), gridWidth, f);
-        }
-    }
+    SavePagedLayer(f, &designationLayer);
     
     // Wear grid
     for (int z = 0; z < gridDepth; z++) {
@@ -343,11 +327,7 @@ bool SaveWorld(const char* filename) {
     }
 
     // Floor dirt grid (v36+)
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fwrite(floorDirtGrid[z][y], sizeof(uint8_t), gridWidth, f);
-        }
-    }
+    SavePagedLayer(f, &floorDirtLayer);
 
     // Explored grid (fog of war, v75+)
     for (int z = 0; z < gridDepth; z++) {
@@ -377,7 +357,11 @@ bool SaveWorld(const char* filename) {
     
     // Items
     fwrite(&itemHighWaterMark, sizeof(itemHighWaterMark), 1, f);
-    fwrite(items, sizeof(Item), itemHighWaterMark, f);
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        ItemRecord record;
+        PackItemRecord(i, &record);
+        fwrite(&record, sizeof(ItemRecord), 1, f);
+    }
     
     // Stockpiles
     fwrite(stockpiles, sizeof(Stockpile), MAX_STOCKPILES, f);
@@ -394,7 +378,11 @@ bool SaveWorld(const char* filename) {
     
     // Movers (v69+: struct without path, then paths separately)
     fwrite(&moverCount, sizeof(moverCount), 1, f);
-    fwrite(movers, sizeof(Mover), moverCount, f);
+    for (int i = 0; i < moverCount; i++) {
+        MoverRecord record;
+        PackMoverRecord(i, &record);
+        fwrite(&record, sizeof(MoverRecord), 1, f);
+    }
     for (int i = 0; i < moverCount; i++) {
         fwrite(moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
     }
@@ -486,8 +474,10 @@ void RebuildPostLoadState(void) {
     // Rebuild entity count globals
     itemCount = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active) itemCount++;
+        if (itemActive[i]) itemCount++;
     }
+    RebuildItemLedger();
+    ClearReachCache();
     stockpileCount = 0;
     for (int i = 0; i < MAX_STOCKPILES; i++) {
         if (stockpiles[i].active) stockpileCount++;
@@ -505,7 +495,7 @@ void RebuildPostLoadState(void) {
     RebuildFurnitureMoveCostGrid();
     for (int i = 0; i < MAX_FURNITURE; i++) {
         if (furniture[i].active && furniture[i].occupant >= 0) {
-            if (furniture[i].occupant >= moverCount || !movers[furniture[i].occupant].active) {
+            if (furniture[i].occupant >= moverCount || !moverActive[furniture[i].occupant]) {
                 furniture[i].occupant = -1;
             }
         }
@@ -521,8 +511,8 @@ void RebuildPostLoadState(void) {
     
     // Clear transient item reservations (not meaningful across save/load)
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active) {
-            items[i].reservedBy = -1;
+        if (itemActive[i]) {
+            itemReservedBy[i] = -1;
         }
     }
 
@@ -540,6 +530,15 @@ void RebuildPostLoadState(void) {
     }
 }
 
+// Sparse layers: allocated pages since v94, dense rows before
+static void LoadSparseLayer(FILE* f, PagedLayer* layer, int version) {
+    if (version >= 94) {
+        LoadPagedLayer(f, layer);
+    } else {
+        LoadDensePagedLayer(f, layer);
+    }
+}
+
 bool LoadWorld(const char* filename) {
     FILE* f = fopen(filename, "rb");
     if (!f) {
@@ -637,26 +636,14 @@ bool LoadWorld(const char* filename) {
     }
     
     // Fire grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fread(fireGrid[z][y], sizeof(FireCell), gridWidth, f);
-        }
-    }
+    LoadSparseLayer(f, &fireLayer, version);
     SyncFireLighting();
     
     // Smoke grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fread(smokeGrid[z][y], sizeof(SmokeCell), gridWidth, f);
-        }
-    }
+    LoadSparseLayer(f, &smokeLayer, version);
     
     // Steam grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fread(steamGrid[z][y], sizeof(SteamCell), gridWidth, f);
-        }
-    }
+    LoadSparseLayer(f, &steamLayer, version);
     
     // Cell flags
     for (int z = 0; z < gridDepth; z++) {
@@ -729,11 +716,7 @@ bool LoadWorld(const char* filename) {
     }
     
     // Snow grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fread(snowGrid[z][y], sizeof(uint8_t), gridWidth, f);
-        }
-    }
+    LoadSparseLayer(f, &snowLayer, version);
     
     // Temperature grid
     for (int z = 0; z < gridDepth; z++) {
@@ -743,18 +726,9 @@ bool LoadWorld(const char* filename) {
     }
     
     // Designations
-    activeDesignationCount = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fread(designations[z][y], sizeof(Designation), gridWidth, f);
-            // Count active designations for early-exit optimizations
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type != DESIGNATION_NONE) {
-                    activeDesignationCount++;
-                }
-            }
-        }
-    }
+    LoadSparseLayer(f, &designationLayer, version);
+    // Count active designations for early-exit optimizations
+    activeDesignationCount = CountActiveDesignations();
     
     // Wear grid
     for (int z = 0; z < gridDepth; z++) {
@@ -785,11 +759,7 @@ bool LoadWorld(const char* filename) {
     }
 
     // Floor dirt grid
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            fread(floorDirtGrid[z][y], sizeof(uint8_t), gridWidth, f);
-        }
-    }
+    LoadSparseLayer(f, &floorDirtLayer, version);
 
     // Explored grid (fog of war)
     for (int z = 0; z < gridDepth; z++) {
@@ -814,7 +784,7 @@ bool LoadWorld(const char* filename) {
             }
         }
     } else {
-        memset(trackConnections, 0, sizeof(trackConnections));
+        CLEAR_WORLD_LAYER(trackConnections);
     }
 
     // === ENTITIES SECTION ===
@@ -828,27 +798,29 @@ bool LoadWorld(const char* filename) {
     
     // Items
     fread(&itemHighWaterMark, sizeof(itemHighWaterMark), 1, f);
-    if (version >= 92) {
-        fread(items, sizeof(Item), itemHighWaterMark, f);
-    } else {
-        // v91 and below: Item struct without temperature field
-        for (int i = 0; i < itemHighWaterMark; i++) {
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        ItemRecord record;
+        if (version >= 92) {
+            fread(&record, sizeof(ItemRecord), 1, f);
+        } else {
+            // v91 and below: Item struct without temperature field
             ItemV91 old;
             fread(&old, sizeof(ItemV91), 1, f);
-            items[i].x = old.x; items[i].y = old.y; items[i].z = old.z;
-            items[i].type = old.type; items[i].state = old.state;
-            items[i].material = old.material; items[i].natural = old.natural;
-            items[i].active = old.active; items[i].reservedBy = old.reservedBy;
-            items[i].unreachableCooldown = old.unreachableCooldown;
-            items[i].stackCount = old.stackCount; items[i].containedIn = old.containedIn;
-            items[i].contentCount = old.contentCount; items[i].contentTypeMask = old.contentTypeMask;
-            items[i].spoilageTimer = old.spoilageTimer; items[i].condition = old.condition;
-            items[i].temperature = 0.0f;
-        }
+            record.x = old.x; record.y = old.y; record.z = old.z;
+            record.type = old.type; record.state = old.state;
+            record.material = old.material; record.natural = old.natural;
+            record.active = old.active; record.reservedBy = old.reservedBy;
+            record.unreachableCooldown = old.unreachableCooldown;
+            record.stackCount = old.stackCount; record.containedIn = old.containedIn;
+            record.contentCount = old.contentCount; record.contentTypeMask = old.contentTypeMask;
+            record.spoilageTimer = old.spoilageTimer; record.condition = old.condition;
+            record.temperature = 0.0f;
+        }
+        UnpackItemRecord(i, &record);
     }
     // Ensure default materials for any missing entries
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].material == MAT_NONE) {
             items[i].material = DefaultMaterialForItemType(items[i].type);
         }
@@ -904,17 +876,24 @@ bool LoadWorld(const char* filename) {
     // Movers
     fread(&moverCount, sizeof(moverCount), 1, f);
     if (version >= 93) {
-        // v93+: Mover struct with bladder field
-        fread(movers, sizeof(Mover), moverCount, f);
+        // v93+: Mover records with bladder field
+        for (int i = 0; i < moverCount; i++) {
+            MoverRecord record;
+            fread(&record, sizeof(MoverRecord), 1, f);
+            UnpackMoverRecord(i, &record);
+        }
         for (int i = 0; i < moverCount; i++) {
             fread(moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
         }
     } else if (version >= 90) {
         // v90-v92: Mover without bladder (4 bytes smaller at end)
         for (int i = 0; i < moverCount; i++) {
-            fread(&movers[i], sizeof(Mover) - sizeof(float), 1, f);
+            MoverRecord record;
+            memset(&record, 0, sizeof(record));
+            fread(&record, sizeof(MoverRecord) - sizeof(float), 1, f);
             fread(moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
-            movers[i].bladder = 1.0f;
+            record.bladder = 1.0f;
+            UnpackMoverRecord(i, &record);
         }
     } else if (version >= 86) {
         // v86-v89: Mover without mood fields
@@ -923,12 +902,12 @@ bool LoadWorld(const char* filename) {
             fread(&old, sizeof(MoverV89), 1, f);
             fread(moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
             Mover* m = &movers[i];
-            m->x = old.x; m->y = old.y; m->z = old.z;
+            moverPosX[i] = old.x; moverPosY[i] = old.y; moverPosZ[i] = old.z;
             m->goal = old.goal;
-            m->pathLength = old.pathLength;
-            m->pathIndex = old.pathIndex;
-            m->active = old.active;
-            m->needsRepath = old.needsRepath;
+            moverPathLength[i] = old.pathLength;
+            moverPathIndex[i] = old.pathIndex;
+            moverActive[i] = old.active;
+            moverNeedsRepath[i] = old.needsRepath;
             m->repathCooldown = old.repathCooldown;
             m->speed = old.speed;
             m->timeNearWaypoint = old.timeNearWaypoint;
@@ -947,7 +926,7 @@ bool LoadWorld(const char* filename) {
             m->dehydrationTimer = old.dehydrationTimer;
             m->bodyTemp = old.bodyTemp;
             m->hypothermiaTimer = old.hypothermiaTimer;
-            m->avoidX = old.avoidX; m->avoidY = old.avoidY;
+            moverAvoidX[i] = old.avoidX; moverAvoidY[i] = old.avoidY;
             m->currentJobId = old.currentJobId;
             m->lastJobType = old.lastJobType;
             m->lastJobResult = old.lastJobResult;
@@ -977,12 +956,12 @@ bool LoadWorld(const char* filename) {
             fread(&old, sizeof(MoverV85), 1, f);
             fread(moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
             Mover* m = &movers[i];
-            m->x = old.x; m->y = old.y; m->z = old.z;
+            moverPosX[i] = old.x; moverPosY[i] = old.y; moverPosZ[i] = old.z;
             m->goal = old.goal;
-            m->pathLength = old.pathLength;
-            m->pathIndex = old.pathIndex;
-            m->active = old.active;
-            m->needsRepath = old.needsRepath;
+            moverPathLength[i] = old.pathLength;
+            moverPathIndex[i] = old.pathIndex;
+            moverActive[i] = old.active;
+            moverNeedsRepath[i] = old.needsRepath;
             m->repathCooldown = old.repathCooldown;
             m->speed = old.speed;
             m->timeNearWaypoint = old.timeNearWaypoint;
@@ -1001,7 +980,7 @@ bool LoadWorld(const char* filename) {
             m->dehydrationTimer = old.dehydrationTimer;
             m->bodyTemp = old.bodyTemp;
             m->hypothermiaTimer = old.hypothermiaTimer;
-            m->avoidX = old.avoidX; m->avoidY = old.avoidY;
+            moverAvoidX[i] = old.avoidX; moverAvoidY[i] = old.avoidY;
             m->currentJobId = old.currentJobId;
             m->lastJobType = old.lastJobType;
             m->lastJobResult = old.lastJobResult;
@@ -1031,12 +1010,12 @@ bool LoadWorld(const char* filename) {
             fread(&old, sizeof(MoverV82), 1, f);
             fread(moverPaths[i], sizeof(Point), MAX_MOVER_PATH, f);
             Mover* m = &movers[i];
-            m->x = old.x; m->y = old.y; m->z = old.z;
+            moverPosX[i] = old.x; moverPosY[i] = old.y; moverPosZ[i] = old.z;
             m->goal = old.goal;
-            m->pathLength = old.pathLength;
-            m->pathIndex = old.pathIndex;
-            m->active = old.active;
-            m->needsRepath = old.needsRepath;
+            moverPathLength[i] = old.pathLength;
+            moverPathIndex[i] = old.pathIndex;
+            moverActive[i] = old.active;
+            moverNeedsRepath[i] = old.needsRepath;
             m->repathCooldown = old.repathCooldown;
             m->speed = old.speed;
             m->timeNearWaypoint = old.timeNearWaypoint;
@@ -1055,7 +1034,7 @@ bool LoadWorld(const char* filename) {
             m->dehydrationTimer = old.dehydrationTimer;
             m->bodyTemp = old.bodyTemp;
             m->hypothermiaTimer = old.hypothermiaTimer;
-            m->avoidX = old.avoidX; m->avoidY = old.avoidY;
+            moverAvoidX[i] = old.avoidX; moverAvoidY[i] = old.avoidY;
             m->currentJobId = old.currentJobId;
             m->lastJobType = old.lastJobType;
             m->lastJobResult = old.lastJobResult;
@@ -1221,6 +1200,7 @@ bool LoadWorld(const char* filename) {
     if (plantCount > 0) {
         fread(plants, sizeof(Plant), plantCount, f);
     }
+    InvalidateAreaSums();
     
     // Furniture
     {
@@ -1316,6 +1296,9 @@ bool LoadWorld(const char* filename) {
 
     // Rebuild active cell counters from loaded simulation grids
     RebuildSimActivityCounts();
+
+    // Rooms aren't saved: drop the previous world's rooms and re-flood
+    InitRooms();
     
     // Rebuild HPA* graph after loading - mark all chunks dirty
     hpaNeedsRebuild = true;
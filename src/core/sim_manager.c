@@ -8,9 +8,21 @@
 #include "../simulation/groundwear.h"
 #include "../simulation/floordirt.h"
 #include "../simulation/farming.h"
+#include "../simulation/weather.h"
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
+#include "../world/designations.h"
+#include "../entities/mover.h"
+#include "../entities/items.h"
+#include "../entities/animals.h"
+#include "../entities/trains.h"
+#include "../entities/jobs.h"
+#include "../simulation/needs.h"
+#include "../simulation/mood.h"
+#include "event_log.h"
+#include "../../shared/profiler.h"
 #include "vendor/raylib.h"
+#include <string.h>
 
 // Active cell counts for early exit
 int waterActiveCells = 0;
@@ -24,6 +36,69 @@ int treeRegenCells = 0;
 int wearActiveCells = 0;
 int dirtActiveCells = 0;
 
+// Per-chunk activity for slow-decay layers
+int chunkActiveCells[ACTIVITY_LAYER_COUNT][MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
+uint64_t chunkActiveMask[ACTIVITY_LAYER_COUNT][MAX_GRID_DEPTH][MAX_CHUNKS_Y][CHUNK_MASK_WORDS];
+int chunkActiveTotal[ACTIVITY_LAYER_COUNT];
+
+void ChunkActivityAdd(ActivityLayer layer, int x, int y, int z, int delta) {
+    int cx = x / chunkWidth;
+    int cy = y / chunkHeight;
+    int* count = &chunkActiveCells[layer][z][cy][cx];
+    *count += delta;
+#ifndef NDEBUG
+    // Every -1 pairs with an earlier +1; a cell that went inactive without
+    // having been counted means some write bypassed its setter
+    if (*count < 0) {
+        TraceLog(LOG_WARNING, "Chunk activity underflow: layer %d chunk (%d,%d,%d) = %d after cell (%d,%d,%d)",
+                 layer, cx, cy, z, *count, x, y, z);
+    }
+#endif
+    chunkActiveTotal[layer] += delta;
+    if (*count > 0) {
+        chunkActiveMask[layer][z][cy][cx >> 6] |= (uint64_t)1 << (cx & 63);
+    } else {
+        chunkActiveMask[layer][z][cy][cx >> 6] &= ~((uint64_t)1 << (cx & 63));
+    }
+}
+
+void ClearChunkActivity(ActivityLayer layer) {
+    memset(chunkActiveCells[layer], 0, sizeof(chunkActiveCells[layer]));
+    memset(chunkActiveMask[layer], 0, sizeof(chunkActiveMask[layer]));
+    chunkActiveTotal[layer] = 0;
+}
+
+static void ClearAllChunkActivity(void) {
+    for (int l = 0; l < ACTIVITY_LAYER_COUNT; l++) {
+        ClearChunkActivity((ActivityLayer)l);
+    }
+}
+
+// Which slow-decay layers a cell is active in (bit per ActivityLayer)
+static int CellActivityBits(int x, int y, int z) {
+    int bits = 0;
+    if (IsWearTrackedCell(x, y, z) && GetGroundWear(x, y, z) > 0) bits |= 1 << ACTIVITY_WEAR;
+    if (FloorDirtAt(x, y, z) > 0) bits |= 1 << ACTIVITY_DIRT;
+    if (GetSnowLevel(x, y, z) > 0) bits |= 1 << ACTIVITY_SNOW;
+    if (GET_CELL_WETNESS(x, y, z) > 0) bits |= 1 << ACTIVITY_WETNESS;
+    return bits;
+}
+
+void RebuildChunkActivity(void) {
+    ClearAllChunkActivity();
+    for (int z = 0; z < gridDepth; z++) {
+        for (int y = 0; y < gridHeight; y++) {
+            for (int x = 0; x < gridWidth; x++) {
+                int bits = CellActivityBits(x, y, z);
+                if (bits == 0) continue;
+                for (int l = 0; l < ACTIVITY_LAYER_COUNT; l++) {
+                    if (bits & (1 << l)) ChunkActivityAdd((ActivityLayer)l, x, y, z, 1);
+                }
+            }
+        }
+    }
+}
+
 void InitSimActivity(void) {
     waterActiveCells = 0;
     steamActiveCells = 0;
@@ -65,7 +140,7 @@ void RebuildSimActivityCounts(void) {
                     steamActiveCells++;
                 }
                 // Fire: level > 0 or is source
-                FireCell *fc = &fireGrid[z][y][x];
+                const FireCell* fc = FireCellAt(x, y, z);
                 if (fc->level > 0 || fc->isSource) {
                     fireActiveCells++;
                 }
@@ -93,14 +168,6 @@ void RebuildSimActivityCounts(void) {
                     treeHarvestState[z][y][x] < TREE_HARVEST_MAX) {
                     treeRegenCells++;
                 }
-                // Groundwear: worn dirt terrain tiles
-                if (cell == CELL_WALL && IsWallNatural(x, y, z) && GetWallMaterial(x, y, z) == MAT_DIRT && GetGroundWear(x, y, z) > 0) {
-                    wearActiveCells++;
-                }
-                // Floor dirt: constructed floor tiles with tracked-in dirt
-                if (floorDirtGrid[z][y][x] > 0) {
-                    dirtActiveCells++;
-                }
                 // Farm: tilled cells
                 if (farmGrid[z][y][x].tilled) {
                     farmActiveCells++;
@@ -108,6 +175,51 @@ void RebuildSimActivityCounts(void) {
             }
         }
     }
+
+    // Slow-decay layers: worn dirt terrain, tracked-in floor dirt, snow, wetness
+    RebuildChunkActivity();
+    wearActiveCells = chunkActiveTotal[ACTIVITY_WEAR];
+    dirtActiveCells = chunkActiveTotal[ACTIVITY_DIRT];
+}
+
+// Scratch for ValidateSimActivityCounts (per-chunk counts recomputed from grids)
+static int actualChunkCells[ACTIVITY_LAYER_COUNT][MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
+
+// Compare per-chunk counts with actualChunkCells; on mismatch, adopt the actual
+// counts and rebuild masks and totals. Returns true if nothing had drifted.
+static bool ValidateChunkActivity(void) {
+    bool valid = true;
+    for (int l = 0; l < ACTIVITY_LAYER_COUNT; l++) {
+        for (int z = 0; z < gridDepth; z++) {
+            for (int cy = 0; cy < chunksY; cy++) {
+                for (int cx = 0; cx < chunksX; cx++) {
+                    int actual = actualChunkCells[l][z][cy][cx];
+                    bool actualMask = actual > 0;
+                    if (chunkActiveCells[l][z][cy][cx] != actual || ChunkHasActivity((ActivityLayer)l, z, cx, cy) != actualMask) {
+                        TraceLog(LOG_WARNING, "Chunk activity drift: layer %d chunk (%d,%d,%d) = %d, actual = %d (correcting)",
+                                 l, cx, cy, z, chunkActiveCells[l][z][cy][cx], actual);
+                        valid = false;
+                    }
+                }
+            }
+        }
+    }
+    if (valid) return true;
+
+    for (int l = 0; l < ACTIVITY_LAYER_COUNT; l++) {
+        ClearChunkActivity((ActivityLayer)l);
+        for (int z = 0; z < gridDepth; z++) {
+            for (int cy = 0; cy < chunksY; cy++) {
+                for (int cx = 0; cx < chunksX; cx++) {
+                    int actual = actualChunkCells[l][z][cy][cx];
+                    chunkActiveCells[l][z][cy][cx] = actual;
+                    chunkActiveTotal[l] += actual;
+                    if (actual > 0) chunkActiveMask[l][z][cy][cx >> 6] |= (uint64_t)1 << (cx & 63);
+                }
+            }
+        }
+    }
+    return false;
 }
 
 // Validate activity counters against actual grid state, auto-correct if drift detected
@@ -116,6 +228,8 @@ bool ValidateSimActivityCounts(void) {
     int actualWater = 0, actualSteam = 0, actualFire = 0, actualSmoke = 0;
     int actualTempSource = 0, actualTempUnstable = 0, actualTree = 0, actualTreeRegen = 0, actualWear = 0, actualDirt = 0, actualFarm = 0;
     
+    memset(actualChunkCells, 0, sizeof(actualChunkCells));
+
     // Count actual active cells from grids (same logic as RebuildSimActivityCounts)
     for (int z = 0; z < gridDepth; z++) {
         int ambient = GetAmbientTemperature(z);
@@ -124,7 +238,7 @@ bool ValidateSimActivityCounts(void) {
                 WaterCell *wc = &waterGrid[z][y][x];
                 if (wc->level > 0 || wc->isSource || wc->isDrain) actualWater++;
                 if (GetSteamLevel(x, y, z) > 0) actualSteam++;
-                FireCell *fc = &fireGrid[z][y][x];
+                const FireCell* fc = FireCellAt(x, y, z);
                 if (fc->level > 0 || fc->isSource) actualFire++;
                 if (GetSmokeLevel(x, y, z) > 0) actualSmoke++;
                 if (IsHeatSource(x, y, z) || IsColdSource(x, y, z)) actualTempSource++;
@@ -135,8 +249,12 @@ bool ValidateSimActivityCounts(void) {
                 if (cell == CELL_TREE_TRUNK &&
                     (z == 0 || grid[z - 1][y][x] != CELL_TREE_TRUNK) &&
                     treeHarvestState[z][y][x] < TREE_HARVEST_MAX) actualTreeRegen++;
-                if (cell == CELL_WALL && IsWallNatural(x, y, z) && GetWallMaterial(x, y, z) == MAT_DIRT && GetGroundWear(x, y, z) > 0) actualWear++;
-                if (floorDirtGrid[z][y][x] > 0) actualDirt++;
+                int bits = CellActivityBits(x, y, z);
+                for (int l = 0; l < ACTIVITY_LAYER_COUNT; l++) {
+                    if (bits & (1 << l)) actualChunkCells[l][z][y / chunkHeight][x / chunkWidth]++;
+                }
+                if (bits & (1 << ACTIVITY_WEAR)) actualWear++;
+                if (bits & (1 << ACTIVITY_DIRT)) actualDirt++;
                 if (farmGrid[z][y][x].tilled) actualFarm++;
             }
         }
@@ -164,6 +282,32 @@ bool ValidateSimActivityCounts(void) {
     CHECK_COUNTER(farmActiveCells, actualFarm);
 
     #undef CHECK_COUNTER
+
+    if (!ValidateChunkActivity()) valid = false;
     
     return valid;
 }
+
+void RunSimTick(float dt) {
+    PROFILE_BEGIN(Tick);
+    TickWithDt(dt);
+    PROFILE_END(Tick);
+    PROFILE_BEGIN(ItemsTick);
+    ItemsTick(dt);
+    PROFILE_END(ItemsTick);
+    PROFILE_BEGIN(AnimalsTick);
+    AnimalsTick(dt);
+    PROFILE_END(AnimalsTick);
+    TrainsTick(dt);
+    DesignationsTick(dt);
+    NeedsTick();
+    ProcessFreetimeNeeds();
+    MoodTick(dt);
+    PROFILE_BEGIN(AssignJobs);
+    AssignJobs();
+    PROFILE_END(AssignJobs);
+    PROFILE_BEGIN(JobsTick);
+    JobsTick();
+    PROFILE_END(JobsTick);
+    EventLogStreamFlush();
+}
@@ -2,6 +2,8 @@
 #define SIM_MANAGER_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "../world/grid.h"
 
 // =============================================================================
 // SIMULATION ACTIVITY TRACKING
@@ -21,8 +23,48 @@ extern int treeRegenCells;     // Trunk bases with harvest state < MAX (regenera
 extern int wearActiveCells;    // Dirt tiles with wear > 0
 extern int dirtActiveCells;    // Floor tiles with tracked-in dirt > 0
 
+// =============================================================================
+// PER-CHUNK ACTIVITY (slow-decay layers)
+// Cells with non-zero state are also counted per chunk, and every chunk row
+// keeps a bitmask of the chunks whose count is non-zero, so recovery and melt
+// passes only visit chunks that have something to do.
+// One bit per chunk column, in 64-bit words (one word at the default caps).
+// =============================================================================
+
+#define CHUNK_MASK_WORDS ((MAX_CHUNKS_X + 63) / 64)
+
+typedef enum {
+    ACTIVITY_WEAR,      // same cells as wearActiveCells
+    ACTIVITY_DIRT,      // same cells as dirtActiveCells
+    ACTIVITY_SNOW,      // snow level > 0
+    ACTIVITY_WETNESS,   // cell wetness > 0 (any material)
+    ACTIVITY_LAYER_COUNT
+} ActivityLayer;
+
+extern int chunkActiveCells[ACTIVITY_LAYER_COUNT][MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
+extern uint64_t chunkActiveMask[ACTIVITY_LAYER_COUNT][MAX_GRID_DEPTH][MAX_CHUNKS_Y][CHUNK_MASK_WORDS];
+extern int chunkActiveTotal[ACTIVITY_LAYER_COUNT];
+
+// Adjust the count for the chunk containing (x,y,z) by +1/-1 (cell became active/inactive)
+void ChunkActivityAdd(ActivityLayer layer, int x, int y, int z, int delta);
+void ClearChunkActivity(ActivityLayer layer);
+void RebuildChunkActivity(void);  // Recount every layer from grids (grid re-init, chunk size change)
+
+static inline bool ChunkHasActivity(ActivityLayer layer, int z, int cx, int cy) {
+    return (chunkActiveMask[layer][z][cy][cx >> 6] >> (cx & 63)) & 1;
+}
+
 void InitSimActivity(void);
 void RebuildSimActivityCounts(void);  // Rebuild counters from grids (call after load)
 bool ValidateSimActivityCounts(void); // Validate counters, auto-correct if drift detected (returns true if valid)
 
+// =============================================================================
+// SIM TICK
+// One fixed step of every entity system, in the order the game loop, the
+// headless runner, replays and bench_sim all share. Ends by flushing the
+// event log stream.
+// =============================================================================
+
+void RunSimTick(float dt);
+
 #endif // SIM_MANAGER_H
@@ -0,0 +1,66 @@
+// sim_rng.c - Seeded random streams for the simulation (PCG32 per stream)
+
+#include "sim_rng.h"
+#include <stdbool.h>
+
+typedef struct {
+    uint64_t state;
+    uint64_t inc;   // odd; selects the PCG sequence
+} PcgStream;
+
+static PcgStream rngStreams[RNG_STREAM_COUNT];
+static uint64_t rngSeed = 0;
+static bool rngSeeded = false;
+
+static uint64_t SplitMix64(uint64_t* x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static uint32_t PcgNext(PcgStream* s) {
+    uint64_t old = s->state;
+    s->state = old * 6364136223846793005ULL + s->inc;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+}
+
+void SeedSimRng(uint64_t seed) {
+    uint64_t x = seed;
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        PcgStream* s = &rngStreams[i];
+        s->state = 0;
+        s->inc = (SplitMix64(&x) << 1) | 1u;
+        PcgNext(s);
+        s->state += SplitMix64(&x);
+        PcgNext(s);
+    }
+    rngSeed = seed;
+    rngSeeded = true;
+}
+
+uint64_t GetSimRngSeed(void) {
+    return rngSeed;
+}
+
+uint32_t SimRandU32(RngStream stream) {
+    if (!rngSeeded) SeedSimRng(0);
+    return PcgNext(&rngStreams[stream]);
+}
+
+int SimRand(RngStream stream) {
+    return (int)(SimRandU32(stream) >> 1);
+}
+
+int SimRandRange(RngStream stream, int min, int max) {
+    if (max < min) {
+        int t = min;
+        min = max;
+        max = t;
+    }
+    uint32_t span = (uint32_t)((int64_t)max - min + 1);
+    if (span == 0) return (int)SimRandU32(stream);  // full 32-bit range
+    return min + (int)(SimRandU32(stream) % span);
+}
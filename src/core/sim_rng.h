@@ -0,0 +1,53 @@
+// sim_rng.h - Seeded random streams for the simulation
+//
+// Every subsystem draws from its own PCG32 stream, all derived from one seed.
+// A subsystem's rolls don't depend on how many numbers another one used, so
+// the same seed and the same inputs give the same simulation, and subsystems
+// that run on worker threads can own a stream each.
+//
+// The simulation must not use rand() or raylib's GetRandomValue: rendering
+// and UI draw from those between ticks, which would make a run depend on the
+// frame rate. Worldgen and UI keep using GetRandomValue.
+//
+// Usage:
+//   SeedSimRng(worldSeed);                          // new world, load, replay start
+//   if (SimRand(RNG_FIRE) % 100 < spreadPercent)    // drop-in for rand() % n
+//   int d = SimRandRange(RNG_MOVERS, 0, 59);        // inclusive, like GetRandomValue
+
+#ifndef SIM_RNG_H
+#define SIM_RNG_H
+
+#include <stdint.h>
+
+typedef enum {
+    RNG_MOVERS,        // random goals, repath jitter
+    RNG_JOBS,          // job outcomes, construction refunds
+    RNG_ANIMALS,
+    RNG_TRAINS,
+    RNG_FIRE,
+    RNG_SMOKE,
+    RNG_STEAM,
+    RNG_WATER,
+    RNG_GROUNDWEAR,
+    RNG_WEATHER,
+    RNG_MOOD,
+    RNG_STREAM_COUNT
+} RngStream;
+
+#define SIM_RAND_MAX 0x7FFFFFFF
+
+// Reseed every stream from one seed
+void SeedSimRng(uint64_t seed);
+
+// Seed of the last SeedSimRng call
+uint64_t GetSimRngSeed(void);
+
+uint32_t SimRandU32(RngStream stream);
+
+// 0..SIM_RAND_MAX
+int SimRand(RngStream stream);
+
+// min..max inclusive
+int SimRandRange(RngStream stream, int min, int max);
+
+#endif // SIM_RNG_H
@@ -1,5 +1,6 @@
 #include "state_audit.h"
 #include "../entities/items.h"
+#include "../entities/item_ledger.h"
 #include "../entities/item_defs.h"
 #include "../entities/stockpiles.h"
 #include "../entities/jobs.h"
@@ -7,6 +8,7 @@
 #include "../world/designations.h"
 #include "../world/construction.h"
 #include "../world/grid.h"
+#include "../world/material.h"
 #include "../simulation/farming.h"
 #include <stdio.h>
 #include <stdarg.h>
@@ -44,12 +46,12 @@ int AuditItemStockpileConsistency(bool verbose) {
 
     // Check: every ITEM_IN_STOCKPILE item should be in an active cell of an active stockpile
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_IN_STOCKPILE) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_IN_STOCKPILE) continue;
 
-        int ix = (int)(items[i].x / CELL_SIZE);
-        int iy = (int)(items[i].y / CELL_SIZE);
-        int iz = (int)items[i].z;
+        int ix = (int)(itemPosX[i] / CELL_SIZE);
+        int iy = (int)(itemPosY[i] / CELL_SIZE);
+        int iz = (int)itemPosZ[i];
 
         bool found = false;
         for (int s = 0; s < MAX_STOCKPILES; s++) {
@@ -103,7 +105,7 @@ int AuditItemStockpileConsistency(bool verbose) {
                     AUDIT_LOG("Stockpile %d slot %d has slotCounts=%d but slots[]=%d (invalid index)",
                               s, idx, sp->slotCounts[idx], itemIdx);
                 }
-            } else if (!items[itemIdx].active) {
+            } else if (!itemActive[itemIdx]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Stockpile %d slot %d has slotCounts=%d but item %d is inactive",
@@ -124,10 +126,10 @@ int AuditItemReservations(bool verbose) {
 
     // Check: every item with reservedBy != -1 should have a matching active job
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].reservedBy == -1) continue;
+        if (!itemActive[i]) continue;
+        if (itemReservedBy[i] == -1) continue;
 
-        int reservedBy = items[i].reservedBy;
+        int reservedBy = itemReservedBy[i];
 
         // reservedBy is a mover index — find if any active job references this item
         bool foundJob = false;
@@ -145,12 +147,12 @@ int AuditItemReservations(bool verbose) {
 
         // Also check if this item is a mover's equipped tool or clothing (no job needed)
         bool isEquippedTool = false;
-        if (reservedBy >= 0 && reservedBy < MAX_MOVERS && movers[reservedBy].active &&
+        if (reservedBy >= 0 && reservedBy < MAX_MOVERS && moverActive[reservedBy] &&
             movers[reservedBy].equippedTool == i) {
             isEquippedTool = true;
         }
         bool isEquippedClothing = false;
-        if (reservedBy >= 0 && reservedBy < MAX_MOVERS && movers[reservedBy].active &&
+        if (reservedBy >= 0 && reservedBy < MAX_MOVERS && moverActive[reservedBy] &&
             movers[reservedBy].equippedClothing == i) {
             isEquippedClothing = true;
         }
@@ -159,7 +161,7 @@ int AuditItemReservations(bool verbose) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Item %d (%s) at (%.0f,%.0f,z%.0f) reservedBy=%d but no active job references it and not equipped",
-                          i, ItemName(items[i].type), items[i].x, items[i].y, items[i].z, reservedBy);
+                          i, ItemName(items[i].type), itemPosX[i], itemPosY[i], itemPosZ[i], reservedBy);
             }
         }
     }
@@ -172,7 +174,7 @@ int AuditItemReservations(bool verbose) {
 
         // targetItem
         if (job->targetItem >= 0 && job->targetItem < MAX_ITEMS) {
-            if (!items[job->targetItem].active) {
+            if (!itemActive[job->targetItem]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Job %d (%s) targetItem=%d is inactive",
@@ -183,7 +185,7 @@ int AuditItemReservations(bool verbose) {
 
         // carryingItem
         if (job->carryingItem >= 0 && job->carryingItem < MAX_ITEMS) {
-            if (!items[job->carryingItem].active) {
+            if (!itemActive[job->carryingItem]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Job %d (%s) carryingItem=%d is inactive",
@@ -194,7 +196,7 @@ int AuditItemReservations(bool verbose) {
 
         // targetItem2
         if (job->targetItem2 >= 0 && job->targetItem2 < MAX_ITEMS) {
-            if (!items[job->targetItem2].active) {
+            if (!itemActive[job->targetItem2]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Job %d (%s) targetItem2=%d is inactive",
@@ -205,7 +207,7 @@ int AuditItemReservations(bool verbose) {
 
         // targetItem3
         if (job->targetItem3 >= 0 && job->targetItem3 < MAX_ITEMS) {
-            if (!items[job->targetItem3].active) {
+            if (!itemActive[job->targetItem3]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Job %d (%s) targetItem3=%d is inactive",
@@ -216,7 +218,7 @@ int AuditItemReservations(bool verbose) {
 
         // fuelItem
         if (job->fuelItem >= 0 && job->fuelItem < MAX_ITEMS) {
-            if (!items[job->fuelItem].active) {
+            if (!itemActive[job->fuelItem]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Job %d (%s) fuelItem=%d is inactive",
@@ -227,7 +229,7 @@ int AuditItemReservations(bool verbose) {
 
         // toolItem
         if (job->toolItem >= 0 && job->toolItem < MAX_ITEMS) {
-            if (!items[job->toolItem].active) {
+            if (!itemActive[job->toolItem]) {
                 violations++;
                 if (verbose) {
                     AUDIT_LOG("Job %d (%s) toolItem=%d is inactive",
@@ -247,7 +249,7 @@ int AuditMoverJobConsistency(bool verbose) {
     int violations = 0;
 
     for (int i = 0; i < moverCount; i++) {
-        if (!movers[i].active) continue;
+        if (!moverActive[i]) continue;
 
         int jobId = movers[i].currentJobId;
         if (jobId < 0) continue;
@@ -285,7 +287,7 @@ int AuditMoverJobConsistency(bool verbose) {
         if (job->assignedMover < 0) continue;
 
         int mi = job->assignedMover;
-        if (mi >= MAX_MOVERS || !movers[mi].active) {
+        if (mi >= MAX_MOVERS || !moverActive[mi]) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Job %d (%s) assignedMover=%d but mover is %s",
@@ -411,7 +413,7 @@ int AuditStockpileFreeSlotCounts(bool verbose) {
 
             if (sp->slotIsContainer[idx]) {
                 int containerIdx = sp->slots[idx];
-                if (containerIdx >= 0 && containerIdx < MAX_ITEMS && items[containerIdx].active) {
+                if (containerIdx >= 0 && containerIdx < MAX_ITEMS && itemActive[containerIdx]) {
                     const ContainerDef* def = GetContainerDef(items[containerIdx].type);
                     if (def && items[containerIdx].contentCount + sp->reservedBy[idx] < def->maxContents) {
                         computed++;
@@ -443,7 +445,7 @@ static int AuditEquippedTools(bool verbose) {
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
 
-        if (!m->active) {
+        if (!moverActive[i]) {
             if (m->equippedTool >= 0) {
                 violations++;
                 if (verbose) {
@@ -465,7 +467,7 @@ static int AuditEquippedTools(bool verbose) {
         }
 
         Item* tool = &items[toolIdx];
-        if (!tool->active) {
+        if (!itemActive[toolIdx]) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Mover %d equippedTool=%d but item is inactive", i, toolIdx);
@@ -473,19 +475,19 @@ static int AuditEquippedTools(bool verbose) {
             continue;
         }
 
-        if (tool->state != ITEM_CARRIED) {
+        if (itemState[toolIdx] != ITEM_CARRIED) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Mover %d equippedTool=%d but item state is %d (expected ITEM_CARRIED=%d)",
-                          i, toolIdx, tool->state, ITEM_CARRIED);
+                          i, toolIdx, itemState[toolIdx], ITEM_CARRIED);
             }
         }
 
-        if (tool->reservedBy != i) {
+        if (itemReservedBy[toolIdx] != i) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Mover %d equippedTool=%d but item.reservedBy=%d (expected %d)",
-                          i, toolIdx, tool->reservedBy, i);
+                          i, toolIdx, itemReservedBy[toolIdx], i);
             }
         }
 
@@ -501,7 +503,7 @@ static int AuditEquippedTools(bool verbose) {
     // Check equipped clothing consistency
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) {
+        if (!moverActive[i]) {
             if (m->equippedClothing >= 0) {
                 violations++;
                 if (verbose) {
@@ -523,7 +525,7 @@ static int AuditEquippedTools(bool verbose) {
         }
 
         Item* cloth = &items[clothIdx];
-        if (!cloth->active) {
+        if (!itemActive[clothIdx]) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Mover %d equippedClothing=%d but item is inactive", i, clothIdx);
@@ -531,19 +533,19 @@ static int AuditEquippedTools(bool verbose) {
             continue;
         }
 
-        if (cloth->state != ITEM_CARRIED) {
+        if (itemState[clothIdx] != ITEM_CARRIED) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Mover %d equippedClothing=%d but item state is %d (expected ITEM_CARRIED=%d)",
-                          i, clothIdx, cloth->state, ITEM_CARRIED);
+                          i, clothIdx, itemState[clothIdx], ITEM_CARRIED);
             }
         }
 
-        if (cloth->reservedBy != i) {
+        if (itemReservedBy[clothIdx] != i) {
             violations++;
             if (verbose) {
                 AUDIT_LOG("Mover %d equippedClothing=%d but item.reservedBy=%d (expected %d)",
-                          i, clothIdx, cloth->reservedBy, i);
+                          i, clothIdx, itemReservedBy[clothIdx], i);
             }
         }
 
@@ -587,6 +589,53 @@ int AuditFarmConsistency(bool verbose) {
     return violations;
 }
 
+// ---------------------------------------------------------------------------
+// 9. Item ledger matches a full recount
+// ---------------------------------------------------------------------------
+static int auditLedgerCounts[ITEM_TYPE_COUNT][MAT_COUNT][ITEM_LEDGER_LOCATIONS];
+
+int AuditItemLedger(bool verbose) {
+    int violations = 0;
+    static const char* locationNames[ITEM_LEDGER_LOCATIONS] = {"ground", "carried", "stockpile", "container"};
+
+    memset(auditLedgerCounts, 0, sizeof(auditLedgerCounts));
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        if (!itemActive[i]) continue;
+        if (items[i].type < 0 || items[i].type >= ITEM_TYPE_COUNT) continue;
+        if (itemState[i] >= ITEM_LEDGER_LOCATIONS) continue;
+        int mat = items[i].material < MAT_COUNT ? items[i].material : MAT_NONE;
+        auditLedgerCounts[items[i].type][mat][itemState[i]] += items[i].stackCount;
+    }
+
+    for (int t = 0; t < ITEM_TYPE_COUNT; t++) {
+        for (int loc = 0; loc < ITEM_LEDGER_LOCATIONS; loc++) {
+            int typeTotal = 0;
+            for (int m = 0; m < MAT_COUNT; m++) {
+                int counted = auditLedgerCounts[t][m][loc];
+                int ledger = LedgerItemCountOfMaterial((ItemType)t, (uint8_t)m, (ItemState)loc);
+                typeTotal += counted;
+                if (counted != ledger) {
+                    violations++;
+                    if (verbose) {
+                        AUDIT_LOG("Ledger %s (%s) %s: ledger %d, recount %d",
+                                  ItemName((ItemType)t), MaterialName(m), locationNames[loc], ledger, counted);
+                    }
+                }
+            }
+            int ledgerTotal = LedgerItemCount((ItemType)t, (ItemState)loc);
+            if (typeTotal != ledgerTotal) {
+                violations++;
+                if (verbose) {
+                    AUDIT_LOG("Ledger %s %s total: ledger %d, recount %d",
+                              ItemName((ItemType)t), locationNames[loc], ledgerTotal, typeTotal);
+                }
+            }
+        }
+    }
+
+    return violations;
+}
+
 // ---------------------------------------------------------------------------
 int RunStateAudit(bool verbose) {
     int total = 0;
@@ -599,6 +648,7 @@ int RunStateAudit(bool verbose) {
     total += AuditStockpileFreeSlotCounts(verbose);
     total += AuditEquippedTools(verbose);
     total += AuditFarmConsistency(verbose);
+    total += AuditItemLedger(verbose);
 
     if (verbose) {
         if (auditUseStdout) {
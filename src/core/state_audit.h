@@ -15,6 +15,7 @@ int AuditBlueprintReservations(bool verbose);
 int AuditStockpileSlotReservations(bool verbose);
 int AuditStockpileFreeSlotCounts(bool verbose);
 int AuditFarmConsistency(bool verbose);
+int AuditItemLedger(bool verbose);
 
 // Set output mode: false = TraceLog (runtime), true = printf (inspect CLI)
 void SetAuditOutputStdout(bool useStdout);
@@ -1,5 +1,6 @@
 #include "time.h"
 #include "../entities/mover.h"  // For Tick() and TICK_DT
+#include "sim_rng.h"
 #include <stdlib.h>
 #include <stdbool.h>
 
@@ -59,6 +60,7 @@ void RunGameSeconds(float seconds) {
 
 void ResetTestState(unsigned int seed) {
     srand(seed);
+    SeedSimRng(seed);
     ResetTime();
     // Note: Individual systems may need their accumulators reset too
     // This will be extended as we convert systems to use game time
@@ -7,6 +7,7 @@
 #include "../simulation/groundwear.h"
 #include "../entities/mover.h"  // For CELL_SIZE, movers[], moverCount
 #include "../../experiments/steering/steering.h"
+#include "../core/sim_rng.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -16,6 +17,7 @@ int animalCount = 0;
 bool animalRespawnEnabled = true;
 int animalTargetPopulation = 8;
 float animalSpawnInterval = 180.0f;  // 3 game-minutes
+int animalGeneration = 0;
 
 // Shared context steering instance (cleared per-animal per-tick)
 static ContextSteering steeringCtx;
@@ -35,8 +37,8 @@ void SpawnAnimal(AnimalType type, int spawnZ, AnimalBehavior behavior) {
     // Find random walkable cell on given z-level
     int attempts = 200;
     while (attempts-- > 0) {
-        int cx = rand() % gridWidth;
-        int cy = rand() % gridHeight;
+        int cx = SimRand(RNG_ANIMALS) % gridWidth;
+        int cy = SimRand(RNG_ANIMALS) % gridHeight;
         int cz = spawnZ;
         if (IsCellWalkableAt(cz, cy, cx) && GetWaterLevel(cx, cy, cz) == 0) {
             Animal* a = &animals[slot];
@@ -47,15 +49,16 @@ void SpawnAnimal(AnimalType type, int spawnZ, AnimalBehavior behavior) {
             a->state = ANIMAL_IDLE;
             a->behavior = behavior;
             a->active = true;
+            animalGeneration++;
             a->speed = ANIMAL_SPEED;
             a->stateTimer = 0.0f;
             a->grazeTimer = 0.0f;
-            a->animPhase = (float)(rand() % 1000) / 1000.0f * 6.28f;
+            a->animPhase = (float)(SimRand(RNG_ANIMALS) % 1000) / 1000.0f * 6.28f;
             a->targetCellX = cx;
             a->targetCellY = cy;
             a->velX = 0.0f;
             a->velY = 0.0f;
-            a->wanderAngle = (float)(rand() % 1000) / 1000.0f * 6.28f;
+            a->wanderAngle = (float)(SimRand(RNG_ANIMALS) % 1000) / 1000.0f * 6.28f;
             a->targetAnimalIdx = -1;
             a->markedForHunt = false;
             a->reservedByHunter = -1;
@@ -67,6 +70,7 @@ void SpawnAnimal(AnimalType type, int spawnZ, AnimalBehavior behavior) {
 
 void ClearAnimals(void) {
     animalCount = 0;
+    animalGeneration++;
     for (int i = 0; i < MAX_ANIMALS; i++) {
         animals[i].active = false;
     }
@@ -152,11 +156,19 @@ static bool IsTargetValid(int tx, int ty, int tz) {
 static bool IsMoverHunting(int moverIdx) {
     if (moverIdx < 0 || moverIdx >= moverCount) return false;
     Mover* m = &movers[moverIdx];
-    if (!m->active || m->currentJobId < 0) return false;
+    if (!moverActive[moverIdx] || m->currentJobId < 0) return false;
     Job* job = GetJob(m->currentJobId);
     return job && job->active && job->type == JOBTYPE_HUNT;
 }
 
+// steering_wander jitters from raylib's generator; jitter from the animal
+// stream instead so wandering replays the same
+static SteeringOutput AnimalWander(const Boid* boid, Animal* a) {
+    const float jitter = 3.0f;
+    a->wanderAngle += ((float)SimRand(RNG_ANIMALS) / SIM_RAND_MAX * 2.0f - 1.0f) * jitter;
+    return steering_wander(boid, 15.0f, 30.0f, 0.0f, &a->wanderAngle);
+}
+
 static void BehaviorSimpleGrazer(Animal* a, float dt) {
     // Frozen while being attacked by hunter
     if (a->state == ANIMAL_BEING_HUNTED) return;
@@ -172,10 +184,10 @@ static void BehaviorSimpleGrazer(Animal* a, float dt) {
 
     // Flee from hunter if being actively hunted
     if (a->reservedByHunter >= 0 && IsMoverHunting(a->reservedByHunter)) {
-        Mover* hunter = &movers[a->reservedByHunter];
-        if ((int)hunter->z == cz) {
-            float dx = hunter->x - a->x;
-            float dy = hunter->y - a->y;
+        int moverIdx = a->reservedByHunter;
+        if ((int)moverPosZ[moverIdx] == cz) {
+            float dx = moverPosX[moverIdx] - a->x;
+            float dy = moverPosY[moverIdx] - a->y;
             float distSq = dx * dx + dy * dy;
             float detectRadius = CELL_SIZE * 10.0f;
             if (distSq < detectRadius * detectRadius && distSq > 0.01f) {
@@ -217,7 +229,7 @@ static void BehaviorSimpleGrazer(Animal* a, float dt) {
             } else {
                 // No grass nearby — wander to random walkable neighbor
                 int dirs[4][2] = {{0,-1},{1,0},{0,1},{-1,0}};
-                int start = rand() % 4;
+                int start = SimRand(RNG_ANIMALS) % 4;
                 for (int i = 0; i < 4; i++) {
                     int d = (start + i) % 4;
                     int nx = cx + dirs[d][0];
@@ -396,14 +408,14 @@ static void BehaviorSteeringGrazer(Animal* a, float dt) {
     }
     // Detect hunter mover as predator-level threat
     if (a->reservedByHunter >= 0 && IsMoverHunting(a->reservedByHunter)) {
-        Mover* hunter = &movers[a->reservedByHunter];
-        if ((int)hunter->z == cz) {
-            float dx = hunter->x - a->x;
-            float dy = hunter->y - a->y;
+        int moverIdx = a->reservedByHunter;
+        if ((int)moverPosZ[moverIdx] == cz) {
+            float dx = moverPosX[moverIdx] - a->x;
+            float dy = moverPosY[moverIdx] - a->y;
             float distSq = dx * dx + dy * dy;
             float awareRadiusSq = (CELL_SIZE * 10.0f) * (CELL_SIZE * 10.0f);
             if (distSq < awareRadiusSq && predatorCount < MAX_ANIMALS) {
-                predatorPositions[predatorCount++] = (Vector2){ hunter->x, hunter->y };
+                predatorPositions[predatorCount++] = (Vector2){ moverPosX[moverIdx], moverPosY[moverIdx] };
                 if (distSq < nearestPredatorDistSq) nearestPredatorDistSq = distSq;
             }
         }
@@ -433,7 +445,7 @@ static void BehaviorSteeringGrazer(Animal* a, float dt) {
             Vector2 grassPos = { (grassX + 0.5f) * CELL_SIZE, (grassY + 0.5f) * CELL_SIZE };
             ctx_interest_seek(&steeringCtx, boid.pos, grassPos, 1.0f);
         } else {
-            SteeringOutput wanderOut = steering_wander(&boid, 15.0f, 30.0f, 3.0f, &a->wanderAngle);
+            SteeringOutput wanderOut = AnimalWander(&boid, a);
             if (wanderOut.linear.x != 0 || wanderOut.linear.y != 0) {
                 Vector2 wanderDir = steering_vec_normalize(wanderOut.linear);
                 ctx_interest_seek(&steeringCtx, boid.pos,
@@ -508,13 +520,12 @@ static void BehaviorSteeringGrazer(Animal* a, float dt) {
     Vector2 moverPositions[64];
     int nearMoverCount = 0;
     for (int i = 0; i < moverCount && nearMoverCount < 64; i++) {
-        Mover* m = &movers[i];
-        if (!m->active) continue;
-        if ((int)m->z != cz) continue;
-        float dx = m->x - a->x;
-        float dy = m->y - a->y;
+        if (!moverActive[i]) continue;
+        if ((int)moverPosZ[i] != cz) continue;
+        float dx = moverPosX[i] - a->x;
+        float dy = moverPosY[i] - a->y;
         if (dx * dx + dy * dy < STEERING_MOVER_FLEE_RADIUS * STEERING_MOVER_FLEE_RADIUS) {
-            moverPositions[nearMoverCount++] = (Vector2){ m->x, m->y };
+            moverPositions[nearMoverCount++] = (Vector2){ moverPosX[i], moverPosY[i] };
         }
     }
     if (nearMoverCount > 0) {
@@ -612,6 +623,13 @@ static void BehaviorSteeringGrazer(Animal* a, float dt) {
 #define PREDATOR_DETECT_RADIUS (CELL_SIZE * 10)
 #define PREDATOR_REST_TIME 3.0f
 
+// Live grazer on the predator's z-level
+static bool IsPreyAnimal(AgentKind kind, int idx, void* userData) {
+    (void)kind;
+    const Animal* other = &animals[idx];
+    return other->active && other->type == ANIMAL_GRAZER && (int)other->z == *(int*)userData;
+}
+
 static void BehaviorPredator(Animal* a, float dt) {
     if (!steeringCtxInitialized) {
         ctx_init(&steeringCtx, 8);
@@ -654,17 +672,20 @@ static void BehaviorPredator(Animal* a, float dt) {
 
     // --- Find nearest prey ---
     int bestPrey = -1;
-    float bestDistSq = PREDATOR_DETECT_RADIUS * PREDATOR_DETECT_RADIUS;
-    for (int i = 0; i < animalCount; i++) {
-        Animal* other = &animals[i];
-        if (!other->active || other->type != ANIMAL_GRAZER) continue;
-        if ((int)other->z != cz) continue;
-        float dx = other->x - a->x;
-        float dy = other->y - a->y;
-        float distSq = dx * dx + dy * dy;
-        if (distSq < bestDistSq) {
-            bestDistSq = distSq;
-            bestPrey = i;
+    if (AgentGridHasCurrentAnimals()) {
+        bestPrey = FindNearestAgent(a->x, a->y, cz, PREDATOR_DETECT_RADIUS, AGENT_MASK(AGENT_ANIMAL),
+                                    IsPreyAnimal, &cz, NULL);
+    } else {
+        float bestDistSq = PREDATOR_DETECT_RADIUS * PREDATOR_DETECT_RADIUS;
+        for (int i = 0; i < animalCount; i++) {
+            if (!IsPreyAnimal(AGENT_ANIMAL, i, &cz)) continue;
+            float dx = animals[i].x - a->x;
+            float dy = animals[i].y - a->y;
+            float distSq = dx * dx + dy * dy;
+            if (distSq < bestDistSq) {
+                bestDistSq = distSq;
+                bestPrey = i;
+            }
         }
     }
     a->targetAnimalIdx = bestPrey;
@@ -677,7 +698,7 @@ static void BehaviorPredator(Animal* a, float dt) {
         ctx_interest_pursuit(&steeringCtx, boid.pos, boid.vel, preyPos, preyVel, 1.0f, 1.0f);
     } else {
         // Wander when no prey found
-        SteeringOutput wanderOut = steering_wander(&boid, 15.0f, 30.0f, 3.0f, &a->wanderAngle);
+        SteeringOutput wanderOut = AnimalWander(&boid, a);
         if (wanderOut.linear.x != 0 || wanderOut.linear.y != 0) {
             Vector2 wanderDir = steering_vec_normalize(wanderOut.linear);
             ctx_interest_seek(&steeringCtx, boid.pos,
@@ -775,12 +796,12 @@ void SpawnAnimalAtEdge(AnimalType type, int spawnZ, AnimalBehavior behavior) {
     while (attempts-- > 0) {
         int cx, cy;
         // Pick random edge cell
-        int edge = rand() % 4;
+        int edge = SimRand(RNG_ANIMALS) % 4;
         switch (edge) {
-            case 0: cx = 0;               cy = rand() % gridHeight; break;
-            case 1: cx = gridWidth - 1;    cy = rand() % gridHeight; break;
-            case 2: cx = rand() % gridWidth; cy = 0;               break;
-            default: cx = rand() % gridWidth; cy = gridHeight - 1;  break;
+            case 0: cx = 0;               cy = SimRand(RNG_ANIMALS) % gridHeight; break;
+            case 1: cx = gridWidth - 1;    cy = SimRand(RNG_ANIMALS) % gridHeight; break;
+            case 2: cx = SimRand(RNG_ANIMALS) % gridWidth; cy = 0;               break;
+            default: cx = SimRand(RNG_ANIMALS) % gridWidth; cy = gridHeight - 1;  break;
         }
         if (IsCellWalkableAt(spawnZ, cy, cx) && GetWaterLevel(cx, cy, spawnZ) == 0) {
             Animal* a = &animals[slot];
@@ -791,15 +812,16 @@ void SpawnAnimalAtEdge(AnimalType type, int spawnZ, AnimalBehavior behavior) {
             a->state = ANIMAL_IDLE;
             a->behavior = behavior;
             a->active = true;
+            animalGeneration++;
             a->speed = ANIMAL_SPEED;
             a->stateTimer = 0.0f;
             a->grazeTimer = 0.0f;
-            a->animPhase = (float)(rand() % 1000) / 1000.0f * 6.28f;
+            a->animPhase = (float)(SimRand(RNG_ANIMALS) % 1000) / 1000.0f * 6.28f;
             a->targetCellX = cx;
             a->targetCellY = cy;
             a->velX = 0.0f;
             a->velY = 0.0f;
-            a->wanderAngle = (float)(rand() % 1000) / 1000.0f * 6.28f;
+            a->wanderAngle = (float)(SimRand(RNG_ANIMALS) % 1000) / 1000.0f * 6.28f;
             a->targetAnimalIdx = -1;
             a->markedForHunt = false;
             a->reservedByHunter = -1;
@@ -832,7 +854,7 @@ static void AnimalRespawnTick(float dt) {
 
     for (int s = 0; s < spawnCount && active + s < animalTargetPopulation; s++) {
         // 80% grazer, 20% predator (capped at 2 predators)
-        bool spawnPredator = (rand() % 5 == 0) && predatorCount < 2;
+        bool spawnPredator = (SimRand(RNG_ANIMALS) % 5 == 0) && predatorCount < 2;
         if (spawnPredator) {
             SpawnAnimalAtEdge(ANIMAL_PREDATOR, 1, BEHAVIOR_PREDATOR);
             predatorCount++;
@@ -52,6 +52,7 @@ extern int animalCount;
 extern bool animalRespawnEnabled;
 extern int animalTargetPopulation;
 extern float animalSpawnInterval;
+extern int animalGeneration;     // Bumped on spawn/clear so cached animal indexes know they're stale
 
 // Core functions
 void SpawnAnimal(AnimalType type, int z, AnimalBehavior behavior);
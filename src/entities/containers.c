@@ -19,7 +19,7 @@ const ContainerDef* GetContainerDef(ItemType type) {
 bool CanPutItemInContainer(int itemIdx, int containerIdx) {
     if (itemIdx < 0 || itemIdx >= MAX_ITEMS) return false;
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return false;
-    if (!items[itemIdx].active || !items[containerIdx].active) return false;
+    if (!itemActive[itemIdx] || !itemActive[containerIdx]) return false;
     if (itemIdx == containerIdx) return false;
 
     const ContainerDef* def = GetContainerDef(items[containerIdx].type);
@@ -36,7 +36,7 @@ bool CanPutItemInContainer(int itemIdx, int containerIdx) {
     ItemType inType = items[itemIdx].type;
     uint8_t inMat = items[itemIdx].material;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
         if (items[i].type == inType && items[i].material == inMat) {
             // Can merge if stack has room
@@ -56,7 +56,7 @@ void PutItemInContainer(int itemIdx, int containerIdx) {
     ItemType inType = items[itemIdx].type;
     uint8_t inMat = items[itemIdx].material;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
         if (items[i].type == inType && items[i].material == inMat) {
             int maxStack = ItemMaxStack(inType);
@@ -66,13 +66,13 @@ void PutItemInContainer(int itemIdx, int containerIdx) {
                 // MergeItemIntoStack handles DeleteItem on full merge
                 // which decrements contentCount via DeleteItem's containedIn check.
                 // If partial merge, incoming item still exists — put remainder in container.
-                if (items[itemIdx].active) {
+                if (itemActive[itemIdx]) {
                     // Partial merge: remainder becomes a new entry in container
                     items[itemIdx].containedIn = containerIdx;
-                    items[itemIdx].state = ITEM_IN_CONTAINER;
-                    items[itemIdx].x = items[containerIdx].x;
-                    items[itemIdx].y = items[containerIdx].y;
-                    items[itemIdx].z = items[containerIdx].z;
+                    SetItemState(itemIdx, ITEM_IN_CONTAINER);
+                    itemPosX[itemIdx] = itemPosX[containerIdx];
+                    itemPosY[itemIdx] = itemPosY[containerIdx];
+                    itemPosZ[itemIdx] = itemPosZ[containerIdx];
                     items[containerIdx].contentCount++;
                     items[containerIdx].contentTypeMask |= (1u << (inType % 32));
                 }
@@ -83,17 +83,17 @@ void PutItemInContainer(int itemIdx, int containerIdx) {
 
     // No merge target — add as new entry
     items[itemIdx].containedIn = containerIdx;
-    items[itemIdx].state = ITEM_IN_CONTAINER;
-    items[itemIdx].x = items[containerIdx].x;
-    items[itemIdx].y = items[containerIdx].y;
-    items[itemIdx].z = items[containerIdx].z;
+    SetItemState(itemIdx, ITEM_IN_CONTAINER);
+    itemPosX[itemIdx] = itemPosX[containerIdx];
+    itemPosY[itemIdx] = itemPosY[containerIdx];
+    itemPosZ[itemIdx] = itemPosZ[containerIdx];
     items[containerIdx].contentCount++;
     items[containerIdx].contentTypeMask |= (1u << (inType % 32));
 }
 
 void RemoveItemFromContainer(int itemIdx) {
     if (itemIdx < 0 || itemIdx >= MAX_ITEMS) return;
-    if (!items[itemIdx].active) return;
+    if (!itemActive[itemIdx]) return;
     if (items[itemIdx].containedIn == -1) return;
 
     int parentIdx = items[itemIdx].containedIn;
@@ -105,21 +105,21 @@ void RemoveItemFromContainer(int itemIdx) {
     }
 
     // Decrement direct parent's contentCount
-    if (parentIdx >= 0 && parentIdx < MAX_ITEMS && items[parentIdx].active) {
+    if (parentIdx >= 0 && parentIdx < MAX_ITEMS && itemActive[parentIdx]) {
         items[parentIdx].contentCount--;
     }
 
     // Remove from container
     items[itemIdx].containedIn = -1;
-    items[itemIdx].state = ITEM_ON_GROUND;
+    SetItemState(itemIdx, ITEM_ON_GROUND);
 
     // Position at outermost container's location via safe drop
-    SafeDropItem(itemIdx, items[outerIdx].x, items[outerIdx].y, (int)items[outerIdx].z);
+    SafeDropItem(itemIdx, itemPosX[outerIdx], itemPosY[outerIdx], (int)itemPosZ[outerIdx]);
 }
 
 bool IsContainerFull(int containerIdx) {
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return true;
-    if (!items[containerIdx].active) return true;
+    if (!itemActive[containerIdx]) return true;
     const ContainerDef* def = GetContainerDef(items[containerIdx].type);
     if (!def) return true;
     return items[containerIdx].contentCount >= def->maxContents;
@@ -138,14 +138,14 @@ bool ContainerMightHaveType(int containerIdx, ItemType type) {
 
 bool IsItemAccessible(int itemIdx) {
     if (itemIdx < 0 || itemIdx >= MAX_ITEMS) return false;
-    if (!items[itemIdx].active) return false;
+    if (!itemActive[itemIdx]) return false;
 
     // Walk up containedIn chain — if any ancestor is reserved or carried, not accessible
     int current = items[itemIdx].containedIn;
     while (current != -1) {
-        if (!items[current].active) return false;
-        if (items[current].reservedBy != -1) return false;
-        if (items[current].state == ITEM_CARRIED) return false;
+        if (!itemActive[current]) return false;
+        if (itemReservedBy[current] != -1) return false;
+        if (itemState[current] == ITEM_CARRIED) return false;
         current = items[current].containedIn;
     }
     return true;
@@ -153,39 +153,39 @@ bool IsItemAccessible(int itemIdx) {
 
 void MoveContainer(int containerIdx, float x, float y, float z) {
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return;
-    if (!items[containerIdx].active) return;
+    if (!itemActive[containerIdx]) return;
 
-    items[containerIdx].x = x;
-    items[containerIdx].y = y;
-    items[containerIdx].z = z;
+    itemPosX[containerIdx] = x;
+    itemPosY[containerIdx] = y;
+    itemPosZ[containerIdx] = z;
 
     // Recursively update all direct children
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
         // If this child is also a container, recurse
         if (items[i].contentCount > 0) {
             MoveContainer(i, x, y, z);
         } else {
-            items[i].x = x;
-            items[i].y = y;
-            items[i].z = z;
+            itemPosX[i] = x;
+            itemPosY[i] = y;
+            itemPosZ[i] = z;
         }
     }
 }
 
 void SpillContainerContents(int containerIdx) {
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return;
-    if (!items[containerIdx].active) return;
+    if (!itemActive[containerIdx]) return;
 
     // Spill direct children only — sub-containers keep their contents
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
 
         items[i].containedIn = -1;
-        items[i].state = ITEM_ON_GROUND;
-        SafeDropItem(i, items[containerIdx].x, items[containerIdx].y, (int)items[containerIdx].z);
+        SetItemState(i, ITEM_ON_GROUND);
+        SafeDropItem(i, itemPosX[containerIdx], itemPosY[containerIdx], (int)itemPosZ[containerIdx]);
     }
 
     items[containerIdx].contentCount = 0;
@@ -195,7 +195,7 @@ void SpillContainerContents(int containerIdx) {
 void ForEachContainedItem(int containerIdx, ContainerContentCallback cb, void* data) {
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
         cb(i, data);
     }
@@ -203,7 +203,7 @@ void ForEachContainedItem(int containerIdx, ContainerContentCallback cb, void* d
 
 static void ForEachRecursiveHelper(int containerIdx, ContainerContentCallback cb, void* data) {
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
         cb(i, data);
         // Recurse into sub-containers
@@ -225,7 +225,7 @@ static void WeightSumCallback(int itemIdx, void* data) {
 
 float GetContainerTotalWeight(int containerIdx) {
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return 0.0f;
-    if (!items[containerIdx].active) return 0.0f;
+    if (!itemActive[containerIdx]) return 0.0f;
 
     float total = ItemWeight(items[containerIdx].type) * items[containerIdx].stackCount;
     ForEachContainedItemRecursive(containerIdx, WeightSumCallback, &total);
@@ -246,7 +246,7 @@ static int SearchContainerForItem(int containerIdx, ItemType type, int excludeIt
                                   ContainerItemFilter extraFilter, void* filterData,
                                   int* outContainerIdx) {
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].containedIn != containerIdx) continue;
 
         // Check sub-containers recursively
@@ -259,8 +259,8 @@ static int SearchContainerForItem(int containerIdx, ItemType type, int excludeIt
         // Check this item
         if (items[i].type != type) continue;
         if (i == excludeItemIdx) continue;
-        if (items[i].reservedBy != -1) continue;
-        if (items[i].unreachableCooldown > 0.0f) continue;
+        if (itemReservedBy[i] != -1) continue;
+        if (itemUnreachableCooldown[i] > 0.0f) continue;
         if (extraFilter && !extraFilter(i, filterData)) continue;
 
         if (outContainerIdx) *outContainerIdx = GetOutermostContainer(containerIdx);
@@ -280,18 +280,18 @@ int FindItemInContainers(ItemType type, int z, int searchCenterX, int searchCent
     int bestDistSq = searchRadius * searchRadius;
 
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (!GetContainerDef(items[i].type)) continue;
         if (items[i].contentCount <= 0) continue;
-        int iz = (int)items[i].z;
+        int iz = (int)itemPosZ[i];
         if (iz < z - 1 || iz > z + 1) continue;
 
         // Only search top-level containers (not nested ones — those are reached via recursion)
         if (items[i].containedIn != -1) continue;
 
         // Distance check (tile coords)
-        int tileX = (int)(items[i].x / CELL_SIZE);
-        int tileY = (int)(items[i].y / CELL_SIZE);
+        int tileX = (int)(itemPosX[i] / CELL_SIZE);
+        int tileY = (int)(itemPosY[i] / CELL_SIZE);
         int dx = tileX - searchCenterX;
         int dy = tileY - searchCenterY;
         int distSq = dx * dx + dy * dy;
@@ -303,8 +303,8 @@ int FindItemInContainers(ItemType type, int z, int searchCenterX, int searchCent
         // filter check in SearchContainerForItem handles sub-containers.
 
         // Skip if container is reserved or carried
-        if (items[i].reservedBy != -1) continue;
-        if (items[i].state == ITEM_CARRIED) continue;
+        if (itemReservedBy[i] != -1) continue;
+        if (itemState[i] == ITEM_CARRIED) continue;
 
         // Search inside this container
         int foundContainer = -1;
@@ -6,8 +6,8 @@
 
 Furniture furniture[MAX_FURNITURE];
 int furnitureCount = 0;
-uint8_t furnitureMoveCostGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t capabilityGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(uint8_t, furnitureMoveCostGrid);
+DEFINE_WORLD_LAYER(uint8_t, capabilityGrid);
 
 static const FurnitureDef furnitureDefs[FURNITURE_TYPE_COUNT] = {
     [FURNITURE_NONE]       = { "None",       0.0f,   false, 0,  CAP_NONE },
@@ -32,8 +32,8 @@ void ClearFurniture(void) {
         furniture[i].occupant = -1;
     }
     furnitureCount = 0;
-    memset(furnitureMoveCostGrid, 0, sizeof(furnitureMoveCostGrid));
-    memset(capabilityGrid, 0, sizeof(capabilityGrid));
+    CLEAR_WORLD_LAYER(furnitureMoveCostGrid);
+    CLEAR_WORLD_LAYER(capabilityGrid);
 }
 
 int SpawnFurniture(int x, int y, int z, FurnitureType type, uint8_t material) {
@@ -79,7 +79,7 @@ int SpawnFurniture(int x, int y, int z, FurnitureType type, uint8_t material) {
         capabilityGrid[z][y][x] |= def->capabilities;
     }
 
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
     return idx;
 }
 
@@ -107,7 +107,7 @@ void RemoveFurniture(int index) {
     f->active = false;
     f->occupant = -1;
     furnitureCount--;
-    InvalidateRooms();
+    InvalidateRoomsAt(f->x, f->y, f->z);
 }
 
 int GetFurnitureAt(int x, int y, int z) {
@@ -136,7 +136,7 @@ void ReleaseFurnitureForMover(int moverIdx) {
 }
 
 void RebuildFurnitureMoveCostGrid(void) {
-    memset(furnitureMoveCostGrid, 0, sizeof(furnitureMoveCostGrid));
+    CLEAR_WORLD_LAYER(furnitureMoveCostGrid);
     for (int i = 0; i < MAX_FURNITURE; i++) {
         if (!furniture[i].active) continue;
         const FurnitureDef* def = &furnitureDefs[furniture[i].type];
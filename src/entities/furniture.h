@@ -42,8 +42,8 @@ typedef struct {
 
 extern Furniture furniture[MAX_FURNITURE];
 extern int furnitureCount;
-extern uint8_t furnitureMoveCostGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-extern uint8_t capabilityGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, furnitureMoveCostGrid);
+extern WORLD_LAYER(uint8_t, capabilityGrid);
 
 const FurnitureDef* GetFurnitureDef(FurnitureType type);
 void ClearFurniture(void);
@@ -0,0 +1,81 @@
+// item_ledger.c - Running unit counts per (item type, material, location)
+//
+// ledgerRecords[i] is what item i currently contributes; a sync subtracts
+// it and adds the item's present contribution, so syncing an unchanged item
+// is a no-op and a missed sync is repaired by the next one.
+
+#include "item_ledger.h"
+#include "../world/material.h"
+#include <string.h>
+
+#define LEDGER_NO_RECORD 0xFF
+
+typedef struct {
+    uint8_t location;  // ItemState, LEDGER_NO_RECORD = contributes nothing
+    uint8_t type;
+    uint8_t material;
+    int units;
+} LedgerRecord;
+
+static int ledgerCounts[ITEM_TYPE_COUNT][MAT_COUNT][ITEM_LEDGER_LOCATIONS];
+static int ledgerTypeCounts[ITEM_TYPE_COUNT][ITEM_LEDGER_LOCATIONS];
+static LedgerRecord ledgerRecords[MAX_ITEMS];
+
+static inline uint8_t LedgerMaterial(uint8_t material) {
+    return material < MAT_COUNT ? material : MAT_NONE;
+}
+
+static void ApplyRecord(const LedgerRecord* r, int sign) {
+    if (r->location == LEDGER_NO_RECORD) return;
+    ledgerCounts[r->type][r->material][r->location] += sign * r->units;
+    ledgerTypeCounts[r->type][r->location] += sign * r->units;
+}
+
+void ClearItemLedger(void) {
+    memset(ledgerCounts, 0, sizeof(ledgerCounts));
+    memset(ledgerTypeCounts, 0, sizeof(ledgerTypeCounts));
+    for (int i = 0; i < MAX_ITEMS; i++) ledgerRecords[i].location = LEDGER_NO_RECORD;
+}
+
+void SyncItemLedger(int itemIdx) {
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS) return;
+    LedgerRecord* r = &ledgerRecords[itemIdx];
+    ApplyRecord(r, -1);
+    r->location = LEDGER_NO_RECORD;
+
+    const Item* item = &items[itemIdx];
+    if (!itemActive[itemIdx]) return;
+    if (item->type < 0 || item->type >= ITEM_TYPE_COUNT) return;
+    if (itemState[itemIdx] >= ITEM_LEDGER_LOCATIONS) return;
+    r->location = (uint8_t)itemState[itemIdx];
+    r->type = (uint8_t)item->type;
+    r->material = LedgerMaterial(item->material);
+    r->units = item->stackCount;
+    ApplyRecord(r, 1);
+}
+
+void RebuildItemLedger(void) {
+    ClearItemLedger();
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        if (itemActive[i]) SyncItemLedger(i);
+    }
+}
+
+int LedgerItemCount(ItemType type, ItemState location) {
+    if (type < 0 || type >= ITEM_TYPE_COUNT) return 0;
+    if ((int)location < 0 || (int)location >= ITEM_LEDGER_LOCATIONS) return 0;
+    return ledgerTypeCounts[type][location];
+}
+
+int LedgerItemCountOfMaterial(ItemType type, uint8_t material, ItemState location) {
+    if (type < 0 || type >= ITEM_TYPE_COUNT) return 0;
+    if ((int)location < 0 || (int)location >= ITEM_LEDGER_LOCATIONS) return 0;
+    return ledgerCounts[type][LedgerMaterial(material)][location];
+}
+
+int LedgerItemTotal(ItemType type) {
+    if (type < 0 || type >= ITEM_TYPE_COUNT) return 0;
+    int total = 0;
+    for (int loc = 0; loc < ITEM_LEDGER_LOCATIONS; loc++) total += ledgerTypeCounts[type][loc];
+    return total;
+}
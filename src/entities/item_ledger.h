@@ -0,0 +1,44 @@
+// item_ledger.h - Running unit counts per (item type, material, location)
+//
+// Bills ("make until 20 planks in stock") and stock readouts used to walk
+// every stockpile slot per query. The ledger keeps the answer current
+// instead: each item's contribution (stackCount units of its type and
+// material, filed under its ItemState) is recorded, and re-synced whenever
+// the item is spawned, deleted, restacked or changes state. A query is one
+// array read.
+//
+// The location classes are the item states: on the ground, carried, in a
+// stockpile slot, inside a container. Items inside a container count under
+// ITEM_IN_CONTAINER wherever the container is.
+//
+// Writers go through SetItemState / SetItemStackCount (items.h), which sync
+// the ledger. Code that rewrites items[] wholesale (load, renumbering) calls
+// RebuildItemLedger. AuditItemLedger (state_audit.h) recounts from scratch.
+
+#ifndef ITEM_LEDGER_H
+#define ITEM_LEDGER_H
+
+#include "items.h"
+#include <stdint.h>
+
+#define ITEM_LEDGER_LOCATIONS (ITEM_IN_CONTAINER + 1)  // one class per ItemState
+
+// Drop every count and record (items cleared)
+void ClearItemLedger(void);
+
+// Recount every active item
+void RebuildItemLedger(void);
+
+// Re-record one item's contribution (idempotent; inactive items contribute nothing)
+void SyncItemLedger(int itemIdx);
+
+// Units of a type in one location class, any material
+int LedgerItemCount(ItemType type, ItemState location);
+
+// Units of a type and material in one location class
+int LedgerItemCountOfMaterial(ItemType type, uint8_t material, ItemState location);
+
+// Units of a type in all location classes
+int LedgerItemTotal(ItemType type);
+
+#endif // ITEM_LEDGER_H
@@ -0,0 +1,368 @@
+// item_renumber.c - Compact and reorder the item and mover pools by cell (Z-order)
+//
+// One pass: validate every stored item reference, sort active items by
+// (z, morton(cellX, cellY), old index), gather them into a scratch pool,
+// copy back, then rewrite the references and rebuild the caches keyed by
+// item index (stockpile ground items, item spatial grid, item ledger).
+//
+// The mover pass has the same shape. Movers carry a 12KB path each, so the
+// pool is permuted in place, cycle by cycle, instead of through a scratch
+// copy. Per-mover state kept by other modules follows through their
+// Renumber* hooks, and the handle tables are composed with the permutation.
+
+#include "item_renumber.h"
+#include "mover.h"
+#include "jobs.h"
+#include "stockpiles.h"
+#include "item_ledger.h"
+#include "workshops.h"
+#include "furniture.h"
+#include "animals.h"
+#include "trains.h"
+#include "path_index.h"
+#include "../world/designations.h"
+#include "../simulation/floordirt.h"
+#include "../world/grid.h"
+#include "../world/material.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+int itemRenumberInterval = 0;
+int itemRenumberCount = 0;
+int itemRenumberSkipped = 0;
+int itemRenumberMap[MAX_ITEMS];
+
+int moverRenumberInterval = 0;
+int moverRenumberCount = 0;
+int moverRenumberSkipped = 0;
+int moverRenumberMap[MAX_MOVERS];
+
+typedef struct {
+    uint64_t key;
+    int index;
+} CellSortKey;
+
+static CellSortKey renumberKeys[MAX_ITEMS > MAX_MOVERS ? MAX_ITEMS : MAX_MOVERS];
+static ItemRecord renumberScratch[MAX_ITEMS];  // hot and cold fields together
+
+// Spread the low 16 bits of v to the even bit positions
+static uint32_t SpreadBits16(uint32_t v) {
+    v &= 0xFFFF;
+    v = (v | (v << 8)) & 0x00FF00FF;
+    v = (v | (v << 4)) & 0x0F0F0F0F;
+    v = (v | (v << 2)) & 0x33333333;
+    v = (v | (v << 1)) & 0x55555555;
+    return v;
+}
+
+static uint64_t CellKey(float x, float y, float z) {
+    int cx = (int)(x / CELL_SIZE);
+    int cy = (int)(y / CELL_SIZE);
+    int cz = (int)z;
+    if (cx < 0) cx = 0;
+    if (cy < 0) cy = 0;
+    if (cz < 0) cz = 0;
+    uint32_t morton = SpreadBits16((uint32_t)cx) | (SpreadBits16((uint32_t)cy) << 1);
+    return ((uint64_t)(uint32_t)cz << 32) | morton;
+}
+
+static int CompareCellSortKey(const void* a, const void* b) {
+    const CellSortKey* ka = (const CellSortKey*)a;
+    const CellSortKey* kb = (const CellSortKey*)b;
+    if (ka->key != kb->key) return ka->key < kb->key ? -1 : 1;
+    return ka->index - kb->index;
+}
+
+// --- Reference walk ---
+// Single list of every field that holds an item index, shared by the
+// validation and rewrite passes so they cannot disagree.
+
+typedef bool (*ItemRefVisitor)(int* ref);
+
+static bool NeedTargetIsItem(const Mover* m) {
+    return m->freetimeState == FREETIME_SEEKING_FOOD || m->freetimeState == FREETIME_EATING ||
+           m->freetimeState == FREETIME_SEEKING_DRINK || m->freetimeState == FREETIME_DRINKING;
+}
+
+static bool VisitItemRefs(ItemRefVisitor visit) {
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        if (!itemActive[i]) continue;
+        if (!visit(&items[i].containedIn)) return false;
+    }
+
+    for (int j = 0; j < jobHighWaterMark; j++) {
+        Job* job = &jobs[j];
+        if (!job->active) continue;
+        if (!visit(&job->targetItem) || !visit(&job->carryingItem) ||
+            !visit(&job->fuelItem) || !visit(&job->targetItem2) ||
+            !visit(&job->targetItem3) || !visit(&job->toolItem)) return false;
+    }
+
+    for (int s = 0; s < MAX_STOCKPILES; s++) {
+        Stockpile* sp = &stockpiles[s];
+        if (!sp->active) continue;
+        int slotCount = sp->width * sp->height;
+        for (int k = 0; k < slotCount; k++) {
+            if (!visit(&sp->slots[k])) return false;
+        }
+    }
+
+    for (int m = 0; m < moverCount; m++) {
+        Mover* mv = &movers[m];
+        if (!moverActive[m]) continue;
+        if (!visit(&mv->equippedTool) || !visit(&mv->equippedClothing)) return false;
+        if (NeedTargetIsItem(mv) && !visit(&mv->needTarget)) return false;
+    }
+    return true;
+}
+
+static bool CheckItemRef(int* ref) {
+    int idx = *ref;
+    if (idx < 0) return true;
+    return idx < itemHighWaterMark && itemActive[idx];
+}
+
+static bool RemapItemRef(int* ref) {
+    if (*ref >= 0) *ref = itemRenumberMap[*ref];
+    return true;
+}
+
+// --- Item pass ---
+
+bool RenumberItemsByCell(void) {
+    if (!VisitItemRefs(CheckItemRef)) {
+        itemRenumberSkipped++;
+        return false;
+    }
+
+    int oldHighWaterMark = itemHighWaterMark;
+    for (int i = 0; i < MAX_ITEMS; i++) itemRenumberMap[i] = -1;
+    int n = 0;
+    for (int i = 0; i < oldHighWaterMark; i++) {
+        if (!itemActive[i]) continue;
+        renumberKeys[n].key = CellKey(itemPosX[i], itemPosY[i], itemPosZ[i]);
+        renumberKeys[n].index = i;
+        n++;
+    }
+    qsort(renumberKeys, n, sizeof(CellSortKey), CompareCellSortKey);
+
+    for (int k = 0; k < n; k++) {
+        int old = renumberKeys[k].index;
+        itemRenumberMap[old] = k;
+        PackItemRecord(old, &renumberScratch[k]);
+    }
+    for (int k = 0; k < n; k++) UnpackItemRecord(k, &renumberScratch[k]);
+
+    // Vacated tail slots go back to the ClearItems defaults
+    for (int i = n; i < oldHighWaterMark; i++) {
+        itemActive[i] = false;
+        itemReservedBy[i] = -1;
+        itemUnreachableCooldown[i] = 0.0f;
+        items[i].material = MAT_NONE;
+        items[i].natural = false;
+        items[i].stackCount = 1;
+        items[i].containedIn = -1;
+        items[i].contentCount = 0;
+        items[i].contentTypeMask = 0;
+        items[i].spoilageTimer = 0.0f;
+        items[i].condition = CONDITION_FRESH;
+    }
+    itemCount = n;
+    itemHighWaterMark = n;
+
+    VisitItemRefs(RemapItemRef);
+
+    RebuildStockpileGroundItemCache();
+    BuildItemSpatialGrid();
+    RebuildItemLedger();
+    itemRenumberCount++;
+    return true;
+}
+
+// --- Mover reference walk ---
+// Every field outside the mover pool that holds a mover index. Within the
+// pool, movers only name items, jobs, stations and trains.
+
+typedef bool (*MoverRefVisitor)(int* ref);
+
+static bool VisitMoverRefs(MoverRefVisitor visit) {
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        if (!itemActive[i]) continue;
+        if (!visit(&itemReservedBy[i])) return false;
+    }
+
+    for (int j = 0; j < jobHighWaterMark; j++) {
+        if (!jobs[j].active) continue;
+        if (!visit(&jobs[j].assignedMover)) return false;
+    }
+
+    for (int p = 0; p < designationLayer.allocatedCount; p++) {
+        int px, py, z;
+        PageCoords(designationLayer.allocated[p], &px, &py, &z);
+        Designation* page = (Designation*)PagedLayerPage(&designationLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) {
+            if (page[c].type == DESIGNATION_NONE) continue;
+            if (!visit(&page[c].assignedMover)) return false;
+        }
+    }
+
+    for (int b = 0; b < MAX_BLUEPRINTS; b++) {
+        if (!blueprints[b].active) continue;
+        if (!visit(&blueprints[b].assignedBuilder)) return false;
+    }
+
+    for (int w = 0; w < MAX_WORKSHOPS; w++) {
+        if (!workshops[w].active) continue;
+        if (!visit(&workshops[w].assignedCrafter) || !visit(&workshops[w].assignedDeconstructor)) return false;
+    }
+
+    for (int f = 0; f < MAX_FURNITURE; f++) {
+        if (!furniture[f].active) continue;
+        if (!visit(&furniture[f].occupant)) return false;
+    }
+
+    for (int a = 0; a < animalCount; a++) {
+        if (!animals[a].active) continue;
+        if (!visit(&animals[a].reservedByHunter)) return false;
+    }
+
+    for (int t = 0; t < trainCount; t++) {
+        if (!trains[t].active) continue;
+        for (int r = 0; r < trains[t].ridingCount; r++) {
+            if (!visit(&trains[t].ridingMovers[r])) return false;
+        }
+    }
+
+    for (int s = 0; s < stationCount; s++) {
+        if (!stations[s].active) continue;
+        for (int k = 0; k < stations[s].waitingCount; k++) {
+            if (!visit(&stations[s].waitingMovers[k])) return false;
+        }
+    }
+    return true;
+}
+
+static bool CheckMoverRef(int* ref) {
+    int idx = *ref;
+    if (idx < 0) return true;
+    return idx < moverCount && moverActive[idx];
+}
+
+static bool RemapMoverRef(int* ref) {
+    if (*ref >= 0) *ref = moverRenumberMap[*ref];
+    return true;
+}
+
+// --- Mover pass ---
+
+static int moverSlotTo[MAX_MOVERS];    // old slot -> new slot, every slot below the old moverCount
+static int moverSlotFrom[MAX_MOVERS];  // new slot -> old slot
+static int moverSlotHandle[MAX_MOVERS];
+static bool moverSlotDone[MAX_MOVERS];
+static Point pathCarry[MAX_MOVER_PATH];
+
+static void CopyMoverPath(int to, const Point* from, int length) {
+    if (length > MAX_MOVER_PATH) length = MAX_MOVER_PATH;
+    if (length > 0) memmove(moverPaths[to], from, length * sizeof(Point));
+}
+
+// One mover's cold struct and hot fields, from slot `from` to slot `to`
+static void MoveMoverSlot(int to, int from) {
+    movers[to] = movers[from];
+    moverPosX[to] = moverPosX[from];
+    moverPosY[to] = moverPosY[from];
+    moverPosZ[to] = moverPosZ[from];
+    moverAvoidX[to] = moverAvoidX[from];
+    moverAvoidY[to] = moverAvoidY[from];
+    moverPathIndex[to] = moverPathIndex[from];
+    moverPathLength[to] = moverPathLength[from];
+    moverActive[to] = moverActive[from];
+    moverNeedsRepath[to] = moverNeedsRepath[from];
+}
+
+// Apply the slot permutation to movers[] and its hot arrays, moverPaths and
+// moverFlowField, one cycle at a time with a single mover held aside
+static void PermuteMoverSlots(int slotCount) {
+    memset(moverSlotDone, 0, slotCount * sizeof(bool));
+    for (int start = 0; start < slotCount; start++) {
+        if (moverSlotDone[start] || moverSlotFrom[start] == start) continue;
+        MoverRecord carried;
+        PackMoverRecord(start, &carried);
+        int carriedFlow = moverFlowField[start];
+        int carriedLength = carried.pathLength < MAX_MOVER_PATH ? carried.pathLength : MAX_MOVER_PATH;
+        if (carriedLength > 0) memcpy(pathCarry, moverPaths[start], carriedLength * sizeof(Point));
+        int slot = start;
+        while (moverSlotFrom[slot] != start) {
+            int from = moverSlotFrom[slot];
+            MoveMoverSlot(slot, from);
+            moverFlowField[slot] = moverFlowField[from];
+            CopyMoverPath(slot, moverPaths[from], moverPathLength[from]);
+            moverSlotDone[slot] = true;
+            slot = from;
+        }
+        UnpackMoverRecord(slot, &carried);
+        moverFlowField[slot] = carriedFlow;
+        CopyMoverPath(slot, pathCarry, carried.pathLength);
+        moverSlotDone[slot] = true;
+    }
+}
+
+bool RenumberMoversByCell(void) {
+    if (!VisitMoverRefs(CheckMoverRef)) {
+        moverRenumberSkipped++;
+        return false;
+    }
+
+    int oldCount = moverCount;
+    for (int i = 0; i < MAX_MOVERS; i++) moverRenumberMap[i] = -1;
+    int n = 0;
+    for (int i = 0; i < oldCount; i++) {
+        if (!moverActive[i]) continue;
+        renumberKeys[n].key = CellKey(moverPosX[i], moverPosY[i], moverPosZ[i]);
+        renumberKeys[n].index = i;
+        n++;
+    }
+    qsort(renumberKeys, n, sizeof(CellSortKey), CompareCellSortKey);
+
+    // Active movers take slots 0..n-1 in cell order; inactive ones fill the
+    // rest in their old order, so the slots stay a permutation
+    for (int k = 0; k < n; k++) {
+        int old = renumberKeys[k].index;
+        moverRenumberMap[old] = k;
+        moverSlotTo[old] = k;
+    }
+    int tail = n;
+    for (int i = 0; i < oldCount; i++) {
+        if (!moverActive[i]) moverSlotTo[i] = tail++;
+    }
+    for (int i = 0; i < oldCount; i++) moverSlotFrom[moverSlotTo[i]] = i;
+
+    PermuteMoverSlots(oldCount);
+    moverCount = n;
+
+    VisitMoverRefs(RemapMoverRef);
+    RenumberIdleMoverList(moverRenumberMap);
+    RenumberRepathScheduler(moverRenumberMap, oldCount);
+    RenumberPathIndex(moverRenumberMap, oldCount);
+    RenumberSceneryState(moverRenumberMap, oldCount);
+    RenumberMoverDirtTracking(moverRenumberMap, oldCount);
+
+    // Handles follow their movers to the new slots
+    if (!moverHandlesRemapped) {
+        for (int i = 0; i < MAX_MOVERS; i++) {
+            moverHandleIndex[i] = i;
+            moverIndexHandle[i] = i;
+        }
+        moverHandlesRemapped = true;
+    }
+    for (int i = 0; i < oldCount; i++) moverSlotHandle[moverSlotTo[i]] = moverIndexHandle[i];
+    for (int i = 0; i < oldCount; i++) {
+        moverIndexHandle[i] = moverSlotHandle[i];
+        moverHandleIndex[moverSlotHandle[i]] = i;
+    }
+
+    BuildMoverSpatialGrid();
+    moverRenumberCount++;
+    return true;
+}
@@ -0,0 +1,57 @@
+// item_renumber.h - Compact and reorder the item and mover pools by cell (Z-order)
+//
+// Items live wherever SpawnItem found a free slot, so after a while the pool
+// is a mix of holes and neighbours that sit thousands of slots apart. A
+// renumber pass packs the active items into 0..itemCount-1 sorted by z-level,
+// then by the Morton (Z-order) code of their cell, so items that share a cell
+// or a neighbourhood are adjacent in memory. Radius queries over the item
+// spatial grid then touch few cache lines, and itemHighWaterMark scans stop
+// at itemCount.
+//
+// Every place that stores an item index (container links, job targets,
+// stockpile slots, equipped tools and clothing, food/drink targets) is
+// rewritten through itemRenumberMap. If any of them points at an inactive
+// item the pass is skipped and nothing is touched.
+//
+// RenumberMoversByCell does the same for movers, so UpdateMovers and the
+// neighbour queries walk movers that share grid cells in memory order. Mover
+// indices are rewritten through moverRenumberMap in item reservations, jobs,
+// designations, blueprints, workshops, furniture, hunted animals, train
+// riders and station queues; per-mover state held by other modules (path
+// index, repath waits, idle list, scenery timers, dirt tracking) moves too.
+// Anything outside the sim that keeps a mover between frames holds a stable
+// handle instead (MoverHandleFromIndex / MoverIndexFromHandle in mover.h).
+//
+// Usage:
+//   itemRenumberInterval = 600;     // Tick() renumbers every 600 ticks (0 = never)
+//   if (RenumberItemsByCell()) {    // or run it by hand, e.g. after load
+//       int now = itemRenumberMap[oldIdx];  // -1 if oldIdx was not active
+//   }
+//   int handle = MoverHandleFromIndex(idx);  // survives RenumberMoversByCell
+
+#ifndef ITEM_RENUMBER_H
+#define ITEM_RENUMBER_H
+
+#include "items.h"
+#include "mover.h"
+#include <stdbool.h>
+
+extern int itemRenumberInterval;        // ticks between passes in Tick(), 0 = off
+extern int itemRenumberCount;           // passes applied
+extern int itemRenumberSkipped;         // passes skipped because a reference was stale
+extern int itemRenumberMap[MAX_ITEMS];  // old -> new index from the last applied pass, -1 = not active
+
+// Run one pass. Returns false (and changes nothing) if a stored item
+// reference points at an inactive or out-of-range item.
+bool RenumberItemsByCell(void);
+
+extern int moverRenumberInterval;         // ticks between passes in Tick(), 0 = off
+extern int moverRenumberCount;            // passes applied
+extern int moverRenumberSkipped;          // passes skipped because a reference was stale
+extern int moverRenumberMap[MAX_MOVERS];  // old -> new index from the last applied pass, -1 = not active
+
+// Run one mover pass. Returns false (and changes nothing) if a stored mover
+// reference points at an inactive or out-of-range mover.
+bool RenumberMoversByCell(void);
+
+#endif // ITEM_RENUMBER_H
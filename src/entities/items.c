@@ -2,25 +2,35 @@
 #include "item_defs.h"  // for ItemName
 #include "mover.h"  // for CELL_SIZE
 #include "../world/grid.h"   // for gridWidth, gridHeight, gridDepth
+#include "../world/cell_edits.h"  // for DeferCellEdit
 #include "../world/material.h"  // for MaterialType
 #include "../core/event_log.h"
 #include "../world/cell_defs.h"  // for IsCellWalkableAt
 #include "stockpiles.h"  // for MarkStockpileGroundItem
 #include "containers.h"  // for ContainerDef, GetContainerDef, GetOutermostContainer
+#include "item_ledger.h"
 #include "../simulation/temperature.h"  // for temperatureGrid
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
+float itemPosX[MAX_ITEMS];
+float itemPosY[MAX_ITEMS];
+float itemPosZ[MAX_ITEMS];
+uint8_t itemState[MAX_ITEMS];
+bool itemActive[MAX_ITEMS];
+int itemReservedBy[MAX_ITEMS];
+float itemUnreachableCooldown[MAX_ITEMS];
+int itemGridCell[MAX_ITEMS];
 Item items[MAX_ITEMS];
 int itemCount = 0;
 int itemHighWaterMark = 0;  // Highest index + 1 ever active
 
 void ClearItems(void) {
     for (int i = 0; i < itemHighWaterMark; i++) {  // Only clear up to high water mark
-        items[i].active = false;
-        items[i].reservedBy = -1;
-        items[i].unreachableCooldown = 0.0f;
+        itemActive[i] = false;
+        itemReservedBy[i] = -1;
+        itemUnreachableCooldown[i] = 0.0f;
         items[i].material = MAT_NONE;
         items[i].natural = false;
         items[i].stackCount = 1;
@@ -32,6 +42,7 @@ void ClearItems(void) {
     }
     itemCount = 0;
     itemHighWaterMark = 0;
+    ClearItemLedger();
     
     // Initialize spatial grid if grid dimensions are set
     if (gridWidth > 0 && gridHeight > 0 && gridDepth > 0) {
@@ -39,20 +50,63 @@ void ClearItems(void) {
     }
 }
 
+void PackItemRecord(int itemIdx, ItemRecord* out) {
+    const Item* item = &items[itemIdx];
+    memset(out, 0, sizeof(*out));  // padding bytes too, so saves are deterministic
+    out->x = itemPosX[itemIdx];
+    out->y = itemPosY[itemIdx];
+    out->z = itemPosZ[itemIdx];
+    out->type = item->type;
+    out->state = (ItemState)itemState[itemIdx];
+    out->material = item->material;
+    out->natural = item->natural;
+    out->active = itemActive[itemIdx];
+    out->reservedBy = itemReservedBy[itemIdx];
+    out->unreachableCooldown = itemUnreachableCooldown[itemIdx];
+    out->stackCount = item->stackCount;
+    out->containedIn = item->containedIn;
+    out->contentCount = item->contentCount;
+    out->contentTypeMask = item->contentTypeMask;
+    out->spoilageTimer = item->spoilageTimer;
+    out->condition = item->condition;
+    out->temperature = item->temperature;
+}
+
+void UnpackItemRecord(int itemIdx, const ItemRecord* in) {
+    Item* item = &items[itemIdx];
+    itemPosX[itemIdx] = in->x;
+    itemPosY[itemIdx] = in->y;
+    itemPosZ[itemIdx] = in->z;
+    item->type = in->type;
+    itemState[itemIdx] = (uint8_t)in->state;
+    item->material = in->material;
+    item->natural = in->natural;
+    itemActive[itemIdx] = in->active;
+    itemReservedBy[itemIdx] = in->reservedBy;
+    itemUnreachableCooldown[itemIdx] = in->unreachableCooldown;
+    item->stackCount = in->stackCount;
+    item->containedIn = in->containedIn;
+    item->contentCount = in->contentCount;
+    item->contentTypeMask = in->contentTypeMask;
+    item->spoilageTimer = in->spoilageTimer;
+    item->condition = in->condition;
+    item->temperature = in->temperature;
+}
+
 int SpawnItem(float x, float y, float z, ItemType type) {
     // Find first inactive slot
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (!items[i].active) {
-            items[i].x = x;
-            items[i].y = y;
-            items[i].z = z;
+        if (!itemActive[i]) {
+            itemPosX[i] = x;
+            itemPosY[i] = y;
+            itemPosZ[i] = z;
             items[i].type = type;
-            items[i].state = ITEM_ON_GROUND;
+            itemState[i] = ITEM_ON_GROUND;
             items[i].material = DefaultMaterialForItemType(type);
             items[i].natural = false;
-            items[i].active = true;
-            items[i].reservedBy = -1;
-            items[i].unreachableCooldown = 0.0f;
+            itemActive[i] = true;
+            itemReservedBy[i] = -1;
+            itemUnreachableCooldown[i] = 0.0f;
             items[i].stackCount = 1;
             items[i].containedIn = -1;
             items[i].contentCount = 0;
@@ -65,6 +119,7 @@ int SpawnItem(float x, float y, float z, ItemType type) {
             }
             // Update stockpile ground item cache
             MarkStockpileGroundItem(x, y, (int)z, i);
+            SyncItemLedger(i);
             return i;
         }
     }
@@ -75,6 +130,7 @@ int SpawnItemWithMaterial(float x, float y, float z, ItemType type, uint8_t mate
     int idx = SpawnItem(x, y, z, type);
     if (idx >= 0) {
         items[idx].material = material;
+        SyncItemLedger(idx);
     }
     return idx;
 }
@@ -90,9 +146,9 @@ uint8_t DefaultMaterialForItemType(ItemType type) {
 void SpillContainerContents(int containerIdx);
 
 void DeleteItem(int index) {
-    if (index >= 0 && index < MAX_ITEMS && items[index].active) {
+    if (index >= 0 && index < MAX_ITEMS && itemActive[index]) {
         EventLog("DeleteItem %d (%s) at (%.0f,%.0f,z%.0f) state=%d",
-                 index, ItemName(items[index].type), items[index].x, items[index].y, items[index].z, items[index].state);
+                 index, ItemName(items[index].type), itemPosX[index], itemPosY[index], itemPosZ[index], itemState[index]);
         // If this is a container with contents, spill them first
         if (items[index].contentCount > 0) {
             SpillContainerContents(index);
@@ -100,38 +156,51 @@ void DeleteItem(int index) {
         // If this item is inside a container, update parent's contentCount
         if (items[index].containedIn != -1) {
             int parentIdx = items[index].containedIn;
-            if (parentIdx >= 0 && parentIdx < MAX_ITEMS && items[parentIdx].active) {
+            if (parentIdx >= 0 && parentIdx < MAX_ITEMS && itemActive[parentIdx]) {
                 items[parentIdx].contentCount--;
             }
             items[index].containedIn = -1;
         }
-        if (items[index].state == ITEM_IN_STOCKPILE) {
-            RemoveItemFromStockpileSlot(items[index].x, items[index].y, (int)items[index].z);
+        if (itemState[index] == ITEM_IN_STOCKPILE) {
+            RemoveItemFromStockpileSlot(itemPosX[index], itemPosY[index], (int)itemPosZ[index]);
         }
-        items[index].active = false;
-        items[index].reservedBy = -1;
+        itemActive[index] = false;
+        itemReservedBy[index] = -1;
+        SyncItemLedger(index);
         itemCount--;
         // Shrink high water mark if we deleted the last item
         if (index == itemHighWaterMark - 1) {
-            while (itemHighWaterMark > 0 && !items[itemHighWaterMark - 1].active) {
+            while (itemHighWaterMark > 0 && !itemActive[itemHighWaterMark - 1]) {
                 itemHighWaterMark--;
             }
         }
     }
 }
 
+void SetItemState(int itemIdx, ItemState state) {
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS) return;
+    itemState[itemIdx] = state;
+    SyncItemLedger(itemIdx);
+}
+
+void SetItemStackCount(int itemIdx, int stackCount) {
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS) return;
+    items[itemIdx].stackCount = stackCount;
+    SyncItemLedger(itemIdx);
+}
+
 bool ReserveItem(int itemIndex, int moverIndex) {
     if (itemIndex < 0 || itemIndex >= MAX_ITEMS) return false;
-    if (!items[itemIndex].active) return false;
-    if (items[itemIndex].reservedBy != -1) return false;  // already reserved
+    if (!itemActive[itemIndex]) return false;
+    if (itemReservedBy[itemIndex] != -1) return false;  // already reserved
     
-    items[itemIndex].reservedBy = moverIndex;
+    itemReservedBy[itemIndex] = moverIndex;
     return true;
 }
 
 void ReleaseItemReservation(int itemIndex) {
     if (itemIndex >= 0 && itemIndex < MAX_ITEMS) {
-        items[itemIndex].reservedBy = -1;
+        itemReservedBy[itemIndex] = -1;
     }
 }
 
@@ -146,13 +215,13 @@ int FindNearestUnreservedItemNaive(float x, float y, float z) {
     float nearestDistSq = 1e30f;
     
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (!items[i].active) continue;
-        if (items[i].reservedBy != -1) continue;  // skip reserved
-        if (items[i].state != ITEM_ON_GROUND) continue;
+        if (!itemActive[i]) continue;
+        if (itemReservedBy[i] != -1) continue;  // skip reserved
+        if (itemState[i] != ITEM_ON_GROUND) continue;
         
-        float dx = items[i].x - x;
-        float dy = items[i].y - y;
-        float dz = items[i].z - z;
+        float dx = itemPosX[i] - x;
+        float dy = itemPosY[i] - y;
+        float dz = itemPosZ[i] - z;
         float distSq = dx*dx + dy*dy + dz*dz;
         
         if (distSq < nearestDistSq) {
@@ -175,10 +244,10 @@ static bool NearestUnreservedIterator(int itemIdx, float distSq, void* userData)
     (void)distSq;  // We recalculate with actual position for accuracy
     NearestUnreservedContext* ctx = (NearestUnreservedContext*)userData;
     
-    if (items[itemIdx].reservedBy != -1) return true;  // skip reserved, continue
+    if (itemReservedBy[itemIdx] != -1) return true;  // skip reserved, continue
     
-    float dx = items[itemIdx].x - ctx->searchX;
-    float dy = items[itemIdx].y - ctx->searchY;
+    float dx = itemPosX[itemIdx] - ctx->searchX;
+    float dy = itemPosY[itemIdx] - ctx->searchY;
     float d = dx * dx + dy * dy;
     
     if (d < ctx->nearestDistSq) {
@@ -234,113 +303,118 @@ int FindNearestUnreservedItem(float x, float y, float z) {
 // Naive O(MAX_ITEMS) implementation - iterates entire array
 void ItemsTickNaive(float dt) {
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (!items[i].active) continue;
-        if (items[i].unreachableCooldown > 0.0f) {
-            items[i].unreachableCooldown -= dt;
-            if (items[i].unreachableCooldown < 0.0f) {
-                items[i].unreachableCooldown = 0.0f;
+        if (!itemActive[i]) continue;
+        if (itemUnreachableCooldown[i] > 0.0f) {
+            itemUnreachableCooldown[i] -= dt;
+            if (itemUnreachableCooldown[i] < 0.0f) {
+                itemUnreachableCooldown[i] = 0.0f;
             }
         }
     }
 }
 
-// Advance spoilage timers and update item condition
-static void SpoilageTick(float dt) {
-    for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (!ItemSpoils(items[i].type)) continue;
-        if (items[i].condition == CONDITION_ROTTEN) continue;  // Already rotten, stop
-        float limit = ItemSpoilageLimit(items[i].type);
-        if (limit <= 0.0f) continue;
-        // Don't spoil carried items (prevents mid-job deletion)
-        if (items[i].state == ITEM_CARRIED) continue;
-
-        // Container modifier: walk to outermost container
-        float rate = dt;
-        if (items[i].containedIn != -1) {
-            int outermost = GetOutermostContainer(i);
-            // Skip items in a carried container
-            if (items[outermost].state == ITEM_CARRIED) continue;
-            const ContainerDef* cdef = GetContainerDef(items[outermost].type);
-            if (cdef) rate = dt * cdef->spoilageModifier;
-        }
-
-        items[i].spoilageTimer += rate;
-
-        // Update condition based on timer ratio
-        float ratio = items[i].spoilageTimer / limit;
-        if (ratio >= 1.0f) {
-            items[i].condition = CONDITION_ROTTEN;
-            EventLog("SPOILED item %d (%s x%d) at (%.0f,%.0f,z%.0f) after %.0fs → rotten",
-                     i, ItemName(items[i].type), items[i].stackCount,
-                     items[i].x, items[i].y, items[i].z, items[i].spoilageTimer);
-        } else if (ratio >= 0.5f) {
-            items[i].condition = CONDITION_STALE;
-        }
+// Advance spoilage timer and update condition for one item
+static void SpoilItem(int i, float dt) {
+    if (!ItemSpoils(items[i].type)) return;
+    if (items[i].condition == CONDITION_ROTTEN) return;  // Already rotten, stop
+    float limit = ItemSpoilageLimit(items[i].type);
+    if (limit <= 0.0f) return;
+    // Don't spoil carried items (prevents mid-job deletion)
+    if (itemState[i] == ITEM_CARRIED) return;
+
+    // Container modifier: walk to outermost container
+    float rate = dt;
+    if (items[i].containedIn != -1) {
+        int outermost = GetOutermostContainer(i);
+        // Skip items in a carried container
+        if (itemState[outermost] == ITEM_CARRIED) return;
+        const ContainerDef* cdef = GetContainerDef(items[outermost].type);
+        if (cdef) rate = dt * cdef->spoilageModifier;
+    }
+
+    items[i].spoilageTimer += rate;
+
+    // Update condition based on timer ratio
+    float ratio = items[i].spoilageTimer / limit;
+    if (ratio >= 1.0f) {
+        items[i].condition = CONDITION_ROTTEN;
+        EventLog("SPOILED item %d (%s x%d) at (%.0f,%.0f,z%.0f) after %.0fs → rotten",
+                 i, ItemName(items[i].type), items[i].stackCount,
+                 itemPosX[i], itemPosY[i], itemPosZ[i], items[i].spoilageTimer);
+    } else if (ratio >= 0.5f) {
+        items[i].condition = CONDITION_STALE;
     }
 }
 
-// Optimized - only iterates up to high water mark
 // Cool hot items toward ambient temperature (Newton's cooling)
 #define FOOD_COOLING_RATE 0.02f  // per second — ~35s to halve the difference
-static void TemperatureTick(float dt) {
-    for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].temperature <= 0.0f) continue;
-        int tx = (int)(items[i].x / CELL_SIZE);
-        int ty = (int)(items[i].y / CELL_SIZE);
-        int tz = (int)items[i].z;
-        float ambient = 20.0f;  // default room temp
-        if (tx >= 0 && tx < gridWidth && ty >= 0 && ty < gridHeight && tz >= 0 && tz < gridDepth) {
-            ambient = (float)temperatureGrid[tz][ty][tx].current;
-        }
-        items[i].temperature += (ambient - items[i].temperature) * FOOD_COOLING_RATE * dt;
-        if (fabsf(items[i].temperature - ambient) < 0.5f) {
-            items[i].temperature = 0.0f;  // close enough — stop tracking
-        }
+static void CoolItem(int i, float dt) {
+    int tx = (int)(itemPosX[i] / CELL_SIZE);
+    int ty = (int)(itemPosY[i] / CELL_SIZE);
+    int tz = (int)itemPosZ[i];
+    float ambient = 20.0f;  // default room temp
+    if (tx >= 0 && tx < gridWidth && ty >= 0 && ty < gridHeight && tz >= 0 && tz < gridDepth) {
+        ambient = (float)temperatureGrid[tz][ty][tx].current;
+    }
+    items[i].temperature += (ambient - items[i].temperature) * FOOD_COOLING_RATE * dt;
+    if (fabsf(items[i].temperature - ambient) < 0.5f) {
+        items[i].temperature = 0.0f;  // close enough — stop tracking
     }
 }
 
+// Optimized - only iterates up to high water mark, and makes a single pass:
+// the cooldown reads only the hot arrays, spoilage and cooling the item's cold
+// struct (the updates are independent per item; spoilage only reads container
+// state)
 void ItemsTick(float dt) {
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].unreachableCooldown > 0.0f) {
-            items[i].unreachableCooldown -= dt;
-            if (items[i].unreachableCooldown < 0.0f) {
-                items[i].unreachableCooldown = 0.0f;
-            }
+        if (!itemActive[i]) continue;
+        if (itemUnreachableCooldown[i] > 0.0f) {
+            float cooldown = itemUnreachableCooldown[i] - dt;
+            itemUnreachableCooldown[i] = cooldown > 0.0f ? cooldown : 0.0f;
         }
+        SpoilItem(i, dt);
+        if (items[i].temperature > 0.0f) CoolItem(i, dt);
     }
-    SpoilageTick(dt);
-    TemperatureTick(dt);
 }
 
 void SetItemUnreachableCooldown(int itemIndex, float cooldown) {
-    if (itemIndex >= 0 && itemIndex < MAX_ITEMS && items[itemIndex].active) {
-        items[itemIndex].unreachableCooldown = cooldown;
+    if (itemIndex >= 0 && itemIndex < MAX_ITEMS && itemActive[itemIndex]) {
+        itemUnreachableCooldown[itemIndex] = cooldown;
         EventLog("Item %d (%s) marked unreachable for %.1fs at (%d,%d,z%d)",
                  itemIndex, ItemName(items[itemIndex].type), cooldown,
-                 (int)(items[itemIndex].x / CELL_SIZE), (int)(items[itemIndex].y / CELL_SIZE), (int)items[itemIndex].z);
+                 (int)(itemPosX[itemIndex] / CELL_SIZE), (int)(itemPosY[itemIndex] / CELL_SIZE), (int)itemPosZ[itemIndex]);
     }
 }
 
 void ClearUnreachableCooldownsNearCell(int x, int y, int z, int radius) {
     // Clear unreachable cooldowns for items near a cell where terrain changed
     // This allows immediate re-evaluation of item reachability after mining/building
+    if (radius == CELL_EDIT_COOLDOWN_RADIUS && DeferCellEdit(x, y, z, CELL_EDIT_COOLDOWN)) return;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].unreachableCooldown <= 0.0f) continue;
+        if (!itemActive[i]) continue;
+        if (itemUnreachableCooldown[i] <= 0.0f) continue;
         
-        int itemX = (int)(items[i].x / CELL_SIZE);
-        int itemY = (int)(items[i].y / CELL_SIZE);
-        int itemZ = (int)items[i].z;
+        int itemX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemY = (int)(itemPosY[i] / CELL_SIZE);
+        int itemZ = (int)itemPosZ[i];
         
         int dx = itemX - x;
         int dy = itemY - y;
         int dz = itemZ - z;
         
         if (dx*dx + dy*dy + dz*dz <= radius*radius) {
-            items[i].unreachableCooldown = 0.0f;
+            itemUnreachableCooldown[i] = 0.0f;
+        }
+    }
+}
+
+void ClearUnreachableCooldownsWhere(bool (*isNear)(int x, int y, int z)) {
+    for (int i = 0; i < itemHighWaterMark; i++) {
+        if (!itemActive[i]) continue;
+        if (itemUnreachableCooldown[i] <= 0.0f) continue;
+        if (isNear((int)(itemPosX[i] / CELL_SIZE), (int)(itemPosY[i] / CELL_SIZE), (int)itemPosZ[i])) {
+            itemUnreachableCooldown[i] = 0.0f;
         }
     }
 }
@@ -360,12 +434,12 @@ int FindGroundItemAtTile(int tileX, int tileY, int z) {
     
     // Fallback to O(n) scan if grid not built yet or was built when empty
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
-        if ((int)items[i].z != z) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_ON_GROUND) continue;
+        if ((int)itemPosZ[i] != z) continue;
         
-        int itemTileX = (int)(items[i].x / CELL_SIZE);
-        int itemTileY = (int)(items[i].y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
         
         if (itemTileX == tileX && itemTileY == tileY) {
             return i;
@@ -375,19 +449,18 @@ int FindGroundItemAtTile(int tileX, int tileY, int z) {
 }
 
 void SafeDropItem(int itemIdx, float x, float y, int z) {
-    if (itemIdx < 0 || !items[itemIdx].active) return;
+    if (itemIdx < 0 || !itemActive[itemIdx]) return;
 
-    Item* item = &items[itemIdx];
-    item->state = ITEM_ON_GROUND;
-    item->reservedBy = -1;
+    SetItemState(itemIdx, ITEM_ON_GROUND);
+    itemReservedBy[itemIdx] = -1;
 
     int cellX = (int)(x / CELL_SIZE);
     int cellY = (int)(y / CELL_SIZE);
 
     if (IsCellWalkableAt(z, cellY, cellX)) {
-        item->x = x;
-        item->y = y;
-        item->z = (float)z;
+        itemPosX[itemIdx] = x;
+        itemPosY[itemIdx] = y;
+        itemPosZ[itemIdx] = (float)z;
     } else {
         int dx[] = {0, 0, -1, 1, -1, 1, -1, 1};
         int dy[] = {-1, 1, 0, 0, -1, -1, 1, 1};
@@ -396,17 +469,17 @@ void SafeDropItem(int itemIdx, float x, float y, int z) {
             int nx = cellX + dx[d];
             int ny = cellY + dy[d];
             if (IsCellWalkableAt(z, ny, nx)) {
-                item->x = nx * CELL_SIZE + CELL_SIZE / 2.0f;
-                item->y = ny * CELL_SIZE + CELL_SIZE / 2.0f;
-                item->z = (float)z;
+                itemPosX[itemIdx] = nx * CELL_SIZE + CELL_SIZE / 2.0f;
+                itemPosY[itemIdx] = ny * CELL_SIZE + CELL_SIZE / 2.0f;
+                itemPosZ[itemIdx] = (float)z;
                 found = true;
                 break;
             }
         }
         if (!found) {
-            item->x = x;
-            item->y = y;
-            item->z = (float)z;
+            itemPosX[itemIdx] = x;
+            itemPosY[itemIdx] = y;
+            itemPosZ[itemIdx] = (float)z;
         }
     }
 }
@@ -430,21 +503,21 @@ void PushItemsOutOfCell(int x, int y, int z) {
     
     // Move all items at this cell to the target neighbor
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if ((int)items[i].z != z) continue;
+        if (!itemActive[i]) continue;
+        if ((int)itemPosZ[i] != z) continue;
         
-        int itemTileX = (int)(items[i].x / CELL_SIZE);
-        int itemTileY = (int)(items[i].y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
         
         if (itemTileX == x && itemTileY == y) {
-            if (items[i].state == ITEM_IN_STOCKPILE) {
-                RemoveItemFromStockpileSlot(items[i].x, items[i].y, (int)items[i].z);
-                items[i].state = ITEM_ON_GROUND;
+            if (itemState[i] == ITEM_IN_STOCKPILE) {
+                RemoveItemFromStockpileSlot(itemPosX[i], itemPosY[i], (int)itemPosZ[i]);
+                SetItemState(i, ITEM_ON_GROUND);
             }
             if (targetX >= 0) {
                 // Move to walkable neighbor
-                items[i].x = targetX * CELL_SIZE + CELL_SIZE * 0.5f;
-                items[i].y = targetY * CELL_SIZE + CELL_SIZE * 0.5f;
+                itemPosX[i] = targetX * CELL_SIZE + CELL_SIZE * 0.5f;
+                itemPosY[i] = targetY * CELL_SIZE + CELL_SIZE * 0.5f;
             }
             // If no walkable neighbor, item stays (will be trapped in wall)
             // This is an edge case - fully surrounded cells shouldn't have blueprints
@@ -466,19 +539,19 @@ void DropItemsInCell(int x, int y, int z) {
     
     // Move all items at this cell down to the target z-level
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if ((int)items[i].z != z) continue;
+        if (!itemActive[i]) continue;
+        if ((int)itemPosZ[i] != z) continue;
         
-        int itemTileX = (int)(items[i].x / CELL_SIZE);
-        int itemTileY = (int)(items[i].y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
         
         if (itemTileX == x && itemTileY == y) {
             // Clear stockpile slot before changing position
-            if (items[i].state == ITEM_IN_STOCKPILE) {
-                RemoveItemFromStockpileSlot(items[i].x, items[i].y, (int)items[i].z);
-                items[i].state = ITEM_ON_GROUND;
+            if (itemState[i] == ITEM_IN_STOCKPILE) {
+                RemoveItemFromStockpileSlot(itemPosX[i], itemPosY[i], (int)itemPosZ[i]);
+                SetItemState(i, ITEM_ON_GROUND);
             }
-            items[i].z = (float)targetZ;
+            itemPosZ[i] = (float)targetZ;
         }
     }
 }
@@ -512,12 +585,11 @@ static int IterateItemsInRadius(int tileX, int tileY, int z, int radiusTiles,
                 
                 for (int t = start; t < end; t++) {
                     int itemIdx = itemGrid.itemIndices[t];
-                    Item* item = &items[itemIdx];
                     
-                    if (!item->active || item->state != ITEM_ON_GROUND) continue;
+                    if (!itemActive[itemIdx] || itemState[itemIdx] != ITEM_ON_GROUND) continue;
                     
-                    int itemTileX = (int)(item->x / CELL_SIZE);
-                    int itemTileY = (int)(item->y / CELL_SIZE);
+                    int itemTileX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+                    int itemTileY = (int)(itemPosY[itemIdx] / CELL_SIZE);
                     float dx = (float)(itemTileX - tileX);
                     float dy = (float)(itemTileY - tileY);
                     float distSq = dx * dx + dy * dy;
@@ -625,12 +697,12 @@ void BuildItemSpatialGridNaive(void) {
     
     // Phase 2: Count ground items per cell
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_ON_GROUND) continue;
         
-        int tx = (int)(items[i].x / CELL_SIZE);
-        int ty = (int)(items[i].y / CELL_SIZE);
-        int tz = (int)items[i].z;
+        int tx = (int)(itemPosX[i] / CELL_SIZE);
+        int ty = (int)(itemPosY[i] / CELL_SIZE);
+        int tz = (int)itemPosZ[i];
         
         tx = clampi_item(tx, 0, itemGrid.gridW - 1);
         ty = clampi_item(ty, 0, itemGrid.gridH - 1);
@@ -654,12 +726,12 @@ void BuildItemSpatialGridNaive(void) {
     
     // Phase 5: Scatter item indices into cells
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_ON_GROUND) continue;
         
-        int tx = (int)(items[i].x / CELL_SIZE);
-        int ty = (int)(items[i].y / CELL_SIZE);
-        int tz = (int)items[i].z;
+        int tx = (int)(itemPosX[i] / CELL_SIZE);
+        int ty = (int)(itemPosY[i] / CELL_SIZE);
+        int tz = (int)itemPosZ[i];
         
         tx = clampi_item(tx, 0, itemGrid.gridW - 1);
         ty = clampi_item(ty, 0, itemGrid.gridH - 1);
@@ -678,20 +750,24 @@ void BuildItemSpatialGrid(void) {
     memset(itemGrid.cellCounts, 0, itemGrid.cellCount * sizeof(int));
     itemGrid.groundItemCount = 0;
     
-    // Phase 2: Count ground items per cell (optimized range)
+    // Phase 2: Count ground items per cell (optimized range). Reads only the
+    // hot arrays; the cell of each item is kept in itemGridCell for phase 4.
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
+        if (!itemActive[i] || itemState[i] != ITEM_ON_GROUND) {
+            itemGridCell[i] = -1;
+            continue;
+        }
         
-        int tx = (int)(items[i].x / CELL_SIZE);
-        int ty = (int)(items[i].y / CELL_SIZE);
-        int tz = (int)items[i].z;
+        int tx = (int)(itemPosX[i] / CELL_SIZE);
+        int ty = (int)(itemPosY[i] / CELL_SIZE);
+        int tz = (int)itemPosZ[i];
         
         tx = clampi_item(tx, 0, itemGrid.gridW - 1);
         ty = clampi_item(ty, 0, itemGrid.gridH - 1);
         tz = clampi_item(tz, 0, itemGrid.gridD - 1);
         
         int cellIdx = tz * (itemGrid.gridW * itemGrid.gridH) + ty * itemGrid.gridW + tx;
+        itemGridCell[i] = cellIdx;
         itemGrid.cellCounts[cellIdx]++;
         itemGrid.groundItemCount++;
     }
@@ -702,25 +778,13 @@ void BuildItemSpatialGrid(void) {
         itemGrid.cellStarts[c + 1] = itemGrid.cellStarts[c] + itemGrid.cellCounts[c];
     }
     
-    // Phase 4: Reset counts to use as write cursors
-    for (int c = 0; c < itemGrid.cellCount; c++) {
-        itemGrid.cellCounts[c] = itemGrid.cellStarts[c];
-    }
+    // Reset counts to use as write cursors
+    memcpy(itemGrid.cellCounts, itemGrid.cellStarts, itemGrid.cellCount * sizeof(int));
     
-    // Phase 5: Scatter item indices into cells (optimized range)
+    // Phase 4: Scatter item indices into cells
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
-        
-        int tx = (int)(items[i].x / CELL_SIZE);
-        int ty = (int)(items[i].y / CELL_SIZE);
-        int tz = (int)items[i].z;
-        
-        tx = clampi_item(tx, 0, itemGrid.gridW - 1);
-        ty = clampi_item(ty, 0, itemGrid.gridH - 1);
-        tz = clampi_item(tz, 0, itemGrid.gridD - 1);
-        
-        int cellIdx = tz * (itemGrid.gridW * itemGrid.gridH) + ty * itemGrid.gridW + tx;
+        int cellIdx = itemGridCell[i];
+        if (cellIdx < 0) continue;
         itemGrid.itemIndices[itemGrid.cellCounts[cellIdx]++] = i;
     }
 }
@@ -739,7 +803,7 @@ int QueryItemAtTile(int tileX, int tileY, int z) {
     for (int t = start; t < end; t++) {
         int itemIdx = itemGrid.itemIndices[t];
         // Double-check the item is still valid (handles edge cases during same frame)
-        if (items[itemIdx].active && items[itemIdx].state == ITEM_ON_GROUND) {
+        if (itemActive[itemIdx] && itemState[itemIdx] == ITEM_ON_GROUND) {
             return itemIdx;
         }
     }
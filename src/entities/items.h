@@ -99,16 +99,27 @@ typedef enum {
     CONDITION_ROTTEN       // Timer >= 100% of limit
 } ItemCondition;
 
-// Item struct
+#define MAX_ITEMS 25000
+
+// Item data is split by how often the sim touches it. The hot fields that
+// every per-tick scan reads (active, position, state, reservation, cooldown,
+// grid cell) live in parallel arrays indexed by item, so a scan streams only
+// the bytes it tests. Item holds the cold rest, read once a candidate is
+// picked. Both sides share the item index.
+extern float itemPosX[MAX_ITEMS];
+extern float itemPosY[MAX_ITEMS];
+extern float itemPosZ[MAX_ITEMS];
+extern uint8_t itemState[MAX_ITEMS];               // ItemState
+extern bool itemActive[MAX_ITEMS];
+extern int itemReservedBy[MAX_ITEMS];              // mover index, -1 = none
+extern float itemUnreachableCooldown[MAX_ITEMS];   // seconds until retry (0 = can try now)
+extern int itemGridCell[MAX_ITEMS];                // item grid cell at the last build, -1 if not on the ground
+
+// Item struct (cold fields)
 typedef struct {
-    float x, y, z;
     ItemType type;
-    ItemState state;
     uint8_t material;        // MaterialType (stored as u8 to avoid header cycle)
     bool natural;            // True if item is unprocessed/natural
-    bool active;
-    int reservedBy;           // mover index, -1 = none
-    float unreachableCooldown; // seconds until retry (0 = can try now)
     int stackCount;           // how many units this item represents (default 1)
     int containedIn;          // item index of container (-1 = not contained)
     int contentCount;         // items directly inside this container (0 if not container)
@@ -118,7 +129,26 @@ typedef struct {
     float temperature;        // Celsius (0.0 = not tracked, >0 = hot food cooling down)
 } Item;
 
-#define MAX_ITEMS 25000
+// One item as saves store it (v92+): hot and cold fields in one record, in
+// the layout saves have always used. Save/load and the inspector go through
+// PackItemRecord/UnpackItemRecord.
+typedef struct {
+    float x, y, z;
+    ItemType type;
+    ItemState state;
+    uint8_t material;
+    bool natural;
+    bool active;
+    int reservedBy;
+    float unreachableCooldown;
+    int stackCount;
+    int containedIn;
+    int contentCount;
+    uint32_t contentTypeMask;
+    float spoilageTimer;
+    uint8_t condition;
+    float temperature;
+} ItemRecord;
 
 extern Item items[MAX_ITEMS];
 extern int itemCount;
@@ -126,11 +156,17 @@ extern int itemHighWaterMark;  // Highest index + 1 that has ever been active (f
 
 // Core functions
 void ClearItems(void);
+void PackItemRecord(int itemIdx, ItemRecord* out);
+void UnpackItemRecord(int itemIdx, const ItemRecord* in);
 int SpawnItem(float x, float y, float z, ItemType type);
 int SpawnItemWithMaterial(float x, float y, float z, ItemType type, uint8_t material);
 uint8_t DefaultMaterialForItemType(ItemType type);
 void DeleteItem(int index);
 
+// State and stack changes go through these so the item ledger stays current
+void SetItemState(int itemIdx, ItemState state);
+void SetItemStackCount(int itemIdx, int stackCount);
+
 // Reservation
 bool ReserveItem(int itemIndex, int moverIndex);
 void ReleaseItemReservation(int itemIndex);
@@ -144,6 +180,7 @@ void ItemsTick(float dt);              // Optimized - iterates to itemHighWaterM
 void ItemsTickNaive(float dt);         // O(MAX_ITEMS) brute force
 void SetItemUnreachableCooldown(int itemIndex, float cooldown);
 void ClearUnreachableCooldownsNearCell(int x, int y, int z, int radius); // Clear cooldowns when terrain changes
+void ClearUnreachableCooldownsWhere(bool (*isNear)(int x, int y, int z)); // isNear gets the item's cell
 
 // Ground item queries for stockpile blocking
 // Returns the index of a ground item at the given tile, or -1 if none
@@ -196,12 +233,12 @@ int FindFirstItemInRadius(int tileX, int tileY, int z, int radiusTiles,
                           ItemFilterFunc filter, void* userData);
 
 // Item getters (inline for zero overhead)
-static inline bool IsItemActive(int itemIdx) { return items[itemIdx].active; }
-static inline float GetItemX(int itemIdx) { return items[itemIdx].x; }
-static inline float GetItemY(int itemIdx) { return items[itemIdx].y; }
-static inline int GetItemZ(int itemIdx) { return (int)items[itemIdx].z; }
+static inline bool IsItemActive(int itemIdx) { return itemActive[itemIdx]; }
+static inline float GetItemX(int itemIdx) { return itemPosX[itemIdx]; }
+static inline float GetItemY(int itemIdx) { return itemPosY[itemIdx]; }
+static inline int GetItemZ(int itemIdx) { return (int)itemPosZ[itemIdx]; }
 static inline ItemType GetItemType(int itemIdx) { return items[itemIdx].type; }
-static inline int GetItemReservedBy(int itemIdx) { return items[itemIdx].reservedBy; }
+static inline int GetItemReservedBy(int itemIdx) { return itemReservedBy[itemIdx]; }
 static inline int GetItemStackCount(int itemIdx) { return items[itemIdx].stackCount; }
 
 static inline bool IsItemRotten(int itemIdx) {
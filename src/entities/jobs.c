@@ -9,6 +9,8 @@
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
 #include "../world/pathfinding.h"
+#include "../world/reach_cache.h"
+#include "../world/cell_edits.h"
 #include "stockpiles.h"
 #include "../world/designations.h"
 #include "../simulation/trees.h"
@@ -21,6 +23,7 @@
 #include "butchering.h"
 #include "tool_quality.h"
 #include "../simulation/farming.h"
+#include "../core/sim_rng.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -49,22 +52,24 @@ static const int DIR_DY[4] = {-1, 0, 1, 0};
 
 // Helper: Check if mover's path is exhausted (no path or index exhausted)
 static inline bool IsPathExhausted(Mover* mover) {
-    return mover->pathLength == 0 || mover->pathIndex < 0;
+    int moverIdx = (int)(mover - movers);
+    return moverPathLength[moverIdx] == 0 || moverPathIndex[moverIdx] < 0;
 }
 
 // Helper: Final approach - move mover directly toward target when path exhausted but close
 // Returns true if micro-movement was applied
 static bool TryFinalApproach(Mover* mover, float targetX, float targetY, int targetCellX, int targetCellY, float radius) {
+    int moverIdx = (int)(mover - movers);
     if (!IsPathExhausted(mover)) return false;
     
-    float dx = mover->x - targetX;
-    float dy = mover->y - targetY;
+    float dx = moverPosX[moverIdx] - targetX;
+    float dy = moverPosY[moverIdx] - targetY;
     float distSq = dx * dx + dy * dy;
     
     if (distSq < radius * radius) return false;  // Already in range
     
-    int moverCellX = (int)(mover->x / CELL_SIZE);
-    int moverCellY = (int)(mover->y / CELL_SIZE);
+    int moverCellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int moverCellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
     bool inSameOrAdjacentCell = (abs(moverCellX - targetCellX) <= 1 && abs(moverCellY - targetCellY) <= 1);
     
     if (!inSameOrAdjacentCell) return false;
@@ -73,8 +78,8 @@ static bool TryFinalApproach(Mover* mover, float targetX, float targetY, int tar
     float dist = sqrtf(distSq);
     float moveSpeed = mover->speed * TICK_DT;
     if (dist > 0.01f) {
-        mover->x -= (dx / dist) * moveSpeed;
-        mover->y -= (dy / dist) * moveSpeed;
+        moverPosX[moverIdx] -= (dx / dist) * moveSpeed;
+        moverPosY[moverIdx] -= (dy / dist) * moveSpeed;
     }
     return true;
 }
@@ -291,6 +296,10 @@ static void RebuildAdjacentDesignationCache(DesignationType type,
     for (int z = 0; z < gridDepth && *count < MAX_DESIGNATION_CACHE; z++) {
         for (int y = 0; y < gridHeight && *count < MAX_DESIGNATION_CACHE; y++) {
             for (int x = 0; x < gridWidth && *count < MAX_DESIGNATION_CACHE; x++) {
+                if (!PagedLayerHasPage(&designationLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) {
+                    x |= PAGE_MASK;  // no designations on this page
+                    continue;
+                }
                 Designation* d = GetDesignation(x, y, z);
                 if (!d || d->type != type) continue;
                 if (d->assignedMover != -1) continue;
@@ -317,6 +326,10 @@ static void RebuildOnTileDesignationCache(DesignationType type,
     for (int z = 0; z < gridDepth && *count < MAX_DESIGNATION_CACHE; z++) {
         for (int y = 0; y < gridHeight && *count < MAX_DESIGNATION_CACHE; y++) {
             for (int x = 0; x < gridWidth && *count < MAX_DESIGNATION_CACHE; x++) {
+                if (!PagedLayerHasPage(&designationLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) {
+                    x |= PAGE_MASK;  // no designations on this page
+                    continue;
+                }
                 Designation* d = GetDesignation(x, y, z);
                 if (!d || d->type != type) continue;
                 if (d->assignedMover != -1) continue;
@@ -439,6 +452,7 @@ static void RebuildTillDesignationCache(void) {
 
 // Invalidate designation caches - call when designations are added/removed/completed
 void InvalidateDesignationCache(DesignationType type) {
+    if (RecordDesignationCacheEdit((int)type)) return;
     for (int i = 0; i < (int)(sizeof(designationSpecs) / sizeof(designationSpecs[0])); i++) {
         if (designationSpecs[i].desigType == type) {
             *designationSpecs[i].cacheDirty = true;
@@ -460,7 +474,7 @@ static bool FindReachableAdjacentTile(int targetX, int targetY, int targetZ,
 
         Point adjCell = { ax, ay, targetZ };
         PROFILE_COUNT(pathfinds, 1);
-        if (FindPath(moverPathAlgorithm, moverCell, adjCell, tempPath, MAX_PATH) > 0) {
+        if (ProbePathLength(moverPathAlgorithm, moverCell, adjCell, tempPath, MAX_PATH) > 0) {
             *outX = ax;
             *outY = ay;
             return true;
@@ -657,7 +671,7 @@ Job* GetJob(int jobId) {
 // =============================================================================
 
 // Forward declaration for helper function used by drivers
-static void ClearSourceStockpileSlot(Item* item);
+static void ClearSourceStockpileSlot(int itemIdx);
 static void ExtractItemFromContainer(int itemIdx);
 
 // =============================================================================
@@ -669,25 +683,25 @@ static void ExtractItemFromContainer(int itemIdx);
 // sets mover->equippedTool, clears job->toolItem, advances to nextStep.
 static JobRunResult RunToolFetchStep(Job* job, Mover* mover, int moverIdx, int nextStep) {
     int toolIdx = job->toolItem;
-    if (toolIdx < 0 || !items[toolIdx].active) return JOBRUN_FAIL;
-    if (items[toolIdx].reservedBy != moverIdx) return JOBRUN_FAIL;
+    if (toolIdx < 0 || !itemActive[toolIdx]) return JOBRUN_FAIL;
+    if (itemReservedBy[toolIdx] != moverIdx) return JOBRUN_FAIL;
 
     Item* tool = &items[toolIdx];
-    int toolCellX = (int)(tool->x / CELL_SIZE);
-    int toolCellY = (int)(tool->y / CELL_SIZE);
-    int toolCellZ = (int)(tool->z);
+    int toolCellX = (int)(itemPosX[toolIdx] / CELL_SIZE);
+    int toolCellY = (int)(itemPosY[toolIdx] / CELL_SIZE);
+    int toolCellZ = (int)(itemPosZ[toolIdx]);
 
     // Set goal to tool position
     if (mover->goal.x != toolCellX || mover->goal.y != toolCellY || mover->goal.z != toolCellZ) {
         mover->goal = (Point){toolCellX, toolCellY, toolCellZ};
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
-    float dx = mover->x - tool->x;
-    float dy = mover->y - tool->y;
+    float dx = moverPosX[moverIdx] - itemPosX[toolIdx];
+    float dy = moverPosY[moverIdx] - itemPosY[toolIdx];
     float distSq = dx * dx + dy * dy;
 
-    TryFinalApproach(mover, tool->x, tool->y, toolCellX, toolCellY, PICKUP_RADIUS);
+    TryFinalApproach(mover, itemPosX[toolIdx], itemPosY[toolIdx], toolCellX, toolCellY, PICKUP_RADIUS);
 
     if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
         SetItemUnreachableCooldown(toolIdx, UNREACHABLE_COOLDOWN);
@@ -701,23 +715,23 @@ static JobRunResult RunToolFetchStep(Job* job, Mover* mover, int moverIdx, int n
         }
 
         // Clear stockpile slot if tool was in stockpile
-        if (tool->state == ITEM_IN_STOCKPILE) {
-            ClearSourceStockpileSlot(tool);
+        if (itemState[toolIdx] == ITEM_IN_STOCKPILE) {
+            ClearSourceStockpileSlot(toolIdx);
         }
 
         // Equip the tool
-        tool->state = ITEM_CARRIED;
-        tool->reservedBy = moverIdx;
-        tool->x = mover->x;
-        tool->y = mover->y;
-        tool->z = mover->z;
+        SetItemState(toolIdx, ITEM_CARRIED);
+        itemReservedBy[toolIdx] = moverIdx;
+        itemPosX[toolIdx] = moverPosX[moverIdx];
+        itemPosY[toolIdx] = moverPosY[moverIdx];
+        itemPosZ[toolIdx] = moverPosZ[moverIdx];
         mover->equippedTool = toolIdx;
 
         job->toolItem = -1;  // No longer tracking — it's equipped now
         job->step = nextStep;
 
         // Set goal for the actual job (mover->goal will be set by the next step's logic)
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
 
         EventLog("Mover %d equipped tool item %d (%s)", moverIdx, toolIdx,
                  itemDefs[tool->type].name);
@@ -730,29 +744,30 @@ static JobRunResult RunToolFetchStep(Job* job, Mover* mover, int moverIdx, int n
 // Returns JOBRUN_RUNNING while walking, JOBRUN_FAIL on error.
 // On successful pickup: sets step=STEP_CARRYING, mover->goal=nextGoal, returns JOBRUN_RUNNING.
 static JobRunResult RunPickupStep(Job* job, Mover* mover, Point nextGoal) {
+    int moverIdx = (int)(mover - movers);
     int itemIdx = job->targetItem;
-    if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+    if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
 
     Item* item = &items[itemIdx];
-    int itemCellX = (int)(item->x / CELL_SIZE);
-    int itemCellY = (int)(item->y / CELL_SIZE);
-    int itemCellZ = (int)(item->z);
+    int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+    int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+    int itemCellZ = (int)(itemPosZ[itemIdx]);
 
     if (!IsCellWalkableAt(itemCellZ, itemCellY, itemCellX)) {
         SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
         return JOBRUN_FAIL;
     }
 
-    float dx = mover->x - item->x;
-    float dy = mover->y - item->y;
+    float dx = moverPosX[moverIdx] - itemPosX[itemIdx];
+    float dy = moverPosY[moverIdx] - itemPosY[itemIdx];
     float distSq = dx * dx + dy * dy;
 
     if (IsPathExhausted(mover) && distSq >= PICKUP_RADIUS * PICKUP_RADIUS) {
         mover->goal = (Point){itemCellX, itemCellY, itemCellZ};
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
-    TryFinalApproach(mover, item->x, item->y, itemCellX, itemCellY, PICKUP_RADIUS);
+    TryFinalApproach(mover, itemPosX[itemIdx], itemPosY[itemIdx], itemCellX, itemCellY, PICKUP_RADIUS);
 
     if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
         SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
@@ -760,10 +775,10 @@ static JobRunResult RunPickupStep(Job* job, Mover* mover, Point nextGoal) {
     }
 
     if (distSq < PICKUP_RADIUS * PICKUP_RADIUS) {
-        if (item->state == ITEM_IN_STOCKPILE) {
-            ClearSourceStockpileSlot(item);
+        if (itemState[itemIdx] == ITEM_IN_STOCKPILE) {
+            ClearSourceStockpileSlot(itemIdx);
         }
-        item->state = ITEM_CARRIED;
+        SetItemState(itemIdx, ITEM_CARRIED);
         EventLog("Item %d (%s x%d) picked up by mover %d for job %d",
                  itemIdx, ItemName(item->type), item->stackCount,
                  (int)(mover - movers), (int)(job - jobs));
@@ -774,7 +789,6 @@ static JobRunResult RunPickupStep(Job* job, Mover* mover, Point nextGoal) {
         // Clear transport state on pickup — the pickup-leg transport is done,
         // ShouldUseTrain will re-evaluate for the delivery leg with the correct goal
         if (mover->transportState != TRANSPORT_NONE) {
-            int moverIdx = (int)(mover - movers);
             EventLog("Mover %d pickup clears stale transport (was %d, station=%d)",
                      moverIdx, mover->transportState, mover->transportStation);
             if (mover->transportState == TRANSPORT_WAITING && mover->transportStation >= 0) {
@@ -787,7 +801,7 @@ static JobRunResult RunPickupStep(Job* job, Mover* mover, Point nextGoal) {
         }
 
         mover->goal = nextGoal;
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
     return JOBRUN_RUNNING;
@@ -796,31 +810,32 @@ static JobRunResult RunPickupStep(Job* job, Mover* mover, Point nextGoal) {
 // Carry item toward destination, updating item position.
 // Returns JOBRUN_RUNNING while walking, JOBRUN_FAIL on error, JOBRUN_DONE on arrival.
 static JobRunResult RunCarryStep(Job* job, Mover* mover, int destX, int destY, int destZ) {
+    int moverIdx = (int)(mover - movers);
     int itemIdx = job->carryingItem;
-    if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+    if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
 
     // Transport: mover is en route via train — don't override goal or detect stuck
     if (mover->transportState != TRANSPORT_NONE) {
         // Still update carried item position
-        items[itemIdx].x = mover->x;
-        items[itemIdx].y = mover->y;
-        items[itemIdx].z = mover->z;
-        if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, mover->x, mover->y, mover->z);
+        itemPosX[itemIdx] = moverPosX[moverIdx];
+        itemPosY[itemIdx] = moverPosY[moverIdx];
+        itemPosZ[itemIdx] = moverPosZ[moverIdx];
+        if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx]);
         return JOBRUN_RUNNING;
     }
 
     float targetX = destX * CELL_SIZE + CELL_SIZE * 0.5f;
     float targetY = destY * CELL_SIZE + CELL_SIZE * 0.5f;
-    float dx = mover->x - targetX;
-    float dy = mover->y - targetY;
+    float dx = moverPosX[moverIdx] - targetX;
+    float dy = moverPosY[moverIdx] - targetY;
     float distSq = dx * dx + dy * dy;
 
     if (IsPathExhausted(mover) && distSq >= DROP_RADIUS * DROP_RADIUS) {
         mover->goal = (Point){destX, destY, destZ};
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
-    bool correctZ = (int)mover->z == destZ;
+    bool correctZ = (int)moverPosZ[moverIdx] == destZ;
     if (correctZ) TryFinalApproach(mover, targetX, targetY, destX, destY, DROP_RADIUS);
 
     if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
@@ -828,10 +843,10 @@ static JobRunResult RunCarryStep(Job* job, Mover* mover, int destX, int destY, i
     }
 
     // Update carried item position (including container contents)
-    items[itemIdx].x = mover->x;
-    items[itemIdx].y = mover->y;
-    items[itemIdx].z = mover->z;
-    if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, mover->x, mover->y, mover->z);
+    itemPosX[itemIdx] = moverPosX[moverIdx];
+    itemPosY[itemIdx] = moverPosY[moverIdx];
+    itemPosZ[itemIdx] = moverPosZ[moverIdx];
+    if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx]);
 
     if (correctZ && distSq < DROP_RADIUS * DROP_RADIUS) {
         return JOBRUN_DONE;
@@ -844,22 +859,23 @@ static JobRunResult RunCarryStep(Job* job, Mover* mover, int destX, int destY, i
 // Returns JOBRUN_RUNNING while walking, JOBRUN_FAIL if stuck.
 // On arrival: sets step=STEP_WORKING, returns JOBRUN_RUNNING.
 static JobRunResult RunWalkToAdjacentStep(Job* job, Mover* mover) {
+    int moverIdx = (int)(mover - movers);
     int adjX = job->targetAdjX;
     int adjY = job->targetAdjY;
     int z = job->targetMineZ;
 
     if (mover->goal.x != adjX || mover->goal.y != adjY || mover->goal.z != z) {
         mover->goal = (Point){adjX, adjY, z};
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
     float goalX = adjX * CELL_SIZE + CELL_SIZE * 0.5f;
     float goalY = adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-    float dx = mover->x - goalX;
-    float dy = mover->y - goalY;
+    float dx = moverPosX[moverIdx] - goalX;
+    float dy = moverPosY[moverIdx] - goalY;
     float distSq = dx * dx + dy * dy;
 
-    bool correctZ = (int)mover->z == z;
+    bool correctZ = (int)moverPosZ[moverIdx] == z;
     if (correctZ) TryFinalApproach(mover, goalX, goalY, adjX, adjY, PICKUP_RADIUS);
 
     if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
@@ -879,22 +895,23 @@ static JobRunResult RunWalkToAdjacentStep(Job* job, Mover* mover) {
 // Returns JOBRUN_RUNNING while walking, JOBRUN_FAIL if stuck.
 // On arrival: sets step=STEP_WORKING, returns JOBRUN_RUNNING.
 static JobRunResult RunWalkToTileStep(Job* job, Mover* mover) {
+    int moverIdx = (int)(mover - movers);
     int tx = job->targetMineX;
     int ty = job->targetMineY;
     int tz = job->targetMineZ;
 
     if (mover->goal.x != tx || mover->goal.y != ty || mover->goal.z != tz) {
         mover->goal = (Point){tx, ty, tz};
-        mover->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
     float goalX = tx * CELL_SIZE + CELL_SIZE * 0.5f;
     float goalY = ty * CELL_SIZE + CELL_SIZE * 0.5f;
-    float dx = mover->x - goalX;
-    float dy = mover->y - goalY;
+    float dx = moverPosX[moverIdx] - goalX;
+    float dy = moverPosY[moverIdx] - goalY;
     float distSq = dx * dx + dy * dy;
 
-    bool correctZ = (int)mover->z == tz;
+    bool correctZ = (int)moverPosZ[moverIdx] == tz;
     if (correctZ) TryFinalApproach(mover, goalX, goalY, tx, ty, PICKUP_RADIUS);
 
     if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
@@ -939,17 +956,16 @@ JobRunResult RunJob_Haul(Job* job, void* moverPtr, float dt) {
     if (job->step == STEP_CARRYING) {
         if (!stockpiles[spIdx].active) return JOBRUN_FAIL;
         int itemIdx = job->carryingItem;
-        if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+        if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
         if (!StockpileAcceptsItem(spIdx, items[itemIdx].type, items[itemIdx].material)) return JOBRUN_FAIL;
 
         JobRunResult r = RunCarryStep(job, mover, job->targetSlotX, job->targetSlotY, stockpiles[spIdx].z);
         if (r == JOBRUN_DONE) {
-            Item* item = &items[itemIdx];
             float targetX = job->targetSlotX * CELL_SIZE + CELL_SIZE * 0.5f;
             float targetY = job->targetSlotY * CELL_SIZE + CELL_SIZE * 0.5f;
-            item->x = targetX;
-            item->y = targetY;
-            item->reservedBy = -1;
+            itemPosX[itemIdx] = targetX;
+            itemPosY[itemIdx] = targetY;
+            itemReservedBy[itemIdx] = -1;
             PlaceItemInStockpile(spIdx, job->targetSlotX, job->targetSlotY, itemIdx);
             job->carryingItem = -1;
         }
@@ -962,37 +978,38 @@ JobRunResult RunJob_Haul(Job* job, void* moverPtr, float dt) {
 JobRunResult RunJob_Clear(Job* job, void* moverPtr, float dt) {
     (void)dt;
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
 
     if (job->step == STEP_MOVING_TO_PICKUP) {
         int itemIdx = job->targetItem;
-        if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+        if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
 
         Item* item = &items[itemIdx];
-        int itemCellX = (int)(item->x / CELL_SIZE);
-        int itemCellY = (int)(item->y / CELL_SIZE);
-        int itemCellZ = (int)(item->z);
+        int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+        int itemCellZ = (int)(itemPosZ[itemIdx]);
         if (!IsCellWalkableAt(itemCellZ, itemCellY, itemCellX)) {
             SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
             return JOBRUN_FAIL;
         }
 
-        float dx = mover->x - item->x;
-        float dy = mover->y - item->y;
+        float dx = moverPosX[moverIdx] - itemPosX[itemIdx];
+        float dy = moverPosY[moverIdx] - itemPosY[itemIdx];
         float distSq = dx*dx + dy*dy;
 
         if (IsPathExhausted(mover) && distSq >= PICKUP_RADIUS * PICKUP_RADIUS) {
             mover->goal = (Point){itemCellX, itemCellY, itemCellZ};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
-        TryFinalApproach(mover, item->x, item->y, itemCellX, itemCellY, PICKUP_RADIUS);
+        TryFinalApproach(mover, itemPosX[itemIdx], itemPosY[itemIdx], itemCellX, itemCellY, PICKUP_RADIUS);
         if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
             SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
             return JOBRUN_FAIL;
         }
 
         if (distSq < PICKUP_RADIUS * PICKUP_RADIUS) {
-            if (item->state == ITEM_IN_STOCKPILE) ClearSourceStockpileSlot(item);
-            item->state = ITEM_CARRIED;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) ClearSourceStockpileSlot(itemIdx);
+            SetItemState(itemIdx, ITEM_CARRIED);
             EventLog("Item %d (%s x%d) picked up by mover %d for job %d",
                      itemIdx, ItemName(item->type), item->stackCount, (int)(mover - movers), (int)(job - jobs));
             job->carryingItem = itemIdx;
@@ -1000,8 +1017,8 @@ JobRunResult RunJob_Clear(Job* job, void* moverPtr, float dt) {
             job->step = STEP_CARRYING;
 
             // Find drop location outside stockpile
-            int moverTileX = (int)(mover->x / CELL_SIZE);
-            int moverTileY = (int)(mover->y / CELL_SIZE);
+            int moverTileX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+            int moverTileY = (int)(moverPosY[moverIdx] / CELL_SIZE);
             bool foundDrop = false;
             for (int radius = 1; radius <= 5 && !foundDrop; radius++) {
                 for (int dy2 = -radius; dy2 <= radius && !foundDrop; dy2++) {
@@ -1009,11 +1026,11 @@ JobRunResult RunJob_Clear(Job* job, void* moverPtr, float dt) {
                         if (abs(dx2) != radius && abs(dy2) != radius) continue;
                         int checkX = moverTileX + dx2, checkY = moverTileY + dy2;
                         if (checkX < 0 || checkY < 0 || checkX >= gridWidth || checkY >= gridHeight) continue;
-                        if (!IsCellWalkableAt((int)mover->z, checkY, checkX)) continue;
+                        if (!IsCellWalkableAt((int)moverPosZ[moverIdx], checkY, checkX)) continue;
                         int tempSpIdx;
                         if (IsPositionInStockpile(checkX * CELL_SIZE + CELL_SIZE * 0.5f,
                                                   checkY * CELL_SIZE + CELL_SIZE * 0.5f,
-                                                  (int)mover->z, &tempSpIdx)) continue;
+                                                  (int)moverPosZ[moverIdx], &tempSpIdx)) continue;
                         job->targetSlotX = checkX;
                         job->targetSlotY = checkY;
                         foundDrop = true;
@@ -1022,20 +1039,19 @@ JobRunResult RunJob_Clear(Job* job, void* moverPtr, float dt) {
             }
             if (!foundDrop) { job->targetSlotX = moverTileX; job->targetSlotY = moverTileY; }
 
-            mover->goal = (Point){job->targetSlotX, job->targetSlotY, (int)mover->z};
-            mover->needsRepath = true;
+            mover->goal = (Point){job->targetSlotX, job->targetSlotY, (int)moverPosZ[moverIdx]};
+            moverNeedsRepath[moverIdx] = true;
         }
         return JOBRUN_RUNNING;
     }
     if (job->step == STEP_CARRYING) {
-        JobRunResult r = RunCarryStep(job, mover, job->targetSlotX, job->targetSlotY, (int)mover->z);
+        JobRunResult r = RunCarryStep(job, mover, job->targetSlotX, job->targetSlotY, (int)moverPosZ[moverIdx]);
         if (r == JOBRUN_DONE) {
             int itemIdx = job->carryingItem;
-            Item* item = &items[itemIdx];
-            item->state = ITEM_ON_GROUND;
-            item->x = job->targetSlotX * CELL_SIZE + CELL_SIZE * 0.5f;
-            item->y = job->targetSlotY * CELL_SIZE + CELL_SIZE * 0.5f;
-            item->reservedBy = -1;
+            SetItemState(itemIdx, ITEM_ON_GROUND);
+            itemPosX[itemIdx] = job->targetSlotX * CELL_SIZE + CELL_SIZE * 0.5f;
+            itemPosY[itemIdx] = job->targetSlotY * CELL_SIZE + CELL_SIZE * 0.5f;
+            itemReservedBy[itemIdx] = -1;
             job->carryingItem = -1;
         }
         return r;
@@ -1200,7 +1216,7 @@ JobRunResult RunJob_PlantSapling(Job* job, void* moverPtr, float dt) {
         int itemIdx = job->carryingItem;
         JobRunResult r = RunWorkProgress(job, d, mover, dt, PLANT_SAPLING_WORK_TIME, false, 1.0f);
         if (r == JOBRUN_DONE) {
-            if (itemIdx >= 0 && items[itemIdx].active) {
+            if (itemIdx >= 0 && itemActive[itemIdx]) {
                 PlaceSapling(tx, ty, tz, (MaterialType)items[itemIdx].material);
                 DeleteItem(itemIdx);
             } else {
@@ -1380,9 +1396,9 @@ JobRunResult RunJob_Explore(Job* job, void* moverPtr, float dt) {
     Designation* d = GetDesignation(tx, ty, tz);
     if (!d || d->type != DESIGNATION_EXPLORE) return JOBRUN_FAIL;
 
-    int cx = (int)(mover->x / CELL_SIZE);
-    int cy = (int)(mover->y / CELL_SIZE);
-    int cz = (int)mover->z;
+    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cz = (int)moverPosZ[moverIdx];
 
     // Designation fulfilled when target cell has been revealed (not just when mover stands on it)
     if (IsExplored(tx, ty, tz)) {
@@ -1391,7 +1407,7 @@ JobRunResult RunJob_Explore(Job* job, void* moverPtr, float dt) {
     }
 
     // If mover still has path waypoints to walk, let UpdateMovers handle it
-    if (mover->pathLength > 0 && mover->pathIndex >= 0 && mover->pathIndex < mover->pathLength) {
+    if (moverPathLength[moverIdx] > 0 && moverPathIndex[moverIdx] >= 0 && moverPathIndex[moverIdx] < moverPathLength[moverIdx]) {
         return JOBRUN_RUNNING;
     }
 
@@ -1407,10 +1423,10 @@ JobRunResult RunJob_Explore(Job* job, void* moverPtr, float dt) {
         Point start = { cx, cy, cz };
         int pathLen = FindPath(moverPathAlgorithm, start, fogEdge, moverPaths[moverIdx], MAX_MOVER_PATH);
         if (pathLen > 0) {
-            mover->pathLength = pathLen;
-            mover->pathIndex = 0;
-            if (mover->pathLength > 2) {
-                StringPullPath(moverPaths[moverIdx], &mover->pathLength);
+            moverPathLength[moverIdx] = pathLen;
+            moverPathIndex[moverIdx] = 0;
+            if (moverPathLength[moverIdx] > 2) {
+                StringPullPath(moverPaths[moverIdx], &moverPathLength[moverIdx]);
             }
             return JOBRUN_RUNNING;
         }
@@ -1433,11 +1449,11 @@ JobRunResult RunJob_Explore(Job* job, void* moverPtr, float dt) {
     for (int i = 0; i < traceLen; i++) {
         moverPaths[moverIdx][i] = tracePath[i];
     }
-    mover->pathLength = traceLen;
-    mover->pathIndex = 0;
+    moverPathLength[moverIdx] = traceLen;
+    moverPathIndex[moverIdx] = 0;
 
-    if (mover->pathLength > 2) {
-        StringPullPath(moverPaths[moverIdx], &mover->pathLength);
+    if (moverPathLength[moverIdx] > 2) {
+        StringPullPath(moverPaths[moverIdx], &moverPathLength[moverIdx]);
     }
 
     return JOBRUN_RUNNING;
@@ -1463,12 +1479,13 @@ JobRunResult RunJob_GatherTree(Job* job, void* moverPtr, float dt) {
 JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
     (void)dt;
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
 
     if (job->step == STEP_MOVING_TO_PICKUP) {
         int itemIdx = job->targetItem;
 
         // Check if item still exists
-        if (itemIdx < 0 || !items[itemIdx].active) {
+        if (itemIdx < 0 || !itemActive[itemIdx]) {
             return JOBRUN_FAIL;
         }
 
@@ -1479,9 +1496,9 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
         }
 
         Item* item = &items[itemIdx];
-        int itemCellX = (int)(item->x / CELL_SIZE);
-        int itemCellY = (int)(item->y / CELL_SIZE);
-        int itemCellZ = (int)(item->z);
+        int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+        int itemCellZ = (int)(itemPosZ[itemIdx]);
 
         // Check if item's cell became a wall
         if (!IsCellWalkableAt(itemCellZ, itemCellY, itemCellX)) {
@@ -1489,18 +1506,18 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
             return JOBRUN_FAIL;
         }
 
-        float dx = mover->x - item->x;
-        float dy = mover->y - item->y;
+        float dx = moverPosX[moverIdx] - itemPosX[itemIdx];
+        float dy = moverPosY[moverIdx] - itemPosY[itemIdx];
         float distSq = dx*dx + dy*dy;
 
         // Request repath if path exhausted and not at destination
         if (IsPathExhausted(mover) && distSq >= PICKUP_RADIUS * PICKUP_RADIUS) {
             mover->goal = (Point){itemCellX, itemCellY, itemCellZ};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
 
         // Final approach - move directly toward item when close but path exhausted
-        TryFinalApproach(mover, item->x, item->y, itemCellX, itemCellY, PICKUP_RADIUS);
+        TryFinalApproach(mover, itemPosX[itemIdx], itemPosY[itemIdx], itemCellX, itemCellY, PICKUP_RADIUS);
 
         // Check if stuck
         if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
@@ -1514,10 +1531,10 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
                 ExtractItemFromContainer(itemIdx);
             }
             // Pick up the item
-            else if (item->state == ITEM_IN_STOCKPILE) {
-                ClearSourceStockpileSlot(item);
+            else if (itemState[itemIdx] == ITEM_IN_STOCKPILE) {
+                ClearSourceStockpileSlot(itemIdx);
             }
-            item->state = ITEM_CARRIED;
+            SetItemState(itemIdx, ITEM_CARRIED);
             job->carryingItem = itemIdx;
             job->targetItem = -1;
             job->step = STEP_CARRYING;
@@ -1543,7 +1560,7 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
             }
 
             mover->goal = goalCell;
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
 
         return JOBRUN_RUNNING;
@@ -1553,19 +1570,19 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
         int bpIdx = job->targetBlueprint;
 
         // Check if still carrying
-        if (itemIdx < 0 || !items[itemIdx].active) {
+        if (itemIdx < 0 || !itemActive[itemIdx]) {
             return JOBRUN_FAIL;
         }
 
         // Check if blueprint still exists
         if (bpIdx < 0 || !blueprints[bpIdx].active) {
             // Blueprint cancelled - drop item on ground
-            items[itemIdx].state = ITEM_ON_GROUND;
-            items[itemIdx].x = mover->x;
-            items[itemIdx].y = mover->y;
-            items[itemIdx].z = mover->z;
-            items[itemIdx].reservedBy = -1;
-            if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, mover->x, mover->y, mover->z);
+            SetItemState(itemIdx, ITEM_ON_GROUND);
+            itemPosX[itemIdx] = moverPosX[moverIdx];
+            itemPosY[itemIdx] = moverPosY[moverIdx];
+            itemPosZ[itemIdx] = moverPosZ[moverIdx];
+            itemReservedBy[itemIdx] = -1;
+            if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx]);
             job->carryingItem = -1;
             return JOBRUN_DONE;  // Job is "done" in the sense that we handled it gracefully
         }
@@ -1573,9 +1590,9 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
         Blueprint* bp = &blueprints[bpIdx];
 
         // Check if arrived at blueprint (on it or adjacent for building over air)
-        int moverCellX = (int)(mover->x / CELL_SIZE);
-        int moverCellY = (int)(mover->y / CELL_SIZE);
-        int moverCellZ = (int)mover->z;
+        int moverCellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+        int moverCellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+        int moverCellZ = (int)moverPosZ[moverIdx];
 
         bool onBlueprint = (moverCellX == bp->x && moverCellY == bp->y && moverCellZ == bp->z);
         bool adjacentToBlueprint = (moverCellZ == bp->z &&
@@ -1595,10 +1612,10 @@ JobRunResult RunJob_HaulToBlueprint(Job* job, void* moverPtr, float dt) {
         }
 
         // Update carried item position (including container contents)
-        items[itemIdx].x = mover->x;
-        items[itemIdx].y = mover->y;
-        items[itemIdx].z = mover->z;
-        if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, mover->x, mover->y, mover->z);
+        itemPosX[itemIdx] = moverPosX[moverIdx];
+        itemPosY[itemIdx] = moverPosY[moverIdx];
+        itemPosZ[itemIdx] = moverPosZ[moverIdx];
+        if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx]);
 
         if (onBlueprint || adjacentToBlueprint) {
             // Deliver material to blueprint
@@ -1631,9 +1648,9 @@ JobRunResult RunJob_Build(Job* job, void* moverPtr, float dt) {
         // Don't override it here
 
         // Check if arrived - either on the blueprint cell OR adjacent to it (for building over air)
-        int moverCellX = (int)(mover->x / CELL_SIZE);
-        int moverCellY = (int)(mover->y / CELL_SIZE);
-        int moverCellZ = (int)mover->z;
+        int moverCellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+        int moverCellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+        int moverCellZ = (int)moverPosZ[moverIdx];
 
         bool onBlueprint = (moverCellX == bp->x && moverCellY == bp->y && moverCellZ == bp->z);
         bool adjacentToBlueprint = (moverCellZ == bp->z &&
@@ -1720,30 +1737,29 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
             int itemIdx = job->targetItem;
 
             // Check if item still exists and is reserved by us
-            if (itemIdx < 0 || !items[itemIdx].active) {
+            if (itemIdx < 0 || !itemActive[itemIdx]) {
                 return JOBRUN_FAIL;
             }
-            Item* item = &items[itemIdx];
-            if (item->reservedBy != moverIdx) {
+            if (itemReservedBy[itemIdx] != moverIdx) {
                 return JOBRUN_FAIL;
             }
 
-            int itemCellX = (int)(item->x / CELL_SIZE);
-            int itemCellY = (int)(item->y / CELL_SIZE);
-            int itemCellZ = (int)(item->z);
+            int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+            int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+            int itemCellZ = (int)(itemPosZ[itemIdx]);
 
             // Set goal to item
             if (mover->goal.x != itemCellX || mover->goal.y != itemCellY || mover->goal.z != itemCellZ) {
                 mover->goal = (Point){itemCellX, itemCellY, itemCellZ};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
-            float dx = mover->x - item->x;
-            float dy = mover->y - item->y;
+            float dx = moverPosX[moverIdx] - itemPosX[itemIdx];
+            float dy = moverPosY[moverIdx] - itemPosY[itemIdx];
             float distSq = dx*dx + dy*dy;
 
             // Final approach - move directly toward item when close but path exhausted
-            TryFinalApproach(mover, item->x, item->y, itemCellX, itemCellY, PICKUP_RADIUS);
+            TryFinalApproach(mover, itemPosX[itemIdx], itemPosY[itemIdx], itemCellX, itemCellY, PICKUP_RADIUS);
 
             // Check if stuck
             if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
@@ -1759,7 +1775,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
         case CRAFT_STEP_PICKING_UP: {
             int itemIdx = job->targetItem;
-            if (itemIdx < 0 || !items[itemIdx].active) {
+            if (itemIdx < 0 || !itemActive[itemIdx]) {
                 return JOBRUN_FAIL;
             }
             Item* item = &items[itemIdx];
@@ -1774,7 +1790,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                 ExtractItemFromContainer(itemIdx);
             }
 
-            item->state = ITEM_CARRIED;
+            SetItemState(itemIdx, ITEM_CARRIED);
             job->carryingItem = itemIdx;
             job->targetItem = -1;
             job->step = CRAFT_STEP_MOVING_TO_WORKSHOP;
@@ -1785,20 +1801,20 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
             // Walk to workshop work tile
             if (mover->goal.x != ws->workTileX || mover->goal.y != ws->workTileY || mover->goal.z != ws->z) {
                 mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
             // Update carried item position to follow mover
-            if (job->carryingItem >= 0 && items[job->carryingItem].active) {
-                items[job->carryingItem].x = mover->x;
-                items[job->carryingItem].y = mover->y;
-                items[job->carryingItem].z = mover->z;
+            if (job->carryingItem >= 0 && itemActive[job->carryingItem]) {
+                itemPosX[job->carryingItem] = moverPosX[moverIdx];
+                itemPosY[job->carryingItem] = moverPosY[moverIdx];
+                itemPosZ[job->carryingItem] = moverPosZ[moverIdx];
             }
 
             float targetX = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
             float targetY = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx = mover->x - targetX;
-            float dy = mover->y - targetY;
+            float dx = moverPosX[moverIdx] - targetX;
+            float dy = moverPosY[moverIdx] - targetY;
             float distSq = dx*dx + dy*dy;
 
             // Final approach - move directly toward workshop when close but path exhausted
@@ -1811,12 +1827,12 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
             if (distSq < PICKUP_RADIUS * PICKUP_RADIUS) {
                 // Deposit first input at workshop work tile
-                if (job->carryingItem >= 0 && items[job->carryingItem].active) {
-                    Item* carried = &items[job->carryingItem];
-                    carried->state = ITEM_ON_GROUND;
-                    carried->x = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carried->y = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carried->z = (float)ws->z;
+                if (job->carryingItem >= 0 && itemActive[job->carryingItem]) {
+                    int itemIdx = job->carryingItem;
+                    SetItemState(job->carryingItem, ITEM_ON_GROUND);
+                    itemPosX[itemIdx] = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
+                    itemPosY[itemIdx] = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
+                    itemPosZ[itemIdx] = (float)ws->z;
                     // Keep it reserved so nobody else grabs it
                 }
                 // Remember deposited input in targetItem so WORKING step can consume it
@@ -1847,28 +1863,27 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
         case CRAFT_STEP_MOVING_TO_INPUT2: {
             // Walk to second input item
             int item2Idx = job->targetItem2;
-            if (item2Idx < 0 || !items[item2Idx].active) {
+            if (item2Idx < 0 || !itemActive[item2Idx]) {
                 return JOBRUN_FAIL;
             }
-            Item* item2 = &items[item2Idx];
-            if (item2->reservedBy != moverIdx) {
+            if (itemReservedBy[item2Idx] != moverIdx) {
                 return JOBRUN_FAIL;
             }
 
-            int item2CellX = (int)(item2->x / CELL_SIZE);
-            int item2CellY = (int)(item2->y / CELL_SIZE);
-            int item2CellZ = (int)(item2->z);
+            int item2CellX = (int)(itemPosX[item2Idx] / CELL_SIZE);
+            int item2CellY = (int)(itemPosY[item2Idx] / CELL_SIZE);
+            int item2CellZ = (int)(itemPosZ[item2Idx]);
 
             if (mover->goal.x != item2CellX || mover->goal.y != item2CellY || mover->goal.z != item2CellZ) {
                 mover->goal = (Point){item2CellX, item2CellY, item2CellZ};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
-            float dx = mover->x - item2->x;
-            float dy = mover->y - item2->y;
+            float dx = moverPosX[moverIdx] - itemPosX[item2Idx];
+            float dy = moverPosY[moverIdx] - itemPosY[item2Idx];
             float distSq2 = dx*dx + dy*dy;
 
-            TryFinalApproach(mover, item2->x, item2->y, item2CellX, item2CellY, PICKUP_RADIUS);
+            TryFinalApproach(mover, itemPosX[item2Idx], itemPosY[item2Idx], item2CellX, item2CellY, PICKUP_RADIUS);
 
             if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
                 SetItemUnreachableCooldown(item2Idx, UNREACHABLE_COOLDOWN);
@@ -1883,7 +1898,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
         case CRAFT_STEP_PICKING_UP_INPUT2: {
             int item2Idx = job->targetItem2;
-            if (item2Idx < 0 || !items[item2Idx].active) {
+            if (item2Idx < 0 || !itemActive[item2Idx]) {
                 return JOBRUN_FAIL;
             }
             Item* item2 = &items[item2Idx];
@@ -1898,7 +1913,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                 ExtractItemFromContainer(item2Idx);
             }
 
-            item2->state = ITEM_CARRIED;
+            SetItemState(item2Idx, ITEM_CARRIED);
             job->carryingItem = item2Idx;
             job->targetItem2 = -1;  // Clear target now that we're carrying
             job->step = CRAFT_STEP_CARRYING_INPUT2;
@@ -1909,20 +1924,20 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
             // Walk back to workshop work tile
             if (mover->goal.x != ws->workTileX || mover->goal.y != ws->workTileY || mover->goal.z != ws->z) {
                 mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
             // Update carried item position
-            if (job->carryingItem >= 0 && items[job->carryingItem].active) {
-                items[job->carryingItem].x = mover->x;
-                items[job->carryingItem].y = mover->y;
-                items[job->carryingItem].z = mover->z;
+            if (job->carryingItem >= 0 && itemActive[job->carryingItem]) {
+                itemPosX[job->carryingItem] = moverPosX[moverIdx];
+                itemPosY[job->carryingItem] = moverPosY[moverIdx];
+                itemPosZ[job->carryingItem] = moverPosZ[moverIdx];
             }
 
             float targetX = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
             float targetY = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx = mover->x - targetX;
-            float dy = mover->y - targetY;
+            float dx = moverPosX[moverIdx] - targetX;
+            float dy = moverPosY[moverIdx] - targetY;
             float distSq2 = dx*dx + dy*dy;
 
             TryFinalApproach(mover, targetX, targetY, ws->workTileX, ws->workTileY, PICKUP_RADIUS);
@@ -1933,12 +1948,12 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
             if (distSq2 < PICKUP_RADIUS * PICKUP_RADIUS) {
                 // Deposit second input at workshop
-                if (job->carryingItem >= 0 && items[job->carryingItem].active) {
-                    Item* carried = &items[job->carryingItem];
-                    carried->state = ITEM_ON_GROUND;
-                    carried->x = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carried->y = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carried->z = (float)ws->z;
+                if (job->carryingItem >= 0 && itemActive[job->carryingItem]) {
+                    int itemIdx = job->carryingItem;
+                    SetItemState(job->carryingItem, ITEM_ON_GROUND);
+                    itemPosX[itemIdx] = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
+                    itemPosY[itemIdx] = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
+                    itemPosZ[itemIdx] = (float)ws->z;
                 }
                 // Store second input in targetItem2 for consumption
                 job->targetItem2 = job->carryingItem;
@@ -1964,28 +1979,27 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
         case CRAFT_STEP_MOVING_TO_INPUT3: {
             // Walk to third input item
             int item3Idx = job->targetItem3;
-            if (item3Idx < 0 || !items[item3Idx].active) {
+            if (item3Idx < 0 || !itemActive[item3Idx]) {
                 return JOBRUN_FAIL;
             }
-            Item* item3 = &items[item3Idx];
-            if (item3->reservedBy != moverIdx) {
+            if (itemReservedBy[item3Idx] != moverIdx) {
                 return JOBRUN_FAIL;
             }
 
-            int item3CellX = (int)(item3->x / CELL_SIZE);
-            int item3CellY = (int)(item3->y / CELL_SIZE);
-            int item3CellZ = (int)(item3->z);
+            int item3CellX = (int)(itemPosX[item3Idx] / CELL_SIZE);
+            int item3CellY = (int)(itemPosY[item3Idx] / CELL_SIZE);
+            int item3CellZ = (int)(itemPosZ[item3Idx]);
 
             if (mover->goal.x != item3CellX || mover->goal.y != item3CellY || mover->goal.z != item3CellZ) {
                 mover->goal = (Point){item3CellX, item3CellY, item3CellZ};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
-            float dx3m = mover->x - item3->x;
-            float dy3m = mover->y - item3->y;
+            float dx3m = moverPosX[moverIdx] - itemPosX[item3Idx];
+            float dy3m = moverPosY[moverIdx] - itemPosY[item3Idx];
             float distSq3 = dx3m*dx3m + dy3m*dy3m;
 
-            TryFinalApproach(mover, item3->x, item3->y, item3CellX, item3CellY, PICKUP_RADIUS);
+            TryFinalApproach(mover, itemPosX[item3Idx], itemPosY[item3Idx], item3CellX, item3CellY, PICKUP_RADIUS);
 
             if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
                 SetItemUnreachableCooldown(item3Idx, UNREACHABLE_COOLDOWN);
@@ -2000,7 +2014,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
         case CRAFT_STEP_PICKING_UP_INPUT3: {
             int item3Idx = job->targetItem3;
-            if (item3Idx < 0 || !items[item3Idx].active) {
+            if (item3Idx < 0 || !itemActive[item3Idx]) {
                 return JOBRUN_FAIL;
             }
             Item* item3 = &items[item3Idx];
@@ -2015,7 +2029,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                 ExtractItemFromContainer(item3Idx);
             }
 
-            item3->state = ITEM_CARRIED;
+            SetItemState(item3Idx, ITEM_CARRIED);
             job->carryingItem = item3Idx;
             job->targetItem3 = -1;  // Clear target now that we're carrying
             job->step = CRAFT_STEP_CARRYING_INPUT3;
@@ -2026,20 +2040,20 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
             // Walk back to workshop work tile
             if (mover->goal.x != ws->workTileX || mover->goal.y != ws->workTileY || mover->goal.z != ws->z) {
                 mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
             // Update carried item position
-            if (job->carryingItem >= 0 && items[job->carryingItem].active) {
-                items[job->carryingItem].x = mover->x;
-                items[job->carryingItem].y = mover->y;
-                items[job->carryingItem].z = mover->z;
+            if (job->carryingItem >= 0 && itemActive[job->carryingItem]) {
+                itemPosX[job->carryingItem] = moverPosX[moverIdx];
+                itemPosY[job->carryingItem] = moverPosY[moverIdx];
+                itemPosZ[job->carryingItem] = moverPosZ[moverIdx];
             }
 
             float targetX3 = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
             float targetY3 = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx3c = mover->x - targetX3;
-            float dy3c = mover->y - targetY3;
+            float dx3c = moverPosX[moverIdx] - targetX3;
+            float dy3c = moverPosY[moverIdx] - targetY3;
             float distSq3c = dx3c*dx3c + dy3c*dy3c;
 
             TryFinalApproach(mover, targetX3, targetY3, ws->workTileX, ws->workTileY, PICKUP_RADIUS);
@@ -2050,12 +2064,12 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
             if (distSq3c < PICKUP_RADIUS * PICKUP_RADIUS) {
                 // Deposit third input at workshop
-                if (job->carryingItem >= 0 && items[job->carryingItem].active) {
-                    Item* carried = &items[job->carryingItem];
-                    carried->state = ITEM_ON_GROUND;
-                    carried->x = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carried->y = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carried->z = (float)ws->z;
+                if (job->carryingItem >= 0 && itemActive[job->carryingItem]) {
+                    int itemIdx = job->carryingItem;
+                    SetItemState(job->carryingItem, ITEM_ON_GROUND);
+                    itemPosX[itemIdx] = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
+                    itemPosY[itemIdx] = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
+                    itemPosZ[itemIdx] = (float)ws->z;
                 }
                 // Store third input in targetItem3 for consumption
                 job->targetItem3 = job->carryingItem;
@@ -2077,28 +2091,27 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
         case CRAFT_STEP_MOVING_TO_FUEL: {
             // Walk to fuel item
             int fuelIdx = job->fuelItem;
-            if (fuelIdx < 0 || !items[fuelIdx].active) {
+            if (fuelIdx < 0 || !itemActive[fuelIdx]) {
                 return JOBRUN_FAIL;
             }
-            Item* fuelItem = &items[fuelIdx];
-            if (fuelItem->reservedBy != moverIdx) {
+            if (itemReservedBy[fuelIdx] != moverIdx) {
                 return JOBRUN_FAIL;
             }
 
-            int fuelCellX = (int)(fuelItem->x / CELL_SIZE);
-            int fuelCellY = (int)(fuelItem->y / CELL_SIZE);
-            int fuelCellZ = (int)(fuelItem->z);
+            int fuelCellX = (int)(itemPosX[fuelIdx] / CELL_SIZE);
+            int fuelCellY = (int)(itemPosY[fuelIdx] / CELL_SIZE);
+            int fuelCellZ = (int)(itemPosZ[fuelIdx]);
 
             if (mover->goal.x != fuelCellX || mover->goal.y != fuelCellY || mover->goal.z != fuelCellZ) {
                 mover->goal = (Point){fuelCellX, fuelCellY, fuelCellZ};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
-            float dx = mover->x - fuelItem->x;
-            float dy = mover->y - fuelItem->y;
+            float dx = moverPosX[moverIdx] - itemPosX[fuelIdx];
+            float dy = moverPosY[moverIdx] - itemPosY[fuelIdx];
             float distSq = dx*dx + dy*dy;
 
-            TryFinalApproach(mover, fuelItem->x, fuelItem->y, fuelCellX, fuelCellY, PICKUP_RADIUS);
+            TryFinalApproach(mover, itemPosX[fuelIdx], itemPosY[fuelIdx], fuelCellX, fuelCellY, PICKUP_RADIUS);
 
             if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
                 SetItemUnreachableCooldown(fuelIdx, UNREACHABLE_COOLDOWN);
@@ -2113,7 +2126,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 
         case CRAFT_STEP_PICKING_UP_FUEL: {
             int fuelIdx = job->fuelItem;
-            if (fuelIdx < 0 || !items[fuelIdx].active) {
+            if (fuelIdx < 0 || !itemActive[fuelIdx]) {
                 return JOBRUN_FAIL;
             }
             Item* fuelItem = &items[fuelIdx];
@@ -2129,7 +2142,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                 ExtractItemFromContainer(fuelIdx);
             }
 
-            fuelItem->state = ITEM_CARRIED;
+            SetItemState(fuelIdx, ITEM_CARRIED);
             job->step = CRAFT_STEP_CARRYING_FUEL;
             break;
         }
@@ -2138,20 +2151,20 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
             // Walk back to workshop work tile
             if (mover->goal.x != ws->workTileX || mover->goal.y != ws->workTileY || mover->goal.z != ws->z) {
                 mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
             }
 
             // Update carried fuel item position to follow mover
-            if (job->fuelItem >= 0 && items[job->fuelItem].active) {
-                items[job->fuelItem].x = mover->x;
-                items[job->fuelItem].y = mover->y;
-                items[job->fuelItem].z = mover->z;
+            if (job->fuelItem >= 0 && itemActive[job->fuelItem]) {
+                itemPosX[job->fuelItem] = moverPosX[moverIdx];
+                itemPosY[job->fuelItem] = moverPosY[moverIdx];
+                itemPosZ[job->fuelItem] = moverPosZ[moverIdx];
             }
 
             float targetX = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
             float targetY = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx = mover->x - targetX;
-            float dy = mover->y - targetY;
+            float dx = moverPosX[moverIdx] - targetX;
+            float dy = moverPosY[moverIdx] - targetY;
             float distSq = dx*dx + dy*dy;
 
             TryFinalApproach(mover, targetX, targetY, ws->workTileX, ws->workTileY, PICKUP_RADIUS);
@@ -2180,7 +2193,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                               ws->type == WORKSHOP_CHARCOAL_PIT ||
                               ws->type == WORKSHOP_HEARTH);
             if (emitsFire && ws->fuelTileX >= 0) {
-                if (GetRandomValue(0, 3) == 0) {
+                if (SimRandRange(RNG_JOBS, 0, 3) == 0) {
                     AddSmoke(ws->fuelTileX, ws->fuelTileY, ws->z, 5);
                 }
                 AddLightSource(ws->fuelTileX, ws->fuelTileY, ws->z, 255, 140, 50, 8);
@@ -2192,7 +2205,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                 // Find the input item - either still carried (no-fuel path) or deposited (fuel path, stored in targetItem)
                 int inputItemIdx = job->carryingItem >= 0 ? job->carryingItem : job->targetItem;
                 MaterialType inputMat = MAT_NONE;
-                if (inputItemIdx >= 0 && items[inputItemIdx].active) {
+                if (inputItemIdx >= 0 && itemActive[inputItemIdx]) {
                     inputMat = (MaterialType)items[inputItemIdx].material;
                     if (inputMat == MAT_NONE) {
                         inputMat = (MaterialType)DefaultMaterialForItemType(items[inputItemIdx].type);
@@ -2200,26 +2213,26 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                 }
 
                 // Consume first input item
-                if (inputItemIdx >= 0 && items[inputItemIdx].active) {
+                if (inputItemIdx >= 0 && itemActive[inputItemIdx]) {
                     DeleteItem(inputItemIdx);
                 }
                 job->carryingItem = -1;
                 job->targetItem = -1;
 
                 // Consume second input item (if any)
-                if (job->targetItem2 >= 0 && items[job->targetItem2].active) {
+                if (job->targetItem2 >= 0 && itemActive[job->targetItem2]) {
                     DeleteItem(job->targetItem2);
                 }
                 job->targetItem2 = -1;
 
                 // Consume third input item (if any)
-                if (job->targetItem3 >= 0 && items[job->targetItem3].active) {
+                if (job->targetItem3 >= 0 && itemActive[job->targetItem3]) {
                     DeleteItem(job->targetItem3);
                 }
                 job->targetItem3 = -1;
 
                 // Consume fuel item (if any - don't preserve its material)
-                if (job->fuelItem >= 0 && items[job->fuelItem].active) {
+                if (job->fuelItem >= 0 && itemActive[job->fuelItem]) {
                     DeleteItem(job->fuelItem);
                 }
                 job->fuelItem = -1;
@@ -2232,7 +2245,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                     const ButcherYieldDef* yield = GetButcherYield(inputMat);
                     for (int yi = 0; yi < yield->productCount; yi++) {
                         int outIdx = SpawnItem(outX, outY, (float)ws->z, yield->products[yi].type);
-                        if (outIdx >= 0) items[outIdx].stackCount = yield->products[yi].count;
+                        if (outIdx >= 0) SetItemStackCount(outIdx, yield->products[yi].count);
                     }
                 } else {
                     {
@@ -2244,7 +2257,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                         }
                         int outIdx = SpawnItemWithMaterial(outX, outY, (float)ws->z, recipe->outputType, outMat);
                         if (outIdx >= 0) {
-                            items[outIdx].stackCount = recipe->outputCount;
+                            SetItemStackCount(outIdx, recipe->outputCount);
                             // Hot food: set temperature if cooked at a heat-source workshop
                             if (ws->fuelTileX >= 0 || ws->type == WORKSHOP_STOVE || ws->type == WORKSHOP_HEARTH ||
                                 ws->type == WORKSHOP_CAMPFIRE || ws->type == WORKSHOP_GROUND_FIRE) {
@@ -2263,7 +2276,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
                             outMat2 = DefaultMaterialForItemType(recipe->outputType2);
                         }
                         int outIdx2 = SpawnItemWithMaterial(outX, outY, (float)ws->z, recipe->outputType2, outMat2);
-                        if (outIdx2 >= 0) items[outIdx2].stackCount = recipe->outputCount2;
+                        if (outIdx2 >= 0) SetItemStackCount(outIdx2, recipe->outputCount2);
                     }
                 }
 
@@ -2306,6 +2319,7 @@ JobRunResult RunJob_Craft(Job* job, void* moverPtr, float dt) {
 // Deliver-to-workshop job driver: pick up item -> carry to workshop work tile -> drop
 JobRunResult RunJob_DeliverToWorkshop(Job* job, void* moverPtr, float dt) {
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
     (void)dt;
 
     // Validate workshop still exists
@@ -2318,27 +2332,27 @@ JobRunResult RunJob_DeliverToWorkshop(Job* job, void* moverPtr, float dt) {
     if (job->step == STEP_MOVING_TO_PICKUP) {
         int itemIdx = job->targetItem;
 
-        if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+        if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
 
         Item* item = &items[itemIdx];
-        int itemCellX = (int)(item->x / CELL_SIZE);
-        int itemCellY = (int)(item->y / CELL_SIZE);
-        int itemCellZ = (int)item->z;
+        int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+        int itemCellZ = (int)itemPosZ[itemIdx];
         if (!IsCellWalkableAt(itemCellZ, itemCellY, itemCellX)) {
             SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
             return JOBRUN_FAIL;
         }
 
-        float dx = mover->x - item->x;
-        float dy = mover->y - item->y;
+        float dx = moverPosX[moverIdx] - itemPosX[itemIdx];
+        float dy = moverPosY[moverIdx] - itemPosY[itemIdx];
         float distSq = dx*dx + dy*dy;
 
         if (IsPathExhausted(mover) && distSq >= PICKUP_RADIUS * PICKUP_RADIUS) {
             mover->goal = (Point){itemCellX, itemCellY, itemCellZ};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
 
-        TryFinalApproach(mover, item->x, item->y, itemCellX, itemCellY, PICKUP_RADIUS);
+        TryFinalApproach(mover, itemPosX[itemIdx], itemPosY[itemIdx], itemCellX, itemCellY, PICKUP_RADIUS);
 
         if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
             SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
@@ -2356,30 +2370,30 @@ JobRunResult RunJob_DeliverToWorkshop(Job* job, void* moverPtr, float dt) {
                 ExtractItemFromContainer(itemIdx);
             }
 
-            item->state = ITEM_CARRIED;
+            SetItemState(itemIdx, ITEM_CARRIED);
             job->carryingItem = itemIdx;
             job->targetItem = -1;
             job->step = STEP_CARRYING;
 
             mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
 
         return JOBRUN_RUNNING;
     }
     else if (job->step == STEP_CARRYING) {
         int itemIdx = job->carryingItem;
-        if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+        if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
 
         float targetX = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
         float targetY = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = mover->x - targetX;
-        float dy = mover->y - targetY;
+        float dx = moverPosX[moverIdx] - targetX;
+        float dy = moverPosY[moverIdx] - targetY;
         float distSq = dx*dx + dy*dy;
 
         if (IsPathExhausted(mover) && distSq >= DROP_RADIUS * DROP_RADIUS) {
             mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
 
         TryFinalApproach(mover, targetX, targetY, ws->workTileX, ws->workTileY, DROP_RADIUS);
@@ -2389,18 +2403,17 @@ JobRunResult RunJob_DeliverToWorkshop(Job* job, void* moverPtr, float dt) {
         }
 
         // Update carried item position (including container contents)
-        items[itemIdx].x = mover->x;
-        items[itemIdx].y = mover->y;
-        items[itemIdx].z = mover->z;
-        if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, mover->x, mover->y, mover->z);
+        itemPosX[itemIdx] = moverPosX[moverIdx];
+        itemPosY[itemIdx] = moverPosY[moverIdx];
+        itemPosZ[itemIdx] = moverPosZ[moverIdx];
+        if (items[itemIdx].contentCount > 0) MoveContainer(itemIdx, moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx]);
 
         if (distSq < DROP_RADIUS * DROP_RADIUS) {
-            Item* item = &items[itemIdx];
-            item->state = ITEM_ON_GROUND;
-            item->x = targetX;
-            item->y = targetY;
-            item->z = ws->z;
-            item->reservedBy = -1;
+            SetItemState(itemIdx, ITEM_ON_GROUND);
+            itemPosX[itemIdx] = targetX;
+            itemPosY[itemIdx] = targetY;
+            itemPosZ[itemIdx] = ws->z;
+            itemReservedBy[itemIdx] = -1;
             job->carryingItem = -1;
             return JOBRUN_DONE;
         }
@@ -2414,6 +2427,7 @@ JobRunResult RunJob_DeliverToWorkshop(Job* job, void* moverPtr, float dt) {
 // Ignite workshop job driver: walk to workshop work tile, do short active work, set passiveReady
 JobRunResult RunJob_IgniteWorkshop(Job* job, void* moverPtr, float dt) {
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
 
     if (job->targetWorkshop < 0 || job->targetWorkshop >= MAX_WORKSHOPS ||
         !workshops[job->targetWorkshop].active) {
@@ -2424,16 +2438,16 @@ JobRunResult RunJob_IgniteWorkshop(Job* job, void* moverPtr, float dt) {
     if (job->step == STEP_MOVING_TO_WORK) {
         if (mover->goal.x != ws->workTileX || mover->goal.y != ws->workTileY || mover->goal.z != ws->z) {
             mover->goal = (Point){ws->workTileX, ws->workTileY, ws->z};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
 
         float goalX = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
         float goalY = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = mover->x - goalX;
-        float dy = mover->y - goalY;
+        float dx = moverPosX[moverIdx] - goalX;
+        float dy = moverPosY[moverIdx] - goalY;
         float distSq = dx*dx + dy*dy;
 
-        bool correctZ = (int)mover->z == ws->z;
+        bool correctZ = (int)moverPosZ[moverIdx] == ws->z;
         if (correctZ) TryFinalApproach(mover, goalX, goalY, ws->workTileX, ws->workTileY, PICKUP_RADIUS);
 
         if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
@@ -2485,6 +2499,7 @@ JobRunResult RunJob_Clean(Job* job, void* moverPtr, float dt) {
 // Deconstruct workshop driver: walk to work tile, tear down, refund materials
 JobRunResult RunJob_DeconstructWorkshop(Job* job, void* moverPtr, float dt) {
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
     int wsIdx = job->targetWorkshop;
 
     if (wsIdx < 0 || wsIdx >= MAX_WORKSHOPS || !workshops[wsIdx].active) {
@@ -2494,9 +2509,9 @@ JobRunResult RunJob_DeconstructWorkshop(Job* job, void* moverPtr, float dt) {
     Workshop* ws = &workshops[wsIdx];
 
     if (job->step == STEP_MOVING_TO_WORK) {
-        int moverCellX = (int)(mover->x / CELL_SIZE);
-        int moverCellY = (int)(mover->y / CELL_SIZE);
-        int moverCellZ = (int)mover->z;
+        int moverCellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+        int moverCellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+        int moverCellZ = (int)moverPosZ[moverIdx];
 
         bool atWorkTile = (moverCellX == ws->workTileX && moverCellY == ws->workTileY && moverCellZ == ws->z);
         bool adjacent = (moverCellZ == ws->z &&
@@ -2539,7 +2554,7 @@ JobRunResult RunJob_DeconstructWorkshop(Job* job, void* moverPtr, float dt) {
                             const ConstructionInput* input = &stage->inputs[inp];
                             ItemType refundType = input->alternatives[0].itemType;
                             for (int c = 0; c < input->count; c++) {
-                                if ((GetRandomValue(0, 99)) < CONSTRUCTION_REFUND_CHANCE) {
+                                if ((SimRandRange(RNG_JOBS, 0, 99)) < CONSTRUCTION_REFUND_CHANCE) {
                                     float sx = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
                                     float sy = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
                                     SpawnItem(sx, sy, (float)ws->z, refundType);
@@ -2578,6 +2593,7 @@ JobRunResult RunJob_DeconstructWorkshop(Job* job, void* moverPtr, float dt) {
 // Hunt job driver: chase animal -> attack when adjacent -> kill
 JobRunResult RunJob_Hunt(Job* job, void* moverPtr, float dt) {
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
     int animalIdx = job->targetAnimalIdx;
 
     // Validate target animal
@@ -2594,19 +2610,19 @@ JobRunResult RunJob_Hunt(Job* job, void* moverPtr, float dt) {
         // Update goal to animal's current position
         if (mover->goal.x != animalCellX || mover->goal.y != animalCellY || mover->goal.z != animalCellZ) {
             mover->goal = (Point){animalCellX, animalCellY, animalCellZ};
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
         }
         // Periodic re-path even if goal cell hasn't changed (animal may have moved within cell)
         if (IsPathExhausted(mover) && mover->timeWithoutProgress > HUNT_RETARGET_INTERVAL) {
-            mover->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
             mover->timeWithoutProgress = 0.0f;
         }
 
         // Check proximity — adjacent (within CELL_SIZE) triggers attack
-        float dx = mover->x - target->x;
-        float dy = mover->y - target->y;
+        float dx = moverPosX[moverIdx] - target->x;
+        float dy = moverPosY[moverIdx] - target->y;
         float distSq = dx * dx + dy * dy;
-        bool correctZ = (int)mover->z == animalCellZ;
+        bool correctZ = (int)moverPosZ[moverIdx] == animalCellZ;
 
         if (correctZ) {
             float goalX = animalCellX * CELL_SIZE + CELL_SIZE * 0.5f;
@@ -2776,7 +2792,7 @@ JobRunResult RunJob_PlantCrop(Job* job, void* moverPtr, float dt) {
     if (job->step == STEP_MOVING_TO_PICKUP) {
         // Split off 1 seed from stack so mover only carries 1
         int seedIdx = job->targetItem;
-        if (seedIdx >= 0 && items[seedIdx].active && items[seedIdx].stackCount > 1) {
+        if (seedIdx >= 0 && itemActive[seedIdx] && items[seedIdx].stackCount > 1) {
             int singleIdx = SplitStack(seedIdx, 1);
             if (singleIdx >= 0) {
                 ReleaseItemReservation(seedIdx);
@@ -2802,7 +2818,7 @@ JobRunResult RunJob_PlantCrop(Job* job, void* moverPtr, float dt) {
         JobRunResult r = RunWorkProgress(job, NULL, mover, dt, PLANT_CROP_WORK_TIME, true, 1.0f);
         if (r == JOBRUN_DONE) {
             int itemIdx = job->carryingItem;
-            if (itemIdx >= 0 && items[itemIdx].active) {
+            if (itemIdx >= 0 && itemActive[itemIdx]) {
                 CropType crop = CropTypeForSeed(items[itemIdx].type);
                 if (crop == CROP_NONE) return JOBRUN_FAIL;
                 fc->cropType = (uint8_t)crop;
@@ -2907,23 +2923,23 @@ JobRunResult RunJob_EquipClothing(Job* job, void* moverPtr, float dt) {
     int moverIdx = (int)(mover - movers);
     int itemIdx = job->targetItem;
 
-    if (itemIdx < 0 || !items[itemIdx].active) return JOBRUN_FAIL;
+    if (itemIdx < 0 || !itemActive[itemIdx]) return JOBRUN_FAIL;
     Item* clothing = &items[itemIdx];
 
     if (job->step == STEP_MOVING_TO_PICKUP) {
         // Walk to item
-        int itemCellX = (int)(clothing->x / CELL_SIZE);
-        int itemCellY = (int)(clothing->y / CELL_SIZE);
+        int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
 
-        TryFinalApproach(mover, clothing->x, clothing->y, itemCellX, itemCellY, PICKUP_RADIUS);
+        TryFinalApproach(mover, itemPosX[itemIdx], itemPosY[itemIdx], itemCellX, itemCellY, PICKUP_RADIUS);
 
         if (IsPathExhausted(mover) && mover->timeWithoutProgress > JOB_STUCK_TIME) {
             SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
             return JOBRUN_FAIL;
         }
 
-        float dx = mover->x - clothing->x;
-        float dy = mover->y - clothing->y;
+        float dx = moverPosX[moverIdx] - itemPosX[itemIdx];
+        float dy = moverPosY[moverIdx] - itemPosY[itemIdx];
         if (dx * dx + dy * dy < PICKUP_RADIUS * PICKUP_RADIUS) {
             // Drop old clothing if any
             if (mover->equippedClothing >= 0) {
@@ -2931,16 +2947,16 @@ JobRunResult RunJob_EquipClothing(Job* job, void* moverPtr, float dt) {
             }
 
             // Clear stockpile slot if clothing was in stockpile
-            if (clothing->state == ITEM_IN_STOCKPILE) {
-                ClearSourceStockpileSlot(clothing);
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) {
+                ClearSourceStockpileSlot(itemIdx);
             }
 
             // Equip the clothing
-            clothing->state = ITEM_CARRIED;
-            clothing->reservedBy = moverIdx;
-            clothing->x = mover->x;
-            clothing->y = mover->y;
-            clothing->z = mover->z;
+            SetItemState(itemIdx, ITEM_CARRIED);
+            itemReservedBy[itemIdx] = moverIdx;
+            itemPosX[itemIdx] = moverPosX[moverIdx];
+            itemPosY[itemIdx] = moverPosY[moverIdx];
+            itemPosZ[itemIdx] = moverPosZ[moverIdx];
             mover->equippedClothing = itemIdx;
 
             EventLog("Mover %d equipped clothing item %d (%s)", moverIdx, itemIdx,
@@ -2960,13 +2976,13 @@ int WorkGiver_EquipClothing(int moverIdx) {
     // Current clothing reduction (0.0 if naked)
     float currentReduction = 0.0f;
     if (m->equippedClothing >= 0 && m->equippedClothing < MAX_ITEMS
-        && items[m->equippedClothing].active) {
+        && itemActive[m->equippedClothing]) {
         currentReduction = GetClothingCoolingReduction(items[m->equippedClothing].type);
     }
 
-    int moverCellX = (int)(m->x / CELL_SIZE);
-    int moverCellY = (int)(m->y / CELL_SIZE);
-    int moverZ = (int)m->z;
+    int moverCellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int moverCellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int moverZ = (int)moverPosZ[moverIdx];
 
     // Find best available clothing item (highest cooling reduction)
     // Must be better than current by at least 0.1 to trigger upgrade
@@ -2976,17 +2992,17 @@ int WorkGiver_EquipClothing(int moverIdx) {
     int bestDistSq = 999999;
 
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (!ItemIsClothing(items[i].type)) continue;
-        if (items[i].reservedBy >= 0) continue;
-        if (items[i].state != ITEM_ON_GROUND && items[i].state != ITEM_IN_STOCKPILE) continue;
-        if ((int)items[i].z != moverZ) continue;
+        if (itemReservedBy[i] >= 0) continue;
+        if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
+        if ((int)itemPosZ[i] != moverZ) continue;
 
         float reduction = GetClothingCoolingReduction(items[i].type);
         if (reduction <= minReduction) continue;
 
-        int ix = (int)(items[i].x / CELL_SIZE);
-        int iy = (int)(items[i].y / CELL_SIZE);
+        int ix = (int)(itemPosX[i] / CELL_SIZE);
+        int iy = (int)(itemPosY[i] / CELL_SIZE);
         int dx = ix - moverCellX;
         int dy = iy - moverCellY;
         int distSq = dx * dx + dy * dy;
@@ -3008,7 +3024,7 @@ int WorkGiver_EquipClothing(int moverIdx) {
     Job* job = GetJob(jobId);
     job->targetItem = bestIdx;
     job->step = STEP_MOVING_TO_PICKUP;
-    items[bestIdx].reservedBy = moverIdx;
+    itemReservedBy[bestIdx] = moverIdx;
 
     // Assign to mover
     job->assignedMover = moverIdx;
@@ -3016,10 +3032,10 @@ int WorkGiver_EquipClothing(int moverIdx) {
     RemoveMoverFromIdleList(moverIdx);
 
     // Set goal toward item
-    int itemCellX = (int)(items[bestIdx].x / CELL_SIZE);
-    int itemCellY = (int)(items[bestIdx].y / CELL_SIZE);
+    int itemCellX = (int)(itemPosX[bestIdx] / CELL_SIZE);
+    int itemCellY = (int)(itemPosY[bestIdx] / CELL_SIZE);
     m->goal = (Point){itemCellX, itemCellY, moverZ};
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     EventLog("WorkGiver_EquipClothing: mover %d -> item %d (%s)", moverIdx, bestIdx,
              itemDefs[items[bestIdx].type].name);
@@ -3030,6 +3046,7 @@ int WorkGiver_EquipClothing(int moverIdx) {
 JobRunResult RunJob_FillWaterPot(Job* job, void* moverPtr, float dt) {
     (void)dt;
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
 
     if (job->step == STEP_MOVING_TO_PICKUP) {
         // Walk to empty pot, pick it up
@@ -3073,7 +3090,7 @@ JobRunResult RunJob_FillWaterPot(Job* job, void* moverPtr, float dt) {
         }
 
         int potIdx = job->carryingItem;
-        if (potIdx < 0 || !items[potIdx].active) return JOBRUN_FAIL;
+        if (potIdx < 0 || !itemActive[potIdx]) return JOBRUN_FAIL;
         if (!HasWater(waterX, waterY, waterZ)) return JOBRUN_FAIL;
 
         JobRunResult r = RunCarryStep(job, mover, standX, standY, waterZ);
@@ -3084,9 +3101,9 @@ JobRunResult RunJob_FillWaterPot(Job* job, void* moverPtr, float dt) {
 
             // Spawn water items inside pot
             for (int i = 0; i < fillCount; i++) {
-                int waterItem = SpawnItem(mover->x, mover->y, mover->z, ITEM_WATER);
+                int waterItem = SpawnItem(moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx], ITEM_WATER);
                 if (waterItem >= 0) {
-                    items[waterItem].state = ITEM_IN_CONTAINER;
+                    SetItemState(waterItem, ITEM_IN_CONTAINER);
                     items[waterItem].containedIn = potIdx;
                     items[potIdx].contentCount++;
                     items[potIdx].contentTypeMask |= (1u << (ITEM_WATER & 31));
@@ -3100,15 +3117,15 @@ JobRunResult RunJob_FillWaterPot(Job* job, void* moverPtr, float dt) {
             if (spIdx >= 0 && stockpiles[spIdx].active) {
                 job->step = STEP_CARRYING_BACK;
                 mover->goal = (Point){job->targetSlotX, job->targetSlotY, stockpiles[spIdx].z};
-                mover->needsRepath = true;
+                moverNeedsRepath[moverIdx] = true;
                 return JOBRUN_RUNNING;
             }
             // No stockpile — just drop the pot
-            items[potIdx].state = ITEM_ON_GROUND;
-            items[potIdx].x = mover->x;
-            items[potIdx].y = mover->y;
-            items[potIdx].z = mover->z;
-            items[potIdx].reservedBy = -1;
+            SetItemState(potIdx, ITEM_ON_GROUND);
+            itemPosX[potIdx] = moverPosX[moverIdx];
+            itemPosY[potIdx] = moverPosY[moverIdx];
+            itemPosZ[potIdx] = moverPosZ[moverIdx];
+            itemReservedBy[potIdx] = -1;
             job->carryingItem = -1;
             return JOBRUN_DONE;
         }
@@ -3117,27 +3134,26 @@ JobRunResult RunJob_FillWaterPot(Job* job, void* moverPtr, float dt) {
     if (job->step == STEP_CARRYING_BACK) {
         // Carry filled pot back to stockpile
         int potIdx = job->carryingItem;
-        if (potIdx < 0 || !items[potIdx].active) return JOBRUN_FAIL;
+        if (potIdx < 0 || !itemActive[potIdx]) return JOBRUN_FAIL;
         int spIdx = job->targetStockpile;
         if (spIdx < 0 || !stockpiles[spIdx].active) {
             // Stockpile gone — drop pot
-            items[potIdx].state = ITEM_ON_GROUND;
-            items[potIdx].x = mover->x;
-            items[potIdx].y = mover->y;
-            items[potIdx].z = mover->z;
-            items[potIdx].reservedBy = -1;
+            SetItemState(potIdx, ITEM_ON_GROUND);
+            itemPosX[potIdx] = moverPosX[moverIdx];
+            itemPosY[potIdx] = moverPosY[moverIdx];
+            itemPosZ[potIdx] = moverPosZ[moverIdx];
+            itemReservedBy[potIdx] = -1;
             job->carryingItem = -1;
             return JOBRUN_DONE;
         }
 
         JobRunResult r = RunCarryStep(job, mover, job->targetSlotX, job->targetSlotY, stockpiles[spIdx].z);
         if (r == JOBRUN_DONE) {
-            Item* pot = &items[potIdx];
             float targetX = job->targetSlotX * CELL_SIZE + CELL_SIZE * 0.5f;
             float targetY = job->targetSlotY * CELL_SIZE + CELL_SIZE * 0.5f;
-            pot->x = targetX;
-            pot->y = targetY;
-            pot->reservedBy = -1;
+            itemPosX[potIdx] = targetX;
+            itemPosY[potIdx] = targetY;
+            itemReservedBy[potIdx] = -1;
             PlaceItemInStockpile(spIdx, job->targetSlotX, job->targetSlotY, potIdx);
             job->carryingItem = -1;
         }
@@ -3151,24 +3167,24 @@ int WorkGiver_FillWaterPot(int moverIdx) {
     if (!thirstEnabled) return -1;
 
     Mover* m = &movers[moverIdx];
-    int mz = (int)m->z;
-    int mcx = (int)(m->x / CELL_SIZE);
-    int mcy = (int)(m->y / CELL_SIZE);
+    int mz = (int)moverPosZ[moverIdx];
+    int mcx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int mcy = (int)(moverPosY[moverIdx] / CELL_SIZE);
 
     // Find an empty clay pot (contentCount == 0, unreserved, accessible)
     int bestPot = -1;
     int bestPotDistSq = 999999;
 
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].type != ITEM_CLAY_POT) continue;
-        if (items[i].reservedBy >= 0) continue;
+        if (itemReservedBy[i] >= 0) continue;
         if (items[i].contentCount > 0) continue;  // Must be empty
-        if (items[i].state != ITEM_ON_GROUND && items[i].state != ITEM_IN_STOCKPILE) continue;
-        if ((int)items[i].z != mz) continue;
+        if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
+        if ((int)itemPosZ[i] != mz) continue;
 
-        int ix = (int)(items[i].x / CELL_SIZE);
-        int iy = (int)(items[i].y / CELL_SIZE);
+        int ix = (int)(itemPosX[i] / CELL_SIZE);
+        int iy = (int)(itemPosY[i] / CELL_SIZE);
         int dx = ix - mcx;
         int dy = iy - mcy;
         int distSq = dx * dx + dy * dy;
@@ -3252,7 +3268,7 @@ int WorkGiver_FillWaterPot(int moverIdx) {
     job->targetSlotX = slotX;
     job->targetSlotY = slotY;
 
-    items[bestPot].reservedBy = moverIdx;
+    itemReservedBy[bestPot] = moverIdx;
 
     // Reserve stockpile slot if we found one
     if (spIdx >= 0) {
@@ -3267,10 +3283,10 @@ int WorkGiver_FillWaterPot(int moverIdx) {
     m->currentJobId = jobId;
     RemoveMoverFromIdleList(moverIdx);
 
-    int potCellX = (int)(items[bestPot].x / CELL_SIZE);
-    int potCellY = (int)(items[bestPot].y / CELL_SIZE);
+    int potCellX = (int)(itemPosX[bestPot] / CELL_SIZE);
+    int potCellY = (int)(itemPosY[bestPot] / CELL_SIZE);
     m->goal = (Point){potCellX, potCellY, mz};
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     EventLog("WorkGiver_FillWaterPot: mover %d -> pot %d, water at (%d,%d)", moverIdx, bestPot, waterX, waterY);
     return jobId;
@@ -3323,7 +3339,7 @@ _Static_assert(sizeof(jobDrivers) / sizeof(jobDrivers[0]) > JOBTYPE_GATHER_REEDS
 void JobsTick(void) {
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) {
+        if (!moverActive[i]) {
             // Inactive mover - cancel any job they have to release reservations
             if (m->currentJobId >= 0) {
                 CancelJob(m, i);
@@ -3360,7 +3376,7 @@ void JobsTick(void) {
             // Job completed successfully - release job and return mover to idle
             ReleaseJob(m->currentJobId);
             m->currentJobId = -1;
-            m->needsRepath = false;
+            moverNeedsRepath[i] = false;
             m->timeWithoutProgress = 0.0f;
             // Clear stale transport state so next job starts fresh
             m->transportState = TRANSPORT_NONE;
@@ -3441,6 +3457,19 @@ void RemoveMoverFromIdleList(int moverIdx) {
     moverIsInIdleList[moverIdx] = false;
 }
 
+void RenumberIdleMoverList(const int* moverMap) {
+    if (!moverIsInIdleList) return;
+    memset(moverIsInIdleList, 0, idleMoverCapacity * sizeof(bool));
+    int kept = 0;
+    for (int i = 0; i < idleMoverCount; i++) {
+        int moverIdx = moverMap[idleMoverList[i]];
+        if (moverIdx < 0) continue;
+        idleMoverList[kept++] = moverIdx;
+        moverIsInIdleList[moverIdx] = true;
+    }
+    idleMoverCount = kept;
+}
+
 void RebuildIdleMoverList(void) {
     if (!moverIsInIdleList) return;
 
@@ -3448,7 +3477,7 @@ void RebuildIdleMoverList(void) {
     memset(moverIsInIdleList, 0, idleMoverCapacity * sizeof(bool));
 
     for (int i = 0; i < moverCount; i++) {
-        if (movers[i].active && movers[i].currentJobId < 0 && movers[i].freetimeState == FREETIME_NONE && !movers[i].isDrafted) {
+        if (moverActive[i] && movers[i].currentJobId < 0 && movers[i].freetimeState == FREETIME_NONE && !movers[i].isDrafted) {
             // Clear stale transport state on jobless movers
             if (movers[i].transportState != TRANSPORT_NONE && movers[i].currentJobId < 0) {
                 if (movers[i].transportState == TRANSPORT_WAITING && movers[i].transportStation >= 0) {
@@ -3460,9 +3489,9 @@ void RebuildIdleMoverList(void) {
                 movers[i].transportTrainIdx = -1;
             }
             // Skip movers stuck in unwalkable cells (e.g. built themselves into a wall)
-            int mx = (int)(movers[i].x / CELL_SIZE);
-            int my = (int)(movers[i].y / CELL_SIZE);
-            if (!IsCellWalkableAt((int)movers[i].z, my, mx)) continue;
+            int mx = (int)(moverPosX[i] / CELL_SIZE);
+            int my = (int)(moverPosY[i] / CELL_SIZE);
+            if (!IsCellWalkableAt((int)moverPosZ[i], my, mx)) continue;
 
             idleMoverList[idleMoverCount++] = i;
             moverIsInIdleList[i] = true;
@@ -3511,8 +3540,8 @@ static void IdleMoverSearchCallback(int moverIdx, float distSq, void* userData)
 }
 
 // Helper: clear item from source stockpile slot when re-hauling
-static void ClearSourceStockpileSlot(Item* item) {
-    RemoveItemFromStockpileSlot(item->x, item->y, (int)item->z);
+static void ClearSourceStockpileSlot(int itemIdx) {
+    RemoveItemFromStockpileSlot(itemPosX[itemIdx], itemPosY[itemIdx], (int)itemPosZ[itemIdx]);
 }
 
 // Extract item from container before pickup (instant, no work timer).
@@ -3527,10 +3556,11 @@ static void ExtractItemFromContainer(int itemIdx) {
 // Searches 8 neighbors (cardinal + diagonal) if mover position is not walkable
 // Wrapper: drop item near mover using shared SafeDropItem from items.c
 static void SafeDropItemNearMover(int itemIdx, Mover* m) {
-    SafeDropItem(itemIdx, m->x, m->y, (int)m->z);
+    int moverIdx = (int)(m - movers);
+    SafeDropItem(itemIdx, moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
     // Move container contents to the drop position
-    if (itemIdx >= 0 && itemIdx < MAX_ITEMS && items[itemIdx].active && items[itemIdx].contentCount > 0) {
-        MoveContainer(itemIdx, items[itemIdx].x, items[itemIdx].y, items[itemIdx].z);
+    if (itemIdx >= 0 && itemIdx < MAX_ITEMS && itemActive[itemIdx] && items[itemIdx].contentCount > 0) {
+        MoveContainer(itemIdx, itemPosX[itemIdx], itemPosY[itemIdx], itemPosZ[itemIdx]);
     }
 }
 
@@ -3553,16 +3583,16 @@ void CancelJob(void* moverPtr, int moverIdx) {
                 }
             }
             // Place mover at train position
-            m->x = t->x;
-            m->y = t->y;
-            m->z = (float)t->z;
+            moverPosX[moverIdx] = t->x;
+            moverPosY[moverIdx] = t->y;
+            moverPosZ[moverIdx] = (float)t->z;
         }
         m->goal = m->transportFinalGoal;
         m->transportState = TRANSPORT_NONE;
         m->transportStation = -1;
         m->transportExitStation = -1;
         m->transportTrainIdx = -1;
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     }
 
     // Get job data (all job-specific data now comes from Job struct)
@@ -3613,7 +3643,7 @@ void CancelJob(void* moverPtr, int moverIdx) {
             Blueprint* bp = &blueprints[job->targetBlueprint];
             if (bp->active) {
                 // Decrement reservedCount for the cancelled item's slot
-                // Note: don't check items[].active — item may have been deleted
+                // Note: don't check itemActive[] — item may have been deleted
                 // but reservedCount was incremented at job creation and must be balanced
                 if (job->targetItem >= 0) {
                     const ConstructionRecipe* recipe = GetConstructionRecipe(bp->recipeIndex);
@@ -3632,8 +3662,8 @@ void CancelJob(void* moverPtr, int moverIdx) {
                         if (!decremented) {
                             EventLog("WARNING: CancelJob bp %d slot reservedCount NOT decremented! item=%d type=%s active=%d",
                                      job->targetBlueprint, job->targetItem,
-                                     items[job->targetItem].active ? ItemName(itemType) : "DELETED",
-                                     items[job->targetItem].active);
+                                     itemActive[job->targetItem] ? ItemName(itemType) : "DELETED",
+                                     itemActive[job->targetItem]);
                         }
                     }
                 }
@@ -3649,38 +3679,38 @@ void CancelJob(void* moverPtr, int moverIdx) {
         }
 
         // Release second input item reservation (for multi-input craft jobs)
-        if (job->targetItem2 >= 0 && items[job->targetItem2].active) {
+        if (job->targetItem2 >= 0 && itemActive[job->targetItem2]) {
             // Only safe-drop if carried; otherwise just release reservation
-            if (items[job->targetItem2].state == ITEM_CARRIED) {
+            if (itemState[job->targetItem2] == ITEM_CARRIED) {
                 SafeDropItemNearMover(job->targetItem2, m);
             } else {
-                items[job->targetItem2].reservedBy = -1;
+                itemReservedBy[job->targetItem2] = -1;
             }
         }
 
         // Release third input item reservation (for tri-input craft jobs)
-        if (job->targetItem3 >= 0 && items[job->targetItem3].active) {
-            if (items[job->targetItem3].state == ITEM_CARRIED) {
+        if (job->targetItem3 >= 0 && itemActive[job->targetItem3]) {
+            if (itemState[job->targetItem3] == ITEM_CARRIED) {
                 SafeDropItemNearMover(job->targetItem3, m);
             } else {
-                items[job->targetItem3].reservedBy = -1;
+                itemReservedBy[job->targetItem3] = -1;
             }
         }
 
         // Release fuel item reservation (for craft jobs with fuel)
-        if (job->fuelItem >= 0 && items[job->fuelItem].active) {
+        if (job->fuelItem >= 0 && itemActive[job->fuelItem]) {
             // Only safe-drop if carried; otherwise just release reservation
-            if (items[job->fuelItem].state == ITEM_CARRIED) {
+            if (itemState[job->fuelItem] == ITEM_CARRIED) {
                 SafeDropItemNearMover(job->fuelItem, m);
             } else {
-                items[job->fuelItem].reservedBy = -1;
+                itemReservedBy[job->fuelItem] = -1;
             }
         }
 
         // Release tool item reservation (if mover hasn't picked it up yet)
-        if (job->toolItem >= 0 && items[job->toolItem].active) {
+        if (job->toolItem >= 0 && itemActive[job->toolItem]) {
             if (m->equippedTool != job->toolItem) {
-                items[job->toolItem].reservedBy = -1;
+                itemReservedBy[job->toolItem] = -1;
             }
         }
 
@@ -3711,7 +3741,7 @@ void CancelJob(void* moverPtr, int moverIdx) {
     // Reset mover state (only currentJobId remains - legacy fields removed)
     m->currentJobId = -1;
     ClearMoverPath(moverIdx);
-    m->needsRepath = false;
+    moverNeedsRepath[moverIdx] = false;
     m->timeWithoutProgress = 0.0f;
 
     // Add back to idle list
@@ -3763,7 +3793,7 @@ void UnassignJob(void* moverPtr, int moverIdx) {
         if (job->targetBlueprint >= 0 && job->targetBlueprint < MAX_BLUEPRINTS) {
             Blueprint* bp = &blueprints[job->targetBlueprint];
             if (bp->active) {
-                // Note: don't check items[].active — item may have been deleted
+                // Note: don't check itemActive[] — item may have been deleted
                 // but reservedCount was incremented at job creation and must be balanced
                 if (job->targetItem >= 0) {
                     const ConstructionRecipe* recipe = GetConstructionRecipe(bp->recipeIndex);
@@ -3782,8 +3812,8 @@ void UnassignJob(void* moverPtr, int moverIdx) {
                         if (!decremented) {
                             EventLog("WARNING: UnassignJob bp %d slot reservedCount NOT decremented! item=%d type=%s active=%d",
                                      job->targetBlueprint, job->targetItem,
-                                     items[job->targetItem].active ? ItemName(itemType) : "DELETED",
-                                     items[job->targetItem].active);
+                                     itemActive[job->targetItem] ? ItemName(itemType) : "DELETED",
+                                     itemActive[job->targetItem]);
                         }
                     }
                 }
@@ -3798,36 +3828,36 @@ void UnassignJob(void* moverPtr, int moverIdx) {
         }
 
         // Release second input item reservation
-        if (job->targetItem2 >= 0 && items[job->targetItem2].active) {
-            if (items[job->targetItem2].state == ITEM_CARRIED) {
+        if (job->targetItem2 >= 0 && itemActive[job->targetItem2]) {
+            if (itemState[job->targetItem2] == ITEM_CARRIED) {
                 SafeDropItemNearMover(job->targetItem2, m);
             } else {
-                items[job->targetItem2].reservedBy = -1;
+                itemReservedBy[job->targetItem2] = -1;
             }
         }
 
         // Release third input item reservation
-        if (job->targetItem3 >= 0 && items[job->targetItem3].active) {
-            if (items[job->targetItem3].state == ITEM_CARRIED) {
+        if (job->targetItem3 >= 0 && itemActive[job->targetItem3]) {
+            if (itemState[job->targetItem3] == ITEM_CARRIED) {
                 SafeDropItemNearMover(job->targetItem3, m);
             } else {
-                items[job->targetItem3].reservedBy = -1;
+                itemReservedBy[job->targetItem3] = -1;
             }
         }
 
         // Release fuel item reservation
-        if (job->fuelItem >= 0 && items[job->fuelItem].active) {
-            if (items[job->fuelItem].state == ITEM_CARRIED) {
+        if (job->fuelItem >= 0 && itemActive[job->fuelItem]) {
+            if (itemState[job->fuelItem] == ITEM_CARRIED) {
                 SafeDropItemNearMover(job->fuelItem, m);
             } else {
-                items[job->fuelItem].reservedBy = -1;
+                itemReservedBy[job->fuelItem] = -1;
             }
         }
 
         // Release tool item reservation (if mover hasn't picked it up yet)
-        if (job->toolItem >= 0 && items[job->toolItem].active) {
+        if (job->toolItem >= 0 && itemActive[job->toolItem]) {
             if (m->equippedTool != job->toolItem) {
-                items[job->toolItem].reservedBy = -1;
+                itemReservedBy[job->toolItem] = -1;
             }
         }
 
@@ -3854,7 +3884,7 @@ void UnassignJob(void* moverPtr, int moverIdx) {
     // Reset mover state
     m->currentJobId = -1;
     ClearMoverPath(moverIdx);
-    m->needsRepath = false;
+    moverNeedsRepath[moverIdx] = false;
     m->timeWithoutProgress = 0.0f;
 
     // Add back to idle list
@@ -3865,7 +3895,7 @@ void UnassignJob(void* moverPtr, int moverIdx) {
 // Returns true if assignment succeeded, false otherwise
 static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, bool safeDrop) {
     Item* item = &items[itemIdx];
-    Point itemCell = { (int)(item->x / CELL_SIZE), (int)(item->y / CELL_SIZE), (int)item->z };
+    Point itemCell = { (int)(itemPosX[itemIdx] / CELL_SIZE), (int)(itemPosY[itemIdx] / CELL_SIZE), (int)itemPosZ[itemIdx] };
 
     // Try up to 3 movers: if the nearest can't path, try the next-nearest.
     // Only set unreachableCooldown if ALL candidates fail.
@@ -3877,11 +3907,11 @@ static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, b
         int moverIdx = -1;
 
         // Use MoverSpatialGrid if available and built
-        if (moverGrid.cellCounts && moverGrid.cellStarts[moverGrid.cellCount] > 0) {
+        if (moverGrid.cellCounts && moverGrid.moverEntryCount > 0) {
             IdleMoverSearchContext ctx = {
-                .itemX = item->x,
-                .itemY = item->y,
-                .itemZ = (int)item->z,
+                .itemX = itemPosX[itemIdx],
+                .itemY = itemPosY[itemIdx],
+                .itemZ = (int)itemPosZ[itemIdx],
                 .bestMoverIdx = -1,
                 .bestDistSq = 1e30f,
                 .requireCanHaul = true,
@@ -3892,7 +3922,7 @@ static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, b
             };
             for (int e = 0; e < excludeCount; e++) ctx.excludeMovers[e] = excludeMovers[e];
 
-            QueryMoverNeighbors(item->x, item->y, MOVER_SEARCH_RADIUS, -1, IdleMoverSearchCallback, &ctx);
+            QueryMoverNeighbors(itemPosX[itemIdx], itemPosY[itemIdx], MOVER_SEARCH_RADIUS, -1, IdleMoverSearchCallback, &ctx);
             moverIdx = ctx.bestMoverIdx;
         } else {
             // Fallback: find nearest idle mover (for tests without spatial grid)
@@ -3906,8 +3936,8 @@ static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, b
                 }
                 if (excluded) continue;
                 if (!movers[idx].capabilities.canHaul) continue;
-                float dx = movers[idx].x - item->x;
-                float dy = movers[idx].y - item->y;
+                float dx = moverPosX[idx] - itemPosX[itemIdx];
+                float dy = moverPosY[idx] - itemPosY[itemIdx];
                 float distSq = dx * dx + dy * dy;
                 if (distSq < bestDistSq) {
                     bestDistSq = distSq;
@@ -3931,12 +3961,12 @@ static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, b
         }
 
         // Quick reachability check
-        Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+        Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
 
         PROFILE_ACCUM_BEGIN(Jobs_ReachabilityCheck);
         Point tempPath[MAX_PATH];
         PROFILE_COUNT(pathfinds, 1);
-        int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+        int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
         PROFILE_ACCUM_END(Jobs_ReachabilityCheck);
 
         if (tempLen == 0) {
@@ -3963,7 +3993,7 @@ static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, b
         }
 
         m->goal = itemCell;
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         RemoveMoverFromIdleList(moverIdx);
         return true;
     }
@@ -3991,17 +4021,18 @@ static bool TryAssignItemToMover(int itemIdx, int spIdx, int slotX, int slotY, b
 
 // Core haulability check — single source of truth for all haul paths.
 // Call sites add their own context-specific checks (z-level, type/material matching) after.
-static bool IsItemHaulable(Item* item, int itemIdx) {
-    (void)itemIdx;
-    if (!item->active) return false;
-    if (item->reservedBy != -1) return false;
-    if (item->state != ITEM_ON_GROUND) return false;
-    if (item->unreachableCooldown > 0.0f) return false;
-    if (!ItemTypeIsValidForJobs(item->type)) return false;
-    if (!IsItemInGatherZone(item->x, item->y, (int)item->z)) return false;
-    int cellX = (int)(item->x / CELL_SIZE);
-    int cellY = (int)(item->y / CELL_SIZE);
-    int cellZ = (int)(item->z);
+// The hot-array checks come first, so most candidates are rejected without
+// touching the Item struct.
+static bool IsItemHaulable(int itemIdx) {
+    if (!itemActive[itemIdx]) return false;
+    if (itemReservedBy[itemIdx] != -1) return false;
+    if (itemState[itemIdx] != ITEM_ON_GROUND) return false;
+    if (itemUnreachableCooldown[itemIdx] > 0.0f) return false;
+    if (!ItemTypeIsValidForJobs(items[itemIdx].type)) return false;
+    if (!IsItemInGatherZone(itemPosX[itemIdx], itemPosY[itemIdx], (int)itemPosZ[itemIdx])) return false;
+    int cellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+    int cellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+    int cellZ = (int)(itemPosZ[itemIdx]);
     if (!IsCellWalkableAt(cellZ, cellY, cellX)) return false;
     if (!IsExplored(cellX, cellY, cellZ)) return false;
     if (IsPassiveWorkshopWorkTile(cellX, cellY, cellZ)) return false;
@@ -4018,15 +4049,15 @@ static void AssignJobs_P1_StockpileMaintenance(void) {
         bool absorb = false;
         int itemIdx = FindGroundItemOnStockpile(&spOnItem, &absorb);
 
-        if (itemIdx < 0 || items[itemIdx].unreachableCooldown > 0.0f) break;
+        if (itemIdx < 0 || itemUnreachableCooldown[itemIdx] > 0.0f) break;
 
         int slotX, slotY, spIdx;
         bool safeDrop = false;
 
         if (absorb) {
             spIdx = spOnItem;
-            slotX = (int)(items[itemIdx].x / CELL_SIZE);
-            slotY = (int)(items[itemIdx].y / CELL_SIZE);
+            slotX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+            slotY = (int)(itemPosY[itemIdx] / CELL_SIZE);
 
             Stockpile* sp = &stockpiles[spOnItem];
             int lx = slotX - sp->x;
@@ -4142,7 +4173,7 @@ static void AssignJobs_P3_ItemHaul(bool typeMatHasStockpile[][MAT_COUNT]) {
             int itemIdx = itemGrid.itemIndices[t];
             Item* item = &items[itemIdx];
 
-            if (!IsItemHaulable(item, itemIdx)) continue;
+            if (!IsItemHaulable(itemIdx)) continue;
             uint8_t mat = ResolveItemMaterialForJobs(item);
             if (!typeMatHasStockpile[item->type][mat]) continue;
 
@@ -4158,7 +4189,7 @@ static void AssignJobs_P3_ItemHaul(bool typeMatHasStockpile[][MAT_COUNT]) {
         for (int j = 0; j < itemHighWaterMark && idleMoverCount > 0; j++) {
             Item* item = &items[j];
 
-            if (!IsItemHaulable(item, j)) continue;
+            if (!IsItemHaulable(j)) continue;
             uint8_t mat = ResolveItemMaterialForJobs(item);
             if (!typeMatHasStockpile[item->type][mat]) continue;
 
@@ -4175,16 +4206,16 @@ static void AssignJobs_P3_ItemHaul(bool typeMatHasStockpile[][MAT_COUNT]) {
 __attribute__((noinline))
 static void AssignJobs_P3c_Rehaul(void) {
     for (int j = 0; j < itemHighWaterMark && idleMoverCount > 0; j++) {
-        if (!items[j].active) continue;
-        if (items[j].reservedBy != -1) continue;
-        if (items[j].state != ITEM_IN_STOCKPILE) continue;
+        if (!itemActive[j]) continue;
+        if (itemReservedBy[j] != -1) continue;
+        if (itemState[j] != ITEM_IN_STOCKPILE) continue;
 
         int currentSp = -1;
-        if (!IsPositionInStockpile(items[j].x, items[j].y, (int)items[j].z, &currentSp)) continue;
+        if (!IsPositionInStockpile(itemPosX[j], itemPosY[j], (int)itemPosZ[j], &currentSp)) continue;
         if (currentSp < 0) continue;
 
-        int itemSlotX = (int)(items[j].x / CELL_SIZE);
-        int itemSlotY = (int)(items[j].y / CELL_SIZE);
+        int itemSlotX = (int)(itemPosX[j] / CELL_SIZE);
+        int itemSlotY = (int)(itemPosY[j] / CELL_SIZE);
 
         int destSlotX, destSlotY;
         int destSp = -1;
@@ -4224,7 +4255,7 @@ static void AssignJobs_P3c_Rehaul(void) {
                     haulItemIdx = SplitStack(j, excess);
                     if (haulItemIdx < 0) continue;
                     // Split item is separate from stockpile — mark as ground item
-                    items[haulItemIdx].state = ITEM_ON_GROUND;
+                    SetItemState(haulItemIdx, ITEM_ON_GROUND);
                     // Update source slot count after split
                     sp->slotCounts[slotIdx] = items[j].stackCount;
                 }
@@ -4254,14 +4285,14 @@ static void AssignJobs_P3e_ContainerCleanup(void) {
         for (int slotIdx = 0; slotIdx < totalSlots && idleMoverCount > 0; slotIdx++) {
             if (!sp->slotIsContainer[slotIdx]) continue;
             int containerIdx = sp->slots[slotIdx];
-            if (containerIdx < 0 || !items[containerIdx].active) continue;
+            if (containerIdx < 0 || !itemActive[containerIdx]) continue;
             if (items[containerIdx].contentCount == 0) continue;
 
             // Scan items contained in this container
             for (int j = 0; j < itemHighWaterMark && idleMoverCount > 0; j++) {
-                if (!items[j].active) continue;
+                if (!itemActive[j]) continue;
                 if (items[j].containedIn != containerIdx) continue;
-                if (items[j].reservedBy != -1) continue;
+                if (itemReservedBy[j] != -1) continue;
 
                 bool illegal = !StockpileAcceptsItem(spIdx, items[j].type, items[j].material)
                     || (sp->rejectsRotten && items[j].condition == CONDITION_ROTTEN);
@@ -4290,16 +4321,16 @@ static void AssignJobs_P3d_Consolidate(void) {
         if (!stockpiles[spIdx].active) continue;
         
         for (int j = 0; j < itemHighWaterMark; j++) {
-            if (!items[j].active) continue;
-            if (items[j].reservedBy != -1) continue;
-            if (items[j].state != ITEM_IN_STOCKPILE) continue;
+            if (!itemActive[j]) continue;
+            if (itemReservedBy[j] != -1) continue;
+            if (itemState[j] != ITEM_IN_STOCKPILE) continue;
             
             int itemSp = -1;
-            if (!IsPositionInStockpile(items[j].x, items[j].y, (int)items[j].z, &itemSp)) continue;
+            if (!IsPositionInStockpile(itemPosX[j], itemPosY[j], (int)itemPosZ[j], &itemSp)) continue;
             if (itemSp != spIdx) continue;
             
-            int itemSlotX = (int)(items[j].x / CELL_SIZE);
-            int itemSlotY = (int)(items[j].y / CELL_SIZE);
+            int itemSlotX = (int)(itemPosX[j] / CELL_SIZE);
+            int itemSlotY = (int)(itemPosY[j] / CELL_SIZE);
             
             int destSlotX, destSlotY;
             if (FindConsolidationTarget(spIdx, itemSlotX, itemSlotY, &destSlotX, &destSlotY)) {
@@ -4461,10 +4492,10 @@ void AssignJobs(void) {
         // Quick pre-check: any unreserved clothing items on ground/stockpile?
         bool anyClothing = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (!ItemIsClothing(items[i].type)) continue;
-            if (items[i].reservedBy >= 0) continue;
-            if (items[i].state != ITEM_ON_GROUND && items[i].state != ITEM_IN_STOCKPILE) continue;
+            if (itemReservedBy[i] >= 0) continue;
+            if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
             anyClothing = true;
             break;
         }
@@ -4538,10 +4569,10 @@ void AssignJobs(void) {
         // Pre-check: any unreserved water items? (one scan, shared across all movers)
         bool anyWaterItems = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type != ITEM_WATER) continue;
-            if (items[i].reservedBy != -1) continue;
-            if (items[i].state != ITEM_ON_GROUND && items[i].state != ITEM_IN_STOCKPILE) continue;
+            if (itemReservedBy[i] != -1) continue;
+            if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
             anyWaterItems = true;
             break;
         }
@@ -4583,7 +4614,7 @@ typedef struct {
 static bool HaulItemFilter(int itemIdx, void* userData) {
     HaulFilterContext* ctx = (HaulFilterContext*)userData;
     Item* item = &items[itemIdx];
-    if (!IsItemHaulable(item, itemIdx)) return false;
+    if (!IsItemHaulable(itemIdx)) return false;
     uint8_t mat = ResolveItemMaterialForJobs(item);
     if (!ctx->typeMatHasStockpile[item->type][mat]) return false;
     return true;
@@ -4627,9 +4658,9 @@ int WorkGiver_Haul(int moverIdx) {
         if (!anyTypeHasSlot) return -1;
     }
 
-    int moverTileX = (int)(m->x / CELL_SIZE);
-    int moverTileY = (int)(m->y / CELL_SIZE);
-    int moverZ = (int)m->z;
+    int moverTileX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int moverTileY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int moverZ = (int)moverPosZ[moverIdx];
 
     int bestItemIdx = -1;
 
@@ -4650,12 +4681,12 @@ int WorkGiver_Haul(int moverIdx) {
         float bestDistSq = 1e30f;
         for (int j = 0; j < itemHighWaterMark; j++) {
             Item* item = &items[j];
-            if (!IsItemHaulable(item, j)) continue;
+            if (!IsItemHaulable(j)) continue;
             uint8_t mat = ResolveItemMaterialForJobs(item);
             if (!typeMatHasStockpile[item->type][mat]) continue;
 
-            float dx = item->x - m->x;
-            float dy = item->y - m->y;
+            float dx = itemPosX[j] - moverPosX[moverIdx];
+            float dy = itemPosY[j] - moverPosY[moverIdx];
             float distSq = dx * dx + dy * dy;
             if (distSq < bestDistSq) {
                 bestDistSq = distSq;
@@ -4674,12 +4705,12 @@ int WorkGiver_Haul(int moverIdx) {
     if (spIdx < 0) return -1;
 
     // Check reachability
-    Point itemCell = { (int)(item->x / CELL_SIZE), (int)(item->y / CELL_SIZE), (int)item->z };
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point itemCell = { (int)(itemPosX[bestItemIdx] / CELL_SIZE), (int)(itemPosY[bestItemIdx] / CELL_SIZE), (int)itemPosZ[bestItemIdx] };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
 
     Point tempPath[MAX_PATH];
     PROFILE_COUNT(pathfinds, 1);
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
     if (tempLen == 0) {
         SetItemUnreachableCooldown(bestItemIdx, UNREACHABLE_COOLDOWN);
         return -1;
@@ -4711,7 +4742,7 @@ int WorkGiver_Haul(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = itemCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -4724,6 +4755,7 @@ int WorkGiver_Haul(int moverIdx) {
 
 JobRunResult RunJob_Knap(Job* job, void* moverPtr, float dt) {
     Mover* mover = (Mover*)moverPtr;
+    int moverIdx = (int)(mover - movers);
     int tx = job->targetMineX, ty = job->targetMineY, tz = job->targetMineZ;
     Designation* d = GetDesignation(tx, ty, tz);
     if (!d || d->type != DESIGNATION_KNAP) return JOBRUN_FAIL;
@@ -4748,9 +4780,9 @@ JobRunResult RunJob_Knap(Job* job, void* moverPtr, float dt) {
         if (r == JOBRUN_DONE) {
             MaterialType wallMat = GetWallMaterial(tx, ty, tz);
             int itemIdx = job->carryingItem;
-            if (itemIdx >= 0 && items[itemIdx].active) DeleteItem(itemIdx);
+            if (itemIdx >= 0 && itemActive[itemIdx]) DeleteItem(itemIdx);
             job->carryingItem = -1;
-            SpawnItemWithMaterial(mover->x, mover->y, mover->z, ITEM_SHARP_STONE, (uint8_t)wallMat);
+            SpawnItemWithMaterial(moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx], ITEM_SHARP_STONE, (uint8_t)wallMat);
             CompleteKnapDesignation(tx, ty, tz, job->assignedMover);
         }
         return r;
@@ -4776,8 +4808,8 @@ static int WorkGiver_KnapDesignation(int moverIdx) {
 
         float tileX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDesigDistSq) {
@@ -4798,17 +4830,17 @@ static int WorkGiver_KnapDesignation(int moverIdx) {
 
     for (int j = 0; j < itemHighWaterMark; j++) {
         Item* item = &items[j];
-        if (!item->active) continue;
+        if (!itemActive[j]) continue;
         if (item->type != ITEM_ROCK) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
-        if (item->unreachableCooldown > 0.0f) continue;
-        int ix = (int)(item->x / CELL_SIZE);
-        int iy = (int)(item->y / CELL_SIZE);
-        if (!IsExplored(ix, iy, (int)item->z)) continue;
-
-        float dx = item->x - m->x;
-        float dy = item->y - m->y;
+        if (itemReservedBy[j] != -1) continue;
+        if (itemState[j] != ITEM_ON_GROUND && itemState[j] != ITEM_IN_STOCKPILE) continue;
+        if (itemUnreachableCooldown[j] > 0.0f) continue;
+        int ix = (int)(itemPosX[j] / CELL_SIZE);
+        int iy = (int)(itemPosY[j] / CELL_SIZE);
+        if (!IsExplored(ix, iy, (int)itemPosZ[j])) continue;
+
+        float dx = itemPosX[j] - moverPosX[moverIdx];
+        float dy = itemPosY[j] - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestItemDistSq) {
@@ -4820,18 +4852,17 @@ static int WorkGiver_KnapDesignation(int moverIdx) {
     if (bestItemIdx < 0) return -1;
 
     // Check reachability to item
-    Item* item = &items[bestItemIdx];
-    int itemCellX = (int)(item->x / CELL_SIZE);
-    int itemCellY = (int)(item->y / CELL_SIZE);
-    int itemCellZ = (int)item->z;
+    int itemCellX = (int)(itemPosX[bestItemIdx] / CELL_SIZE);
+    int itemCellY = (int)(itemPosY[bestItemIdx] / CELL_SIZE);
+    int itemCellZ = (int)itemPosZ[bestItemIdx];
     if (!IsCellWalkableAt(itemCellZ, itemCellY, itemCellX)) {
         SetItemUnreachableCooldown(bestItemIdx, UNREACHABLE_COOLDOWN);
         return -1;
     }
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point itemCell = { itemCellX, itemCellY, itemCellZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         SetItemUnreachableCooldown(bestItemIdx, UNREACHABLE_COOLDOWN);
         return -1;
@@ -4839,7 +4870,7 @@ static int WorkGiver_KnapDesignation(int moverIdx) {
 
     // Check reachability from item to adjacent tile
     Point adjCell = { bestAdjX, bestAdjY, bestDesigZ };
-    tempLen = FindPath(moverPathAlgorithm, itemCell, adjCell, tempPath, MAX_PATH);
+    tempLen = ProbePathLength(moverPathAlgorithm, itemCell, adjCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -4875,7 +4906,7 @@ static int WorkGiver_KnapDesignation(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ itemCellX, itemCellY, itemCellZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -4905,8 +4936,8 @@ static int WorkGiver_DigRootsDesignation(int moverIdx) {
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -4919,10 +4950,10 @@ static int WorkGiver_DigRootsDesignation(int moverIdx) {
 
     if (bestDesigX < 0) return -1;
 
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestDesigX, bestDesigY, bestDesigZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -4945,7 +4976,7 @@ static int WorkGiver_DigRootsDesignation(int moverIdx) {
 
     m->currentJobId = jobId;
     m->goal = (Point){ bestDesigX, bestDesigY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -4972,12 +5003,12 @@ static int WorkGiver_ExploreDesignation(int moverIdx) {
         if (d->unreachableCooldown > 0.0f) continue;
 
         // Only same z-level
-        if (entry->z != (int)m->z) continue;
+        if (entry->z != (int)moverPosZ[moverIdx]) continue;
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -5035,8 +5066,8 @@ static int WorkGiver_TillDesignation(int moverIdx) {
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -5047,10 +5078,10 @@ static int WorkGiver_TillDesignation(int moverIdx) {
     }
     if (bestX < 0) return -1;
 
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestX, bestY, bestZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestX, bestY, bestZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -5073,7 +5104,7 @@ static int WorkGiver_TillDesignation(int moverIdx) {
 
     m->currentJobId = jobId;
     m->goal = (Point){ bestX, bestY, bestZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
     RemoveMoverFromIdleList(moverIdx);
     return jobId;
 }
@@ -5190,8 +5221,8 @@ int WorkGiver_TendCrop(int moverIdx) {
         int x = farmCacheWeedy[i].x, y = farmCacheWeedy[i].y, z = farmCacheWeedy[i].z;
         float tileX = x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -5209,10 +5240,10 @@ int WorkGiver_TendCrop(int moverIdx) {
         }
     }
 
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestX, bestY, bestZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) return -1;
 
     int jobId = CreateJob(JOBTYPE_TEND_CROP);
@@ -5228,7 +5259,7 @@ int WorkGiver_TendCrop(int moverIdx) {
 
     m->currentJobId = jobId;
     m->goal = (Point){ bestX, bestY, bestZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
     RemoveMoverFromIdleList(moverIdx);
     return jobId;
 }
@@ -5244,12 +5275,12 @@ int WorkGiver_Fertilize(int moverIdx) {
     float bestCompostDistSq = 1e30f;
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
+        if (!itemActive[i]) continue;
         if (item->type != ITEM_COMPOST) continue;
-        if (item->state != ITEM_ON_GROUND) continue;
-        if (item->reservedBy != -1) continue;
-        float dx = item->x - m->x;
-        float dy = item->y - m->y;
+        if (itemState[i] != ITEM_ON_GROUND) continue;
+        if (itemReservedBy[i] != -1) continue;
+        float dx = itemPosX[i] - moverPosX[moverIdx];
+        float dy = itemPosY[i] - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestCompostDistSq) {
             bestCompostDistSq = distSq;
@@ -5265,8 +5296,8 @@ int WorkGiver_Fertilize(int moverIdx) {
         int x = farmCacheLowFertility[i].x, y = farmCacheLowFertility[i].y, z = farmCacheLowFertility[i].z;
         float tileX = x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -5304,10 +5335,10 @@ int WorkGiver_Fertilize(int moverIdx) {
     job->carryingItem = -1;
 
     m->currentJobId = jobId;
-    m->goal = (Point){ (int)(items[bestCompostIdx].x / CELL_SIZE),
-                        (int)(items[bestCompostIdx].y / CELL_SIZE),
-                        (int)items[bestCompostIdx].z };
-    m->needsRepath = true;
+    m->goal = (Point){ (int)(itemPosX[bestCompostIdx] / CELL_SIZE),
+                        (int)(itemPosY[bestCompostIdx] / CELL_SIZE),
+                        (int)itemPosZ[bestCompostIdx] };
+    moverNeedsRepath[moverIdx] = true;
     RemoveMoverFromIdleList(moverIdx);
     return jobId;
 }
@@ -5325,8 +5356,8 @@ int WorkGiver_WaterCrop(int moverIdx) {
         int x = farmCacheDry[i].x, y = farmCacheDry[i].y, z = farmCacheDry[i].z;
         float tileX = x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -5349,12 +5380,12 @@ int WorkGiver_WaterCrop(int moverIdx) {
     float bestWaterDistSq = 1e30f;
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
+        if (!itemActive[i]) continue;
         if (item->type != ITEM_WATER) continue;
-        if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
-        if (item->reservedBy != -1) continue;
-        float dx = item->x - m->x;
-        float dy = item->y - m->y;
+        if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
+        if (itemReservedBy[i] != -1) continue;
+        float dx = itemPosX[i] - moverPosX[moverIdx];
+        float dy = itemPosY[i] - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestWaterDistSq) {
             bestWaterDistSq = distSq;
@@ -5383,10 +5414,10 @@ int WorkGiver_WaterCrop(int moverIdx) {
     job->carryingItem = -1;
 
     m->currentJobId = jobId;
-    m->goal = (Point){ (int)(items[bestWaterIdx].x / CELL_SIZE),
-                        (int)(items[bestWaterIdx].y / CELL_SIZE),
-                        (int)items[bestWaterIdx].z };
-    m->needsRepath = true;
+    m->goal = (Point){ (int)(itemPosX[bestWaterIdx] / CELL_SIZE),
+                        (int)(itemPosY[bestWaterIdx] / CELL_SIZE),
+                        (int)itemPosZ[bestWaterIdx] };
+    moverNeedsRepath[moverIdx] = true;
     RemoveMoverFromIdleList(moverIdx);
     return jobId;
 }
@@ -5407,8 +5438,8 @@ int WorkGiver_PlantCrop(int moverIdx) {
         FarmCell* fc = &farmGrid[z][y][x];
         float tileX = x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -5435,12 +5466,12 @@ int WorkGiver_PlantCrop(int moverIdx) {
     float bestSeedDistSq = 1e30f;
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
+        if (!itemActive[i]) continue;
         if (item->type != seedType) continue;
-        if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
-        if (item->reservedBy != -1) continue;
-        float dx = item->x - m->x;
-        float dy = item->y - m->y;
+        if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
+        if (itemReservedBy[i] != -1) continue;
+        float dx = itemPosX[i] - moverPosX[moverIdx];
+        float dy = itemPosY[i] - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestSeedDistSq) {
             bestSeedDistSq = distSq;
@@ -5469,10 +5500,10 @@ int WorkGiver_PlantCrop(int moverIdx) {
     job->carryingItem = -1;
 
     m->currentJobId = jobId;
-    m->goal = (Point){ (int)(items[bestSeedIdx].x / CELL_SIZE),
-                        (int)(items[bestSeedIdx].y / CELL_SIZE),
-                        (int)items[bestSeedIdx].z };
-    m->needsRepath = true;
+    m->goal = (Point){ (int)(itemPosX[bestSeedIdx] / CELL_SIZE),
+                        (int)(itemPosY[bestSeedIdx] / CELL_SIZE),
+                        (int)itemPosZ[bestSeedIdx] };
+    moverNeedsRepath[moverIdx] = true;
     RemoveMoverFromIdleList(moverIdx);
     return jobId;
 }
@@ -5490,8 +5521,8 @@ int WorkGiver_HarvestCrop(int moverIdx) {
         int x = farmCacheRipe[i].x, y = farmCacheRipe[i].y, z = farmCacheRipe[i].z;
         float tileX = x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -5509,10 +5540,10 @@ int WorkGiver_HarvestCrop(int moverIdx) {
         }
     }
 
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestX, bestY, bestZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) return -1;
 
     int jobId = CreateJob(JOBTYPE_HARVEST_CROP);
@@ -5528,7 +5559,7 @@ int WorkGiver_HarvestCrop(int moverIdx) {
 
     m->currentJobId = jobId;
     m->goal = (Point){ bestX, bestY, bestZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
     RemoveMoverFromIdleList(moverIdx);
     return jobId;
 }
@@ -5549,8 +5580,8 @@ int WorkGiver_DeconstructWorkshop(int moverIdx) {
 
         float wx = ws->workTileX * CELL_SIZE + CELL_SIZE * 0.5f;
         float wy = ws->workTileY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = wx - m->x;
-        float dy = wy - m->y;
+        float dx = wx - moverPosX[moverIdx];
+        float dy = wy - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestDistSq) {
@@ -5564,11 +5595,11 @@ int WorkGiver_DeconstructWorkshop(int moverIdx) {
     Workshop* ws = &workshops[bestWsIdx];
 
     // Check reachability to work tile
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point goalCell = { ws->workTileX, ws->workTileY, ws->z };
 
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, goalCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, goalCell, tempPath, MAX_PATH);
     if (tempLen == 0) return -1;
 
     // Get deconstruct time = half build time
@@ -5600,7 +5631,7 @@ int WorkGiver_DeconstructWorkshop(int moverIdx) {
 
     m->currentJobId = jobId;
     m->goal = goalCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -5617,7 +5648,7 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
 
     if (!m->capabilities.canHaul) return -1;
 
-    int moverZ = (int)m->z;
+    int moverZ = (int)moverPosZ[moverIdx];
 
     // Scan passive workshops for one with a runnable bill that needs input
     for (int w = 0; w < MAX_WORKSHOPS; w++) {
@@ -5644,21 +5675,21 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
         int inputOnTile = 0;
         for (int j = 0; j < itemHighWaterMark; j++) {
             Item* item = &items[j];
-            if (!item->active) continue;
+            if (!itemActive[j]) continue;
             if (!RecipeInputMatches(recipe, item)) continue;
 
             // Item already on work tile — count stackCount
-            int ix = (int)(item->x / CELL_SIZE);
-            int iy = (int)(item->y / CELL_SIZE);
-            if (ix == ws->workTileX && iy == ws->workTileY && (int)item->z == ws->z &&
-                item->state == ITEM_ON_GROUND) {
+            int ix = (int)(itemPosX[j] / CELL_SIZE);
+            int iy = (int)(itemPosY[j] / CELL_SIZE);
+            if (ix == ws->workTileX && iy == ws->workTileY && (int)itemPosZ[j] == ws->z &&
+                itemState[j] == ITEM_ON_GROUND) {
                 inputOnTile += item->stackCount;
             }
 
             // Item reserved for delivery to this workshop (being fetched or carried)
             // Count as 1 unit per delivery job (movers carry 1 at a time)
-            if (item->reservedBy >= 0 && item->reservedBy < moverCount) {
-                Mover* carrier = &movers[item->reservedBy];
+            if (itemReservedBy[j] >= 0 && itemReservedBy[j] < moverCount) {
+                Mover* carrier = &movers[itemReservedBy[j]];
                 if (carrier->currentJobId >= 0) {
                     Job* cjob = GetJob(carrier->currentJobId);
                     if (cjob && cjob->type == JOBTYPE_DELIVER_TO_WORKSHOP &&
@@ -5678,25 +5709,25 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
 
         for (int j = 0; j < itemHighWaterMark; j++) {
             Item* item = &items[j];
-            if (!item->active) continue;
-            if (item->reservedBy != -1) continue;
-            if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
-            if (item->unreachableCooldown > 0.0f) continue;
+            if (!itemActive[j]) continue;
+            if (itemReservedBy[j] != -1) continue;
+            if (itemState[j] != ITEM_ON_GROUND && itemState[j] != ITEM_IN_STOCKPILE) continue;
+            if (itemUnreachableCooldown[j] > 0.0f) continue;
             if (!RecipeInputMatches(recipe, item)) continue;
 
-            int cellX = (int)(item->x / CELL_SIZE);
-            int cellY = (int)(item->y / CELL_SIZE);
-            if (!IsCellWalkableAt((int)item->z, cellY, cellX)) continue;
-            if (!IsExplored(cellX, cellY, (int)item->z)) continue;
+            int cellX = (int)(itemPosX[j] / CELL_SIZE);
+            int cellY = (int)(itemPosY[j] / CELL_SIZE);
+            if (!IsCellWalkableAt((int)itemPosZ[j], cellY, cellX)) continue;
+            if (!IsExplored(cellX, cellY, (int)itemPosZ[j])) continue;
 
             // Skip items on passive workshop work tiles (they're in use or waiting for ignition)
-            if (IsPassiveWorkshopWorkTile(cellX, cellY, (int)item->z)) continue;
+            if (IsPassiveWorkshopWorkTile(cellX, cellY, (int)itemPosZ[j])) continue;
 
             // Skip items already on the work tile — they're already delivered
-            if (cellX == ws->workTileX && cellY == ws->workTileY && (int)item->z == ws->z) continue;
+            if (cellX == ws->workTileX && cellY == ws->workTileY && (int)itemPosZ[j] == ws->z) continue;
 
-            float dx = item->x - m->x;
-            float dy = item->y - m->y;
+            float dx = itemPosX[j] - moverPosX[moverIdx];
+            float dy = itemPosY[j] - moverPosY[moverIdx];
             float distSq = dx * dx + dy * dy;
             if (distSq < bestDistSq) {
                 bestDistSq = distSq;
@@ -5707,8 +5738,8 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
         // Fallback: search inside containers
         if (bestItemIdx < 0 && recipe->inputItemMatch != ITEM_MATCH_ANY_FUEL) {
             int containerIdx = -1;
-            int moverTileX = (int)(m->x / CELL_SIZE);
-            int moverTileY = (int)(m->y / CELL_SIZE);
+            int moverTileX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+            int moverTileY = (int)(moverPosY[moverIdx] / CELL_SIZE);
             bestItemIdx = FindItemInContainers(recipe->inputType, moverZ, moverTileX, moverTileY,
                                                100, -1, NULL, NULL, &containerIdx);
         }
@@ -5716,11 +5747,11 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
         if (bestItemIdx < 0) continue;
 
         // Check reachability
-        Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), moverZ };
-        Point itemCell = { (int)(items[bestItemIdx].x / CELL_SIZE),
-                           (int)(items[bestItemIdx].y / CELL_SIZE), moverZ };
+        Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), moverZ };
+        Point itemCell = { (int)(itemPosX[bestItemIdx] / CELL_SIZE),
+                           (int)(itemPosY[bestItemIdx] / CELL_SIZE), moverZ };
         Point tempPath[MAX_PATH];
-        int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+        int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
         if (tempLen == 0) {
             SetItemUnreachableCooldown(bestItemIdx, UNREACHABLE_COOLDOWN);
             continue;
@@ -5745,7 +5776,7 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
 
         m->currentJobId = jobId;
         m->goal = itemCell;
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
 
         RemoveMoverFromIdleList(moverIdx);
 
@@ -5759,7 +5790,7 @@ int WorkGiver_DeliverToPassiveWorkshop(int moverIdx) {
 // Returns job ID if successful, -1 if no job available
 int WorkGiver_IgniteWorkshop(int moverIdx) {
     Mover* m = &movers[moverIdx];
-    int moverZ = (int)m->z;
+    int moverZ = (int)moverPosZ[moverIdx];
 
     for (int w = 0; w < MAX_WORKSHOPS; w++) {
         Workshop* ws = &workshops[w];
@@ -5789,10 +5820,10 @@ int WorkGiver_IgniteWorkshop(int moverIdx) {
         int inputCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
             Item* item = &items[i];
-            if (!item->active) continue;
-            if (item->state != ITEM_ON_GROUND) continue;
-            int tileX = (int)(item->x / CELL_SIZE);
-            int tileY = (int)(item->y / CELL_SIZE);
+            if (!itemActive[i]) continue;
+            if (itemState[i] != ITEM_ON_GROUND) continue;
+            int tileX = (int)(itemPosX[i] / CELL_SIZE);
+            int tileY = (int)(itemPosY[i] / CELL_SIZE);
             if (tileX != ws->workTileX || tileY != ws->workTileY) continue;
             if (!RecipeInputMatches(recipe, item)) continue;
             inputCount++;
@@ -5801,10 +5832,10 @@ int WorkGiver_IgniteWorkshop(int moverIdx) {
         if (inputCount < recipe->inputCount) continue;
 
         // Check reachability
-        Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), moverZ };
+        Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), moverZ };
         Point workCell = { ws->workTileX, ws->workTileY, ws->z };
         Point tempPath[MAX_PATH];
-        int tempLen = FindPath(moverPathAlgorithm, moverCell, workCell, tempPath, MAX_PATH);
+        int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, workCell, tempPath, MAX_PATH);
         if (tempLen == 0) continue;
 
         // Create job
@@ -5823,7 +5854,7 @@ int WorkGiver_IgniteWorkshop(int moverIdx) {
 
         m->currentJobId = jobId;
         m->goal = workCell;
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
 
         RemoveMoverFromIdleList(moverIdx);
 
@@ -5863,8 +5894,8 @@ int WorkGiver_GatherSapling(int moverIdx) {
         // Distance to adjacent tile (already cached)
         float adjPosX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
         float adjPosY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = adjPosX - m->x;
-        float distY = adjPosY - m->y;
+        float distX = adjPosX - moverPosX[moverIdx];
+        float distY = adjPosY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -5880,7 +5911,7 @@ int WorkGiver_GatherSapling(int moverIdx) {
     if (bestDesigX < 0) return -1;
 
     // Check reachability
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -5908,7 +5939,7 @@ int WorkGiver_GatherSapling(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -5940,8 +5971,8 @@ int WorkGiver_PlantSapling(int moverIdx) {
         // Distance to designation
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDesigDistSq) {
@@ -5960,17 +5991,17 @@ int WorkGiver_PlantSapling(int moverIdx) {
 
     for (int j = 0; j < itemHighWaterMark; j++) {
         Item* item = &items[j];
-        if (!item->active) continue;
+        if (!itemActive[j]) continue;
         if (!IsSaplingItem(item->type)) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
-        if (item->unreachableCooldown > 0.0f) continue;
-        int ix = (int)(item->x / CELL_SIZE);
-        int iy = (int)(item->y / CELL_SIZE);
-        if (!IsExplored(ix, iy, (int)item->z)) continue;
-
-        float dx = item->x - m->x;
-        float dy = item->y - m->y;
+        if (itemReservedBy[j] != -1) continue;
+        if (itemState[j] != ITEM_ON_GROUND && itemState[j] != ITEM_IN_STOCKPILE) continue;
+        if (itemUnreachableCooldown[j] > 0.0f) continue;
+        int ix = (int)(itemPosX[j] / CELL_SIZE);
+        int iy = (int)(itemPosY[j] / CELL_SIZE);
+        if (!IsExplored(ix, iy, (int)itemPosZ[j])) continue;
+
+        float dx = itemPosX[j] - moverPosX[moverIdx];
+        float dy = itemPosY[j] - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestItemDistSq) {
@@ -5982,14 +6013,13 @@ int WorkGiver_PlantSapling(int moverIdx) {
     if (bestItemIdx < 0) return -1;
 
     // Check reachability to item
-    Item* item = &items[bestItemIdx];
-    int itemCellX = (int)(item->x / CELL_SIZE);
-    int itemCellY = (int)(item->y / CELL_SIZE);
-    int itemCellZ = (int)item->z;
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    int itemCellX = (int)(itemPosX[bestItemIdx] / CELL_SIZE);
+    int itemCellY = (int)(itemPosY[bestItemIdx] / CELL_SIZE);
+    int itemCellZ = (int)itemPosZ[bestItemIdx];
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point itemCell = { itemCellX, itemCellY, itemCellZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         SetItemUnreachableCooldown(bestItemIdx, UNREACHABLE_COOLDOWN);
         return -1;
@@ -5997,7 +6027,7 @@ int WorkGiver_PlantSapling(int moverIdx) {
 
     // Check reachability to designation
     Point desigCell = { bestDesigX, bestDesigY, bestDesigZ };
-    tempLen = FindPath(moverPathAlgorithm, itemCell, desigCell, tempPath, MAX_PATH);
+    tempLen = ProbePathLength(moverPathAlgorithm, itemCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -6031,7 +6061,7 @@ int WorkGiver_PlantSapling(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ itemCellX, itemCellY, itemCellZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6058,8 +6088,8 @@ int WorkGiver_GatherGrass(int moverIdx) {
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -6072,20 +6102,20 @@ int WorkGiver_GatherGrass(int moverIdx) {
 
     if (bestDesigX < 0) {
         if (gatherGrassCacheCount > 0) {
-            EventLog("WorkGiver_GatherGrass: mover %d at z%d, %d cached desigs (none matched)", moverIdx, (int)m->z, gatherGrassCacheCount);
+            EventLog("WorkGiver_GatherGrass: mover %d at z%d, %d cached desigs (none matched)", moverIdx, (int)moverPosZ[moverIdx], gatherGrassCacheCount);
         }
         return -1;
     }
 
     // Check reachability
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestDesigX, bestDesigY, bestDesigZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
-        EventLog("WorkGiver_GatherGrass: desig (%d,%d,z%d) unreachable from mover %d at z%d", bestDesigX, bestDesigY, bestDesigZ, moverIdx, (int)m->z);
+        EventLog("WorkGiver_GatherGrass: desig (%d,%d,z%d) unreachable from mover %d at z%d", bestDesigX, bestDesigY, bestDesigZ, moverIdx, (int)moverPosZ[moverIdx]);
         return -1;
     }
 
@@ -6108,7 +6138,7 @@ int WorkGiver_GatherGrass(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ bestDesigX, bestDesigY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6134,8 +6164,8 @@ int WorkGiver_GatherReeds(int moverIdx) {
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -6151,10 +6181,10 @@ int WorkGiver_GatherReeds(int moverIdx) {
     }
 
     // Check reachability
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestDesigX, bestDesigY, bestDesigZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -6180,7 +6210,7 @@ int WorkGiver_GatherReeds(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ bestDesigX, bestDesigY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6206,8 +6236,8 @@ int WorkGiver_HarvestBerry(int moverIdx) {
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -6220,10 +6250,10 @@ int WorkGiver_HarvestBerry(int moverIdx) {
 
     if (bestDesigX < 0) return -1;
 
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestDesigX, bestDesigY, bestDesigZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -6246,7 +6276,7 @@ int WorkGiver_HarvestBerry(int moverIdx) {
 
     m->currentJobId = jobId;
     m->goal = (Point){ bestDesigX, bestDesigY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6273,8 +6303,8 @@ int WorkGiver_GatherTree(int moverIdx) {
 
         float adjPosX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
         float adjPosY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = adjPosX - m->x;
-        float distY = adjPosY - m->y;
+        float distX = adjPosX - moverPosX[moverIdx];
+        float distY = adjPosY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -6290,7 +6320,7 @@ int WorkGiver_GatherTree(int moverIdx) {
     if (bestDesigX < 0) return -1;
 
     // Check reachability
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -6318,7 +6348,7 @@ int WorkGiver_GatherTree(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6343,8 +6373,8 @@ static int WorkGiver_CleanDesignation(int moverIdx) {
 
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = tileX - m->x;
-        float distY = tileY - m->y;
+        float distX = tileX - moverPosX[moverIdx];
+        float distY = tileY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -6358,10 +6388,10 @@ static int WorkGiver_CleanDesignation(int moverIdx) {
     if (bestDesigX < 0) return -1;
 
     // Check reachability
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point desigCell = { bestDesigX, bestDesigY, bestDesigZ };
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, desigCell, tempPath, MAX_PATH);
     if (tempLen <= 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -6387,7 +6417,7 @@ static int WorkGiver_CleanDesignation(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ bestDesigX, bestDesigY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6438,9 +6468,9 @@ int WorkGiver_Craft(int moverIdx) {
                 if (bill->recipeIdx >= 0 && bill->recipeIdx < resumeRecipeCount) {
                     const Recipe* resumeRecipe = &resumeRecipes[bill->recipeIdx];
                     for (int i = 0; i < itemHighWaterMark; i++) {
-                        if (!items[i].active) continue;
+                        if (!itemActive[i]) continue;
                         if (!RecipeInputMatches(resumeRecipe, &items[i])) continue;
-                        if (items[i].reservedBy != -1) continue;
+                        if (itemReservedBy[i] != -1) continue;
                         uint8_t mat = items[i].material;
                         if (mat == MAT_NONE) mat = DefaultMaterialForItemType(items[i].type);
                         int outSlotX, outSlotY;
@@ -6474,7 +6504,7 @@ int WorkGiver_Craft(int moverIdx) {
                     ? GetItemQualityLevel(items[m->equippedTool].type, reqQuality) : 0;
                 if (currentLevel < reqLevel) {
                     neededToolIdx = FindNearestToolForQuality(reqQuality, reqLevel,
-                        (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z, 50, -1);
+                        (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx], 50, -1);
                     if (neededToolIdx < 0) continue;  // No tool, skip this bill
                 }
             }
@@ -6489,17 +6519,17 @@ int WorkGiver_Craft(int moverIdx) {
             // Search for closest unreserved item of the required type with enough stack
             for (int i = 0; i < itemHighWaterMark; i++) {
                 Item* item = &items[i];
-                if (!item->active) continue;
-                if (item->state == ITEM_IN_CONTAINER) continue;
+                if (!itemActive[i]) continue;
+                if (itemState[i] == ITEM_IN_CONTAINER) continue;
                 if (!RecipeInputMatches(recipe, item)) continue;
-                if (item->reservedBy != -1) continue;
-                if (item->unreachableCooldown > 0.0f) continue;
+                if (itemReservedBy[i] != -1) continue;
+                if (itemUnreachableCooldown[i] > 0.0f) continue;
                 if (item->stackCount < recipe->inputCount) continue;
 
                 // Check distance from workshop
-                int itemTileX = (int)(item->x / CELL_SIZE);
-                int itemTileY = (int)(item->y / CELL_SIZE);
-                if (!IsExplored(itemTileX, itemTileY, (int)item->z)) continue;
+                int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+                int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
+                if (!IsExplored(itemTileX, itemTileY, (int)itemPosZ[i])) continue;
                 int dx = itemTileX - ws->x;
                 int dy = itemTileY - ws->y;
                 int distSq = dx * dx + dy * dy;
@@ -6541,11 +6571,11 @@ int WorkGiver_Craft(int moverIdx) {
             }
 
             // Check if mover can reach the item
-            Point itemCell = { (int)(item->x / CELL_SIZE), (int)(item->y / CELL_SIZE), (int)item->z };
-            Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+            Point itemCell = { (int)(itemPosX[itemIdx] / CELL_SIZE), (int)(itemPosY[itemIdx] / CELL_SIZE), (int)itemPosZ[itemIdx] };
+            Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
 
             Point tempPath[MAX_PATH];
-            int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+            int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
             if (tempLen == 0) {
                 SetItemUnreachableCooldown(itemIdx, UNREACHABLE_COOLDOWN);
                 continue;
@@ -6553,7 +6583,7 @@ int WorkGiver_Craft(int moverIdx) {
 
             // Check if mover can reach the workshop work tile
             Point workCell = { ws->workTileX, ws->workTileY, ws->z };
-            tempLen = FindPath(moverPathAlgorithm, itemCell, workCell, tempPath, MAX_PATH);
+            tempLen = ProbePathLength(moverPathAlgorithm, itemCell, workCell, tempPath, MAX_PATH);
             if (tempLen == 0) continue;
 
             // Find second input item if recipe requires it
@@ -6562,15 +6592,15 @@ int WorkGiver_Craft(int moverIdx) {
                 int best2DistSq = searchRadius * searchRadius;
                 for (int i = 0; i < itemHighWaterMark; i++) {
                     Item* item2 = &items[i];
-                    if (!item2->active) continue;
-                    if (item2->state == ITEM_IN_CONTAINER) continue;
+                    if (!itemActive[i]) continue;
+                    if (itemState[i] == ITEM_IN_CONTAINER) continue;
                     if (item2->type != recipe->inputType2) continue;
-                    if (item2->reservedBy != -1) continue;
-                    if (item2->unreachableCooldown > 0.0f) continue;
+                    if (itemReservedBy[i] != -1) continue;
+                    if (itemUnreachableCooldown[i] > 0.0f) continue;
                     if (i == itemIdx) continue;  // Can't use same item as first input
 
-                    int item2TileX = (int)(item2->x / CELL_SIZE);
-                    int item2TileY = (int)(item2->y / CELL_SIZE);
+                    int item2TileX = (int)(itemPosX[i] / CELL_SIZE);
+                    int item2TileY = (int)(itemPosY[i] / CELL_SIZE);
                     int dx2 = item2TileX - ws->x;
                     int dy2 = item2TileY - ws->y;
                     int dist2Sq = dx2 * dx2 + dy2 * dy2;
@@ -6590,8 +6620,8 @@ int WorkGiver_Craft(int moverIdx) {
                 if (item2Idx < 0) continue;  // Second input not available
 
                 // Verify second input is reachable from workshop
-                Point item2Cell = { (int)(items[item2Idx].x / CELL_SIZE), (int)(items[item2Idx].y / CELL_SIZE), (int)items[item2Idx].z };
-                int item2PathLen = FindPath(moverPathAlgorithm, workCell, item2Cell, tempPath, MAX_PATH);
+                Point item2Cell = { (int)(itemPosX[item2Idx] / CELL_SIZE), (int)(itemPosY[item2Idx] / CELL_SIZE), (int)itemPosZ[item2Idx] };
+                int item2PathLen = ProbePathLength(moverPathAlgorithm, workCell, item2Cell, tempPath, MAX_PATH);
                 if (item2PathLen == 0) {
                     SetItemUnreachableCooldown(item2Idx, UNREACHABLE_COOLDOWN);
                     continue;
@@ -6604,16 +6634,16 @@ int WorkGiver_Craft(int moverIdx) {
                 int best3DistSq = searchRadius * searchRadius;
                 for (int i = 0; i < itemHighWaterMark; i++) {
                     Item* item3 = &items[i];
-                    if (!item3->active) continue;
-                    if (item3->state == ITEM_IN_CONTAINER) continue;
+                    if (!itemActive[i]) continue;
+                    if (itemState[i] == ITEM_IN_CONTAINER) continue;
                     if (item3->type != recipe->inputType3) continue;
-                    if (item3->reservedBy != -1) continue;
-                    if (item3->unreachableCooldown > 0.0f) continue;
+                    if (itemReservedBy[i] != -1) continue;
+                    if (itemUnreachableCooldown[i] > 0.0f) continue;
                     if (i == itemIdx) continue;      // Can't use same item as first input
                     if (i == item2Idx) continue;     // Can't use same item as second input
 
-                    int item3TileX = (int)(item3->x / CELL_SIZE);
-                    int item3TileY = (int)(item3->y / CELL_SIZE);
+                    int item3TileX = (int)(itemPosX[i] / CELL_SIZE);
+                    int item3TileY = (int)(itemPosY[i] / CELL_SIZE);
                     int dx3 = item3TileX - ws->x;
                     int dy3 = item3TileY - ws->y;
                     int dist3Sq = dx3 * dx3 + dy3 * dy3;
@@ -6635,8 +6665,8 @@ int WorkGiver_Craft(int moverIdx) {
                 if (item3Idx < 0) continue;  // Third input not available
 
                 // Verify third input is reachable from workshop
-                Point item3Cell = { (int)(items[item3Idx].x / CELL_SIZE), (int)(items[item3Idx].y / CELL_SIZE), (int)items[item3Idx].z };
-                int item3PathLen = FindPath(moverPathAlgorithm, workCell, item3Cell, tempPath, MAX_PATH);
+                Point item3Cell = { (int)(itemPosX[item3Idx] / CELL_SIZE), (int)(itemPosY[item3Idx] / CELL_SIZE), (int)itemPosZ[item3Idx] };
+                int item3PathLen = ProbePathLength(moverPathAlgorithm, workCell, item3Cell, tempPath, MAX_PATH);
                 if (item3PathLen == 0) {
                     SetItemUnreachableCooldown(item3Idx, UNREACHABLE_COOLDOWN);
                     continue;
@@ -6650,27 +6680,27 @@ int WorkGiver_Craft(int moverIdx) {
                 fuelIdx = FindNearestFuelItem(ws, searchRadius);
                 if (fuelIdx < 0 || fuelIdx == itemIdx) continue;
                 // Verify fuel item is reachable from workshop
-                Point fuelCell = { (int)(items[fuelIdx].x / CELL_SIZE), (int)(items[fuelIdx].y / CELL_SIZE), (int)items[fuelIdx].z };
+                Point fuelCell = { (int)(itemPosX[fuelIdx] / CELL_SIZE), (int)(itemPosY[fuelIdx] / CELL_SIZE), (int)itemPosZ[fuelIdx] };
                 Point workCell2 = { ws->workTileX, ws->workTileY, ws->z };
-                int fuelPathLen = FindPath(moverPathAlgorithm, workCell2, fuelCell, tempPath, MAX_PATH);
+                int fuelPathLen = ProbePathLength(moverPathAlgorithm, workCell2, fuelCell, tempPath, MAX_PATH);
                 if (fuelPathLen == 0) continue;
             }
 
             // Reserve items and workshop
-            item->reservedBy = moverIdx;
+            itemReservedBy[itemIdx] = moverIdx;
             ws->assignedCrafter = moverIdx;
-            if (item2Idx >= 0) items[item2Idx].reservedBy = moverIdx;
-            if (item3Idx >= 0) items[item3Idx].reservedBy = moverIdx;
-            if (fuelIdx >= 0) items[fuelIdx].reservedBy = moverIdx;
+            if (item2Idx >= 0) itemReservedBy[item2Idx] = moverIdx;
+            if (item3Idx >= 0) itemReservedBy[item3Idx] = moverIdx;
+            if (fuelIdx >= 0) itemReservedBy[fuelIdx] = moverIdx;
 
             // Create job
             int jobId = CreateJob(JOBTYPE_CRAFT);
             if (jobId < 0) {
-                item->reservedBy = -1;
+                itemReservedBy[itemIdx] = -1;
                 ws->assignedCrafter = -1;
-                if (item2Idx >= 0) items[item2Idx].reservedBy = -1;
-                if (item3Idx >= 0) items[item3Idx].reservedBy = -1;
-                if (fuelIdx >= 0) items[fuelIdx].reservedBy = -1;
+                if (item2Idx >= 0) itemReservedBy[item2Idx] = -1;
+                if (item3Idx >= 0) itemReservedBy[item3Idx] = -1;
+                if (fuelIdx >= 0) itemReservedBy[fuelIdx] = -1;
                 return -1;
             }
 
@@ -6687,12 +6717,12 @@ int WorkGiver_Craft(int moverIdx) {
 
             // Set up tool fetch or go directly to input pickup
             if (neededToolIdx >= 0) {
-                items[neededToolIdx].reservedBy = moverIdx;
+                itemReservedBy[neededToolIdx] = moverIdx;
                 job->toolItem = neededToolIdx;
                 job->step = STEP_FETCHING_TOOL;
-                m->goal = (Point){ (int)(items[neededToolIdx].x / CELL_SIZE),
-                                    (int)(items[neededToolIdx].y / CELL_SIZE),
-                                    (int)items[neededToolIdx].z };
+                m->goal = (Point){ (int)(itemPosX[neededToolIdx] / CELL_SIZE),
+                                    (int)(itemPosY[neededToolIdx] / CELL_SIZE),
+                                    (int)itemPosZ[neededToolIdx] };
             } else {
                 job->step = CRAFT_STEP_MOVING_TO_INPUT;
                 m->goal = itemCell;
@@ -6700,7 +6730,7 @@ int WorkGiver_Craft(int moverIdx) {
 
             // Update mover
             m->currentJobId = jobId;
-            m->needsRepath = true;
+            moverNeedsRepath[moverIdx] = true;
 
             RemoveMoverFromIdleList(moverIdx);
 
@@ -6726,7 +6756,7 @@ int WorkGiver_StockpileMaintenance(int moverIdx) {
     int itemIdx = FindGroundItemOnStockpile(&spOnItem, &absorb);
 
     if (itemIdx < 0) return -1;
-    if (items[itemIdx].unreachableCooldown > 0.0f) return -1;
+    if (itemUnreachableCooldown[itemIdx] > 0.0f) return -1;
 
     Item* item = &items[itemIdx];
 
@@ -6736,8 +6766,8 @@ int WorkGiver_StockpileMaintenance(int moverIdx) {
     if (absorb) {
         // Absorb: destination is same tile (item matches stockpile filter)
         spIdx = spOnItem;
-        slotX = (int)(item->x / CELL_SIZE);
-        slotY = (int)(item->y / CELL_SIZE);
+        slotX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        slotY = (int)(itemPosY[itemIdx] / CELL_SIZE);
 
         // Check if slot is full — if so, treat as clear instead
         Stockpile* sp = &stockpiles[spOnItem];
@@ -6771,11 +6801,11 @@ int WorkGiver_StockpileMaintenance(int moverIdx) {
     }
 
     // Check reachability
-    Point itemCell = { (int)(item->x / CELL_SIZE), (int)(item->y / CELL_SIZE), (int)item->z };
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point itemCell = { (int)(itemPosX[itemIdx] / CELL_SIZE), (int)(itemPosY[itemIdx] / CELL_SIZE), (int)itemPosZ[itemIdx] };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
 
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
 
     if (tempLen == 0) {
         // Can't reach - release reservations and set cooldown
@@ -6808,7 +6838,7 @@ int WorkGiver_StockpileMaintenance(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = itemCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6831,16 +6861,16 @@ int WorkGiver_Rehaul(int moverIdx) {
     float bestDistSq = 1e30f;
 
     for (int j = 0; j < itemHighWaterMark; j++) {
-        if (!items[j].active) continue;
-        if (items[j].reservedBy != -1) continue;
-        if (items[j].state != ITEM_IN_STOCKPILE) continue;
+        if (!itemActive[j]) continue;
+        if (itemReservedBy[j] != -1) continue;
+        if (itemState[j] != ITEM_IN_STOCKPILE) continue;
 
         int currentSp = -1;
-        if (!IsPositionInStockpile(items[j].x, items[j].y, (int)items[j].z, &currentSp)) continue;
+        if (!IsPositionInStockpile(itemPosX[j], itemPosY[j], (int)itemPosZ[j], &currentSp)) continue;
         if (currentSp < 0) continue;
 
-        int itemSlotX = (int)(items[j].x / CELL_SIZE);
-        int itemSlotY = (int)(items[j].y / CELL_SIZE);
+        int itemSlotX = (int)(itemPosX[j] / CELL_SIZE);
+        int itemSlotY = (int)(itemPosY[j] / CELL_SIZE);
 
         int destSlotX, destSlotY;
         int destSp = -1;
@@ -6860,8 +6890,8 @@ int WorkGiver_Rehaul(int moverIdx) {
         if (destSp < 0) continue;
 
         // Calculate distance to item
-        float dx = items[j].x - m->x;
-        float dy = items[j].y - m->y;
+        float dx = itemPosX[j] - moverPosX[moverIdx];
+        float dy = itemPosY[j] - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestDistSq) {
@@ -6887,11 +6917,11 @@ int WorkGiver_Rehaul(int moverIdx) {
     }
 
     // Check reachability BEFORE clearing source slot
-    Point itemCell = { (int)(item->x / CELL_SIZE), (int)(item->y / CELL_SIZE), (int)item->z };
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point itemCell = { (int)(itemPosX[bestItemIdx] / CELL_SIZE), (int)(itemPosY[bestItemIdx] / CELL_SIZE), (int)itemPosZ[bestItemIdx] };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
 
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
 
     if (tempLen == 0) {
         ReleaseItemReservation(bestItemIdx);
@@ -6921,7 +6951,7 @@ int WorkGiver_Rehaul(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = itemCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -6962,8 +6992,8 @@ int WorkGiver_Mining(int moverIdx) {
 
             float minePosX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
             float minePosY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx = minePosX - m->x;
-            float dy = minePosY - m->y;
+            float dx = minePosX - moverPosX[moverIdx];
+            float dy = minePosY - moverPosY[moverIdx];
             float distSq = dx * dx + dy * dy;
 
             if (distSq < bestDistSq) {
@@ -6986,12 +7016,12 @@ int WorkGiver_Mining(int moverIdx) {
         MaterialType mat = GetWallMaterial(bestDesigX, bestDesigY, bestDesigZ);
         JobToolReq req = GetJobToolRequirement(JOBTYPE_MINE, mat);
         neededToolIdx = FindNearestToolForQuality(req.qualityType, req.minLevel,
-            (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z, 50, -1);
+            (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx], 50, -1);
         if (neededToolIdx < 0) return -1;  // No tool available
     }
 
     // Check reachability - try all adjacent walkable tiles until we find one with a valid path
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -7017,12 +7047,12 @@ int WorkGiver_Mining(int moverIdx) {
 
     // Set up tool fetch or go directly to work
     if (neededToolIdx >= 0) {
-        items[neededToolIdx].reservedBy = moverIdx;
+        itemReservedBy[neededToolIdx] = moverIdx;
         job->toolItem = neededToolIdx;
         job->step = STEP_FETCHING_TOOL;
-        m->goal = (Point){ (int)(items[neededToolIdx].x / CELL_SIZE),
-                            (int)(items[neededToolIdx].y / CELL_SIZE),
-                            (int)items[neededToolIdx].z };
+        m->goal = (Point){ (int)(itemPosX[neededToolIdx] / CELL_SIZE),
+                            (int)(itemPosY[neededToolIdx] / CELL_SIZE),
+                            (int)itemPosZ[neededToolIdx] };
     } else {
         job->step = STEP_MOVING_TO_WORK;
         m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
@@ -7030,7 +7060,7 @@ int WorkGiver_Mining(int moverIdx) {
 
     // Update mover
     m->currentJobId = jobId;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7068,8 +7098,8 @@ int WorkGiver_Channel(int moverIdx) {
 
             float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
             float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx = tileX - m->x;
-            float dy = tileY - m->y;
+            float dx = tileX - moverPosX[moverIdx];
+            float dy = tileY - moverPosY[moverIdx];
             float distSq = dx * dx + dy * dy;
 
             if (distSq < bestDistSq) {
@@ -7090,16 +7120,16 @@ int WorkGiver_Channel(int moverIdx) {
         MaterialType mat = (bestDesigZ > 0) ? GetWallMaterial(bestDesigX, bestDesigY, bestDesigZ - 1) : MAT_DIRT;
         JobToolReq req = GetJobToolRequirement(JOBTYPE_CHANNEL, mat);
         neededToolIdx = FindNearestToolForQuality(req.qualityType, req.minLevel,
-            (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z, 50, -1);
+            (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx], 50, -1);
         if (neededToolIdx < 0) return -1;
     }
 
     // Check reachability - mover walks TO the tile (not adjacent)
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point targetCell = { bestDesigX, bestDesigY, bestDesigZ };
 
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, targetCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, targetCell, tempPath, MAX_PATH);
 
     if (tempLen == 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
@@ -7124,12 +7154,12 @@ int WorkGiver_Channel(int moverIdx) {
 
     // Set up tool fetch or go directly to work
     if (neededToolIdx >= 0) {
-        items[neededToolIdx].reservedBy = moverIdx;
+        itemReservedBy[neededToolIdx] = moverIdx;
         job->toolItem = neededToolIdx;
         job->step = STEP_FETCHING_TOOL;
-        m->goal = (Point){ (int)(items[neededToolIdx].x / CELL_SIZE),
-                            (int)(items[neededToolIdx].y / CELL_SIZE),
-                            (int)items[neededToolIdx].z };
+        m->goal = (Point){ (int)(itemPosX[neededToolIdx] / CELL_SIZE),
+                            (int)(itemPosY[neededToolIdx] / CELL_SIZE),
+                            (int)itemPosZ[neededToolIdx] };
     } else {
         job->step = STEP_MOVING_TO_WORK;
         m->goal = targetCell;
@@ -7137,7 +7167,7 @@ int WorkGiver_Channel(int moverIdx) {
 
     // Update mover
     m->currentJobId = jobId;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7177,8 +7207,8 @@ int WorkGiver_DigRamp(int moverIdx) {
 
             float workPosX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
             float workPosY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-            float dx = workPosX - m->x;
-            float dy = workPosY - m->y;
+            float dx = workPosX - moverPosX[moverIdx];
+            float dy = workPosY - moverPosY[moverIdx];
             float distSq = dx * dx + dy * dy;
 
             if (distSq < bestDistSq) {
@@ -7201,12 +7231,12 @@ int WorkGiver_DigRamp(int moverIdx) {
         MaterialType mat = GetWallMaterial(bestDesigX, bestDesigY, bestDesigZ);
         JobToolReq req = GetJobToolRequirement(JOBTYPE_DIG_RAMP, mat);
         neededToolIdx = FindNearestToolForQuality(req.qualityType, req.minLevel,
-            (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z, 50, -1);
+            (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx], 50, -1);
         if (neededToolIdx < 0) return -1;
     }
 
     // Check reachability - try all adjacent walkable tiles until we find one with a valid path
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -7232,12 +7262,12 @@ int WorkGiver_DigRamp(int moverIdx) {
 
     // Set up tool fetch or go directly to work
     if (neededToolIdx >= 0) {
-        items[neededToolIdx].reservedBy = moverIdx;
+        itemReservedBy[neededToolIdx] = moverIdx;
         job->toolItem = neededToolIdx;
         job->step = STEP_FETCHING_TOOL;
-        m->goal = (Point){ (int)(items[neededToolIdx].x / CELL_SIZE),
-                            (int)(items[neededToolIdx].y / CELL_SIZE),
-                            (int)items[neededToolIdx].z };
+        m->goal = (Point){ (int)(itemPosX[neededToolIdx] / CELL_SIZE),
+                            (int)(itemPosY[neededToolIdx] / CELL_SIZE),
+                            (int)itemPosZ[neededToolIdx] };
     } else {
         job->step = STEP_MOVING_TO_WORK;
         m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
@@ -7245,7 +7275,7 @@ int WorkGiver_DigRamp(int moverIdx) {
 
     // Update mover
     m->currentJobId = jobId;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7279,8 +7309,8 @@ int WorkGiver_RemoveFloor(int moverIdx) {
         // Distance to the tile itself (mover stands on it)
         float tileX = entry->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestDistSq) {
@@ -7294,11 +7324,11 @@ int WorkGiver_RemoveFloor(int moverIdx) {
     if (bestDesigX < 0) return -1;
 
     // Check reachability - mover walks TO the tile
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point targetCell = { bestDesigX, bestDesigY, bestDesigZ };
 
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, targetCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, targetCell, tempPath, MAX_PATH);
 
     if (tempLen == 0) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
@@ -7325,7 +7355,7 @@ int WorkGiver_RemoveFloor(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = targetCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7360,8 +7390,8 @@ int WorkGiver_RemoveRamp(int moverIdx) {
         // Distance to adjacent tile (pre-computed in cache)
         float tileX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
         float tileY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = tileX - m->x;
-        float dy = tileY - m->y;
+        float dx = tileX - moverPosX[moverIdx];
+        float dy = tileY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestDistSq) {
@@ -7377,7 +7407,7 @@ int WorkGiver_RemoveRamp(int moverIdx) {
     if (bestDesigX < 0) return -1;
 
     // Check reachability - try all adjacent walkable tiles until we find one with a valid path
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -7405,7 +7435,7 @@ int WorkGiver_RemoveRamp(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7427,7 +7457,7 @@ int WorkGiver_Chop(int moverIdx) {
         if (!toolRequirementsEnabled) return -1;
         JobToolReq req = GetJobToolRequirement(JOBTYPE_CHOP, MAT_NONE);
         neededToolIdx = FindNearestToolForQuality(req.qualityType, req.minLevel,
-            (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z, 50, -1);
+            (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx], 50, -1);
         if (neededToolIdx < 0) return -1;
     }
 
@@ -7447,8 +7477,8 @@ int WorkGiver_Chop(int moverIdx) {
         // Distance to adjacent tile (already cached)
         float adjPosX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
         float adjPosY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = adjPosX - m->x;
-        float distY = adjPosY - m->y;
+        float distX = adjPosX - moverPosX[moverIdx];
+        float distY = adjPosY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -7464,7 +7494,7 @@ int WorkGiver_Chop(int moverIdx) {
     if (bestDesigX < 0) return -1;
 
     // Check reachability
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -7490,12 +7520,12 @@ int WorkGiver_Chop(int moverIdx) {
 
     // Set up tool fetch or go directly to work
     if (neededToolIdx >= 0) {
-        items[neededToolIdx].reservedBy = moverIdx;
+        itemReservedBy[neededToolIdx] = moverIdx;
         job->toolItem = neededToolIdx;
         job->step = STEP_FETCHING_TOOL;
-        m->goal = (Point){ (int)(items[neededToolIdx].x / CELL_SIZE),
-                            (int)(items[neededToolIdx].y / CELL_SIZE),
-                            (int)items[neededToolIdx].z };
+        m->goal = (Point){ (int)(itemPosX[neededToolIdx] / CELL_SIZE),
+                            (int)(itemPosY[neededToolIdx] / CELL_SIZE),
+                            (int)itemPosZ[neededToolIdx] };
     } else {
         job->step = STEP_MOVING_TO_WORK;
         m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
@@ -7503,7 +7533,7 @@ int WorkGiver_Chop(int moverIdx) {
 
     // Update mover
     m->currentJobId = jobId;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7524,7 +7554,7 @@ int WorkGiver_ChopFelled(int moverIdx) {
         if (!toolRequirementsEnabled) return -1;
         JobToolReq req = GetJobToolRequirement(JOBTYPE_CHOP_FELLED, MAT_NONE);
         neededToolIdx = FindNearestToolForQuality(req.qualityType, req.minLevel,
-            (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z, 50, -1);
+            (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx], 50, -1);
         if (neededToolIdx < 0) return -1;
     }
 
@@ -7546,8 +7576,8 @@ int WorkGiver_ChopFelled(int moverIdx) {
         // Distance to adjacent tile (already cached)
         float adjPosX = entry->adjX * CELL_SIZE + CELL_SIZE * 0.5f;
         float adjPosY = entry->adjY * CELL_SIZE + CELL_SIZE * 0.5f;
-        float distX = adjPosX - m->x;
-        float distY = adjPosY - m->y;
+        float distX = adjPosX - moverPosX[moverIdx];
+        float distY = adjPosY - moverPosY[moverIdx];
         float distSq = distX * distX + distY * distY;
 
         if (distSq < bestDistSq) {
@@ -7562,7 +7592,7 @@ int WorkGiver_ChopFelled(int moverIdx) {
 
     if (bestDesigX < 0) return -1;
 
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     if (!FindReachableAdjacentTile(bestDesigX, bestDesigY, bestDesigZ, moverCell, &bestAdjX, &bestAdjY)) {
         Designation* d = GetDesignation(bestDesigX, bestDesigY, bestDesigZ);
         if (d) d->unreachableCooldown = UNREACHABLE_COOLDOWN;
@@ -7586,19 +7616,19 @@ int WorkGiver_ChopFelled(int moverIdx) {
 
     // Set up tool fetch or go directly to work
     if (neededToolIdx >= 0) {
-        items[neededToolIdx].reservedBy = moverIdx;
+        itemReservedBy[neededToolIdx] = moverIdx;
         job->toolItem = neededToolIdx;
         job->step = STEP_FETCHING_TOOL;
-        m->goal = (Point){ (int)(items[neededToolIdx].x / CELL_SIZE),
-                            (int)(items[neededToolIdx].y / CELL_SIZE),
-                            (int)items[neededToolIdx].z };
+        m->goal = (Point){ (int)(itemPosX[neededToolIdx] / CELL_SIZE),
+                            (int)(itemPosY[neededToolIdx] / CELL_SIZE),
+                            (int)itemPosZ[neededToolIdx] };
     } else {
         job->step = STEP_MOVING_TO_WORK;
         m->goal = (Point){ bestAdjX, bestAdjY, bestDesigZ };
     }
 
     m->currentJobId = jobId;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7626,8 +7656,8 @@ int WorkGiver_Build(int moverIdx) {
 
         float bpX = bp->x * CELL_SIZE + CELL_SIZE * 0.5f;
         float bpY = bp->y * CELL_SIZE + CELL_SIZE * 0.5f;
-        float dx = bpX - m->x;
-        float dy = bpY - m->y;
+        float dx = bpX - moverPosX[moverIdx];
+        float dy = bpY - moverPosY[moverIdx];
         float distSq = dx * dx + dy * dy;
 
         if (distSq < bestDistSq) {
@@ -7642,7 +7672,7 @@ int WorkGiver_Build(int moverIdx) {
 
     // Check reachability - either to the cell itself, or to an adjacent cell if target is not walkable
     Point bpCell = { bp->x, bp->y, bp->z };
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx] };
     Point goalCell = bpCell;
 
     Point tempPath[MAX_PATH];
@@ -7650,7 +7680,7 @@ int WorkGiver_Build(int moverIdx) {
 
     if (IsCellWalkableAt(bp->z, bp->y, bp->x)) {
         // Blueprint cell is walkable - path directly to it (e.g. building wall on ground)
-        tempLen = FindPath(moverPathAlgorithm, moverCell, bpCell, tempPath, MAX_PATH);
+        tempLen = ProbePathLength(moverPathAlgorithm, moverCell, bpCell, tempPath, MAX_PATH);
     } else {
         // Blueprint cell is not walkable (e.g. floor over air) - find adjacent walkable cell
         // Check orthogonal neighbors only (no diagonals, like Dwarf Fortress)
@@ -7663,7 +7693,7 @@ int WorkGiver_Build(int moverIdx) {
             if (!IsCellWalkableAt(bp->z, ay, ax)) continue;
 
             Point adjCell = { ax, ay, bp->z };
-            tempLen = FindPath(moverPathAlgorithm, moverCell, adjCell, tempPath, MAX_PATH);
+            tempLen = ProbePathLength(moverPathAlgorithm, moverCell, adjCell, tempPath, MAX_PATH);
             if (tempLen > 0) {
                 goalCell = adjCell;
                 break;
@@ -7692,7 +7722,7 @@ int WorkGiver_Build(int moverIdx) {
     // Update mover
     m->currentJobId = jobId;
     m->goal = goalCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -7706,9 +7736,9 @@ int WorkGiver_BlueprintClear(int moverIdx) {
     if (!m->capabilities.canHaul) return -1;
     if (bpCacheClearingCount == 0) return -1;
 
-    int moverZ = (int)m->z;
-    int moverTileX = (int)(m->x / CELL_SIZE);
-    int moverTileY = (int)(m->y / CELL_SIZE);
+    int moverZ = (int)moverPosZ[moverIdx];
+    int moverTileX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int moverTileY = (int)(moverPosY[moverIdx] / CELL_SIZE);
     Point moverCell = { moverTileX, moverTileY, moverZ };
     Point tempPath[MAX_PATH];
 
@@ -7720,16 +7750,16 @@ int WorkGiver_BlueprintClear(int moverIdx) {
         int foundItem = -1;
         bool anyItemsLeft = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
-            if ((int)items[i].z != bp->z) continue;
-            if (items[i].state != ITEM_ON_GROUND && items[i].state != ITEM_IN_STOCKPILE) continue;
-            int ix = (int)(items[i].x / CELL_SIZE);
-            int iy = (int)(items[i].y / CELL_SIZE);
+            if (!itemActive[i]) continue;
+            if ((int)itemPosZ[i] != bp->z) continue;
+            if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
+            int ix = (int)(itemPosX[i] / CELL_SIZE);
+            int iy = (int)(itemPosY[i] / CELL_SIZE);
             if (ix != bp->x || iy != bp->y) continue;
-            if (!IsExplored(ix, iy, (int)items[i].z)) continue;
+            if (!IsExplored(ix, iy, (int)itemPosZ[i])) continue;
             anyItemsLeft = true;
-            if (items[i].reservedBy != -1) continue;
-            if (items[i].unreachableCooldown > 0.0f) continue;
+            if (itemReservedBy[i] != -1) continue;
+            if (itemUnreachableCooldown[i] > 0.0f) continue;
             foundItem = i;
             break;
         }
@@ -7751,10 +7781,10 @@ int WorkGiver_BlueprintClear(int moverIdx) {
         bool safeDrop = (spIdx < 0);
 
         // Check item reachability
-        Point itemCell = { (int)(items[foundItem].x / CELL_SIZE),
-                           (int)(items[foundItem].y / CELL_SIZE),
-                           (int)items[foundItem].z };
-        int pathLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+        Point itemCell = { (int)(itemPosX[foundItem] / CELL_SIZE),
+                           (int)(itemPosY[foundItem] / CELL_SIZE),
+                           (int)itemPosZ[foundItem] };
+        int pathLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
         if (pathLen == 0) continue;
 
         // Reserve item and stockpile slot (unless safe-drop)
@@ -7785,7 +7815,7 @@ int WorkGiver_BlueprintClear(int moverIdx) {
 
         m->currentJobId = jobId;
         m->goal = itemCell;
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         RemoveMoverFromIdleList(moverIdx);
         return jobId;
     }
@@ -7806,14 +7836,14 @@ static bool RecipeHaulItemFilter(int itemIdx, void* userData) {
     RecipeHaulFilterData* data = (RecipeHaulFilterData*)userData;
     Item* item = &items[itemIdx];
 
-    if (!item->active) return false;
-    if (item->reservedBy != -1) return false;
-    if (item->state != ITEM_ON_GROUND) return false;
-    if (item->unreachableCooldown > 0.0f) return false;
+    if (!itemActive[itemIdx]) return false;
+    if (itemReservedBy[itemIdx] != -1) return false;
+    if (itemState[itemIdx] != ITEM_ON_GROUND) return false;
+    if (itemUnreachableCooldown[itemIdx] > 0.0f) return false;
     {
-        int ix = (int)(item->x / CELL_SIZE);
-        int iy = (int)(item->y / CELL_SIZE);
-        if (!IsExplored(ix, iy, (int)item->z)) return false;
+        int ix = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int iy = (int)(itemPosY[itemIdx] / CELL_SIZE);
+        if (!IsExplored(ix, iy, (int)itemPosZ[itemIdx])) return false;
     }
 
     // Check if item type matches this input slot
@@ -7849,8 +7879,8 @@ static int FindNearestRecipeItem(int moverTileX, int moverTileY, int moverZ, flo
                                                 RecipeHaulItemFilter, &filterData);
         }
         if (bestItemIdx >= 0) {
-            float dx = items[bestItemIdx].x - mx;
-            float dy = items[bestItemIdx].y - my;
+            float dx = itemPosX[bestItemIdx] - mx;
+            float dy = itemPosY[bestItemIdx] - my;
             bestDistSq = dx * dx + dy * dy;
         }
     }
@@ -7859,14 +7889,14 @@ static int FindNearestRecipeItem(int moverTileX, int moverTileY, int moverZ, flo
     if (bestItemIdx >= 0) return bestItemIdx;
     for (int j = 0; j < itemHighWaterMark; j++) {
         Item* item = &items[j];
-        if (!item->active) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
-        if (item->unreachableCooldown > 0.0f) continue;
+        if (!itemActive[j]) continue;
+        if (itemReservedBy[j] != -1) continue;
+        if (itemState[j] != ITEM_ON_GROUND && itemState[j] != ITEM_IN_STOCKPILE) continue;
+        if (itemUnreachableCooldown[j] > 0.0f) continue;
         {
-            int ix = (int)(item->x / CELL_SIZE);
-            int iy = (int)(item->y / CELL_SIZE);
-            if (!IsExplored(ix, iy, (int)item->z)) continue;
+            int ix = (int)(itemPosX[j] / CELL_SIZE);
+            int iy = (int)(itemPosY[j] / CELL_SIZE);
+            if (!IsExplored(ix, iy, (int)itemPosZ[j])) continue;
         }
         if (!ConstructionInputAcceptsItem(input, item->type)) continue;
 
@@ -7881,8 +7911,8 @@ static int FindNearestRecipeItem(int moverTileX, int moverTileY, int moverZ, flo
             }
         }
 
-        float dx = item->x - mx;
-        float dy = item->y - my;
+        float dx = itemPosX[j] - mx;
+        float dy = itemPosY[j] - my;
         float distSq = dx * dx + dy * dy;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -7924,7 +7954,7 @@ static bool IsBlueprintReachable(Blueprint* bp, Point moverCell, Point tempPath[
     int tempLen = 0;
     if (IsCellWalkableAt(bp->z, bp->y, bp->x)) {
         Point bpCell = { bp->x, bp->y, bp->z };
-        tempLen = FindPath(moverPathAlgorithm, moverCell, bpCell, tempPath, MAX_PATH);
+        tempLen = ProbePathLength(moverPathAlgorithm, moverCell, bpCell, tempPath, MAX_PATH);
     }
     if (tempLen == 0) {
         int dx[] = {1, -1, 0, 0};
@@ -7935,7 +7965,7 @@ static bool IsBlueprintReachable(Blueprint* bp, Point moverCell, Point tempPath[
             if (ax < 0 || ax >= gridWidth || ay < 0 || ay >= gridHeight) continue;
             if (!IsCellWalkableAt(bp->z, ay, ax)) continue;
             Point adjCell = { ax, ay, bp->z };
-            tempLen = FindPath(moverPathAlgorithm, moverCell, adjCell, tempPath, MAX_PATH);
+            tempLen = ProbePathLength(moverPathAlgorithm, moverCell, adjCell, tempPath, MAX_PATH);
             if (tempLen > 0) break;
         }
     }
@@ -7950,9 +7980,9 @@ int WorkGiver_BlueprintHaul(int moverIdx) {
     if (bpCacheNeedsMaterialsCount == 0) return -1;
     if (bpHaulItemsExhausted) return -1;  // no items found for any blueprint this frame
 
-    int moverZ = (int)m->z;
-    int moverTileX = (int)(m->x / CELL_SIZE);
-    int moverTileY = (int)(m->y / CELL_SIZE);
+    int moverZ = (int)moverPosZ[moverIdx];
+    int moverTileX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int moverTileY = (int)(moverPosY[moverIdx] / CELL_SIZE);
     Point moverCell = { moverTileX, moverTileY, moverZ };
     Point tempPath[MAX_PATH];
 
@@ -7973,15 +8003,15 @@ int WorkGiver_BlueprintHaul(int moverIdx) {
             StageDelivery* sd = &bp->stageDeliveries[s];
             if (sd->deliveredCount + sd->reservedCount >= stage->inputs[s].count) continue;  // slot full
 
-            int itemIdx = FindNearestRecipeItem(moverTileX, moverTileY, moverZ, m->x, m->y,
+            int itemIdx = FindNearestRecipeItem(moverTileX, moverTileY, moverZ, moverPosX[moverIdx], moverPosY[moverIdx],
                                                  &stage->inputs[s], sd);
             if (itemIdx < 0) continue;
 
             // Check reachability
             if (!IsBlueprintReachable(bp, moverCell, tempPath)) break;  // bp unreachable, skip all slots
 
-            Point itemCell = { (int)(items[itemIdx].x / CELL_SIZE), (int)(items[itemIdx].y / CELL_SIZE), (int)items[itemIdx].z };
-            int itemPathLen = FindPath(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
+            Point itemCell = { (int)(itemPosX[itemIdx] / CELL_SIZE), (int)(itemPosY[itemIdx] / CELL_SIZE), (int)itemPosZ[itemIdx] };
+            int itemPathLen = ProbePathLength(moverPathAlgorithm, moverCell, itemCell, tempPath, MAX_PATH);
             if (itemPathLen == 0) continue;
 
             bestBpIdx = bpIdx;
@@ -8063,10 +8093,10 @@ int WorkGiver_BlueprintHaul(int moverIdx) {
     job->targetSlotY = bp->y;
     job->step = 0;  // STEP_MOVING_TO_PICKUP
 
-    Point itemCell = { (int)(items[bestItemIdx].x / CELL_SIZE), (int)(items[bestItemIdx].y / CELL_SIZE), (int)items[bestItemIdx].z };
+    Point itemCell = { (int)(itemPosX[bestItemIdx] / CELL_SIZE), (int)(itemPosY[bestItemIdx] / CELL_SIZE), (int)itemPosZ[bestItemIdx] };
     m->currentJobId = jobId;
     m->goal = itemCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -8075,6 +8105,19 @@ int WorkGiver_BlueprintHaul(int moverIdx) {
 
 // WorkGiver_Hunt: Find a marked animal to hunt
 // Returns job ID if successful, -1 if no job available
+// Marked, unreserved, explored animal on the hunter's z-level
+static bool IsHuntableAnimal(AgentKind kind, int idx, void* userData) {
+    (void)kind;
+    Animal* a = &animals[idx];
+    if (!a->active) return false;
+    if (!a->markedForHunt) return false;
+    if (a->reservedByHunter >= 0) return false;
+    if ((int)a->z != *(int*)userData) return false;
+    int ax = (int)(a->x / CELL_SIZE);
+    int ay = (int)(a->y / CELL_SIZE);
+    return IsExplored(ax, ay, (int)a->z);
+}
+
 int WorkGiver_Hunt(int moverIdx) {
     Mover* m = &movers[moverIdx];
     if (!m->capabilities.canHunt) return -1;
@@ -8082,26 +8125,22 @@ int WorkGiver_Hunt(int moverIdx) {
     // Find nearest marked, unreserved animal
     int bestIdx = -1;
     float bestDistSq = 1e30f;
-    int moverZ = (int)m->z;
-
-    for (int i = 0; i < animalCount; i++) {
-        Animal* a = &animals[i];
-        if (!a->active) continue;
-        if (!a->markedForHunt) continue;
-        if (a->reservedByHunter >= 0) continue;
-        if ((int)a->z != moverZ) continue;
-        {
-            int ax = (int)(a->x / CELL_SIZE);
-            int ay = (int)(a->y / CELL_SIZE);
-            if (!IsExplored(ax, ay, (int)a->z)) continue;
-        }
+    int moverZ = (int)moverPosZ[moverIdx];
 
-        float dx = a->x - m->x;
-        float dy = a->y - m->y;
-        float distSq = dx * dx + dy * dy;
-        if (distSq < bestDistSq) {
-            bestDistSq = distSq;
-            bestIdx = i;
+    if (AgentGridHasCurrentAnimals()) {
+        bestIdx = FindNearestAgent(moverPosX[moverIdx], moverPosY[moverIdx], moverZ, 0.0f, AGENT_MASK(AGENT_ANIMAL),
+                                   IsHuntableAnimal, &moverZ, NULL);
+    } else {
+        for (int i = 0; i < animalCount; i++) {
+            if (!IsHuntableAnimal(AGENT_ANIMAL, i, &moverZ)) continue;
+
+            float dx = animals[i].x - moverPosX[moverIdx];
+            float dy = animals[i].y - moverPosY[moverIdx];
+            float distSq = dx * dx + dy * dy;
+            if (distSq < bestDistSq) {
+                bestDistSq = distSq;
+                bestIdx = i;
+            }
         }
     }
 
@@ -8113,11 +8152,11 @@ int WorkGiver_Hunt(int moverIdx) {
     int animalCellX = (int)(target->x / CELL_SIZE);
     int animalCellY = (int)(target->y / CELL_SIZE);
     int animalCellZ = (int)target->z;
-    Point moverCell = { (int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), moverZ };
+    Point moverCell = { (int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), moverZ };
     Point goalCell = { animalCellX, animalCellY, animalCellZ };
 
     Point tempPath[MAX_PATH];
-    int tempLen = FindPath(moverPathAlgorithm, moverCell, goalCell, tempPath, MAX_PATH);
+    int tempLen = ProbePathLength(moverPathAlgorithm, moverCell, goalCell, tempPath, MAX_PATH);
     if (tempLen == 0) return -1;
 
     // Create job
@@ -8135,7 +8174,7 @@ int WorkGiver_Hunt(int moverIdx) {
     // Set mover goal
     m->currentJobId = jobId;
     m->goal = goalCell;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 
     RemoveMoverFromIdleList(moverIdx);
 
@@ -253,6 +253,7 @@ void FreeJobSystem(void);
 void AddMoverToIdleList(int moverIdx);
 void RemoveMoverFromIdleList(int moverIdx);
 void RebuildIdleMoverList(void);  // Full rebuild (e.g., after ClearMovers)
+void RenumberIdleMoverList(const int* moverMap);  // same list, new indices (RenumberMoversByCell)
 
 // Core functions
 void AssignJobs(void);           // Match idle movers with available jobs
@@ -6,7 +6,10 @@
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
 #include "../world/pathfinding.h"
+#include "../world/cell_edits.h"
 #include "items.h"
+#include "item_renumber.h"
+#include "path_index.h"
 #include "containers.h"
 #include "jobs.h"
 #include "stockpiles.h"
@@ -30,9 +33,13 @@
 #include "../../shared/profiler.h"
 #include "../../shared/ui.h"
 #include "../../vendor/raylib.h"
+#include "../core/sim_rng.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Fast inverse square root (Quake III algorithm)
 // Uses memcpy to avoid undefined behavior from type-punning
@@ -48,7 +55,20 @@ static inline float fastInvSqrt(float x) {
 
 // Globals
 Mover movers[MAX_MOVERS];
+float moverPosX[MAX_MOVERS];
+float moverPosY[MAX_MOVERS];
+float moverPosZ[MAX_MOVERS];
+float moverAvoidX[MAX_MOVERS];
+float moverAvoidY[MAX_MOVERS];
+int moverPathIndex[MAX_MOVERS];
+int moverPathLength[MAX_MOVERS];
+bool moverActive[MAX_MOVERS];
+bool moverNeedsRepath[MAX_MOVERS];
 Point moverPaths[MAX_MOVERS][MAX_MOVER_PATH];
+int moverFlowField[MAX_MOVERS];
+int moverHandleIndex[MAX_MOVERS];
+int moverIndexHandle[MAX_MOVERS];
+bool moverHandlesRemapped = false;
 int moverCount = 0;
 int repathFallbackCount = 0;
 int repathHpaSuccessCount = 0;
@@ -65,6 +85,7 @@ bool useWallSliding = true;
 float avoidStrengthOpen = 0.5f;
 float avoidStrengthClosed = 0.0f;
 bool useDirectionalAvoidance = true;
+bool useSimdAvoidance = true;
 PathAlgorithm moverPathAlgorithm = PATH_ALGO_HPA;  // Default to HPA*
 bool useRandomizedCooldowns = true;   // Default on for demo perf, tests can disable
 bool useStaggeredUpdates = true;      // Default on for demo perf, tests can disable
@@ -79,16 +100,17 @@ static inline int clampi(int v, int lo, int hi) {
 // Try to make a mover fall to ground. Returns true if mover fell.
 // Searches downward from current z for a walkable cell, stops at walls.
 static bool TryFallToGround(Mover* m, int cellX, int cellY) {
-    int currentZ = (int)m->z;
+    int moverIdx = (int)(m - movers);
+    int currentZ = (int)moverPosZ[moverIdx];
     
     // First, try to fall straight down
     for (int checkZ = currentZ - 1; checkZ >= 0; checkZ--) {
         if (IsCellWalkableAt(checkZ, cellY, cellX)) {
-            m->z = (float)checkZ;
+            moverPosZ[moverIdx] = (float)checkZ;
             m->fallTimer = 1.0f;
             // Clear path so mover gets a new goal at the new z-level
-            m->pathLength = 0;
-            m->pathIndex = -1;
+            moverPathLength[moverIdx] = 0;
+            moverPathIndex[moverIdx] = -1;
             return true;
         }
         if (IsWallCell(grid[checkZ][cellY][cellX])) {
@@ -108,13 +130,13 @@ static bool TryFallToGround(Mover* m, int cellX, int cellY) {
             int adjY = cellY + dy[d];
             if (adjX >= 0 && adjX < gridWidth && adjY >= 0 && adjY < gridHeight) {
                 if (IsCellWalkableAt(checkZ, adjY, adjX)) {
-                    m->z = (float)checkZ;
-                    m->x = adjX * CELL_SIZE + CELL_SIZE * 0.5f;
-                    m->y = adjY * CELL_SIZE + CELL_SIZE * 0.5f;
+                    moverPosZ[moverIdx] = (float)checkZ;
+                    moverPosX[moverIdx] = adjX * CELL_SIZE + CELL_SIZE * 0.5f;
+                    moverPosY[moverIdx] = adjY * CELL_SIZE + CELL_SIZE * 0.5f;
                     m->fallTimer = 1.0f;
                     // Clear path so mover gets a new goal at the new z-level
-                    m->pathLength = 0;
-                    m->pathIndex = -1;
+                    moverPathLength[moverIdx] = 0;
+                    moverPathIndex[moverIdx] = -1;
                     return true;
                 }
             }
@@ -130,40 +152,111 @@ void InitMoverSpatialGrid(int worldPixelWidth, int worldPixelHeight) {
     moverGrid.invCellSize = 1.0f / MOVER_GRID_CELL_SIZE;
     moverGrid.gridW = (int)ceilf(worldPixelWidth * moverGrid.invCellSize);
     moverGrid.gridH = (int)ceilf(worldPixelHeight * moverGrid.invCellSize);
+    moverGrid.gridD = clampi(gridDepth, 1, MAX_GRID_DEPTH);
     moverGrid.cellCount = moverGrid.gridW * moverGrid.gridH;
     
+    int cap = MAX_MOVERS + MAX_ANIMALS + MAX_TRAINS * (1 + MAX_TRAIL_LENGTH);
+    moverGrid.entryCapacity = cap;
     moverGrid.cellCounts = (int*)calloc(moverGrid.cellCount, sizeof(int));
     moverGrid.cellStarts = (int*)calloc(moverGrid.cellCount + 1, sizeof(int));
-    moverGrid.moverIndices = (int*)malloc(MAX_MOVERS * sizeof(int));
+    moverGrid.agentIndex = (int*)malloc(cap * sizeof(int));
+    moverGrid.agentKind = (uint8_t*)malloc(cap * sizeof(uint8_t));
+    moverGrid.agentZ = (uint8_t*)malloc(cap * sizeof(uint8_t));
+    moverGrid.cellPosX = (float*)malloc(cap * sizeof(float));
+    moverGrid.cellPosY = (float*)malloc(cap * sizeof(float));
+    moverGrid.moverEntryCount = 0;
+    moverGrid.animalGeneration = -1;
 }
 
 void FreeMoverSpatialGrid(void) {
     free(moverGrid.cellCounts);
     free(moverGrid.cellStarts);
-    free(moverGrid.moverIndices);
+    free(moverGrid.agentIndex);
+    free(moverGrid.agentKind);
+    free(moverGrid.agentZ);
+    free(moverGrid.cellPosX);
+    free(moverGrid.cellPosY);
     moverGrid.cellCounts = NULL;
     moverGrid.cellStarts = NULL;
-    moverGrid.moverIndices = NULL;
+    moverGrid.agentIndex = NULL;
+    moverGrid.agentKind = NULL;
+    moverGrid.agentZ = NULL;
+    moverGrid.cellPosX = NULL;
+    moverGrid.cellPosY = NULL;
+    moverGrid.moverEntryCount = 0;
+    moverGrid.animalGeneration = -1;
+}
+
+// Entries are staged in gather order, then radix-sorted: by z, then stably by cell
+typedef struct {
+    float x, y;
+    int index;
+    int cell;
+    uint8_t kind;
+    uint8_t z;
+} AgentStage;
+
+#define AGENT_GRID_CAPACITY (MAX_MOVERS + MAX_ANIMALS + MAX_TRAINS * (1 + MAX_TRAIL_LENGTH))
+static AgentStage agentStage[AGENT_GRID_CAPACITY];
+static int agentByZ[AGENT_GRID_CAPACITY];
+
+static inline void StageAgent(int* n, AgentKind kind, int index, float x, float y, int z) {
+    z = clampi(z, 0, moverGrid.gridD - 1);
+    int cx = clampi((int)(x * moverGrid.invCellSize), 0, moverGrid.gridW - 1);
+    int cy = clampi((int)(y * moverGrid.invCellSize), 0, moverGrid.gridH - 1);
+    AgentStage* s = &agentStage[(*n)++];
+    s->x = x;
+    s->y = y;
+    s->index = index;
+    s->cell = cy * moverGrid.gridW + cx;
+    s->kind = (uint8_t)kind;
+    s->z = (uint8_t)z;
+    moverGrid.kindCounts[kind][z]++;
+    moverGrid.cellCounts[s->cell]++;
 }
 
 void BuildMoverSpatialGrid(void) {
     if (!moverGrid.cellCounts) return;
+    moverGrid.gridD = clampi(gridDepth, 1, MAX_GRID_DEPTH);
     
     // Clear counts
     memset(moverGrid.cellCounts, 0, moverGrid.cellCount * sizeof(int));
+    memset(moverGrid.kindCounts, 0, sizeof(moverGrid.kindCounts));
     
-    // Count movers per cell
+    // Gather every agent once (the only pass that reads the entity structs)
+    int n = 0;
     for (int i = 0; i < moverCount; i++) {
-        if (!movers[i].active) continue;
-        
-        int cx = (int)(movers[i].x * moverGrid.invCellSize);
-        int cy = (int)(movers[i].y * moverGrid.invCellSize);
-        cx = clampi(cx, 0, moverGrid.gridW - 1);
-        cy = clampi(cy, 0, moverGrid.gridH - 1);
-        
-        moverGrid.cellCounts[cy * moverGrid.gridW + cx]++;
+        if (!moverActive[i]) continue;
+        StageAgent(&n, AGENT_MOVER, i, moverPosX[i], moverPosY[i], (int)moverPosZ[i]);
+    }
+    moverGrid.moverEntryCount = n;
+    
+    for (int i = 0; i < animalCount; i++) {
+        if (!animals[i].active) continue;
+        StageAgent(&n, AGENT_ANIMAL, i, animals[i].x, animals[i].y, (int)animals[i].z);
+    }
+    moverGrid.animalGeneration = animalGeneration;
+    moverGrid.animalCountAtBuild = animalCount;
+    moverGrid.builtTick = currentTick;
+    
+    // Locomotive plus each trailing car at its trail cell center
+    for (int j = 0; j < MAX_TRAINS; j++) {
+        Train* t = &trains[j];
+        if (!t->active) continue;
+        StageAgent(&n, AGENT_TRAIN_CAR, j, t->x, t->y, t->z);
+        for (int car = 0; car < t->trailCount; car++) {
+            float carX = t->trailCellX[car] * CELL_SIZE + CELL_SIZE * 0.5f;
+            float carY = t->trailCellY[car] * CELL_SIZE + CELL_SIZE * 0.5f;
+            StageAgent(&n, AGENT_TRAIN_CAR, j, carX, carY, t->z);
+        }
     }
     
+    // Pass 1: order entries by z (few levels, so a tiny counting sort)
+    int zStart[MAX_GRID_DEPTH + 1] = {0};
+    for (int e = 0; e < n; e++) zStart[agentStage[e].z + 1]++;
+    for (int z = 0; z < moverGrid.gridD; z++) zStart[z + 1] += zStart[z];
+    for (int e = 0; e < n; e++) agentByZ[zStart[agentStage[e].z]++] = e;
+    
     // Build prefix sum
     moverGrid.cellStarts[0] = 0;
     for (int c = 0; c < moverGrid.cellCount; c++) {
@@ -171,84 +264,180 @@ void BuildMoverSpatialGrid(void) {
     }
     
     // Reset counts to use as write cursors
-    for (int c = 0; c < moverGrid.cellCount; c++) {
-        moverGrid.cellCounts[c] = moverGrid.cellStarts[c];
+    memcpy(moverGrid.cellCounts, moverGrid.cellStarts, moverGrid.cellCount * sizeof(int));
+    
+    // Pass 2: stable scatter by cell, so each cell's run is sorted by z
+    for (int k = 0; k < n; k++) {
+        const AgentStage* s = &agentStage[agentByZ[k]];
+        int slot = moverGrid.cellCounts[s->cell]++;
+        moverGrid.agentIndex[slot] = s->index;
+        moverGrid.agentKind[slot] = s->kind;
+        moverGrid.agentZ[slot] = s->z;
+        moverGrid.cellPosX[slot] = s->x;
+        moverGrid.cellPosY[slot] = s->y;
     }
-    
-    // Scatter mover indices into cells
-    for (int i = 0; i < moverCount; i++) {
-        if (!movers[i].active) continue;
-        
-        int cx = (int)(movers[i].x * moverGrid.invCellSize);
-        int cy = (int)(movers[i].y * moverGrid.invCellSize);
-        cx = clampi(cx, 0, moverGrid.gridW - 1);
-        cy = clampi(cy, 0, moverGrid.gridH - 1);
-        
-        int cellIdx = cy * moverGrid.gridW + cx;
-        moverGrid.moverIndices[moverGrid.cellCounts[cellIdx]++] = i;
+}
+
+// Entry run [*start, *end) for grid cell (gx, gy) on level z, or all levels when z < 0
+static inline bool AgentBucketRange(int gx, int gy, int z, int* start, int* end) {
+    int cellIdx = gy * moverGrid.gridW + gx;
+    int s = moverGrid.cellStarts[cellIdx];
+    int e = moverGrid.cellStarts[cellIdx + 1];
+    if (z >= 0) {
+        const uint8_t* zs = moverGrid.agentZ;
+        while (s < e && zs[s] < z) s++;
+        int t = s;
+        while (t < e && zs[t] == z) t++;
+        e = t;
     }
+    *start = s;
+    *end = e;
+    return e > s;
 }
 
+bool AgentGridHasCurrentAnimals(void) {
+    return moverGrid.cellCounts && moverGrid.animalGeneration == animalGeneration &&
+           moverGrid.animalCountAtBuild == animalCount && currentTick - moverGrid.builtTick <= 1;
+}
 
+// Repulsion weight per agent kind, relative to mover-mover avoidance
+static const float agentAvoidWeight[] = {
+    [AGENT_MOVER] = 2.0f,
+    [AGENT_ANIMAL] = 4.0f,       // 2x stronger than mover-mover avoidance
+    [AGENT_TRAIN_CAR] = 8.0f,    // 4x stronger — get off the tracks!
+};
+
+// Neighbor block shared by every mover in one grid cell: the z-level runs of
+// the surrounding cells, packed in the order the avoidance scan visits them.
+// Gathering stops once no mover could scan further (AVOID_MAX_SCAN non-train
+// entries plus its own), so dense cells stay bounded.
+#define AVOID_BLOCK_MAX (AVOID_MAX_SCAN + 1 + MAX_TRAINS * (1 + MAX_TRAIL_LENGTH))
+
+typedef struct {
+    float x[AVOID_BLOCK_MAX + 4];   // +4: lane padding for the last batch
+    float y[AVOID_BLOCK_MAX + 4];
+    float weight[AVOID_BLOCK_MAX];
+    int mover[AVOID_BLOCK_MAX];     // mover index, -1 for other kinds
+    uint8_t train[AVOID_BLOCK_MAX];
+    int count;
+} AvoidBlock;
+
+static AvoidBlock avoidBlock;
+
+static void GatherAvoidBlock(int cx, int cy, int z, AvoidBlock* b) {
+    int radCells = (int)ceilf(MOVER_AVOID_RADIUS * moverGrid.invCellSize);
+    int minCx = clampi(cx - radCells, 0, moverGrid.gridW - 1);
+    int maxCx = clampi(cx + radCells, 0, moverGrid.gridW - 1);
+    int minCy = clampi(cy - radCells, 0, moverGrid.gridH - 1);
+    int maxCy = clampi(cy + radCells, 0, moverGrid.gridH - 1);
+    
+    int n = 0, scannable = 0;
+    for (int gy = minCy; gy <= maxCy; gy++) {
+        for (int gx = minCx; gx <= maxCx; gx++) {
+            int start, end;
+            if (!AgentBucketRange(gx, gy, z, &start, &end)) continue;
+            for (int t = start; t < end; t++) {
+                if (scannable > AVOID_MAX_SCAN) goto done;
+                AgentKind kind = (AgentKind)moverGrid.agentKind[t];
+                b->x[n] = moverGrid.cellPosX[t];
+                b->y[n] = moverGrid.cellPosY[t];
+                b->weight[n] = agentAvoidWeight[kind];
+                b->mover[n] = (kind == AGENT_MOVER) ? moverGrid.agentIndex[t] : -1;
+                b->train[n] = (kind == AGENT_TRAIN_CAR);
+                if (kind != AGENT_TRAIN_CAR) scannable++;
+                n++;
+            }
+        }
+    }
+done:
+    for (int l = 0; l < 4; l++) {
+        b->x[n + l] = 0.0f;
+        b->y[n + l] = 0.0f;
+    }
+    b->count = n;
+}
 
-Vec2 ComputeMoverAvoidance(int moverIndex) {
+// Per-lane repulsion for 4 block entries: dx, dy and strength / distance, with
+// the same operation order as the scalar path so both are bit-identical.
+// Returns a bit per lane inside the avoid radius.
+static inline int AvoidanceLanes4(const AvoidBlock* b, int t, float mx, float my,
+                                  float radiusSq, float invRadius,
+                                  float* outDx, float* outDy, float* outS) {
+#if defined(__SSE2__)
+    __m128 dx = _mm_sub_ps(_mm_set1_ps(mx), _mm_loadu_ps(&b->x[t]));
+    __m128 dy = _mm_sub_ps(_mm_set1_ps(my), _mm_loadu_ps(&b->y[t]));
+    __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+    __m128 inRange = _mm_and_ps(_mm_cmpge_ps(distSq, _mm_set1_ps(1e-10f)),
+                                _mm_cmplt_ps(distSq, _mm_set1_ps(radiusSq)));
+    
+    // fastInvSqrt, lane-wise
+    __m128 xhalf = _mm_mul_ps(_mm_set1_ps(0.5f), distSq);
+    __m128i bits = _mm_sub_epi32(_mm_set1_epi32(0x5f375a86), _mm_srai_epi32(_mm_castps_si128(distSq), 1));
+    __m128 inv = _mm_castsi128_ps(bits);
+    inv = _mm_mul_ps(inv, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(xhalf, inv), inv)));
+    
+    __m128 dist = _mm_mul_ps(distSq, inv);
+    __m128 u = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(dist, _mm_set1_ps(invRadius)));
+    _mm_storeu_ps(outDx, dx);
+    _mm_storeu_ps(outDy, dy);
+    _mm_storeu_ps(outS, _mm_mul_ps(_mm_mul_ps(u, u), inv));
+    return _mm_movemask_ps(inRange);
+#else
+    int mask = 0;
+    for (int l = 0; l < 4; l++) {
+        float dx = mx - b->x[t + l];
+        float dy = my - b->y[t + l];
+        float distSq = dx * dx + dy * dy;
+        outDx[l] = dx;
+        outDy[l] = dy;
+        outS[l] = 0.0f;
+        if (distSq < 1e-10f || distSq >= radiusSq) continue;
+        float invDist = fastInvSqrt(distSq);
+        float dist = distSq * invDist;
+        float u = 1.0f - dist * invRadius;
+        outS[l] = u * u * invDist;
+        mask |= 1 << l;
+    }
+    return mask;
+#endif
+}
+
+static Vec2 AvoidanceFromBlock(const AvoidBlock* b, int moverIndex) {
     Vec2 avoidance = {0.0f, 0.0f};
-    
-    // Guard: return early if spatial grid not initialized
-    if (!moverGrid.cellCounts) return avoidance;
-    
     Mover* m = &movers[moverIndex];
-    if (!m->active) return avoidance;
     
     float radius = MOVER_AVOID_RADIUS;
     float radiusSq = radius * radius;
     float invRadius = 1.0f / radius;
     
+    // Movers waiting to board or riding don't shy away from trains
+    bool avoidTrains = m->transportState != TRANSPORT_WAITING && m->transportState != TRANSPORT_RIDING;
+    
     int found = 0;
     int scanned = 0;
     
-    // Compute cell range to search
-    int radCells = (int)ceilf(radius * moverGrid.invCellSize);
-    int cx = (int)(m->x * moverGrid.invCellSize);
-    int cy = (int)(m->y * moverGrid.invCellSize);
-    
-    int minCx = clampi(cx - radCells, 0, moverGrid.gridW - 1);
-    int maxCx = clampi(cx + radCells, 0, moverGrid.gridW - 1);
-    int minCy = clampi(cy - radCells, 0, moverGrid.gridH - 1);
-    int maxCy = clampi(cy + radCells, 0, moverGrid.gridH - 1);
-    
-    for (int gy = minCy; gy <= maxCy; gy++) {
-        for (int gx = minCx; gx <= maxCx; gx++) {
-            int cellIdx = gy * moverGrid.gridW + gx;
-            int start = moverGrid.cellStarts[cellIdx];
-            int end = moverGrid.cellStarts[cellIdx + 1];
+    if (useSimdAvoidance) {
+        for (int t = 0; t < b->count; t += 4) {
+            float dxs[4], dys[4], ss[4];
+            int inRange = AvoidanceLanes4(b, t, moverPosX[moverIndex], moverPosY[moverIndex], radiusSq, invRadius, dxs, dys, ss);
+            int lanes = b->count - t < 4 ? b->count - t : 4;
             
-            for (int t = start; t < end; t++) {
-                int j = moverGrid.moverIndices[t];
-                if (j == moverIndex) continue;
+            // Apply lanes in block order so the scan/neighbor caps and the
+            // summation order match the one-at-a-time path
+            for (int l = 0; l < lanes; l++) {
+                int e = t + l;
+                if (b->mover[e] == moverIndex) continue;
+                if (b->train[e] && !avoidTrains) continue;
                 
                 scanned++;
                 if (scanned >= AVOID_MAX_SCAN) {
                     return avoidance;
                 }
+                if (!(inRange & (1 << l))) continue;
                 
-                float dx = m->x - movers[j].x;
-                float dy = m->y - movers[j].y;
-                float distSq = dx * dx + dy * dy;
-                
-                if (distSq < 1e-10f || distSq >= radiusSq) continue;
-                
-                float invDist = fastInvSqrt(distSq);
-                float dist = distSq * invDist;
-                
-                // Strength increases quadratically as distance decreases
-                float u = 1.0f - dist * invRadius;
-                float strength = u * u;
-                
-                // Add repulsion (direction * strength / distance)
-                float k = strength * invDist * 2.0f;
-                avoidance.x += dx * k;
-                avoidance.y += dy * k;
+                float k = ss[l] * b->weight[e];
+                avoidance.x += dxs[l] * k;
+                avoidance.y += dys[l] * k;
                 
                 found++;
                 if (found >= AVOID_MAX_NEIGHBORS) {
@@ -256,65 +445,97 @@ Vec2 ComputeMoverAvoidance(int moverIndex) {
                 }
             }
         }
+        return avoidance;
     }
-
-    // Also avoid animals (simple linear scan — small count)
-    for (int j = 0; j < animalCount && found < AVOID_MAX_NEIGHBORS; j++) {
-        if (!animals[j].active) continue;
-        if ((int)animals[j].z != (int)m->z) continue;
-
-        float dx = m->x - animals[j].x;
-        float dy = m->y - animals[j].y;
+    
+    for (int e = 0; e < b->count; e++) {
+        if (b->mover[e] == moverIndex) continue;
+        if (b->train[e] && !avoidTrains) continue;
+        
+        scanned++;
+        if (scanned >= AVOID_MAX_SCAN) {
+            return avoidance;
+        }
+        
+        // Positions come from the packed copy taken at build time (agents
+        // don't move between BuildMoverSpatialGrid and the avoidance phase)
+        float dx = moverPosX[moverIndex] - b->x[e];
+        float dy = moverPosY[moverIndex] - b->y[e];
         float distSq = dx * dx + dy * dy;
-
+        
         if (distSq < 1e-10f || distSq >= radiusSq) continue;
-
+        
         float invDist = fastInvSqrt(distSq);
         float dist = distSq * invDist;
+        
+        // Strength increases quadratically as distance decreases
         float u = 1.0f - dist * invRadius;
         float strength = u * u;
-        float k = strength * invDist * 4.0f;  // 4x stronger than mover-mover avoidance
+        
+        // Add repulsion (direction * strength / distance)
+        float k = strength * invDist * b->weight[e];
         avoidance.x += dx * k;
         avoidance.y += dy * k;
+        
         found++;
+        if (found >= AVOID_MAX_NEIGHBORS) {
+            return avoidance;
+        }
     }
 
-    // Avoid trains (skip if mover is waiting to board or riding)
-    if (m->transportState != TRANSPORT_WAITING && m->transportState != TRANSPORT_RIDING) {
-        for (int j = 0; j < MAX_TRAINS && found < AVOID_MAX_NEIGHBORS; j++) {
-            Train* t = &trains[j];
-            if (!t->active || t->z != (int)m->z) continue;
-
-            // Check locomotive + each trailing car
-            for (int car = -1; car < t->trailCount && found < AVOID_MAX_NEIGHBORS; car++) {
-                float carX, carY;
-                if (car < 0) {
-                    carX = t->x;
-                    carY = t->y;
-                } else {
-                    carX = t->trailCellX[car] * CELL_SIZE + CELL_SIZE * 0.5f;
-                    carY = t->trailCellY[car] * CELL_SIZE + CELL_SIZE * 0.5f;
-                }
-
-                float dx = m->x - carX;
-                float dy = m->y - carY;
-                float distSq = dx * dx + dy * dy;
+    return avoidance;
+}
 
-                if (distSq < 1e-10f || distSq >= radiusSq) continue;
+Vec2 ComputeMoverAvoidance(int moverIndex) {
+    Vec2 avoidance = {0.0f, 0.0f};
+    
+    // Guard: return early if spatial grid not initialized
+    if (!moverGrid.cellCounts) return avoidance;
+    
+    if (!moverActive[moverIndex]) return avoidance;
+    
+    // Only this mover's z-level run in each nearby cell
+    int mz = (int)moverPosZ[moverIndex];
+    if (mz < 0 || mz >= moverGrid.gridD) return avoidance;
+    int cx = clampi((int)(moverPosX[moverIndex] * moverGrid.invCellSize), 0, moverGrid.gridW - 1);
+    int cy = clampi((int)(moverPosY[moverIndex] * moverGrid.invCellSize), 0, moverGrid.gridH - 1);
+    
+    GatherAvoidBlock(cx, cy, mz, &avoidBlock);
+    return AvoidanceFromBlock(&avoidBlock, moverIndex);
+}
 
-                float invDist = fastInvSqrt(distSq);
-                float dist = distSq * invDist;
-                float u = 1.0f - dist * invRadius;
-                float strength = u * u;
-                float k = strength * invDist * 8.0f;  // 8x stronger — get off the tracks!
-                avoidance.x += dx * k;
-                avoidance.y += dy * k;
-                found++;
+void ComputeMoverAvoidanceBatch(const bool* wanted, Vec2* out) {
+    if (!moverGrid.cellCounts) {
+        for (int i = 0; i < moverCount; i++) {
+            if (wanted[i]) out[i] = (Vec2){0.0f, 0.0f};
+        }
+        return;
+    }
+    
+    // Walk the grid so every mover in one cell and level shares one gathered block
+    for (int cy = 0; cy < moverGrid.gridH; cy++) {
+        for (int cx = 0; cx < moverGrid.gridW; cx++) {
+            int cell = cy * moverGrid.gridW + cx;
+            int end = moverGrid.cellStarts[cell + 1];
+            int blockZ = -1;
+            for (int t = moverGrid.cellStarts[cell]; t < end; t++) {
+                if (moverGrid.agentKind[t] != AGENT_MOVER) continue;
+                int i = moverGrid.agentIndex[t];
+                if (!wanted[i]) continue;
+                
+                // Movers off the indexed levels (clamped into the grid) take the single path
+                if ((int)moverPosZ[i] != moverGrid.agentZ[t]) {
+                    out[i] = ComputeMoverAvoidance(i);
+                    continue;
+                }
+                if (blockZ != moverGrid.agentZ[t]) {
+                    blockZ = moverGrid.agentZ[t];
+                    GatherAvoidBlock(cx, cy, blockZ, &avoidBlock);
+                }
+                out[i] = AvoidanceFromBlock(&avoidBlock, i);
             }
         }
     }
-
-    return avoidance;
 }
 
 bool IsMoverInOpenArea(float x, float y, int z) {
@@ -481,16 +702,18 @@ int QueryMoverNeighbors(float x, float y, float radius, int excludeIndex,
     
     for (int gy = minCy; gy <= maxCy; gy++) {
         for (int gx = minCx; gx <= maxCx; gx++) {
+            // All z-levels of a cell are one contiguous run
             int cellIdx = gy * moverGrid.gridW + gx;
             int start = moverGrid.cellStarts[cellIdx];
             int end = moverGrid.cellStarts[cellIdx + 1];
             
             for (int t = start; t < end; t++) {
-                int moverIdx = moverGrid.moverIndices[t];
+                if (moverGrid.agentKind[t] != AGENT_MOVER) continue;
+                int moverIdx = moverGrid.agentIndex[t];
                 if (moverIdx == excludeIndex) continue;
                 
-                float dx = movers[moverIdx].x - x;
-                float dy = movers[moverIdx].y - y;
+                float dx = moverPosX[moverIdx] - x;
+                float dy = moverPosY[moverIdx] - y;
                 float distSq = dx * dx + dy * dy;
                 
                 if (distSq < radiusSq) {
@@ -506,6 +729,126 @@ int QueryMoverNeighbors(float x, float y, float radius, int excludeIndex,
     return found;
 }
 
+int QueryAgentNeighbors(float x, float y, int z, float radius, unsigned int kindMask,
+                        AgentNeighborCallback callback, void* userData) {
+    if (!moverGrid.cellCounts) return 0;
+    if (z >= moverGrid.gridD) return 0;
+    
+    float radiusSq = radius * radius;
+    int found = 0;
+    
+    int radCells = (int)ceilf(radius * moverGrid.invCellSize);
+    int cx = (int)(x * moverGrid.invCellSize);
+    int cy = (int)(y * moverGrid.invCellSize);
+    
+    int minCx = clampi(cx - radCells, 0, moverGrid.gridW - 1);
+    int maxCx = clampi(cx + radCells, 0, moverGrid.gridW - 1);
+    int minCy = clampi(cy - radCells, 0, moverGrid.gridH - 1);
+    int maxCy = clampi(cy + radCells, 0, moverGrid.gridH - 1);
+    
+    for (int gy = minCy; gy <= maxCy; gy++) {
+        for (int gx = minCx; gx <= maxCx; gx++) {
+            int start, end;
+            if (!AgentBucketRange(gx, gy, z, &start, &end)) continue;
+            
+            for (int t = start; t < end; t++) {
+                AgentKind kind = (AgentKind)moverGrid.agentKind[t];
+                if (!(kindMask & AGENT_MASK(kind))) continue;
+                
+                float dx = moverGrid.cellPosX[t] - x;
+                float dy = moverGrid.cellPosY[t] - y;
+                float distSq = dx * dx + dy * dy;
+                
+                if (distSq < radiusSq) {
+                    if (callback) {
+                        callback(kind, moverGrid.agentIndex[t], distSq, userData);
+                    }
+                    found++;
+                }
+            }
+        }
+    }
+    
+    return found;
+}
+
+// Live position of an agent (the grid copy may be up to one tick old)
+static inline void GetAgentPosition(AgentKind kind, int index, float cellX, float cellY,
+                                    float* outX, float* outY) {
+    switch (kind) {
+        case AGENT_MOVER:  *outX = moverPosX[index];  *outY = moverPosY[index];  break;
+        case AGENT_ANIMAL: *outX = animals[index].x; *outY = animals[index].y; break;
+        default:           *outX = cellX;            *outY = cellY;            break;
+    }
+}
+
+int FindNearestAgent(float x, float y, int z, float maxDist, unsigned int kindMask,
+                     AgentFilter filter, void* userData, float* outDistSq) {
+    if (!moverGrid.cellCounts) return -1;
+    if (z < 0 || z >= moverGrid.gridD) return -1;
+    
+    // Stop once every candidate on this level has been looked at
+    int remaining = 0;
+    for (int k = 0; k < 3; k++) {
+        if (kindMask & AGENT_MASK(k)) remaining += moverGrid.kindCounts[k][z];
+    }
+    
+    int cx = clampi((int)(x * moverGrid.invCellSize), 0, moverGrid.gridW - 1);
+    int cy = clampi((int)(y * moverGrid.invCellSize), 0, moverGrid.gridH - 1);
+    int maxRing = moverGrid.gridW > moverGrid.gridH ? moverGrid.gridW : moverGrid.gridH;
+    float bestDistSq = 1e30f;
+    if (maxDist > 0.0f) {
+        // +2: the query's own cell offset plus one cell of movement since the build
+        int reachRing = (int)ceilf(maxDist * moverGrid.invCellSize) + 2;
+        if (reachRing < maxRing) maxRing = reachRing;
+        bestDistSq = maxDist * maxDist;
+    }
+    
+    int bestIdx = -1;
+    for (int ring = 0; ring <= maxRing && remaining > 0; ring++) {
+        // Everything in ring r was at least r-1 cells away at build time; allow
+        // one cell of movement since then before calling the search done
+        if (bestIdx >= 0 && ring >= 2) {
+            float reach = (ring - 2) * MOVER_GRID_CELL_SIZE;
+            if (reach * reach > bestDistSq) break;
+        }
+        
+        int minGy = cy - ring, maxGy = cy + ring;
+        int minGx = cx - ring, maxGx = cx + ring;
+        for (int gy = minGy; gy <= maxGy; gy++) {
+            if (gy < 0 || gy >= moverGrid.gridH) continue;
+            // Interior rows of a ring only touch its left and right columns
+            int step = (gy == minGy || gy == maxGy) ? 1 : maxGx - minGx;
+            for (int gx = minGx; gx <= maxGx; gx += step) {
+                if (gx < 0 || gx >= moverGrid.gridW) continue;
+                int start, end;
+                if (!AgentBucketRange(gx, gy, z, &start, &end)) continue;
+                
+                for (int t = start; t < end; t++) {
+                    AgentKind kind = (AgentKind)moverGrid.agentKind[t];
+                    if (!(kindMask & AGENT_MASK(kind))) continue;
+                    remaining--;
+                    int idx = moverGrid.agentIndex[t];
+                    if (filter && !filter(kind, idx, userData)) continue;
+                    
+                    float ax, ay;
+                    GetAgentPosition(kind, idx, moverGrid.cellPosX[t], moverGrid.cellPosY[t], &ax, &ay);
+                    float dx = ax - x;
+                    float dy = ay - y;
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq < bestDistSq || (distSq == bestDistSq && bestIdx >= 0 && idx < bestIdx)) {
+                        bestDistSq = distSq;
+                        bestIdx = idx;
+                    }
+                }
+            }
+        }
+    }
+    
+    if (outDistSq) *outDistSq = bestDistSq;
+    return bestIdx;
+}
+
 // Check if there's line-of-sight between two points (Bresenham)
 bool HasLineOfSight(int x0, int y0, int x1, int y1, int z) {
     // Bounds check
@@ -675,16 +1018,17 @@ void StringPullPath(Point* pathArr, int* pathLen) {
 }
 
 void InitMover(Mover* m, float x, float y, float z, Point goal, float speed) {
-    m->x = x;
-    m->y = y;
-    m->z = z;
+    int moverIdx = (int)(m - movers);
+    moverPosX[moverIdx] = x;
+    moverPosY[moverIdx] = y;
+    moverPosZ[moverIdx] = z;
     m->goal = goal;
     m->speed = speed;
-    m->active = true;
-    m->needsRepath = false;
+    moverActive[moverIdx] = true;
+    moverNeedsRepath[moverIdx] = false;
     m->repathCooldown = 0;
-    m->pathLength = 0;
-    m->pathIndex = -1;
+    moverPathLength[moverIdx] = 0;
+    moverPathIndex[moverIdx] = -1;
     m->timeNearWaypoint = 0.0f;
     m->lastX = x;
     m->lastY = y;
@@ -736,38 +1080,158 @@ void InitMover(Mover* m, float x, float y, float z, Point goal, float speed) {
 }
 
 void InitMoverWithPath(Mover* m, float x, float y, float z, Point goal, float speed, Point* pathArr, int pathLen) {
+    int moverIdx = (int)(m - movers);
     InitMover(m, x, y, z, goal, speed);
-    m->pathLength = (pathLen > MAX_MOVER_PATH) ? MAX_MOVER_PATH : pathLen;
+    moverPathLength[moverIdx] = (pathLen > MAX_MOVER_PATH) ? MAX_MOVER_PATH : pathLen;
     
     // Path is stored goal-to-start: path[0]=goal, path[pathLen-1]=start
     // If truncating, keep the START end (high indices), not the goal end
-    int moverIdx = (int)(m - movers);
-    int srcOffset = pathLen - m->pathLength;
-    for (int i = 0; i < m->pathLength; i++) {
+    int srcOffset = pathLen - moverPathLength[moverIdx];
+    for (int i = 0; i < moverPathLength[moverIdx]; i++) {
         moverPaths[moverIdx][i] = pathArr[srcOffset + i];
     }
-    m->pathIndex = m->pathLength - 1;
+    moverPathIndex[moverIdx] = moverPathLength[moverIdx] - 1;
+}
+
+void PackMoverRecord(int moverIdx, MoverRecord* out) {
+    const Mover* m = &movers[moverIdx];
+    memset(out, 0, sizeof(*out));  // padding bytes too, so saves are deterministic
+    out->x = moverPosX[moverIdx];
+    out->y = moverPosY[moverIdx];
+    out->z = moverPosZ[moverIdx];
+    out->pathLength = moverPathLength[moverIdx];
+    out->pathIndex = moverPathIndex[moverIdx];
+    out->active = moverActive[moverIdx];
+    out->needsRepath = moverNeedsRepath[moverIdx];
+    out->goal = m->goal;
+    out->repathCooldown = m->repathCooldown;
+    out->speed = m->speed;
+    out->timeNearWaypoint = m->timeNearWaypoint;
+    out->lastX = m->lastX;
+    out->lastY = m->lastY;
+    out->lastZ = m->lastZ;
+    out->timeWithoutProgress = m->timeWithoutProgress;
+    out->fallTimer = m->fallTimer;
+    out->workAnimPhase = m->workAnimPhase;
+    out->hunger = m->hunger;
+    out->energy = m->energy;
+    out->freetimeState = m->freetimeState;
+    out->needTarget = m->needTarget;
+    out->needProgress = m->needProgress;
+    out->needSearchCooldown = m->needSearchCooldown;
+    out->starvationTimer = m->starvationTimer;
+    out->thirst = m->thirst;
+    out->dehydrationTimer = m->dehydrationTimer;
+    out->bodyTemp = m->bodyTemp;
+    out->hypothermiaTimer = m->hypothermiaTimer;
+    out->avoidX = moverAvoidX[moverIdx];
+    out->avoidY = moverAvoidY[moverIdx];
+    out->currentJobId = m->currentJobId;
+    out->lastJobType = m->lastJobType;
+    out->lastJobResult = m->lastJobResult;
+    out->lastJobTargetX = m->lastJobTargetX;
+    out->lastJobTargetY = m->lastJobTargetY;
+    out->lastJobTargetZ = m->lastJobTargetZ;
+    out->lastJobEndTick = m->lastJobEndTick;
+    out->capabilities = m->capabilities;
+    out->equippedTool = m->equippedTool;
+    out->equippedClothing = m->equippedClothing;
+    memcpy(out->name, m->name, sizeof(out->name));
+    out->gender = m->gender;
+    out->age = m->age;
+    out->appearanceSeed = m->appearanceSeed;
+    out->isDrafted = m->isDrafted;
+    out->mood = m->mood;
+    memcpy(out->moodlets, m->moodlets, sizeof(out->moodlets));
+    out->moodletCount = m->moodletCount;
+    memcpy(out->traits, m->traits, sizeof(out->traits));
+    out->transportState = m->transportState;
+    out->transportStation = m->transportStation;
+    out->transportExitStation = m->transportExitStation;
+    out->transportTrainIdx = m->transportTrainIdx;
+    out->transportFinalGoal = m->transportFinalGoal;
+    out->bladder = m->bladder;
+}
+
+void UnpackMoverRecord(int moverIdx, const MoverRecord* in) {
+    Mover* m = &movers[moverIdx];
+    moverPosX[moverIdx] = in->x;
+    moverPosY[moverIdx] = in->y;
+    moverPosZ[moverIdx] = in->z;
+    moverPathLength[moverIdx] = in->pathLength;
+    moverPathIndex[moverIdx] = in->pathIndex;
+    moverActive[moverIdx] = in->active;
+    moverNeedsRepath[moverIdx] = in->needsRepath;
+    m->goal = in->goal;
+    m->repathCooldown = in->repathCooldown;
+    m->speed = in->speed;
+    m->timeNearWaypoint = in->timeNearWaypoint;
+    m->lastX = in->lastX;
+    m->lastY = in->lastY;
+    m->lastZ = in->lastZ;
+    m->timeWithoutProgress = in->timeWithoutProgress;
+    m->fallTimer = in->fallTimer;
+    m->workAnimPhase = in->workAnimPhase;
+    m->hunger = in->hunger;
+    m->energy = in->energy;
+    m->freetimeState = in->freetimeState;
+    m->needTarget = in->needTarget;
+    m->needProgress = in->needProgress;
+    m->needSearchCooldown = in->needSearchCooldown;
+    m->starvationTimer = in->starvationTimer;
+    m->thirst = in->thirst;
+    m->dehydrationTimer = in->dehydrationTimer;
+    m->bodyTemp = in->bodyTemp;
+    m->hypothermiaTimer = in->hypothermiaTimer;
+    moverAvoidX[moverIdx] = in->avoidX;
+    moverAvoidY[moverIdx] = in->avoidY;
+    m->currentJobId = in->currentJobId;
+    m->lastJobType = in->lastJobType;
+    m->lastJobResult = in->lastJobResult;
+    m->lastJobTargetX = in->lastJobTargetX;
+    m->lastJobTargetY = in->lastJobTargetY;
+    m->lastJobTargetZ = in->lastJobTargetZ;
+    m->lastJobEndTick = in->lastJobEndTick;
+    m->capabilities = in->capabilities;
+    m->equippedTool = in->equippedTool;
+    m->equippedClothing = in->equippedClothing;
+    memcpy(m->name, in->name, sizeof(m->name));
+    m->gender = in->gender;
+    m->age = in->age;
+    m->appearanceSeed = in->appearanceSeed;
+    m->isDrafted = in->isDrafted;
+    m->mood = in->mood;
+    memcpy(m->moodlets, in->moodlets, sizeof(m->moodlets));
+    m->moodletCount = in->moodletCount;
+    memcpy(m->traits, in->traits, sizeof(m->traits));
+    m->transportState = in->transportState;
+    m->transportStation = in->transportStation;
+    m->transportExitStation = in->transportExitStation;
+    m->transportTrainIdx = in->transportTrainIdx;
+    m->transportFinalGoal = in->transportFinalGoal;
+    m->bladder = in->bladder;
 }
 
 void ClearMovers(void) {
     // Drop carried items on the ground at mover's position
     for (int i = 0; i < moverCount; i++) {
-        if (!movers[i].active) continue;
+        if (!moverActive[i]) continue;
         Mover* m = &movers[i];
         
         // Check if mover has a job with a carried item
         if (m->currentJobId >= 0) {
             Job* job = GetJob(m->currentJobId);
             if (job && job->carryingItem >= 0 && job->carryingItem < MAX_ITEMS) {
-                Item* item = &items[job->carryingItem];
-                if (item->active && item->state == ITEM_CARRIED) {
-                    item->x = m->x;
-                    item->y = m->y;
-                    item->z = m->z;
-                    item->state = ITEM_ON_GROUND;
-                    item->reservedBy = -1;
+                int itemIdx = job->carryingItem;
+                Item* item = &items[itemIdx];
+                if (itemActive[itemIdx] && itemState[itemIdx] == ITEM_CARRIED) {
+                    itemPosX[itemIdx] = moverPosX[i];
+                    itemPosY[itemIdx] = moverPosY[i];
+                    itemPosZ[itemIdx] = moverPosZ[i];
+                    SetItemState(job->carryingItem, ITEM_ON_GROUND);
+                    itemReservedBy[itemIdx] = -1;
                     if (item->contentCount > 0) {
-                        MoveContainer(job->carryingItem, m->x, m->y, m->z);
+                        MoveContainer(job->carryingItem, moverPosX[i], moverPosY[i], moverPosZ[i]);
                     }
                 }
             }
@@ -779,19 +1243,20 @@ void ClearMovers(void) {
     
     // Clear all item reservations
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active) {
-            items[i].reservedBy = -1;
+        if (itemActive[i]) {
+            itemReservedBy[i] = -1;
         }
     }
     
     // Reset all designation progress and assignments
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type != DESIGNATION_NONE) {
-                    designations[z][y][x].assignedMover = -1;
-                    designations[z][y][x].progress = 0.0f;
-                }
+    for (int i = 0; i < designationLayer.allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(designationLayer.allocated[i], &px, &py, &z);
+        Designation* page = (Designation*)PagedLayerPage(&designationLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) {
+            if (page[c].type != DESIGNATION_NONE) {
+                page[c].assignedMover = -1;
+                page[c].progress = 0.0f;
             }
         }
     }
@@ -826,6 +1291,11 @@ void ClearMovers(void) {
     
     moverCount = 0;
     currentTick = 0;
+    moverHandlesRemapped = false;
+    memset(moverFlowField, 0, sizeof(moverFlowField));
+    ClearFlowFields();
+    ResetRepathScheduler();
+    ClearPathIndex();
     // Initialize spatial grid if grid dimensions are set
     if (gridWidth > 0 && gridHeight > 0) {
         InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
@@ -838,7 +1308,7 @@ void ClearMovers(void) {
 int CountActiveMovers(void) {
     int count = 0;
     for (int i = 0; i < moverCount; i++) {
-        if (movers[i].active) count++;
+        if (moverActive[i]) count++;
     }
     return count;
 }
@@ -847,7 +1317,7 @@ void NeedsTick(void) {
     float dt = gameDeltaTime;
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) continue;
+        if (!moverActive[i]) continue;
 
         // Skip freetime transitions for movers riding trains (they can't seek food/rest/etc.)
         if (m->transportState == TRANSPORT_RIDING) continue;
@@ -863,13 +1333,13 @@ void NeedsTick(void) {
                 if (m->starvationTimer >= GameHoursToGameSeconds(balance.starvationDeathGH)) {
                     if (m->currentJobId >= 0) CancelJob(m, i);
                     if (m->needTarget >= 0) {
-                        items[m->needTarget].reservedBy = -1;
+                        itemReservedBy[m->needTarget] = -1;
                         m->needTarget = -1;
                     }
                     DropEquippedTool(i);
                     DropEquippedClothing(i);
                     m->freetimeState = FREETIME_NONE;
-                    m->active = false;
+                    moverActive[i] = false;
                     EventLog("%s (#%d) died of starvation (timer=%.1fs)", MoverDisplayName(i), i, m->starvationTimer);
                     TraceLog(LOG_WARNING, "%s (#%d) died of starvation", MoverDisplayName(i), i);
                     AddMessage("Your mover starved to death.", RED);
@@ -894,13 +1364,13 @@ void NeedsTick(void) {
                 if (m->dehydrationTimer >= GameHoursToGameSeconds(balance.dehydrationDeathGH)) {
                     if (m->currentJobId >= 0) CancelJob(m, i);
                     if (m->needTarget >= 0) {
-                        items[m->needTarget].reservedBy = -1;
+                        itemReservedBy[m->needTarget] = -1;
                         m->needTarget = -1;
                     }
                     DropEquippedTool(i);
                     DropEquippedClothing(i);
                     m->freetimeState = FREETIME_NONE;
-                    m->active = false;
+                    moverActive[i] = false;
                     EventLog("%s (#%d) died of dehydration (timer=%.1fs)", MoverDisplayName(i), i, m->dehydrationTimer);
                     TraceLog(LOG_WARNING, "%s (#%d) died of dehydration", MoverDisplayName(i), i);
                     AddMessage("Your mover died of thirst.", RED);
@@ -938,9 +1408,9 @@ void NeedsTick(void) {
 
         // Update body temperature
         if (bodyTempEnabled) {
-            int cx = (int)(m->x / CELL_SIZE);
-            int cy = (int)(m->y / CELL_SIZE);
-            int cz = (int)m->z;
+            int cx = (int)(moverPosX[i] / CELL_SIZE);
+            int cy = (int)(moverPosY[i] / CELL_SIZE);
+            int cz = (int)moverPosZ[i];
             float cellTemp = (float)GetTemperature(cx, cy, cz);
             bool exposed = IsExposedToSky(cx, cy, cz);
             float effectiveAmbient = GetWindChillTemp(cellTemp, weatherState.windStrength, exposed);
@@ -956,7 +1426,7 @@ void NeedsTick(void) {
             float rate = (diff > 0) ? balance.bodyTempWarmingRatePerGH : balance.bodyTempCoolingRatePerGH;
             // Clothing slows heat loss (cooling only)
             if (diff < 0 && m->equippedClothing >= 0 && m->equippedClothing < MAX_ITEMS
-                && items[m->equippedClothing].active) {
+                && itemActive[m->equippedClothing]) {
                 float reduction = GetClothingCoolingReduction(items[m->equippedClothing].type);
                 rate *= (1.0f - reduction);
             }
@@ -977,7 +1447,7 @@ void NeedsTick(void) {
                     DropEquippedTool(i);
                     DropEquippedClothing(i);
                     m->freetimeState = FREETIME_NONE;
-                    m->active = false;
+                    moverActive[i] = false;
                     EventLog("%s (#%d) died of hypothermia (bodyTemp=%.1f)", MoverDisplayName(i), i, m->bodyTemp);
                     TraceLog(LOG_WARNING, "%s (#%d) died of hypothermia", MoverDisplayName(i), i);
                     AddMessage("Your mover froze to death.", RED);
@@ -992,10 +1462,10 @@ void NeedsTick(void) {
         }
 
         // Sync equipped tool position with mover
-        if (m->equippedTool >= 0 && items[m->equippedTool].active) {
-            items[m->equippedTool].x = m->x;
-            items[m->equippedTool].y = m->y;
-            items[m->equippedTool].z = m->z;
+        if (m->equippedTool >= 0 && itemActive[m->equippedTool]) {
+            itemPosX[m->equippedTool] = moverPosX[i];
+            itemPosY[m->equippedTool] = moverPosY[i];
+            itemPosZ[m->equippedTool] = moverPosZ[i];
         }
 
         // Tick search cooldown
@@ -1010,19 +1480,18 @@ void PushMoversOutOfCell(int x, int y, int z) {
     int dx[] = {0, 0, -1, 1};
     int dy[] = {-1, 1, 0, 0};
     for (int i = 0; i < moverCount; i++) {
-        Mover* m = &movers[i];
-        if (!m->active) continue;
-        int mx = (int)(m->x / CELL_SIZE);
-        int my = (int)(m->y / CELL_SIZE);
-        int mz = (int)m->z;
+        if (!moverActive[i]) continue;
+        int mx = (int)(moverPosX[i] / CELL_SIZE);
+        int my = (int)(moverPosY[i] / CELL_SIZE);
+        int mz = (int)moverPosZ[i];
         if (mx == x && my == y && mz == z) {
             for (int d = 0; d < 4; d++) {
                 int nx = x + dx[d];
                 int ny = y + dy[d];
                 if (IsCellWalkableAt(z, ny, nx)) {
-                    m->x = nx * CELL_SIZE + CELL_SIZE * 0.5f;
-                    m->y = ny * CELL_SIZE + CELL_SIZE * 0.5f;
-                    m->needsRepath = true;
+                    moverPosX[i] = nx * CELL_SIZE + CELL_SIZE * 0.5f;
+                    moverPosY[i] = ny * CELL_SIZE + CELL_SIZE * 0.5f;
+                    moverNeedsRepath[i] = true;
                     break;
                 }
             }
@@ -1031,27 +1500,69 @@ void PushMoversOutOfCell(int x, int y, int z) {
 }
 
 void InvalidatePathsThroughCell(int x, int y, int z) {
-    for (int i = 0; i < moverCount; i++) {
-        Mover* m = &movers[i];
-        if (!m->active) continue;
-        if (m->pathLength == 0) continue;
-        
-        // Check if any waypoint in the path goes through this cell
-        for (int j = 0; j <= m->pathIndex; j++) {
-            if (moverPaths[i][j].x == x && moverPaths[i][j].y == y && moverPaths[i][j].z == z) {
-                m->needsRepath = true;
-                break;
-            }
-        }
+    if (DeferCellEdit(x, y, z, CELL_EDIT_PATHS)) return;
+    // Only movers whose path crosses the cell's chunk are checked (path_index.c)
+    MarkPathsThroughCell(x, y, z);
+}
+
+// Drop the mover's flow field reference (goal changed, arrived, deactivated)
+static void DetachMoverFlowField(int moverIdx) {
+    if (moverFlowField[moverIdx] == 0) return;
+    ReleaseFlowField(moverFlowField[moverIdx]);
+    moverFlowField[moverIdx] = 0;
+}
+
+// Follow the shared field for the mover's goal if one is cached or enough
+// movers asked for this goal recently. Returns true if the mover now has one.
+static bool AttachMoverFlowField(int moverIdx, Point start) {
+    Mover* m = &movers[moverIdx];
+    int handle = 0;
+    if (useFlowFields && (FindFlowField(m->goal) != 0 ||
+                          NoteFlowFieldDemand(m->goal, currentTick) >= FLOW_FIELD_MIN_MOVERS)) {
+        handle = AcquireFlowField(m->goal, start);  // may grow the field to cover start
     }
+    DetachMoverFlowField(moverIdx);
+    moverFlowField[moverIdx] = handle;
+    return handle != 0;
+}
+
+// Pull the next stretch of cells from the mover's field once its current
+// stretch is used up. Arrival (or a field that no longer fits) drops the field.
+static void RefillMoverFlowPath(int moverIdx, Point cell) {
+    Mover* m = &movers[moverIdx];
+    int handle = moverFlowField[moverIdx];
+    const FlowField* f = &flowFields[handle - 1];
+    bool sameGoal = f->active && f->goal.x == m->goal.x && f->goal.y == m->goal.y && f->goal.z == m->goal.z;
+    bool arrived = (cell.x == m->goal.x && cell.y == m->goal.y && cell.z == m->goal.z) ||
+                   (moverPathLength[moverIdx] > 0 && moverPaths[moverIdx][0].x == m->goal.x &&
+                    moverPaths[moverIdx][0].y == m->goal.y && moverPaths[moverIdx][0].z == m->goal.z);
+    if (arrived && sameGoal) {
+        DetachMoverFlowField(moverIdx);
+        return;
+    }
+
+    int len = sameGoal ? SampleFlowField(handle, cell, moverPaths[moverIdx], FLOW_FIELD_LOOKAHEAD + 1) : 0;
+    if (len == 0) {
+        DetachMoverFlowField(moverIdx);
+        moverPathLength[moverIdx] = 0;
+        moverPathIndex[moverIdx] = -1;
+        moverNeedsRepath[moverIdx] = true;
+        return;
+    }
+    moverPathLength[moverIdx] = len;
+    if (useStringPulling && moverPathLength[moverIdx] > 2) {
+        StringPullPath(moverPaths[moverIdx], &moverPathLength[moverIdx]);
+    }
+    moverPathIndex[moverIdx] = moverPathLength[moverIdx] - 1;
 }
 
 // Assign a new random goal to a mover and compute path
 static void AssignNewMoverGoal(Mover* m) {
+    int moverIdx = (int)(m - movers);
     Point newGoal;
-    int cx = (int)(m->x / CELL_SIZE);
-    int cy = (int)(m->y / CELL_SIZE);
-    int cz = (int)m->z;
+    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cz = (int)moverPosZ[moverIdx];
 
     // TODO: GetRandomReachableCell(cx, cy, cz) respects walls/rooms but disabled for testing
     bool hasZConnections = (ladderLinkCount > 0 || rampCount > 0);
@@ -1062,9 +1573,9 @@ static void AssignNewMoverGoal(Mover* m) {
     }
     m->goal = newGoal;
 
-    int currentX = (int)(m->x / CELL_SIZE);
-    int currentY = (int)(m->y / CELL_SIZE);
-    int currentZ = (int)m->z;
+    int currentX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int currentY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int currentZ = (int)moverPosZ[moverIdx];
     Point start = {currentX, currentY, currentZ};
 
     // HPA* and JPS+ now have native ramp support via RampLink edges
@@ -1073,49 +1584,49 @@ static void AssignNewMoverGoal(Mover* m) {
     Point tempPath[MAX_PATH];
     int len = FindPath(algo, start, newGoal, tempPath, MAX_PATH);
 
-    int moverIdx = (int)(m - movers);
-    m->pathLength = (len > MAX_MOVER_PATH) ? MAX_MOVER_PATH : len;
+    moverPathLength[moverIdx] = (len > MAX_MOVER_PATH) ? MAX_MOVER_PATH : len;
     // Path is stored goal-to-start: path[0]=goal, path[pathLen-1]=start
     // If truncating, keep the START end (high indices), not the goal end
-    int srcOffset = len - m->pathLength;
-    for (int j = 0; j < m->pathLength; j++) {
+    int srcOffset = len - moverPathLength[moverIdx];
+    for (int j = 0; j < moverPathLength[moverIdx]; j++) {
         moverPaths[moverIdx][j] = tempPath[srcOffset + j];
     }
 
-    if (useStringPulling && m->pathLength > 2) {
-        StringPullPath(moverPaths[moverIdx], &m->pathLength);
+    if (useStringPulling && moverPathLength[moverIdx] > 2) {
+        StringPullPath(moverPaths[moverIdx], &moverPathLength[moverIdx]);
     }
 
-    m->pathIndex = m->pathLength - 1;
-    m->needsRepath = false;
+    moverPathIndex[moverIdx] = moverPathLength[moverIdx] - 1;
+    moverNeedsRepath[moverIdx] = false;
 }
 
 void UpdateMovers(void) {
     float dt = gameDeltaTime;  // Use game time so movers scale with gameSpeed
     float dayLengthSpeedScale = 60.0f / dayLength;  // Normalize movement per game-hour
     
-    // Phase 1: LOS checks (optionally staggered - each mover checks every 3 frames)
+    // Phase 1: LOS checks (optionally staggered - each mover checks every
+    // LOS_STAGGER_TICKS frames). Terrain edits are caught by the path index, so
+    // this is only the backstop for drift off the path.
     PROFILE_BEGIN(LOS);
     for (int i = 0; i < moverCount; i++) {
         // Stagger: each mover checks on a different frame (if enabled)
-        if (useStaggeredUpdates && (currentTick % 3) != (i % 3)) continue;
+        if (useStaggeredUpdates && (currentTick % LOS_STAGGER_TICKS) != (unsigned long)(i % LOS_STAGGER_TICKS)) continue;
         
-        Mover* m = &movers[i];
-        if (!m->active || m->needsRepath) continue;
-        if (m->pathIndex < 0 || m->pathLength == 0) continue;
+        if (!moverActive[i] || moverNeedsRepath[i]) continue;
+        if (moverPathIndex[i] < 0 || moverPathLength[i] == 0) continue;
         
-        int currentX = (int)(m->x / CELL_SIZE);
-        int currentY = (int)(m->y / CELL_SIZE);
-        int currentZ = (int)m->z;
+        int currentX = (int)(moverPosX[i] / CELL_SIZE);
+        int currentY = (int)(moverPosY[i] / CELL_SIZE);
+        int currentZ = (int)moverPosZ[i];
         
         // Skip movers in non-walkable positions (handled in phase 3)
         // In DF mode, air cells above solid ARE walkable, so check walkability
         if (!IsCellWalkableAt(currentZ, currentY, currentX)) continue;
         
-        Point target = moverPaths[i][m->pathIndex];
+        Point target = moverPaths[i][moverPathIndex[i]];
         if (target.z == currentZ) {
             if (!HasLineOfSightLenient(currentX, currentY, target.x, target.y, currentZ)) {
-                m->needsRepath = true;
+                moverNeedsRepath[i] = true;
             }
         } else {
             // Z-transition: check if next waypoint after z-trans is reachable
@@ -1129,43 +1640,62 @@ void UpdateMovers(void) {
     // Phase 2: Avoidance computation (just compute, don't move yet)
     // Only recompute every 3 frames per mover, staggered by mover index
     static Vec2 avoidVectors[MAX_MOVERS];
+    static bool avoidWanted[MAX_MOVERS];  // recompute this frame
+    static bool avoidUsed[MAX_MOVERS];    // recompute or reuse the cached vector
     PROFILE_BEGIN(Avoid);
     if (useMoverAvoidance || useWallRepulsion) {
+        int wantedCount = 0;
         for (int i = 0; i < moverCount; i++) {
             Mover* m = &movers[i];
+            avoidWanted[i] = false;
+            avoidUsed[i] = false;
             
-            if (!m->active || m->needsRepath) {
+            if (!moverActive[i] || moverNeedsRepath[i]) {
                 avoidVectors[i] = (Vec2){0, 0};
                 continue;
             }
-            if ((m->pathIndex < 0 || m->pathLength == 0) &&
+            if ((moverPathIndex[i] < 0 || moverPathLength[i] == 0) &&
                 !(m->transportState == TRANSPORT_WAITING && !trainQueueEnabled)) {
                 avoidVectors[i] = (Vec2){0, 0};
                 continue;
             }
+            avoidUsed[i] = true;
             
             // Stagger: each mover recomputes on a different frame (based on index, if enabled)
             if (!useStaggeredUpdates || (currentTick % 3) == (i % 3)) {
+                avoidWanted[i] = true;
+                wantedCount++;
+            }
+        }
+        
+        // Separation for every mover due this frame, batched by grid cell
+        if (useMoverAvoidance && wantedCount > 0) {
+            ComputeMoverAvoidanceBatch(avoidWanted, avoidVectors);
+        }
+        
+        for (int i = 0; i < moverCount; i++) {
+            if (!avoidUsed[i]) continue;
+            if (avoidWanted[i]) {
                 // Recompute and cache
                 Vec2 avoid = {0, 0};
                 if (useMoverAvoidance) {
-                    avoid = ComputeMoverAvoidance(i);
-                    int moverZ = (int)m->z;
+                    avoid = avoidVectors[i];
+                    int moverZ = (int)moverPosZ[i];
                     if (useDirectionalAvoidance) {
-                        avoid = FilterAvoidanceByWalls(m->x, m->y, moverZ, avoid);
+                        avoid = FilterAvoidanceByWalls(moverPosX[i], moverPosY[i], moverZ, avoid);
                     }
                 }
                 if (useWallRepulsion) {
-                    Vec2 wallRepel = ComputeWallRepulsion(m->x, m->y, (int)m->z);
+                    Vec2 wallRepel = ComputeWallRepulsion(moverPosX[i], moverPosY[i], (int)moverPosZ[i]);
                     avoid.x += wallRepel.x * wallRepulsionStrength;
                     avoid.y += wallRepel.y * wallRepulsionStrength;
                 }
-                m->avoidX = avoid.x;
-                m->avoidY = avoid.y;
+                moverAvoidX[i] = avoid.x;
+                moverAvoidY[i] = avoid.y;
             }
             
             // Use cached value
-            avoidVectors[i] = (Vec2){m->avoidX, m->avoidY};
+            avoidVectors[i] = (Vec2){moverAvoidX[i], moverAvoidY[i]};
         }
     }
     PROFILE_END(Avoid);
@@ -1174,16 +1704,19 @@ void UpdateMovers(void) {
     PROFILE_BEGIN(Move);
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) continue;
+        if (!moverActive[i]) {
+            DetachMoverFlowField(i);
+            continue;
+        }
         
         // Decrement fall timer for visual feedback
         if (m->fallTimer > 0) {
             m->fallTimer -= dt;
         }
         
-        int currentX = (int)(m->x / CELL_SIZE);
-        int currentY = (int)(m->y / CELL_SIZE);
-        int currentZ = (int)m->z;
+        int currentX = (int)(moverPosX[i] / CELL_SIZE);
+        int currentY = (int)(moverPosY[i] / CELL_SIZE);
+        int currentZ = (int)moverPosZ[i];
 
         // Check if mover is in a non-walkable cell
         if (!IsCellWalkableAt(currentZ, currentY, currentX)) {
@@ -1198,8 +1731,8 @@ void UpdateMovers(void) {
                 
                 if (isAboveRamp) {
                     // Descend onto the ramp - NOT a fall, just z-transition
-                    m->z = (float)(currentZ - 1);
-                    m->needsRepath = true;
+                    moverPosZ[i] = (float)(currentZ - 1);
+                    moverNeedsRepath[i] = true;
                     // Don't continue - let them move on the ramp
                 } else if (!isRampExit) {
                     // Actual fall
@@ -1207,8 +1740,8 @@ void UpdateMovers(void) {
                         // Couldn't fall - maybe stuck inside solid ground
                         // Try to move up if the cell above is walkable
                         if (currentZ + 1 < gridDepth && IsCellWalkableAt(currentZ + 1, currentY, currentX)) {
-                            m->z = (float)(currentZ + 1);
-                            m->needsRepath = true;
+                            moverPosZ[i] = (float)(currentZ + 1);
+                            moverNeedsRepath[i] = true;
                         }
                     }
                     continue;
@@ -1223,7 +1756,7 @@ void UpdateMovers(void) {
             if (currentZ + 1 < gridDepth && IsCellWalkableAt(currentZ + 1, currentY, currentX) &&
                 FindRampPointingTo(currentX, currentY, currentZ, &rampX, &rampY)) {
                 // Found a ramp pointing to us - transition to z+1
-                m->z = (float)(currentZ + 1);
+                moverPosZ[i] = (float)(currentZ + 1);
 
                 handledByRamp = true;
             }
@@ -1240,35 +1773,35 @@ void UpdateMovers(void) {
                     int nx = currentX + dx[d];
                     int ny = currentY + dy[d];
                     if (IsCellWalkableAt(currentZ, ny, nx)) {
-                        m->x = nx * CELL_SIZE + CELL_SIZE * 0.5f;
-                        m->y = ny * CELL_SIZE + CELL_SIZE * 0.5f;
+                        moverPosX[i] = nx * CELL_SIZE + CELL_SIZE * 0.5f;
+                        moverPosY[i] = ny * CELL_SIZE + CELL_SIZE * 0.5f;
                         pushed = true;
                         break;
                     }
                 }
                 if (!pushed) {
-                    m->active = false;
+                    moverActive[i] = false;
                     EventLog("%s (#%d) deactivated: trapped in wall at (%d,%d,%d)", MoverDisplayName(i), i, currentX, currentY, currentZ);
                     TraceLog(LOG_WARNING, "Mover %d deactivated: stuck in blocked cell with no escape", i);
                     AddMessage(TextFormat("Mover %d lost: trapped in wall at (%d,%d,%d)",
                                          i, currentX, currentY, currentZ), RED);
                 }
-                m->needsRepath = true;
+                moverNeedsRepath[i] = true;
                 continue;
             }
         }
         
         // Don't move movers that are waiting for a repath - they'd walk on stale paths
         // But still accumulate stuck time for job stuck detection
-        if (m->needsRepath) {
-            if (m->currentJobId >= 0 && m->pathLength == 0) {
+        if (moverNeedsRepath[i]) {
+            if (m->currentJobId >= 0 && moverPathLength[i] == 0) {
                 m->timeWithoutProgress += dt;
             }
             continue;
         }
 
         // Clear stale paths on stuck jobless movers
-        if (m->currentJobId < 0 && m->pathLength > 0 && m->timeWithoutProgress > STUCK_REPATH_TIME) {
+        if (m->currentJobId < 0 && moverPathLength[i] > 0 && m->timeWithoutProgress > STUCK_REPATH_TIME) {
             ClearMoverPath(i);
             m->timeWithoutProgress = 0.0f;
         }
@@ -1297,7 +1830,7 @@ void UpdateMovers(void) {
                             m->transportStation = -1;
                             m->transportExitStation = -1;
                             m->transportTrainIdx = -1;
-                            m->needsRepath = true;
+                            moverNeedsRepath[i] = true;
                         }
                         break;
                     }
@@ -1315,19 +1848,19 @@ void UpdateMovers(void) {
                         float targetX, targetY;
                         StationGetQueuePosition(m->transportStation, queueIdx, &targetX, &targetY);
                         float lerpRate = 3.0f;
-                        m->x += (targetX - m->x) * lerpRate * dt;
-                        m->y += (targetY - m->y) * lerpRate * dt;
+                        moverPosX[i] += (targetX - moverPosX[i]) * lerpRate * dt;
+                        moverPosY[i] += (targetY - moverPosY[i]) * lerpRate * dt;
                     }
                 } else {
                     // Spread-out avoidance: gentle tether to platform center
                     float platCX = s->platX * CELL_SIZE + CELL_SIZE * 0.5f;
                     float platCY = s->platY * CELL_SIZE + CELL_SIZE * 0.5f;
-                    float tetherX = (platCX - m->x) * 0.5f;
-                    float tetherY = (platCY - m->y) * 0.5f;
+                    float tetherX = (platCX - moverPosX[i]) * 0.5f;
+                    float tetherY = (platCY - moverPosY[i]) * 0.5f;
                     float ax = avoidVectors[i].x * m->speed * 0.8f;
                     float ay = avoidVectors[i].y * m->speed * 0.8f;
-                    float newX = m->x + (tetherX + ax) * dt;
-                    float newY = m->y + (tetherY + ay) * dt;
+                    float newX = moverPosX[i] + (tetherX + ax) * dt;
+                    float newY = moverPosY[i] + (tetherY + ay) * dt;
                     float minX = s->platX * CELL_SIZE + CELL_SIZE * 0.1f;
                     float maxX = (s->platX + 1) * CELL_SIZE - CELL_SIZE * 0.1f;
                     float minY = s->platY * CELL_SIZE + CELL_SIZE * 0.1f;
@@ -1336,15 +1869,21 @@ void UpdateMovers(void) {
                     if (newX > maxX) newX = maxX;
                     if (newY < minY) newY = minY;
                     if (newY > maxY) newY = maxY;
-                    m->x = newX;
-                    m->y = newY;
+                    moverPosX[i] = newX;
+                    moverPosY[i] = newY;
                 }
             }
             continue;
         }
 
+        // Flow-field movers pull their next stretch of cells from the shared field
+        if ((moverPathIndex[i] < 0 || moverPathLength[i] == 0) && moverFlowField[i] != 0) {
+            RefillMoverFlowPath(i, (Point){currentX, currentY, currentZ});
+            if (moverNeedsRepath[i]) continue;
+        }
+
         // Handle movers that need a new goal (reached destination or have no path)
-        if (m->pathIndex < 0 || m->pathLength == 0) {
+        if (moverPathIndex[i] < 0 || moverPathLength[i] == 0) {
             // Transport: WALKING_TO_STATION mover arrived at platform → transition to WAITING
             if (m->transportState == TRANSPORT_WALKING_TO_STATION) {
                 int stIdx = m->transportStation;
@@ -1356,12 +1895,12 @@ void UpdateMovers(void) {
                     if (trainQueueEnabled) {
                         float qx, qy;
                         StationGetQueuePosition(stIdx, stations[stIdx].waitingCount - 1, &qx, &qy);
-                        m->x = qx;
-                        m->y = qy;
+                        moverPosX[i] = qx;
+                        moverPosY[i] = qy;
                     } else {
                         TrainStation* s = &stations[stIdx];
-                        m->x = s->platX * CELL_SIZE + CELL_SIZE * 0.5f;
-                        m->y = s->platY * CELL_SIZE + CELL_SIZE * 0.5f;
+                        moverPosX[i] = s->platX * CELL_SIZE + CELL_SIZE * 0.5f;
+                        moverPosY[i] = s->platY * CELL_SIZE + CELL_SIZE * 0.5f;
                     }
                 } else {
                     // Station gone — abandon transport
@@ -1371,7 +1910,7 @@ void UpdateMovers(void) {
                     m->transportStation = -1;
                     m->transportExitStation = -1;
                     m->transportTrainIdx = -1;
-                    m->needsRepath = true;
+                    moverNeedsRepath[i] = true;
                 }
                 continue;
             }
@@ -1383,7 +1922,7 @@ void UpdateMovers(void) {
                 // Trigger periodic repaths while stuck
                 if (m->timeWithoutProgress > STUCK_REPATH_TIME &&
                     fmodf(m->timeWithoutProgress, STUCK_REPATH_TIME) < dt) {
-                    m->needsRepath = true;
+                    moverNeedsRepath[i] = true;
                 }
             }
 
@@ -1394,11 +1933,11 @@ void UpdateMovers(void) {
                     continue;
                 }
                 AssignNewMoverGoal(m);
-                if (m->pathLength == 0) {
+                if (moverPathLength[i] == 0) {
                     // No path found, wait before retrying
                     if (useRandomizedCooldowns) {
                         // Randomize to avoid synchronized retries causing spikes
-                        m->repathCooldown = TICK_RATE + GetRandomValue(0, TICK_RATE - 1);
+                        m->repathCooldown = TICK_RATE + SimRandRange(RNG_MOVERS, 0, TICK_RATE - 1);
                     } else {
                         // Deterministic for tests
                         m->repathCooldown = REPATH_COOLDOWN_FRAMES;
@@ -1406,20 +1945,20 @@ void UpdateMovers(void) {
                 }
             } else if (m->currentJobId < 0 && m->freetimeState == FREETIME_NONE) {
                 // Only deactivate if truly idle (no job, no active needs)
-                m->active = false;
+                moverActive[i] = false;
             }
             continue;
         }
 
-        Point target = moverPaths[i][m->pathIndex];
+        Point target = moverPaths[i][moverPathIndex[i]];
 
         // Skip if marked for repath (by LOS check in phase 1, or wall-push above)
-        if (m->needsRepath) continue;
+        if (moverNeedsRepath[i]) continue;
         float tx = target.x * CELL_SIZE + CELL_SIZE * 0.5f;
         float ty = target.y * CELL_SIZE + CELL_SIZE * 0.5f;
 
-        float dxf = tx - m->x;
-        float dyf = ty - m->y;
+        float dxf = tx - moverPosX[i];
+        float dyf = ty - moverPosY[i];
         float distSq = dxf*dxf + dyf*dyf;
         float dist = distSq * fastInvSqrt(distSq);
 
@@ -1433,7 +1972,7 @@ void UpdateMovers(void) {
                 Job* job = GetJob(m->currentJobId);
                 if (job && job->carryingItem >= 0 && job->carryingItem < MAX_ITEMS) {
                     Item* item = &items[job->carryingItem];
-                    if (item->active && item->state == ITEM_CARRIED) {
+                    if (itemActive[job->carryingItem] && itemState[job->carryingItem] == ITEM_CARRIED) {
                         float w = (item->contentCount > 0)
                             ? GetContainerTotalWeight(job->carryingItem)
                             : ItemWeight(item->type) * item->stackCount;
@@ -1478,8 +2017,8 @@ void UpdateMovers(void) {
 
         if (dist < arrivalRadius) {
             bool didClimb = false;
-            if (target.z != (int)m->z) {
-                int cellZ = (int)m->z;
+            if (target.z != (int)moverPosZ[i]) {
+                int cellZ = (int)moverPosZ[i];
                 bool isLadderTransition = IsLadderCell(grid[cellZ][target.y][target.x]) &&
                                           IsLadderCell(grid[target.z][target.y][target.x]);
 
@@ -1500,16 +2039,16 @@ void UpdateMovers(void) {
 
                 if (isLadderTransition || isRampTransition) {
                     // Lock XY at waypoint and interpolate Z over time
-                    m->x = target.x * CELL_SIZE + CELL_SIZE * 0.5f;
-                    m->y = target.y * CELL_SIZE + CELL_SIZE * 0.5f;
+                    moverPosX[i] = target.x * CELL_SIZE + CELL_SIZE * 0.5f;
+                    moverPosY[i] = target.y * CELL_SIZE + CELL_SIZE * 0.5f;
                     float zDir = (target.z > cellZ) ? 1.0f : -1.0f;
                     float zRate = effectiveSpeed / (float)CELL_SIZE;
-                    m->z += zDir * zRate * dt;
-                    bool zArrived = (zDir > 0.0f) ? (m->z >= (float)target.z)
-                                                   : (m->z <= (float)target.z);
+                    moverPosZ[i] += zDir * zRate * dt;
+                    bool zArrived = (zDir > 0.0f) ? (moverPosZ[i] >= (float)target.z)
+                                                   : (moverPosZ[i] <= (float)target.z);
                     if (zArrived) {
-                        m->z = (float)target.z;
-                        m->pathIndex--;
+                        moverPosZ[i] = (float)target.z;
+                        moverPathIndex[i]--;
                         m->timeNearWaypoint = 0.0f;
                     }
                     didClimb = true;
@@ -1517,10 +2056,10 @@ void UpdateMovers(void) {
             }
             if (!didClimb) {
                 if (shouldSnap) {
-                    m->x = tx;
-                    m->y = ty;
+                    moverPosX[i] = tx;
+                    moverPosY[i] = ty;
                 }
-                m->pathIndex--;
+                moverPathIndex[i]--;
                 m->timeNearWaypoint = 0.0f;
             }
         } else {
@@ -1551,9 +2090,9 @@ void UpdateMovers(void) {
             }
             
             // Apply movement with wall sliding (but allow falling through air)
-            float newX = m->x + vx * dt;
-            float newY = m->y + vy * dt;
-            int mz = (int)m->z;
+            float newX = moverPosX[i] + vx * dt;
+            float newY = moverPosY[i] + vy * dt;
+            int mz = (int)moverPosZ[i];
             
             // For z-level transitions, check if target cell is a ladder or ramp
             bool targetIsZTransition = (target.z != mz);
@@ -1610,13 +2149,13 @@ void UpdateMovers(void) {
                 
                 if (canMove) {
                     // Normal movement
-                    m->x = newX;
-                    m->y = newY;
+                    moverPosX[i] = newX;
+                    moverPosY[i] = newY;
                     // If we're descending onto a ramp, also transition z
                     if (targetIsZTransition && target.z < mz) {
                         bool rampBelow = (mz > 0) && CellIsDirectionalRamp(grid[mz-1][newCellY][newCellX]);
                         if (rampBelow) {
-                            m->z = (float)(mz - 1);
+                            moverPosZ[i] = (float)(mz - 1);
                         }
                     }
                 } else if (!CellBlocksMovement(grid[mz][newCellY][newCellX]) && 
@@ -1624,44 +2163,44 @@ void UpdateMovers(void) {
                     // Moving into non-blocking, non-walkable cell (e.g., air without solid below)
                     // Check if there's a ramp below - if so, this is a ramp descent, not a fall
                     bool hasRampBelow = (mz > 0) && CellIsDirectionalRamp(grid[mz-1][newCellY][newCellX]);
-                    m->x = newX;
-                    m->y = newY;
+                    moverPosX[i] = newX;
+                    moverPosY[i] = newY;
                     if (hasRampBelow) {
                         // Ramp descent - transition to ramp z-level without fall penalty
-                        m->z = (float)(mz - 1);
-                        m->needsRepath = true;
+                        moverPosZ[i] = (float)(mz - 1);
+                        moverNeedsRepath[i] = true;
                     } else {
                         // Actual fall - find ground
                         TryFallToGround(m, newCellX, newCellY);
                     }
                 } else {
                     // Wall or out of bounds - try sliding
-                    int xOnlyCellY = (int)(m->y / CELL_SIZE);
-                    int yOnlyCellX = (int)(m->x / CELL_SIZE);
+                    int xOnlyCellY = (int)(moverPosY[i] / CELL_SIZE);
+                    int yOnlyCellX = (int)(moverPosX[i] / CELL_SIZE);
                     bool xOnlyOk = IsCellWalkableAt(mz, xOnlyCellY, newCellX);
                     bool yOnlyOk = IsCellWalkableAt(mz, newCellY, yOnlyCellX);
                     
                     if (xOnlyOk && yOnlyOk) {
                         if (fabsf(vx) > fabsf(vy)) {
-                            m->x = newX;
+                            moverPosX[i] = newX;
                         } else {
-                            m->y = newY;
+                            moverPosY[i] = newY;
                         }
                     } else if (xOnlyOk) {
-                        m->x = newX;
+                        moverPosX[i] = newX;
                     } else if (yOnlyOk) {
-                        m->y = newY;
+                        moverPosY[i] = newY;
                     }
                 }
             } else {
-                m->x = newX;
-                m->y = newY;
+                moverPosX[i] = newX;
+                moverPosY[i] = newY;
             }
             
             // Trample ground where mover is standing (creates paths over time)
-            int trampleCellX = (int)(m->x / CELL_SIZE);
-            int trampleCellY = (int)(m->y / CELL_SIZE);
-            int trampleCellZ = (int)m->z;
+            int trampleCellX = (int)(moverPosX[i] / CELL_SIZE);
+            int trampleCellY = (int)(moverPosY[i] / CELL_SIZE);
+            int trampleCellZ = (int)moverPosZ[i];
             TrampleGround(trampleCellX, trampleCellY, trampleCellZ);
             MoverTrackDirt(i, trampleCellX, trampleCellY, trampleCellZ);
 
@@ -1671,15 +2210,15 @@ void UpdateMovers(void) {
             }
             
             // Track progress for stuck detection
-            float dx = m->x - m->lastX;
-            float dy = m->y - m->lastY;
+            float dx = moverPosX[i] - m->lastX;
+            float dy = moverPosY[i] - m->lastY;
             float movedDistSq = dx * dx + dy * dy;
             
             if (movedDistSq >= STUCK_MIN_DISTANCE * STUCK_MIN_DISTANCE) {
                 // Made progress, reset timer and update last position
                 m->timeWithoutProgress = 0.0f;
-                m->lastX = m->x;
-                m->lastY = m->y;
+                m->lastX = moverPosX[i];
+                m->lastY = moverPosY[i];
             } else {
                 // No significant movement, accumulate stuck time
                 m->timeWithoutProgress += dt;
@@ -1691,9 +2230,9 @@ void UpdateMovers(void) {
                 if (m->timeWithoutProgress > STUCK_REPATH_TIME && 
                     fmodf(m->timeWithoutProgress, STUCK_REPATH_TIME) < dt) {
                     // Trigger repath periodically while stuck (every STUCK_REPATH_TIME seconds)
-                    m->needsRepath = true;
-                    m->lastX = m->x;
-                    m->lastY = m->y;
+                    moverNeedsRepath[i] = true;
+                    m->lastX = moverPosX[i];
+                    m->lastY = moverPosY[i];
                 }
             }
         }
@@ -1701,130 +2240,342 @@ void UpdateMovers(void) {
     PROFILE_END(Move);
 }
 
-void ProcessMoverRepaths(void) {
-    int repathsThisFrame = 0;
+// Splice a fresh search from start to waypoint `rejoin` onto the path beyond
+// it. Returns false (path untouched) if the search fails or would not fit.
+static bool RepairMoverPath(int i, Point start, int rejoin) {
+    Mover* m = &movers[i];
+    Point tempPath[MAX_PATH];
+    int len = FindPath(moverPathAlgorithm, start, moverPaths[i][rejoin], tempPath, MAX_PATH);
+    if (len == 0 || rejoin + len > MAX_MOVER_PATH) return false;
 
-    for (int i = 0; i < moverCount && repathsThisFrame < MAX_REPATHS_PER_FRAME; i++) {
-        Mover* m = &movers[i];
-        if (!m->active || !m->needsRepath) continue;
+    // tempPath runs rejoin waypoint -> start, replacing everything after the rejoin waypoint
+    for (int j = 0; j < len; j++) {
+        moverPaths[i][rejoin + j] = tempPath[j];
+    }
+    moverPathLength[i] = rejoin + len;
+    if (useStringPulling && moverPathLength[i] > 2) {
+        StringPullPath(moverPaths[i], &moverPathLength[i]);
+    }
+    moverPathIndex[i] = moverPathLength[i] - 1;
+    moverNeedsRepath[i] = false;
+    m->repathCooldown = REPATH_COOLDOWN_FRAMES;
+    pathRepairCount++;
+    return true;
+}
 
-        if (m->repathCooldown > 0) {
-            m->repathCooldown--;
-            continue;
-        }
+// Run one mover's repath. Returns false when it was only a flow field sample
+// that did not (re)build the field, which the fixed-count mode does not charge.
+static bool RepathMover(int i) {
+    Mover* m = &movers[i];
+    int currentX = (int)(moverPosX[i] / CELL_SIZE);
+    int currentY = (int)(moverPosY[i] / CELL_SIZE);
+    int currentZ = (int)moverPosZ[i];
 
-        int currentX = (int)(m->x / CELL_SIZE);
-        int currentY = (int)(m->y / CELL_SIZE);
-        int currentZ = (int)m->z;
+    Point start = {currentX, currentY, currentZ};
 
-        Point start = {currentX, currentY, currentZ};
-        
-        // HPA* now supports ramp links for cross-z paths, no need to force A*
-        PathAlgorithm algo = moverPathAlgorithm;
-        
-        Point tempPath[MAX_PATH];
-        double pathStart = GetTime();
-        int len = FindPath(algo, start, m->goal, tempPath, MAX_PATH);
-        double pathTime = (GetTime() - pathStart) * 1000.0;
-
-        // A* fallback disabled: HPA* handles ramps correctly now.
-        // The fallback was burning 6-14s on large grids confirming unreachable paths.
-        // Re-enable if HPA* misses valid ramp paths (check test_pathfinding.c hpa_fallback).
-        // if (len == 0 && algo == PATH_ALGO_HPA && rampCount > 0) {
-        //     repathFallbackCount++;
-        //     double astarStart = GetTime();
-        //     len = FindPath(PATH_ALGO_ASTAR, start, m->goal, tempPath, MAX_PATH);
-        //     double astarTime = (GetTime() - astarStart) * 1000.0;
-        //     if (astarTime > 50.0) {
-        //         TraceLog(LOG_WARNING, "SLOW A* fallback: mover %d, %.1fms, start(%d,%d,z%d)->goal(%d,%d,z%d), len=%d",
-        //             i, astarTime, start.x, start.y, start.z, m->goal.x, m->goal.y, m->goal.z, len);
-        //     }
-        // } else
-        if (len > 0) {
-            repathHpaSuccessCount++;
+    // A cell edit broke the path: re-search only up to the waypoint past the break
+    int rejoin = TakePathRepairPoint(i);
+    if (rejoin >= 0 && moverFlowField[i] == 0 && RepairMoverPath(i, start, rejoin)) return true;
+    
+    // HPA* now supports ramp links for cross-z paths, no need to force A*
+    PathAlgorithm algo = moverPathAlgorithm;
+    
+    Point tempPath[MAX_PATH];
+    double pathStart = GetTime();
+    int len = 0;
+
+    // Popular goals share one flow field; a sample is a pointer walk, so it
+    // only counts against the repath budget when the field had to be (re)built
+    int fieldBuildsBefore = flowFieldBuildCount;
+    if (AttachMoverFlowField(i, start)) {
+        len = SampleFlowField(moverFlowField[i], start, tempPath, FLOW_FIELD_LOOKAHEAD + 1);
+        if (len == 0) DetachMoverFlowField(i);  // field can't route start: fall back to own path
+    }
+    bool fromFlowField = (len > 0);
+    if (!fromFlowField) len = FindPath(algo, start, m->goal, tempPath, MAX_PATH);
+    double pathTime = (GetTime() - pathStart) * 1000.0;
+
+    // A* fallback disabled: HPA* handles ramps correctly now.
+    // The fallback was burning 6-14s on large grids confirming unreachable paths.
+    // Re-enable if HPA* misses valid ramp paths (check test_pathfinding.c hpa_fallback).
+    // if (len == 0 && algo == PATH_ALGO_HPA && rampCount > 0) {
+    //     repathFallbackCount++;
+    //     double astarStart = GetTime();
+    //     len = FindPath(PATH_ALGO_ASTAR, start, m->goal, tempPath, MAX_PATH);
+    //     double astarTime = (GetTime() - astarStart) * 1000.0;
+    //     if (astarTime > 50.0) {
+    //         TraceLog(LOG_WARNING, "SLOW A* fallback: mover %d, %.1fms, start(%d,%d,z%d)->goal(%d,%d,z%d), len=%d",
+    //             i, astarTime, start.x, start.y, start.z, m->goal.x, m->goal.y, m->goal.z, len);
+    //     }
+    // } else
+    if (len > 0 && !fromFlowField) {
+        repathHpaSuccessCount++;
+    }
+    
+    if (pathTime > 50.0 && !fromFlowField) {
+        TraceLog(LOG_WARNING, "SLOW HPA: mover %d, %.1fms, start(%d,%d,z%d)->goal(%d,%d,z%d), len=%d",
+            i, pathTime, start.x, start.y, start.z, m->goal.x, m->goal.y, m->goal.z, len);
+    }
+
+    moverPathLength[i] = (len > MAX_MOVER_PATH) ? MAX_MOVER_PATH : len;
+    // Path is stored goal-to-start: path[0]=goal, path[pathLen-1]=start
+    // If truncating, keep the START end (high indices), not the goal end
+    int srcOffset = len - moverPathLength[i];
+    for (int j = 0; j < moverPathLength[i]; j++) {
+        moverPaths[i][j] = tempPath[srcOffset + j];
+    }
+
+    if (moverPathLength[i] == 0) {
+        // Repath failed - check if goal cell itself is now a wall
+        if (!IsCellWalkableAt(m->goal.z, m->goal.y, m->goal.x)) {
+            // Goal is unwalkable (wall placed on it)
+            // Only assign new random goal if mover has no job - otherwise let job system handle it
+            if (m->currentJobId < 0) {
+                Point oldGoal = m->goal;
+                AssignNewMoverGoal(m);
+                if (moverPathLength[i] > 0) {
+                    AddMessage(TextFormat("Mover %d: goal (%d,%d) became wall, reassigned",
+                                          i, oldGoal.x, oldGoal.y), ORANGE);
+                    moverNeedsRepath[i] = false;
+                    return true;
+                }
+            }
+            // Mover has job or new goal unreachable - fall through to retry logic
         }
         
-        if (pathTime > 50.0) {
-            TraceLog(LOG_WARNING, "SLOW HPA: mover %d, %.1fms, start(%d,%d,z%d)->goal(%d,%d,z%d), len=%d",
-                i, pathTime, start.x, start.y, start.z, m->goal.x, m->goal.y, m->goal.z, len);
+        // Goal is still walkable but path blocked - retry after cooldown
+        moverPathIndex[i] = -1;
+        moverNeedsRepath[i] = true;  // Keep trying
+        if (useRandomizedCooldowns) {
+            m->repathCooldown = TICK_RATE + SimRandRange(RNG_MOVERS, 0, TICK_RATE - 1);
+        } else {
+            m->repathCooldown = REPATH_COOLDOWN_FRAMES;
         }
+        return true;
+    }
+
+    if (useStringPulling && moverPathLength[i] > 2) {
+        StringPullPath(moverPaths[i], &moverPathLength[i]);
+    }
 
-        m->pathLength = (len > MAX_MOVER_PATH) ? MAX_MOVER_PATH : len;
-        // Path is stored goal-to-start: path[0]=goal, path[pathLen-1]=start
-        // If truncating, keep the START end (high indices), not the goal end
-        int srcOffset = len - m->pathLength;
-        for (int j = 0; j < m->pathLength; j++) {
-            moverPaths[i][j] = tempPath[srcOffset + j];
+    moverPathIndex[i] = moverPathLength[i] - 1;
+    moverNeedsRepath[i] = false;
+    m->repathCooldown = REPATH_COOLDOWN_FRAMES;
+
+    // Transport check: after successful pathfind, consider using train
+    if (m->transportState == TRANSPORT_NONE && ShouldUseTrain(i)) {
+        int mx = (int)(moverPosX[i] / CELL_SIZE);
+        int my = (int)(moverPosY[i] / CELL_SIZE);
+        int mz = (int)moverPosZ[i];
+        int entryStation = FindNearestStation(mx, my, mz, TRANSPORT_STATION_RADIUS);
+        int exitStation = FindNearestStation(m->goal.x, m->goal.y, mz, TRANSPORT_STATION_RADIUS);
+        if (entryStation >= 0 && exitStation >= 0 && entryStation != exitStation) {
+            // Save original goal, redirect to platform
+            m->transportFinalGoal = m->goal;
+            m->transportState = TRANSPORT_WALKING_TO_STATION;
+            m->transportStation = entryStation;
+            m->transportExitStation = exitStation;
+            m->transportTrainIdx = -1;
+            EventLog("Mover %d (%s) using train: entry=%d exit=%d, goal=(%d,%d,z%d)",
+                     i, m->name, entryStation, exitStation,
+                     m->transportFinalGoal.x, m->transportFinalGoal.y, m->transportFinalGoal.z);
+            // Redirect goal to nearest platform cell
+            int nearPlatX, nearPlatY;
+            GetNearestPlatformCell(entryStation, mx, my, &nearPlatX, &nearPlatY);
+            m->goal = (Point){nearPlatX, nearPlatY, stations[entryStation].z};
+            // Repath to new goal
+            moverNeedsRepath[i] = true;
+            m->repathCooldown = 0;
         }
+    }
 
-        if (m->pathLength == 0) {
-            // Repath failed - check if goal cell itself is now a wall
-            if (!IsCellWalkableAt(m->goal.z, m->goal.y, m->goal.x)) {
-                // Goal is unwalkable (wall placed on it)
-                // Only assign new random goal if mover has no job - otherwise let job system handle it
-                if (m->currentJobId < 0) {
-                    Point oldGoal = m->goal;
-                    AssignNewMoverGoal(m);
-                    if (m->pathLength > 0) {
-                        AddMessage(TextFormat("Mover %d: goal (%d,%d) became wall, reassigned",
-                                              i, oldGoal.x, oldGoal.y), ORANGE);
-                        m->needsRepath = false;
-                        repathsThisFrame++;
-                        continue;
-                    }
-                }
-                // Mover has job or new goal unreachable - fall through to retry logic
-            }
-            
-            // Goal is still walkable but path blocked - retry after cooldown
-            m->pathIndex = -1;
-            m->needsRepath = true;  // Keep trying
-            if (useRandomizedCooldowns) {
-                m->repathCooldown = TICK_RATE + GetRandomValue(0, TICK_RATE - 1);
-            } else {
-                m->repathCooldown = REPATH_COOLDOWN_FRAMES;
-            }
-            repathsThisFrame++;
+    return !fromFlowField || flowFieldBuildCount != fieldBuildsBefore;
+}
+
+// =============================================================================
+// Repath scheduling
+// =============================================================================
+// Movers waiting for a path form a priority queue rebuilt each tick: danger
+// first, then movers carrying an item, then movers with a job, then idle
+// ones, each raised by the ticks already waited so nobody starves. By
+// default MAX_REPATHS_PER_FRAME searches run per tick, so a tick does the
+// same work on every machine. The windowed game opts into a wall-time budget
+// (repathBudgetMs, on the profiler's monotonic clock): searches run until it
+// is spent, and a tick that overruns it (one slow HPA* query) pays the excess
+// back from the following ticks, so the cost of a long search is spread out
+// instead of stacking more searches behind it.
+
+typedef struct {
+    int mover;
+    int priority;
+} RepathRequest;
+
+float repathBudgetMs = 0.0f;
+RepathStats repathStats;
+static RepathRequest repathQueue[MAX_MOVERS];
+static unsigned long repathQueuedAt[MAX_MOVERS];  // tick + 1 the request became eligible, 0 = not queued
+static double repathDebtMs;                       // overrun still to be paid from later budgets
+static uint8_t repathWaitSamples[REPATH_WAIT_WINDOW];
+static int repathWaitHist[REPATH_WAIT_MAX + 1];
+static int repathWaitNext;
+static int repathWaitFilled;
+
+RepathPriority GetRepathPriority(int moverIdx) {
+    const Mover* m = &movers[moverIdx];
+    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cz = (int)moverPosZ[moverIdx];
+    if (HasFire(cx, cy, cz) || GetWaterLevel(cx, cy, cz) >= WATER_BLOCKS_MOVEMENT) {
+        return REPATH_PRIORITY_DANGER;
+    }
+    if (m->currentJobId >= 0) {
+        Job* job = GetJob(m->currentJobId);
+        if (job && job->carryingItem >= 0) return REPATH_PRIORITY_CARRYING;
+        return REPATH_PRIORITY_JOB;
+    }
+    return REPATH_PRIORITY_IDLE;
+}
+
+// Max-heap order: higher priority first, lower mover index breaks ties
+static inline bool RepathBefore(const RepathRequest* a, const RepathRequest* b) {
+    if (a->priority != b->priority) return a->priority > b->priority;
+    return a->mover < b->mover;
+}
+
+static void RepathSiftDown(int i, int n) {
+    RepathRequest item = repathQueue[i];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= n) break;
+        if (child + 1 < n && RepathBefore(&repathQueue[child + 1], &repathQueue[child])) child++;
+        if (!RepathBefore(&repathQueue[child], &item)) break;
+        repathQueue[i] = repathQueue[child];
+        i = child;
+    }
+    repathQueue[i] = item;
+}
+
+static int RepathPop(int* n) {
+    int mover = repathQueue[0].mover;
+    (*n)--;
+    if (*n > 0) {
+        repathQueue[0] = repathQueue[*n];
+        RepathSiftDown(0, *n);
+    }
+    return mover;
+}
+
+static void RecordRepathWait(unsigned long waitTicks) {
+    int w = waitTicks > REPATH_WAIT_MAX ? REPATH_WAIT_MAX : (int)waitTicks;
+    if (repathWaitFilled == REPATH_WAIT_WINDOW) {
+        repathWaitHist[repathWaitSamples[repathWaitNext]]--;
+    } else {
+        repathWaitFilled++;
+    }
+    repathWaitSamples[repathWaitNext] = (uint8_t)w;
+    repathWaitHist[w]++;
+    repathWaitNext = (repathWaitNext + 1) % REPATH_WAIT_WINDOW;
+}
+
+int GetRepathWaitPercentile(int percent) {
+    if (repathWaitFilled == 0) return 0;
+    int rank = (repathWaitFilled * percent + 99) / 100;
+    if (rank < 1) rank = 1;
+    int seen = 0;
+    for (int w = 0; w <= REPATH_WAIT_MAX; w++) {
+        seen += repathWaitHist[w];
+        if (seen >= rank) return w;
+    }
+    return REPATH_WAIT_MAX;
+}
+
+void ResetRepathScheduler(void) {
+    memset(repathQueuedAt, 0, sizeof(repathQueuedAt));
+    memset(repathWaitHist, 0, sizeof(repathWaitHist));
+    memset(&repathStats, 0, sizeof(repathStats));
+    repathWaitNext = 0;
+    repathWaitFilled = 0;
+    repathDebtMs = 0.0;
+}
+
+void RenumberRepathScheduler(const int* moverMap, int oldCount) {
+    static unsigned long oldQueuedAt[MAX_MOVERS];
+    memcpy(oldQueuedAt, repathQueuedAt, oldCount * sizeof(unsigned long));
+    memset(repathQueuedAt, 0, oldCount * sizeof(unsigned long));
+    for (int i = 0; i < oldCount; i++) {
+        if (moverMap[i] >= 0) repathQueuedAt[moverMap[i]] = oldQueuedAt[i];
+    }
+}
+
+void ProcessMoverRepaths(void) {
+    int queued = 0;
+    for (int i = 0; i < moverCount; i++) {
+        Mover* m = &movers[i];
+        if (!moverActive[i] || !moverNeedsRepath[i]) {
+            repathQueuedAt[i] = 0;
             continue;
         }
 
-        if (useStringPulling && m->pathLength > 2) {
-            StringPullPath(moverPaths[i], &m->pathLength);
+        if (m->repathCooldown > 0) {
+            m->repathCooldown--;
+            continue;
         }
 
-        m->pathIndex = m->pathLength - 1;
-        m->needsRepath = false;
-        m->repathCooldown = REPATH_COOLDOWN_FRAMES;
-
-        // Transport check: after successful pathfind, consider using train
-        if (m->transportState == TRANSPORT_NONE && ShouldUseTrain(i)) {
-            int mx = (int)(m->x / CELL_SIZE);
-            int my = (int)(m->y / CELL_SIZE);
-            int mz = (int)m->z;
-            int entryStation = FindNearestStation(mx, my, mz, TRANSPORT_STATION_RADIUS);
-            int exitStation = FindNearestStation(m->goal.x, m->goal.y, mz, TRANSPORT_STATION_RADIUS);
-            if (entryStation >= 0 && exitStation >= 0 && entryStation != exitStation) {
-                // Save original goal, redirect to platform
-                m->transportFinalGoal = m->goal;
-                m->transportState = TRANSPORT_WALKING_TO_STATION;
-                m->transportStation = entryStation;
-                m->transportExitStation = exitStation;
-                m->transportTrainIdx = -1;
-                EventLog("Mover %d (%s) using train: entry=%d exit=%d, goal=(%d,%d,z%d)",
-                         i, m->name, entryStation, exitStation,
-                         m->transportFinalGoal.x, m->transportFinalGoal.y, m->transportFinalGoal.z);
-                // Redirect goal to nearest platform cell
-                int nearPlatX, nearPlatY;
-                GetNearestPlatformCell(entryStation, mx, my, &nearPlatX, &nearPlatY);
-                m->goal = (Point){nearPlatX, nearPlatY, stations[entryStation].z};
-                // Repath to new goal
-                m->needsRepath = true;
-                m->repathCooldown = 0;
-            }
-        }
+        if (repathQueuedAt[i] == 0) repathQueuedAt[i] = currentTick + 1;
+        unsigned long waited = currentTick + 1 - repathQueuedAt[i];
+        if (waited > REPATH_MAX_AGE_TICKS) waited = REPATH_MAX_AGE_TICKS;
+        repathQueue[queued].mover = i;
+        repathQueue[queued].priority = (int)GetRepathPriority(i) * REPATH_PRIORITY_TICKS + (int)waited;
+        queued++;
+    }
+    for (int i = queued / 2 - 1; i >= 0; i--) RepathSiftDown(i, queued);
+
+    // Fixed-count mode (budget <= 0) keeps the old deterministic throughput
+    bool timed = repathBudgetMs > 0.0f;
+    double available = repathBudgetMs - repathDebtMs;
+    if (timed && available <= 0.0) {
+        repathDebtMs = -available;  // still paying back an earlier overrun
+        available = 0.0;
+    }
+
+    uint64_t tickStart = ProfileNowNs();
+    double elapsedMs = 0.0;
+    int remaining = queued;
+    int searches = 0;
+    int charged = 0;
+    while (remaining > 0) {
+        if (timed ? elapsedMs >= available : charged >= MAX_REPATHS_PER_FRAME) break;
+        int i = RepathPop(&remaining);
+        RecordRepathWait(currentTick + 1 - repathQueuedAt[i]);
+        repathQueuedAt[i] = 0;
+
+        uint64_t searchStart = ProfileNowNs();
+        if (RepathMover(i)) charged++;
+        searches++;
+        uint64_t now = ProfileNowNs();
+        double searchMs = (double)(now - searchStart) / 1e6;
+        if (searchMs > repathStats.slowestSearchMs) repathStats.slowestSearchMs = (float)searchMs;
+        elapsedMs = (double)(now - tickStart) / 1e6;
+    }
 
-        repathsThisFrame++;
+    if (timed && available > 0.0) {
+        double excess = elapsedMs - available;
+        double maxDebt = repathBudgetMs * REPATH_MAX_DEBT_TICKS;
+        repathDebtMs = excess > 0.0 ? (excess < maxDebt ? excess : maxDebt) : 0.0;
     }
+    bool overrun = timed && elapsedMs > repathBudgetMs;
+    if (overrun) repathStats.overruns++;
+
+    repathStats.queueDepth = remaining;
+    repathStats.searchesLastTick = searches;
+    repathStats.lastTickMs = (float)elapsedMs;
+    repathStats.debtMs = (float)repathDebtMs;
+
+    PROFILE_COUNT_SET(repath_queue, remaining);
+    PROFILE_COUNT(repath_searches, searches);
+    PROFILE_COUNT(repath_overruns, overrun ? 1 : 0);
+    PROFILE_COUNT_SET(repath_wait_p50, GetRepathWaitPercentile(50));
+    PROFILE_COUNT_SET(repath_wait_p95, GetRepathWaitPercentile(95));
 }
 
 void TickWithDt(float dt) {
@@ -1898,11 +2649,25 @@ void TickWithDt(float dt) {
     // Farm tick (weed accumulation)
     FarmTick(dt);
 
+    // Periodic compaction of the item and mover pools into cell order (off by default)
+    if (itemRenumberInterval > 0 && currentTick % (unsigned long)itemRenumberInterval == 0) {
+        RenumberItemsByCell();
+    }
+    if (moverRenumberInterval > 0 && currentTick % (unsigned long)moverRenumberInterval == 0) {
+        RenumberMoversByCell();
+    }
+
     PROFILE_BEGIN(Grid);
     BuildMoverSpatialGrid();
     BuildItemSpatialGrid();
     PROFILE_END(Grid);
     
+    // Catch up the chunk -> path index, then mark paths broken by cell edits
+    PROFILE_BEGIN(PathIndex);
+    SyncPathIndex();
+    ApplyPathCellEdits();
+    PROFILE_END(PathIndex);
+
     PROFILE_BEGIN(Repath);
     ProcessMoverRepaths();
     PROFILE_END(Repath);
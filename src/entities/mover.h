@@ -3,8 +3,10 @@
 
 #include "../world/grid.h"
 #include "../world/pathfinding.h"
+#include "../world/flow_field.h"
 #include "../simulation/mood.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 // Cell size in pixels (for position calculations)
 #define CELL_SIZE 32
@@ -13,8 +15,17 @@
 #define MAX_MOVERS 10000
 #define MAX_MOVER_PATH 1024
 #define MOVER_SPEED 200.0f
-#define MAX_REPATHS_PER_FRAME 10
+#define MAX_REPATHS_PER_FRAME 10  // repaths per tick when repathBudgetMs <= 0
+#define REPATH_BUDGET_INTERACTIVE_MS 2.0f  // repathBudgetMs the windowed game runs with
 #define REPATH_COOLDOWN_FRAMES 30
+#define LOS_STAGGER_TICKS 6        // staggered LOS re-check interval; cell edits reach paths via path_index
+
+// Repath scheduler: priority classes are REPATH_PRIORITY_TICKS of waiting apart
+#define REPATH_PRIORITY_TICKS 60   // an idle mover waiting 1s ranks with a fresh job mover
+#define REPATH_MAX_AGE_TICKS 600   // waiting stops raising priority after this
+#define REPATH_MAX_DEBT_TICKS 8    // overrun carried forward is capped at this many budgets
+#define REPATH_WAIT_WINDOW 256     // recent requests kept for wait percentiles
+#define REPATH_WAIT_MAX 255        // waits are recorded in ticks, clamped here
 
 // Spatial grid for neighbor queries (used by avoidance)
 // Cell size ~2x AVOID_RADIUS keeps cell count manageable for large worlds
@@ -54,14 +65,24 @@ typedef enum {
 } FreetimeState;
 
 
-// Mover struct (no Color - that's raylib specific, for rendering only)
+// Mover data is split by how often the sim touches it. The fields the
+// movement and avoidance loops read every tick (position, avoidance vector,
+// path cursor, active/repath flags) live in parallel arrays indexed by mover,
+// so a sweep streams only those bytes. Mover holds the cold rest (needs, job,
+// identity, mood). Both sides share the mover index.
+extern float moverPosX[MAX_MOVERS];
+extern float moverPosY[MAX_MOVERS];
+extern float moverPosZ[MAX_MOVERS];        // z-level (float for smooth falling)
+extern float moverAvoidX[MAX_MOVERS];      // cached avoidance vector (recomputed every N frames)
+extern float moverAvoidY[MAX_MOVERS];
+extern int moverPathIndex[MAX_MOVERS];     // next waypoint in moverPaths (counts down, -1 = done)
+extern int moverPathLength[MAX_MOVERS];
+extern bool moverActive[MAX_MOVERS];
+extern bool moverNeedsRepath[MAX_MOVERS];
+
+// Mover struct (cold fields; no Color - that's raylib specific, for rendering only)
 typedef struct Mover {
-    float x, y, z;              // z for future multi-level support (always 0 for now)
     Point goal;
-    int pathLength;
-    int pathIndex;
-    bool active;
-    bool needsRepath;
     int repathCooldown;
     float speed;
     // Knot detection: time spent near current waypoint without reaching it
@@ -85,8 +106,6 @@ typedef struct Mover {
     // Body temperature
     float bodyTemp;             // Celsius, normal 37°C
     float hypothermiaTimer;     // Game-seconds at severe cold, resets when warming
-    // Cached avoidance vector (recomputed every N frames)
-    float avoidX, avoidY;
     // Job system
     int currentJobId;    // Job pool index, -1 = no job (idle)
     // Diagnostics: what the last job was and how it ended
@@ -121,6 +140,60 @@ typedef struct Mover {
     float bladder;              // 1.0=fine, 0.0=desperate
 } Mover;
 
+// One mover as saves store it (v93+): hot and cold fields in one record, in
+// the layout saves have always used (v90-v92 records stop before bladder).
+// Save/load and the inspector go through PackMoverRecord/UnpackMoverRecord.
+typedef struct {
+    float x, y, z;
+    Point goal;
+    int pathLength;
+    int pathIndex;
+    bool active;
+    bool needsRepath;
+    int repathCooldown;
+    float speed;
+    float timeNearWaypoint;
+    float lastX, lastY, lastZ;
+    float timeWithoutProgress;
+    float fallTimer;
+    float workAnimPhase;
+    float hunger;
+    float energy;
+    int freetimeState;
+    int needTarget;
+    float needProgress;
+    float needSearchCooldown;
+    float starvationTimer;
+    float thirst;
+    float dehydrationTimer;
+    float bodyTemp;
+    float hypothermiaTimer;
+    float avoidX, avoidY;
+    int currentJobId;
+    int lastJobType;
+    int lastJobResult;
+    int lastJobTargetX, lastJobTargetY, lastJobTargetZ;
+    unsigned long lastJobEndTick;
+    MoverCapabilities capabilities;
+    int equippedTool;
+    int equippedClothing;
+    char name[16];
+    uint8_t gender;
+    uint8_t age;
+    uint32_t appearanceSeed;
+    bool isDrafted;
+    float mood;
+    Moodlet moodlets[MAX_MOODLETS];
+    int moodletCount;
+    uint8_t traits[MAX_TRAITS];
+    int transportState;
+    int transportStation;
+    int transportExitStation;
+    int transportTrainIdx;
+    Point transportFinalGoal;
+    float bladder;
+} MoverRecord;
+
 // Stuck detection thresholds
 #define STUCK_CHECK_INTERVAL 0.5f    // How often to check for progress (seconds)
 #define STUCK_MIN_DISTANCE 1.0f      // Minimum distance to count as "progress"
@@ -145,6 +218,7 @@ extern bool useWallSliding;             // Toggle for wall sliding
 // Globals
 extern Mover movers[MAX_MOVERS];
 extern Point moverPaths[MAX_MOVERS][MAX_MOVER_PATH];
+extern int moverFlowField[MAX_MOVERS];  // Flow field handle the mover follows (0 = own path)
 extern int moverCount;
 extern unsigned long currentTick;
 extern bool useStringPulling;
@@ -154,6 +228,25 @@ extern bool preferDifferentZ;  // When true, movers prefer goals on different z-
 extern bool allowFallingFromAvoidance;  // When true, avoidance can push movers into air (they will fall)
 extern PathAlgorithm moverPathAlgorithm;  // Algorithm used for mover pathfinding (default: HPA*)
 
+// Stable mover handles. RenumberMoversByCell (item_renumber.h) moves movers
+// to new indices; a handle keeps naming the same mover across passes. The
+// two tables are inverse permutations of 0..MAX_MOVERS-1, and the identity
+// until the first pass after ClearMovers. Sim state stores plain indices
+// (the pass rewrites them); code outside the sim that keeps a mover between
+// frames (camera follow, render colors) stores a handle.
+extern int moverHandleIndex[MAX_MOVERS];  // handle -> mover index
+extern int moverIndexHandle[MAX_MOVERS];  // mover index -> handle
+extern bool moverHandlesRemapped;          // false = both tables are the identity
+
+static inline int MoverIndexFromHandle(int handle) {
+    if (handle < 0 || !moverHandlesRemapped) return handle;
+    return moverHandleIndex[handle];
+}
+static inline int MoverHandleFromIndex(int moverIdx) {
+    if (moverIdx < 0 || !moverHandlesRemapped) return moverIdx;
+    return moverIndexHandle[moverIdx];
+}
+
 // Core functions
 void InitMover(Mover* m, float x, float y, float z, Point goal, float speed);
 void InitMoverWithPath(Mover* m, float x, float y, float z, Point goal, float speed, Point* pathArr, int pathLen);
@@ -163,6 +256,8 @@ void Tick(void);
 void TickWithDt(float dt);  // Tick with custom delta time (for variable timestep)
 void RunTicks(int count);
 void ClearMovers(void);
+void PackMoverRecord(int moverIdx, MoverRecord* out);
+void UnpackMoverRecord(int moverIdx, const MoverRecord* in);
 
 // Hunger/needs tick (drain hunger, tick cooldowns)
 void NeedsTick(void);
@@ -173,12 +268,35 @@ bool HasLineOfSight(int x0, int y0, int x1, int y1, int z);
 void StringPullPath(Point* pathArr, int* pathLen);
 
 // Spatial grid for neighbor queries
+// Indexes movers, animals and train cars together. Each grid cell's entries are
+// one contiguous run sorted by z, so a same-level query reads one sub-run per
+// cell and an all-levels query reads the whole run.
+typedef enum {
+    AGENT_MOVER,
+    AGENT_ANIMAL,
+    AGENT_TRAIN_CAR,    // locomotive or trailing car (index = train)
+} AgentKind;
+
+#define AGENT_MASK(kind) (1u << (kind))
+#define AGENT_MASK_ALL (AGENT_MASK(AGENT_MOVER) | AGENT_MASK(AGENT_ANIMAL) | AGENT_MASK(AGENT_TRAIN_CAR))
+
 typedef struct {
-    int* cellCounts;    // Number of movers per cell
-    int* cellStarts;    // Prefix sum: start index for each cell in moverIndices
-    int* moverIndices;  // Mover indices sorted by cell
+    int* cellCounts;    // Build scratch: entries per cell, then write cursors
+    int* cellStarts;    // Prefix sum: cell c holds entries [cellStarts[c], cellStarts[c + 1])
+    int* agentIndex;    // Mover / animal / train index per entry, sorted by (cell, z)
+    uint8_t* agentKind; // AgentKind per entry
+    uint8_t* agentZ;    // z-level per entry
+    float* cellPosX;    // Agent x per entry (packed copy for neighbor scans)
+    float* cellPosY;    // Agent y per entry
     int gridW, gridH;   // Grid dimensions in cells
+    int gridD;          // z-levels indexed (gridDepth at the last build)
     int cellCount;      // Total cells (gridW * gridH)
+    int entryCapacity;  // Movers + animals + train cars that fit
+    int moverEntryCount;     // Movers indexed by the last build
+    int kindCounts[3][MAX_GRID_DEPTH]; // Entries per AgentKind per z-level (lets searches stop early)
+    int animalGeneration;    // animalGeneration at the last build (-1 = never built)
+    int animalCountAtBuild;  // animalCount at the last build
+    unsigned long builtTick; // currentTick at the last build
     float invCellSize;  // 1.0 / MOVER_GRID_CELL_SIZE for fast division
 } MoverSpatialGrid;
 
@@ -188,12 +306,28 @@ void InitMoverSpatialGrid(int worldPixelWidth, int worldPixelHeight);
 void FreeMoverSpatialGrid(void);
 void BuildMoverSpatialGrid(void);
 
-// Query: calls callback for each mover within radius of (x, y), excluding excludeIndex
+// Query: calls callback for each mover within radius of (x, y) on any z-level, excluding excludeIndex
 // Returns number of neighbors found
 typedef void (*MoverNeighborCallback)(int moverIndex, float distSq, void* userData);
 int QueryMoverNeighbors(float x, float y, float radius, int excludeIndex,
                         MoverNeighborCallback callback, void* userData);
 
+// Query any agent kinds in kindMask within radius of (x, y) on level z (z < 0 = all levels).
+// Distances use positions captured at the last build.
+typedef void (*AgentNeighborCallback)(AgentKind kind, int index, float distSq, void* userData);
+int QueryAgentNeighbors(float x, float y, int z, float radius, unsigned int kindMask,
+                        AgentNeighborCallback callback, void* userData);
+
+// Nearest agent of kindMask on level z accepted by filter (NULL = any) and closer
+// than maxDist (<= 0 = unlimited), searching rings of grid cells outward using live
+// positions. Returns the index or -1; ties go to the lower index.
+typedef bool (*AgentFilter)(AgentKind kind, int index, void* userData);
+int FindNearestAgent(float x, float y, int z, float maxDist, unsigned int kindMask,
+                     AgentFilter filter, void* userData, float* outDistSq);
+
+// True if the grid holds every animal and is at most one tick of movement old (animal queries are safe)
+bool AgentGridHasCurrentAnimals(void);
+
 // Check if mover is in open area (3x3 grid cells around it are all walkable)
 // Returns true if full avoidance is safe, false if near walls
 bool IsMoverInOpenArea(float x, float y, int z);
@@ -219,24 +353,54 @@ Vec2 FilterAvoidanceByWalls(float x, float y, int z, Vec2 avoidance);
 extern float avoidStrengthOpen;    // Avoidance strength in open areas
 extern float avoidStrengthClosed;  // Avoidance strength near walls
 extern bool useDirectionalAvoidance;  // Filter avoidance by wall clearance
+extern bool useSimdAvoidance;  // Evaluate avoidance 4 neighbors at a time (SSE2 when available)
 
 // Test/debug toggles for deterministic behavior
 extern bool useRandomizedCooldowns;   // When true, repath cooldowns are randomized (avoids sync spikes)
 extern bool useStaggeredUpdates;      // When true, LOS/avoidance are staggered across frames
 
+// Repath scheduling (see ProcessMoverRepaths)
+typedef enum {
+    REPATH_PRIORITY_IDLE,
+    REPATH_PRIORITY_JOB,
+    REPATH_PRIORITY_CARRYING,
+    REPATH_PRIORITY_DANGER,    // standing in fire or deep water
+} RepathPriority;
+
+typedef struct {
+    int queueDepth;            // movers still waiting after the last tick
+    int searchesLastTick;
+    int overruns;              // ticks whose repath work exceeded repathBudgetMs
+    float lastTickMs;
+    float debtMs;              // overrun still being paid from later budgets
+    float slowestSearchMs;
+} RepathStats;
+
+extern float repathBudgetMs;   // wall time per tick for repaths, <= 0 (default) = MAX_REPATHS_PER_FRAME per tick
+extern RepathStats repathStats;
+
+RepathPriority GetRepathPriority(int moverIdx);
+int GetRepathWaitPercentile(int percent);  // ticks from eligible to served, over recent requests
+void ResetRepathScheduler(void);
+void RenumberRepathScheduler(const int* moverMap, int oldCount);  // waits follow movers to new indices
+
 // Compute avoidance vector for a mover (boids-style separation)
 // Returns a vector pointing away from nearby movers, strength based on proximity
 Vec2 ComputeMoverAvoidance(int moverIndex);
 
+// Same result for every mover i with wanted[i], written to out[i]. Walks the grid
+// cell by cell so movers sharing a cell reuse one gathered neighbor block.
+void ComputeMoverAvoidanceBatch(const bool* wanted, Vec2* out);
+
 // Compute wall repulsion vector (pushes mover away from walls and workshop blocks)
 Vec2 ComputeWallRepulsion(float x, float y, int z);
 
 // Mover path state getters/setters (inline for zero overhead)
-static inline int GetMoverPathLength(int moverIdx) { return movers[moverIdx].pathLength; }
-static inline int GetMoverPathIndex(int moverIdx) { return movers[moverIdx].pathIndex; }
-static inline bool GetMoverNeedsRepath(int moverIdx) { return movers[moverIdx].needsRepath; }
-static inline void SetMoverNeedsRepath(int moverIdx, bool needsRepath) { movers[moverIdx].needsRepath = needsRepath; }
-static inline void ClearMoverPath(int moverIdx) { movers[moverIdx].pathLength = 0; movers[moverIdx].pathIndex = -1; }
+static inline int GetMoverPathLength(int moverIdx) { return moverPathLength[moverIdx]; }
+static inline int GetMoverPathIndex(int moverIdx) { return moverPathIndex[moverIdx]; }
+static inline bool GetMoverNeedsRepath(int moverIdx) { return moverNeedsRepath[moverIdx]; }
+static inline void SetMoverNeedsRepath(int moverIdx, bool needsRepath) { moverNeedsRepath[moverIdx] = needsRepath; }
+static inline void ClearMoverPath(int moverIdx) { moverPathLength[moverIdx] = 0; moverPathIndex[moverIdx] = -1; }
 
 // Push all movers out of a cell to nearest walkable neighbor
 void PushMoversOutOfCell(int x, int y, int z);
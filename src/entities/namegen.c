@@ -148,7 +148,7 @@ static void GenerateOneName(char name[16], uint8_t gender) {
 
 bool IsNameUnique(const char* name) {
     for (int i = 0; i < moverCount; i++) {
-        if (!movers[i].active) continue;
+        if (!moverActive[i]) continue;
         if (strcmp(movers[i].name, name) == 0) return false;
     }
     return true;
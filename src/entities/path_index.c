@@ -0,0 +1,391 @@
+// path_index.c - Reverse index from chunks to the movers whose paths cross them
+//
+// Storage: each mover owns PATH_INDEX_SLOTS fixed nodes (mover * SLOTS + k,
+// the first `used` in use). Every node sits in the doubly linked list of its
+// chunk, so adding, dropping and walking a chunk's movers are all O(1) per
+// entry. A node remembers the lowest path segment touching its chunk; once
+// the mover's pathIndex drops below it the chunk is behind the mover.
+//
+// Segment s runs from waypoint s+1 to waypoint s (paths are goal-to-start,
+// so the mover walks segments pathIndex, pathIndex-1, ..., 0).
+
+#include "path_index.h"
+#include "mover.h"
+#include "../world/grid.h"
+#include "../world/cell_defs.h"
+#include <string.h>
+
+#define PATH_INDEX_CHUNKS (MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X)
+#define PATH_INDEX_NODES (MAX_MOVERS * PATH_INDEX_SLOTS)
+#define PATH_TOUCH_RADIUS_SQ (0.75f * 0.75f)  // cells this close to a segment count as on it
+#define PATH_REPAIR_FULL (-2)                 // repairFrom: break position unknown
+
+bool usePathRepair = true;
+int pathIndexMarkCount = 0;
+int pathRepairCount = 0;
+
+typedef struct {
+    int used;             // nodes in use
+    int indexedTo;        // segments >= indexedTo are registered
+    int pathLength;       // path signature at the last sync
+    int pathIndex;
+    Point head, tail;     // moverPaths[i][0] and [pathLength - 1]
+    unsigned long since;  // edit serial when the path was indexed
+    int repairFrom;       // broken segment waiting for a local repair, -1 = none, PATH_REPAIR_FULL
+} MoverPathEntry;
+
+static MoverPathEntry pathEntries[MAX_MOVERS];
+static int chunkHead[PATH_INDEX_CHUNKS];
+static unsigned long chunkEditSerial[PATH_INDEX_CHUNKS];
+static int nodeChunk[PATH_INDEX_NODES];
+static int nodeSeg[PATH_INDEX_NODES];
+static int nodePrev[PATH_INDEX_NODES];
+static int nodeNext[PATH_INDEX_NODES];
+
+static Point pendingEdits[PATH_EDIT_QUEUE_MAX];
+static int pendingEditCount = 0;
+static bool pendingOverflow = false;
+static unsigned long editSerial = 0;        // bumped per noted edit
+static unsigned long appliedEditSerial = 0; // edits up to here have been applied
+
+static bool pathIndexReady = false;
+static int indexedChunkWidth, indexedChunkHeight;
+
+static inline int PathChunkId(int x, int y, int z) {
+    return (z * MAX_CHUNKS_Y + y / chunkHeight) * MAX_CHUNKS_X + x / chunkWidth;
+}
+
+static inline bool SamePathPoint(Point a, Point b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+void ClearPathIndex(void) {
+    for (int c = 0; c < PATH_INDEX_CHUNKS; c++) chunkHead[c] = -1;
+    memset(chunkEditSerial, 0, sizeof(chunkEditSerial));
+    memset(pathEntries, 0, sizeof(pathEntries));
+    for (int i = 0; i < MAX_MOVERS; i++) pathEntries[i].repairFrom = -1;
+    pendingEditCount = 0;
+    pendingOverflow = false;
+    editSerial = 0;
+    appliedEditSerial = 0;
+    indexedChunkWidth = chunkWidth;
+    indexedChunkHeight = chunkHeight;
+    pathIndexReady = true;
+}
+
+void RenumberPathIndex(const int* moverMap, int oldCount) {
+    if (!pathIndexReady) return;
+    static MoverPathEntry oldEntries[MAX_MOVERS];
+    static int oldChunk[PATH_INDEX_NODES], oldSeg[PATH_INDEX_NODES];
+    memcpy(oldEntries, pathEntries, oldCount * sizeof(MoverPathEntry));
+    memcpy(oldChunk, nodeChunk, oldCount * PATH_INDEX_SLOTS * sizeof(int));
+    memcpy(oldSeg, nodeSeg, oldCount * PATH_INDEX_SLOTS * sizeof(int));
+
+    // Relink every chunk list from scratch; list order doesn't matter
+    for (int c = 0; c < PATH_INDEX_CHUNKS; c++) chunkHead[c] = -1;
+    memset(pathEntries, 0, sizeof(pathEntries));
+    for (int i = 0; i < MAX_MOVERS; i++) pathEntries[i].repairFrom = -1;
+    for (int i = 0; i < oldCount; i++) {
+        int n = moverMap[i];
+        if (n < 0) continue;
+        pathEntries[n] = oldEntries[i];
+        for (int k = 0; k < oldEntries[i].used; k++) {
+            int node = n * PATH_INDEX_SLOTS + k;
+            int chunk = oldChunk[i * PATH_INDEX_SLOTS + k];
+            nodeChunk[node] = chunk;
+            nodeSeg[node] = oldSeg[i * PATH_INDEX_SLOTS + k];
+            nodePrev[node] = -1;
+            nodeNext[node] = chunkHead[chunk];
+            if (chunkHead[chunk] >= 0) nodePrev[chunkHead[chunk]] = node;
+            chunkHead[chunk] = node;
+        }
+    }
+}
+
+static bool EnsurePathIndex(void) {
+    if (chunkWidth <= 0 || chunkHeight <= 0) return false;
+    if (!pathIndexReady || chunkWidth != indexedChunkWidth || chunkHeight != indexedChunkHeight) {
+        ClearPathIndex();
+    }
+    return true;
+}
+
+// --- Node lists ---
+
+static void UnlinkNode(int node) {
+    int prev = nodePrev[node], next = nodeNext[node];
+    if (prev >= 0) nodeNext[prev] = next;
+    else chunkHead[nodeChunk[node]] = next;
+    if (next >= 0) nodePrev[next] = prev;
+}
+
+// Move a linked node into slot `to` (keeps the mover's nodes packed)
+static void RelocateNode(int from, int to) {
+    nodeChunk[to] = nodeChunk[from];
+    nodeSeg[to] = nodeSeg[from];
+    nodePrev[to] = nodePrev[from];
+    nodeNext[to] = nodeNext[from];
+    if (nodePrev[to] >= 0) nodeNext[nodePrev[to]] = to;
+    else chunkHead[nodeChunk[to]] = to;
+    if (nodeNext[to] >= 0) nodePrev[nodeNext[to]] = to;
+}
+
+static void RemoveSlot(int moverIdx, int k) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    int base = moverIdx * PATH_INDEX_SLOTS;
+    UnlinkNode(base + k);
+    int last = e->used - 1;
+    if (k != last) RelocateNode(base + last, base + k);
+    e->used--;
+}
+
+static void ClearMoverEntries(int moverIdx) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    int base = moverIdx * PATH_INDEX_SLOTS;
+    for (int k = 0; k < e->used; k++) UnlinkNode(base + k);
+    e->used = 0;
+}
+
+static void MarkBroken(int moverIdx, int seg) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    moverNeedsRepath[moverIdx] = true;
+    if (seg < 0) e->repairFrom = PATH_REPAIR_FULL;      // break unknown: full repath
+    else if (e->repairFrom == -1 || (e->repairFrom >= 0 && seg < e->repairFrom)) {
+        e->repairFrom = seg;  // keep the break nearest the goal so one repair covers them all
+    }
+    pathIndexMarkCount++;
+}
+
+// Register chunk for segment seg. Returns false when the mover's slots are full.
+static bool AddChunk(int moverIdx, int chunk, int seg) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    int base = moverIdx * PATH_INDEX_SLOTS;
+    for (int k = 0; k < e->used; k++) {
+        if (nodeChunk[base + k] == chunk) {
+            if (seg < nodeSeg[base + k]) nodeSeg[base + k] = seg;
+            return true;
+        }
+    }
+    if (e->used == PATH_INDEX_SLOTS) return false;
+
+    int node = base + e->used++;
+    nodeChunk[node] = chunk;
+    nodeSeg[node] = seg;
+    nodePrev[node] = -1;
+    nodeNext[node] = chunkHead[chunk];
+    if (chunkHead[chunk] >= 0) nodePrev[chunkHead[chunk]] = node;
+    chunkHead[chunk] = node;
+
+    // Horizon reached a chunk edited after this path was found
+    if (chunkEditSerial[chunk] > e->since) MarkBroken(moverIdx, seg);
+    return true;
+}
+
+// Chunk of the cell plus, on chunk borders, the chunks of its neighbours
+// (cells within PATH_TOUCH_RADIUS of the segment may sit across the border).
+// lastChunk skips the slot search for runs of interior cells in one chunk.
+static bool AddCellChunks(int moverIdx, int x, int y, int z, int seg, int* lastChunk) {
+    if (z < 0 || z >= gridDepth) return true;
+    int lx = x % chunkWidth, ly = y % chunkHeight;
+    int dxLo = (lx == 0) ? -1 : 0, dxHi = (lx == chunkWidth - 1) ? 1 : 0;
+    int dyLo = (ly == 0) ? -1 : 0, dyHi = (ly == chunkHeight - 1) ? 1 : 0;
+    if (dxLo == dxHi && dyLo == dyHi) {
+        int chunk = PathChunkId(x, y, z);
+        if (chunk == *lastChunk) return true;
+        *lastChunk = chunk;
+        return AddChunk(moverIdx, chunk, seg);
+    }
+    *lastChunk = -1;
+    for (int dy = dyLo; dy <= dyHi; dy++) {
+        for (int dx = dxLo; dx <= dxHi; dx++) {
+            int nx = x + dx, ny = y + dy;
+            if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
+            if (!AddChunk(moverIdx, PathChunkId(nx, ny, z), seg)) return false;
+        }
+    }
+    return true;
+}
+
+static Point SegmentStart(int moverIdx, int seg) {
+    if (seg + 1 < moverPathLength[moverIdx]) return moverPaths[moverIdx][seg + 1];
+    return (Point){(int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx]};
+}
+
+static bool RegisterSegment(int moverIdx, int seg) {
+    Point a = SegmentStart(moverIdx, seg);
+    Point b = moverPaths[moverIdx][seg];
+    int dx = b.x - a.x, dy = b.y - a.y;
+    int lastChunkA = -1, lastChunkB = -1;
+    int steps = (dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy) ? (dx < 0 ? -dx : dx) : (dy < 0 ? -dy : dy);
+    for (int t = 0; t <= steps; t++) {
+        int x = steps ? a.x + (dx * t + (dx >= 0 ? steps / 2 : -(steps / 2))) / steps : a.x;
+        int y = steps ? a.y + (dy * t + (dy >= 0 ? steps / 2 : -(steps / 2))) / steps : a.y;
+        if (!AddCellChunks(moverIdx, x, y, a.z, seg, &lastChunkA)) return false;
+        if (b.z != a.z && !AddCellChunks(moverIdx, x, y, b.z, seg, &lastChunkB)) return false;
+    }
+    return true;
+}
+
+// Register further segments until the slots are full or the goal is reached
+static void ExtendHorizon(int moverIdx) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    while (e->indexedTo > 0) {
+        if (!RegisterSegment(moverIdx, e->indexedTo - 1)) break;
+        e->indexedTo--;
+    }
+}
+
+static void IndexMoverPath(int moverIdx) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    ClearMoverEntries(moverIdx);
+    e->pathLength = moverPathLength[moverIdx];
+    e->pathIndex = moverPathIndex[moverIdx];
+    e->head = moverPaths[moverIdx][0];
+    e->tail = moverPaths[moverIdx][moverPathLength[moverIdx] - 1];
+    e->since = editSerial;
+    e->repairFrom = -1;
+    e->indexedTo = moverPathIndex[moverIdx] + 1;
+    ExtendHorizon(moverIdx);
+}
+
+void SyncPathIndex(void) {
+    if (!EnsurePathIndex()) return;
+    for (int i = 0; i < moverCount; i++) {
+        MoverPathEntry* e = &pathEntries[i];
+        bool hasPath = moverActive[i] && moverPathLength[i] > 0 && moverPathIndex[i] >= 0 && moverPathIndex[i] < moverPathLength[i];
+        if (!hasPath) {
+            if (e->pathLength != 0) {
+                ClearMoverEntries(i);
+                e->pathLength = 0;
+                e->repairFrom = -1;
+            }
+            continue;
+        }
+
+        bool samePath = e->pathLength == moverPathLength[i] && moverPathIndex[i] <= e->pathIndex &&
+                        SamePathPoint(e->head, moverPaths[i][0]) &&
+                        SamePathPoint(e->tail, moverPaths[i][moverPathLength[i] - 1]);
+        if (!samePath) {
+            IndexMoverPath(i);
+            continue;
+        }
+
+        if (moverPathIndex[i] < e->pathIndex) {
+            // Walked past waypoints: drop chunks that are now behind, look further ahead
+            e->pathIndex = moverPathIndex[i];
+            int base = i * PATH_INDEX_SLOTS;
+            for (int k = e->used - 1; k >= 0; k--) {
+                if (nodeSeg[base + k] > moverPathIndex[i]) RemoveSlot(i, k);
+            }
+            if (e->indexedTo > moverPathIndex[i] + 1) e->indexedTo = moverPathIndex[i] + 1;
+            ExtendHorizon(i);
+        }
+    }
+}
+
+// --- Edits ---
+
+static bool SegmentTouchesCell(Point a, Point b, int x, int y, int z) {
+    int minZ = a.z < b.z ? a.z : b.z;
+    int maxZ = a.z < b.z ? b.z : a.z;
+    if (z < minZ || z > maxZ) return false;
+    float abx = (float)(b.x - a.x), aby = (float)(b.y - a.y);
+    float apx = (float)(x - a.x), apy = (float)(y - a.y);
+    float lenSq = abx * abx + aby * aby;
+    float t = lenSq > 0.0f ? (apx * abx + apy * aby) / lenSq : 0.0f;
+    if (t < 0.0f) t = 0.0f;
+    if (t > 1.0f) t = 1.0f;
+    float ex = apx - t * abx, ey = apy - t * aby;
+    return ex * ex + ey * ey <= PATH_TOUCH_RADIUS_SQ;
+}
+
+// Remaining segment through the cell nearest the goal, -1 if none. Segments
+// below minSeg (the lowest one registered in the cell's chunk) cannot reach
+// it. With onlyZChanges, only ladder/ramp segments count (the cell is still
+// walkable but may have lost the link between levels).
+static int FindBrokenSegment(int moverIdx, int minSeg, int x, int y, int z, bool onlyZChanges) {
+    for (int s = minSeg; s <= moverPathIndex[moverIdx]; s++) {
+        Point a = (s == moverPathIndex[moverIdx])
+            ? (Point){(int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), (int)moverPosZ[moverIdx]}
+            : moverPaths[moverIdx][s + 1];
+        Point b = moverPaths[moverIdx][s];
+        if (onlyZChanges && a.z == b.z) continue;
+        if (SegmentTouchesCell(a, b, x, y, z)) return s;
+    }
+    return -1;
+}
+
+void NotePathCellEdit(int x, int y, int z) {
+    if (!EnsurePathIndex()) return;
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) return;
+    chunkEditSerial[PathChunkId(x, y, z)] = ++editSerial;
+    if (z + 1 < gridDepth) chunkEditSerial[PathChunkId(x, y, z + 1)] = editSerial;
+    if (pendingEditCount < PATH_EDIT_QUEUE_MAX) {
+        pendingEdits[pendingEditCount++] = (Point){x, y, z};
+    } else {
+        pendingOverflow = true;
+    }
+}
+
+static void CheckCellAgainstPaths(int x, int y, int z, bool onlyBlocked) {
+    if (z < 0 || z >= gridDepth) return;
+    bool onlyZChanges = onlyBlocked && IsCellWalkableAt(z, y, x);
+    for (int node = chunkHead[PathChunkId(x, y, z)]; node >= 0; node = nodeNext[node]) {
+        int moverIdx = node / PATH_INDEX_SLOTS;
+        int seg = FindBrokenSegment(moverIdx, nodeSeg[node], x, y, z, onlyZChanges);
+        if (seg >= 0) MarkBroken(moverIdx, seg);
+    }
+}
+
+void ApplyPathCellEdits(void) {
+    if (!EnsurePathIndex()) return;
+    if (pendingOverflow) {
+        // Too many edits to check cell by cell: movers in any touched chunk repath in full
+        for (int c = 0; c < PATH_INDEX_CHUNKS; c++) {
+            if (chunkEditSerial[c] <= appliedEditSerial) continue;
+            for (int node = chunkHead[c]; node >= 0; node = nodeNext[node]) {
+                MarkBroken(node / PATH_INDEX_SLOTS, -1);
+            }
+        }
+    } else {
+        for (int k = 0; k < pendingEditCount; k++) {
+            Point p = pendingEdits[k];
+            // The cell above stands on this one, so it can stop being walkable too
+            CheckCellAgainstPaths(p.x, p.y, p.z, true);
+            CheckCellAgainstPaths(p.x, p.y, p.z + 1, true);
+        }
+    }
+    pendingEditCount = 0;
+    pendingOverflow = false;
+    appliedEditSerial = editSerial;
+}
+
+int MarkPathsThroughCell(int x, int y, int z) {
+    if (!EnsurePathIndex()) return 0;
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) return 0;
+    SyncPathIndex();
+    chunkEditSerial[PathChunkId(x, y, z)] = ++editSerial;  // paths beyond their horizon catch it later
+    int before = pathIndexMarkCount;
+    CheckCellAgainstPaths(x, y, z, false);
+    return pathIndexMarkCount - before;
+}
+
+int TakePathRepairPoint(int moverIdx) {
+    MoverPathEntry* e = &pathEntries[moverIdx];
+    int seg = e->repairFrom;
+    e->repairFrom = -1;
+    if (!usePathRepair || seg < 0) return -1;
+
+    const Mover* m = &movers[moverIdx];
+    if (moverPathLength[moverIdx] == 0 || !SamePathPoint(moverPaths[moverIdx][0], m->goal)) return -1;  // goal moved on
+    if (seg > moverPathIndex[moverIdx]) seg = moverPathIndex[moverIdx];
+
+    // Rejoin past the break, at the first waypoint that is still walkable
+    int rejoin = seg - PATH_REPAIR_REJOIN_SKIP;
+    while (rejoin >= 0) {
+        Point w = moverPaths[moverIdx][rejoin];
+        if (IsCellWalkableAt(w.z, w.y, w.x)) break;
+        rejoin--;
+    }
+    return rejoin;
+}
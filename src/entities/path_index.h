@@ -0,0 +1,56 @@
+// path_index.h - Reverse index from chunks to the movers whose paths cross them
+//
+// Each mover registers the chunks its remaining path passes through, in
+// travel order, up to PATH_INDEX_SLOTS chunks ahead. Chunks fall off as the
+// mover walks past them and further ones are added, so the index stays in
+// step with pathIndex. The index is synced once per tick from the live
+// paths (SyncPathIndex), so code that writes moverPaths directly needs no
+// extra call.
+//
+// Cell edits (MarkChunkDirty) are queued and applied once per tick: only
+// movers registered in the edited chunk are checked, against the segments
+// of their remaining path, and only if the cell is no longer walkable. A hit
+// marks the mover for repath and remembers the broken segment so the repath
+// can re-search just that stretch (local repair) and keep the rest.
+//
+// Chunks beyond a mover's horizon are not indexed; when the horizon later
+// reaches a chunk edited after the path was found, the mover is marked too.
+
+#ifndef PATH_INDEX_H
+#define PATH_INDEX_H
+
+#include <stdbool.h>
+
+#define PATH_INDEX_SLOTS 32          // chunks indexed ahead of each mover
+#define PATH_EDIT_QUEUE_MAX 4096     // queued cell edits per tick before falling back to whole chunks
+#define PATH_REPAIR_REJOIN_SKIP 1    // waypoints past the break the repair search rejoins at
+
+extern bool usePathRepair;           // Repath broken paths by re-searching only the broken stretch
+extern int pathIndexMarkCount;       // movers marked by cell edits
+extern int pathRepairCount;          // repaths served by a local repair
+
+// Bring the index in line with the live paths (new, cleared or advanced)
+void SyncPathIndex(void);
+
+// Queue a cell edit; applied by ApplyPathCellEdits
+void NotePathCellEdit(int x, int y, int z);
+
+// Check queued edits against the paths that cross their chunks
+void ApplyPathCellEdits(void);
+
+// Mark every mover whose remaining path passes through the cell, walkable or
+// not (explicit invalidation, e.g. furniture placed). Returns movers marked.
+int MarkPathsThroughCell(int x, int y, int z);
+
+// Waypoint index a repair search should rejoin for this mover, or -1 for a
+// full repath. Consumes the pending repair.
+int TakePathRepairPoint(int moverIdx);
+
+// Drop all entries and queued edits (movers cleared, grid re-initialized)
+void ClearPathIndex(void);
+
+// Move each mover's entries to its new index after RenumberMoversByCell
+// (moverMap: old -> new index, -1 = dropped). Queued edits are kept.
+void RenumberPathIndex(const int* moverMap, int oldCount);
+
+#endif // PATH_INDEX_H
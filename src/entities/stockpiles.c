@@ -209,9 +209,9 @@ void RebuildStockpileGroundItemCache(void) {
     
     // Mark slots with their ground item indices
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
-        MarkStockpileGroundItem(items[i].x, items[i].y, (int)items[i].z, i);
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_ON_GROUND) continue;
+        MarkStockpileGroundItem(itemPosX[i], itemPosY[i], (int)itemPosZ[i], i);
     }
 }
 
@@ -383,7 +383,7 @@ int CreateStockpile(int x, int y, int z, int width, int height) {
             
             stockpileCount++;
             InvalidateStockpileSlotCacheAll();  // New stockpile added
-            InvalidateRooms();
+            InvalidateRoomContentsInRect(sp->x, sp->y, sp->z, sp->width, sp->height);
             EventLog("Stockpile %d created at (%d,%d,z%d) %dx%d", i, x, y, z, sp->width, sp->height);
             return i;
         }
@@ -400,23 +400,23 @@ void DeleteStockpile(int index) {
         for (int s = 0; s < totalSlots; s++) {
             if (!sp->cells[s]) continue;
             if (sp->slots[s] >= 0 && sp->slots[s] < MAX_ITEMS
-                && items[sp->slots[s]].active && items[sp->slots[s]].contentCount > 0) {
+                && itemActive[sp->slots[s]] && items[sp->slots[s]].contentCount > 0) {
                 SpillContainerContents(sp->slots[s]);
             }
         }
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
-            if (items[i].state != ITEM_IN_STOCKPILE) continue;
+            if (!itemActive[i]) continue;
+            if (itemState[i] != ITEM_IN_STOCKPILE) continue;
             
             // Check if item is within this stockpile's bounds
-            int itemTileX = (int)(items[i].x / CELL_SIZE);
-            int itemTileY = (int)(items[i].y / CELL_SIZE);
-            int itemZ = (int)items[i].z;
+            int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+            int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
+            int itemZ = (int)itemPosZ[i];
             
             if (itemZ == sp->z &&
                 itemTileX >= sp->x && itemTileX < sp->x + sp->width &&
                 itemTileY >= sp->y && itemTileY < sp->y + sp->height) {
-                items[i].state = ITEM_ON_GROUND;
+                SetItemState(i, ITEM_ON_GROUND);
             }
         }
         
@@ -424,7 +424,7 @@ void DeleteStockpile(int index) {
         sp->active = false;
         stockpileCount--;
         InvalidateStockpileSlotCacheAll();  // Stockpile deleted
-        InvalidateRooms();
+        InvalidateRoomContentsInRect(sp->x, sp->y, sp->z, sp->width, sp->height);
     }
 }
 
@@ -462,14 +462,14 @@ void RemoveStockpileCells(int stockpileIdx, int x1, int y1, int x2, int y2) {
             {
                 // Find items at this tile and set them to ground state
                 for (int i = 0; i < itemHighWaterMark; i++) {
-                    if (!items[i].active) continue;
-                    if (items[i].state != ITEM_IN_STOCKPILE) continue;
-                    int itemTileX = (int)(items[i].x / CELL_SIZE);
-                    int itemTileY = (int)(items[i].y / CELL_SIZE);
-                    int itemZ = (int)items[i].z;
+                    if (!itemActive[i]) continue;
+                    if (itemState[i] != ITEM_IN_STOCKPILE) continue;
+                    int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+                    int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
+                    int itemZ = (int)itemPosZ[i];
                     if (itemTileX == wx && itemTileY == wy && itemZ == sp->z) {
-                        items[i].state = ITEM_ON_GROUND;
-                        items[i].reservedBy = -1;
+                        SetItemState(i, ITEM_ON_GROUND);
+                        itemReservedBy[i] = -1;
                     }
                 }
             }
@@ -497,18 +497,18 @@ void RemoveStockpileCells(int stockpileIdx, int x1, int y1, int x2, int y2) {
         if (job->targetSlotX >= x1 && job->targetSlotX <= x2 &&
             job->targetSlotY >= y1 && job->targetSlotY <= y2) {
             // Release item reservation
-            if (job->targetItem >= 0 && items[job->targetItem].active) {
-                items[job->targetItem].reservedBy = -1;
+            if (job->targetItem >= 0 && itemActive[job->targetItem]) {
+                itemReservedBy[job->targetItem] = -1;
             }
             // Release job
             ReleaseJob(jobId);
             // Reset mover
             int moverIdx = job->assignedMover;
-            if (moverIdx >= 0 && moverIdx < moverCount && movers[moverIdx].active) {
+            if (moverIdx >= 0 && moverIdx < moverCount && moverActive[moverIdx]) {
                 Mover* m = &movers[moverIdx];
                 m->currentJobId = -1;
                 ClearMoverPath(moverIdx);
-                m->needsRepath = false;
+                moverNeedsRepath[moverIdx] = false;
                 m->timeWithoutProgress = 0.0f;
                 AddMoverToIdleList(moverIdx);
             }
@@ -852,7 +852,7 @@ void PlaceItemInStockpile(int stockpileIdx, int slotX, int slotY, int itemIdx) {
         return;
     }
     
-    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !items[itemIdx].active) return;
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !itemActive[itemIdx]) return;
     
     if (sp->reservedBy[idx] > 0) sp->reservedBy[idx]--;  // one reservation fulfilled
     sp->groundItemIdx[idx] = -1;  // item is being placed in slot, not on ground
@@ -871,7 +871,7 @@ void PlaceItemInStockpile(int stockpileIdx, int slotX, int slotY, int itemIdx) {
         int installed = CountInstalledContainers(stockpileIdx);
         if (installed < sp->maxContainers) {
             // Install container as the slot's storage unit
-            items[itemIdx].state = ITEM_IN_STOCKPILE;
+            SetItemState(itemIdx, ITEM_IN_STOCKPILE);
             sp->slots[idx] = itemIdx;
             sp->slotTypes[idx] = items[itemIdx].type;
             sp->slotMaterials[idx] = ResolveItemMaterial(items[itemIdx].type, items[itemIdx].material);
@@ -892,12 +892,12 @@ void PlaceItemInStockpile(int stockpileIdx, int slotX, int slotY, int itemIdx) {
     
     // If slot already has an item, merge stacks (incoming item may be deleted)
     if (sp->slotCounts[idx] > 0 && sp->slots[idx] >= 0 && sp->slots[idx] < MAX_ITEMS
-        && items[sp->slots[idx]].active) {
+        && itemActive[sp->slots[idx]]) {
         MergeItemIntoStack(sp->slots[idx], itemIdx);
         sp->slotCounts[idx] = items[sp->slots[idx]].stackCount;
     } else {
         // First item in slot
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        SetItemState(itemIdx, ITEM_IN_STOCKPILE);
         sp->slots[idx] = itemIdx;
         sp->slotTypes[idx] = items[itemIdx].type;
         sp->slotMaterials[idx] = incomingMat;
@@ -962,13 +962,13 @@ void SyncStockpileSlotCount(float x, float y, int z) {
 
     int idx = ly * stockpiles[sourceSp].width + lx;
     int slotItem = stockpiles[sourceSp].slots[idx];
-    if (slotItem >= 0 && items[slotItem].active) {
+    if (slotItem >= 0 && itemActive[slotItem]) {
         stockpiles[sourceSp].slotCounts[idx] = items[slotItem].stackCount;
     }
 }
 
 void SyncStockpileSlotCountForItem(int itemIdx) {
-    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !items[itemIdx].active) return;
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !itemActive[itemIdx]) return;
     for (int i = 0; i < MAX_STOCKPILES; i++) {
         if (!stockpiles[i].active) continue;
         Stockpile* sp = &stockpiles[i];
@@ -983,9 +983,9 @@ void SyncStockpileSlotCountForItem(int itemIdx) {
 }
 
 int TakeFromStockpileSlot(int itemIdx, int count) {
-    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !items[itemIdx].active) return -1;
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !itemActive[itemIdx]) return -1;
     if (count <= 0) return -1;
-    if (items[itemIdx].state != ITEM_IN_STOCKPILE) return itemIdx; // not in stockpile, just return as-is
+    if (itemState[itemIdx] != ITEM_IN_STOCKPILE) return itemIdx; // not in stockpile, just return as-is
 
     if (items[itemIdx].stackCount <= count) {
         // Taking all — find and clear the stockpile slot holding this item
@@ -1007,10 +1007,10 @@ int TakeFromStockpileSlot(int itemIdx, int count) {
     // Taking partial — split off what we need, remainder stays
     int splitIdx = SplitStack(itemIdx, count);
     if (splitIdx < 0) return -1;
-    items[splitIdx].state = ITEM_ON_GROUND;
+    SetItemState(splitIdx, ITEM_ON_GROUND);
     // Transfer reservation from original to split-off (original stays in stockpile unreserved)
-    items[splitIdx].reservedBy = items[itemIdx].reservedBy;
-    items[itemIdx].reservedBy = -1;
+    itemReservedBy[splitIdx] = itemReservedBy[itemIdx];
+    itemReservedBy[itemIdx] = -1;
     SyncStockpileSlotCountForItem(itemIdx);
     return splitIdx;
 }
@@ -1091,14 +1091,14 @@ void SetStockpileSlotCount(int stockpileIdx, int localX, int localY, ItemType ty
         int worldY = sp->y + localY;
         float cx = worldX * CELL_SIZE + CELL_SIZE * 0.5f;
         float cy = worldY * CELL_SIZE + CELL_SIZE * 0.5f;
-        if (sp->slots[idx] >= 0 && sp->slots[idx] < MAX_ITEMS && items[sp->slots[idx]].active) {
-            items[sp->slots[idx]].stackCount = count;
+        if (sp->slots[idx] >= 0 && sp->slots[idx] < MAX_ITEMS && itemActive[sp->slots[idx]]) {
+            SetItemStackCount(sp->slots[idx], count);
         } else {
             int itemIdx = SpawnItemWithMaterial(cx, cy, (float)sp->z, type,
                                                DefaultMaterialForItemType(type));
             if (itemIdx >= 0) {
-                items[itemIdx].state = ITEM_IN_STOCKPILE;
-                items[itemIdx].stackCount = count;
+                SetItemState(itemIdx, ITEM_IN_STOCKPILE);
+                SetItemStackCount(itemIdx, count);
                 sp->slots[idx] = itemIdx;
             }
         }
@@ -1157,7 +1157,7 @@ bool IsSlotOverfull(int stockpileIdx, int slotX, int slotY) {
 }
 
 int FindStockpileForOverfullItem(int itemIdx, int currentStockpileIdx, int* outSlotX, int* outSlotY) {
-    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !items[itemIdx].active) return -1;
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !itemActive[itemIdx]) return -1;
     if (currentStockpileIdx < 0 || currentStockpileIdx >= MAX_STOCKPILES) return -1;
     
     ItemType type = items[itemIdx].type;
@@ -1168,8 +1168,8 @@ int FindStockpileForOverfullItem(int itemIdx, int currentStockpileIdx, int* outS
         int slotX, slotY;
         if (FindFreeStockpileSlot(currentStockpileIdx, type, material, &slotX, &slotY)) {
             // Make sure we're not targeting the same slot the item is already on
-            int itemTileX = (int)(items[itemIdx].x / CELL_SIZE);
-            int itemTileY = (int)(items[itemIdx].y / CELL_SIZE);
+            int itemTileX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+            int itemTileY = (int)(itemPosY[itemIdx] / CELL_SIZE);
             if (slotX != itemTileX || slotY != itemTileY) {
                 *outSlotX = slotX;
                 *outSlotY = slotY;
@@ -1255,7 +1255,7 @@ bool IsStockpileOverfull(int stockpileIdx) {
 }
 
 int FindHigherPriorityStockpile(int itemIdx, int currentStockpileIdx, int* outSlotX, int* outSlotY) {
-    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !items[itemIdx].active) return -1;
+    if (itemIdx < 0 || itemIdx >= MAX_ITEMS || !itemActive[itemIdx]) return -1;
     if (currentStockpileIdx < 0 || currentStockpileIdx >= MAX_STOCKPILES) return -1;
     
     ItemType type = items[itemIdx].type;
@@ -1349,10 +1349,10 @@ int FindGroundItemOnStockpile(int* outStockpileIdx, bool* outIsAbsorb) {
                 if (itemIdx < 0) continue;  // no ground item on this slot
                 
                 // Validate item is still active and on ground (cache may be slightly stale)
-                if (!items[itemIdx].active || items[itemIdx].state != ITEM_ON_GROUND) continue;
+                if (!itemActive[itemIdx] || itemState[itemIdx] != ITEM_ON_GROUND) continue;
                 
                 // Check if it's already reserved
-                if (items[itemIdx].reservedBy != -1) continue;
+                if (itemReservedBy[itemIdx] != -1) continue;
                 
                 // Check if item matches stockpile filter
                 bool matches = StockpileAcceptsItem(spIdx, items[itemIdx].type, items[itemIdx].material);
@@ -1409,8 +1409,8 @@ bool IsSlotContainer(int stockpileIdx, int slotIdx) {
 
 void SyncStockpileContainerSlotCount(int containerIdx) {
     if (containerIdx < 0 || containerIdx >= MAX_ITEMS) return;
-    if (!items[containerIdx].active) return;
-    if (items[containerIdx].state != ITEM_IN_STOCKPILE) return;
+    if (!itemActive[containerIdx]) return;
+    if (itemState[containerIdx] != ITEM_IN_STOCKPILE) return;
 
     // Find which stockpile slot holds this container
     for (int s = 0; s < stockpileCount; s++) {
@@ -96,7 +96,7 @@ JobToolReq GetJobToolRequirement(int jobType, MaterialType targetMaterial) {
 
 static int GetEquippedToolQualityLevel(int equippedToolItemIdx, QualityType qualityType) {
     if (equippedToolItemIdx < 0) return 0;
-    if (equippedToolItemIdx >= MAX_ITEMS || !items[equippedToolItemIdx].active) return 0;
+    if (equippedToolItemIdx >= MAX_ITEMS || !itemActive[equippedToolItemIdx]) return 0;
     return GetItemQualityLevel(items[equippedToolItemIdx].type, qualityType);
 }
 
@@ -136,16 +136,16 @@ int FindNearestToolForQuality(QualityType quality, int minLevel,
 
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
+        if (!itemActive[i]) continue;
         if (i == excludeItemIdx) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->state != ITEM_ON_GROUND && item->state != ITEM_IN_STOCKPILE) continue;
+        if (itemReservedBy[i] != -1) continue;
+        if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
         if (!(itemDefs[item->type].flags & IF_TOOL)) continue;
         if (GetItemQualityLevel(item->type, quality) < minLevel) continue;
 
-        int itemTileX = (int)(item->x / CELL_SIZE);
-        int itemTileY = (int)(item->y / CELL_SIZE);
-        int itemZ = (int)item->z;
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
+        int itemZ = (int)itemPosZ[i];
         if (itemZ != z) continue;  // same z-level only
 
         int dx = itemTileX - tileX;
@@ -164,8 +164,8 @@ void DropEquippedTool(int moverIdx) {
     if (m->equippedTool < 0) return;
     int toolIdx = m->equippedTool;
     m->equippedTool = -1;
-    if (toolIdx < MAX_ITEMS && items[toolIdx].active) {
-        SafeDropItem(toolIdx, m->x, m->y, (int)m->z);
+    if (toolIdx < MAX_ITEMS && itemActive[toolIdx]) {
+        SafeDropItem(toolIdx, moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
         EventLog("Mover %d dropped tool item %d (%s)", moverIdx, toolIdx,
                  itemDefs[items[toolIdx].type].name);
     }
@@ -176,8 +176,8 @@ void DropEquippedClothing(int moverIdx) {
     if (m->equippedClothing < 0) return;
     int clothIdx = m->equippedClothing;
     m->equippedClothing = -1;
-    if (clothIdx < MAX_ITEMS && items[clothIdx].active) {
-        SafeDropItem(clothIdx, m->x, m->y, (int)m->z);
+    if (clothIdx < MAX_ITEMS && itemActive[clothIdx]) {
+        SafeDropItem(clothIdx, moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
         EventLog("Mover %d dropped clothing item %d (%s)", moverIdx, clothIdx,
                  itemDefs[items[clothIdx].type].name);
     }
@@ -5,6 +5,7 @@
 #include "../simulation/lighting.h"
 #include "../core/time.h"
 #include "../core/event_log.h"
+#include "../core/sim_rng.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -217,14 +218,14 @@ void RebuildStations(void) {
             // Reset transport state for any movers that were waiting here
             for (int j = 0; j < oldStations[oi].waitingCount; j++) {
                 int mi = oldStations[oi].waitingMovers[j];
-                if (mi >= 0 && mi < moverCount && movers[mi].active) {
+                if (mi >= 0 && mi < moverCount && moverActive[mi]) {
                     movers[mi].transportState = TRANSPORT_NONE;
                     movers[mi].transportStation = -1;
                     movers[mi].transportExitStation = -1;
                     movers[mi].transportTrainIdx = -1;
                     // Restore original goal
                     movers[mi].goal = movers[mi].transportFinalGoal;
-                    movers[mi].needsRepath = true;
+                    moverNeedsRepath[mi] = true;
                 }
             }
         }
@@ -351,9 +352,9 @@ bool ShouldUseTrain(int moverIdx) {
         if (j && j->step == STEP_MOVING_TO_PICKUP) return false;
     }
 
-    int mx = (int)(m->x / CELL_SIZE);
-    int my = (int)(m->y / CELL_SIZE);
-    int mz = (int)m->z;
+    int mx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int my = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int mz = (int)moverPosZ[moverIdx];
 
     // Must be same z-level
     if (m->goal.z != mz) return false;
@@ -387,9 +388,9 @@ void BoardMoverOnTrain(int trainIdx, int moverIdx, int stationIdx) {
     m->transportState = TRANSPORT_RIDING;
     m->transportTrainIdx = trainIdx;
     // Clear path — mover is now riding
-    m->pathLength = 0;
-    m->pathIndex = -1;
-    m->needsRepath = false;
+    moverPathLength[moverIdx] = 0;
+    moverPathIndex[moverIdx] = -1;
+    moverNeedsRepath[moverIdx] = false;
 
     EventLog("Mover %d boarded train %d at station %d", moverIdx, trainIdx, stationIdx);
 }
@@ -413,12 +414,12 @@ void ExitMoverFromTrain(int trainIdx, int riderSlot, int stationIdx) {
         exitY = s->platformCells[cellSlot][1];
     }
     exitSpreadIdx++;
-    m->x = exitX * CELL_SIZE + CELL_SIZE * 0.5f;
-    m->y = exitY * CELL_SIZE + CELL_SIZE * 0.5f;
-    m->z = (float)s->z;
-    m->lastX = m->x;
-    m->lastY = m->y;
-    m->lastZ = m->z;
+    moverPosX[moverIdx] = exitX * CELL_SIZE + CELL_SIZE * 0.5f;
+    moverPosY[moverIdx] = exitY * CELL_SIZE + CELL_SIZE * 0.5f;
+    moverPosZ[moverIdx] = (float)s->z;
+    m->lastX = moverPosX[moverIdx];
+    m->lastY = moverPosY[moverIdx];
+    m->lastZ = moverPosZ[moverIdx];
 
     // Restore original goal
     m->goal = m->transportFinalGoal;
@@ -426,7 +427,7 @@ void ExitMoverFromTrain(int trainIdx, int riderSlot, int stationIdx) {
     m->transportStation = -1;
     m->transportExitStation = -1;
     m->transportTrainIdx = -1;
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
     m->timeWithoutProgress = 0.0f;
 
     EventLog("Mover %d exited train %d at station %d", moverIdx, trainIdx, stationIdx);
@@ -439,12 +440,12 @@ void DismountAllRiders(int trainIdx) {
         Mover* m = &movers[moverIdx];
 
         // Place at train's current cell (best effort)
-        m->x = t->x;
-        m->y = t->y;
-        m->z = (float)t->z;
-        m->lastX = m->x;
-        m->lastY = m->y;
-        m->lastZ = m->z;
+        moverPosX[moverIdx] = t->x;
+        moverPosY[moverIdx] = t->y;
+        moverPosZ[moverIdx] = (float)t->z;
+        m->lastX = moverPosX[moverIdx];
+        m->lastY = moverPosY[moverIdx];
+        m->lastZ = moverPosZ[moverIdx];
 
         EventLog("Mover %d dismounted from train %d (DismountAll)", moverIdx, trainIdx);
         m->goal = m->transportFinalGoal;
@@ -452,7 +453,7 @@ void DismountAllRiders(int trainIdx) {
         m->transportStation = -1;
         m->transportExitStation = -1;
         m->transportTrainIdx = -1;
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         m->timeWithoutProgress = 0.0f;
 
         // Swap-last remove
@@ -509,13 +510,13 @@ static bool FindNextTrackCell(Train* t, int* outX, int* outY) {
                 }
             }
 
-            if (straightIdx >= 0 && (rand() % 100) >= 10) {
+            if (straightIdx >= 0 && (SimRand(RNG_TRAINS) % 100) >= 10) {
                 // Go straight (90% chance; 10% chance to pick randomly instead)
                 *outX = options[straightIdx][0];
                 *outY = options[straightIdx][1];
             } else {
                 // No straight option (T-junction) — pick random among remaining
-                int pick = rand() % optionCount;
+                int pick = SimRand(RNG_TRAINS) % optionCount;
                 *outX = options[pick][0];
                 *outY = options[pick][1];
             }
@@ -559,7 +560,7 @@ void TrainsTick(float dt) {
             // 1. Exit riders whose exit station is this station
             for (int r = t->ridingCount - 1; r >= 0; r--) {
                 int mi = t->ridingMovers[r];
-                if (mi >= 0 && mi < moverCount && movers[mi].active) {
+                if (mi >= 0 && mi < moverCount && moverActive[mi]) {
                     if (movers[mi].transportExitStation == t->atStation) {
                         ExitMoverFromTrain(i, r, t->atStation);
                     }
@@ -586,9 +587,9 @@ void TrainsTick(float dt) {
             // Update riding mover positions even while stopped
             for (int r = 0; r < t->ridingCount; r++) {
                 int mi = t->ridingMovers[r];
-                if (mi >= 0 && mi < moverCount && movers[mi].active) {
-                    movers[mi].x = t->x;
-                    movers[mi].y = t->y;
+                if (mi >= 0 && mi < moverCount && moverActive[mi]) {
+                    moverPosX[mi] = t->x;
+                    moverPosY[mi] = t->y;
                     movers[mi].timeWithoutProgress = 0.0f;
                 }
             }
@@ -609,7 +610,7 @@ void TrainsTick(float dt) {
                 bool hasExiters = false;
                 for (int r = 0; r < t->ridingCount && !hasExiters; r++) {
                     int mi = t->ridingMovers[r];
-                    if (mi >= 0 && mi < moverCount && movers[mi].active) {
+                    if (mi >= 0 && mi < moverCount && moverActive[mi]) {
                         if (movers[mi].transportExitStation == stIdx) hasExiters = true;
                     }
                 }
@@ -671,12 +672,12 @@ void TrainsTick(float dt) {
 
             for (int mi = 0; mi < moverCount; mi++) {
                 Mover* m = &movers[mi];
-                if (!m->active || (int)m->z != t->z) continue;
+                if (!moverActive[mi] || (int)moverPosZ[mi] != t->z) continue;
                 // Don't push riders or movers waiting to board
                 if (m->transportState == TRANSPORT_RIDING || m->transportState == TRANSPORT_WAITING) continue;
 
-                float dx = m->x - t->x;
-                float dy = m->y - t->y;
+                float dx = moverPosX[mi] - t->x;
+                float dy = moverPosY[mi] - t->y;
                 float distSq = dx * dx + dy * dy;
 
                 if (distSq < 1e-10f || distSq >= pushRadiusSq) continue;
@@ -685,17 +686,17 @@ void TrainsTick(float dt) {
                 float push = pushStrength * (1.0f - dist / pushRadius) * gdt;
                 float nx = dx / dist;
                 float ny = dy / dist;
-                m->x += nx * push;
-                m->y += ny * push;
+                moverPosX[mi] += nx * push;
+                moverPosY[mi] += ny * push;
             }
         }
 
         // Update riding mover positions
         for (int r = 0; r < t->ridingCount; r++) {
             int mi = t->ridingMovers[r];
-            if (mi >= 0 && mi < moverCount && movers[mi].active) {
-                movers[mi].x = t->x;
-                movers[mi].y = t->y;
+            if (mi >= 0 && mi < moverCount && moverActive[mi]) {
+                moverPosX[mi] = t->x;
+                moverPosY[mi] = t->y;
                 movers[mi].timeWithoutProgress = 0.0f;
             }
         }
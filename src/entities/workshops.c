@@ -3,6 +3,7 @@
 #include "mover.h"
 #include "jobs.h"
 #include "item_defs.h"
+#include "item_ledger.h"
 #include "containers.h"
 #include "furniture.h"
 #include "../simulation/balance.h"
@@ -11,6 +12,7 @@
 #include "../simulation/smoke.h"
 #include "../simulation/lighting.h"
 #include "../simulation/rooms.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -406,16 +408,16 @@ static bool WorkshopHasInputForRecipe(Workshop* ws, const Recipe* recipe, int se
 
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
-        if (item->state == ITEM_IN_CONTAINER) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] == ITEM_IN_CONTAINER) continue;
         if (!RecipeInputMatches(recipe, item)) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->unreachableCooldown > 0.0f) continue;
-        int iz = (int)item->z;
+        if (itemReservedBy[i] != -1) continue;
+        if (itemUnreachableCooldown[i] > 0.0f) continue;
+        int iz = (int)itemPosZ[i];
         if (iz < ws->z - 1 || iz > ws->z + 1) continue;
 
-        int itemTileX = (int)(item->x / CELL_SIZE);
-        int itemTileY = (int)(item->y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
         int dx = itemTileX - ws->x;
         int dy = itemTileY - ws->y;
         int distSq = dx * dx + dy * dy;
@@ -455,16 +457,16 @@ bool WorkshopHasFuelForRecipe(Workshop* ws, int searchRadius) {
 
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
-        if (item->state == ITEM_IN_CONTAINER) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] == ITEM_IN_CONTAINER) continue;
         if (!ItemIsFuelOrRotten(item)) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->unreachableCooldown > 0.0f) continue;
-        int iz = (int)item->z;
+        if (itemReservedBy[i] != -1) continue;
+        if (itemUnreachableCooldown[i] > 0.0f) continue;
+        int iz = (int)itemPosZ[i];
         if (iz < ws->z - 1 || iz > ws->z + 1) continue;
 
-        int itemTileX = (int)(item->x / CELL_SIZE);
-        int itemTileY = (int)(item->y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
         int dx = itemTileX - ws->x;
         int dy = itemTileY - ws->y;
         int distSq = dx * dx + dy * dy;
@@ -494,16 +496,16 @@ int FindNearestFuelItem(Workshop* ws, int searchRadius) {
 
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
-        if (item->state == ITEM_IN_CONTAINER) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] == ITEM_IN_CONTAINER) continue;
         if (!ItemIsFuelOrRotten(item)) continue;
-        if (item->reservedBy != -1) continue;
-        if (item->unreachableCooldown > 0.0f) continue;
-        int iz = (int)item->z;
+        if (itemReservedBy[i] != -1) continue;
+        if (itemUnreachableCooldown[i] > 0.0f) continue;
+        int iz = (int)itemPosZ[i];
         if (iz < ws->z - 1 || iz > ws->z + 1) continue;
 
-        int itemTileX = (int)(item->x / CELL_SIZE);
-        int itemTileY = (int)(item->y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[i] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[i] / CELL_SIZE);
         int dx = itemTileX - ws->x;
         int dy = itemTileY - ws->y;
         int distSq = dx * dx + dy * dy;
@@ -704,7 +706,7 @@ void DeleteWorkshop(int index) {
 
         ws->active = false;
         workshopCount--;
-        InvalidateRooms();
+        InvalidateRoomsInRect(ws->x, ws->y, ws->z, ws->width, ws->height);
     }
 }
 
@@ -755,7 +757,7 @@ void RemoveBill(int workshopIdx, int billIdx) {
             // This job targets the removed bill or a bill that will shift
             // Cancel it to avoid recipe mismatch
             int moverIdx = job->assignedMover;
-            if (moverIdx >= 0 && moverIdx < moverCount && movers[moverIdx].active) {
+            if (moverIdx >= 0 && moverIdx < moverCount && moverActive[moverIdx]) {
                 CancelJob(&movers[moverIdx], moverIdx);
             }
         }
@@ -779,21 +781,7 @@ void SuspendBill(int workshopIdx, int billIdx, bool suspended) {
 
 // Count items of a type in all stockpiles
 int CountItemsInStockpiles(ItemType type) {
-    int count = 0;
-    for (int s = 0; s < MAX_STOCKPILES; s++) {
-        Stockpile* sp = &stockpiles[s];
-        if (!sp->active) continue;
-        
-        for (int sy = 0; sy < sp->height; sy++) {
-            for (int sx = 0; sx < sp->width; sx++) {
-                int slotIdx = sy * sp->width + sx;
-                if (sp->slotTypes[slotIdx] == type) {
-                    count += sp->slotCounts[slotIdx];
-                }
-            }
-        }
-    }
-    return count;
+    return LedgerItemCount(type, ITEM_IN_STOCKPILE);
 }
 
 bool ShouldBillRun(Workshop* ws, Bill* bill) {
@@ -948,12 +936,12 @@ void PassiveWorkshopsTick(float dt) {
         int inputCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
             Item* item = &items[i];
-            if (!item->active) continue;
-            if (item->state != ITEM_ON_GROUND) continue;
-            int tileX = (int)(item->x / CELL_SIZE);
-            int tileY = (int)(item->y / CELL_SIZE);
+            if (!itemActive[i]) continue;
+            if (itemState[i] != ITEM_ON_GROUND) continue;
+            int tileX = (int)(itemPosX[i] / CELL_SIZE);
+            int tileY = (int)(itemPosY[i] / CELL_SIZE);
             if (tileX != ws->workTileX || tileY != ws->workTileY) continue;
-            if ((int)item->z != ws->z) continue;
+            if ((int)itemPosZ[i] != ws->z) continue;
             if (!RecipeInputMatches(recipe, item)) continue;
             inputCount += item->stackCount;
             if (inputCount >= recipe->inputCount) break;
@@ -983,7 +971,7 @@ void PassiveWorkshopsTick(float dt) {
 
         // Emit smoke and light while passively burning
         if (ws->fuelTileX >= 0) {
-            if (GetRandomValue(0, 3) == 0) {
+            if (SimRandRange(RNG_JOBS, 0, 3) == 0) {
                 AddSmoke(ws->fuelTileX, ws->fuelTileY, ws->z, 3);
             }
             AddLightSource(ws->fuelTileX, ws->fuelTileY, ws->z, 255, 140, 50, 8);
@@ -996,12 +984,12 @@ void PassiveWorkshopsTick(float dt) {
             MaterialType inputMat = MAT_NONE;
             for (int i = 0; i < itemHighWaterMark && remaining > 0; i++) {
                 Item* item = &items[i];
-                if (!item->active) continue;
-                if (item->state != ITEM_ON_GROUND) continue;
-                int tileX = (int)(item->x / CELL_SIZE);
-                int tileY = (int)(item->y / CELL_SIZE);
+                if (!itemActive[i]) continue;
+                if (itemState[i] != ITEM_ON_GROUND) continue;
+                int tileX = (int)(itemPosX[i] / CELL_SIZE);
+                int tileY = (int)(itemPosY[i] / CELL_SIZE);
                 if (tileX != ws->workTileX || tileY != ws->workTileY) continue;
-                if ((int)item->z != ws->z) continue;
+                if ((int)itemPosZ[i] != ws->z) continue;
                 if (!RecipeInputMatches(recipe, item)) continue;
                 if (inputMat == MAT_NONE) {
                     inputMat = (MaterialType)item->material;
@@ -1031,7 +1019,7 @@ void PassiveWorkshopsTick(float dt) {
                 }
                 int outIdx = SpawnItemWithMaterial(outX, outY, (float)ws->z, recipe->outputType, outMat);
                 if (outIdx >= 0) {
-                    items[outIdx].stackCount = recipe->outputCount;
+                    SetItemStackCount(outIdx, recipe->outputCount);
                     // Hot food from passive heat-source workshops (campfire, etc.)
                     if (ws->fuelTileX >= 0 || ws->type == WORKSHOP_STOVE || ws->type == WORKSHOP_HEARTH ||
                         ws->type == WORKSHOP_CAMPFIRE || ws->type == WORKSHOP_GROUND_FIRE) {
@@ -1049,7 +1037,7 @@ void PassiveWorkshopsTick(float dt) {
                     outMat2 = DefaultMaterialForItemType(recipe->outputType2);
                 }
                 int outIdx2 = SpawnItemWithMaterial(outX, outY, (float)ws->z, recipe->outputType2, outMat2);
-                if (outIdx2 >= 0) items[outIdx2].stackCount = recipe->outputCount2;
+                if (outIdx2 >= 0) SetItemStackCount(outIdx2, recipe->outputCount2);
             }
 
             // Remove fire light
@@ -1087,8 +1075,9 @@ void UpdateWorkshopDiagnostics(float dt) {
 
         bool isWorking = false;
         if (ws->assignedCrafter >= 0 && ws->assignedCrafter < moverCount) {
-            Mover* m = &movers[ws->assignedCrafter];
-            if (m->active && m->currentJobId >= 0) {
+            int moverIdx = ws->assignedCrafter;
+            Mover* m = &movers[moverIdx];
+            if (moverActive[moverIdx] && m->currentJobId >= 0) {
                 Job* job = GetJob(m->currentJobId);
                 if (job && job->type == JOBTYPE_CRAFT && job->targetWorkshop == w) {
                     isWorking = true;
@@ -1126,10 +1115,10 @@ void UpdateWorkshopDiagnostics(float dt) {
             if (hasInput) {
                 // Check storage with actual input material
                 for (int i = 0; i < itemHighWaterMark; i++) {
-                    if (!items[i].active) continue;
+                    if (!itemActive[i]) continue;
                     if (!RecipeInputMatches(recipe, &items[i])) continue;
-                    if (items[i].reservedBy != -1) continue;
-                    if ((int)items[i].z != ws->z) continue;
+                    if (itemReservedBy[i] != -1) continue;
+                    if ((int)itemPosZ[i] != ws->z) continue;
                     uint8_t mat = items[i].material;
                     if (mat == MAT_NONE) mat = DefaultMaterialForItemType(items[i].type);
                     int outSlotX, outSlotY;
@@ -223,7 +223,7 @@ int AddBill(int workshopIdx, int recipeIdx, BillMode mode, int targetCount);
 void RemoveBill(int workshopIdx, int billIdx);
 void SuspendBill(int workshopIdx, int billIdx, bool suspended);
 bool ShouldBillRun(Workshop* ws, Bill* bill);
-int CountItemsInStockpiles(ItemType type);
+int CountItemsInStockpiles(ItemType type);  // units stored in stockpile slots (item ledger, O(1))
 
 // Fuel queries
 bool WorkshopHasFuelForRecipe(Workshop* ws, int searchRadius);
@@ -106,7 +106,7 @@ extern bool showSimSources;
 extern bool showCursorDebug;
 extern bool showHelpPanel;
 extern bool paused;
-extern int followMoverIdx;
+extern int followMoverHandle;  // mover handle (MoverIndexFromHandle), -1 = none
 
 // Pathfinding settings
 extern int pathAlgorithm;
@@ -229,7 +229,7 @@ extern int agentCount;
 // Mover settings
 extern int moverCountSetting;
 extern int itemCountSetting;
-extern MoverRenderData moverRenderData[MAX_MOVERS];
+extern MoverRenderData moverRenderData[MAX_MOVERS];  // indexed by mover handle
 
 // ============================================================================
 // Helper Functions
@@ -6,9 +6,14 @@
 #include "game_state.h"
 #include "world/cell_defs.h"
 #include "world/designations.h"
+#include "world/cell_edits.h"
 #include "world/material.h"
 #include "core/input_mode.h"
 #include "core/pie_menu.h"
+#include "core/replay.h"
+#include "core/event_log.h"
+#include "core/sim_manager.h"
+#include "core/sim_rng.h"
 #include "entities/jobs.h"
 #include "entities/workshops.h"
 #include "assets/fonts/comic_embedded.h"
@@ -59,7 +64,7 @@ bool showSimSources = false;
 bool showCursorDebug = false;
 bool showHelpPanel = false;
 bool paused = false;
-int followMoverIdx = -1;
+int followMoverHandle = -1;
 
 // Sound debug (phrase/songs experiments)
 static bool soundDebugEnabled = false;
@@ -313,13 +318,13 @@ static Color ColorFromSeed(uint32_t seed) {
 }
 
 static void AssignMoverIdentity(int idx) {
-    uint32_t seed = (uint32_t)(worldSeed ^ (uint64_t)idx ^ (uint64_t)GetRandomValue(0, 0x7FFFFFFF));
+    uint32_t seed = (uint32_t)(worldSeed ^ (uint64_t)idx ^ (uint64_t)SimRand(RNG_MOVERS));
     Mover* m = &movers[idx];
     m->appearanceSeed = seed;
     m->gender = (seed & 1) ? GENDER_FEMALE : GENDER_MALE;
     m->age = 50 + (seed >> 1) % 21;
     GenerateMoverName(m->name, m->gender, seed);
-    moverRenderData[idx].color = ColorFromSeed(seed);
+    moverRenderData[MoverHandleFromIndex(idx)].color = ColorFromSeed(seed);
 }
 
 Vector2 ScreenToGrid(Vector2 screen) {
@@ -395,21 +400,19 @@ bool FrontViewPickCell(Vector2 screen, int *outX, int *outY, int *outZ) {
 
         if (!hasContent) {
             for (int i = 0; i < itemHighWaterMark; i++) {
-                Item* it = &items[i];
-                if (!it->active) continue;
-                if (it->state == ITEM_CARRIED || it->state == ITEM_IN_STOCKPILE) continue;
-                if ((int)(it->y / CELL_SIZE) == worldY &&
-                    (int)(it->x / CELL_SIZE) == gx &&
-                    (int)it->z == gz) { hasContent = true; break; }
+                if (!itemActive[i]) continue;
+                if (itemState[i] == ITEM_CARRIED || itemState[i] == ITEM_IN_STOCKPILE) continue;
+                if ((int)(itemPosY[i] / CELL_SIZE) == worldY &&
+                    (int)(itemPosX[i] / CELL_SIZE) == gx &&
+                    (int)itemPosZ[i] == gz) { hasContent = true; break; }
             }
         }
         if (!hasContent) {
             for (int i = 0; i < moverCount; i++) {
-                Mover* m = &movers[i];
-                if (!m->active) continue;
-                if ((int)(m->y / CELL_SIZE) == worldY &&
-                    (int)(m->x / CELL_SIZE) == gx &&
-                    (int)m->z == gz) { hasContent = true; break; }
+                if (!moverActive[i]) continue;
+                if ((int)(moverPosY[i] / CELL_SIZE) == worldY &&
+                    (int)(moverPosX[i] / CELL_SIZE) == gx &&
+                    (int)moverPosZ[i] == gz) { hasContent = true; break; }
             }
         }
 
@@ -453,12 +456,11 @@ int GetMoverAtWorldPos(float wx, float wy, int wz) {
     float radius = CELL_SIZE * 0.6f;
 
     for (int i = 0; i < moverCount; i++) {
-        Mover* m = &movers[i];
-        if (!m->active) continue;
-        if ((int)m->z != wz) continue;
+        if (!moverActive[i]) continue;
+        if ((int)moverPosZ[i] != wz) continue;
 
-        float dx = m->x - wx;
-        float dy = m->y - wy;
+        float dx = moverPosX[i] - wx;
+        float dy = moverPosY[i] - wy;
         float dist = sqrtf(dx*dx + dy*dy);
         if (dist < radius && dist < bestDist) {
             bestDist = dist;
@@ -503,17 +505,16 @@ int GetMoverAtFrontView(float screenX, float screenY, int yStart, int yEnd) {
     int bestIdx = -1;
 
     for (int i = 0; i < moverCount; i++) {
-        Mover* m = &movers[i];
-        if (!m->active) continue;
-        int moverCellY = (int)(m->y / CELL_SIZE);
+        if (!moverActive[i]) continue;
+        int moverCellY = (int)(moverPosY[i] / CELL_SIZE);
         if (moverCellY < yStart || moverCellY > yEnd) continue;
 
         int layer = moverCellY - yStart;
         if (layer < 0 || layer >= depthLayers) continue;
         float layerOff = (depthLayers - 1 - layer) * floorThickness;
 
-        float msx = offset.x + (m->x / CELL_SIZE) * size + size * 0.5f;
-        float msy = offset.y + (gridDepth - 1 - (int)m->z) * size - layerOff + size * 0.5f;
+        float msx = offset.x + (moverPosX[i] / CELL_SIZE) * size + size * 0.5f;
+        float msy = offset.y + (gridDepth - 1 - (int)moverPosZ[i]) * size - layerOff + size * 0.5f;
 
         float dx = screenX - msx;
         float dy = screenY - msy;
@@ -563,10 +564,10 @@ int GetAnimalAtFrontView(float screenX, float screenY, int yStart, int yEnd) {
 int GetItemsAtCell(int cellX, int cellY, int cellZ, int* outItems, int maxItems) {
     int count = 0;
     for (int i = 0; i < MAX_ITEMS && count < maxItems; i++) {
-        if (!items[i].active) continue;
-        int ix = (int)(items[i].x / CELL_SIZE);
-        int iy = (int)(items[i].y / CELL_SIZE);
-        int iz = (int)(items[i].z);
+        if (!itemActive[i]) continue;
+        int ix = (int)(itemPosX[i] / CELL_SIZE);
+        int iy = (int)(itemPosY[i] / CELL_SIZE);
+        int iz = (int)(itemPosZ[i]);
         if (ix == cellX && iy == cellY && iz == cellZ) {
             outItems[count++] = i;
         }
@@ -576,6 +577,7 @@ int GetItemsAtCell(int cellX, int cellY, int cellZ, int* outItems, int maxItems)
 
 void GenerateCurrentTerrain(void) {
     TraceLog(LOG_INFO, "Generating terrain: %s", terrainNames[currentTerrain]);
+    BeginCellEdits();
     switch (currentTerrain) {
         case 0: InitGrid(); break;
         case 1: GenerateSparse(0.10f); break;
@@ -603,6 +605,7 @@ void GenerateCurrentTerrain(void) {
         case 23: GenerateMoodTest(); break;
     }
     SyncMaterialsToTerrain();
+    CommitCellEdits();
 }
 
 // ============================================================================
@@ -691,7 +694,7 @@ void AddMoversDemo(int count) {
         float x = start.x * CELL_SIZE + CELL_SIZE * 0.5f;
         float y = start.y * CELL_SIZE + CELL_SIZE * 0.5f;
         float z = (float)start.z;
-        float speed = balance.baseMoverSpeed * (1.0f + balance.moverSpeedVariance * (GetRandomValue(-100, 100) / 100.0f));
+        float speed = balance.baseMoverSpeed * (1.0f + balance.moverSpeedVariance * (SimRandRange(RNG_MOVERS, -100, 100) / 100.0f));
 
         startPos = start;
         goalPos = goal;
@@ -704,9 +707,9 @@ void AddMoversDemo(int count) {
 
         if (pathLength > 0) {
             InitMoverWithPath(m, x, y, z, goal, speed, path, pathLength);
-            if (useStringPulling && m->pathLength > 2) {
-                StringPullPath(moverPaths[moverCount], &m->pathLength);
-                m->pathIndex = m->pathLength - 1;
+            if (useStringPulling && moverPathLength[moverCount] > 2) {
+                StringPullPath(moverPaths[moverCount], &moverPathLength[moverCount]);
+                moverPathIndex[moverCount] = moverPathLength[moverCount] - 1;
             }
         } else {
             InitMover(m, x, y, z, goal, speed);
@@ -742,7 +745,7 @@ void SpawnMoversDemo(int count) {
         float x = start.x * CELL_SIZE + CELL_SIZE * 0.5f;
         float y = start.y * CELL_SIZE + CELL_SIZE * 0.5f;
         float z = (float)start.z;
-        float speed = balance.baseMoverSpeed * (1.0f + balance.moverSpeedVariance * (GetRandomValue(-100, 100) / 100.0f));
+        float speed = balance.baseMoverSpeed * (1.0f + balance.moverSpeedVariance * (SimRandRange(RNG_MOVERS, -100, 100) / 100.0f));
 
         startPos = start;
         goalPos = goal;
@@ -756,9 +759,9 @@ void SpawnMoversDemo(int count) {
         if (pathLength > 0) {
             InitMoverWithPath(m, x, y, z, goal, speed, path, pathLength);
 
-            if (useStringPulling && m->pathLength > 2) {
-                StringPullPath(moverPaths[moverCount], &m->pathLength);
-                m->pathIndex = m->pathLength - 1;
+            if (useStringPulling && moverPathLength[moverCount] > 2) {
+                StringPullPath(moverPaths[moverCount], &moverPathLength[moverCount]);
+                moverPathIndex[moverCount] = moverPathLength[moverCount] - 1;
             }
 
         } else {
@@ -890,8 +893,8 @@ void RebuildPostLoadState(void);
 // Headless Mode - Run simulation without GUI
 // ============================================================================
 
-static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
-    // Initialize minimal state (no window)
+// Minimal state for running without a window; a save is loaded on top
+static void InitHeadlessState(void) {
     use8Dir = true;
     InitGridWithSizeAndChunkSize(32, 32, 8, 8);
     gridDepth = 16;
@@ -914,6 +917,11 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
     InitRooms();
     InitPlants();
     InitFarming();
+}
+
+static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
+    // Initialize minimal state (no window)
+    InitHeadlessState();
 
     // Handle .gz decompression
     const char* actualFile = loadFile;
@@ -948,10 +956,10 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
     // Snapshot state before
     int stuckBefore = 0;
     for (int i = 0; i < moverCount; i++) {
-        if (movers[i].active) {
-            int mx = (int)(movers[i].x / CELL_SIZE);
-            int my = (int)(movers[i].y / CELL_SIZE);
-            int mz = (int)movers[i].z;
+        if (moverActive[i]) {
+            int mx = (int)(moverPosX[i] / CELL_SIZE);
+            int my = (int)(moverPosY[i] / CELL_SIZE);
+            int mz = (int)moverPosZ[i];
             if (!IsCellWalkableAt(mz, my, mx)) stuckBefore++;
         }
     }
@@ -960,17 +968,8 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
     clock_t startClock = clock();
     for (int t = 0; t < ticks; t++) {
         double tickStart = GetTime();
-        TickWithDt(TICK_DT);
-        ItemsTick(TICK_DT);
-        AnimalsTick(TICK_DT);
-        TrainsTick(TICK_DT);
-        DesignationsTick(TICK_DT);
-        NeedsTick();
-        ProcessFreetimeNeeds();
-        MoodTick(TICK_DT);
-        AssignJobs();
-        JobsTick();
-        PROFILE_FRAME_END();  // Store profiler data for this tick
+        RunSimTick(TICK_DT);
+        PROFILE_FRAME_END();  // Store profiler data for this tick (and drain the trace)
         double tickTime = (GetTime() - tickStart) * 1000.0;
         if (tickTime > 100.0) {
             TraceLog(LOG_WARNING, "SLOW TICK %d: %.1fms", t, tickTime);
@@ -982,10 +981,10 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
     int stuckAfter = 0;
     int moversInNonWalkable = 0;
     for (int i = 0; i < moverCount; i++) {
-        if (movers[i].active) {
-            int mx = (int)(movers[i].x / CELL_SIZE);
-            int my = (int)(movers[i].y / CELL_SIZE);
-            int mz = (int)movers[i].z;
+        if (moverActive[i]) {
+            int mx = (int)(moverPosX[i] / CELL_SIZE);
+            int my = (int)(moverPosY[i] / CELL_SIZE);
+            int mz = (int)moverPosZ[i];
             if (!IsCellWalkableAt(mz, my, mx)) {
                 moversInNonWalkable++;
             }
@@ -1029,17 +1028,15 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
     printf("\n");
     
     // Active cell counts
-    extern WaterCell waterGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-    extern FireCell fireGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-    extern SteamCell steamGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+    extern WORLD_LAYER(WaterCell, waterGrid);
     int waterCells = 0, fireCells = 0, steamCells = 0, smokeCells = 0;
     for (int z = 0; z < gridDepth; z++) {
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
                 if (waterGrid[z][y][x].level > 0) waterCells++;
-                if (fireGrid[z][y][x].level > 0) fireCells++;
-                if (steamGrid[z][y][x].level > 0) steamCells++;
-                if (smokeGrid[z][y][x].level > 0) smokeCells++;
+                if (FireCellAt(x, y, z)->level > 0) fireCells++;
+                if (SteamCellAt(x, y, z)->level > 0) steamCells++;
+                if (SmokeCellAt(x, y, z)->level > 0) smokeCells++;
             }
         }
     }
@@ -1047,7 +1044,6 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
            waterCells, fireCells, steamCells, smokeCells);
     
     // Smoke per z-level with cell locations
-    extern SmokeCell smokeGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
     int smokeTotalLevel = 0;
     int smokeMaxZ = -1;
     int highestSmokeX = -1, highestSmokeY = -1;
@@ -1057,8 +1053,8 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
         int cellCount = 0;
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
-                if (smokeGrid[z][y][x].level > 0) {
-                    levelSum += smokeGrid[z][y][x].level;
+                if (SmokeCellAt(x, y, z)->level > 0) {
+                    levelSum += SmokeCellAt(x, y, z)->level;
                     cellCount++;
                     if (z > smokeMaxZ) {
                         highestSmokeX = x;
@@ -1085,14 +1081,14 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
             if (strcmp(arg, "all") == 0) {
                 for (int m = 0; m < moverCount; m++) {
                     Mover* mv = &movers[m];
-                    if (!mv->active) continue;
-                    int mx = (int)(mv->x / CELL_SIZE);
-                    int my = (int)(mv->y / CELL_SIZE);
-                    int mz = (int)mv->z;
+                    if (!moverActive[m]) continue;
+                    int mx = (int)(moverPosX[m] / CELL_SIZE);
+                    int my = (int)(moverPosY[m] / CELL_SIZE);
+                    int mz = (int)moverPosZ[m];
                     bool walkable = IsCellWalkableAt(mz, my, mx);
                     printf("Mover %d (%s): cell (%d,%d,z%d) %s goal=(%d,%d,z%d) path=%d\n",
                            m, MoverDisplayName(m), mx, my, mz, walkable ? "OK" : "STUCK!",
-                           mv->goal.x, mv->goal.y, mv->goal.z, mv->pathLength);
+                           mv->goal.x, mv->goal.y, mv->goal.z, moverPathLength[m]);
                     printf("  H:%.0f%% T:%.0f%% E:%.0f%% B:%.0f%% Mood:%.0f%% Job:%d Freetime:%d\n",
                            mv->hunger*100, mv->thirst*100, mv->energy*100, mv->bladder*100,
                            (mv->mood+1)*50, mv->currentJobId, mv->freetimeState);
@@ -1101,14 +1097,14 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
                 int idx = atoi(arg);
                 if (idx >= 0 && idx < moverCount) {
                     Mover* mv = &movers[idx];
-                    int mx = (int)(mv->x / CELL_SIZE);
-                    int my = (int)(mv->y / CELL_SIZE);
-                    int mz = (int)mv->z;
+                    int mx = (int)(moverPosX[idx] / CELL_SIZE);
+                    int my = (int)(moverPosY[idx] / CELL_SIZE);
+                    int mz = (int)moverPosZ[idx];
                     printf("Mover %d:\n", idx);
-                    printf("  Position: (%.2f, %.2f, z%d) -> cell (%d, %d)\n", mv->x, mv->y, mz, mx, my);
+                    printf("  Position: (%.2f, %.2f, z%d) -> cell (%d, %d)\n", moverPosX[idx], moverPosY[idx], mz, mx, my);
                     printf("  Walkable: %s\n", IsCellWalkableAt(mz, my, mx) ? "YES" : "NO");
                     printf("  Goal: (%d, %d, z%d)\n", mv->goal.x, mv->goal.y, mv->goal.z);
-                    printf("  Path length: %d, index: %d\n", mv->pathLength, mv->pathIndex);
+                    printf("  Path length: %d, index: %d\n", moverPathLength[idx], moverPathIndex[idx]);
                     printf("  Time without progress: %.2f\n", mv->timeWithoutProgress);
                 }
             }
@@ -1132,6 +1128,85 @@ static int RunHeadless(const char* loadFile, int ticks, int argc, char** argv) {
     return 0;
 }
 
+// ============================================================================
+// Replay Mode - Re-run a recording headless and time every tick
+// ============================================================================
+
+static int CompareDouble(const void* a, const void* b) {
+    double da = *(const double*)a, db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static int RunReplay(const char* replayFile) {
+    InitHeadlessState();
+    Console_Init();
+    Console_RegisterGameVars();
+
+    if (!ReplayOpen(replayFile)) {
+        printf("Failed to open replay: %s (and %s.sav)\n", replayFile, replayFile);
+        return 1;
+    }
+    printf("Replaying: %s (seed %llu)\n", replayFile, (unsigned long long)GetSimRngSeed());
+
+    int capacity = 4096, count = 0;
+    double* tickMs = malloc(capacity * sizeof(double));
+    float dt = TICK_DT;
+    while (ReplayApplyTick(&dt)) {
+        uint64_t start = ProfileNowNs();
+        RunSimTick(dt);
+        PROFILE_FRAME_END();
+        double ms = (double)(ProfileNowNs() - start) / 1e6;
+        if (count == capacity) {
+            capacity *= 2;
+            tickMs = realloc(tickMs, capacity * sizeof(double));
+        }
+        tickMs[count++] = ms;
+        ReplayEndTick();
+    }
+    ReplayClose();
+
+    printf("\n=== REPLAY RESULTS ===\n");
+    printf("Ticks: %d\n", count);
+    if (count > 0) {
+        double total = 0.0;
+        for (int i = 0; i < count; i++) total += tickMs[i];
+
+        // Slowest ticks, by tick number, before sorting destroys the order
+        int slowest[5];
+        int slowCount = count < 5 ? count : 5;
+        for (int s = 0; s < slowCount; s++) {
+            int best = -1;
+            for (int i = 0; i < count; i++) {
+                bool taken = false;
+                for (int k = 0; k < s; k++) if (slowest[k] == i) taken = true;
+                if (!taken && (best < 0 || tickMs[i] > tickMs[best])) best = i;
+            }
+            slowest[s] = best;
+        }
+        printf("Slowest ticks:");
+        for (int s = 0; s < slowCount; s++) printf(" #%d=%.2fms", slowest[s], tickMs[slowest[s]]);
+        printf("\n");
+
+        qsort(tickMs, count, sizeof(double), CompareDouble);
+        printf("Total: %.2f ms, mean %.3f ms/tick\n", total, total / count);
+        printf("p50=%.3f p95=%.3f p99=%.3f max=%.3f ms\n",
+               tickMs[(count - 1) * 50 / 100], tickMs[(count - 1) * 95 / 100],
+               tickMs[(count - 1) * 99 / 100], tickMs[count - 1]);
+    }
+    free(tickMs);
+
+    uint64_t hash = ComputeSimStateHash();
+    if (ReplayHasEndHash()) {
+        bool match = hash == ReplayGetEndHash() && (uint32_t)count == ReplayGetEndTick();
+        printf("State: %s (hash %016llx, recorded %016llx at tick %u)\n",
+               match ? "MATCH" : "DIVERGED", (unsigned long long)hash,
+               (unsigned long long)ReplayGetEndHash(), ReplayGetEndTick());
+        return match ? 0 : 2;
+    }
+    printf("State: no end record (recording was cut short), hash %016llx\n", (unsigned long long)hash);
+    return 0;
+}
+
 // ============================================================================
 // Screen Shake
 // ============================================================================
@@ -1174,6 +1249,57 @@ int main(int argc, char** argv) {
         return InspectSaveFile(argc, argv);
     }
 
+    // Check for --events mode (decode an --event-stream file to text)
+    if (argc >= 2 && strcmp(argv[1], "--events") == 0) {
+        if (argc < 3) {
+            printf("Usage: %s --events <stream> [--grep TEXT]\n", argv[0]);
+            return 1;
+        }
+        const char* filter = NULL;
+        for (int i = 3; i + 1 < argc; i++) {
+            if (strcmp(argv[i], "--grep") == 0) filter = argv[i + 1];
+        }
+        if (!EventLogDecodeFile(argv[2], stdout, filter)) {
+            fprintf(stderr, "Failed to read event stream: %s\n", argv[2]);
+            return 1;
+        }
+        return 0;
+    }
+
+    // Check for --trace option (profiler spans + counters as Chrome trace JSON)
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--trace") == 0) {
+            if (i + 1 < argc) {
+                if (ProfileTraceStart(argv[i + 1])) {
+                    printf("Tracing to: %s\n", argv[i + 1]);
+                } else {
+                    printf("Failed to open trace file: %s\n", argv[i + 1]);
+                }
+            } else {
+                printf("Warning: --trace requires a filename\n");
+                printf("Usage: %s --trace <trace.json>\n", argv[0]);
+            }
+            break;
+        }
+    }
+
+    // Check for --event-stream option (binary event log of the whole run, see --events)
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--event-stream") == 0) {
+            if (i + 1 < argc) {
+                if (EventLogStreamStart(argv[i + 1])) {
+                    printf("Streaming events to: %s\n", argv[i + 1]);
+                } else {
+                    printf("Failed to open event stream: %s\n", argv[i + 1]);
+                }
+            } else {
+                printf("Warning: --event-stream requires a filename\n");
+                printf("Usage: %s --event-stream <events.bin>\n", argv[0]);
+            }
+            break;
+        }
+    }
+
     // Check for --headless mode
     const char* headlessFile = NULL;
     int headlessTicks = 100;
@@ -1189,10 +1315,31 @@ int main(int argc, char** argv) {
                 }
             }
             if (!headlessFile) {
-                printf("Usage: %s --headless --load <savefile> [--ticks N] [--save <outfile>] [--mover N] [--cell X,Y,Z] ...\n", argv[0]);
+                printf("Usage: %s --headless --load <savefile> [--ticks N] [--save <outfile>] [--trace <file>] [--event-stream <file>] [--mover N] [--cell X,Y,Z] ...\n", argv[0]);
+                ProfileTraceStop();
+                EventLogStreamStop();
                 return 1;
             }
-            return RunHeadless(headlessFile, headlessTicks, argc, argv);
+            int result = RunHeadless(headlessFile, headlessTicks, argc, argv);
+            ProfileTraceStop();
+            EventLogStreamStop();
+            return result;
+        }
+    }
+
+    // Check for --replay mode (re-run a --record session headless)
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--replay") == 0) {
+            if (i + 1 >= argc) {
+                printf("Usage: %s --replay <recording> [--trace <file>] [--event-stream <file>]\n", argv[0]);
+                ProfileTraceStop();
+                EventLogStreamStop();
+                return 1;
+            }
+            int result = RunReplay(argv[i + 1]);
+            ProfileTraceStop();
+            EventLogStreamStop();
+            return result;
         }
     }
 
@@ -1305,6 +1452,27 @@ int main(int argc, char** argv) {
         }
     }
 
+    // Interactive play trades tick determinism for a steady frame rate;
+    // --record switches back to the fixed repath count
+    repathBudgetMs = REPATH_BUDGET_INTERACTIVE_MS;
+
+    // Check for --record option (command log for --replay)
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--record") == 0) {
+            if (i + 1 < argc) {
+                if (ReplayStartRecording(argv[i + 1], worldSeed)) {
+                    printf("Recording to: %s (+ %s.sav)\n", argv[i + 1], argv[i + 1]);
+                } else {
+                    printf("Failed to start recording: %s\n", argv[i + 1]);
+                }
+            } else {
+                printf("Warning: --record requires a filename\n");
+                printf("Usage: %s --record <recording>\n", argv[0]);
+            }
+            break;
+        }
+    }
+
     float accumulator = 0.0f;
 
     while (!WindowShouldClose() && !shouldQuit) {
@@ -1439,7 +1607,7 @@ int main(int argc, char** argv) {
             if (pathStatsUpdated) {
                 int blockedCount = 0;
                 for (int i = 0; i < moverCount; i++) {
-                    if (movers[i].active && movers[i].pathLength == 0) {
+                    if (moverActive[i] && moverPathLength[i] == 0) {
                         blockedCount++;
                     }
                 }
@@ -1464,26 +1632,9 @@ int main(int argc, char** argv) {
             float tickDt = useFixedTimestep ? TICK_DT : frameTime;
             
             if (shouldTick) {
-                PROFILE_BEGIN(Tick);
-                TickWithDt(tickDt);
-                PROFILE_END(Tick);
-                PROFILE_BEGIN(ItemsTick);
-                ItemsTick(tickDt);
-                PROFILE_END(ItemsTick);
-                PROFILE_BEGIN(AnimalsTick);
-                AnimalsTick(tickDt);
-                PROFILE_END(AnimalsTick);
-                TrainsTick(tickDt);
-                DesignationsTick(tickDt);
-                NeedsTick();
-                ProcessFreetimeNeeds();
-                MoodTick(tickDt);
-                PROFILE_BEGIN(AssignJobs);
-                AssignJobs();
-                PROFILE_END(AssignJobs);
-                PROFILE_BEGIN(JobsTick);
-                JobsTick();
-                PROFILE_END(JobsTick);
+                ReplayBeginTick(tickDt);
+                RunSimTick(tickDt);
+                ReplayEndTick();
                 
                 // Periodically validate simulation activity counters (every 60 seconds)
                 static float simValidationTimer = 0.0f;
@@ -1510,9 +1661,10 @@ int main(int argc, char** argv) {
             gameOverTriggered = true;
         }
 
-        if (followMoverIdx >= 0) {
-            if (followMoverIdx >= moverCount || !movers[followMoverIdx].active) {
-                followMoverIdx = -1;
+        int followIdx = MoverIndexFromHandle(followMoverHandle);
+        if (followIdx >= 0) {
+            if (followIdx >= moverCount || !moverActive[followIdx]) {
+                followMoverHandle = -1;
             } else {
                 float centerX = GetScreenWidth() * 0.5f;
                 float centerY = GetScreenHeight() * 0.5f;
@@ -1522,18 +1674,18 @@ int main(int argc, char** argv) {
                 if (frontViewMode) {
                     // Front view: X from mover world X, Y from mover world Z
                     float size = CELL_SIZE * zoom;
-                    float targetX = centerX - (movers[followMoverIdx].x / CELL_SIZE) * size;
-                    float targetY = centerY - (gridDepth - 1 - movers[followMoverIdx].z) * size;
+                    float targetX = centerX - (moverPosX[followIdx] / CELL_SIZE) * size;
+                    float targetY = centerY - (gridDepth - 1 - moverPosZ[followIdx]) * size;
                     offset.x += (targetX - offset.x) * t;
                     offset.y += (targetY - offset.y) * t;
                     // Track mover's Y-slice as front depth layer
-                    frontViewY = (int)(movers[followMoverIdx].y / CELL_SIZE);
+                    frontViewY = (int)(moverPosY[followIdx] / CELL_SIZE);
                 } else {
-                    float targetX = centerX - movers[followMoverIdx].x * zoom;
-                    float targetY = centerY - movers[followMoverIdx].y * zoom;
+                    float targetX = centerX - moverPosX[followIdx] * zoom;
+                    float targetY = centerY - moverPosY[followIdx] * zoom;
                     offset.x += (targetX - offset.x) * t;
                     offset.y += (targetY - offset.y) * t;
-                    currentViewZ = (int)movers[followMoverIdx].z;
+                    currentViewZ = (int)moverPosZ[followIdx];
                 }
             }
         }
@@ -2356,6 +2508,9 @@ int main(int argc, char** argv) {
         SoundSynthDestroy(soundDebugSynth);
         soundDebugSynth = NULL;
     }
+    ReplayStopRecording();
+    ProfileTraceStop();
+    EventLogStreamStop();
     CloseWindow();
     return 0;
 }
@@ -479,7 +479,7 @@ static void DrawCellGrid(void) {
 
                 // Floor dirt overlay (tracked-in dirt from natural terrain)
                 {
-                    uint8_t dirt = floorDirtGrid[z][y][x];
+                    uint8_t dirt = FloorDirtAt(x, y, z);
                     if (dirt >= DIRT_VISIBLE_THRESHOLD) {
                         Rectangle dirtSrc = SpriteGetRect(SPRITE_finish_messy);
                         float t = (float)(dirt - DIRT_VISIBLE_THRESHOLD)
@@ -1052,7 +1052,7 @@ static void DrawFire(void) {
             for (int x = minX; x < maxX; x++) {
                 if (!IsCellVisibleFromAbove(x, y, zDepth + 1, z)) continue;
                 
-                FireCell* cell = &fireGrid[zDepth][y][x];
+                const FireCell* cell = FireCellAt(x, y, zDepth);
                 int level = cell->level;
                 
                 if (level == 0 && HAS_CELL_FLAG(x, y, zDepth, CELL_FLAG_BURNED)) {
@@ -1083,7 +1083,7 @@ static void DrawFire(void) {
                 fireZ = z - 1;
             }
             
-            FireCell* cell = &fireGrid[fireZ][y][x];
+            const FireCell* cell = FireCellAt(x, y, fireZ);
             int level = cell->level;
             
             if (level == 0 && HAS_CELL_FLAG(x, y, fireZ, CELL_FLAG_BURNED)) {
@@ -1418,15 +1418,15 @@ static void DrawAgents(void) {
     }
 }
 
-static void DrawMoverPath(int moverIdx, const Mover* m, float sx, float sy, int viewZ,
+static void DrawMoverPath(int moverIdx, float sx, float sy, int viewZ,
                           Color color, float lineWidth, float segmentWidth, float segmentFade) {
-    Point next = moverPaths[moverIdx][m->pathIndex];
+    Point next = moverPaths[moverIdx][moverPathIndex[moverIdx]];
     if (next.z == viewZ) {
         float tx = offset.x + (next.x * CELL_SIZE + CELL_SIZE * 0.5f) * zoom;
         float ty = offset.y + (next.y * CELL_SIZE + CELL_SIZE * 0.5f) * zoom;
         DrawLineEx((Vector2){sx, sy}, (Vector2){tx, ty}, lineWidth, color);
     }
-    for (int j = m->pathIndex; j > 0; j--) {
+    for (int j = moverPathIndex[moverIdx]; j > 0; j--) {
         if (moverPaths[moverIdx][j].z != viewZ || moverPaths[moverIdx][j-1].z != viewZ) continue;
         float px1 = offset.x + (moverPaths[moverIdx][j].x * CELL_SIZE + CELL_SIZE * 0.5f) * zoom;
         float py1 = offset.y + (moverPaths[moverIdx][j].y * CELL_SIZE + CELL_SIZE * 0.5f) * zoom;
@@ -1437,6 +1437,7 @@ static void DrawMoverPath(int moverIdx, const Mover* m, float sx, float sy, int
 }
 
 static Vector2 CalcWorkAnimOffset(Mover* m) {
+    int moverIdx = (int)(m - movers);
     Vector2 off = {0, 0};
     Job* job = (m->currentJobId >= 0) ? GetJob(m->currentJobId) : NULL;
     bool isWorking = job && (job->step == STEP_WORKING || job->step == CRAFT_STEP_WORKING);
@@ -1478,8 +1479,8 @@ static Vector2 CalcWorkAnimOffset(Mover* m) {
 
         if (workTargetX >= 0) {
             float wave = sinf(m->workAnimPhase * WORK_SWAY_FREQ * 2.0f * PI);
-            float ddx = workTargetX - m->x;
-            float ddy = workTargetY - m->y;
+            float ddx = workTargetX - moverPosX[moverIdx];
+            float ddy = workTargetY - moverPosY[moverIdx];
             float dist = sqrtf(ddx * ddx + ddy * ddy);
             if (dist > 0.01f) { ddx /= dist; ddy /= dist; }
             float swayAmount = wave * WORK_SWAY_AMPLITUDE * CELL_SIZE * zoom;
@@ -1491,16 +1492,17 @@ static Vector2 CalcWorkAnimOffset(Mover* m) {
 }
 
 static void DrawCarriedItem(const Mover* m, float sx, float sy, int viewZ, Color skyColor) {
+    int moverIdx = (int)(m - movers);
     Job* moverJob = (m->currentJobId >= 0) ? GetJob(m->currentJobId) : NULL;
     int carryingItem = moverJob ? moverJob->carryingItem : -1;
     if (carryingItem < 0 && moverJob && moverJob->step == CRAFT_STEP_CARRYING_FUEL) {
         carryingItem = moverJob->fuelItem;
     }
-    if (carryingItem < 0 || !items[carryingItem].active) return;
+    if (carryingItem < 0 || !itemActive[carryingItem]) return;
 
     float size = CELL_SIZE * zoom;
     float moverSize = size * MOVER_SIZE;
-    int moverZ = (int)m->z;
+    int moverZ = (int)moverPosZ[moverIdx];
 
     Item* item = &items[carryingItem];
     int sprite = ItemSpriteForTypeMaterial(item->type, item->material);
@@ -1509,8 +1511,8 @@ static void DrawCarriedItem(const Mover* m, float sx, float sy, int viewZ, Color
     Rectangle itemDest = { sx - itemSize/2, itemY, itemSize, itemSize };
 
     // Apply depth tinting, darkening, and lighting to carried items
-    int cellX = (int)(m->x / CELL_SIZE);
-    int cellY = (int)(m->y / CELL_SIZE);
+    int cellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
     Color lightTint = GetLightColor(cellX, cellY, moverZ, skyColor);
     Color itemTint = MultiplyColor(lightTint, ItemTypeTint(item->type));
     Color borderTint = MultiplyColor(ItemBorderTint(item->type), lightTint);
@@ -1542,26 +1544,26 @@ static void DrawMovers(void) {
 
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) continue;
+        if (!moverActive[i]) continue;
 
         // Riding movers are rendered at train position in DrawTrains loop
         if (m->transportState == TRANSPORT_RIDING) continue;
 
-        int moverZ = (int)m->z;
+        int moverZ = (int)moverPosZ[i];
 
         // Only draw movers within visible depth range (current z and up to 9 levels below)
         if (moverZ > viewZ || moverZ < viewZ - MAX_VISIBLE_DEPTH) continue;
         
         // Check if mover is visible (clear line of sight from above)
         if (moverZ < viewZ) {
-            int cellX = (int)(m->x / CELL_SIZE);
-            int cellY = (int)(m->y / CELL_SIZE);
+            int cellX = (int)(moverPosX[i] / CELL_SIZE);
+            int cellY = (int)(moverPosY[i] / CELL_SIZE);
             if (!IsCellVisibleFromAbove(cellX, cellY, moverZ + 1, viewZ)) continue;
         }
 
         // Screen position
-        float sx = offset.x + m->x * zoom;
-        float sy = offset.y + m->y * zoom;
+        float sx = offset.x + moverPosX[i] * zoom;
+        float sy = offset.y + moverPosY[i] * zoom;
         
         // Frustum cull - skip movers outside visible area
         if (sx < minX || sx > maxX || sy < minY || sy > maxY) continue;
@@ -1600,10 +1602,10 @@ static void DrawMovers(void) {
                 moverColor = GREEN;
             }
         } else if (showOpenArea) {
-            bool open = IsMoverInOpenArea(m->x, m->y, (int)m->z);
+            bool open = IsMoverInOpenArea(moverPosX[i], moverPosY[i], (int)moverPosZ[i]);
             moverColor = open ? SKYBLUE : MAGENTA;
         } else if (showNeighborCounts) {
-            int neighbors = QueryMoverNeighbors(m->x, m->y, MOVER_AVOID_RADIUS, i, NULL, NULL);
+            int neighbors = QueryMoverNeighbors(moverPosX[i], moverPosY[i], MOVER_AVOID_RADIUS, i, NULL, NULL);
             if (neighbors == 0) {
                 moverColor = GREEN;
             } else if (neighbors <= 3) {
@@ -1613,13 +1615,13 @@ static void DrawMovers(void) {
             } else {
                 moverColor = RED;
             }
-        } else if (m->currentJobId >= 0 && m->repathCooldown > 0 && m->pathLength == 0) {
+        } else if (m->currentJobId >= 0 && m->repathCooldown > 0 && moverPathLength[i] == 0) {
             moverColor = ORANGE;
-        } else if (m->currentJobId >= 0 && m->pathLength == 0) {
+        } else if (m->currentJobId >= 0 && moverPathLength[i] == 0) {
             moverColor = RED;
-        } else if (m->needsRepath) {
+        } else if (moverNeedsRepath[i]) {
             moverColor = YELLOW;
-        } else if (m->currentJobId < 0 && m->pathLength == 0 && m->repathCooldown > 0) {
+        } else if (m->currentJobId < 0 && moverPathLength[i] == 0 && m->repathCooldown > 0) {
             moverColor = (Color){ 255, 200, 200, 255 };  // Faint pink: recently disrupted, now idle
         } else {
             moverColor = WHITE;
@@ -1638,8 +1640,8 @@ static void DrawMovers(void) {
 
         // Apply lighting
         {
-            int cellX = (int)(m->x / CELL_SIZE);
-            int cellY = (int)(m->y / CELL_SIZE);
+            int cellX = (int)(moverPosX[i] / CELL_SIZE);
+            int cellY = (int)(moverPosY[i] / CELL_SIZE);
             moverColor = MultiplyColor(moverColor, GetLightColor(cellX, cellY, moverZ, skyColor));
         }
 
@@ -1650,7 +1652,7 @@ static void DrawMovers(void) {
 
         // Draw clothing outline behind mover (larger tinted sprite)
         if (m->equippedClothing >= 0 && m->equippedClothing < MAX_ITEMS
-            && items[m->equippedClothing].active) {
+            && itemActive[m->equippedClothing]) {
             Color clothColor;
             switch (items[m->equippedClothing].type) {
                 case ITEM_GRASS_TUNIC:   clothColor = (Color){120, 160, 80, 200}; break;  // green
@@ -1680,24 +1682,22 @@ static void DrawMovers(void) {
     if (showMoverPaths) {
         PROFILE_BEGIN(MoverPaths);
         for (int i = 0; i < moverCount; i++) {
-            Mover* m = &movers[i];
-            if (!m->active || m->pathIndex < 0) continue;
-            if ((int)m->z != viewZ) continue;
+            if (!moverActive[i] || moverPathIndex[i] < 0) continue;
+            if ((int)moverPosZ[i] != viewZ) continue;
 
-            float sx = offset.x + m->x * zoom;
-            float sy = offset.y + m->y * zoom;
-            DrawMoverPath(i, m, sx, sy, viewZ, moverRenderData[i].color, 2.0f, 1.0f, 0.4f);
+            float sx = offset.x + moverPosX[i] * zoom;
+            float sy = offset.y + moverPosY[i] * zoom;
+            DrawMoverPath(i, sx, sy, viewZ, moverRenderData[MoverHandleFromIndex(i)].color, 2.0f, 1.0f, 0.4f);
         }
         PROFILE_END(MoverPaths);
     }
     
     // Draw hovered mover's path (always, even if showMoverPaths is off)
     if (hoveredMover >= 0 && !showMoverPaths) {
-        Mover* m = &movers[hoveredMover];
-        if (m->active && m->pathIndex >= 0) {
-            float sx = offset.x + m->x * zoom;
-            float sy = offset.y + m->y * zoom;
-            DrawMoverPath(hoveredMover, m, sx, sy, viewZ, YELLOW, 2.0f, 2.0f, 0.6f);
+        if (moverActive[hoveredMover] && moverPathIndex[hoveredMover] >= 0) {
+            float sx = offset.x + moverPosX[hoveredMover] * zoom;
+            float sy = offset.y + moverPosY[hoveredMover] * zoom;
+            DrawMoverPath(hoveredMover, sx, sy, viewZ, YELLOW, 2.0f, 2.0f, 0.6f);
         }
     }
 }
@@ -1925,7 +1925,7 @@ static void DrawTrains(void) {
         // Draw riding movers distributed across vehicles
         for (int r = 0; r < t->ridingCount; r++) {
             int mIdx = t->ridingMovers[r];
-            if (mIdx < 0 || mIdx >= moverCount || !movers[mIdx].active) continue;
+            if (mIdx < 0 || mIdx >= moverCount || !moverActive[mIdx]) continue;
 
             int vehicleIdx = r % totalVehicles;
             int seatInVehicle = r / totalVehicles;
@@ -1985,14 +1985,14 @@ static void DrawJobLines(void) {
 
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) continue;
+        if (!moverActive[i]) continue;
         if (m->currentJobId < 0) continue;
 
         Job* job = GetJob(m->currentJobId);
         if (!job || !job->active) continue;
 
-        float msx = offset.x + m->x * zoom;
-        float msy = offset.y + m->y * zoom;
+        float msx = offset.x + moverPosX[i] * zoom;
+        float msy = offset.y + moverPosY[i] * zoom;
 
         Color color = YELLOW;
         switch (job->type) {
@@ -2023,16 +2023,15 @@ static void DrawJobLines(void) {
             case JOBTYPE_HAUL_TO_BLUEPRINT: {
                 color = YELLOW;
                 if (job->step == STEP_MOVING_TO_PICKUP || job->step == STEP_CARRYING) {
-                    if (job->targetItem >= 0 && items[job->targetItem].active) {
-                        Item* item = &items[job->targetItem];
-                        int itemX = (int)(item->x / CELL_SIZE);
-                        int itemY = (int)(item->y / CELL_SIZE);
-                        DrawLineToTile(msx, msy, itemX, itemY, (int)item->z, color);
+                    if (job->targetItem >= 0 && itemActive[job->targetItem]) {
+                        int itemX = (int)(itemPosX[job->targetItem] / CELL_SIZE);
+                        int itemY = (int)(itemPosY[job->targetItem] / CELL_SIZE);
+                        DrawLineToTile(msx, msy, itemX, itemY, (int)itemPosZ[job->targetItem], color);
                     }
                 }
                 if (job->step == STEP_CARRYING) {
                     if (job->type == JOBTYPE_HAUL && job->targetStockpile >= 0) {
-                        DrawLineToTile(msx, msy, job->targetSlotX, job->targetSlotY, (int)m->z, color);
+                        DrawLineToTile(msx, msy, job->targetSlotX, job->targetSlotY, (int)moverPosZ[i], color);
                     } else if (job->type == JOBTYPE_HAUL_TO_BLUEPRINT && job->targetBlueprint >= 0) {
                         Blueprint* bp = &blueprints[job->targetBlueprint];
                         if (bp->active) {
@@ -2045,18 +2044,16 @@ static void DrawJobLines(void) {
             case JOBTYPE_CRAFT: {
                 color = ORANGE;
                 if (job->step == CRAFT_STEP_MOVING_TO_INPUT || job->step == CRAFT_STEP_PICKING_UP) {
-                    if (job->targetItem >= 0 && items[job->targetItem].active) {
-                        Item* item = &items[job->targetItem];
-                        int itemX = (int)(item->x / CELL_SIZE);
-                        int itemY = (int)(item->y / CELL_SIZE);
-                        DrawLineToTile(msx, msy, itemX, itemY, (int)item->z, color);
+                    if (job->targetItem >= 0 && itemActive[job->targetItem]) {
+                        int itemX = (int)(itemPosX[job->targetItem] / CELL_SIZE);
+                        int itemY = (int)(itemPosY[job->targetItem] / CELL_SIZE);
+                        DrawLineToTile(msx, msy, itemX, itemY, (int)itemPosZ[job->targetItem], color);
                     }
                 } else if (job->step == CRAFT_STEP_MOVING_TO_FUEL || job->step == CRAFT_STEP_PICKING_UP_FUEL) {
-                    if (job->fuelItem >= 0 && items[job->fuelItem].active) {
-                        Item* fuelItem = &items[job->fuelItem];
-                        int fuelX = (int)(fuelItem->x / CELL_SIZE);
-                        int fuelY = (int)(fuelItem->y / CELL_SIZE);
-                        DrawLineToTile(msx, msy, fuelX, fuelY, (int)fuelItem->z, color);
+                    if (job->fuelItem >= 0 && itemActive[job->fuelItem]) {
+                        int fuelX = (int)(itemPosX[job->fuelItem] / CELL_SIZE);
+                        int fuelY = (int)(itemPosY[job->fuelItem] / CELL_SIZE);
+                        DrawLineToTile(msx, msy, fuelX, fuelY, (int)itemPosZ[job->fuelItem], color);
                     }
                 } else if (job->targetWorkshop >= 0 && job->targetWorkshop < MAX_WORKSHOPS) {
                     Workshop* ws = &workshops[job->targetWorkshop];
@@ -2079,23 +2076,23 @@ static void DrawItems(void) {
 
     for (int i = 0; i < itemHighWaterMark; i++) {
         Item* item = &items[i];
-        if (!item->active) continue;
-        if (item->state == ITEM_CARRIED) continue;
-        if (item->state == ITEM_IN_STOCKPILE) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] == ITEM_CARRIED) continue;
+        if (itemState[i] == ITEM_IN_STOCKPILE) continue;
 
-        int itemZ = (int)item->z;
+        int itemZ = (int)itemPosZ[i];
         if (itemZ > viewZ || itemZ < viewZ - MAX_VISIBLE_DEPTH) continue;
 
-        int cellX = (int)(item->x / CELL_SIZE);
-        int cellY = (int)(item->y / CELL_SIZE);
+        int cellX = (int)(itemPosX[i] / CELL_SIZE);
+        int cellY = (int)(itemPosY[i] / CELL_SIZE);
 
         // Visibility check for items below current view
         if (itemZ < viewZ) {
             if (!IsCellVisibleFromAbove(cellX, cellY, itemZ + 1, viewZ)) continue;
         }
 
-        float sx = offset.x + item->x * zoom;
-        float sy = offset.y + item->y * zoom;
+        float sx = offset.x + itemPosX[i] * zoom;
+        float sy = offset.y + itemPosY[i] * zoom;
 
         int sprite = ItemSpriteForTypeMaterial(item->type, item->material);
         float itemSize = size * ITEM_SIZE_GROUND;
@@ -2105,7 +2102,7 @@ static void DrawItems(void) {
         Color lightTint = GetLightColor(cellX, cellY, itemZ, skyColor);
         Color tint = MultiplyColor(MaterialTint((MaterialType)item->material), lightTint);
         tint = MultiplyColor(tint, ItemTypeTint(item->type));
-        if (item->reservedBy >= 0) {
+        if (itemReservedBy[i] >= 0) {
             tint = MultiplyColor(tint, (Color){200, 200, 200, 255});
         }
         // Apply depth tinting
@@ -2272,7 +2269,7 @@ static void DrawStockpileItems(void) {
                 // Check if slot has a container or bare items
                 int slotItemIdx = sp->slots[slotIdx];
                 bool isContainer = slotItemIdx >= 0 && slotItemIdx < MAX_ITEMS
-                    && items[slotItemIdx].active && ItemIsContainer(items[slotItemIdx].type);
+                    && itemActive[slotItemIdx] && ItemIsContainer(items[slotItemIdx].type);
 
                 if (!isContainer && sp->slotCounts[slotIdx] <= 0) continue;
                 if (isContainer && sp->slots[slotIdx] < 0) continue;
@@ -2492,11 +2489,11 @@ static void DrawWorkshops(void) {
     if (hoveredWorkshop >= 0 && hoveredWorkshop < MAX_WORKSHOPS) {
         Workshop* ws = &workshops[hoveredWorkshop];
         if (ws->active && ws->assignedCrafter >= 0) {
-            Mover* m = &movers[ws->assignedCrafter];
-            if (m->active && m->pathIndex >= 0) {
-                float msx = offset.x + m->x * zoom;
-                float msy = offset.y + m->y * zoom;
-                DrawMoverPath(ws->assignedCrafter, m, msx, msy, viewZ, YELLOW, 2.0f, 2.0f, 0.6f);
+            int moverIdx = ws->assignedCrafter;
+            if (moverActive[moverIdx] && moverPathIndex[moverIdx] >= 0) {
+                float msx = offset.x + moverPosX[moverIdx] * zoom;
+                float msy = offset.y + moverPosY[moverIdx] * zoom;
+                DrawMoverPath(moverIdx, msx, msy, viewZ, YELLOW, 2.0f, 2.0f, 0.6f);
                 DrawCircle((int)msx, (int)msy, 4.0f * zoom, YELLOW);
             }
         }
@@ -2711,6 +2708,10 @@ static void DrawMiningDesignations(void) {
     // Draw designation overlays + progress bars
     for (int y = 0; y < gridHeight; y++) {
         for (int x = 0; x < gridWidth; x++) {
+            if (!PagedLayerHasPage(&designationLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, viewZ)) {
+                x |= PAGE_MASK;
+                continue;
+            }
             Designation* d = GetDesignation(x, y, viewZ);
             if (!d) continue;
             if (d->type <= DESIGNATION_NONE || d->type >= DESIGNATION_TYPE_COUNT) continue;
@@ -2755,11 +2756,11 @@ static void DrawMiningDesignations(void) {
     if (hoveredDesignationX >= 0) {
         Designation* d = GetDesignation(hoveredDesignationX, hoveredDesignationY, hoveredDesignationZ);
         if (d && d->assignedMover >= 0) {
-            Mover* m = &movers[d->assignedMover];
-            if (m->active && m->pathIndex >= 0) {
-                float msx = offset.x + m->x * zoom;
-                float msy = offset.y + m->y * zoom;
-                DrawMoverPath(d->assignedMover, m, msx, msy, viewZ, ORANGE, 2.0f, 2.0f, 0.6f);
+            int moverIdx = d->assignedMover;
+            if (moverActive[moverIdx] && moverPathIndex[moverIdx] >= 0) {
+                float msx = offset.x + moverPosX[moverIdx] * zoom;
+                float msy = offset.y + moverPosY[moverIdx] * zoom;
+                DrawMoverPath(moverIdx, msx, msy, viewZ, ORANGE, 2.0f, 2.0f, 0.6f);
                 DrawCircle((int)msx, (int)msy, 4.0f * zoom, ORANGE);
             }
         }
@@ -3318,7 +3319,7 @@ static void DrawFrontView(void) {
             for (int z = minZ; z < maxZ; z++) {
                 float screenY = offset.y + (gridDepth - 1 - z) * size - layerOffsetY;
                 for (int x = minX; x < maxX; x++) {
-                    FireCell* fc = &fireGrid[z][worldY][x];
+                    const FireCell* fc = FireCellAt(x, worldY, z);
                     int level = fc->level;
 
                     if (level == 0 && HAS_CELL_FLAG(x, worldY, z, CELL_FLAG_BURNED)) {
@@ -3403,7 +3404,7 @@ static void DrawFrontView(void) {
 
                     int slotItemIdx = sp->slots[slotIdx];
                     bool isContainer = slotItemIdx >= 0 && slotItemIdx < MAX_ITEMS
-                        && items[slotItemIdx].active && ItemIsContainer(items[slotItemIdx].type);
+                        && itemActive[slotItemIdx] && ItemIsContainer(items[slotItemIdx].type);
 
                     if (isContainer) {
                         ItemType ctype = items[slotItemIdx].type;
@@ -3449,14 +3450,14 @@ static void DrawFrontView(void) {
         float itemSize = size * 0.6f;
         for (int i = 0; i < itemHighWaterMark; i++) {
             Item* it = &items[i];
-            if (!it->active) continue;
-            if (it->state == ITEM_CARRIED || it->state == ITEM_IN_STOCKPILE) continue;
+            if (!itemActive[i]) continue;
+            if (itemState[i] == ITEM_CARRIED || itemState[i] == ITEM_IN_STOCKPILE) continue;
 
-            int itemCellY = (int)(it->y / CELL_SIZE);
+            int itemCellY = (int)(itemPosY[i] / CELL_SIZE);
             if (itemCellY != worldY) continue;
 
-            float isx = offset.x + (it->x / CELL_SIZE) * size + (size - itemSize) / 2.0f;
-            float isy = offset.y + (gridDepth - 1 - (int)it->z) * size - layerOffsetY + (size - itemSize) / 2.0f;
+            float isx = offset.x + (itemPosX[i] / CELL_SIZE) * size + (size - itemSize) / 2.0f;
+            float isy = offset.y + (gridDepth - 1 - (int)itemPosZ[i]) * size - layerOffsetY + (size - itemSize) / 2.0f;
             Rectangle itemDest = {isx, isy, itemSize, itemSize};
 
             int sprite = ItemSpriteForTypeMaterial(it->type, it->material);
@@ -3469,29 +3470,29 @@ static void DrawFrontView(void) {
         float moverSize = size * MOVER_SIZE;
         for (int i = 0; i < moverCount; i++) {
             Mover* m = &movers[i];
-            if (!m->active) continue;
+            if (!moverActive[i]) continue;
             if (m->transportState == TRANSPORT_RIDING) continue;
 
-            int moverCellY = (int)(m->y / CELL_SIZE);
+            int moverCellY = (int)(moverPosY[i] / CELL_SIZE);
             if (moverCellY != worldY) continue;
 
             // Fractional layer position for smooth interpolation
-            float fracY = m->y / CELL_SIZE;  // e.g. 5.7
+            float fracY = moverPosY[i] / CELL_SIZE;  // e.g. 5.7
             float fracLayer = fracY - startY; // continuous layer index
             float fracBrightness = (depthLayers > 1) ? 0.3f + 0.7f * (fracLayer / (float)(depthLayers - 1)) : 1.0f;
             if (fracBrightness < 0.3f) fracBrightness = 0.3f;
             if (fracBrightness > 1.0f) fracBrightness = 1.0f;
             float fracLayerOffsetY = (depthLayers - 1 - fracLayer) * floorThickness;
 
-            float msx = offset.x + (m->x / CELL_SIZE) * size;
-            float msy = offset.y + (gridDepth - 1 - m->z) * size - fracLayerOffsetY;
+            float msx = offset.x + (moverPosX[i] / CELL_SIZE) * size;
+            float msy = offset.y + (gridDepth - 1 - moverPosZ[i]) * size - fracLayerOffsetY;
 
             float moverOffset = (size - moverSize) / 2.0f;
             Rectangle moverDest = {msx + moverOffset, msy + moverOffset, moverSize, moverSize};
 
             unsigned char mb = (unsigned char)(fracBrightness * 255);
             Color moverColor = {mb, mb, mb, 255};
-            Color lightTint = GetLightColor((int)(m->x / CELL_SIZE), moverCellY, (int)m->z, skyColor);
+            Color lightTint = GetLightColor((int)(moverPosX[i] / CELL_SIZE), moverCellY, (int)moverPosZ[i], skyColor);
             moverColor = MultiplyColor(moverColor, lightTint);
 
             DrawTexturePro(atlas, SpriteGetRect(SPRITE_head), moverDest, (Vector2){0,0}, 0, moverColor);
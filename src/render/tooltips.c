@@ -272,7 +272,7 @@ static void DrawStockpileTooltip(int spIdx, Vector2 mouse, Vector2 mouseGrid) {
 static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
     if (moverIdx < 0 || moverIdx >= moverCount) return;
     Mover* m = &movers[moverIdx];
-    if (!m->active) return;
+    if (!moverActive[moverIdx]) return;
 
     Job* job = (m->currentJobId >= 0) ? GetJob(m->currentJobId) : NULL;
 
@@ -303,9 +303,9 @@ static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
         ? (Color){255, 150, 180, 255} : (Color){130, 180, 255, 255};
 
     // Position
-    int cellX = (int)(m->x / CELL_SIZE);
-    int cellY = (int)(m->y / CELL_SIZE);
-    snprintf(lines[lineCount], sizeof(lines[0]), "Pos: (%.1f, %.1f, z%.0f) cell (%d,%d)", m->x, m->y, m->z, cellX, cellY);
+    int cellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    snprintf(lines[lineCount], sizeof(lines[0]), "Pos: (%.1f, %.1f, z%.0f) cell (%d,%d)", moverPosX[moverIdx], moverPosY[moverIdx], moverPosZ[moverIdx], cellX, cellY);
     lineColors[lineCount++] = WHITE;
 
     // Hunger
@@ -500,7 +500,7 @@ static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
     lineColors[lineCount++] = job ? GREEN : GRAY;
 
     // Carrying item with name
-    if (carryingItem >= 0 && items[carryingItem].active) {
+    if (carryingItem >= 0 && itemActive[carryingItem]) {
         char itemName[64];
         FormatItemName(&items[carryingItem], itemName, sizeof(itemName));
         snprintf(lines[lineCount], sizeof(lines[0]), "Carrying: #%d (%s)", carryingItem, itemName);
@@ -511,7 +511,7 @@ static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
     }
 
     // Equipped tool
-    if (m->equippedTool >= 0 && m->equippedTool < MAX_ITEMS && items[m->equippedTool].active) {
+    if (m->equippedTool >= 0 && m->equippedTool < MAX_ITEMS && itemActive[m->equippedTool]) {
         char toolName[64];
         FormatItemName(&items[m->equippedTool], toolName, sizeof(toolName));
         snprintf(lines[lineCount], sizeof(lines[0]), "Equipped: %s", toolName);
@@ -522,7 +522,7 @@ static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
     }
 
     // Equipped clothing
-    if (m->equippedClothing >= 0 && m->equippedClothing < MAX_ITEMS && items[m->equippedClothing].active) {
+    if (m->equippedClothing >= 0 && m->equippedClothing < MAX_ITEMS && itemActive[m->equippedClothing]) {
         char clothName[64];
         FormatItemName(&items[m->equippedClothing], clothName, sizeof(clothName));
         float reduction = GetClothingCoolingReduction(items[m->equippedClothing].type);
@@ -535,11 +535,11 @@ static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
 
     // Path info
     snprintf(lines[lineCount], sizeof(lines[0]), "Path: %d/%d, Goal: (%d,%d,z%d)",
-        m->pathIndex >= 0 ? m->pathIndex + 1 : 0, m->pathLength, m->goal.x, m->goal.y, m->goal.z);
-    lineColors[lineCount++] = m->pathLength > 0 ? WHITE : RED;
+        moverPathIndex[moverIdx] >= 0 ? moverPathIndex[moverIdx] + 1 : 0, moverPathLength[moverIdx], m->goal.x, m->goal.y, m->goal.z);
+    lineColors[lineCount++] = moverPathLength[moverIdx] > 0 ? WHITE : RED;
 
     // Repath status
-    if (m->needsRepath) {
+    if (moverNeedsRepath[moverIdx]) {
         snprintf(lines[lineCount], sizeof(lines[0]), "NEEDS REPATH (cooldown: %d)", m->repathCooldown);
         lineColors[lineCount++] = RED;
     } else if (m->repathCooldown > 0) {
@@ -563,15 +563,15 @@ static void DrawMoverTooltip(int moverIdx, Vector2 mouse) {
 
     // Target item pickup info
     float pickupRadius = CELL_SIZE * 0.75f;
-    if (job && targetItem >= 0 && items[targetItem].active) {
+    if (job && targetItem >= 0 && itemActive[targetItem]) {
         Item* item = &items[targetItem];
         char itemName[64];
         FormatItemName(item, itemName, sizeof(itemName));
-        float dx = m->x - item->x;
-        float dy = m->y - item->y;
+        float dx = moverPosX[moverIdx] - itemPosX[targetItem];
+        float dy = moverPosY[moverIdx] - itemPosY[targetItem];
         float dist = sqrtf(dx*dx + dy*dy);
         snprintf(lines[lineCount], sizeof(lines[0]), "Target: #%d %s at (%.0f,%.0f)", 
-            targetItem, itemName, item->x, item->y);
+            targetItem, itemName, itemPosX[targetItem], itemPosY[targetItem]);
         lineColors[lineCount++] = SKYBLUE;
         
         snprintf(lines[lineCount], sizeof(lines[0]), "  dist=%.1f %s", 
@@ -726,7 +726,7 @@ static void DrawItemTooltip(int* itemIndices, int itemCount, Vector2 mouse, int
         Item* item = &items[idx];
         char typeName[64];
         FormatItemName(item, typeName, sizeof(typeName));
-        const char* stateName = (item->state >= 0 && item->state < 3) ? stateNames[item->state] : "?";
+        const char* stateName = (itemState[idx] < 3) ? stateNames[itemState[idx]] : "?";
         // Freshness label for spoilable items
         const char* freshness = "";
         if (ItemSpoils(item->type)) {
@@ -983,7 +983,7 @@ static void DrawCellTooltip(int cellX, int cellY, int cellZ, Vector2 mouse) {
     }
 
     // Fire info
-    FireCell* fire = &fireGrid[cellZ][cellY][cellX];
+    const FireCell* fire = FireCellAt(cellX, cellY, cellZ);
     if (fire->level > 0 || fire->isSource) {
         snprintf(lines[lineCount++], sizeof(lines[0]), "Fire: %d/7", fire->level);
         if (fire->isSource) {
@@ -995,13 +995,13 @@ static void DrawCellTooltip(int cellX, int cellY, int cellZ, Vector2 mouse) {
     }
 
     // Steam info
-    SteamCell* steam = &steamGrid[cellZ][cellY][cellX];
+    const SteamCell* steam = SteamCellAt(cellX, cellY, cellZ);
     if (steam->level > 0) {
         snprintf(lines[lineCount++], sizeof(lines[0]), "Steam: %d/7", steam->level);
     }
 
     // Smoke info
-    SmokeCell* smoke = &smokeGrid[cellZ][cellY][cellX];
+    const SmokeCell* smoke = SmokeCellAt(cellX, cellY, cellZ);
     if (smoke->level > 0) {
         snprintf(lines[lineCount++], sizeof(lines[0]), "Smoke: %d/7", smoke->level);
     }
@@ -1229,8 +1229,8 @@ static void DrawWorkshopTooltip(int wsIdx, Vector2 mouse) {
                     
                     for (int i = 0; i < itemHighWaterMark; i++) {
                         Item* item = &items[i];
-                        if (!item->active || item->reservedBy != -1) continue;
-                        if ((int)item->z != ws->z) continue;
+                        if (!itemActive[i] || itemReservedBy[i] != -1) continue;
+                        if ((int)itemPosZ[i] != ws->z) continue;
                         if (RecipeInputMatches(recipe, item)) {
                             hasInput1 = true;
                             break;
@@ -1249,8 +1249,8 @@ static void DrawWorkshopTooltip(int wsIdx, Vector2 mouse) {
                         bool hasInput2 = false;
                         for (int i = 0; i < itemHighWaterMark; i++) {
                             Item* item = &items[i];
-                            if (!item->active || item->reservedBy != -1) continue;
-                            if ((int)item->z != ws->z) continue;
+                            if (!itemActive[i] || itemReservedBy[i] != -1) continue;
+                            if ((int)itemPosZ[i] != ws->z) continue;
                             if (item->type == recipe->inputType2) {
                                 hasInput2 = true;
                                 break;
@@ -1271,8 +1271,8 @@ static void DrawWorkshopTooltip(int wsIdx, Vector2 mouse) {
                         bool hasInput3 = false;
                         for (int i = 0; i < itemHighWaterMark; i++) {
                             Item* item = &items[i];
-                            if (!item->active || item->reservedBy != -1) continue;
-                            if ((int)item->z != ws->z) continue;
+                            if (!itemActive[i] || itemReservedBy[i] != -1) continue;
+                            if ((int)itemPosZ[i] != ws->z) continue;
                             if (item->type == recipe->inputType3) {
                                 hasInput3 = true;
                                 break;
@@ -1364,16 +1364,16 @@ static void DrawWorkshopTooltip(int wsIdx, Vector2 mouse) {
                 bool hasInput = false;
                 for (int i = 0; i < itemHighWaterMark; i++) {
                     Item* item = &items[i];
-                    if (!item->active) continue;
-                    if ((int)item->z != ws->z) continue;
+                    if (!itemActive[i]) continue;
+                    if ((int)itemPosZ[i] != ws->z) continue;
                     if (RecipeInputMatches(recipe, item)) { hasInput = true; break; }
                 }
                 bool hasInput2 = (recipe->inputType2 == ITEM_NONE);  // true if not needed
                 if (!hasInput2) {
                     for (int i = 0; i < itemHighWaterMark; i++) {
                         Item* item = &items[i];
-                        if (!item->active) continue;
-                        if ((int)item->z != ws->z) continue;
+                        if (!itemActive[i]) continue;
+                        if ((int)itemPosZ[i] != ws->z) continue;
                         if (item->type == recipe->inputType2) { hasInput2 = true; break; }
                     }
                 }
@@ -1381,8 +1381,8 @@ static void DrawWorkshopTooltip(int wsIdx, Vector2 mouse) {
                 if (!hasInput3) {
                     for (int i = 0; i < itemHighWaterMark; i++) {
                         Item* item = &items[i];
-                        if (!item->active) continue;
-                        if ((int)item->z != ws->z) continue;
+                        if (!itemActive[i]) continue;
+                        if ((int)itemPosZ[i] != ws->z) continue;
                         if (item->type == recipe->inputType3) { hasInput3 = true; break; }
                     }
                 }
@@ -216,19 +216,17 @@ static void StartNewGame(void) {
     SpawnMoversDemo(1);
 
     // Fog of war: start with everything unexplored, then reveal around spawn
-    memset(exploredGrid, 0, sizeof(exploredGrid));
+    CLEAR_WORLD_LAYER(exploredGrid);
     if (moverCount > 0) {
-        Mover* m = &movers[0];
-        int spawnX = (int)(m->x / CELL_SIZE);
-        int spawnY = (int)(m->y / CELL_SIZE);
-        int spawnZ = (int)m->z;
+        int spawnX = (int)(moverPosX[0] / CELL_SIZE);
+        int spawnY = (int)(moverPosY[0] / CELL_SIZE);
+        int spawnZ = (int)moverPosZ[0];
         RevealAroundPoint(spawnX, spawnY, spawnZ, balance.spawnVisionRadius);
     }
 
     // Spawn starting supplies near the mover
     if (moverCount > 0) {
-        Mover* m = &movers[0];
-        float sx = m->x, sy = m->y, sz = m->z;
+        float sx = moverPosX[0], sy = moverPosY[0], sz = moverPosZ[0];
 
         // 5 berries (immediate food)
         for (int i = 0; i < 5; i++) {
@@ -255,11 +253,10 @@ static void StartNewGame(void) {
 
     // Center camera on the mover and follow it
     if (moverCount > 0) {
-        Mover* m = &movers[0];
-        currentViewZ = (int)m->z;
-        offset.x = GetScreenWidth() / 2.0f - m->x * zoom;
-        offset.y = GetScreenHeight() / 2.0f - m->y * zoom;
-        followMoverIdx = 0;
+        currentViewZ = (int)moverPosZ[0];
+        offset.x = GetScreenWidth() / 2.0f - moverPosX[0] * zoom;
+        offset.y = GetScreenHeight() / 2.0f - moverPosY[0] * zoom;
+        followMoverHandle = MoverHandleFromIndex(0);
     }
 
     ResetTime();
@@ -267,7 +264,7 @@ static void StartNewGame(void) {
     balance.baseMoverSpeed = 400.0f;  // Faster movement for survival
     // Update already-spawned movers to new speed
     for (int i = 0; i < moverCount; i++) {
-        if (movers[i].active) {
+        if (moverActive[i]) {
             movers[i].speed = balance.baseMoverSpeed * (1.0f + balance.moverSpeedVariance * (GetRandomValue(-100, 100) / 100.0f));
         }
     }
@@ -407,11 +404,11 @@ static void StartDollhouseMode(void) {
     float sy = (oy + 5) * CELL_SIZE + CELL_SIZE * 0.5f;
     {
         int idx = SpawnItem(sx, sy, (float)z, ITEM_COOKED_MEAT);
-        if (idx >= 0) items[idx].stackCount = 5;
+        if (idx >= 0) SetItemStackCount(idx, 5);
     }
     {
         int idx = SpawnItem(sx + CELL_SIZE, sy, (float)z, ITEM_BREAD);
-        if (idx >= 0) items[idx].stackCount = 5;
+        if (idx >= 0) SetItemStackCount(idx, 5);
     }
     // Water pots (two so both movers can drink)
     for (int p = 0; p < 2; p++) {
@@ -426,11 +423,10 @@ static void StartDollhouseMode(void) {
 
     // Camera: center on apartment, follow first mover
     if (moverCount > 0) {
-        Mover* m = &movers[0];
         currentViewZ = z;
-        offset.x = GetScreenWidth() / 2.0f - m->x * zoom;
-        offset.y = GetScreenHeight() / 2.0f - m->y * zoom;
-        followMoverIdx = 0;
+        offset.x = GetScreenWidth() / 2.0f - moverPosX[0] * zoom;
+        offset.y = GetScreenHeight() / 2.0f - moverPosY[0] * zoom;
+        followMoverHandle = MoverHandleFromIndex(0);
     }
 
     // Settings
@@ -438,7 +434,7 @@ static void StartDollhouseMode(void) {
     dayLength = 120.0f;
     balance.baseMoverSpeed = 300.0f;
     for (int i = 0; i < moverCount; i++) {
-        if (movers[i].active) {
+        if (moverActive[i]) {
             movers[i].speed = balance.baseMoverSpeed * (1.0f + balance.moverSpeedVariance * (GetRandomValue(-100, 100) / 100.0f));
         }
     }
@@ -484,11 +480,11 @@ static void DrawPlayerHUD(void) {
         if (clicked && moverCount > 0) {
             // Find first active mover and center camera on them
             for (int i = 0; i < moverCount; i++) {
-                if (movers[i].active) {
-                    followMoverIdx = i;
-                    currentViewZ = (int)movers[i].z;
-                    offset.x = GetScreenWidth() / 2.0f - movers[i].x * zoom;
-                    offset.y = GetScreenHeight() / 2.0f - movers[i].y * zoom;
+                if (moverActive[i]) {
+                    followMoverHandle = MoverHandleFromIndex(i);
+                    currentViewZ = (int)moverPosZ[i];
+                    offset.x = GetScreenWidth() / 2.0f - moverPosX[i] * zoom;
+                    offset.y = GetScreenHeight() / 2.0f - moverPosY[i] * zoom;
                     break;
                 }
             }
@@ -497,17 +493,17 @@ static void DrawPlayerHUD(void) {
 
         // Mover name buttons (click to follow)
         for (int i = 0; i < moverCount && i < 20; i++) {
-            if (!movers[i].active) continue;
+            if (!moverActive[i]) continue;
             const char* mname = MoverDisplayName(i);
             const char* label = movers[i].isDrafted
                 ? TextFormat("[D] %s", mname) : mname;
             clicked = false;
             PushButtonInline(10, y, label, &clicked);
             if (clicked) {
-                followMoverIdx = i;
-                currentViewZ = (int)movers[i].z;
-                offset.x = GetScreenWidth() / 2.0f - movers[i].x * zoom;
-                offset.y = GetScreenHeight() / 2.0f - movers[i].y * zoom;
+                followMoverHandle = MoverHandleFromIndex(i);
+                currentViewZ = (int)moverPosZ[i];
+                offset.x = GetScreenWidth() / 2.0f - moverPosX[i] * zoom;
+                offset.y = GetScreenHeight() / 2.0f - moverPosY[i] * zoom;
             }
             y += 16;
         }
@@ -518,7 +514,7 @@ static void DrawPlayerHUD(void) {
     bool hasAnyItems = (itemCount > 0);
     bool hasGrass = false, hasLeaves = false, hasRocks = false;
     for (int i = 0; i < itemHighWaterMark && (!hasGrass || !hasLeaves || !hasRocks); i++) {
-        if (!items[i].active) continue;
+        if (!itemActive[i]) continue;
         if (items[i].type == ITEM_GRASS) hasGrass = true;
         if (items[i].type == ITEM_LEAVES) hasLeaves = true;
         if (items[i].type == ITEM_ROCK) hasRocks = true;
@@ -1784,7 +1780,7 @@ void DrawUI(void) {
             if (balance.baseMoverSpeed != oldBaseSpeed && oldBaseSpeed > 0) {
                 float scale = balance.baseMoverSpeed / oldBaseSpeed;
                 for (int i = 0; i < moverCount; i++) {
-                    if (movers[i].active) movers[i].speed *= scale;
+                    if (moverActive[i]) movers[i].speed *= scale;
                 }
             }
             DraggableFloatT(ix, y, "Speed Variance", &balance.moverSpeedVariance, 0.05f, 0.0f, 0.5f,
@@ -2205,24 +2201,24 @@ void DrawProfilerPanel(float rightEdge, float y) {
             size_t groundWearSize = sizeof(int) * MAX_GRID_DEPTH * MAX_GRID_HEIGHT * MAX_GRID_WIDTH;
 
             // Pathfinding
-            size_t entrancesSize = sizeof(Entrance) * MAX_ENTRANCES;
+            size_t entrancesSize = sizeof(Entrance) * entranceCapacity;
             size_t pathSize = sizeof(Point) * MAX_PATH;  // Global path scratch buffer
-            size_t edgesSize = sizeof(GraphEdge) * MAX_EDGES;
+            size_t edgesSize = sizeof(GraphEdge) * graphEdgeCapacity;
             size_t nodeDataSize = sizeof(AStarNode) * MAX_GRID_DEPTH * MAX_GRID_HEIGHT * MAX_GRID_WIDTH;
             size_t chunkDirtySize = sizeof(bool) * MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X;
             size_t ladderLinksSize = sizeof(LadderLink) * MAX_LADDERS;
             size_t rampLinksSize = sizeof(RampLink) * MAX_RAMP_LINKS;
-            size_t abstractNodesSize = sizeof(AbstractNode) * MAX_ABSTRACT_NODES;
-            size_t abstractPathSize = sizeof(int) * (MAX_ENTRANCES + 2);
-            size_t adjListSize = sizeof(int) * MAX_ENTRANCES * MAX_EDGES_PER_NODE;  // adjList[MAX_ENTRANCES][MAX_EDGES_PER_NODE]
-            size_t adjListCountSize = sizeof(int) * MAX_ENTRANCES;
-            size_t entranceHashSize = 16 * 32768;  // EntranceHashEntry (16 bytes) * ENTRANCE_HASH_SIZE
+            size_t abstractNodesSize = sizeof(AbstractNode) * (entranceCapacity + 2);
+            size_t abstractPathSize = sizeof(int) * (entranceCapacity + 2);
+            size_t adjListSize = sizeof(int) * entranceCapacity * MAX_EDGES_PER_NODE;  // adjList[entranceCapacity][MAX_EDGES_PER_NODE]
+            size_t adjListCountSize = sizeof(int) * entranceCapacity;
+            size_t entranceHashSize = 20 * 2 * (size_t)entranceCapacity;  // EntranceHashEntry (20 bytes), >= 2x capacity
 
             // Entities
-            size_t moversSize = sizeof(Mover) * MAX_MOVERS;
+            size_t moversSize = (sizeof(Mover) + sizeof(float) * 5 + sizeof(int) * 2 + sizeof(bool) * 2) * MAX_MOVERS;  // cold structs + hot arrays
             size_t moverPathsSize = sizeof(Point) * MAX_MOVER_PATH * MAX_MOVERS;
             size_t moverRenderSize = sizeof(MoverRenderData) * MAX_MOVERS;
-            size_t itemsSize = sizeof(Item) * MAX_ITEMS;
+            size_t itemsSize = (sizeof(Item) + sizeof(float) * 4 + sizeof(uint8_t) + sizeof(bool) + sizeof(int) * 2) * MAX_ITEMS;  // cold structs + hot arrays
             size_t jobsSize = sizeof(Job) * MAX_JOBS;
             size_t stockpilesSize = sizeof(Stockpile) * MAX_STOCKPILES;
             size_t blueprintsSize = sizeof(Blueprint) * MAX_BLUEPRINTS;
@@ -2230,7 +2226,8 @@ void DrawProfilerPanel(float rightEdge, float y) {
             size_t workshopsSize = sizeof(Workshop) * MAX_WORKSHOPS;
 
             // Spatial grids (heap allocated)
-            size_t moverSpatialGrid = (moverGrid.cellCount + 1) * sizeof(int) * 2 + MAX_MOVERS * sizeof(int);
+            size_t moverSpatialGrid = (moverGrid.cellCount + 1) * sizeof(int) * 2 +
+                moverGrid.entryCapacity * (sizeof(int) + sizeof(float) * 2 + sizeof(uint8_t) * 2);
             size_t itemSpatialGrid = (itemGrid.cellCount + 1) * sizeof(int) * 2 + MAX_ITEMS * sizeof(int);
 
             size_t totalGrid = gridSize + designationsSize + waterSize + fireSize + smokeSize + steamSize + temperatureSize + cellFlagsSize + groundWearSize;
@@ -0,0 +1,164 @@
+// area_sums.c - Per-z-level summed-area tables for neighborhood queries
+//
+// areaSum[l][z][y][x] holds the sum of areaValue over [0..x-1] x [0..y-1], so
+// row 0 and column 0 stay zero and any rectangle is S(D) - S(B) - S(C) + S(A).
+// Refresh is lazy: dirty chunks only cost something on the next query.
+
+#include "area_sums.h"
+#include "../world/grid.h"
+#include "water.h"
+#include "plants.h"
+#include "lighting.h"
+#include <limits.h>
+#include <string.h>
+
+static WORLD_LAYER(uint16_t, areaValue[AREA_LAYER_COUNT]);
+static int32_t (*areaSum[AREA_LAYER_COUNT])[MAX_GRID_HEIGHT + 1][MAX_GRID_WIDTH + 1];
+static bool areaChunkDirty[AREA_LAYER_COUNT][MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
+static int areaDirtyMinY[AREA_LAYER_COUNT][MAX_GRID_DEPTH];  // INT_MAX = level is clean
+
+__attribute__((constructor)) static void AllocAreaLayers(void) {
+    for (int l = 0; l < AREA_LAYER_COUNT; l++) {
+        areaValue[l] = AllocWorldLayer(sizeof(uint16_t), "areaValue");
+        areaSum[l] = AllocWorldBuffer((size_t)MAX_GRID_DEPTH * (MAX_GRID_HEIGHT + 1) * (MAX_GRID_WIDTH + 1) * sizeof(int32_t), "areaSum");
+    }
+}
+
+// Start fully dirty so the first query builds everything
+static bool areaSumsInitialized = false;
+
+// --- Per-cell values ---
+
+static inline bool IsBeautyCell(CellType cell) {
+    return cell == CELL_TREE_TRUNK || cell == CELL_TREE_BRANCH ||
+           cell == CELL_TREE_LEAVES || cell == CELL_SAPLING;
+}
+
+static uint16_t ComputeBeautyValue(int x, int y, int z) {
+    for (int dz = -1; dz <= 1; dz++) {
+        int nz = z + dz;
+        if (nz < 0 || nz >= gridDepth) continue;
+        if (IsBeautyCell(grid[nz][y][x])) return 1;
+        if (waterGrid[nz][y][x].level > 0) return 1;
+    }
+    return 0;
+}
+
+int AreaLightValue(int x, int y, int z) {
+    // Same combination as rooms: max(sky 0-15, brightest block channel mapped to 0-15)
+    const LightCell* lc = &lightGrid[z][y][x];
+    int sky = (int)lc->skyLevel * AREA_LIGHT_SCALE;
+    int blockMax = lc->blockR;
+    if (lc->blockG > blockMax) blockMax = lc->blockG;
+    if (lc->blockB > blockMax) blockMax = lc->blockB;
+    int block = blockMax * 15;
+    return sky > block ? sky : block;
+}
+
+// --- Dirty tracking ---
+
+static void MarkLevelAllDirty(AreaLayer layer, int z) {
+    memset(areaChunkDirty[layer][z], 1, sizeof(areaChunkDirty[layer][z]));
+    areaDirtyMinY[layer][z] = 0;
+}
+
+void InvalidateAreaSums(void) {
+    for (int l = 0; l < AREA_LAYER_COUNT; l++) {
+        for (int z = 0; z < MAX_GRID_DEPTH; z++) {
+            MarkLevelAllDirty((AreaLayer)l, z);
+        }
+    }
+    areaSumsInitialized = true;
+}
+
+void InvalidateAreaLayer(AreaLayer layer) {
+    for (int z = 0; z < MAX_GRID_DEPTH; z++) {
+        MarkLevelAllDirty(layer, z);
+    }
+}
+
+void MarkAreaSumsDirty(int x, int y, int z) {
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight) return;
+    int cx = x / chunkWidth;
+    int cy = y / chunkHeight;
+    int rowStart = cy * chunkHeight;
+    for (int dz = -1; dz <= 1; dz++) {
+        int nz = z + dz;
+        if (nz < 0 || nz >= gridDepth) continue;
+        areaChunkDirty[AREA_LAYER_BEAUTY][nz][cy][cx] = true;
+        if (rowStart < areaDirtyMinY[AREA_LAYER_BEAUTY][nz]) {
+            areaDirtyMinY[AREA_LAYER_BEAUTY][nz] = rowStart;
+        }
+    }
+}
+
+// --- Refresh ---
+
+static void RecomputeChunkValues(AreaLayer layer, int z, int cx, int cy) {
+    int x0 = cx * chunkWidth, x1 = x0 + chunkWidth;
+    int y0 = cy * chunkHeight, y1 = y0 + chunkHeight;
+    if (x1 > gridWidth) x1 = gridWidth;
+    if (y1 > gridHeight) y1 = gridHeight;
+
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            areaValue[layer][z][y][x] = (layer == AREA_LAYER_BEAUTY)
+                ? ComputeBeautyValue(x, y, z)
+                : (uint16_t)AreaLightValue(x, y, z);
+        }
+    }
+}
+
+static void RefreshAreaLevel(AreaLayer layer, int z) {
+    int minY = areaDirtyMinY[layer][z];
+    if (minY >= gridHeight) return;
+
+    bool (*dirty)[MAX_CHUNKS_X] = areaChunkDirty[layer][z];
+    for (int cy = minY / chunkHeight; cy < chunksY; cy++) {
+        for (int cx = 0; cx < chunksX; cx++) {
+            if (dirty[cy][cx]) RecomputeChunkValues(layer, z, cx, cy);
+        }
+    }
+
+    // Plants are sparse entities, not cells: stamp them into the dirty chunks
+    if (layer == AREA_LAYER_BEAUTY) {
+        for (int i = 0; i < plantCount; i++) {
+            const Plant* p = &plants[i];
+            if (!p->active || p->z < z - 1 || p->z > z + 1) continue;
+            if (p->x < 0 || p->x >= gridWidth || p->y < 0 || p->y >= gridHeight) continue;
+            if (!dirty[p->y / chunkHeight][p->x / chunkWidth]) continue;
+            areaValue[layer][z][p->y][p->x] = 1;
+        }
+    }
+
+    for (int cy = minY / chunkHeight; cy < chunksY; cy++) {
+        for (int cx = 0; cx < chunksX; cx++) dirty[cy][cx] = false;
+    }
+
+    // Re-integrate every row at or below the first dirty one
+    int32_t (*sum)[MAX_GRID_WIDTH + 1] = areaSum[layer][z];
+    uint16_t (*val)[MAX_GRID_WIDTH] = areaValue[layer][z];
+    for (int y = minY; y < gridHeight; y++) {
+        int32_t rowSum = 0;
+        for (int x = 0; x < gridWidth; x++) {
+            rowSum += val[y][x];
+            sum[y + 1][x + 1] = sum[y][x + 1] + rowSum;
+        }
+    }
+    areaDirtyMinY[layer][z] = INT_MAX;
+}
+
+int AreaSumRect(AreaLayer layer, int x0, int y0, int x1, int y1, int z) {
+    if (z < 0 || z >= gridDepth) return 0;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= gridWidth) x1 = gridWidth - 1;
+    if (y1 >= gridHeight) y1 = gridHeight - 1;
+    if (x0 > x1 || y0 > y1) return 0;
+
+    if (!areaSumsInitialized) InvalidateAreaSums();
+    RefreshAreaLevel(layer, z);
+
+    int32_t (*sum)[MAX_GRID_WIDTH + 1] = areaSum[layer][z];
+    return sum[y1 + 1][x1 + 1] - sum[y0][x1 + 1] - sum[y1 + 1][x0] + sum[y0][x0];
+}
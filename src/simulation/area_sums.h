@@ -0,0 +1,42 @@
+// area_sums.h - Per-z-level summed-area tables for neighborhood queries
+//
+// Each layer stores one small integer per cell plus a summed-area (integral)
+// table over it, so the sum over any axis-aligned rectangle is 4 lookups.
+// Changes are tracked per chunk; the next query on a z-level recomputes only
+// the dirty chunks and re-integrates from the first dirty row down.
+//
+// Usage:
+//   MarkAreaSumsDirty(x, y, z);                     // cell changed (trees, water, plants)
+//   int n = AreaSumRect(AREA_LAYER_BEAUTY, x0, y0, x1, y1, z);  // inclusive bounds
+
+#ifndef AREA_SUMS_H
+#define AREA_SUMS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    AREA_LAYER_BEAUTY,   // 1 if a tree, water or plant is within z-1..z+1 of (x,y), else 0
+    AREA_LAYER_LIGHT,    // light level (0-15) scaled by AREA_LIGHT_SCALE, exact for sky and block light
+    AREA_LAYER_COUNT
+} AreaLayer;
+
+// Light values are stored as level * 255 so block light (0-255 -> 0-15) stays integral
+#define AREA_LIGHT_SCALE 255
+
+// Mark every layer on every z-level for recompute (grid re-init, load)
+void InvalidateAreaSums(void);
+
+// Mark a whole layer for recompute (e.g. light after RecomputeLighting)
+void InvalidateAreaLayer(AreaLayer layer);
+
+// Mark the beauty layer dirty around a changed cell (affects z-1..z+1)
+void MarkAreaSumsDirty(int x, int y, int z);
+
+// Sum of a layer over [x0..x1] x [y0..y1] at z (inclusive, clamped to grid)
+int AreaSumRect(AreaLayer layer, int x0, int y0, int x1, int y1, int z);
+
+// Light level of a single cell in AREA_LIGHT_SCALE units (reads lightGrid directly)
+int AreaLightValue(int x, int y, int z);
+
+#endif // AREA_SUMS_H
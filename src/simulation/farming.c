@@ -10,7 +10,7 @@
 #include <string.h>
 
 // Grid storage
-FarmCell farmGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(FarmCell, farmGrid);
 int farmActiveCells = 0;
 
 // Tick accumulator
@@ -21,7 +21,7 @@ void InitFarming(void) {
 }
 
 void ClearFarming(void) {
-    memset(farmGrid, 0, sizeof(farmGrid));
+    CLEAR_WORLD_LAYER(farmGrid);
     farmActiveCells = 0;
     farmTickAccumulator = 0;
 }
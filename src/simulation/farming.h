@@ -37,7 +37,7 @@ typedef struct {
 } FarmCell;
 
 // Farm grid (parallel to main grid, zero-initialized = no farm data)
-extern FarmCell farmGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(FarmCell, farmGrid);
 extern int farmActiveCells;  // count of tilled cells (for sim tick skipping)
 
 // Fertility constants
@@ -11,11 +11,17 @@
 #include "../world/cell_defs.h"
 #include "../world/material.h"
 #include "../core/time.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <stdlib.h>
 
 // Fire grid storage
-FireCell fireGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+static const FireCell emptyFire = {0};
+static bool FireCellIsEmpty(const void* cell) {
+    const FireCell* fc = (const FireCell*)cell;
+    return fc->level == 0 && !fc->isSource && fc->fuel == 0;
+}
+DEFINE_PAGED_LAYER(FireCell, fireLayer, &emptyFire, FireCellIsEmpty);
 
 // Global state
 bool fireEnabled = true;
@@ -41,13 +47,13 @@ void InitFire(void) {
 
 // Helper to check if a fire cell is "active" (needs processing)
 static inline bool FireCellIsActive(int x, int y, int z) {
-    FireCell *fc = &fireGrid[z][y][x];
+    const FireCell *fc = FireCellAt(x, y, z);
     return fc->level > 0 || fc->isSource;
 }
 
 // Clear all fire
 void ClearFire(void) {
-    memset(fireGrid, 0, sizeof(fireGrid));
+    ClearPagedLayer(&fireLayer);
     fireUpdateCount = 0;
     fireSpreadAccum = 0.0f;
     fireFuelAccum = 0.0f;
@@ -136,19 +142,24 @@ static inline bool CanBurn(int x, int y, int z) {
 }
 
 // Mark cell and neighbors as unstable
+// Cells of unallocated pages are empty and never scanned: leave them
+static inline void UnsettleFireCell(int x, int y, int z) {
+    if (!FireInBounds(x, y, z)) return;
+    if (!PagedLayerHasPage(&fireLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) return;
+    FireCellForWrite(x, y, z)->stable = false;
+}
+
 void DestabilizeFire(int x, int y, int z) {
-    if (FireInBounds(x, y, z)) {
-        fireGrid[z][y][x].stable = false;
-    }
+    UnsettleFireCell(x, y, z);
     
     // 4 horizontal neighbors (orthogonal only)
-    if (FireInBounds(x-1, y, z)) fireGrid[z][y][x-1].stable = false;
-    if (FireInBounds(x+1, y, z)) fireGrid[z][y][x+1].stable = false;
-    if (FireInBounds(x, y-1, z)) fireGrid[z][y-1][x].stable = false;
-    if (FireInBounds(x, y+1, z)) fireGrid[z][y+1][x].stable = false;
+    UnsettleFireCell(x-1, y, z);
+    UnsettleFireCell(x+1, y, z);
+    UnsettleFireCell(x, y-1, z);
+    UnsettleFireCell(x, y+1, z);
     
     // Above (for smoke generation later)
-    if (FireInBounds(x, y, z+1)) fireGrid[z+1][y][x].stable = false;
+    UnsettleFireCell(x, y, z+1);
 }
 
 // Set fire level at a cell
@@ -156,8 +167,9 @@ void SetFireLevel(int x, int y, int z, int level) {
     if (!FireInBounds(x, y, z)) return;
     if (level < 0) level = 0;
     if (level > FIRE_MAX_LEVEL) level = FIRE_MAX_LEVEL;
+    if (FireCellAt(x, y, z)->level == level) return;  // Nothing changes
     
-    FireCell* cell = &fireGrid[z][y][x];
+    FireCell* cell = FireCellForWrite(x, y, z);
     int oldLevel = cell->level;
     cell->level = (uint16_t)level;
     
@@ -197,7 +209,7 @@ void IgniteCell(int x, int y, int z) {
     if (!FireInBounds(x, y, z)) return;
     if (!CanBurn(x, y, z)) return;
     
-    FireCell* cell = &fireGrid[z][y][x];
+    FireCell* cell = FireCellForWrite(x, y, z);
     
     // Initialize fuel from cell type (including grass surface)
     cell->fuel = GetFuelAt(x, y, z);
@@ -208,8 +220,7 @@ void IgniteCell(int x, int y, int z) {
 void ExtinguishCell(int x, int y, int z) {
     if (!FireInBounds(x, y, z)) return;
     
-    FireCell* cell = &fireGrid[z][y][x];
-    if (cell->level > 0) {
+    if (FireCellAt(x, y, z)->level > 0) {
         SetFireLevel(x, y, z, 0);
     }
 }
@@ -219,11 +230,14 @@ void SetFireSource(int x, int y, int z, bool isSource) {
     if (!FireInBounds(x, y, z)) return;
     
     bool wasActive = FireCellIsActive(x, y, z);
-    fireGrid[z][y][x].isSource = isSource;
+    if (isSource || FireCellAt(x, y, z)->isSource) {
+        FireCellForWrite(x, y, z)->isSource = isSource;
+    }
     
     if (isSource) {
-        fireGrid[z][y][x].level = FIRE_MAX_LEVEL;
-        fireGrid[z][y][x].fuel = 15;  // Max fuel for sources
+        FireCell* cell = FireCellForWrite(x, y, z);
+        cell->level = FIRE_MAX_LEVEL;
+        cell->fuel = 15;  // Max fuel for sources
         DestabilizeFire(x, y, z);
         // Fire sources also act as heat sources
         SetHeatSource(x, y, z, true);
@@ -232,7 +246,7 @@ void SetFireSource(int x, int y, int z, bool isSource) {
     } else {
         // Removing fire source also removes heat source
         SetHeatSource(x, y, z, false);
-        if (fireGrid[z][y][x].level == 0) {
+        if (FireCellAt(x, y, z)->level == 0) {
             RemoveLightSource(x, y, z);
         }
     }
@@ -248,7 +262,7 @@ void SetFireSource(int x, int y, int z, bool isSource) {
 // Query functions
 int GetFireLevel(int x, int y, int z) {
     if (!FireInBounds(x, y, z)) return 0;
-    return fireGrid[z][y][x].level;
+    return FireCellAt(x, y, z)->level;
 }
 
 bool HasFire(int x, int y, int z) {
@@ -257,12 +271,12 @@ bool HasFire(int x, int y, int z) {
 
 int GetCellFuel(int x, int y, int z) {
     if (!FireInBounds(x, y, z)) return 0;
-    return fireGrid[z][y][x].fuel;
+    return FireCellAt(x, y, z)->fuel;
 }
 
 bool IsFireSourceAt(int x, int y, int z) {
     if (!FireInBounds(x, y, z)) return false;
-    return fireGrid[z][y][x].isSource;
+    return FireCellAt(x, y, z)->isSource;
 }
 
 // Check if any adjacent cell has water
@@ -277,7 +291,7 @@ static bool HasAdjacentWater(int x, int y, int z) {
 // Try to spread fire to neighbors
 // Called when spread interval is reached - fire level and water affect probability
 static bool FireTrySpread(int x, int y, int z) {
-    FireCell* cell = &fireGrid[z][y][x];
+    const FireCell* cell = FireCellAt(x, y, z);
     if (cell->level < FIRE_MIN_SPREAD_LEVEL) return false;
     
     // Orthogonal neighbors + upward (fire rises)
@@ -288,7 +302,7 @@ static bool FireTrySpread(int x, int y, int z) {
     // Fisher-Yates shuffle
     int order[] = {0, 1, 2, 3, 4};
     for (int i = 4; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = SimRand(RNG_FIRE) % (i + 1);
         int tmp = order[i];
         order[i] = order[j];
         order[j] = tmp;
@@ -322,8 +336,7 @@ static bool FireTrySpread(int x, int y, int z) {
         
         if (!CanBurn(nx, ny, nz)) continue;
         
-        FireCell* neighbor = &fireGrid[nz][ny][nx];
-        if (neighbor->level > 0) continue;  // Already burning
+        if (FireCellAt(nx, ny, nz)->level > 0) continue;  // Already burning
         
         // Base spread chance: higher fire level = more likely to spread
         // Formula: spreadPercent = fireSpreadBase + (level * fireSpreadPerLevel) - targetResistance
@@ -358,9 +371,9 @@ static bool FireTrySpread(int x, int y, int z) {
             if (spreadPercent < 1) spreadPercent = 1;
         }
 
-        if ((rand() % 100) < spreadPercent) {
+        if ((SimRand(RNG_FIRE) % 100) < spreadPercent) {
             // Ignite neighbor
-            neighbor->fuel = GetFuelAt(nx, ny, nz);
+            FireCellForWrite(nx, ny, nz)->fuel = GetFuelAt(nx, ny, nz);
             SetFireLevel(nx, ny, nz, FIRE_MIN_SPREAD_LEVEL);  // Start at low intensity
             spread = true;
         }
@@ -370,8 +383,9 @@ static bool FireTrySpread(int x, int y, int z) {
 }
 
 // Process a single fire cell
+// Only called for cells of allocated pages
 static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
-    FireCell* cell = &fireGrid[z][y][x];
+    FireCell* cell = FireCellForWrite(x, y, z);
     bool changed = false;
     
     // Handle sources - always burn at max, never consume fuel
@@ -413,7 +427,7 @@ static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
         int rainChance = 0;
         if (w == WEATHER_RAIN) rainChance = 20;
         else if (w == WEATHER_HEAVY_RAIN || w == WEATHER_THUNDERSTORM) rainChance = 40;
-        if (rainChance > 0 && (rand() % 100) < rainChance) {
+        if (rainChance > 0 && (SimRand(RNG_FIRE) % 100) < rainChance) {
             SetFireLevel(x, y, z, cell->level - 1);
             if (cell->level == 0) {
                 cell->fuel = 0;
@@ -443,7 +457,7 @@ static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
                     grid[z][y][x] = burnResult;
                     // Set high wear on burned dirt so it takes time to regrow
                     if (burnResult == CELL_WALL && IsWallNatural(x, y, z) && GetWallMaterial(x, y, z) == MAT_DIRT) {
-                        wearGrid[z][y][x] = wearMax;
+                        SetGroundWear(x, y, z, wearMax);
                         SET_CELL_SURFACE(x, y, z, SURFACE_BARE);
                         SetVegetation(x, y, z, VEG_NONE);
                     }
@@ -457,7 +471,7 @@ static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
                     }
                 } else if (currentCell == CELL_WALL && IsWallNatural(x, y, z) && GetWallMaterial(x, y, z) == MAT_DIRT) {
                     // Dirt with grass surface burns away the grass
-                    wearGrid[z][y][x] = wearMax;
+                    SetGroundWear(x, y, z, wearMax);
                     SET_CELL_SURFACE(x, y, z, SURFACE_BARE);
                     SetVegetation(x, y, z, VEG_NONE);
                 }
@@ -482,7 +496,7 @@ static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
             else if (wetness == 2) maxLevel = 3;   // Wet
             else if (wetness >= 3) maxLevel = 2;   // Soaked: barely smolders
         }
-        if (cell->level < maxLevel && (rand() % 3) == 0) {
+        if (cell->level < maxLevel && (SimRand(RNG_FIRE) % 3) == 0) {
             SetFireLevel(x, y, z, cell->level + 1);
             changed = true;
         }
@@ -509,8 +523,7 @@ static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
             int nx = x + dx[i];
             int ny = y + dy[i];
             if (FireInBounds(nx, ny, z)) {
-                FireCell* neighbor = &fireGrid[z][ny][nx];
-                if (neighbor->level > 0 || CanBurn(nx, ny, z)) {
+                if (FireCellAt(nx, ny, z)->level > 0 || CanBurn(nx, ny, z)) {
                     hasActiveNeighbor = true;
                     break;
                 }
@@ -532,6 +545,9 @@ static bool ProcessFireCell(int x, int y, int z, bool doSpread, bool doFuel) {
 void UpdateFire(void) {
     if (!fireEnabled) return;
     
+    // Give back pages that have burned out
+    ReclaimPagedLayer(&fireLayer, PAGED_RECLAIM_BUDGET);
+    
     // Early exit: no fire activity at all
     if (fireActiveCells == 0) {
         fireUpdateCount = 0;
@@ -553,11 +569,17 @@ void UpdateFire(void) {
     if (doSpread) fireSpreadAccum -= spreadIntervalGS;
     if (doFuel) fireFuelAccum -= fuelIntervalGS;
     
-    // Process from bottom to top (simple iteration, keeps early exit optimization)
+    // Process from bottom to top (simple iteration, keeps early exit optimization),
+    // skipping unallocated pages
     for (int z = 0; z < gridDepth; z++) {
         for (int y = 0; y < gridHeight; y++) {
+            int py = y >> PAGE_SHIFT;
             for (int x = 0; x < gridWidth; x++) {
-                FireCell* cell = &fireGrid[z][y][x];
+                if (!PagedLayerHasPage(&fireLayer, x >> PAGE_SHIFT, py, z)) {
+                    x |= PAGE_MASK;  // Next page
+                    continue;
+                }
+                const FireCell* cell = FireCellAt(x, y, z);
                 
                 // Skip stable empty non-source cells
                 if (cell->stable && cell->level == 0 && !cell->isSource) {
@@ -586,7 +608,11 @@ void SyncFireLighting(void) {
     for (int z = 0; z < gridDepth; z++) {
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
-                FireCell* fc = &fireGrid[z][y][x];
+                if (!PagedLayerHasPage(&fireLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) {
+                    x |= PAGE_MASK;  // Next page
+                    continue;
+                }
+                const FireCell* fc = FireCellAt(x, y, z);
                 if (fc->level > 0) {
                     int lvl = fc->level;
                     uint8_t r = 255;
@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "../world/grid.h"
+#include "../world/paged_layer.h"
 
 // Fire level constants (1-7 scale like water)
 #define FIRE_MAX_LEVEL 7
@@ -20,8 +21,15 @@ typedef struct {
     uint16_t fuel     : 8;   // 0-255 remaining fuel in this cell
 } FireCell;
 
-// Fire grid (same dimensions as main grid)
-extern FireCell fireGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Fire cells, paged: pages with no fire, source or leftover fuel are not allocated
+extern PagedLayer fireLayer;
+
+static inline const FireCell* FireCellAt(int x, int y, int z) {
+    return PagedLayerCell(&fireLayer, x, y, z);
+}
+static inline FireCell* FireCellForWrite(int x, int y, int z) {
+    return PagedLayerCellForWrite(&fireLayer, x, y, z);
+}
 
 // Global state
 extern bool fireEnabled;            // Master toggle for fire simulation
@@ -6,8 +6,12 @@
 #include "../entities/mover.h"
 #include <string.h>
 
-// Grid storage
-uint8_t floorDirtGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Dirt storage: a page is freed when its last dirty cell is cleaned
+static const uint8_t noDirt = 0;
+static bool DirtCellIsClean(const void* cell) {
+    return *(const uint8_t*)cell == 0;
+}
+DEFINE_PAGED_LAYER(uint8_t, floorDirtLayer, &noDirt, DirtCellIsClean);
 
 // Global state
 bool floorDirtEnabled = true;
@@ -15,12 +19,18 @@ bool floorDirtEnabled = true;
 // Per-mover previous cell tracking (avoids Mover struct changes)
 static struct { int x, y, z; } prevMoverCell[MAX_MOVERS];
 
+static void NoteDirtActive(int x, int y, int z, int delta) {
+    dirtActiveCells += delta;
+    ChunkActivityAdd(ACTIVITY_DIRT, x, y, z, delta);
+}
+
 void InitFloorDirt(void) {
     ClearFloorDirt();
 }
 
 void ClearFloorDirt(void) {
-    memset(floorDirtGrid, 0, sizeof(floorDirtGrid));
+    ClearPagedLayer(&floorDirtLayer);
+    ClearChunkActivity(ACTIVITY_DIRT);
     ResetMoverDirtTracking();
 }
 
@@ -32,6 +42,23 @@ void ResetMoverDirtTracking(void) {
     }
 }
 
+void RenumberMoverDirtTracking(const int* moverMap, int oldCount) {
+    static struct { int x, y, z; } oldCells[MAX_MOVERS];
+    memcpy(oldCells, prevMoverCell, oldCount * sizeof(prevMoverCell[0]));
+    for (int i = 0; i < oldCount; i++) {
+        prevMoverCell[i].x = -1;
+        prevMoverCell[i].y = -1;
+        prevMoverCell[i].z = -1;
+    }
+    for (int i = 0; i < oldCount; i++) {
+        int n = moverMap[i];
+        if (n < 0) continue;
+        prevMoverCell[n].x = oldCells[i].x;
+        prevMoverCell[n].y = oldCells[i].y;
+        prevMoverCell[n].z = oldCells[i].z;
+    }
+}
+
 // Check if position is natural soil terrain (dirt source for tracking)
 // Uses same z/z-1 pattern as TrampleGround() in groundwear.c
 bool IsDirtSource(int x, int y, int z) {
@@ -94,12 +121,13 @@ static void TrackFloorDirt(int srcX, int srcY, int srcZ,
         if (amount < 1) amount = 1;
     }
 
-    uint8_t old = floorDirtGrid[dstZ][dstY][dstX];
+    uint8_t old = FloorDirtAt(dstX, dstY, dstZ);
     int newVal = old + amount;
     if (newVal > DIRT_MAX) newVal = DIRT_MAX;
-    floorDirtGrid[dstZ][dstY][dstX] = (uint8_t)newVal;
+    if (newVal == old) return;
+    *(uint8_t*)PagedLayerCellForWrite(&floorDirtLayer, dstX, dstY, dstZ) = (uint8_t)newVal;
 
-    if (old == 0 && newVal > 0) dirtActiveCells++;
+    if (old == 0 && newVal > 0) NoteDirtActive(dstX, dstY, dstZ, 1);
 }
 
 void MoverTrackDirt(int moverIdx, int cellX, int cellY, int cellZ) {
@@ -123,26 +151,34 @@ void MoverTrackDirt(int moverIdx, int cellX, int cellY, int cellZ) {
 int GetFloorDirt(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight
         || z < 0 || z >= gridDepth) return 0;
-    return floorDirtGrid[z][y][x];
+    return FloorDirtAt(x, y, z);
 }
 
 void SetFloorDirt(int x, int y, int z, int value) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight
         || z < 0 || z >= gridDepth) return;
-    uint8_t old = floorDirtGrid[z][y][x];
+    uint8_t old = FloorDirtAt(x, y, z);
     uint8_t nv = (uint8_t)(value > DIRT_MAX ? DIRT_MAX : (value < 0 ? 0 : value));
-    floorDirtGrid[z][y][x] = nv;
-    if (old == 0 && nv > 0) dirtActiveCells++;
-    if (old > 0 && nv == 0) dirtActiveCells--;
+    if (nv == old) return;
+    *(uint8_t*)PagedLayerCellForWrite(&floorDirtLayer, x, y, z) = nv;
+    if (old == 0 && nv > 0) NoteDirtActive(x, y, z, 1);
+    if (old > 0 && nv == 0) {
+        NoteDirtActive(x, y, z, -1);
+        ReclaimLayerPageAt(&floorDirtLayer, x, y, z);
+    }
 }
 
 int CleanFloorDirt(int x, int y, int z, int amount) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight
         || z < 0 || z >= gridDepth) return 0;
-    uint8_t old = floorDirtGrid[z][y][x];
+    uint8_t old = FloorDirtAt(x, y, z);
     int nv = (int)old - amount;
     if (nv < 0) nv = 0;
-    floorDirtGrid[z][y][x] = (uint8_t)nv;
-    if (old > 0 && nv == 0) dirtActiveCells--;
+    if (nv == old) return nv;
+    *(uint8_t*)PagedLayerCellForWrite(&floorDirtLayer, x, y, z) = (uint8_t)nv;
+    if (old > 0 && nv == 0) {
+        NoteDirtActive(x, y, z, -1);
+        ReclaimLayerPageAt(&floorDirtLayer, x, y, z);
+    }
     return nv;
 }
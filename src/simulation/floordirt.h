@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include "../world/grid.h"
+#include "../world/paged_layer.h"
 
 // Floor dirt thresholds (uint8_t range: 0-255)
 #define DIRT_VISIBLE_THRESHOLD  10   // Overlay starts rendering above this
@@ -14,8 +15,13 @@
 #define DIRT_STONE_MULTIPLIER   50   // Stone floors: 50% rate (value / 100)
 #define DIRT_CLEAN_AMOUNT       50   // Dirt removed per completed clean job
 
-// Grid storage (parallel to main grid)
-extern uint8_t floorDirtGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Dirt per cell, paged: pages with no dirt are not allocated
+extern PagedLayer floorDirtLayer;
+
+// Unchecked read (in-bounds cells only)
+static inline uint8_t FloorDirtAt(int x, int y, int z) {
+    return *(const uint8_t*)PagedLayerCell(&floorDirtLayer, x, y, z);
+}
 
 // Global state
 extern bool floorDirtEnabled;
@@ -33,6 +39,9 @@ void MoverTrackDirt(int moverIdx, int cellX, int cellY, int cellZ);
 // Reset per-mover tracking (call from ClearMovers)
 void ResetMoverDirtTracking(void);
 
+// Carry tracking over RenumberMoversByCell (moverMap: old -> new index, -1 = dropped)
+void RenumberMoverDirtTracking(const int* moverMap, int oldCount);
+
 // Accessors
 int  GetFloorDirt(int x, int y, int z);
 void SetFloorDirt(int x, int y, int z, int value);
@@ -9,11 +9,12 @@
 #include "water.h"
 #include "trees.h"
 #include "../entities/items.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <stdlib.h>
 
 // Wear grid storage (3D)
-int wearGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(int, wearGrid);
 
 // Global state
 bool groundWearEnabled = true;
@@ -34,9 +35,31 @@ int saplingRegrowthChance = 5;      // 5 per 10000 = 0.05% per interval per tile
 int saplingMinTreeDistance = 4;     // Min 4 tiles from existing trees/saplings
 int wearMax = WEAR_MAX_DEFAULT;
 
+// Chunks visited per UpdateGroundWear call while a recovery sweep is running.
+// A sweep starts each time the recovery interval elapses and walks z/chunk-row/chunk
+// order, so large maps spread one pass over several ticks.
+int wearRecoveryChunkBudget = 256;
+
 // Internal accumulator for game-time
 static float wearRecoveryAccum = 0.0f;
 
+// In-progress recovery sweep
+static struct {
+    bool active;
+    bool allChunks;     // visit every chunk (regrowth/reeds/drift), not just worn or wet ones
+    float vegRate;      // seasonal growth rate cached at sweep start
+    int z, cy, cx;      // next chunk to visit
+} wearSweep;
+
+bool IsWearTrackedCell(int x, int y, int z) {
+    return CellIsSolid(grid[z][y][x]) && IsWallNatural(x, y, z) && GetWallMaterial(x, y, z) == MAT_DIRT;
+}
+
+static void NoteWearActive(int x, int y, int z, int delta) {
+    wearActiveCells += delta;
+    ChunkActivityAdd(ACTIVITY_WEAR, x, y, z, delta);
+}
+
 // Map wear value to the vegetation level it implies
 static VegetationType VegLevelForWear(int wear) {
     if (wear >= wearGrassToDirt)      return VEG_NONE;
@@ -139,8 +162,20 @@ void InitGroundWear(void) {
 }
 
 void ClearGroundWear(void) {
-    memset(wearGrid, 0, sizeof(wearGrid));
+    CLEAR_WORLD_LAYER(wearGrid);
+    ClearChunkActivity(ACTIVITY_WEAR);
     wearRecoveryAccum = 0.0f;
+    wearSweep.active = false;
+}
+
+void SetGroundWear(int x, int y, int z, int wear) {
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight) return;
+    if (z < 0 || z >= gridDepth) return;
+    int old = wearGrid[z][y][x];
+    wearGrid[z][y][x] = wear;
+    if (!IsWearTrackedCell(x, y, z)) return;
+    if (old == 0 && wear > 0) NoteWearActive(x, y, z, 1);
+    if (old > 0 && wear == 0) NoteWearActive(x, y, z, -1);
 }
 
 void TrampleGround(int x, int y, int z) {
@@ -190,124 +225,179 @@ void TrampleGround(int x, int y, int z) {
     
     // Track active worn cells
     if (oldWear == 0 && newWear > 0) {
-        wearActiveCells++;
+        NoteWearActive(x, y, targetZ, 1);
     }
     
     // Update surface overlay — trampling can only decrease vegetation
     UpdateSurfaceFromWear(x, y, targetZ, false);
 }
 
+// Per-cell recovery: wear decay, reed and sapling regrowth, wetness drying
+static void RecoverSoilCell(int x, int y, int z, float vegRate) {
+    CellType cell = grid[z][y][x];
+    
+    // Only process natural dirt tiles
+    if (!CellIsSolid(cell) || !IsWallNatural(x, y, z)) return;
+    bool isDirt = (GetWallMaterial(x, y, z) == MAT_DIRT);
+    
+    // Skip if on fire - don't regrow grass while burning
+    if (HasFire(x, y, z)) return;
+    
+    if (isDirt) {
+        // Decay wear (modulated by seasonal vegetation growth)
+        int effectiveDecay = (int)(wearDecayRate * vegRate);
+        int oldWear = wearGrid[z][y][x];
+        if (effectiveDecay > 0 && oldWear > effectiveDecay) {
+            wearGrid[z][y][x] = oldWear - effectiveDecay;
+            // Recovery — vegetation grows one step per tick
+            UpdateSurfaceFromWear(x, y, z, true);
+        } else if (effectiveDecay > 0 && oldWear > 0) {
+            // Wear would decay to 0. If vegetation hasn't fully
+            // regrown, hold wear at 1 to keep recovery ticking.
+            VegetationType veg = GetVegetation(x, y, z);
+            wearGrid[z][y][x] = 0;
+            UpdateSurfaceFromWear(x, y, z, true);
+            veg = GetVegetation(x, y, z);
+            if (veg > VEG_NONE && veg < VEG_GRASS_TALLER) {
+                wearGrid[z][y][x] = 1;  // keep ticking
+            } else {
+                NoteWearActive(x, y, z, -1);
+            }
+        }
+    }
+
+    // Reed regrowth: bare soil adjacent to water regrows reeds
+    if (isDirt && GetVegetation(x, y, z) == VEG_NONE && wearGrid[z][y][x] == 0) {
+        bool hasAdjacentWater = false;
+        if (z + 1 < gridDepth) {
+            if (x > 0 && GetWaterLevel(x - 1, y, z + 1) > 0) hasAdjacentWater = true;
+            if (x < gridWidth - 1 && GetWaterLevel(x + 1, y, z + 1) > 0) hasAdjacentWater = true;
+            if (y > 0 && GetWaterLevel(x, y - 1, z + 1) > 0) hasAdjacentWater = true;
+            if (y < gridHeight - 1 && GetWaterLevel(x, y + 1, z + 1) > 0) hasAdjacentWater = true;
+        }
+        if (hasAdjacentWater) {
+            SetVegetation(x, y, z, VEG_REEDS);
+        }
+    }
+
+    // Sapling regrowth: spawn sapling on tall grass with some chance
+    if (saplingRegrowthEnabled && wearGrid[z][y][x] == 0) {
+        // For dirt, require fully recovered grass; for other soils, just require no wear
+        if (!isDirt || GetVegetation(x, y, z) >= VEG_GRASS_TALL) {
+            if (z + 1 < gridDepth && grid[z + 1][y][x] == CELL_AIR) {
+                if (QueryItemAtTile(x, y, z + 1) >= 0) return;
+                if ((SimRand(RNG_GROUNDWEAR) % 10000) < saplingRegrowthChance) {
+                    if (!HasNearbyTree(x, y, z, saplingMinTreeDistance)) {
+                        MaterialType soilMat = GetWallMaterial(x, y, z);
+                        MaterialType treeMat = PickTreeTypeForSoil(soilMat);
+                        PlaceSapling(x, y, z + 1, treeMat);
+                    }
+                }
+            }
+        }
+    }
+    
+    // Wetness drying: decrease wetness on natural soil cells
+    // Only dry if no water is sitting on or above this cell
+    // Random chance per cell prevents all mud vanishing in the same tick
+    int wetness = GET_CELL_WETNESS(x, y, z);
+    if (wetness > 0 && IsSoilMaterial(GetWallMaterial(x, y, z))) {
+        bool waterPresent = (z + 1 < gridDepth && GetWaterLevel(x, y, z + 1) > 0)
+                         || GetWaterLevel(x, y, z) > 0;
+        if (!waterPresent) {
+            // 50% chance to dry — desynchronizes cells so mud fades gradually
+            if (SimRand(RNG_GROUNDWEAR) % 100 < 50) {
+                SET_CELL_WETNESS(x, y, z, wetness - 1);
+            }
+
+            // Wind drying: exposed cells with wind have additional chance to dry
+            if (weatherState.windStrength > 0.5f && IsExposedToSky(x, y, z)) {
+                int currentWetness = GET_CELL_WETNESS(x, y, z);
+                if (currentWetness > 0 && (SimRand(RNG_GROUNDWEAR) % 100) < (int)(windDryingMultiplier * 10.0f)) {
+                    SET_CELL_WETNESS(x, y, z, currentWetness - 1);
+                }
+            }
+        }
+    }
+}
+
+static void RecoverChunk(int z, int cx, int cy, float vegRate) {
+    int x0 = cx * chunkWidth, x1 = x0 + chunkWidth;
+    int y0 = cy * chunkHeight, y1 = y0 + chunkHeight;
+    if (x1 > gridWidth) x1 = gridWidth;
+    if (y1 > gridHeight) y1 = gridHeight;
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            RecoverSoilCell(x, y, z, vegRate);
+        }
+    }
+}
+
+// Wet soil lies under water, so reeds regrow in wet chunks and their neighbours
+// (the water can sit just across a chunk edge).
+static bool ChunkNearWetness(int z, int cx, int cy) {
+    for (int ny = cy - 1; ny <= cy + 1; ny++) {
+        if (ny < 0 || ny >= chunksY) continue;
+        for (int nx = cx - 1; nx <= cx + 1; nx++) {
+            if (nx < 0 || nx >= chunksX) continue;
+            if (ChunkHasActivity(ACTIVITY_WETNESS, z, nx, ny)) return true;
+        }
+    }
+    return false;
+}
+
+// Visit up to wearRecoveryChunkBudget chunks of the current sweep.
+// Only worn or wet chunks have work unless the sweep covers every chunk.
+static void ContinueWearSweep(void) {
+    int budget = wearRecoveryChunkBudget > 0 ? wearRecoveryChunkBudget : 1;
+    for (; wearSweep.z < gridDepth; wearSweep.z++, wearSweep.cy = 0) {
+        int z = wearSweep.z;
+        for (; wearSweep.cy < chunksY; wearSweep.cy++, wearSweep.cx = 0) {
+            int cy = wearSweep.cy;
+            const uint64_t* wearMask = chunkActiveMask[ACTIVITY_WEAR][z][cy];
+            for (; wearSweep.cx < chunksX; wearSweep.cx++) {
+                int cx = wearSweep.cx;
+                if (!wearSweep.allChunks && !((wearMask[cx >> 6] >> (cx & 63)) & 1) &&
+                    !ChunkNearWetness(z, cx, cy)) continue;
+                if (budget == 0) return;
+                RecoverChunk(z, cx, cy, wearSweep.vegRate);
+                budget--;
+            }
+        }
+    }
+    wearSweep.active = false;
+}
+
 void UpdateGroundWear(void) {
     if (!groundWearEnabled) return;
     
     // Early exit: nothing to process
-    if (wearActiveCells == 0 && !saplingRegrowthEnabled && waterActiveCells == 0) {
+    if (!wearSweep.active && wearActiveCells == 0 && !saplingRegrowthEnabled &&
+        chunkActiveTotal[ACTIVITY_WETNESS] == 0) {
         return;
     }
     
     // Accumulate game time for interval-based decay
     wearRecoveryAccum += gameDeltaTime;
     
-    // Only decay wear when interval elapses
-    float wearIntervalGS = GameHoursToGameSeconds(wearRecoveryInterval);
-    if (wearRecoveryAccum < wearIntervalGS) return;
-    wearRecoveryAccum -= wearIntervalGS;
-    
-    // Cache seasonal growth rate (uses cosf — don't call per-cell)
-    float vegRate = GetVegetationGrowthRate();
-
-    // Process all cells at all z-levels
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                CellType cell = grid[z][y][x];
-                
-                // Only process natural dirt tiles
-                if (!CellIsSolid(cell) || !IsWallNatural(x, y, z)) continue;
-                bool isDirt = (GetWallMaterial(x, y, z) == MAT_DIRT);
-                
-                // Skip if on fire - don't regrow grass while burning
-                if (HasFire(x, y, z)) continue;
-                
-                if (isDirt) {
-                    // Decay wear (modulated by seasonal vegetation growth)
-                    int effectiveDecay = (int)(wearDecayRate * vegRate);
-                    int oldWear = wearGrid[z][y][x];
-                    if (effectiveDecay > 0 && oldWear > effectiveDecay) {
-                        wearGrid[z][y][x] = oldWear - effectiveDecay;
-                        // Recovery — vegetation grows one step per tick
-                        UpdateSurfaceFromWear(x, y, z, true);
-                    } else if (effectiveDecay > 0 && oldWear > 0) {
-                        // Wear would decay to 0. If vegetation hasn't fully
-                        // regrown, hold wear at 1 to keep recovery ticking.
-                        VegetationType veg = GetVegetation(x, y, z);
-                        wearGrid[z][y][x] = 0;
-                        UpdateSurfaceFromWear(x, y, z, true);
-                        veg = GetVegetation(x, y, z);
-                        if (veg > VEG_NONE && veg < VEG_GRASS_TALLER) {
-                            wearGrid[z][y][x] = 1;  // keep ticking
-                        } else {
-                            wearActiveCells--;
-                        }
-                    }
-                }
-
-                // Reed regrowth: bare soil adjacent to water regrows reeds
-                if (isDirt && GetVegetation(x, y, z) == VEG_NONE && wearGrid[z][y][x] == 0) {
-                    bool hasAdjacentWater = false;
-                    if (z + 1 < gridDepth) {
-                        if (x > 0 && GetWaterLevel(x - 1, y, z + 1) > 0) hasAdjacentWater = true;
-                        if (x < gridWidth - 1 && GetWaterLevel(x + 1, y, z + 1) > 0) hasAdjacentWater = true;
-                        if (y > 0 && GetWaterLevel(x, y - 1, z + 1) > 0) hasAdjacentWater = true;
-                        if (y < gridHeight - 1 && GetWaterLevel(x, y + 1, z + 1) > 0) hasAdjacentWater = true;
-                    }
-                    if (hasAdjacentWater) {
-                        SetVegetation(x, y, z, VEG_REEDS);
-                    }
-                }
+    // Only start a new recovery sweep when interval elapses
+    if (!wearSweep.active) {
+        float wearIntervalGS = GameHoursToGameSeconds(wearRecoveryInterval);
+        if (wearRecoveryAccum < wearIntervalGS) return;
+        wearRecoveryAccum -= wearIntervalGS;
 
-                // Sapling regrowth: spawn sapling on tall grass with some chance
-                if (saplingRegrowthEnabled && wearGrid[z][y][x] == 0) {
-                    // For dirt, require fully recovered grass; for other soils, just require no wear
-                    if (!isDirt || GetVegetation(x, y, z) >= VEG_GRASS_TALL) {
-                        if (z + 1 < gridDepth && grid[z + 1][y][x] == CELL_AIR) {
-                            if (QueryItemAtTile(x, y, z + 1) >= 0) continue;
-                            if ((rand() % 10000) < saplingRegrowthChance) {
-                                if (!HasNearbyTree(x, y, z, saplingMinTreeDistance)) {
-                                    MaterialType soilMat = GetWallMaterial(x, y, z);
-                                    MaterialType treeMat = PickTreeTypeForSoil(soilMat);
-                                    PlaceSapling(x, y, z + 1, treeMat);
-                                }
-                            }
-                        }
-                    }
-                }
-                
-                // Wetness drying: decrease wetness on natural soil cells
-                // Only dry if no water is sitting on or above this cell
-                // Random chance per cell prevents all mud vanishing in the same tick
-                int wetness = GET_CELL_WETNESS(x, y, z);
-                if (wetness > 0 && IsSoilMaterial(GetWallMaterial(x, y, z))) {
-                    bool waterPresent = (z + 1 < gridDepth && GetWaterLevel(x, y, z + 1) > 0)
-                                     || GetWaterLevel(x, y, z) > 0;
-                    if (!waterPresent) {
-                        // 50% chance to dry — desynchronizes cells so mud fades gradually
-                        if (rand() % 100 < 50) {
-                            SET_CELL_WETNESS(x, y, z, wetness - 1);
-                        }
-
-                        // Wind drying: exposed cells with wind have additional chance to dry
-                        if (weatherState.windStrength > 0.5f && IsExposedToSky(x, y, z)) {
-                            int currentWetness = GET_CELL_WETNESS(x, y, z);
-                            if (currentWetness > 0 && (rand() % 100) < (int)(windDryingMultiplier * 10.0f)) {
-                                SET_CELL_WETNESS(x, y, z, currentWetness - 1);
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        wearSweep.active = true;
+        // Sapling regrowth can happen on any soil cell, and a wear counter that
+        // disagrees with the per-chunk counts means something wrote wearGrid directly.
+        // Reed regrowth and drying follow the wetness mask instead.
+        wearSweep.allChunks = saplingRegrowthEnabled ||
+                              wearActiveCells != chunkActiveTotal[ACTIVITY_WEAR];
+        // Cache seasonal growth rate (uses cosf — don't call per-cell)
+        wearSweep.vegRate = GetVegetationGrowthRate();
+        wearSweep.z = wearSweep.cy = wearSweep.cx = 0;
     }
+
+    ContinueWearSweep();
 }
 
 int GetGroundWear(int x, int y, int z) {
@@ -29,6 +29,7 @@ extern int wearTrampleAmount;    // Wear added per mover step
 extern int wearDecayRate;        // Wear removed per decay interval
 extern float wearRecoveryInterval; // Game-seconds between decay updates
 extern int wearMax;              // Maximum wear value
+extern int wearRecoveryChunkBudget; // Chunks visited per tick while a recovery sweep runs
 
 // Sapling regrowth on untrampled grass
 extern bool saplingRegrowthEnabled;   // Enable/disable natural sapling spawning
@@ -36,7 +37,7 @@ extern int saplingRegrowthChance;     // Chance per 10000 per interval (default
 extern int saplingMinTreeDistance;    // Min distance from existing trees/saplings
 
 // Wear grid (parallel to main grid, all z-levels)
-extern int wearGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(int, wearGrid);
 
 // Global state
 extern bool groundWearEnabled;
@@ -56,6 +57,13 @@ void UpdateGroundWear(void);
 // Get current wear value at position
 int GetGroundWear(int x, int y, int z);
 
+// Set wear directly (burning, tools, harvesting) and keep activity counts in sync
+void SetGroundWear(int x, int y, int z, int wear);
+
+// True for the cells counted in wearActiveCells / ACTIVITY_WEAR (natural dirt terrain).
+// Code that changes a cell's type or wall material clears its wear first (ClearCellCleanup).
+bool IsWearTrackedCell(int x, int y, int z);
+
 // Accumulator getters/setters (for save/load)
 float GetWearRecoveryAccum(void);
 void SetWearRecoveryAccum(float v);
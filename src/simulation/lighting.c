@@ -5,6 +5,7 @@
 // Both write into lightGrid which rendering reads each frame.
 
 #include "lighting.h"
+#include "area_sums.h"
 #include "../world/cell_defs.h"
 #include "../world/material.h"
 #include <string.h>
@@ -49,7 +50,7 @@ void SetTorchPreset(TorchPreset preset) {
 }
 
 // Light grid (per-cell computed light)
-LightCell lightGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(LightCell, lightGrid);
 
 // Light sources (sparse list)
 LightSource lightSources[MAX_LIGHT_SOURCES];
@@ -64,10 +65,11 @@ typedef struct { int x, y, z; uint8_t level; } LightBfsNode;
 static LightBfsNode bfsQueue[LIGHT_BFS_MAX];
 
 void InitLighting(void) {
-    memset(lightGrid, 0, sizeof(lightGrid));
+    CLEAR_WORLD_LAYER(lightGrid);
     memset(lightSources, 0, sizeof(lightSources));
     lightSourceCount = 0;
     lightingDirty = true;
+    InvalidateAreaLayer(AREA_LAYER_LIGHT);
 }
 
 void InvalidateLighting(void) {
@@ -286,6 +288,7 @@ void RecomputeLighting(void) {
         ClearBlockLight();
     }
     lightingDirty = false;
+    InvalidateAreaLayer(AREA_LAYER_LIGHT);
 }
 
 void UpdateLighting(void) {
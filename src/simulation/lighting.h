@@ -60,7 +60,7 @@ typedef struct {
 } LightSource;
 
 // Light grid
-extern LightCell lightGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(LightCell, lightGrid);
 
 // Light sources (sparse list)
 extern LightSource lightSources[MAX_LIGHT_SOURCES];
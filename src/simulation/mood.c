@@ -14,6 +14,8 @@
 #include "../core/time.h"
 #include "../core/event_log.h"
 #include "rooms.h"
+#include "area_sums.h"
+#include "../core/sim_rng.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -349,35 +351,29 @@ void InitSceneryState(void) {
     memset(roomCheckTimer, 0, sizeof(roomCheckTimer));
 }
 
+// moverMap: old index -> new index, -1 = dropped (see item_renumber.h)
+void RenumberSceneryState(const int* moverMap, int oldCount) {
+    static float oldScenery[MAX_MOVERS], oldBleak[MAX_MOVERS], oldRoom[MAX_MOVERS];
+    memcpy(oldScenery, sceneryCheckTimer, oldCount * sizeof(float));
+    memcpy(oldBleak, bleakAccumulator, oldCount * sizeof(float));
+    memcpy(oldRoom, roomCheckTimer, oldCount * sizeof(float));
+    memset(sceneryCheckTimer, 0, oldCount * sizeof(float));
+    memset(bleakAccumulator, 0, oldCount * sizeof(float));
+    memset(roomCheckTimer, 0, oldCount * sizeof(float));
+    for (int i = 0; i < oldCount; i++) {
+        int n = moverMap[i];
+        if (n < 0) continue;
+        sceneryCheckTimer[n] = oldScenery[i];
+        bleakAccumulator[n] = oldBleak[i];
+        roomCheckTimer[n] = oldRoom[i];
+    }
+}
+
 // Count beauty sources (trees, water, plants) within radius of a cell.
+// Each (x,y) column counts once if any source sits at z-1..z+1.
+// O(1): reads the beauty summed-area table (see area_sums.h).
 int CountBeautySources(int cx, int cy, int cz, int radius) {
-    int count = 0;
-    for (int dy = -radius; dy <= radius; dy++) {
-        for (int dx = -radius; dx <= radius; dx++) {
-            int nx = cx + dx;
-            int ny = cy + dy;
-            if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
-
-            // Trees: trunk, branch, leaves, sapling at any z within ±1
-            for (int dz = -1; dz <= 1; dz++) {
-                int nz = cz + dz;
-                if (nz < 0 || nz >= gridDepth) continue;
-                CellType cell = grid[nz][ny][nx];
-                if (cell == CELL_TREE_TRUNK || cell == CELL_TREE_BRANCH ||
-                    cell == CELL_TREE_LEAVES || cell == CELL_SAPLING) {
-                    count++;
-                    break; // only count this (x,y) once for trees
-                }
-                // Water
-                if (GetWaterLevel(nx, ny, nz) > 0) {
-                    count++;
-                    break;
-                }
-            }
-
-        }
-    }
-    return count;
+    return AreaSumRect(AREA_LAYER_BEAUTY, cx - radius, cy - radius, cx + radius, cy + radius, cz);
 }
 
 static void UpdateSceneryMoodlets(Mover* m, int moverIdx, float dt) {
@@ -388,9 +384,9 @@ static void UpdateSceneryMoodlets(Mover* m, int moverIdx, float dt) {
     sceneryCheckTimer[moverIdx] = GameHoursToGameSeconds(SCENERY_CHECK_INTERVAL_GH);
 
     // Convert pixel position to cell coords
-    int cx = (int)(m->x / CELL_SIZE);
-    int cy = (int)(m->y / CELL_SIZE);
-    int cz = (int)m->z;
+    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cz = (int)moverPosZ[moverIdx];
 
     int beauty = CountBeautySources(cx, cy, cz, SCENERY_RADIUS);
 
@@ -421,9 +417,9 @@ static void UpdateRoomMoodlets(Mover* m, int moverIdx, float dt) {
     if (roomCheckTimer[moverIdx] > 0.0f) return;
     roomCheckTimer[moverIdx] = GameHoursToGameSeconds(ROOM_CHECK_INTERVAL_GH);
 
-    int cx = (int)(m->x / CELL_SIZE);
-    int cy = (int)(m->y / CELL_SIZE);
-    int cz = (int)m->z;
+    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cz = (int)moverPosZ[moverIdx];
 
     uint16_t rid = GetRoomAt(cx, cy, cz);
     DetectedRoom* room = GetRoom(rid);
@@ -464,11 +460,11 @@ void AssignRandomTraits(Mover* m) {
     m->traits[1] = TRAIT_NONE;
 
     // 70% chance of first trait, 30% chance of second
-    if ((rand() % 100) < 70) {
-        m->traits[0] = 1 + (rand() % (TRAIT_COUNT - 1));  // skip TRAIT_NONE
+    if ((SimRand(RNG_MOOD) % 100) < 70) {
+        m->traits[0] = 1 + (SimRand(RNG_MOOD) % (TRAIT_COUNT - 1));  // skip TRAIT_NONE
     }
-    if ((rand() % 100) < 30) {
-        TraitType second = 1 + (rand() % (TRAIT_COUNT - 1));
+    if ((SimRand(RNG_MOOD) % 100) < 30) {
+        TraitType second = 1 + (SimRand(RNG_MOOD) % (TRAIT_COUNT - 1));
         // No duplicates
         if (second != m->traits[0]) {
             m->traits[1] = second;
@@ -491,7 +487,7 @@ void MoodTick(float dt) {
 
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) continue;
+        if (!moverActive[i]) continue;
 
         TickMoverMoodlets(m, dt);
         UpdateContinuousMoodlets(m, i, dt);
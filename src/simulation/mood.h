@@ -117,6 +117,7 @@ extern bool moodEnabled;
 // Scenery appreciation (Phase 3)
 extern bool sceneryEnabled;
 void InitSceneryState(void);
+void RenumberSceneryState(const int* moverMap, int oldCount);  // carry timers over RenumberMoversByCell
 int CountBeautySources(int cx, int cy, int cz, int radius);
 
 #endif // MOOD_H
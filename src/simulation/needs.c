@@ -39,15 +39,15 @@ static int FindNearestEdibleInStockpile(float x, float y, int z) {
     float bestDistSq = 1e30f;
 
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_IN_STOCKPILE) continue;
-        if (items[i].reservedBy != -1) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_IN_STOCKPILE) continue;
+        if (itemReservedBy[i] != -1) continue;
         if (!ItemIsEdible(items[i].type)) continue;
         if (items[i].condition == CONDITION_ROTTEN) continue;
 
-        float dx = items[i].x - x;
-        float dy = items[i].y - y;
-        float dz = ((int)items[i].z - z) * CELL_SIZE;
+        float dx = itemPosX[i] - x;
+        float dy = itemPosY[i] - y;
+        float dz = ((int)itemPosZ[i] - z) * CELL_SIZE;
         float distSq = dx * dx + dy * dy + dz * dz;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -65,15 +65,15 @@ static int FindNearestEdibleOnGround(float x, float y, int z) {
     float bestDistSq = 1e30f;
 
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].state != ITEM_ON_GROUND) continue;
-        if (items[i].reservedBy != -1) continue;
+        if (!itemActive[i]) continue;
+        if (itemState[i] != ITEM_ON_GROUND) continue;
+        if (itemReservedBy[i] != -1) continue;
         if (!ItemIsEdible(items[i].type)) continue;
         if (items[i].condition == CONDITION_ROTTEN) continue;
 
-        float dx = items[i].x - x;
-        float dy = items[i].y - y;
-        float dz = ((int)items[i].z - z) * CELL_SIZE;
+        float dx = itemPosX[i] - x;
+        float dy = itemPosY[i] - y;
+        float dz = ((int)itemPosZ[i] - z) * CELL_SIZE;
         float distSq = dx * dx + dy * dy + dz * dz;
         if (distSq < bestDistSq) {
             bestDistSq = distSq;
@@ -86,9 +86,9 @@ static int FindNearestEdibleOnGround(float x, float y, int z) {
 
 static void StartFoodSearch(Mover* m, int moverIdx) {
     // Try stockpile first, then ground items
-    int itemIdx = FindNearestEdibleInStockpile(m->x, m->y, (int)m->z);
+    int itemIdx = FindNearestEdibleInStockpile(moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
     if (itemIdx < 0) {
-        itemIdx = FindNearestEdibleOnGround(m->x, m->y, (int)m->z);
+        itemIdx = FindNearestEdibleOnGround(moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
     }
 
     if (itemIdx < 0) {
@@ -110,11 +110,11 @@ static void StartFoodSearch(Mover* m, int moverIdx) {
     m->needProgress = 0.0f;
 
     // Set mover goal to item position
-    int goalX = (int)(items[itemIdx].x / CELL_SIZE);
-    int goalY = (int)(items[itemIdx].y / CELL_SIZE);
-    int goalZ = (int)items[itemIdx].z;
+    int goalX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+    int goalY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+    int goalZ = (int)itemPosZ[itemIdx];
     m->goal = (Point){goalX, goalY, goalZ};
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 }
 
 // Find nearest actively burning workshop (heat source) on same z-level.
@@ -165,7 +165,7 @@ static bool FindWalkableNearFuel(Workshop* ws, int* outX, int* outY) {
 }
 
 static void StartWarmthSearch(Mover* m, int moverIdx) {
-    int wsIdx = FindNearestBurningWorkshop(m->x, m->y, (int)m->z);
+    int wsIdx = FindNearestBurningWorkshop(moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
     if (wsIdx < 0) {
         m->needSearchCooldown = GameHoursToGameSeconds(balance.warmthSearchCooldownGH);
         return;
@@ -183,7 +183,7 @@ static void StartWarmthSearch(Mover* m, int moverIdx) {
     m->needTarget = wsIdx;
     m->needProgress = 0.0f;
     m->goal = (Point){goalX, goalY, ws->z};
-    m->needsRepath = true;
+    moverNeedsRepath[moverIdx] = true;
 }
 
 // --- Bladder seeking ---
@@ -249,19 +249,19 @@ static bool FindNearbyBush(int cx, int cy, int z, int* outX, int* outY) {
 }
 
 static void StartBladderSearch(Mover* m, int moverIdx) {
-    int cx = (int)(m->x / CELL_SIZE);
-    int cy = (int)(m->y / CELL_SIZE);
-    int cz = (int)m->z;
+    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cz = (int)moverPosZ[moverIdx];
 
     // Priority 1: toilet furniture
-    int toiletIdx = FindNearestToilet(m->x, m->y, cz);
+    int toiletIdx = FindNearestToilet(moverPosX[moverIdx], moverPosY[moverIdx], cz);
     if (toiletIdx >= 0) {
         furniture[toiletIdx].occupant = moverIdx;
         m->freetimeState = FREETIME_SEEKING_TOILET;
         m->needTarget = toiletIdx;
         m->needProgress = 0.0f;
         m->goal = (Point){furniture[toiletIdx].x, furniture[toiletIdx].y, cz};
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         return;
     }
 
@@ -272,7 +272,7 @@ static void StartBladderSearch(Mover* m, int moverIdx) {
         m->needTarget = bushX + bushY * gridWidth;  // encode position
         m->needProgress = 0.0f;
         m->goal = (Point){bushX, bushY, cz};
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         return;
     }
 
@@ -288,19 +288,19 @@ static int FindBestDrinkableItem(float x, float y, int z) {
     float bestScore = -1.0f;
 
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (!items[i].active) continue;
-        if (items[i].reservedBy != -1) continue;
+        if (!itemActive[i]) continue;
+        if (itemReservedBy[i] != -1) continue;
         if (!ItemIsDrinkable(items[i].type)) continue;
         if (items[i].condition == CONDITION_ROTTEN) continue;
         // Must be accessible (in stockpile, on ground, or in accessible container)
-        if (items[i].state != ITEM_IN_STOCKPILE && items[i].state != ITEM_ON_GROUND &&
-            items[i].state != ITEM_IN_CONTAINER) continue;
-        if (items[i].state == ITEM_IN_CONTAINER && !IsItemAccessible(i)) continue;
+        if (itemState[i] != ITEM_IN_STOCKPILE && itemState[i] != ITEM_ON_GROUND &&
+            itemState[i] != ITEM_IN_CONTAINER) continue;
+        if (itemState[i] == ITEM_IN_CONTAINER && !IsItemAccessible(i)) continue;
 
         float hydration = GetItemHydration(items[i].type);
-        float dx = items[i].x - x;
-        float dy = items[i].y - y;
-        float dz = ((int)items[i].z - z) * CELL_SIZE;
+        float dx = itemPosX[i] - x;
+        float dy = itemPosY[i] - y;
+        float dz = ((int)itemPosZ[i] - z) * CELL_SIZE;
         float dist = sqrtf(dx * dx + dy * dy + dz * dz);
         // Score: higher hydration, closer distance
         float score = hydration / (1.0f + dist / CELL_SIZE);
@@ -364,7 +364,7 @@ static bool FindNearestWaterCell(float x, float y, int z, int* outWaterX, int* o
 
 static void StartDrinkSearch(Mover* m, int moverIdx) {
     // Try to find a drinkable item (in stockpile, container, or on ground)
-    int itemIdx = FindBestDrinkableItem(m->x, m->y, (int)m->z);
+    int itemIdx = FindBestDrinkableItem(moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx]);
 
     if (itemIdx >= 0) {
         if (!ReserveItem(itemIdx, moverIdx)) {
@@ -380,26 +380,26 @@ static void StartDrinkSearch(Mover* m, int moverIdx) {
         // Set goal to item position (or container position if contained)
         float goalX, goalY;
         int goalZ;
-        if (items[itemIdx].containedIn >= 0 && items[items[itemIdx].containedIn].active) {
+        if (items[itemIdx].containedIn >= 0 && itemActive[items[itemIdx].containedIn]) {
             int ci = items[itemIdx].containedIn;
-            goalX = items[ci].x; goalY = items[ci].y; goalZ = (int)items[ci].z;
+            goalX = itemPosX[ci]; goalY = itemPosY[ci]; goalZ = (int)itemPosZ[ci];
         } else {
-            goalX = items[itemIdx].x; goalY = items[itemIdx].y; goalZ = (int)items[itemIdx].z;
+            goalX = itemPosX[itemIdx]; goalY = itemPosY[itemIdx]; goalZ = (int)itemPosZ[itemIdx];
         }
         m->goal = (Point){(int)(goalX / CELL_SIZE), (int)(goalY / CELL_SIZE), goalZ};
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         return;
     }
 
     // No items — try natural water
     int waterX, waterY, waterZ, standX, standY, standZ;
-    if (FindNearestWaterCell(m->x, m->y, (int)m->z, &waterX, &waterY, &waterZ, &standX, &standY, &standZ)) {
+    if (FindNearestWaterCell(moverPosX[moverIdx], moverPosY[moverIdx], (int)moverPosZ[moverIdx], &waterX, &waterY, &waterZ, &standX, &standY, &standZ)) {
         EventLog("Mover %d SEEKING_NATURAL_WATER at (%d,%d,%d) stand (%d,%d,%d)", moverIdx, waterX, waterY, waterZ, standX, standY, standZ);
         m->freetimeState = FREETIME_SEEKING_NATURAL_WATER;
         m->needTarget = waterX + waterY * gridWidth; // encode water cell position
         m->needProgress = 0.0f;
         m->goal = (Point){standX, standY, standZ};
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
         return;
     }
 
@@ -412,8 +412,8 @@ static void StartRestSearch(Mover* m, int moverIdx) {
     // Prefer highest restRate, weight by distance
     int bestIdx = -1;
     float bestScore = -1.0f;
-    float mx = m->x, my = m->y;
-    int mz = (int)m->z;
+    float mx = moverPosX[moverIdx], my = moverPosY[moverIdx];
+    int mz = (int)moverPosZ[moverIdx];
 
     for (int i = 0; i < MAX_FURNITURE; i++) {
         if (!furniture[i].active) continue;
@@ -447,16 +447,16 @@ static void StartRestSearch(Mover* m, int moverIdx) {
 
         // Set goal to furniture position
         m->goal = (Point){furniture[bestIdx].x, furniture[bestIdx].y, furniture[bestIdx].z};
-        m->needsRepath = true;
+        moverNeedsRepath[moverIdx] = true;
     } else {
         // No furniture available — ground rest at current position
         EventLog("Mover %d RESTING on ground", moverIdx);
         m->freetimeState = FREETIME_RESTING;
         m->needTarget = -1;
         m->needProgress = 0.0f;
-        m->pathLength = 0;
-        m->pathIndex = -1;
-        m->goal = (Point){(int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), mz};
+        moverPathLength[moverIdx] = 0;
+        moverPathIndex[moverIdx] = -1;
+        m->goal = (Point){(int)(moverPosX[moverIdx] / CELL_SIZE), (int)(moverPosY[moverIdx] / CELL_SIZE), mz};
     }
 }
 
@@ -481,7 +481,7 @@ static bool IsGoodDrink(ItemType type) {
 static void ProcessMoverFreetime(Mover* m, int moverIdx) {
     // Cancel food-seeking if hunger disabled
     if (!hungerEnabled && (m->freetimeState == FREETIME_SEEKING_FOOD || m->freetimeState == FREETIME_EATING)) {
-        if (m->needTarget >= 0 && m->needTarget < MAX_ITEMS && items[m->needTarget].reservedBy == moverIdx) {
+        if (m->needTarget >= 0 && m->needTarget < MAX_ITEMS && itemReservedBy[m->needTarget] == moverIdx) {
             ReleaseItemReservation(m->needTarget);
         }
         m->freetimeState = FREETIME_NONE;
@@ -492,7 +492,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
                            m->freetimeState == FREETIME_SEEKING_NATURAL_WATER || m->freetimeState == FREETIME_DRINKING_NATURAL)) {
         if (m->needTarget >= 0 && m->needTarget < MAX_ITEMS &&
             (m->freetimeState == FREETIME_SEEKING_DRINK || m->freetimeState == FREETIME_DRINKING) &&
-            items[m->needTarget].reservedBy == moverIdx) {
+            itemReservedBy[m->needTarget] == moverIdx) {
             ReleaseItemReservation(m->needTarget);
         }
         m->freetimeState = FREETIME_NONE;
@@ -517,7 +517,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
     // This catches cases where needTarget was cleared but reservedBy wasn't.
     if (m->freetimeState == FREETIME_NONE && m->currentJobId < 0) {
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].reservedBy == moverIdx) {
+            if (itemActive[i] && itemReservedBy[i] == moverIdx) {
                 ReleaseItemReservation(i);
             }
         }
@@ -585,9 +585,9 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
         case FREETIME_SEEKING_FOOD: {
             // Validate target still exists and is reserved by us
             int ti = m->needTarget;
-            if (ti < 0 || ti >= MAX_ITEMS || !items[ti].active || items[ti].reservedBy != moverIdx) {
+            if (ti < 0 || ti >= MAX_ITEMS || !itemActive[ti] || itemReservedBy[ti] != moverIdx) {
                 // Target gone — release and reset
-                if (ti >= 0 && ti < MAX_ITEMS && items[ti].reservedBy == moverIdx) {
+                if (ti >= 0 && ti < MAX_ITEMS && itemReservedBy[ti] == moverIdx) {
                     ReleaseItemReservation(ti);
                 }
                 m->freetimeState = FREETIME_NONE;
@@ -597,18 +597,18 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
             }
 
             // Check if arrived at food
-            float dx = m->x - items[ti].x;
-            float dy = m->y - items[ti].y;
+            float dx = moverPosX[moverIdx] - itemPosX[ti];
+            float dy = moverPosY[moverIdx] - itemPosY[ti];
             float distSq = dx * dx + dy * dy;
             float pickupR = CELL_SIZE * 0.75f;
 
-            if ((int)m->z == (int)items[ti].z && distSq < pickupR * pickupR) {
+            if ((int)moverPosZ[moverIdx] == (int)itemPosZ[ti] && distSq < pickupR * pickupR) {
                 // Arrived — start eating
                 m->freetimeState = FREETIME_EATING;
                 m->needProgress = 0.0f;
                 // Clear path so mover stops
-                m->pathLength = 0;
-                m->pathIndex = -1;
+                moverPathLength[moverIdx] = 0;
+                moverPathIndex[moverIdx] = -1;
                 break;
             }
 
@@ -625,7 +625,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
 
         case FREETIME_EATING: {
             int ti = m->needTarget;
-            if (ti < 0 || ti >= MAX_ITEMS || !items[ti].active) {
+            if (ti < 0 || ti >= MAX_ITEMS || !itemActive[ti]) {
                 m->freetimeState = FREETIME_NONE;
                 m->needTarget = -1;
                 break;
@@ -649,9 +649,9 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
                 // Mood: ate at table vs without table
                 // Check if mover is in a room with a chair (future: require table furniture)
                 {
-                    int cx = (int)(m->x / CELL_SIZE);
-                    int cy = (int)(m->y / CELL_SIZE);
-                    int cz = (int)m->z;
+                    int cx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+                    int cy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+                    int cz = (int)moverPosZ[moverIdx];
                     uint16_t rid = GetRoomAt(cx, cy, cz);
                     DetectedRoom* room = GetRoom(rid);
                     if (room && room->chairCount > 0) {
@@ -668,7 +668,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
 
                 // Consume one from stack, or delete if last
                 if (items[ti].stackCount > 1) {
-                    items[ti].stackCount--;
+                    SetItemStackCount(ti, items[ti].stackCount - 1);
                 } else {
                     DeleteItem(ti);
                 }
@@ -694,9 +694,9 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
                 }
 
                 // Check arrival — on the furniture cell, or adjacent if blocking
-                int moverCellX = (int)(m->x / CELL_SIZE);
-                int moverCellY = (int)(m->y / CELL_SIZE);
-                int moverCellZ = (int)m->z;
+                int moverCellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+                int moverCellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+                int moverCellZ = (int)moverPosZ[moverIdx];
                 const FurnitureDef* fdef = GetFurnitureDef(furniture[fi].type);
                 bool onCell = (moverCellX == furniture[fi].x && moverCellY == furniture[fi].y && moverCellZ == furniture[fi].z);
                 bool adjacent = (moverCellZ == furniture[fi].z &&
@@ -705,12 +705,12 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
 
                 if (arrived) {
                     // Snap to furniture cell center
-                    m->x = furniture[fi].x * CELL_SIZE + CELL_SIZE / 2.0f;
-                    m->y = furniture[fi].y * CELL_SIZE + CELL_SIZE / 2.0f;
+                    moverPosX[moverIdx] = furniture[fi].x * CELL_SIZE + CELL_SIZE / 2.0f;
+                    moverPosY[moverIdx] = furniture[fi].y * CELL_SIZE + CELL_SIZE / 2.0f;
                     m->freetimeState = FREETIME_RESTING;
                     m->needProgress = 0.0f;
-                    m->pathLength = 0;
-                    m->pathIndex = -1;
+                    moverPathLength[moverIdx] = 0;
+                    moverPathIndex[moverIdx] = -1;
                     break;
                 }
             }
@@ -780,14 +780,14 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
             }
 
             // Check arrival (within 1 cell of goal)
-            int mx = (int)(m->x / CELL_SIZE);
-            int my = (int)(m->y / CELL_SIZE);
-            if ((int)m->z == m->goal.z && abs(mx - m->goal.x) <= 1 && abs(my - m->goal.y) <= 1) {
+            int mx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+            int my = (int)(moverPosY[moverIdx] / CELL_SIZE);
+            if ((int)moverPosZ[moverIdx] == m->goal.z && abs(mx - m->goal.x) <= 1 && abs(my - m->goal.y) <= 1) {
                 EventLog("Mover %d WARMING at workshop %d", moverIdx, wi);
                 m->freetimeState = FREETIME_WARMING;
                 m->needProgress = 0.0f;
-                m->pathLength = 0;
-                m->pathIndex = -1;
+                moverPathLength[moverIdx] = 0;
+                moverPathIndex[moverIdx] = -1;
                 break;
             }
 
@@ -825,8 +825,8 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
         case FREETIME_SEEKING_DRINK: {
             // Validate target still exists and is reserved by us
             int ti = m->needTarget;
-            if (ti < 0 || ti >= MAX_ITEMS || !items[ti].active || items[ti].reservedBy != moverIdx) {
-                if (ti >= 0 && ti < MAX_ITEMS && items[ti].reservedBy == moverIdx) {
+            if (ti < 0 || ti >= MAX_ITEMS || !itemActive[ti] || itemReservedBy[ti] != moverIdx) {
+                if (ti >= 0 && ti < MAX_ITEMS && itemReservedBy[ti] == moverIdx) {
                     ReleaseItemReservation(ti);
                 }
                 m->freetimeState = FREETIME_NONE;
@@ -838,25 +838,25 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
             // Get target position (item or its container)
             float targetX, targetY;
             int targetZ;
-            if (items[ti].containedIn >= 0 && items[items[ti].containedIn].active) {
+            if (items[ti].containedIn >= 0 && itemActive[items[ti].containedIn]) {
                 int ci = items[ti].containedIn;
-                targetX = items[ci].x; targetY = items[ci].y; targetZ = (int)items[ci].z;
+                targetX = itemPosX[ci]; targetY = itemPosY[ci]; targetZ = (int)itemPosZ[ci];
             } else {
-                targetX = items[ti].x; targetY = items[ti].y; targetZ = (int)items[ti].z;
+                targetX = itemPosX[ti]; targetY = itemPosY[ti]; targetZ = (int)itemPosZ[ti];
             }
 
             // Check if arrived
-            float dx = m->x - targetX;
-            float dy = m->y - targetY;
+            float dx = moverPosX[moverIdx] - targetX;
+            float dy = moverPosY[moverIdx] - targetY;
             float distSq = dx * dx + dy * dy;
             float pickupR = CELL_SIZE * 0.75f;
 
-            if ((int)m->z == targetZ && distSq < pickupR * pickupR) {
+            if ((int)moverPosZ[moverIdx] == targetZ && distSq < pickupR * pickupR) {
                 // Arrived — start drinking
                 m->freetimeState = FREETIME_DRINKING;
                 m->needProgress = 0.0f;
-                m->pathLength = 0;
-                m->pathIndex = -1;
+                moverPathLength[moverIdx] = 0;
+                moverPathIndex[moverIdx] = -1;
                 break;
             }
 
@@ -873,7 +873,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
 
         case FREETIME_DRINKING: {
             int ti = m->needTarget;
-            if (ti < 0 || ti >= MAX_ITEMS || !items[ti].active) {
+            if (ti < 0 || ti >= MAX_ITEMS || !itemActive[ti]) {
                 m->freetimeState = FREETIME_NONE;
                 m->needTarget = -1;
                 break;
@@ -892,7 +892,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
                 if (IsGoodDrink(items[ti].type)) AddMoodlet(m, MOODLET_DRANK_GOOD);
                 if (items[ti].temperature >= 40.0f) AddMoodlet(m, MOODLET_HOT_MEAL);
                 if (items[ti].stackCount > 1) {
-                    items[ti].stackCount--;
+                    SetItemStackCount(ti, items[ti].stackCount - 1);
                 } else {
                     DeleteItem(ti);
                 }
@@ -910,7 +910,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
             int waterY = m->needTarget / gridWidth;
 
             // Validate water still exists (check mover z and z-1 for walled ponds)
-            int mz = (int)m->z;
+            int mz = (int)moverPosZ[moverIdx];
             if (!HasWater(waterX, waterY, mz) && !(mz > 0 && HasWater(waterX, waterY, mz - 1))) {
                 m->freetimeState = FREETIME_NONE;
                 m->needTarget = -1;
@@ -919,14 +919,14 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
             }
 
             // Check arrival (within 1 cell of goal — we're standing adjacent to water)
-            int mx = (int)(m->x / CELL_SIZE);
-            int my = (int)(m->y / CELL_SIZE);
-            if ((int)m->z == m->goal.z && abs(mx - m->goal.x) <= 1 && abs(my - m->goal.y) <= 1) {
+            int mx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+            int my = (int)(moverPosY[moverIdx] / CELL_SIZE);
+            if ((int)moverPosZ[moverIdx] == m->goal.z && abs(mx - m->goal.x) <= 1 && abs(my - m->goal.y) <= 1) {
                 EventLog("Mover %d DRINKING_NATURAL at (%d,%d)", moverIdx, waterX, waterY);
                 m->freetimeState = FREETIME_DRINKING_NATURAL;
                 m->needProgress = 0.0f;
-                m->pathLength = 0;
-                m->pathIndex = -1;
+                moverPathLength[moverIdx] = 0;
+                moverPathIndex[moverIdx] = -1;
                 break;
             }
 
@@ -982,7 +982,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
                 break;
             }
             int tx = furniture[fi].x, ty = furniture[fi].y;
-            int mx = (int)(m->x / CELL_SIZE), my = (int)(m->y / CELL_SIZE);
+            int mx = (int)(moverPosX[moverIdx] / CELL_SIZE), my = (int)(moverPosY[moverIdx] / CELL_SIZE);
             if (abs(mx - tx) <= 1 && abs(my - ty) <= 1) {
                 m->freetimeState = FREETIME_USING_TOILET;
                 m->needProgress = 0.0f;
@@ -1015,7 +1015,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
                 m->needSearchCooldown = GameHoursToGameSeconds(balance.bladderSearchCooldownGH);
                 break;
             }
-            int mx = (int)(m->x / CELL_SIZE), my = (int)(m->y / CELL_SIZE);
+            int mx = (int)(moverPosX[moverIdx] / CELL_SIZE), my = (int)(moverPosY[moverIdx] / CELL_SIZE);
             if (abs(mx - targetX) <= 1 && abs(my - targetY) <= 1) {
                 m->freetimeState = FREETIME_USING_BUSH;
                 m->needProgress = 0.0f;
@@ -1043,11 +1043,11 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
         m->freetimeState != FREETIME_USING_BUSH) {
         m->bladder = 1.0f;
         AddMoodlet(m, MOODLET_NO_TOILET);
-        int dx = (int)(m->x / CELL_SIZE);
-        int dy = (int)(m->y / CELL_SIZE);
-        int dz = (int)m->z;
+        int dx = (int)(moverPosX[moverIdx] / CELL_SIZE);
+        int dy = (int)(moverPosY[moverIdx] / CELL_SIZE);
+        int dz = (int)moverPosZ[moverIdx];
         if (dx >= 0 && dx < gridWidth && dy >= 0 && dy < gridHeight && dz >= 0 && dz < gridDepth) {
-            if (floorDirtGrid[dz][dy][dx] < 200) floorDirtGrid[dz][dy][dx] += 50;
+            if (FloorDirtAt(dx, dy, dz) < 200) SetFloorDirt(dx, dy, dz, FloorDirtAt(dx, dy, dz) + 50);
         }
     }
 }
@@ -1055,7 +1055,7 @@ static void ProcessMoverFreetime(Mover* m, int moverIdx) {
 void ProcessFreetimeNeeds(void) {
     for (int i = 0; i < moverCount; i++) {
         Mover* m = &movers[i];
-        if (!m->active) continue;
+        if (!moverActive[i]) continue;
         ProcessMoverFreetime(m, i);
     }
 }
@@ -5,6 +5,7 @@
 #include "plants.h"
 #include "balance.h"
 #include "weather.h"
+#include "area_sums.h"
 #include "../entities/items.h"
 #include "../entities/mover.h"  // CELL_SIZE
 #include <string.h>
@@ -34,6 +35,7 @@ void InitPlants(void) {
 void ClearPlants(void) {
     memset(plants, 0, sizeof(plants));
     plantCount = 0;
+    InvalidateAreaLayer(AREA_LAYER_BEAUTY);
 }
 
 int SpawnPlant(int x, int y, int z, PlantType type) {
@@ -48,6 +50,7 @@ int SpawnPlant(int x, int y, int z, PlantType type) {
             plants[i].growthProgress = 0.0f;
             plants[i].active = true;
             if (i >= plantCount) plantCount = i + 1;
+            MarkAreaSumsDirty(x, y, z);
             return i;
         }
     }
@@ -57,6 +60,7 @@ int SpawnPlant(int x, int y, int z, PlantType type) {
 void DeletePlant(int idx) {
     if (idx < 0 || idx >= MAX_PLANTS) return;
     plants[idx].active = false;
+    MarkAreaSumsDirty(plants[idx].x, plants[idx].y, plants[idx].z);
 }
 
 Plant* GetPlantAt(int x, int y, int z) {
@@ -2,22 +2,34 @@
 //
 // Flood-fill BFS per z-level detects enclosed rooms bounded by walls/doors/windows.
 // Rooms are classified by furniture/workshop contents and scored for quality.
+//
+// Two update paths:
+//   - InvalidateRooms(): full recompute of every z-level (init, load, unknown changes)
+//   - InvalidateRoomsAt()/InvalidateRoomsInRect(): queue a dirty rect. UpdateRooms
+//     clears only the rooms touching it, re-floods from their old cells (handles
+//     splits and merges), and leaves every other room and its ID untouched.
+//   - InvalidateRoomContentsInRect(): contents changed (stockpiles) — rescan
+//     metadata of the rooms in the rect, no re-flood.
 
 #include "rooms.h"
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
+#include "../world/cell_edits.h"
 #include "../world/material.h"
 #include "../entities/furniture.h"
 #include "../entities/workshops.h"
 #include "../entities/stockpiles.h"
 #include "lighting.h"
 #include "floordirt.h"
+#include "area_sums.h"
 
-uint16_t roomGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(uint16_t, roomGrid);
 DetectedRoom rooms[MAX_DETECTED_ROOMS];
 int roomCount = 0;
 bool roomsDirty = true;
 bool roomsEnabled = true;
+int roomsFullRecomputeCount = 0;
+int roomsIncrementalUpdateCount = 0;
 
 // --- BFS data (reused per z-level) ---
 
@@ -25,8 +37,31 @@ typedef struct { int x, y; } RoomBfsNode;
 #define ROOM_BFS_MAX (MAX_GRID_WIDTH * MAX_GRID_HEIGHT)
 static RoomBfsNode roomBfsQueue[ROOM_BFS_MAX];
 static RoomBfsNode roomCellBuffer[ROOM_BFS_MAX];
-// Visited grid per z-level (marks cells we've already processed)
-static bool visited[MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+static RoomBfsNode roomSeedBuffer[ROOM_BFS_MAX];
+static RoomBfsNode roomDoorBuffer[ROOM_BFS_MAX];
+// Visited stamps per z-level: a cell is visited in the current pass when its
+// stamp is >= passStartSerial. Each flood gets its own serial so incremental
+// floods can tell "reached a cell an earlier (outdoor) flood stopped in".
+static uint32_t visitSerial[MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+static uint32_t floodSerial = 0;
+static uint32_t passStartSerial = 1;
+
+// --- Pending incremental work ---
+
+typedef struct {
+    int x0, y0, x1, y1, z;   // inclusive, clamped to grid
+    bool structural;         // false = contents only (no re-flood)
+} RoomDirtyRect;
+
+#define MAX_ROOM_DIRTY_RECTS 256
+static RoomDirtyRect roomDirtyRects[MAX_ROOM_DIRTY_RECTS];
+static int roomDirtyRectCount = 0;
+static bool roomsNeedFullRecompute = true;
+
+// Per-room flags while applying dirty rects
+#define ROOM_MARK_REFLOOD 1
+#define ROOM_MARK_RESCAN  2
+static uint8_t roomMark[MAX_DETECTED_ROOMS];
 
 // --- Helpers ---
 
@@ -57,28 +92,34 @@ static bool IsBedFurniture(FurnitureType type) {
            type == FURNITURE_GRASS_PILE;
 }
 
-static float ComputeLightLevel(int x, int y, int z) {
-    // Combine sky light and block light into a 0-15 scale
-    float sky = (float)lightGrid[z][y][x].skyLevel;
-    float blockMax = lightGrid[z][y][x].blockR;
-    if (lightGrid[z][y][x].blockG > blockMax) blockMax = lightGrid[z][y][x].blockG;
-    if (lightGrid[z][y][x].blockB > blockMax) blockMax = lightGrid[z][y][x].blockB;
-    float block = blockMax / 255.0f * 15.0f;
-    return sky > block ? sky : block;
+// --- Flood fill ---
+
+static inline bool IsVisited(int x, int y) {
+    return visitSerial[y][x] >= passStartSerial;
 }
 
-// --- Flood fill ---
+// Start a new visit pass (all cells become unvisited)
+static void BeginVisitPass(void) {
+    if (floodSerial > UINT32_MAX - ROOM_BFS_MAX) {
+        memset(visitSerial, 0, sizeof(visitSerial));
+        floodSerial = 0;
+    }
+    passStartSerial = ++floodSerial;
+}
 
 // BFS flood fill from seed (sx, sy) at z-level.
 // Returns number of cells found. Sets touchedEdge if flood reaches grid boundary.
-// Cells written to roomCellBuffer[0..n-1]. Marks visited[][].
-static int FloodFill(int sx, int sy, int z, bool *touchedEdge) {
+// Cells written to roomCellBuffer[0..n-1]. Stamps visitSerial[][].
+// With stopAtEdge, returns as soon as the space is known to be open (the
+// incremental path doesn't need the full extent of outdoor areas).
+static int FloodFill(int sx, int sy, int z, bool stopAtEdge, bool *touchedEdge) {
     int cellCount = 0;
     int qHead = 0, qTail = 0;
+    uint32_t serial = ++floodSerial;
     *touchedEdge = false;
 
     roomBfsQueue[qTail++] = (RoomBfsNode){sx, sy};
-    visited[sy][sx] = true;
+    visitSerial[sy][sx] = serial;
 
     while (qHead < qTail) {
         RoomBfsNode cur = roomBfsQueue[qHead++];
@@ -88,6 +129,7 @@ static int FloodFill(int sx, int sy, int z, bool *touchedEdge) {
         if (cur.x == 0 || cur.x == gridWidth - 1 ||
             cur.y == 0 || cur.y == gridHeight - 1) {
             *touchedEdge = true;
+            if (stopAtEdge) return cellCount;
         }
 
         // Expand to 4 cardinal neighbors
@@ -99,9 +141,18 @@ static int FloodFill(int sx, int sy, int z, bool *touchedEdge) {
 
             if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) {
                 *touchedEdge = true;
+                if (stopAtEdge) return cellCount;
+                continue;
+            }
+            if (IsVisited(nx, ny)) {
+                // Only an earlier flood that stopped at the edge can leave
+                // stamps reachable from here — so this space is open too
+                if (stopAtEdge && visitSerial[ny][nx] != serial) {
+                    *touchedEdge = true;
+                    return cellCount;
+                }
                 continue;
             }
-            if (visited[ny][nx]) continue;
 
             CellType cell = grid[z][ny][nx];
 
@@ -117,7 +168,7 @@ static int FloodFill(int sx, int sy, int z, bool *touchedEdge) {
             // Walkable cell — must actually be walkable (has support)
             if (!IsCellWalkableAt(z, ny, nx)) continue;
 
-            visited[ny][nx] = true;
+            visitSerial[ny][nx] = serial;
             roomBfsQueue[qTail++] = (RoomBfsNode){nx, ny};
         }
     }
@@ -204,8 +255,21 @@ static void ScanRoomCells(uint16_t roomId, int z, RoomBfsNode *cells, int cellCo
     room->cellCount = cellCount;
     room->active = true;
 
-    // Accumulate quality inputs
-    float totalLight = 0.0f;
+    // Bounding box: a rectangular room (the common built case) gets its light
+    // total from the light summed-area table instead of per-cell reads
+    int minX = cells[0].x, maxX = cells[0].x, minY = cells[0].y, maxY = cells[0].y;
+    for (int i = 1; i < cellCount; i++) {
+        if (cells[i].x < minX) minX = cells[i].x;
+        if (cells[i].x > maxX) maxX = cells[i].x;
+        if (cells[i].y < minY) minY = cells[i].y;
+        if (cells[i].y > maxY) maxY = cells[i].y;
+    }
+    bool rectangular = (maxX - minX + 1) * (maxY - minY + 1) == cellCount;
+    room->minX = minX; room->maxX = maxX;
+    room->minY = minY; room->maxY = maxY;
+
+    // Accumulate quality inputs (light in AREA_LIGHT_SCALE units)
+    int totalLight = rectangular ? AreaSumRect(AREA_LAYER_LIGHT, minX, minY, maxX, maxY, z) : 0;
     float totalDirt = 0.0f;
     int constructedFloors = 0;
     int totalWallNeighbors = 0;
@@ -220,11 +284,11 @@ static void ScanRoomCells(uint16_t roomId, int z, RoomBfsNode *cells, int cellCo
         int cx = cells[i].x;
         int cy = cells[i].y;
 
-        // Light
-        totalLight += ComputeLightLevel(cx, cy, z);
+        // Light (combined sky/block level, see AreaLightValue)
+        if (!rectangular) totalLight += AreaLightValue(cx, cy, z);
 
         // Floor dirt
-        totalDirt += (float)floorDirtGrid[z][cy][cx];
+        totalDirt += (float)FloorDirtAt(cx, cy, z);
 
         // Constructed floor check
         if (HAS_FLOOR(cx, cy, z) && !IsFloorNatural(cx, cy, z)) {
@@ -278,7 +342,8 @@ static void ScanRoomCells(uint16_t roomId, int z, RoomBfsNode *cells, int cellCo
         }
     }
 
-    room->avgLight = cellCount > 0 ? totalLight / (float)cellCount : 0.0f;
+    room->avgLight = cellCount > 0
+        ? (float)totalLight / (float)AREA_LIGHT_SCALE / (float)cellCount : 0.0f;
     room->avgDirt = cellCount > 0 ? totalDirt / (float)cellCount : 0.0f;
     room->constructedFloorFrac = cellCount > 0 ? (float)constructedFloors / (float)cellCount : 0.0f;
     room->constructedWallFrac = totalWallNeighbors > 0
@@ -315,38 +380,66 @@ static void ScanRoomCells(uint16_t roomId, int z, RoomBfsNode *cells, int cellCo
     room->quality = ComputeQuality(room);
 }
 
+// --- Door assignment ---
+
+static const int roomDx[] = {1, -1, 0, 0};
+static const int roomDy[] = {0, 0, 1, -1};
+
+// Assign an unassigned door cell to its first adjacent room (if any)
+static void AssignDoorCell(int x, int y, int z) {
+    if (grid[z][y][x] != CELL_DOOR) return;
+    if (roomGrid[z][y][x] != ROOM_NONE) return;
+
+    for (int d = 0; d < 4; d++) {
+        int nx = x + roomDx[d];
+        int ny = y + roomDy[d];
+        if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
+        uint16_t adj = roomGrid[z][ny][nx];
+        if (adj != ROOM_NONE) {
+            DetectedRoom *r = &rooms[adj];
+            roomGrid[z][y][x] = adj;
+            r->cellCount++;
+            if (x < r->minX) r->minX = x;
+            if (x > r->maxX) r->maxX = x;
+            if (y < r->minY) r->minY = y;
+            if (y > r->maxY) r->maxY = y;
+            break;
+        }
+    }
+}
+
 // --- Main recompute ---
 
 static void RecomputeRooms(void) {
-    memset(roomGrid, 0, sizeof(roomGrid));
+    CLEAR_WORLD_LAYER(roomGrid);
     memset(rooms, 0, sizeof(rooms));
     roomCount = 0;
 
     for (int z = 0; z < gridDepth; z++) {
-        memset(visited, 0, sizeof(visited));
+        BeginVisitPass();
 
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
-                if (visited[y][x]) continue;
+                if (IsVisited(x, y)) continue;
 
                 CellType cell = grid[z][y][x];
 
                 // Skip walls/windows/doors — walls and windows aren't rooms,
                 // doors are assigned in a post-pass
                 if (CellBlocksMovement(cell) || cell == CELL_DOOR) {
-                    visited[y][x] = true;
+                    visitSerial[y][x] = passStartSerial;
                     continue;
                 }
 
                 // Skip non-walkable cells (no support)
                 if (!IsCellWalkableAt(z, y, x)) {
-                    visited[y][x] = true;
+                    visitSerial[y][x] = passStartSerial;
                     continue;
                 }
 
                 // Flood fill from this cell
                 bool touchedEdge = false;
-                int count = FloodFill(x, y, z, &touchedEdge);
+                int count = FloodFill(x, y, z, false, &touchedEdge);
 
                 // If flood reached grid edge, it's outdoors — skip
                 if (touchedEdge) continue;
@@ -354,8 +447,8 @@ static void RecomputeRooms(void) {
                 // Too few cells — not a real room (need at least 1 interior cell)
                 if (count < 1) continue;
 
-                // Assign room ID
-                if (roomCount >= MAX_DETECTED_ROOMS) continue;
+                // Assign room ID (rooms[] is indexed 1..MAX_DETECTED_ROOMS-1)
+                if (roomCount >= MAX_DETECTED_ROOMS - 1) continue;
                 uint16_t roomId = (uint16_t)(roomCount + 1); // 1-based
                 roomCount++;
 
@@ -372,44 +465,245 @@ static void RecomputeRooms(void) {
         // Post-pass: assign door cells to an adjacent room
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
-                if (grid[z][y][x] != CELL_DOOR) continue;
+                AssignDoorCell(x, y, z);
+            }
+        }
+    }
+    roomsFullRecomputeCount++;
+}
+
+// --- Incremental update ---
+
+// Lowest free room slot, or ROOM_NONE if the table is full
+static uint16_t AllocRoomId(void) {
+    for (int id = 1; id <= roomCount; id++) {
+        if (!rooms[id].active) return (uint16_t)id;
+    }
+    if (roomCount >= MAX_DETECTED_ROOMS - 1) return ROOM_NONE;
+    roomCount++;
+    return (uint16_t)roomCount;
+}
+
+// Collect a room's cells from its bounding box. Non-door cells go to
+// roomCellBuffer, door cells to roomDoorBuffer[doorStart..]. Returns cell count.
+static int CollectRoomCells(uint16_t roomId, int *doorCount, int doorStart) {
+    DetectedRoom *r = &rooms[roomId];
+    int z = r->z;
+    int n = 0;
+    for (int y = r->minY; y <= r->maxY; y++) {
+        for (int x = r->minX; x <= r->maxX; x++) {
+            if (roomGrid[z][y][x] != roomId) continue;
+            if (grid[z][y][x] == CELL_DOOR) {
+                roomDoorBuffer[doorStart + (*doorCount)++] = (RoomBfsNode){x, y};
+            } else {
+                roomCellBuffer[n++] = (RoomBfsNode){x, y};
+            }
+        }
+    }
+    return n;
+}
+
+// Re-scan metadata of an existing room whose contents changed (same cells)
+static void RescanRoom(uint16_t roomId) {
+    DetectedRoom *r = &rooms[roomId];
+    int z = r->z;
+    int minX = r->minX, maxX = r->maxX, minY = r->minY, maxY = r->maxY;
+    int doorCount = 0;
+    int n = CollectRoomCells(roomId, &doorCount, 0);
+    memset(r, 0, sizeof(*r));
+    if (n == 0) return;
+    ScanRoomCells(roomId, z, roomCellBuffer, n);
+    r->cellCount += doorCount;
+    r->minX = minX; r->maxX = maxX;
+    r->minY = minY; r->maxY = maxY;
+}
+
+// Re-flood one z-level after structural changes. Rooms marked ROOM_MARK_REFLOOD
+// on this level are dissolved and their cells re-flooded together with the
+// dirty rects' own cells. Returns false if the room grid turned out to be
+// inconsistent (caller falls back to a full recompute).
+static bool RefloodLevel(int z) {
+    int seedCount = 0;
+    int doorCount = 0;
+
+    // Dissolve affected rooms; their cells become seeds, their doors get reassigned
+    for (int id = 1; id <= roomCount; id++) {
+        if (!(roomMark[id] & ROOM_MARK_REFLOOD) || rooms[id].z != z || !rooms[id].active) continue;
+        int n = CollectRoomCells((uint16_t)id, &doorCount, doorCount);
+        for (int i = 0; i < n; i++) {
+            roomGrid[z][roomCellBuffer[i].y][roomCellBuffer[i].x] = ROOM_NONE;
+            roomSeedBuffer[seedCount++] = roomCellBuffer[i];
+        }
+        memset(&rooms[id], 0, sizeof(rooms[id]));
+        roomMark[id] = 0;
+    }
+    for (int i = 0; i < doorCount; i++) {
+        roomGrid[z][roomDoorBuffer[i].y][roomDoorBuffer[i].x] = ROOM_NONE;
+    }
+
+    // Cells inside the dirty rects (expanded by 1) may have become walkable
+    for (int r = 0; r < roomDirtyRectCount; r++) {
+        RoomDirtyRect *dr = &roomDirtyRects[r];
+        if (!dr->structural || (dr->z != z && dr->z + 1 != z)) continue;
+        int x0 = dr->x0 > 0 ? dr->x0 - 1 : 0;
+        int y0 = dr->y0 > 0 ? dr->y0 - 1 : 0;
+        int x1 = dr->x1 < gridWidth - 1 ? dr->x1 + 1 : gridWidth - 1;
+        int y1 = dr->y1 < gridHeight - 1 ? dr->y1 + 1 : gridHeight - 1;
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
                 if (roomGrid[z][y][x] != ROOM_NONE) continue;
+                if (grid[z][y][x] == CELL_DOOR) {
+                    if (doorCount < ROOM_BFS_MAX) roomDoorBuffer[doorCount++] = (RoomBfsNode){x, y};
+                } else if (seedCount < ROOM_BFS_MAX) {
+                    roomSeedBuffer[seedCount++] = (RoomBfsNode){x, y};
+                }
+            }
+        }
+    }
 
-                // Find first adjacent room
-                static const int dx[] = {1, -1, 0, 0};
-                static const int dy[] = {0, 0, 1, -1};
-                for (int d = 0; d < 4; d++) {
-                    int nx = x + dx[d];
-                    int ny = y + dy[d];
-                    if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
-                    uint16_t adj = roomGrid[z][ny][nx];
-                    if (adj != ROOM_NONE) {
-                        roomGrid[z][y][x] = adj;
-                        rooms[adj].cellCount++;
-                        break;
-                    }
+    BeginVisitPass();
+    for (int s = 0; s < seedCount; s++) {
+        int x = roomSeedBuffer[s].x, y = roomSeedBuffer[s].y;
+        if (IsVisited(x, y)) continue;
+        CellType cell = grid[z][y][x];
+        if (CellBlocksMovement(cell) || cell == CELL_DOOR) continue;
+        if (!IsCellWalkableAt(z, y, x)) continue;
+
+        bool touchedEdge = false;
+        int count = FloodFill(x, y, z, true, &touchedEdge);
+        if (touchedEdge) continue;
+
+        // Reaching a live room means that room should have been dissolved too
+        for (int i = 0; i < count; i++) {
+            if (roomGrid[z][roomCellBuffer[i].y][roomCellBuffer[i].x] != ROOM_NONE) return false;
+        }
+
+        uint16_t roomId = AllocRoomId();
+        if (roomId == ROOM_NONE) continue;
+        memset(&rooms[roomId], 0, sizeof(rooms[roomId]));
+        for (int i = 0; i < count; i++) {
+            roomGrid[z][roomCellBuffer[i].y][roomCellBuffer[i].x] = roomId;
+        }
+        ScanRoomCells(roomId, z, roomCellBuffer, count);
+
+        // Doors bordering the new room (it may have been outdoors before)
+        for (int i = 0; i < count && doorCount < ROOM_BFS_MAX; i++) {
+            for (int d = 0; d < 4; d++) {
+                int nx = roomCellBuffer[i].x + roomDx[d];
+                int ny = roomCellBuffer[i].y + roomDy[d];
+                if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
+                if (grid[z][ny][nx] == CELL_DOOR && roomGrid[z][ny][nx] == ROOM_NONE &&
+                    doorCount < ROOM_BFS_MAX) {
+                    roomDoorBuffer[doorCount++] = (RoomBfsNode){nx, ny};
                 }
             }
         }
     }
+
+    for (int i = 0; i < doorCount; i++) {
+        AssignDoorCell(roomDoorBuffer[i].x, roomDoorBuffer[i].y, z);
+    }
+    return true;
+}
+
+// Mark rooms inside a rect (optionally expanded by one cell) at level z
+static void MarkRoomsInRect(const RoomDirtyRect *dr, int z, int grow, uint8_t mark, bool *levelHasWork) {
+    if (z < 0 || z >= gridDepth) return;
+    int x0 = dr->x0 - grow, y0 = dr->y0 - grow;
+    int x1 = dr->x1 + grow, y1 = dr->y1 + grow;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= gridWidth) x1 = gridWidth - 1;
+    if (y1 >= gridHeight) y1 = gridHeight - 1;
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            uint16_t id = roomGrid[z][y][x];
+            if (id != ROOM_NONE) roomMark[id] |= mark;
+        }
+    }
+    if (mark == ROOM_MARK_REFLOOD) levelHasWork[z] = true;
+}
+
+static bool ApplyRoomDirtyRects(void) {
+    bool levelHasWork[MAX_GRID_DEPTH] = {0};
+    memset(roomMark, 0, sizeof(roomMark));
+
+    for (int r = 0; r < roomDirtyRectCount; r++) {
+        RoomDirtyRect *dr = &roomDirtyRects[r];
+        if (dr->structural) {
+            // A cell change also flips walkability (support) of the cell above
+            MarkRoomsInRect(dr, dr->z, 1, ROOM_MARK_REFLOOD, levelHasWork);
+            MarkRoomsInRect(dr, dr->z + 1, 1, ROOM_MARK_REFLOOD, levelHasWork);
+        } else {
+            MarkRoomsInRect(dr, dr->z, 0, ROOM_MARK_RESCAN, levelHasWork);
+        }
+    }
+
+    for (int z = 0; z < gridDepth; z++) {
+        if (levelHasWork[z] && !RefloodLevel(z)) return false;
+    }
+
+    // Contents-only changes: re-scan rooms that weren't rebuilt above
+    for (int id = 1; id <= roomCount; id++) {
+        if (roomMark[id] == ROOM_MARK_RESCAN && rooms[id].active) RescanRoom((uint16_t)id);
+    }
+    roomsIncrementalUpdateCount++;
+    return true;
+}
+
+static void AddRoomDirtyRect(int x, int y, int z, int w, int h, bool structural) {
+    roomsDirty = true;
+    if (roomsNeedFullRecompute) return;
+    if (z < 0 || z >= gridDepth || w <= 0 || h <= 0) return;
+    int x1 = x + w - 1, y1 = y + h - 1;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 >= gridWidth) x1 = gridWidth - 1;
+    if (y1 >= gridHeight) y1 = gridHeight - 1;
+    if (x > x1 || y > y1) return;
+    if (roomDirtyRectCount >= MAX_ROOM_DIRTY_RECTS) {
+        roomsNeedFullRecompute = true;
+        return;
+    }
+    roomDirtyRects[roomDirtyRectCount++] = (RoomDirtyRect){x, y, x1, y1, z, structural};
 }
 
 // --- Public API ---
 
 void InitRooms(void) {
-    memset(roomGrid, 0, sizeof(roomGrid));
+    CLEAR_WORLD_LAYER(roomGrid);
     memset(rooms, 0, sizeof(rooms));
     roomCount = 0;
     roomsDirty = true;
+    roomsNeedFullRecompute = true;
+    roomDirtyRectCount = 0;
 }
 
 void InvalidateRooms(void) {
     roomsDirty = true;
+    roomsNeedFullRecompute = true;
+}
+
+void InvalidateRoomsAt(int x, int y, int z) {
+    if (DeferCellEdit(x, y, z, CELL_EDIT_ROOMS)) return;
+    AddRoomDirtyRect(x, y, z, 1, 1, true);
+}
+
+void InvalidateRoomsInRect(int x, int y, int z, int w, int h) {
+    AddRoomDirtyRect(x, y, z, w, h, true);
+}
+
+void InvalidateRoomContentsInRect(int x, int y, int z, int w, int h) {
+    AddRoomDirtyRect(x, y, z, w, h, false);
 }
 
 void UpdateRooms(void) {
     if (!roomsEnabled || !roomsDirty) return;
-    RecomputeRooms();
+    if (roomsNeedFullRecompute || !ApplyRoomDirtyRects()) {
+        RecomputeRooms();
+    }
+    roomsNeedFullRecompute = false;
+    roomDirtyRectCount = 0;
     roomsDirty = false;
 }
 
@@ -5,8 +5,9 @@
 // Quality feeds into mood (MOODLET_NICE_ROOM / MOODLET_UGLY_ROOM).
 //
 // Usage:
-//   InvalidateRooms();              // call when walls/furniture/workshops change
-//   UpdateRooms();                  // in TickWithDt, recomputes if dirty
+//   InvalidateRoomsAt(x,y,z);       // call when a wall/door/floor/furniture cell changes
+//   InvalidateRooms();              // full recompute (init, load, unknown changes)
+//   UpdateRooms();                  // in TickWithDt, re-floods only what changed
 //   uint16_t rid = GetRoomAt(x,y,z);
 //   DetectedRoom* r = GetRoom(rid);  // NULL if no room
 
@@ -15,6 +16,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "../world/grid.h"
 
 #define MAX_DETECTED_ROOMS 1024
 #define ROOM_NONE 0   // 0 = no room (outdoors, wall, unenclosed)
@@ -52,10 +54,13 @@ typedef struct {
     float constructedFloorFrac;  // 0.0-1.0
     float constructedWallFrac;   // 0.0-1.0
     float avgDirt;               // 0-255
+
+    // Bounding box of the room's cells (doors included), for local re-floods
+    int minX, minY, maxX, maxY;
 } DetectedRoom;
 
 // Room grid: per-cell room ID (0 = no room)
-extern uint16_t roomGrid[16][512][512]; // [MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH]
+extern WORLD_LAYER(uint16_t, roomGrid);
 
 // Room metadata
 extern DetectedRoom rooms[MAX_DETECTED_ROOMS];
@@ -67,9 +72,16 @@ extern bool roomsDirty;
 // Master toggle
 extern bool roomsEnabled;
 
+// Update counters (for tests/profiling)
+extern int roomsFullRecomputeCount;
+extern int roomsIncrementalUpdateCount;
+
 // API
 void InitRooms(void);
 void InvalidateRooms(void);
+void InvalidateRoomsAt(int x, int y, int z);                          // structural cell change
+void InvalidateRoomsInRect(int x, int y, int z, int w, int h);        // structural, e.g. workshop footprint
+void InvalidateRoomContentsInRect(int x, int y, int z, int w, int h); // contents only (stockpiles)
 void UpdateRooms(void);
 uint16_t GetRoomAt(int x, int y, int z);
 DetectedRoom* GetRoom(uint16_t roomId);
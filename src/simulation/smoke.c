@@ -5,11 +5,16 @@
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
 #include "../core/time.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <stdlib.h>
 
-// Smoke grid storage
-SmokeCell smokeGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Smoke cell storage: a page is empty once no cell in it holds smoke
+static const SmokeCell emptySmoke = {0};
+static bool SmokeCellIsEmpty(const void* cell) {
+    return ((const SmokeCell*)cell)->level == 0;
+}
+DEFINE_PAGED_LAYER(SmokeCell, smokeLayer, &emptySmoke, SmokeCellIsEmpty);
 
 // Global state
 bool smokeEnabled = true;
@@ -33,11 +38,11 @@ static SmokePos smokePressureQueue[SMOKE_PRESSURE_SEARCH_LIMIT];
 
 // Generation counter for visited tracking (avoids expensive memset)
 static uint16_t smokePressureGeneration = 0;
-static uint16_t smokePressureVisited[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_STATIC_WORLD_LAYER(uint16_t, smokePressureVisited);
 
 // Track cells that have already risen this tick (prevents cascading through multiple z-levels)
 static uint16_t smokeRiseGeneration = 0;
-static uint16_t smokeHasRisen[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_STATIC_WORLD_LAYER(uint16_t, smokeHasRisen);
 
 // Initialize smoke system
 void InitSmoke(void) {
@@ -46,7 +51,7 @@ void InitSmoke(void) {
 
 // Clear all smoke
 void ClearSmoke(void) {
-    memset(smokeGrid, 0, sizeof(smokeGrid));
+    ClearPagedLayer(&smokeLayer);
     smokeUpdateCount = 0;
     smokeRiseAccum = 0.0f;
     smokeDissipationAccum = 0.0f;
@@ -59,12 +64,11 @@ void ResetSmokeAccumulators(void) {
     smokeDissipationAccum = 0.0f;
 
     // Also destabilize all cells so they get processed after load
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                smokeGrid[z][y][x].stable = false;
-            }
-        }
+    for (int i = 0; i < smokeLayer.allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(smokeLayer.allocated[i], &px, &py, &z);
+        SmokeCell* page = (SmokeCell*)PagedLayerPage(&smokeLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) page[c].stable = false;
     }
 }
 
@@ -82,21 +86,26 @@ static inline bool CanHoldSmoke(int x, int y, int z) {
     return CellAllowsFluids(cell);
 }
 
+// Cells of unallocated pages hold no smoke and are never scanned: leave them
+static inline void UnsettleSmokeCell(int x, int y, int z) {
+    if (!InBounds(x, y, z)) return;
+    if (!PagedLayerHasPage(&smokeLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) return;
+    SmokeCellForWrite(x, y, z)->stable = false;
+}
+
 // Mark cell and neighbors as unstable
 void DestabilizeSmoke(int x, int y, int z) {
-    if (InBounds(x, y, z)) {
-        smokeGrid[z][y][x].stable = false;
-    }
+    UnsettleSmokeCell(x, y, z);
 
     // 4 horizontal neighbors
-    if (InBounds(x-1, y, z)) smokeGrid[z][y][x-1].stable = false;
-    if (InBounds(x+1, y, z)) smokeGrid[z][y][x+1].stable = false;
-    if (InBounds(x, y-1, z)) smokeGrid[z][y-1][x].stable = false;
-    if (InBounds(x, y+1, z)) smokeGrid[z][y+1][x].stable = false;
+    UnsettleSmokeCell(x-1, y, z);
+    UnsettleSmokeCell(x+1, y, z);
+    UnsettleSmokeCell(x, y-1, z);
+    UnsettleSmokeCell(x, y+1, z);
 
     // Above and below
-    if (InBounds(x, y, z-1)) smokeGrid[z-1][y][x].stable = false;
-    if (InBounds(x, y, z+1)) smokeGrid[z+1][y][x].stable = false;
+    UnsettleSmokeCell(x, y, z-1);
+    UnsettleSmokeCell(x, y, z+1);
 }
 
 // Set smoke level at a cell
@@ -105,8 +114,8 @@ void SetSmokeLevel(int x, int y, int z, int level) {
     if (level < 0) level = 0;
     if (level > SMOKE_MAX_LEVEL) level = SMOKE_MAX_LEVEL;
 
-    int oldLevel = smokeGrid[z][y][x].level;
-    smokeGrid[z][y][x].level = (uint8_t)level;
+    int oldLevel = SmokeCellAt(x, y, z)->level;
+    if (oldLevel != level) SmokeCellForWrite(x, y, z)->level = (uint8_t)level;
 
     // Update presence tracking
     if (oldLevel == 0 && level > 0) {
@@ -123,14 +132,14 @@ void SetSmokeLevel(int x, int y, int z, int level) {
 // Add smoke to a cell
 void AddSmoke(int x, int y, int z, int amount) {
     if (!InBounds(x, y, z)) return;
-    int newLevel = smokeGrid[z][y][x].level + amount;
+    int newLevel = SmokeCellAt(x, y, z)->level + amount;
     SetSmokeLevel(x, y, z, newLevel);
 }
 
 // Query functions
 int GetSmokeLevel(int x, int y, int z) {
     if (!InBounds(x, y, z)) return 0;
-    return smokeGrid[z][y][x].level;
+    return SmokeCellAt(x, y, z)->level;
 }
 
 bool HasSmoke(int x, int y, int z) {
@@ -159,7 +168,7 @@ void GenerateSmokeFromFire(int x, int y, int z, int fireLevel) {
     // Smoke rises - add more to cell above if possible
     if (CanHoldSmoke(x, y, z + 1)) {
         AddSmoke(x, y, z + 1, smokeAmount);
-        smokeGrid[z + 1][y][x].pressureSourceZ = z;  // Track origin
+        if (HasSmoke(x, y, z + 1)) SmokeCellForWrite(x, y, z + 1)->pressureSourceZ = z;  // Track origin
     }
 }
 
@@ -172,10 +181,8 @@ static int TryRise(int x, int y, int z) {
         return 0;  // Blocked above
     }
 
-    SmokeCell* src = &smokeGrid[z][y][x];
-    SmokeCell* dst = &smokeGrid[z+1][y][x];
-
-    if (src->level == 0) return 0;
+    if (SmokeCellAt(x, y, z)->level == 0) return 0;
+    SmokeCell* src = SmokeCellForWrite(x, y, z);
 
     // Don't rise if this cell's smoke already rose into it this tick
     // This prevents smoke from cascading through multiple z-levels in one tick
@@ -183,7 +190,7 @@ static int TryRise(int x, int y, int z) {
         return 0;
     }
 
-    int space = SMOKE_MAX_LEVEL - dst->level;
+    int space = SMOKE_MAX_LEVEL - SmokeCellAt(x, y, z + 1)->level;
     if (space <= 0) {
         // Cell above is full - create pressure (smoke wants to rise but can't)
         src->hasPressure = true;
@@ -195,6 +202,8 @@ static int TryRise(int x, int y, int z) {
     if (flow > src->level) flow = src->level;
     if (flow > space) flow = space;
 
+    SmokeCell* dst = SmokeCellForWrite(x, y, z + 1);
+
     // Track counter transitions
     bool srcWasActive = src->level > 0;
     bool dstWasActive = dst->level > 0;
@@ -232,8 +241,8 @@ static int TryRise(int x, int y, int z) {
 
 // Phase 2: SPREADING - Equalize smoke levels with horizontal neighbors
 static bool SmokeTrySpread(int x, int y, int z) {
-    SmokeCell* cell = &smokeGrid[z][y][x];
-    if (cell->level == 0) return false;
+    if (SmokeCellAt(x, y, z)->level == 0) return false;
+    SmokeCell* cell = SmokeCellForWrite(x, y, z);
 
     // Orthogonal neighbors - randomize order
     int dx[] = {-1, 1, 0, 0};
@@ -242,7 +251,7 @@ static bool SmokeTrySpread(int x, int y, int z) {
     // Fisher-Yates shuffle
     int order[] = {0, 1, 2, 3};
     for (int i = 3; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = SimRand(RNG_SMOKE) % (i + 1);
         int tmp = order[i];
         order[i] = order[j];
         order[j] = tmp;
@@ -272,11 +281,11 @@ static bool SmokeTrySpread(int x, int y, int z) {
 
         if (!CanHoldSmoke(nx, ny, z)) continue;
 
-        SmokeCell* neighbor = &smokeGrid[z][ny][nx];
-        int diff = cell->level - neighbor->level;
+        int diff = cell->level - SmokeCellAt(nx, ny, z)->level;
 
         // Spread to lower neighbors
         if (diff >= 2) {
+            SmokeCell* neighbor = SmokeCellForWrite(nx, ny, z);
             bool neighborWasEmpty = neighbor->level == 0;
             cell->level -= 1;
             neighbor->level += 1;
@@ -292,6 +301,7 @@ static bool SmokeTrySpread(int x, int y, int z) {
 
             if (cell->level <= 1) break;
         } else if (diff == 1 && cell->level > 1) {
+            SmokeCell* neighbor = SmokeCellForWrite(nx, ny, z);
             bool neighborWasEmpty = neighbor->level == 0;
             cell->level -= 1;
             neighbor->level += 1;
@@ -313,11 +323,11 @@ static bool SmokeTrySpread(int x, int y, int z) {
 
 // Phase 3: FILL DOWN - When trapped, smoke fills downward (inverse pressure)
 static bool TryFillDown(int x, int y, int z) {
-    SmokeCell* cell = &smokeGrid[z][y][x];
-
     // Need full smoke with pressure to fill down
-    if (cell->level < SMOKE_MAX_LEVEL) return false;
-    if (!cell->hasPressure) return false;
+    const SmokeCell* view = SmokeCellAt(x, y, z);
+    if (view->level < SMOKE_MAX_LEVEL) return false;
+    if (!view->hasPressure) return false;
+    SmokeCell* cell = SmokeCellForWrite(x, y, z);
 
     int minZ = cell->pressureSourceZ;
     if (minZ >= z) minZ = 0;  // Can fill all the way down if no source tracked
@@ -327,7 +337,7 @@ static bool TryFillDown(int x, int y, int z) {
     smokePressureGeneration++;
     if (smokePressureGeneration == 0) {
         // Handle wraparound (rare) - clear array once
-        memset(smokePressureVisited, 0, sizeof(smokePressureVisited));
+        CLEAR_WORLD_LAYER(smokePressureVisited);
         smokePressureGeneration = 1;
     }
 
@@ -359,16 +369,17 @@ static bool TryFillDown(int x, int y, int z) {
     // BFS through full cells looking for non-full cell
     while (queueHead < queueTail) {
         SmokePos pos = smokePressureQueue[queueHead++];
-        SmokeCell* current = &smokeGrid[pos.z][pos.y][pos.x];
+        const SmokeCell* currentView = SmokeCellAt(pos.x, pos.y, pos.z);
 
         // Found a non-full cell - push smoke here
-        if (current->level < SMOKE_MAX_LEVEL) {
-            int space = SMOKE_MAX_LEVEL - current->level;
+        if (currentView->level < SMOKE_MAX_LEVEL) {
+            int space = SMOKE_MAX_LEVEL - currentView->level;
             int transfer = 1;
             if (transfer > space) transfer = space;
             if (transfer > cell->level) transfer = cell->level;
 
             if (transfer > 0) {
+                SmokeCell* current = SmokeCellForWrite(pos.x, pos.y, pos.z);
                 bool currentWasEmpty = current->level == 0;
                 cell->level -= transfer;
                 current->level += transfer;
@@ -391,7 +402,7 @@ static bool TryFillDown(int x, int y, int z) {
         }
 
         // Cell is full - continue searching through it
-        if (current->level >= SMOKE_MAX_LEVEL) {
+        if (currentView->level >= SMOKE_MAX_LEVEL) {
             for (int i = 4; i >= 0; i--) {
                 int nx = pos.x + dx[i];
                 int ny = pos.y + dy[i];
@@ -416,8 +427,9 @@ static bool TryFillDown(int x, int y, int z) {
 // Process a single smoke cell
 // doRise: interval has elapsed for rising
 // doDissipate: interval has elapsed for dissipation
+// Only called for cells of allocated pages
 static bool ProcessSmokeCell(int x, int y, int z, bool doRise, bool doDissipate) {
-    SmokeCell* cell = &smokeGrid[z][y][x];
+    SmokeCell* cell = SmokeCellForWrite(x, y, z);
     bool moved = false;
 
     // No smoke to process
@@ -454,7 +466,7 @@ static bool ProcessSmokeCell(int x, int y, int z, bool doRise, bool doDissipate)
         // Smoke at higher z-levels or trapped dissipates slower
         bool isTrapped = cell->hasPressure || (z > 0 && !CanHoldSmoke(x, y, z + 1));
 
-        if (!isTrapped || (rand() % 3) == 0) {
+        if (!isTrapped || (SimRand(RNG_SMOKE) % 3) == 0) {
             cell->level--;
             if (cell->level == 0) {
                 cell->hasPressure = false;
@@ -485,6 +497,9 @@ static int smokeTick = 0;
 void UpdateSmoke(void) {
     if (!smokeEnabled) return;
 
+    // Give back pages the smoke has left
+    ReclaimPagedLayer(&smokeLayer, PAGED_RECLAIM_BUDGET);
+
     // Early exit: no smoke activity at all
     if (smokeActiveCells == 0) {
         smokeUpdateCount = 0;
@@ -527,7 +542,7 @@ void UpdateSmoke(void) {
         smokeRiseGeneration++;
         if (smokeRiseGeneration == 0) {
             // Handle wraparound - clear the array
-            memset(smokeHasRisen, 0, sizeof(smokeHasRisen));
+            CLEAR_WORLD_LAYER(smokeHasRisen);
             smokeRiseGeneration = 1;
         }
     }
@@ -537,14 +552,20 @@ void UpdateSmoke(void) {
     bool reverseX = (smokeTick & 1);
     bool reverseY = (smokeTick & 2);
 
-    // Process from bottom to top (simple iteration)
+    // Process from bottom to top (simple iteration), skipping unallocated pages
     for (int z = 0; z < gridDepth; z++) {
         for (int yi = 0; yi < gridHeight; yi++) {
             int y = reverseY ? (gridHeight - 1 - yi) : yi;
+            int py = y >> PAGE_SHIFT;
             for (int xi = 0; xi < gridWidth; xi++) {
                 int x = reverseX ? (gridWidth - 1 - xi) : xi;
-                
-                SmokeCell* cell = &smokeGrid[z][y][x];
+                if (!PagedLayerHasPage(&smokeLayer, x >> PAGE_SHIFT, py, z)) {
+                    // Jump to the last cell of this page in scan order
+                    xi += reverseX ? (x & PAGE_MASK) : (PAGE_MASK - (x & PAGE_MASK));
+                    continue;
+                }
+
+                const SmokeCell* cell = SmokeCellAt(x, y, z);
 
                 // Skip stable empty cells
                 if (cell->stable && cell->level == 0) {
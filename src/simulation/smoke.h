@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "../world/grid.h"
+#include "../world/paged_layer.h"
 
 // Smoke level constants (1-7 scale like water/fire)
 #define SMOKE_MAX_LEVEL 7
@@ -20,8 +21,16 @@ typedef struct {
     uint8_t pressureSourceZ : 3; // z-level where smoke originated (can fill down to here)
 } SmokeCell;
 
-// Smoke grid (same dimensions as main grid)
-extern SmokeCell smokeGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Smoke cells, paged: only pages that have held smoke since the last
+// reclaim are allocated (see world/paged_layer.h)
+extern PagedLayer smokeLayer;
+
+static inline const SmokeCell* SmokeCellAt(int x, int y, int z) {
+    return PagedLayerCell(&smokeLayer, x, y, z);
+}
+static inline SmokeCell* SmokeCellForWrite(int x, int y, int z) {
+    return PagedLayerCellForWrite(&smokeLayer, x, y, z);
+}
 
 // Global state
 extern bool smokeEnabled;           // Master toggle for smoke simulation
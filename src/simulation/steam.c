@@ -7,11 +7,16 @@
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
 #include "../core/time.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <stdlib.h>
 
-// Steam grid storage
-SteamCell steamGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Steam cell storage: a page is empty once no cell in it holds steam
+static const SteamCell emptySteam = {0};
+static bool SteamCellIsEmpty(const void* cell) {
+    return ((const SteamCell*)cell)->level == 0;
+}
+DEFINE_PAGED_LAYER(SteamCell, steamLayer, &emptySteam, SteamCellIsEmpty);
 
 // Global state
 bool steamEnabled = true;
@@ -29,7 +34,7 @@ static float steamRiseAccum = 0.0f;
 
 // Track which cells have received risen steam this tick (prevents cascading through z-levels)
 static uint16_t steamRiseGeneration = 0;
-static uint16_t steamHasRisen[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_STATIC_WORLD_LAYER(uint16_t, steamHasRisen);
 
 // Initialize steam system
 void InitSteam(void) {
@@ -38,7 +43,7 @@ void InitSteam(void) {
 
 // Clear all steam
 void ClearSteam(void) {
-    memset(steamGrid, 0, sizeof(steamGrid));
+    ClearPagedLayer(&steamLayer);
     steamUpdateCount = 0;
     steamRiseAccum = 0.0f;
     steamActiveCells = 0;
@@ -49,12 +54,11 @@ void ResetSteamAccumulators(void) {
     steamRiseAccum = 0.0f;
     
     // Also destabilize all cells so they get processed after load
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                steamGrid[z][y][x].stable = false;
-            }
-        }
+    for (int i = 0; i < steamLayer.allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(steamLayer.allocated[i], &px, &py, &z);
+        SteamCell* page = (SteamCell*)PagedLayerPage(&steamLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) page[c].stable = false;
     }
 }
 
@@ -72,21 +76,26 @@ static inline bool CanHoldSteam(int x, int y, int z) {
     return CellAllowsFluids(cell);
 }
 
+// Cells of unallocated pages hold no steam and are never scanned: leave them
+static inline void UnsettleSteamCell(int x, int y, int z) {
+    if (!SteamInBounds(x, y, z)) return;
+    if (!PagedLayerHasPage(&steamLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) return;
+    SteamCellForWrite(x, y, z)->stable = false;
+}
+
 // Mark cell and neighbors as unstable
 void DestabilizeSteam(int x, int y, int z) {
-    if (SteamInBounds(x, y, z)) {
-        steamGrid[z][y][x].stable = false;
-    }
+    UnsettleSteamCell(x, y, z);
     
     // 4 horizontal neighbors
-    if (SteamInBounds(x-1, y, z)) steamGrid[z][y][x-1].stable = false;
-    if (SteamInBounds(x+1, y, z)) steamGrid[z][y][x+1].stable = false;
-    if (SteamInBounds(x, y-1, z)) steamGrid[z][y-1][x].stable = false;
-    if (SteamInBounds(x, y+1, z)) steamGrid[z][y+1][x].stable = false;
+    UnsettleSteamCell(x-1, y, z);
+    UnsettleSteamCell(x+1, y, z);
+    UnsettleSteamCell(x, y-1, z);
+    UnsettleSteamCell(x, y+1, z);
     
     // Above and below
-    if (SteamInBounds(x, y, z-1)) steamGrid[z-1][y][x].stable = false;
-    if (SteamInBounds(x, y, z+1)) steamGrid[z+1][y][x].stable = false;
+    UnsettleSteamCell(x, y, z-1);
+    UnsettleSteamCell(x, y, z+1);
 }
 
 // Set steam level at a cell
@@ -95,8 +104,8 @@ void SetSteamLevel(int x, int y, int z, int level) {
     if (level < 0) level = 0;
     if (level > STEAM_MAX_LEVEL) level = STEAM_MAX_LEVEL;
     
-    int oldLevel = steamGrid[z][y][x].level;
-    steamGrid[z][y][x].level = (uint8_t)level;
+    int oldLevel = SteamCellAt(x, y, z)->level;
+    if (oldLevel != level) SteamCellForWrite(x, y, z)->level = (uint8_t)level;
     
     // Update presence tracking
     if (oldLevel == 0 && level > 0) {
@@ -113,14 +122,14 @@ void SetSteamLevel(int x, int y, int z, int level) {
 // Add steam to a cell
 void AddSteam(int x, int y, int z, int amount) {
     if (!SteamInBounds(x, y, z)) return;
-    int newLevel = steamGrid[z][y][x].level + amount;
+    int newLevel = SteamCellAt(x, y, z)->level + amount;
     SetSteamLevel(x, y, z, newLevel);
 }
 
 // Query functions
 int GetSteamLevel(int x, int y, int z) {
     if (!SteamInBounds(x, y, z)) return 0;
-    return steamGrid[z][y][x].level;
+    return SteamCellAt(x, y, z)->level;
 }
 
 bool HasSteam(int x, int y, int z) {
@@ -143,7 +152,8 @@ void GenerateSteamFromBoilingWater(int x, int y, int z, int amount) {
 
 // Phase 1: RISING - Steam moves up if there's space above
 static int SteamTryRise(int x, int y, int z) {
-    SteamCell* src = &steamGrid[z][y][x];
+    if (SteamCellAt(x, y, z)->level == 0) return 0;
+    SteamCell* src = SteamCellForWrite(x, y, z);
     
     // At top of world - steam escapes into the sky
     if (z >= gridDepth - 1) {
@@ -163,17 +173,14 @@ static int SteamTryRise(int x, int y, int z) {
     
     if (!CanHoldSteam(x, y, z + 1)) return 0;  // Blocked above
     
-    SteamCell* dst = &steamGrid[z+1][y][x];
-    
-    if (src->level == 0) return 0;
-    
+
     // Don't rise if this cell's steam already rose into it this tick
     // This prevents steam from cascading through multiple z-levels in one tick
     if (steamHasRisen[z][y][x] == steamRiseGeneration) {
         return 0;
     }
     
-    int space = STEAM_MAX_LEVEL - dst->level;
+    int space = STEAM_MAX_LEVEL - SteamCellAt(x, y, z + 1)->level;
     if (space <= 0) {
         // Cell above is full - pressure builds (Phase 2)
         return 0;
@@ -183,6 +190,8 @@ static int SteamTryRise(int x, int y, int z) {
     if (flow > src->level) flow = src->level;
     if (flow > space) flow = space;
     
+    SteamCell* dst = SteamCellForWrite(x, y, z + 1);
+    
     // Track counter transitions
     bool srcWasActive = src->level > 0;
     bool dstWasActive = dst->level > 0;
@@ -223,8 +232,8 @@ static int SteamTryRise(int x, int y, int z) {
 // Phase 2: SPREADING - Equalize steam levels with horizontal neighbors
 // (same logic as smoke - stays cohesive)
 static bool SteamTrySpread(int x, int y, int z) {
-    SteamCell* cell = &steamGrid[z][y][x];
-    if (cell->level == 0) return false;
+    if (SteamCellAt(x, y, z)->level == 0) return false;
+    SteamCell* cell = SteamCellForWrite(x, y, z);
     
     // Orthogonal neighbors - randomize order
     int dx[] = {-1, 1, 0, 0};
@@ -233,7 +242,7 @@ static bool SteamTrySpread(int x, int y, int z) {
     // Fisher-Yates shuffle
     int order[] = {0, 1, 2, 3};
     for (int i = 3; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = SimRand(RNG_STEAM) % (i + 1);
         int tmp = order[i];
         order[i] = order[j];
         order[j] = tmp;
@@ -263,11 +272,11 @@ static bool SteamTrySpread(int x, int y, int z) {
         
         if (!CanHoldSteam(nx, ny, z)) continue;
         
-        SteamCell* neighbor = &steamGrid[z][ny][nx];
-        int diff = cell->level - neighbor->level;
+        int diff = cell->level - SteamCellAt(nx, ny, z)->level;
         
         // Spread to lower neighbors
         if (diff >= 2) {
+            SteamCell* neighbor = SteamCellForWrite(nx, ny, z);
             bool neighborWasEmpty = neighbor->level == 0;
             cell->level -= 1;
             neighbor->level += 1;
@@ -283,6 +292,7 @@ static bool SteamTrySpread(int x, int y, int z) {
             
             if (cell->level <= 1) break;
         } else if (diff == 1 && cell->level > 1) {
+            SteamCell* neighbor = SteamCellForWrite(nx, ny, z);
             bool neighborWasEmpty = neighbor->level == 0;
             cell->level -= 1;
             neighbor->level += 1;
@@ -304,11 +314,11 @@ static bool SteamTrySpread(int x, int y, int z) {
 
 // Phase 3: CONDENSATION - Steam below threshold turns back to water
 static bool SteamTryCondense(int x, int y, int z) {
-    SteamCell* cell = &steamGrid[z][y][x];
-    if (cell->level == 0) return false;
+    if (SteamCellAt(x, y, z)->level == 0) return false;
+    SteamCell* cell = SteamCellForWrite(x, y, z);
     
     // Only condense sometimes (steam lingers)
-    if (steamCondensationChance > 1 && (rand() % steamCondensationChance) != 0) return false;
+    if (steamCondensationChance > 1 && (SimRand(RNG_STEAM) % steamCondensationChance) != 0) return false;
     
     // Check temperature at this cell (Celsius)
     int temp = GetTemperature(x, y, z);
@@ -348,8 +358,9 @@ static bool SteamTryCondense(int x, int y, int z) {
 
 // Process a single steam cell
 // doRise: interval has elapsed for rising
+// Only called for cells of allocated pages
 static bool ProcessSteamCell(int x, int y, int z, bool doRise) {
-    SteamCell* cell = &steamGrid[z][y][x];
+    SteamCell* cell = SteamCellForWrite(x, y, z);
     bool moved = false;
     
     // No steam to process
@@ -391,6 +402,9 @@ static int steamTick = 0;
 void UpdateSteam(void) {
     if (!steamEnabled) return;
     
+    // Give back pages the steam has left
+    ReclaimPagedLayer(&steamLayer, PAGED_RECLAIM_BUDGET);
+    
     // Early exit: no steam activity at all
     if (steamActiveCells == 0) {
         steamUpdateCount = 0;
@@ -413,7 +427,7 @@ void UpdateSteam(void) {
         steamRiseGeneration++;
         if (steamRiseGeneration == 0) {
             // Handle overflow by clearing the tracking array
-            memset(steamHasRisen, 0, sizeof(steamHasRisen));
+            CLEAR_WORLD_LAYER(steamHasRisen);
             steamRiseGeneration = 1;
         }
     }
@@ -422,13 +436,19 @@ void UpdateSteam(void) {
     bool reverseX = (steamTick & 1);
     bool reverseY = (steamTick & 2);
     
-    // Process from bottom to top (simple iteration)
+    // Process from bottom to top (simple iteration), skipping unallocated pages
     for (int z = 0; z < gridDepth; z++) {
         for (int yi = 0; yi < gridHeight; yi++) {
             int y = reverseY ? (gridHeight - 1 - yi) : yi;
+            int py = y >> PAGE_SHIFT;
             for (int xi = 0; xi < gridWidth; xi++) {
                 int x = reverseX ? (gridWidth - 1 - xi) : xi;
-                SteamCell* cell = &steamGrid[z][y][x];
+                if (!PagedLayerHasPage(&steamLayer, x >> PAGE_SHIFT, py, z)) {
+                    // Jump to the last cell of this page in scan order
+                    xi += reverseX ? (x & PAGE_MASK) : (PAGE_MASK - (x & PAGE_MASK));
+                    continue;
+                }
+                const SteamCell* cell = SteamCellAt(x, y, z);
                 
                 // Skip stable empty cells
                 if (cell->stable && cell->level == 0) {
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "../world/grid.h"
+#include "../world/paged_layer.h"
 
 // Steam constants
 #define STEAM_MAX_LEVEL 7
@@ -18,8 +19,15 @@ typedef struct {
     uint8_t reserved : 1;     // Future use
 } SteamCell;
 
-// Steam grid (same dimensions as main grid)
-extern SteamCell steamGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Steam cells, paged: pages without steam are not allocated
+extern PagedLayer steamLayer;
+
+static inline const SteamCell* SteamCellAt(int x, int y, int z) {
+    return PagedLayerCell(&steamLayer, x, y, z);
+}
+static inline SteamCell* SteamCellForWrite(int x, int y, int z) {
+    return PagedLayerCellForWrite(&steamLayer, x, y, z);
+}
 
 // Global state
 extern bool steamEnabled;
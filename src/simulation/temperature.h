@@ -60,7 +60,7 @@ typedef struct {
 } TempCell;
 
 // Temperature grid (same dimensions as main grid)
-extern TempCell temperatureGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(TempCell, temperatureGrid);
 
 // Global state
 extern bool temperatureEnabled;     // Master toggle for temperature simulation
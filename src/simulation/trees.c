@@ -24,13 +24,13 @@ float youngToMatureGH = 400.0f;  // Game-hours young tree waits at full height b
 #define LEAF_TRUNK_CHECK_DIST 4   // Max distance to check for trunk connection
 
 // Simple timer grid for growth (could be optimized with a list later)
-float growthTimer[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(float, growthTimer);
 
 // Target height per tree (set when sapling becomes trunk, based on position)
-int targetHeight[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(int, targetHeight);
 
 // Harvest state per cell (only meaningful on trunk base cells)
-uint8_t treeHarvestState[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(uint8_t, treeHarvestState);
 
 // Simple hash for position-based randomness (deterministic)
 static unsigned int PositionHash(int x, int y, int z) {
@@ -235,6 +235,7 @@ static void PlaceBranchCell(int x, int y, int z, MaterialType treeMat) {
 static void PlaceRootCell(int x, int y, int z, MaterialType treeMat) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) return;
     if (!CellIsSolid(grid[z][y][x])) return;
+    ClearCellCleanup(x, y, z);
     grid[z][y][x] = CELL_TREE_ROOT;
     SetWallMaterial(x, y, z, treeMat);
     MarkChunkDirty(x, y, z);
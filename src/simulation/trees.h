@@ -17,15 +17,15 @@ ItemType SaplingItemFromTreeType(MaterialType mat);
 ItemType LeafItemFromTreeType(MaterialType mat);
 
 // Growth grids (exposed for save/load)
-extern float growthTimer[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-extern int targetHeight[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(float, growthTimer);
+extern WORLD_LAYER(int, targetHeight);
 
 // Harvest state (stored on trunk base cell only)
 // 0 = depleted, TREE_HARVEST_MAX = fully harvestable
 // Regen uses growthTimer on the base cell (idle on mature trees)
 #define TREE_HARVEST_MAX 2
 #define TREE_HARVEST_REGEN_GH 24.0f  // Game-hours to regen one harvest level
-extern uint8_t treeHarvestState[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, treeHarvestState);
 
 // Initialize tree growth system
 void InitTrees(void);
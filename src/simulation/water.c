@@ -2,15 +2,18 @@
 #include "steam.h"
 #include "temperature.h"
 #include "balance.h"
+#include "area_sums.h"
 #include "../core/sim_manager.h"
 #include "../world/grid.h"
 #include "../world/cell_defs.h"
+#include "../world/cell_edits.h"
 #include "../core/time.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <stdlib.h>
 
 // Water grid storage - single buffer (falling sand style)
-WaterCell waterGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(WaterCell, waterGrid);
 
 // Global state
 bool waterEnabled = true;
@@ -41,7 +44,7 @@ typedef struct {
 static WaterPos pressureQueue[WATER_PRESSURE_SEARCH_LIMIT];
 
 // Generation-based visited tracking (avoids expensive memset each call)
-static uint16_t pressureVisitedGen[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_STATIC_WORLD_LAYER(uint16_t, pressureVisitedGen);
 static uint16_t currentPressureGen = 0;
 
 // Initialize water system
@@ -55,11 +58,7 @@ void ClearWater(void) {
     // WaterCell is a uint16_t bitfield: stable is bit 3, so value 0x0008.
     WaterCell emptyStable = {0};
     emptyStable.stable = 1;
-    uint16_t pattern;
-    memcpy(&pattern, &emptyStable, sizeof(pattern));
-    uint16_t* grid16 = (uint16_t*)waterGrid;
-    size_t count = sizeof(waterGrid) / sizeof(uint16_t);
-    for (size_t i = 0; i < count; i++) grid16[i] = pattern;
+    FILL_WORLD_LAYER(waterGrid, &emptyStable);
     waterUpdateCount = 0;
     waterEvapAccum = 0.0f;
     wetnessSyncAccum = 0.0f;
@@ -87,8 +86,10 @@ static inline bool CanHoldWater(int x, int y, int z) {
 
 // Mark cell and neighbors as unstable
 void DestabilizeWater(int x, int y, int z) {
+    if (DeferCellEdit(x, y, z, CELL_EDIT_WATER)) return;
     if (WaterInBounds(x, y, z)) {
         waterGrid[z][y][x].stable = false;
+        MarkAreaSumsDirty(x, y, z);  // water presence feeds scenery beauty
     }
     
     // 4 horizontal neighbors (orthogonal only, like DF pressure)
@@ -342,7 +343,7 @@ static bool WaterTrySpread(int x, int y, int z) {
     // Fisher-Yates shuffle for direction order
     int order[] = {0, 1, 2, 3};
     for (int i = 3; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = SimRand(RNG_WATER) % (i + 1);
         int tmp = order[i];
         order[i] = order[j];
         order[j] = tmp;
@@ -428,7 +429,7 @@ static bool TryPressure(int x, int y, int z) {
     currentPressureGen++;
     if (currentPressureGen == 0) {
         // Handle wrap-around (rare) - clear the array once
-        memset(pressureVisitedGen, 0, sizeof(pressureVisitedGen));
+        CLEAR_WORLD_LAYER(pressureVisitedGen);
         currentPressureGen = 1;
     }
     
@@ -583,7 +584,7 @@ static bool ProcessWaterCell(int x, int y, int z, bool doEvap) {
     // Evaporation: level 1 water has a chance to evaporate each interval
     // Random chance prevents all puddles vanishing simultaneously
     if (doEvap && waterEvaporationEnabled && cell->level == 1 && !cell->isSource) {
-        if (rand() % 100 < 50) {
+        if (SimRand(RNG_WATER) % 100 < 50) {
             SetWaterLevel(x, y, z, 0);
             cell->hasPressure = false;
             moved = true;
@@ -815,12 +816,12 @@ static void SpawnRainWave(int count) {
     if (skyZ < 2) return;
     
     for (int i = 0; i < count; i++) {
-        int gx = GetRandomValue(0, gridWidth - 1);
-        int gy = GetRandomValue(0, gridHeight - 1);
+        int gx = SimRandRange(RNG_WATER, 0, gridWidth - 1);
+        int gy = SimRandRange(RNG_WATER, 0, gridHeight - 1);
         
         for (int z = skyZ; z >= skyZ - 1 && z >= 1; z--) {
             if (grid[z][gy][gx] == CELL_AIR) {
-                int level = GetRandomValue(4, 7);
+                int level = SimRandRange(RNG_WATER, 4, 7);
                 AddWater(gx, gy, z, level);
                 break;
             }
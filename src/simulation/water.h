@@ -42,7 +42,7 @@ typedef struct {
 } WaterCell;
 
 // Water grid (same dimensions as main grid)
-extern WaterCell waterGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(WaterCell, waterGrid);
 
 // Global state
 extern bool waterEnabled;           // Master toggle for water simulation
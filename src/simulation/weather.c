@@ -4,8 +4,10 @@
 #include "balance.h"
 #include "../world/grid.h"
 #include "../core/event_log.h"
+#include "../core/sim_manager.h"
 #include "../world/cell_defs.h"
 #include "../world/material.h"
+#include "../core/sim_rng.h"
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
@@ -101,7 +103,7 @@ static WeatherType PickNextWeather(WeatherType current) {
 
     if (totalWeight <= 0.0f) return WEATHER_CLEAR;
 
-    float roll = ((float)(rand() % 10000)) / 10000.0f * totalWeight;
+    float roll = ((float)(SimRand(RNG_WEATHER) % 10000)) / 10000.0f * totalWeight;
     float cumulative = 0.0f;
     for (int i = 0; i < WEATHER_COUNT; i++) {
         cumulative += weights[i];
@@ -139,7 +141,7 @@ void InitWeather(void) {
     weatherState.previous = WEATHER_CLEAR;
     float minDurGS = GameHoursToGameSeconds(weatherMinDuration);
     float maxDurGS = GameHoursToGameSeconds(weatherMaxDuration);
-    weatherState.transitionTimer = minDurGS + ((float)(rand() % 1000) / 1000.0f) * (maxDurGS - minDurGS);
+    weatherState.transitionTimer = minDurGS + ((float)(SimRand(RNG_WEATHER) % 1000) / 1000.0f) * (maxDurGS - minDurGS);
     weatherState.transitionDuration = weatherState.transitionTimer;
     weatherState.intensity = 1.0f;
     weatherState.windDirX = 0.0f;
@@ -348,8 +350,8 @@ static void UpdateWind(void) {
     if (weatherWindAccum >= weatherState.windChangeTimer) {
         weatherWindAccum -= weatherState.windChangeTimer;
         // Random walk: nudge direction
-        float nudgeX = ((float)(rand() % 200) - 100.0f) / 100.0f;
-        float nudgeY = ((float)(rand() % 200) - 100.0f) / 100.0f;
+        float nudgeX = ((float)(SimRand(RNG_WEATHER) % 200) - 100.0f) / 100.0f;
+        float nudgeY = ((float)(SimRand(RNG_WEATHER) % 200) - 100.0f) / 100.0f;
         weatherState.windDirX += nudgeX * 0.3f;
         weatherState.windDirY += nudgeY * 0.3f;
         // Normalize
@@ -360,12 +362,12 @@ static void UpdateWind(void) {
             weatherState.windDirY /= len;
         } else {
             // Pick random direction if collapsed to zero
-            float angle = ((float)(rand() % 628)) / 100.0f;
+            float angle = ((float)(SimRand(RNG_WEATHER) % 628)) / 100.0f;
             weatherState.windDirX = cosf(angle);
             weatherState.windDirY = sinf(angle);
         }
         // Next wind change in 5-15 seconds
-        weatherState.windChangeTimer = 5.0f + ((float)(rand() % 100)) / 10.0f;
+        weatherState.windChangeTimer = 5.0f + ((float)(SimRand(RNG_WEATHER) % 100)) / 10.0f;
     }
 }
 
@@ -393,7 +395,7 @@ void UpdateWeather(void) {
         float minDurGS = GameHoursToGameSeconds(weatherMinDuration);
         float maxDurGS = GameHoursToGameSeconds(weatherMaxDuration);
         weatherState.transitionTimer = minDurGS +
-            ((float)(rand() % 1000)) / 1000.0f * (maxDurGS - minDurGS);
+            ((float)(SimRand(RNG_WEATHER) % 1000)) / 1000.0f * (maxDurGS - minDurGS);
         weatherState.transitionDuration = weatherState.transitionTimer;
         weatherState.intensity = 0.0f;  // Start ramping up
     }
@@ -437,9 +439,12 @@ void SetWeatherWindAccum(float v) { weatherWindAccum = v; }
 // SNOW SYSTEM (Phase 4)
 // =============================================================================
 
-// Snow grid: 0=none, 1=light, 2=moderate, 3=heavy
-// Same layout as vegetationGrid
-uint8_t snowGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Snow layer: 0=none, 1=light, 2=moderate, 3=heavy
+static const uint8_t noSnow = 0;
+static bool SnowCellIsEmpty(const void* cell) {
+    return *(const uint8_t*)cell == 0;
+}
+DEFINE_PAGED_LAYER(uint8_t, snowLayer, &noSnow, SnowCellIsEmpty);
 
 // Snow tunables (game-hours): 1/rate = game-hours per snow level change
 float snowAccumulationRate = 0.25f;   // 1/0.25 = 4 GH per level (was 0.1, 1/0.1 = 10 game-seconds)
@@ -448,20 +453,38 @@ float snowMeltingRate = 0.125f;       // 1/0.125 = 8 GH per level (was 0.05, 1/0
 // Internal accumulator for snow changes
 static float snowAccum = 0.0f;
 
-// Per-cell accumulators for deterministic snow changes
-static float snowAccumGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Per-cell accumulators for deterministic snow changes (paged like the snow)
+static const float noSnowAccum = 0.0f;
+static bool SnowAccumIsEmpty(const void* cell) {
+    return *(const float*)cell == 0.0f;
+}
+DEFINE_PAGED_LAYER(float, snowAccumLayer, &noSnowAccum, SnowAccumIsEmpty);
+
+static inline float GetSnowAccum(int x, int y, int z) {
+    return *(const float*)PagedLayerCell(&snowAccumLayer, x, y, z);
+}
+
+static inline void SetSnowAccum(int x, int y, int z, float v) {
+    if (GetSnowAccum(x, y, z) == v) return;  // Resetting an empty cell allocates nothing
+    *(float*)PagedLayerCellForWrite(&snowAccumLayer, x, y, z) = v;
+}
+
+// Some surface accumulator may be non-zero (cleared by the next freezing, dry pass)
+static bool snowAccumPending = false;
 
 void InitSnow(void) {
-    memset(snowGrid, 0, sizeof(snowGrid));
-    memset(snowAccumGrid, 0, sizeof(snowAccumGrid));
+    ClearPagedLayer(&snowLayer);
+    ClearPagedLayer(&snowAccumLayer);
+    ClearChunkActivity(ACTIVITY_SNOW);
     snowAccum = 0.0f;
+    snowAccumPending = false;
 }
 
 uint8_t GetSnowLevel(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return 0;
     }
-    return snowGrid[z][y][x];
+    return *(const uint8_t*)PagedLayerCell(&snowLayer, x, y, z);
 }
 
 void SetSnowLevel(int x, int y, int z, uint8_t level) {
@@ -469,26 +492,22 @@ void SetSnowLevel(int x, int y, int z, uint8_t level) {
         return;
     }
     if (level > 3) level = 3;  // Clamp to max level
-    snowGrid[z][y][x] = level;
-}
-
-void UpdateSnow(void) {
-    if (gameDeltaTime <= 0.0f) return;
-    
-    snowAccum += gameDeltaTime;
-    float snowTickGS = GameHoursToGameSeconds(0.04f);  // Update every 0.04 game-hours
-    if (snowAccum < snowTickGS) return;
-    float elapsedTime = snowAccum;
-    snowAccum = 0.0f;
-    
-    WeatherType w = weatherState.current;
-    bool isSnowing = (w == WEATHER_SNOW);
-    int ambientTemp = GetAmbientTemperature(0);  // Surface temperature
-    bool isFreezing = (ambientTemp <= 0);
-    
-    // Iterate surface cells
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
+    uint8_t old = GetSnowLevel(x, y, z);
+    if (old == level) return;
+    *(uint8_t*)PagedLayerCellForWrite(&snowLayer, x, y, z) = level;
+    if (old == 0 && level > 0) ChunkActivityAdd(ACTIVITY_SNOW, x, y, z, 1);
+    if (old > 0 && level == 0) ChunkActivityAdd(ACTIVITY_SNOW, x, y, z, -1);
+}
+
+// Accumulate/melt snow on the topmost solid cell of each column in one chunk
+static void UpdateSnowChunk(int cx, int cy, float elapsedTime, bool isSnowing, bool isFreezing) {
+    int x0 = cx * chunkWidth, x1 = x0 + chunkWidth;
+    int y0 = cy * chunkHeight, y1 = y0 + chunkHeight;
+    if (x1 > gridWidth) x1 = gridWidth;
+    if (y1 > gridHeight) y1 = gridHeight;
+
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
             // Find topmost solid cell
             for (int z = gridDepth - 1; z >= 0; z--) {
                 CellType cell = grid[z][y][x];
@@ -500,20 +519,26 @@ void UpdateSnow(void) {
                 
                 // Snow accumulation
                 if (isSnowing && exposed && isFreezing && currentSnow < 3) {
-                    snowAccumGrid[z][y][x] += elapsedTime * weatherState.intensity;
+                    float accum = GetSnowAccum(x, y, z) + elapsedTime * weatherState.intensity;
                     float threshold = GameHoursToGameSeconds(1.0f / snowAccumulationRate);
-                    if (snowAccumGrid[z][y][x] >= threshold) {
-                        snowAccumGrid[z][y][x] = 0.0f;
+                    if (accum >= threshold) {
+                        SetSnowAccum(x, y, z, 0.0f);
                         SetSnowLevel(x, y, z, currentSnow + 1);
+                    } else {
+                        SetSnowAccum(x, y, z, accum);
+                        snowAccumPending = true;
                     }
                 }
                 
                 // Snow melting
                 if (!isFreezing && currentSnow > 0) {
-                    snowAccumGrid[z][y][x] += elapsedTime;
+                    float accum = GetSnowAccum(x, y, z) + elapsedTime;
                     float threshold = GameHoursToGameSeconds(1.0f / snowMeltingRate);
-                    if (snowAccumGrid[z][y][x] >= threshold) {
-                        snowAccumGrid[z][y][x] = 0.0f;
+                    if (accum < threshold) {
+                        SetSnowAccum(x, y, z, accum);
+                        snowAccumPending = true;
+                    } else {
+                        SetSnowAccum(x, y, z, 0.0f);
                         SetSnowLevel(x, y, z, currentSnow - 1);
                         // Add wetness from melted snow
                         int wetness = GET_CELL_WETNESS(x, y, z);
@@ -525,7 +550,7 @@ void UpdateSnow(void) {
                 
                 // Reset accumulator if conditions don't match
                 if ((!isSnowing || !exposed || !isFreezing) && isFreezing) {
-                    snowAccumGrid[z][y][x] = 0.0f;
+                    SetSnowAccum(x, y, z, 0.0f);
                 }
                 
                 break;  // Only process topmost solid cell
@@ -534,6 +559,53 @@ void UpdateSnow(void) {
     }
 }
 
+void UpdateSnow(void) {
+    if (gameDeltaTime <= 0.0f) return;
+    
+    snowAccum += gameDeltaTime;
+    float snowTickGS = GameHoursToGameSeconds(0.04f);  // Update every 0.04 game-hours
+    if (snowAccum < snowTickGS) return;
+    float elapsedTime = snowAccum;
+    snowAccum = 0.0f;
+
+    // Give back pages the snow has melted off
+    ReclaimPagedLayer(&snowLayer, PAGED_RECLAIM_BUDGET);
+    ReclaimPagedLayer(&snowAccumLayer, PAGED_RECLAIM_BUDGET);
+    
+    WeatherType w = weatherState.current;
+    bool isSnowing = (w == WEATHER_SNOW);
+    int ambientTemp = GetAmbientTemperature(0);  // Surface temperature
+    bool isFreezing = (ambientTemp <= 0);
+    
+    // Which chunks need a visit:
+    //  - snowing and freezing: any exposed surface can accumulate, visit everything
+    //  - thawing: only cells that already have snow can melt
+    //  - freezing and dry: only accumulator resets, needed once after snow/melt progress
+    bool allChunks = isSnowing && isFreezing;
+    if (!allChunks && isFreezing) {
+        if (!snowAccumPending) return;
+        allChunks = true;
+        snowAccumPending = false;
+    }
+
+    for (int cy = 0; cy < chunksY; cy++) {
+        // Columns can have their surface at any z, so OR the snow masks of all levels
+        uint64_t mask[CHUNK_MASK_WORDS] = {0};
+        if (!allChunks) {
+            uint64_t any = 0;
+            for (int z = 0; z < gridDepth; z++) {
+                for (int w = 0; w < CHUNK_MASK_WORDS; w++) mask[w] |= chunkActiveMask[ACTIVITY_SNOW][z][cy][w];
+            }
+            for (int w = 0; w < CHUNK_MASK_WORDS; w++) any |= mask[w];
+            if (any == 0) continue;
+        }
+        for (int cx = 0; cx < chunksX; cx++) {
+            if (!allChunks && !((mask[cx >> 6] >> (cx & 63)) & 1)) continue;
+            UpdateSnowChunk(cx, cy, elapsedTime, isSnowing, isFreezing);
+        }
+    }
+}
+
 float GetSnowSpeedMultiplier(int x, int y, int z) {
     uint8_t snow = GetSnowLevel(x, y, z);
     switch (snow) {
@@ -716,7 +788,7 @@ static void TryLightningStrike(void) {
     if (candidateCount == 0) return;  // No valid targets
     
     // Pick random candidate and ignite
-    int idx = rand() % candidateCount;
+    int idx = SimRand(RNG_WEATHER) % candidateCount;
     int x = candidates[idx].x;
     int y = candidates[idx].y;
     int z = candidates[idx].z;
@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "../core/time.h"
+#include "../world/paged_layer.h"
 
 // =============================================================================
 // SEASONS
@@ -106,7 +107,9 @@ void SetWeatherWindAccum(float v);
 // =============================================================================
 
 // Snow levels: 0=none, 1=light, 2=moderate, 3=heavy
-// Stored in separate snowGrid (uint8_t 3D array, like vegetationGrid)
+// Stored in a paged uint8_t layer: pages without snow are not allocated
+extern PagedLayer snowLayer;
+extern PagedLayer snowAccumLayer;       // fractional snow changes, same paging
 
 void InitSnow(void);                    // Initialize snow grid to zero
 uint8_t GetSnowLevel(int x, int y, int z);
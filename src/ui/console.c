@@ -18,6 +18,7 @@
 #include "../core/time.h"              // timeOfDay, dayNumber, dayLength
 #include "../core/sim_manager.h"       // InitSimActivity
 #include "../world/designations.h"     // InitDesignations
+#include "../core/replay.h"            // ReplayRecordConsole
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>                // atoi, atof
@@ -101,6 +102,23 @@ typedef struct {
 static CVar cvars[CON_MAX_VARS];
 static int cvarCount = 0;
 
+// Cell that "at mouse" commands act on; replays pin it to the recorded cell
+static bool targetCellSet = false;
+static int targetX, targetY, targetZ;
+
+static void GetTargetCell(int* x, int* y, int* z) {
+    if (targetCellSet) {
+        *x = targetX;
+        *y = targetY;
+        *z = targetZ;
+        return;
+    }
+    Vector2 gridPos = ScreenToGrid(GetMousePosition());
+    *x = (int)gridPos.x;
+    *y = (int)gridPos.y;
+    *z = currentViewZ;
+}
+
 // ---------------------------------------------------------------------------
 // Init
 // ---------------------------------------------------------------------------
@@ -595,11 +613,8 @@ static void Cmd_Spawn(int argc, const char** argv) {
     }
 
     // Get mouse world position
-    Vector2 mousePos = GetMousePosition();
-    Vector2 gridPos = ScreenToGrid(mousePos);
-    int mx = (int)gridPos.x;
-    int my = (int)gridPos.y;
-    int mz = currentViewZ;
+    int mx, my, mz;
+    GetTargetCell(&mx, &my, &mz);
 
     // Check bounds
     if (mx < 0 || mx >= gridWidth || my < 0 || my >= gridHeight || mz < 0 || mz >= gridDepth) {
@@ -1196,6 +1211,9 @@ static void Submit(void) {
     HistoryPush(con.input);
 
     // Execute command
+    int tx, ty, tz;
+    GetTargetCell(&tx, &ty, &tz);
+    ReplayRecordConsole(con.input, tx, ty, tz);
     ExecuteCommand(con.input);
 
     // Clear input
@@ -1209,6 +1227,15 @@ static void Submit(void) {
 // ---------------------------------------------------------------------------
 // Register Game Variables (call from main.c after init)
 // ---------------------------------------------------------------------------
+void Console_ExecuteAt(const char* line, int x, int y, int z) {
+    targetCellSet = true;
+    targetX = x;
+    targetY = y;
+    targetZ = z;
+    ExecuteCommand(line);
+    targetCellSet = false;
+}
+
 void Console_RegisterGameVars(void) {
     // Rendering & Display (from main.c)
     Console_RegisterVar("zoom", &zoom, CVAR_FLOAT);
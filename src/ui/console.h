@@ -34,4 +34,7 @@ typedef enum { CVAR_BOOL, CVAR_INT, CVAR_FLOAT } CVarType;
 void Console_RegisterVar(const char* name, void* ptr, CVarType type);
 void Console_RegisterGameVars(void);  // Register common game variables
 
+// Run a command line as if typed, with "at mouse" commands aimed at (x, y, z)
+void Console_ExecuteAt(const char* line, int x, int y, int z);
+
 #endif
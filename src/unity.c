@@ -11,12 +11,18 @@
 #define UI_IMPLEMENTATION
 
 // World systems
+#include "core/sim_rng.c"
 #include "world/cell_defs.c"
 #include "world/material.c"
 #include "world/grid.c"
+#include "world/paged_layer.c"
 #include "world/biome.c"
 #include "world/terrain.c"
+#include "world/worldgen_tiles.c"
+#include "world/cell_edits.c"
 #include "world/pathfinding.c"
+#include "world/flow_field.c"
+#include "world/reach_cache.c"
 #include "world/designations.c"
 #include "world/construction.c"
 
@@ -34,6 +40,7 @@
 #include "simulation/trees.c"
 #include "simulation/lighting.c"
 #include "simulation/plants.c"
+#include "simulation/area_sums.c"
 #include "simulation/farming.c"
 #include "simulation/balance.c"
 #include "simulation/mood.c"
@@ -50,6 +57,9 @@
 #include "entities/stacking.c"
 #include "entities/containers.c"
 #include "entities/stockpiles.c"
+#include "entities/item_renumber.c"
+#include "entities/path_index.c"
+#include "entities/item_ledger.c"
 #include "entities/workshops.c"
 #include "entities/furniture.c"
 #include "entities/animals.c"
@@ -68,6 +78,7 @@
 #include "core/pie_menu.c"
 #include "core/input.c"
 #include "core/saveload.c"
+#include "core/replay.c"
 
 // Rendering
 #include "render/rendering.c"
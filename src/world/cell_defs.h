@@ -400,7 +400,7 @@ static inline int GetCellMoveCost(int x, int y, int z) {
     
     // Furniture movement penalty (non-blocking furniture)
     {
-        extern uint8_t furnitureMoveCostGrid[][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+        extern WORLD_LAYER(uint8_t, furnitureMoveCostGrid);
         int furnCost = furnitureMoveCostGrid[z][y][x];
         if (furnCost > cost) cost = furnCost;
     }
@@ -0,0 +1,180 @@
+// cell_edits.c - Bulk cell-edit transactions with deferred invalidation
+#include "cell_edits.h"
+#include "grid.h"
+#include "pathfinding.h"
+#include "designations.h"
+#include "../entities/items.h"
+#include "../entities/mover.h"
+#include "../entities/jobs.h"
+#include "../simulation/rooms.h"
+#include "../simulation/water.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    int x, y, z;
+    uint8_t kinds;
+    int next;           // next cell in the same chunk, -1 at the end
+} CellEdit;
+
+typedef struct {
+    int cx, cy, z;
+    int x0, y0, x1, y1; // bounding box of the chunk's edited cells
+    uint8_t kinds;
+    int firstCell;
+    int lastCell;
+} ChunkEdit;
+
+int cellEditDepth = 0;
+CellEditStats lastCellEditCommit;
+
+static CellEdit* cellEdits = NULL;
+static int cellEditCount = 0;
+static int cellEditCapacity = 0;
+
+static ChunkEdit* chunkEdits = NULL;
+static int chunkEditCount = 0;
+static int chunkEditCapacity = 0;
+
+// Index + 1 into chunkEdits, 0 = chunk not touched in this transaction
+static int32_t chunkEditSlot[MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
+
+static bool designationCacheEdited[DESIGNATION_TYPE_COUNT];
+static bool anyDesignationCacheEdited = false;
+
+static bool GrowEdits(void** array, int* capacity, int needed, size_t elemSize) {
+    if (needed <= *capacity) return true;
+    int newCap = *capacity ? *capacity * 2 : 1024;
+    while (newCap < needed) newCap *= 2;
+    void* grown = realloc(*array, (size_t)newCap * elemSize);
+    if (!grown) return false;
+    *array = grown;
+    *capacity = newCap;
+    return true;
+}
+
+void BeginCellEdits(void) {
+    cellEditDepth++;
+}
+
+bool RecordCellEdit(int x, int y, int z, uint8_t kinds) {
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) return false;
+
+    // Most fan-outs for one cell arrive back to back
+    if (cellEditCount > 0) {
+        CellEdit* last = &cellEdits[cellEditCount - 1];
+        if (last->x == x && last->y == y && last->z == z) {
+            last->kinds |= kinds;
+            chunkEdits[chunkEditSlot[z][y / chunkHeight][x / chunkWidth] - 1].kinds |= kinds;
+            return true;
+        }
+    }
+
+    int cx = x / chunkWidth, cy = y / chunkHeight;
+    int slot = chunkEditSlot[z][cy][cx] - 1;
+    if (slot < 0) {
+        if (!GrowEdits((void**)&chunkEdits, &chunkEditCapacity, chunkEditCount + 1, sizeof(ChunkEdit))) return false;
+        slot = chunkEditCount++;
+        chunkEdits[slot] = (ChunkEdit){ cx, cy, z, x, y, x, y, 0, -1, -1 };
+        chunkEditSlot[z][cy][cx] = slot + 1;
+    }
+    if (!GrowEdits((void**)&cellEdits, &cellEditCapacity, cellEditCount + 1, sizeof(CellEdit))) return false;
+
+    int idx = cellEditCount++;
+    cellEdits[idx] = (CellEdit){ x, y, z, kinds, -1 };
+
+    ChunkEdit* c = &chunkEdits[slot];
+    if (c->lastCell >= 0) cellEdits[c->lastCell].next = idx;
+    else c->firstCell = idx;
+    c->lastCell = idx;
+    c->kinds |= kinds;
+    if (x < c->x0) c->x0 = x;
+    if (y < c->y0) c->y0 = y;
+    if (x > c->x1) c->x1 = x;
+    if (y > c->y1) c->y1 = y;
+    return true;
+}
+
+bool RecordDesignationCacheEdit(int type) {
+    if (cellEditDepth <= 0 || type < 0 || type >= DESIGNATION_TYPE_COUNT) return false;
+    designationCacheEdited[type] = true;
+    anyDesignationCacheEdited = true;
+    return true;
+}
+
+// Is (x, y, z) within the cooldown radius of a recorded cooldown cell?
+// Only chunks the radius can reach are walked.
+static bool NearCooldownEdit(int x, int y, int z) {
+    const int r = CELL_EDIT_COOLDOWN_RADIUS;
+    int cx0 = (x - r) / chunkWidth, cx1 = (x + r) / chunkWidth;
+    int cy0 = (y - r) / chunkHeight, cy1 = (y + r) / chunkHeight;
+    if (x - r < 0) cx0 = 0;
+    if (y - r < 0) cy0 = 0;
+    if (cx1 >= chunksX) cx1 = chunksX - 1;
+    if (cy1 >= chunksY) cy1 = chunksY - 1;
+    int z0 = z - r < 0 ? 0 : z - r;
+    int z1 = z + r >= gridDepth ? gridDepth - 1 : z + r;
+
+    for (int cz = z0; cz <= z1; cz++) {
+        for (int cy = cy0; cy <= cy1; cy++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                int slot = chunkEditSlot[cz][cy][cx] - 1;
+                if (slot < 0 || !(chunkEdits[slot].kinds & CELL_EDIT_COOLDOWN)) continue;
+                for (int i = chunkEdits[slot].firstCell; i >= 0; i = cellEdits[i].next) {
+                    const CellEdit* e = &cellEdits[i];
+                    if (!(e->kinds & CELL_EDIT_COOLDOWN)) continue;
+                    int dx = x - e->x, dy = y - e->y, dz = z - e->z;
+                    if (dx*dx + dy*dy + dz*dz <= r*r) return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void CommitCellEdits(void) {
+    if (cellEditDepth <= 0) return;
+    if (--cellEditDepth > 0) return;
+
+    // Invalidations below run immediately (depth is 0 again)
+    uint8_t allKinds = 0;
+    for (int i = 0; i < chunkEditCount; i++) {
+        const ChunkEdit* c = &chunkEdits[i];
+        allKinds |= c->kinds;
+        if (c->kinds & CELL_EDIT_NAV) {
+            MarkNavChunkDirty(c->x0, c->y0, c->z);
+        }
+        if (c->kinds & CELL_EDIT_ROOMS) {
+            InvalidateRoomsInRect(c->x0, c->y0, c->z, c->x1 - c->x0 + 1, c->y1 - c->y0 + 1);
+        }
+    }
+
+    for (int i = 0; i < cellEditCount; i++) {
+        const CellEdit* e = &cellEdits[i];
+        if (e->kinds & CELL_EDIT_NAV) NoteNavCellEdit(e->x, e->y, e->z);
+        if (e->kinds & CELL_EDIT_WATER) DestabilizeWater(e->x, e->y, e->z);
+        if (e->kinds & CELL_EDIT_PATHS) InvalidatePathsThroughCell(e->x, e->y, e->z);
+    }
+
+    if (allKinds & CELL_EDIT_COOLDOWN) {
+        ClearUnreachableCooldownsWhere(NearCooldownEdit);
+    }
+
+    if (anyDesignationCacheEdited) {
+        for (int t = 0; t < DESIGNATION_TYPE_COUNT; t++) {
+            if (designationCacheEdited[t]) InvalidateDesignationCache((DesignationType)t);
+        }
+        memset(designationCacheEdited, 0, sizeof(designationCacheEdited));
+        anyDesignationCacheEdited = false;
+    }
+
+    lastCellEditCommit.cells = cellEditCount;
+    lastCellEditCommit.chunks = chunkEditCount;
+
+    for (int i = 0; i < chunkEditCount; i++) {
+        const ChunkEdit* c = &chunkEdits[i];
+        chunkEditSlot[c->z][c->cy][c->cx] = 0;
+    }
+    chunkEditCount = 0;
+    cellEditCount = 0;
+}
@@ -0,0 +1,66 @@
+// cell_edits.h - Bulk cell-edit transactions with deferred invalidation
+//
+// Every cell mutation fans out to the caches that depend on the grid:
+// MarkChunkDirty (HPA* chunks, JPS+, lighting, area sums, flow fields, path
+// index, reach cache), InvalidateRoomsAt, DestabilizeWater,
+// InvalidatePathsThroughCell, ClearUnreachableCooldownsNearCell (a scan over
+// every item) and InvalidateDesignationCache. Fine for one cell, but a drag
+// over a 100x100 area pays the item scan ten thousand times.
+//
+// Between BeginCellEdits and CommitCellEdits those calls only record the
+// cell. The commit then runs each invalidation once where it can:
+//   - per touched chunk: HPA* chunk flags, lighting, area sums, and one
+//     room dirty rect (the bounding box of the chunk's edited cells)
+//   - per recorded cell: the O(1) queues (JPS+, path index, reach cache,
+//     flow fields), water destabilize, paths-through-cell
+//   - once: the item cooldown scan, each designation cache
+//
+// Transactions nest; only the outermost commit flushes. Path and
+// reachability queries inside a transaction see the caches as they were
+// at Begin, so don't pathfind against cells edited in the same transaction.
+//
+// Usage:
+//   BeginCellEdits();
+//   for (...) PlaceCellFull(x, y, z, spec);   // fan-out is recorded
+//   CommitCellEdits();                        // and run here, once
+
+#ifndef CELL_EDITS_H
+#define CELL_EDITS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Fan-out kinds recorded per cell
+typedef enum {
+    CELL_EDIT_NAV      = 1 << 0,  // MarkChunkDirty
+    CELL_EDIT_ROOMS    = 1 << 1,  // InvalidateRoomsAt
+    CELL_EDIT_WATER    = 1 << 2,  // DestabilizeWater
+    CELL_EDIT_PATHS    = 1 << 3,  // InvalidatePathsThroughCell
+    CELL_EDIT_COOLDOWN = 1 << 4,  // ClearUnreachableCooldownsNearCell
+} CellEditKind;
+
+// Cooldown clears with a larger radius aren't deferred
+#define CELL_EDIT_COOLDOWN_RADIUS 5
+
+extern int cellEditDepth;  // > 0 inside a transaction
+
+void BeginCellEdits(void);
+void CommitCellEdits(void);
+
+// Records the cell for the open transaction. False when there is none (or
+// the cell is off the grid): the caller runs its invalidation now.
+bool RecordCellEdit(int x, int y, int z, uint8_t kinds);
+bool RecordDesignationCacheEdit(int type);
+
+static inline bool DeferCellEdit(int x, int y, int z, uint8_t kinds) {
+    return cellEditDepth > 0 && RecordCellEdit(x, y, z, kinds);
+}
+
+// Stats for the last commit
+typedef struct {
+    int cells;   // distinct recorded cells (consecutive repeats merge)
+    int chunks;  // chunks those cells fall in
+} CellEditStats;
+extern CellEditStats lastCellEditCommit;
+
+#endif // CELL_EDITS_H
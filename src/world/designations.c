@@ -3,6 +3,7 @@
 #include "cell_defs.h"
 #include "material.h"
 #include "pathfinding.h"
+#include "cell_edits.h"
 #include "../entities/items.h"
 #include "../entities/mover.h"  // for CELL_SIZE
 #include "../simulation/water.h"
@@ -19,10 +20,15 @@
 #include "../core/event_log.h"
 #include "../simulation/rooms.h"
 #include "../game_state.h"
+#include "../core/sim_rng.h"
 #include <string.h>
 #include <math.h>
 
-Designation designations[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+static const Designation noDesignation = { DESIGNATION_NONE, -1, 0.0f, 0.0f };
+static bool DesignationIsNone(const void* cell) {
+    return ((const Designation*)cell)->type == DESIGNATION_NONE;
+}
+DEFINE_PAGED_LAYER(Designation, designationLayer, &noDesignation, DesignationIsNone);
 
 // Active designation count for early-exit optimizations
 int activeDesignationCount = 0;
@@ -43,16 +49,51 @@ static unsigned int PositionHashLocal(int x, int y, int z) {
     return h ^ (h >> 16);
 }
 
-void InitDesignations(void) {
-    memset(designations, 0, sizeof(designations));
-    // Set all assignedMover to -1
-    for (int z = 0; z < MAX_GRID_DEPTH; z++) {
-        for (int y = 0; y < MAX_GRID_HEIGHT; y++) {
-            for (int x = 0; x < MAX_GRID_WIDTH; x++) {
-                designations[z][y][x].assignedMover = -1;
-            }
+// Designations of one type (walks allocated pages only)
+static int CountDesignationsOfType(DesignationType type) {
+    int count = 0;
+    for (int i = 0; i < designationLayer.allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(designationLayer.allocated[i], &px, &py, &z);
+        const Designation* page = (const Designation*)PagedLayerPage(&designationLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) {
+            if (page[c].type == type) count++;
+        }
+    }
+    return count;
+}
+
+int CountActiveDesignations(void) {
+    int count = 0;
+    for (int i = 0; i < designationLayer.allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(designationLayer.allocated[i], &px, &py, &z);
+        const Designation* page = (const Designation*)PagedLayerPage(&designationLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) {
+            if (page[c].type != DESIGNATION_NONE) count++;
         }
     }
+    return count;
+}
+
+// New designation on a cell (callers check bounds and the old type)
+static void SetDesignationCell(int x, int y, int z, DesignationType type) {
+    Designation* d = DesignationForWrite(x, y, z);
+    d->type = type;
+    d->assignedMover = -1;
+    d->progress = 0.0f;
+    d->unreachableCooldown = 0.0f;
+}
+
+// Back to no designation; frees the page once it holds none
+static void ClearDesignationCell(int x, int y, int z) {
+    if (!PagedLayerHasPage(&designationLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) return;
+    *DesignationForWrite(x, y, z) = noDesignation;
+    ReclaimLayerPageAt(&designationLayer, x, y, z);
+}
+
+void InitDesignations(void) {
+    ClearPagedLayer(&designationLayer);
     activeDesignationCount = 0;
     
     // Clear blueprints
@@ -77,13 +118,11 @@ bool DesignateMine(int x, int y, int z) {
     }
     
     // Already designated?
-    if (designations[z][y][x].type == DESIGNATION_MINE) {
+    if (DesignationAt(x, y, z)->type == DESIGNATION_MINE) {
         return false;
     }
     
-    designations[z][y][x].type = DESIGNATION_MINE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_MINE);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_MINE);
     
@@ -95,31 +134,29 @@ void CancelDesignation(int x, int y, int z) {
         return;
     }
     
-    DesignationType oldType = designations[z][y][x].type;
+    DesignationType oldType = DesignationAt(x, y, z)->type;
     if (oldType != DESIGNATION_NONE) {
         activeDesignationCount--;
         InvalidateDesignationCache(oldType);  // Mark cache dirty
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
 }
 
 bool HasMineDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_MINE;
+    return DesignationAt(x, y, z)->type == DESIGNATION_MINE;
 }
 
 Designation* GetDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return NULL;
     }
-    if (designations[z][y][x].type == DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type == DESIGNATION_NONE) {
         return NULL;
     }
-    return &designations[z][y][x];
+    return DesignationForWrite(x, y, z);  // non-NONE: page already allocated
 }
 
 bool FindUnassignedMineDesignation(int* outX, int* outY, int* outZ) {
@@ -127,7 +164,11 @@ bool FindUnassignedMineDesignation(int* outX, int* outY, int* outZ) {
     for (int z = 0; z < gridDepth; z++) {
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
-                Designation* d = &designations[z][y][x];
+                if (!PagedLayerHasPage(&designationLayer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z)) {
+                    x |= PAGE_MASK;
+                    continue;
+                }
+                const Designation* d = DesignationAt(x, y, z);
                 if (d->type == DESIGNATION_MINE && d->assignedMover == -1) {
                     *outX = x;
                     *outY = y;
@@ -154,6 +195,7 @@ void CompleteMineDesignation(int x, int y, int z) {
         MaterialType wallMat = GetWallMaterial(x, y, z);
         bool wasNatural = IsWallNatural(x, y, z);
         
+        ClearCellCleanup(x, y, z);
         grid[z][y][x] = CELL_AIR;
         SET_FLOOR(x, y, z);
         
@@ -188,33 +230,21 @@ void CompleteMineDesignation(int x, int y, int z) {
     }
     
     // Clear designation
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     
     // Validate nearby ramps - mining may have removed solid support
     ValidateAndCleanupRamps(x - 2, y - 2, z - 1, x + 2, y + 2, z + 1);
     
     // Invalidate mine cache so newly-adjacent designations become reachable
     InvalidateDesignationCache(DESIGNATION_MINE);
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
 }
 
 int CountMineDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_MINE) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_MINE);
 }
 
 // Tick down unreachable cooldowns for designations
@@ -222,25 +252,28 @@ void DesignationsTick(float dt) {
     // Early exit if no designations
     if (activeDesignationCount == 0) return;
     
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                Designation* d = &designations[z][y][x];
-                if (d->type == DESIGNATION_NONE) continue;
-                if (d->unreachableCooldown > 0.0f) {
-                    d->unreachableCooldown = fmaxf(0.0f, d->unreachableCooldown - dt);
-                }
+    for (int i = 0; i < designationLayer.allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(designationLayer.allocated[i], &px, &py, &z);
+        Designation* page = (Designation*)PagedLayerPage(&designationLayer, px, py, z);
+        for (int c = 0; c < PAGE_CELLS; c++) {
+            Designation* d = &page[c];
+            if (d->type == DESIGNATION_NONE) continue;
+            if (d->unreachableCooldown > 0.0f) {
+                d->unreachableCooldown = fmaxf(0.0f, d->unreachableCooldown - dt);
+            }
 
-                // Validate: if assignedMover is set, that mover must have an active job.
-                // A mismatch means a bug left a stale assignedMover (e.g. stale cache,
-                // failed job without proper cleanup). Auto-clear to prevent stuck designations.
-                if (d->assignedMover >= 0 && d->assignedMover < moverCount) {
-                    if (movers[d->assignedMover].currentJobId < 0) {
-                        TraceLog(LOG_WARNING,
-                            "STALE DESIGNATION: %s at (%d,%d,z%d) assignedMover=%d but mover is idle - clearing",
-                            DesignationTypeName(d->type), x, y, z, d->assignedMover);
-                        d->assignedMover = -1;
-                    }
+            // Validate: if assignedMover is set, that mover must have an active job.
+            // A mismatch means a bug left a stale assignedMover (e.g. stale cache,
+            // failed job without proper cleanup). Auto-clear to prevent stuck designations.
+            if (d->assignedMover >= 0 && d->assignedMover < moverCount) {
+                if (movers[d->assignedMover].currentJobId < 0) {
+                    int x = (px << PAGE_SHIFT) | (c & PAGE_MASK);
+                    int y = (py << PAGE_SHIFT) | (c >> PAGE_SHIFT);
+                    TraceLog(LOG_WARNING,
+                        "STALE DESIGNATION: %s at (%d,%d,z%d) assignedMover=%d but mover is idle - clearing",
+                        DesignationTypeName(d->type), x, y, z, d->assignedMover);
+                    d->assignedMover = -1;
                 }
             }
         }
@@ -264,7 +297,7 @@ bool DesignateChannel(int x, int y, int z) {
     }
     
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -283,9 +316,7 @@ bool DesignateChannel(int x, int y, int z) {
         }
     }
     
-    designations[z][y][x].type = DESIGNATION_CHANNEL;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_CHANNEL);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_CHANNEL);
     
@@ -296,7 +327,7 @@ bool HasChannelDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_CHANNEL;
+    return DesignationAt(x, y, z)->type == DESIGNATION_CHANNEL;
 }
 
 // Direction offsets for cardinal neighbors (N, E, S, W)
@@ -366,11 +397,20 @@ CellType AutoDetectChannelRampDirection(int x, int y, int lowerZ) {
     return CELL_AIR;  // No valid direction found
 }
 
+static void ChannelCell(int x, int y, int z, int channelerMoverIdx);
+
+// Channeling edits the cell, the one below it and nearby ramps: one
+// transaction, so the invalidations fan out once
 void CompleteChannelDesignation(int x, int y, int z, int channelerMoverIdx) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z <= 0 || z >= gridDepth) {
         return;
     }
-    
+    BeginCellEdits();
+    ChannelCell(x, y, z, channelerMoverIdx);
+    CommitCellEdits();
+}
+
+static void ChannelCell(int x, int y, int z, int channelerMoverIdx) {
     int lowerZ = z - 1;
     
     // Drop items in this cell down to z-1 (floor is being removed)
@@ -379,11 +419,10 @@ void CompleteChannelDesignation(int x, int y, int z, int channelerMoverIdx) {
     // Push OTHER movers out (not the channeler)
     for (int i = 0; i < moverCount; i++) {
         if (i == channelerMoverIdx) continue;
-        Mover* m = &movers[i];
-        if (!m->active) continue;
-        int mx = (int)(m->x / CELL_SIZE);
-        int my = (int)(m->y / CELL_SIZE);
-        int mz = (int)m->z;
+        if (!moverActive[i]) continue;
+        int mx = (int)(moverPosX[i] / CELL_SIZE);
+        int my = (int)(moverPosY[i] / CELL_SIZE);
+        int mz = (int)moverPosZ[i];
         if (mx == x && my == y && mz == z) {
             // Push to adjacent walkable cell
             for (int dir = 0; dir < 4; dir++) {
@@ -391,11 +430,11 @@ void CompleteChannelDesignation(int x, int y, int z, int channelerMoverIdx) {
                 int ay = y + CHANNEL_DIR_DY[dir];
                 if (ax >= 0 && ax < gridWidth && ay >= 0 && ay < gridHeight) {
                     if (IsCellWalkableAt(z, ay, ax)) {
-                        m->x = ax * CELL_SIZE + CELL_SIZE * 0.5f;
-                        m->y = ay * CELL_SIZE + CELL_SIZE * 0.5f;
-                        m->pathLength = 0;
-                        m->pathIndex = -1;
-                        m->needsRepath = true;
+                        moverPosX[i] = ax * CELL_SIZE + CELL_SIZE * 0.5f;
+                        moverPosY[i] = ay * CELL_SIZE + CELL_SIZE * 0.5f;
+                        moverPathLength[i] = 0;
+                        moverPathIndex[i] = -1;
+                        moverNeedsRepath[i] = true;
                         break;
                     }
                 }
@@ -427,6 +466,7 @@ void CompleteChannelDesignation(int x, int y, int z, int channelerMoverIdx) {
         // z-1 was solid - mine it out and create a ramp
         // Use channeling-specific ramp detection (relaxed rules - no low-side check)
         CellType rampDir = AutoDetectChannelRampDirection(x, y, lowerZ);
+        ClearCellCleanup(x, y, lowerZ);
         
         if (rampDir != CELL_AIR) {
             // Create ramp facing the adjacent wall
@@ -488,25 +528,22 @@ void CompleteChannelDesignation(int x, int y, int z, int channelerMoverIdx) {
     
     // === STEP 3: Handle channeler descent ===
     if (channelerMoverIdx >= 0 && channelerMoverIdx < moverCount) {
-        Mover* channeler = &movers[channelerMoverIdx];
         // Move mover to z-1 - they descend into their channel
-        channeler->z = (float)lowerZ;
+        moverPosZ[channelerMoverIdx] = (float)lowerZ;
         // Position them at center of the cell
-        channeler->x = x * CELL_SIZE + CELL_SIZE * 0.5f;
-        channeler->y = y * CELL_SIZE + CELL_SIZE * 0.5f;
+        moverPosX[channelerMoverIdx] = x * CELL_SIZE + CELL_SIZE * 0.5f;
+        moverPosY[channelerMoverIdx] = y * CELL_SIZE + CELL_SIZE * 0.5f;
         // They're now on the ramp/floor they just created
         // Clear their path since they've moved
-        channeler->pathLength = 0;
-        channeler->pathIndex = -1;
+        moverPathLength[channelerMoverIdx] = 0;
+        moverPathIndex[channelerMoverIdx] = -1;
     }
     
     // === STEP 4: Clear designation ===
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     
     // === STEP 5: Validate nearby ramps ===
     // Channeling may have removed the solid support for adjacent ramps
@@ -514,21 +551,11 @@ void CompleteChannelDesignation(int x, int y, int z, int channelerMoverIdx) {
     ValidateAndCleanupRamps(x - 2, y - 2, lowerZ, x + 2, y + 2, z);
     
     InvalidateDesignationCache(DESIGNATION_CHANNEL);
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
 }
 
 int CountChannelDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_CHANNEL) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_CHANNEL);
 }
 
 // =============================================================================
@@ -573,7 +600,7 @@ bool DesignateDigRamp(int x, int y, int z) {
     }
     
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -583,9 +610,7 @@ bool DesignateDigRamp(int x, int y, int z) {
         return false;  // No adjacent walkable floor
     }
     
-    designations[z][y][x].type = DESIGNATION_DIG_RAMP;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_DIG_RAMP);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_DIG_RAMP);
     
@@ -596,7 +621,7 @@ bool HasDigRampDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_DIG_RAMP;
+    return DesignationAt(x, y, z)->type == DESIGNATION_DIG_RAMP;
 }
 
 void CompleteDigRampDesignation(int x, int y, int z, int moverIdx) {
@@ -620,6 +645,7 @@ void CompleteDigRampDesignation(int x, int y, int z, int moverIdx) {
     }
     
     // Convert to ramp
+    ClearCellCleanup(x, y, z);
     grid[z][y][x] = rampType;
     SetWallMaterial(x, y, z, mat);  // Preserve material for the ramp
     if (isWallNatural) {
@@ -645,27 +671,15 @@ void CompleteDigRampDesignation(int x, int y, int z, int moverIdx) {
     }
     
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_DIG_RAMP);
     ValidateAndCleanupRamps(x - 2, y - 2, z - 1, x + 2, y + 2, z + 1);
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
 }
 
 int CountDigRampDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_DIG_RAMP) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_DIG_RAMP);
 }
 
 // =============================================================================
@@ -680,7 +694,7 @@ bool DesignateRemoveFloor(int x, int y, int z) {
     if (!IsExplored(x, y, z)) return false;
 
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -695,9 +709,7 @@ bool DesignateRemoveFloor(int x, int y, int z) {
         return false;  // No constructed floor to remove
     }
     
-    designations[z][y][x].type = DESIGNATION_REMOVE_FLOOR;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_REMOVE_FLOOR);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_REMOVE_FLOOR);
     
@@ -708,7 +720,7 @@ bool HasRemoveFloorDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_REMOVE_FLOOR;
+    return DesignationAt(x, y, z)->type == DESIGNATION_REMOVE_FLOOR;
 }
 
 void CompleteRemoveFloorDesignation(int x, int y, int z, int moverIdx) {
@@ -743,31 +755,19 @@ void CompleteRemoveFloorDesignation(int x, int y, int z, int moverIdx) {
     }
     
     // Clear designation
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     
     // Note: mover will fall if there's nothing solid below - handled by mover update tick
     InvalidateDesignationCache(DESIGNATION_REMOVE_FLOOR);
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
     (void)moverIdx;  // Could be used for special handling later
 }
 
 int CountRemoveFloorDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_REMOVE_FLOOR) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_REMOVE_FLOOR);
 }
 
 // =============================================================================
@@ -782,7 +782,7 @@ bool DesignateRemoveRamp(int x, int y, int z) {
     if (!IsExplored(x, y, z)) return false;
 
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -792,9 +792,7 @@ bool DesignateRemoveRamp(int x, int y, int z) {
         return false;
     }
     
-    designations[z][y][x].type = DESIGNATION_REMOVE_RAMP;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_REMOVE_RAMP);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_REMOVE_RAMP);
     
@@ -805,7 +803,7 @@ bool HasRemoveRampDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_REMOVE_RAMP;
+    return DesignationAt(x, y, z)->type == DESIGNATION_REMOVE_RAMP;
 }
 
 void CompleteRemoveRampDesignation(int x, int y, int z, int moverIdx) {
@@ -854,29 +852,17 @@ void CompleteRemoveRampDesignation(int x, int y, int z, int moverIdx) {
     }
     
     // Clear designation
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     
     InvalidateDesignationCache(DESIGNATION_REMOVE_RAMP);
     (void)moverIdx;  // Could be used for special handling later
 }
 
 int CountRemoveRampDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_REMOVE_RAMP) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_REMOVE_RAMP);
 }
 
 // =============================================================================
@@ -925,13 +911,11 @@ bool DesignateChop(int x, int y, int z) {
     }
     
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
-    designations[z][y][x].type = DESIGNATION_CHOP;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_CHOP);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_CHOP);
     
@@ -942,7 +926,7 @@ bool HasChopDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_CHOP;
+    return DesignationAt(x, y, z)->type == DESIGNATION_CHOP;
 }
 
 bool DesignateChopFelled(int x, int y, int z) {
@@ -951,7 +935,7 @@ bool DesignateChopFelled(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -959,9 +943,7 @@ bool DesignateChopFelled(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_CHOP_FELLED;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_CHOP_FELLED);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_CHOP_FELLED);
 
@@ -972,7 +954,7 @@ bool HasChopFelledDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_CHOP_FELLED;
+    return DesignationAt(x, y, z)->type == DESIGNATION_CHOP_FELLED;
 }
 
 // Helper: Check if a leaf cell is connected to a trunk of same type within distance
@@ -1100,12 +1082,10 @@ static void FellTree(int x, int y, int z, float chopperX, float chopperY) {
         SetWallMaterial(cx, cy, cz, MAT_NONE);
         MarkChunkDirty(cx, cy, cz);
 
-        if (designations[cz][cy][cx].type != DESIGNATION_NONE) {
-            InvalidateDesignationCache(designations[cz][cy][cx].type);
+        if (DesignationAt(cx, cy, cz)->type != DESIGNATION_NONE) {
+            InvalidateDesignationCache(DesignationAt(cx, cy, cz)->type);
             activeDesignationCount--;
-            designations[cz][cy][cx].type = DESIGNATION_NONE;
-            designations[cz][cy][cx].assignedMover = -1;
-            designations[cz][cy][cx].progress = 0.0f;
+            ClearDesignationCell(cx, cy, cz);
         }
 
         if (cx < minX) minX = cx;
@@ -1324,9 +1304,9 @@ void CompleteChopDesignation(int x, int y, int z, int moverIdx) {
     float chopperX = (float)x + 0.5f;
     float chopperY = (float)y + 0.5f;
     
-    if (moverIdx >= 0 && moverIdx < moverCount && movers[moverIdx].active) {
-        chopperX = movers[moverIdx].x / CELL_SIZE;
-        chopperY = movers[moverIdx].y / CELL_SIZE;
+    if (moverIdx >= 0 && moverIdx < moverCount && moverActive[moverIdx]) {
+        chopperX = moverPosX[moverIdx] / CELL_SIZE;
+        chopperY = moverPosY[moverIdx] / CELL_SIZE;
     }
     
     // Fell the entire tree (falls away from chopper)
@@ -1362,31 +1342,11 @@ void CompleteChopFelledDesignation(int x, int y, int z, int moverIdx) {
 }
 
 int CountChopDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_CHOP) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_CHOP);
 }
 
 int CountChopFelledDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_CHOP_FELLED) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_CHOP_FELLED);
 }
 
 // =============================================================================
@@ -1401,7 +1361,7 @@ bool DesignateGatherSapling(int x, int y, int z) {
     if (!IsExplored(x, y, z)) return false;
 
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -1410,9 +1370,7 @@ bool DesignateGatherSapling(int x, int y, int z) {
         return false;
     }
     
-    designations[z][y][x].type = DESIGNATION_GATHER_SAPLING;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_GATHER_SAPLING);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_GATHER_SAPLING);
     
@@ -1423,7 +1381,7 @@ bool HasGatherSaplingDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_GATHER_SAPLING;
+    return DesignationAt(x, y, z)->type == DESIGNATION_GATHER_SAPLING;
 }
 
 void CompleteGatherSaplingDesignation(int x, int y, int z, int moverIdx) {
@@ -1444,25 +1402,13 @@ void CompleteGatherSaplingDesignation(int x, int y, int z, int moverIdx) {
                           (uint8_t)saplingMat);
     
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_GATHER_SAPLING);
 }
 
 int CountGatherSaplingDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_GATHER_SAPLING) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_GATHER_SAPLING);
 }
 
 // =============================================================================
@@ -1477,7 +1423,7 @@ bool DesignatePlantSapling(int x, int y, int z) {
     if (!IsExplored(x, y, z)) return false;
 
     // Already designated?
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -1500,9 +1446,7 @@ bool DesignatePlantSapling(int x, int y, int z) {
         }
     }
     
-    designations[z][y][x].type = DESIGNATION_PLANT_SAPLING;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_PLANT_SAPLING);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_PLANT_SAPLING);
     
@@ -1513,7 +1457,7 @@ bool HasPlantSaplingDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_PLANT_SAPLING;
+    return DesignationAt(x, y, z)->type == DESIGNATION_PLANT_SAPLING;
 }
 
 void CompletePlantSaplingDesignation(int x, int y, int z, MaterialType treeMat, int moverIdx) {
@@ -1522,25 +1466,13 @@ void CompletePlantSaplingDesignation(int x, int y, int z, MaterialType treeMat,
     PlaceSapling(x, y, z, treeMat);
     
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_PLANT_SAPLING);
 }
 
 int CountPlantSaplingDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_PLANT_SAPLING) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_PLANT_SAPLING);
 }
 
 // =============================================================================
@@ -1561,7 +1493,7 @@ bool DesignateGatherGrass(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
     
@@ -1575,9 +1507,7 @@ bool DesignateGatherGrass(int x, int y, int z) {
         return false;
     }
     
-    designations[z][y][x].type = DESIGNATION_GATHER_GRASS;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_GATHER_GRASS);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_GATHER_GRASS);
     EventLog("Designated GATHER_GRASS at (%d,%d,z%d) walkable=%d", x, y, z, IsCellWalkableAt(z, y, x));
@@ -1589,7 +1519,7 @@ bool HasGatherGrassDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_GATHER_GRASS;
+    return DesignationAt(x, y, z)->type == DESIGNATION_GATHER_GRASS;
 }
 
 void CompleteGatherGrassDesignation(int x, int y, int z, int moverIdx) {
@@ -1600,7 +1530,7 @@ void CompleteGatherGrassDesignation(int x, int y, int z, int moverIdx) {
     if (vegZ >= 0) {
         SetVegetation(x, y, vegZ, VEG_NONE);
         SET_CELL_SURFACE(x, y, vegZ, SURFACE_TRAMPLED);
-        wearGrid[vegZ][y][x] = wearNormalToTrampled;
+        SetGroundWear(x, y, vegZ, wearNormalToTrampled);
     }
     
     // Spawn grass item at the walking position
@@ -1609,25 +1539,13 @@ void CompleteGatherGrassDesignation(int x, int y, int z, int moverIdx) {
     SpawnItem(spawnX, spawnY, (float)z, ITEM_GRASS);
     
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_GATHER_GRASS);
 }
 
 int CountGatherGrassDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_GATHER_GRASS) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_GATHER_GRASS);
 }
 
 // =============================================================================
@@ -1647,7 +1565,7 @@ bool DesignateGatherReeds(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -1661,9 +1579,7 @@ bool DesignateGatherReeds(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_GATHER_REEDS;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_GATHER_REEDS);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_GATHER_REEDS);
     EventLog("Designated GATHER_REEDS at (%d,%d,z%d)", x, y, z);
@@ -1675,7 +1591,7 @@ bool HasGatherReedsDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_GATHER_REEDS;
+    return DesignationAt(x, y, z)->type == DESIGNATION_GATHER_REEDS;
 }
 
 void CompleteGatherReedsDesignation(int x, int y, int z, int moverIdx) {
@@ -1686,7 +1602,7 @@ void CompleteGatherReedsDesignation(int x, int y, int z, int moverIdx) {
     if (vegZ >= 0) {
         SetVegetation(x, y, vegZ, VEG_NONE);
         SET_CELL_SURFACE(x, y, vegZ, SURFACE_TRAMPLED);
-        wearGrid[vegZ][y][x] = wearNormalToTrampled;
+        SetGroundWear(x, y, vegZ, wearNormalToTrampled);
     }
 
     // Spawn reeds item at the walking position
@@ -1695,25 +1611,13 @@ void CompleteGatherReedsDesignation(int x, int y, int z, int moverIdx) {
     SpawnItem(spawnX, spawnY, (float)z, ITEM_REEDS);
 
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_GATHER_REEDS);
 }
 
 int CountGatherReedsDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_GATHER_REEDS) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_GATHER_REEDS);
 }
 
 // =============================================================================
@@ -1726,7 +1630,7 @@ bool DesignateGatherTree(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -1741,9 +1645,7 @@ bool DesignateGatherTree(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_GATHER_TREE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_GATHER_TREE);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_GATHER_TREE);
 
@@ -1754,7 +1656,7 @@ bool HasGatherTreeDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_GATHER_TREE;
+    return DesignationAt(x, y, z)->type == DESIGNATION_GATHER_TREE;
 }
 
 void CompleteGatherTreeDesignation(int x, int y, int z, int moverIdx) {
@@ -1774,33 +1676,21 @@ void CompleteGatherTreeDesignation(int x, int y, int z, int moverIdx) {
     // Spawn items at mover position (trunk cell is solid, not walkable)
     float spawnX = x * CELL_SIZE + CELL_SIZE * 0.5f;
     float spawnY = y * CELL_SIZE + CELL_SIZE * 0.5f;
-    if (moverIdx >= 0 && moverIdx < moverCount && movers[moverIdx].active) {
-        spawnX = movers[moverIdx].x;
-        spawnY = movers[moverIdx].y;
+    if (moverIdx >= 0 && moverIdx < moverCount && moverActive[moverIdx]) {
+        spawnX = moverPosX[moverIdx];
+        spawnY = moverPosY[moverIdx];
     }
     SpawnItemWithMaterial(spawnX, spawnY, (float)z, ITEM_STICKS, (uint8_t)treeMat);
     SpawnItemWithMaterial(spawnX, spawnY, (float)z, ITEM_LEAVES, (uint8_t)treeMat);
 
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_GATHER_TREE);
 }
 
 int CountGatherTreeDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_GATHER_TREE) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_GATHER_TREE);
 }
 
 // =============================================================================
@@ -1813,7 +1703,7 @@ bool DesignateClean(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -1827,9 +1717,7 @@ bool DesignateClean(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_CLEAN;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_CLEAN);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_CLEAN);
 
@@ -1840,7 +1728,7 @@ bool HasCleanDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_CLEAN;
+    return DesignationAt(x, y, z)->type == DESIGNATION_CLEAN;
 }
 
 void CompleteCleanDesignation(int x, int y, int z) {
@@ -1851,27 +1739,15 @@ void CompleteCleanDesignation(int x, int y, int z) {
     // Fully clean the tile (set to 0)
     SetFloorDirt(x, y, z, 0);
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     InvalidateDesignationCache(DESIGNATION_CLEAN);
 }
 
 int CountCleanDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_CLEAN) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_CLEAN);
 }
 
 // =============================================================================
@@ -1889,7 +1765,7 @@ bool DesignateHarvestBerry(int x, int y, int z) {
         z = z - 1;
     }
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -1903,9 +1779,7 @@ bool DesignateHarvestBerry(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_HARVEST_BERRY;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_HARVEST_BERRY);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_HARVEST_BERRY);
 
@@ -1916,7 +1790,7 @@ bool HasHarvestBerryDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_HARVEST_BERRY;
+    return DesignationAt(x, y, z)->type == DESIGNATION_HARVEST_BERRY;
 }
 
 void CompleteHarvestBerryDesignation(int x, int y, int z) {
@@ -1927,27 +1801,15 @@ void CompleteHarvestBerryDesignation(int x, int y, int z) {
     // Harvest the plant (resets to bare, spawns ITEM_BERRIES)
     HarvestPlant(x, y, z);
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     InvalidateDesignationCache(DESIGNATION_HARVEST_BERRY);
 }
 
 int CountHarvestBerryDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_HARVEST_BERRY) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_HARVEST_BERRY);
 }
 
 // =============================================================================
@@ -1965,7 +1827,7 @@ bool DesignateKnap(int x, int y, int z) {
         z = z - 1;
     }
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -1979,9 +1841,7 @@ bool DesignateKnap(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_KNAP;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_KNAP);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_KNAP);
 
@@ -1992,34 +1852,22 @@ bool HasKnapDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    if (designations[z][y][x].type == DESIGNATION_KNAP) return true;
+    if (DesignationAt(x, y, z)->type == DESIGNATION_KNAP) return true;
     // Check cell below (designation targets the wall, not the air above)
-    if (z > 0 && designations[z-1][y][x].type == DESIGNATION_KNAP) return true;
+    if (z > 0 && DesignationAt(x, y, z-1)->type == DESIGNATION_KNAP) return true;
     return false;
 }
 
 void CompleteKnapDesignation(int x, int y, int z, int moverIdx) {
     (void)moverIdx;
     // Wall is NOT consumed — just clear the designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_KNAP);
 }
 
 int CountKnapDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_KNAP) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_KNAP);
 }
 
 // =============================================================================
@@ -2032,7 +1880,7 @@ bool DesignateDigRoots(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
@@ -2050,9 +1898,7 @@ bool DesignateDigRoots(int x, int y, int z) {
         return false;
     }
 
-    designations[z][y][x].type = DESIGNATION_DIG_ROOTS;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_DIG_ROOTS);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_DIG_ROOTS);
     EventLog("Designated DIG_ROOTS at (%d,%d,z%d) mat=%s", x, y, z, MaterialName(belowMat));
@@ -2064,7 +1910,7 @@ bool HasDigRootsDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_DIG_ROOTS;
+    return DesignationAt(x, y, z)->type == DESIGNATION_DIG_ROOTS;
 }
 
 void CompleteDigRootsDesignation(int x, int y, int z, int moverIdx) {
@@ -2085,25 +1931,13 @@ void CompleteDigRootsDesignation(int x, int y, int z, int moverIdx) {
     }
 
     // Clear designation
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     activeDesignationCount--;
     InvalidateDesignationCache(DESIGNATION_DIG_ROOTS);
 }
 
 int CountDigRootsDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_DIG_ROOTS) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_DIG_ROOTS);
 }
 
 // =============================================================================
@@ -2115,14 +1949,12 @@ bool DesignateExplore(int x, int y, int z) {
         return false;
     }
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         return false;
     }
 
     // Target cell CAN be unwalkable (wall you're scouting toward) — minimal validation
-    designations[z][y][x].type = DESIGNATION_EXPLORE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_EXPLORE);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_EXPLORE);
 
@@ -2133,7 +1965,7 @@ bool HasExploreDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_EXPLORE;
+    return DesignationAt(x, y, z)->type == DESIGNATION_EXPLORE;
 }
 
 void CompleteExploreDesignation(int x, int y, int z) {
@@ -2141,27 +1973,15 @@ void CompleteExploreDesignation(int x, int y, int z) {
         return;
     }
 
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     InvalidateDesignationCache(DESIGNATION_EXPLORE);
 }
 
 int CountExploreDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_EXPLORE) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_EXPLORE);
 }
 
 // =============================================================================
@@ -2174,14 +1994,11 @@ bool DesignateFarm(int x, int y, int z) {
     }
     if (!IsExplored(x, y, z)) return false;
     if (!IsFarmableSoil(x, y, z)) return false;
-    if (designations[z][y][x].type != DESIGNATION_NONE) return false;
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) return false;
     // Don't designate already-tilled cells
     if (farmGrid[z][y][x].tilled) return false;
 
-    designations[z][y][x].type = DESIGNATION_FARM;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
-    designations[z][y][x].unreachableCooldown = 0.0f;
+    SetDesignationCell(x, y, z, DESIGNATION_FARM);
     activeDesignationCount++;
     InvalidateDesignationCache(DESIGNATION_FARM);
     return true;
@@ -2191,7 +2008,7 @@ bool HasFarmDesignation(int x, int y, int z) {
     if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) {
         return false;
     }
-    return designations[z][y][x].type == DESIGNATION_FARM;
+    return DesignationAt(x, y, z)->type == DESIGNATION_FARM;
 }
 
 void CompleteFarmDesignation(int x, int y, int z, int moverIdx) {
@@ -2220,27 +2037,15 @@ void CompleteFarmDesignation(int x, int y, int z, int moverIdx) {
     if (z > 0) SetVegetation(x, y, z - 1, VEG_NONE);
 
     // Clear designation
-    if (designations[z][y][x].type != DESIGNATION_NONE) {
+    if (DesignationAt(x, y, z)->type != DESIGNATION_NONE) {
         activeDesignationCount--;
     }
-    designations[z][y][x].type = DESIGNATION_NONE;
-    designations[z][y][x].assignedMover = -1;
-    designations[z][y][x].progress = 0.0f;
+    ClearDesignationCell(x, y, z);
     InvalidateDesignationCache(DESIGNATION_FARM);
 }
 
 int CountFarmDesignations(void) {
-    int count = 0;
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (designations[z][y][x].type == DESIGNATION_FARM) {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    return CountDesignationsOfType(DESIGNATION_FARM);
 }
 
 // =============================================================================
@@ -2332,11 +2137,11 @@ int CreateRecipeBlueprint(int x, int y, int z, int recipeIndex) {
     // Check for items on ground at this cell — start in CLEARING if any exist
     bool hasItems = false;
     for (int i = 0; i < itemHighWaterMark && !hasItems; i++) {
-        if (!items[i].active) continue;
-        if ((int)items[i].z != z) continue;
-        if (items[i].state != ITEM_ON_GROUND && items[i].state != ITEM_IN_STOCKPILE) continue;
-        int ix = (int)(items[i].x / CELL_SIZE);
-        int iy = (int)(items[i].y / CELL_SIZE);
+        if (!itemActive[i]) continue;
+        if ((int)itemPosZ[i] != z) continue;
+        if (itemState[i] != ITEM_ON_GROUND && itemState[i] != ITEM_IN_STOCKPILE) continue;
+        int ix = (int)(itemPosX[i] / CELL_SIZE);
+        int iy = (int)(itemPosY[i] / CELL_SIZE);
         if (ix == x && iy == y) hasItems = true;
     }
     if (hasItems) {
@@ -2493,7 +2298,7 @@ void CancelBlueprint(int blueprintIdx) {
             ConsumedRecord* cr = &bp->consumedItems[st][s];
             if (cr->count > 0 && cr->itemType != ITEM_NONE) {
                 for (int i = 0; i < cr->count; i++) {
-                    if (GetRandomValue(1, 100) <= CONSTRUCTION_REFUND_CHANCE) {
+                    if (SimRandRange(RNG_JOBS, 1, 100) <= CONSTRUCTION_REFUND_CHANCE) {
                         SpawnItemWithMaterial(spawnX, spawnY, (float)bp->z,
                                              cr->itemType, (uint8_t)cr->material);
                     }
@@ -2597,8 +2402,8 @@ void DeliverMaterialToBlueprint(int blueprintIdx, int itemIdx) {
         int excessIdx = SplitStack(itemIdx, stackCount - toDeliver);
         if (excessIdx >= 0) {
             // Drop excess on the ground at the blueprint location
-            items[excessIdx].state = ITEM_ON_GROUND;
-            items[excessIdx].reservedBy = -1;
+            SetItemState(excessIdx, ITEM_ON_GROUND);
+            itemReservedBy[excessIdx] = -1;
         }
     }
 
@@ -2846,7 +2651,7 @@ void CompleteBlueprint(int blueprintIdx) {
         bp->active = false;
         bp->assignedBuilder = -1;
         blueprintCount--;
-        InvalidateRooms();
+        InvalidateRoomsAt(x, y, z);
         return;
     }
 
@@ -2857,18 +2662,19 @@ void CompleteBlueprint(int blueprintIdx) {
             EventLog("Workshop %d (%s) constructed at (%d,%d,z%d)",
                      wsIdx, workshopDefs[bp->workshopType].displayName,
                      bp->workshopOriginX, bp->workshopOriginY, bp->z);
+            Workshop* ws = &workshops[wsIdx];
+            InvalidateRoomsInRect(ws->x, ws->y, ws->z, ws->width, ws->height);
         }
         bp->active = false;
         bp->assignedBuilder = -1;
         blueprintCount--;
-        InvalidateRooms();
         return;
     }
 
     bp->active = false;
     bp->assignedBuilder = -1;
     blueprintCount--;
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
 }
 
 int CountBlueprints(void) {
@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include "grid.h"
+#include "paged_layer.h"
 #include "material.h"
 #include "construction.h"
 #include "../entities/items.h"
@@ -84,8 +85,17 @@ typedef struct {
 #define DIG_ROOTS_WORK_TIME 0.6f      // Digging roots from soil
 #define HUNT_ATTACK_WORK_TIME 0.8f    // Attack duration (~4s bare-handed, ~2s with cutting tool)
 
-// Storage: one designation per cell (sparse would be better for huge maps, but this is simple)
-extern Designation designations[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+// Storage: one designation per cell, paged (pages without designations are not allocated)
+extern PagedLayer designationLayer;
+
+// Unchecked accessors (in-bounds cells only). Read through DesignationAt;
+// DesignationForWrite allocates the cell's page.
+static inline const Designation* DesignationAt(int x, int y, int z) {
+    return (const Designation*)PagedLayerCell(&designationLayer, x, y, z);
+}
+static inline Designation* DesignationForWrite(int x, int y, int z) {
+    return (Designation*)PagedLayerCellForWrite(&designationLayer, x, y, z);
+}
 
 // =============================================================================
 // Blueprints (for construction)
@@ -132,6 +142,9 @@ void InitDesignations(void);
 // Tick down unreachable cooldowns for designations
 void DesignationsTick(float dt);
 
+// Count designations of every type (recomputes activeDesignationCount after a load)
+int CountActiveDesignations(void);
+
 // Designate a cell for mining
 // Returns true if designation was added, false if cell can't be mined
 bool DesignateMine(int x, int y, int z);
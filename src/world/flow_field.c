@@ -0,0 +1,350 @@
+// flow_field.c - Shared integration fields for crowds heading to one goal
+//
+// Integration is Dijkstra from the goal over predecessor edges: a cell u gets
+// cost(v) + step(u -> v) for every v it can step to, using the exact move
+// rules and costs of RunAStar (diagonal corner checks, ramp side entry,
+// ladders, ramp climbs and descents). next[u] remembers v, so sampling is a
+// walk down the pointers.
+
+#include "flow_field.h"
+#include "grid.h"
+#include "cell_defs.h"
+#include <stdlib.h>
+#include <string.h>
+
+FlowField flowFields[MAX_FLOW_FIELDS];
+bool useFlowFields = true;
+int flowFieldBuildCount = 0;
+
+static unsigned long flowUseStamp = 0;
+
+// --- Demand counting ---
+
+#define FLOW_DEMAND_SLOTS 64
+
+typedef struct {
+    Point goal;
+    int count;
+    unsigned long tick;
+} FlowDemand;
+
+static FlowDemand flowDemand[FLOW_DEMAND_SLOTS];
+
+static inline bool SamePoint(Point a, Point b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+int NoteFlowFieldDemand(Point goal, unsigned long tick) {
+    unsigned int h = ((unsigned int)goal.x * 73856093u) ^ ((unsigned int)goal.y * 19349663u) ^
+                     ((unsigned int)goal.z * 83492791u);
+    FlowDemand* d = &flowDemand[h % FLOW_DEMAND_SLOTS];
+    if (d->count == 0 || !SamePoint(d->goal, goal) || tick < d->tick ||
+        tick - d->tick > FLOW_FIELD_DEMAND_WINDOW) {
+        d->goal = goal;
+        d->count = 0;
+    }
+    d->count++;
+    d->tick = tick;
+    return d->count;
+}
+
+// --- Field storage ---
+
+static inline FlowField* FieldFromHandle(int handle) {
+    if (handle < 1 || handle > MAX_FLOW_FIELDS) return NULL;
+    FlowField* f = &flowFields[handle - 1];
+    return f->active ? f : NULL;
+}
+
+static inline int FieldCellIndex(const FlowField* f, int x, int y, int z) {
+    if (x < f->minX || x >= f->maxX || y < f->minY || y >= f->maxY || z < 0 || z >= f->depth) return -1;
+    return (z * f->height + (y - f->minY)) * f->width + (x - f->minX);
+}
+
+static inline Point FieldCellPoint(const FlowField* f, int idx) {
+    int x = idx % f->width;
+    int rest = idx / f->width;
+    return (Point){f->minX + x, f->minY + rest % f->height, rest / f->height};
+}
+
+void ClearFlowFields(void) {
+    for (int i = 0; i < MAX_FLOW_FIELDS; i++) {
+        free(flowFields[i].cost);
+        free(flowFields[i].next);
+    }
+    memset(flowFields, 0, sizeof(flowFields));
+    memset(flowDemand, 0, sizeof(flowDemand));
+    flowUseStamp = 0;
+}
+
+int FindFlowField(Point goal) {
+    for (int i = 0; i < MAX_FLOW_FIELDS; i++) {
+        if (flowFields[i].active && SamePoint(flowFields[i].goal, goal)) return i + 1;
+    }
+    return 0;
+}
+
+// Free slot, else the least recently used unreferenced field, else none
+static int AllocFlowFieldSlot(void) {
+    int best = -1;
+    for (int i = 0; i < MAX_FLOW_FIELDS; i++) {
+        if (!flowFields[i].active) return i;
+        if (flowFields[i].refCount > 0) continue;
+        if (best < 0 || flowFields[i].lastUsed < flowFields[best].lastUsed) best = i;
+    }
+    return best;
+}
+
+// Size the field to the given chunk box; marks it for re-integration
+static bool ResizeFlowField(FlowField* f, int cx0, int cy0, int cx1, int cy1) {
+    int minX = cx0 * chunkWidth, minY = cy0 * chunkHeight;
+    int maxX = cx1 * chunkWidth, maxY = cy1 * chunkHeight;
+    if (maxX > gridWidth) maxX = gridWidth;
+    if (maxY > gridHeight) maxY = gridHeight;
+    long long cells = (long long)(maxX - minX) * (maxY - minY) * gridDepth;
+    if (cells <= 0 || cells > FLOW_FIELD_MAX_CELLS) return false;
+
+    int* cost = realloc(f->cost, (size_t)cells * sizeof(int));
+    if (cost) f->cost = cost;
+    int* next = realloc(f->next, (size_t)cells * sizeof(int));
+    if (next) f->next = next;
+    if (!cost || !next) return false;
+
+    f->minX = minX;
+    f->minY = minY;
+    f->maxX = maxX;
+    f->maxY = maxY;
+    f->width = maxX - minX;
+    f->height = maxY - minY;
+    f->depth = gridDepth;
+    f->dirty = true;
+    return true;
+}
+
+int AcquireFlowField(Point goal, Point source) {
+    if (goal.x < 0 || goal.x >= gridWidth || goal.y < 0 || goal.y >= gridHeight ||
+        goal.z < 0 || goal.z >= gridDepth) return 0;
+    if (source.x < 0 || source.x >= gridWidth || source.y < 0 || source.y >= gridHeight ||
+        source.z < 0 || source.z >= gridDepth) return 0;
+    if (!IsCellWalkableAt(goal.z, goal.y, goal.x)) return 0;
+
+    int handle = FindFlowField(goal);
+    FlowField* f = handle ? &flowFields[handle - 1] : NULL;
+    if (f && FieldCellIndex(f, source.x, source.y, source.z) < 0) {
+        // Grow to the chunk box holding the old box and the new source
+        int cx0 = f->minX / chunkWidth, cy0 = f->minY / chunkHeight;
+        int cx1 = (f->maxX + chunkWidth - 1) / chunkWidth;
+        int cy1 = (f->maxY + chunkHeight - 1) / chunkHeight;
+        int sx = source.x / chunkWidth, sy = source.y / chunkHeight;
+        int lo, hi;
+        lo = sx - FLOW_FIELD_MARGIN_CHUNKS; if (lo < 0) lo = 0;
+        hi = sx + FLOW_FIELD_MARGIN_CHUNKS + 1; if (hi > chunksX) hi = chunksX;
+        if (lo < cx0) cx0 = lo;
+        if (hi > cx1) cx1 = hi;
+        lo = sy - FLOW_FIELD_MARGIN_CHUNKS; if (lo < 0) lo = 0;
+        hi = sy + FLOW_FIELD_MARGIN_CHUNKS + 1; if (hi > chunksY) hi = chunksY;
+        if (lo < cy0) cy0 = lo;
+        if (hi > cy1) cy1 = hi;
+        if (!ResizeFlowField(f, cx0, cy0, cx1, cy1)) return 0;
+    } else if (!f) {
+        int slot = AllocFlowFieldSlot();
+        if (slot < 0) return 0;
+        f = &flowFields[slot];
+        int gx = goal.x / chunkWidth, gy = goal.y / chunkHeight;
+        int sx = source.x / chunkWidth, sy = source.y / chunkHeight;
+        int cx0 = (gx < sx ? gx : sx) - FLOW_FIELD_MARGIN_CHUNKS;
+        int cy0 = (gy < sy ? gy : sy) - FLOW_FIELD_MARGIN_CHUNKS;
+        int cx1 = (gx > sx ? gx : sx) + FLOW_FIELD_MARGIN_CHUNKS + 1;
+        int cy1 = (gy > sy ? gy : sy) + FLOW_FIELD_MARGIN_CHUNKS + 1;
+        if (cx0 < 0) cx0 = 0;
+        if (cy0 < 0) cy0 = 0;
+        if (cx1 > chunksX) cx1 = chunksX;
+        if (cy1 > chunksY) cy1 = chunksY;
+        f->active = false;
+        f->refCount = 0;
+        if (!ResizeFlowField(f, cx0, cy0, cx1, cy1)) return 0;
+        f->active = true;
+        f->goal = goal;
+        handle = slot + 1;
+    }
+
+    f->refCount++;
+    f->lastUsed = ++flowUseStamp;
+    return handle;
+}
+
+void ReleaseFlowField(int handle) {
+    FlowField* f = FieldFromHandle(handle);
+    if (f && f->refCount > 0) f->refCount--;
+}
+
+void MarkFlowFieldsDirty(int x, int y, int z) {
+    for (int i = 0; i < MAX_FLOW_FIELDS; i++) {
+        FlowField* f = &flowFields[i];
+        if (f->active && !f->dirty && FieldCellIndex(f, x, y, z) >= 0) f->dirty = true;
+    }
+}
+
+// --- Integration ---
+
+typedef struct {
+    int cost;
+    int idx;
+} FlowHeapEntry;
+
+static FlowHeapEntry* flowHeap = NULL;
+static int flowHeapSize = 0;
+static int flowHeapCapacity = 0;
+
+static void FlowHeapPush(int cost, int idx) {
+    if (flowHeapSize == flowHeapCapacity) {
+        int newCap = flowHeapCapacity ? flowHeapCapacity * 2 : 4096;
+        FlowHeapEntry* grown = realloc(flowHeap, (size_t)newCap * sizeof(FlowHeapEntry));
+        if (!grown) return;
+        flowHeap = grown;
+        flowHeapCapacity = newCap;
+    }
+    int i = flowHeapSize++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (flowHeap[parent].cost <= cost) break;
+        flowHeap[i] = flowHeap[parent];
+        i = parent;
+    }
+    flowHeap[i] = (FlowHeapEntry){cost, idx};
+}
+
+static FlowHeapEntry FlowHeapPop(void) {
+    FlowHeapEntry top = flowHeap[0];
+    FlowHeapEntry last = flowHeap[--flowHeapSize];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= flowHeapSize) break;
+        if (child + 1 < flowHeapSize && flowHeap[child + 1].cost < flowHeap[child].cost) child++;
+        if (flowHeap[child].cost >= last.cost) break;
+        flowHeap[i] = flowHeap[child];
+        i = child;
+    }
+    if (flowHeapSize > 0) flowHeap[i] = last;
+    return top;
+}
+
+static inline void RelaxFlowCell(FlowField* f, int x, int y, int z, int cost, int nextIdx) {
+    int u = FieldCellIndex(f, x, y, z);
+    if (u < 0 || cost >= f->cost[u]) return;
+    f->cost[u] = cost;
+    f->next[u] = nextIdx;
+    FlowHeapPush(cost, u);
+}
+
+static void IntegrateFlowField(FlowField* f) {
+    static const int dx8[] = {0, 1, 1, 1, 0, -1, -1, -1};
+    static const int dy8[] = {-1, -1, 0, 1, 1, 1, 0, -1};
+    static const int dx4[] = {0, 1, 0, -1};
+    static const int dy4[] = {-1, 0, 1, 0};
+    const int* dx = use8Dir ? dx8 : dx4;
+    const int* dy = use8Dir ? dy8 : dy4;
+    int numDirs = use8Dir ? 8 : 4;
+
+    int cells = f->width * f->height * f->depth;
+    for (int i = 0; i < cells; i++) {
+        f->cost[i] = FLOW_COST_INF;
+        f->next[i] = -1;
+    }
+    f->dirty = false;
+    flowFieldBuildCount++;
+
+    int goalIdx = FieldCellIndex(f, f->goal.x, f->goal.y, f->goal.z);
+    if (goalIdx < 0 || !IsCellWalkableAt(f->goal.z, f->goal.y, f->goal.x)) return;
+    f->cost[goalIdx] = 0;
+    flowHeapSize = 0;
+    FlowHeapPush(0, goalIdx);
+
+    while (flowHeapSize > 0) {
+        FlowHeapEntry top = FlowHeapPop();
+        int v = top.idx;
+        if (top.cost > f->cost[v]) continue;  // stale entry
+        Point p = FieldCellPoint(f, v);
+        int vx = p.x, vy = p.y, vz = p.z;
+        int stepCost = GetCellMoveCost(vx, vy, vz);  // moves are priced by the destination cell
+        bool walkable = IsCellWalkableAt(vz, vy, vx);
+
+        // Same-level steps into v
+        if (walkable) {
+            for (int i = 0; i < numDirs; i++) {
+                int ux = vx - dx[i], uy = vy - dy[i];
+                if (dx[i] != 0 && dy[i] != 0) {
+                    if (!IsCellWalkableAt(vz, uy, vx) || !IsCellWalkableAt(vz, vy, ux)) continue;
+                }
+                if (!CanEnterRampFromSide(vx, vy, vz, ux, uy)) continue;
+                int baseCost = (dx[i] != 0 && dy[i] != 0) ? 14 : 10;
+                RelaxFlowCell(f, ux, uy, vz, top.cost + (baseCost * stepCost) / 10, v);
+            }
+        }
+
+        // Ladder climbs into v
+        if (vz > 0 && CanClimbUpAt(vx, vy, vz - 1)) {
+            RelaxFlowCell(f, vx, vy, vz - 1, top.cost + stepCost, v);
+        }
+        if (vz + 1 < f->depth && CanClimbDownAt(vx, vy, vz + 1)) {
+            RelaxFlowCell(f, vx, vy, vz + 1, top.cost + stepCost, v);
+        }
+
+        // Walking up a ramp below whose high side exits onto v
+        if (vz > 0) {
+            static const int ox[] = {0, 1, 0, -1};
+            static const int oy[] = {-1, 0, 1, 0};
+            for (int i = 0; i < 4; i++) {
+                int rx = vx + ox[i], ry = vy + oy[i];
+                if (rx < 0 || rx >= gridWidth || ry < 0 || ry >= gridHeight) continue;
+                if (!CanWalkUpRampAt(rx, ry, vz - 1)) continue;
+                int highDx, highDy;
+                GetRampHighSideOffset(grid[vz - 1][ry][rx], &highDx, &highDy);
+                if (rx + highDx != vx || ry + highDy != vy) continue;
+                RelaxFlowCell(f, rx, ry, vz - 1, top.cost + (14 * stepCost) / 10, v);
+            }
+        }
+
+        // Walking down onto ramp v from the exit cell above its high side
+        if (walkable && vz + 1 < f->depth && CellIsDirectionalRamp(grid[vz][vy][vx])) {
+            int highDx, highDy;
+            GetRampHighSideOffset(grid[vz][vy][vx], &highDx, &highDy);
+            RelaxFlowCell(f, vx + highDx, vy + highDy, vz + 1, top.cost + (14 * stepCost) / 10, v);
+        }
+    }
+}
+
+// --- Queries ---
+
+int SampleFlowField(int handle, Point from, Point* outPath, int maxLen) {
+    FlowField* f = FieldFromHandle(handle);
+    if (!f || maxLen < 1) return 0;
+    if (f->dirty) IntegrateFlowField(f);
+    f->lastUsed = ++flowUseStamp;
+
+    int idx = FieldCellIndex(f, from.x, from.y, from.z);
+    if (idx < 0 || f->cost[idx] >= FLOW_COST_INF || f->next[idx] < 0) return 0;
+
+    // Walk forward from `from`, then reverse into goal-to-start order
+    int len = 0;
+    outPath[len++] = from;
+    while (len < maxLen && f->next[idx] >= 0) {
+        idx = f->next[idx];
+        outPath[len++] = FieldCellPoint(f, idx);
+    }
+    for (int i = 0, j = len - 1; i < j; i++, j--) {
+        Point t = outPath[i];
+        outPath[i] = outPath[j];
+        outPath[j] = t;
+    }
+    return len;
+}
+
+int GetFlowFieldCost(int handle, Point p) {
+    FlowField* f = FieldFromHandle(handle);
+    if (!f) return FLOW_COST_INF;
+    if (f->dirty) IntegrateFlowField(f);
+    int idx = FieldCellIndex(f, p.x, p.y, p.z);
+    return idx < 0 ? FLOW_COST_INF : f->cost[idx];
+}
@@ -0,0 +1,72 @@
+// flow_field.h - Shared integration fields for crowds heading to one goal
+//
+// A flow field holds, for every cell in a box of chunk columns around a goal,
+// the cost to reach that goal and the next cell to step to. It is one
+// Dijkstra run from the goal over the reversed movement graph (same
+// walkability, terrain cost, ladder and ramp rules as A*), so any number of
+// movers heading to the goal can follow it without their own search.
+//
+// Fields are cached and ref-counted. Unreferenced fields stay cached until
+// their slot is needed for another goal. A cell edit inside a field's box
+// (MarkChunkDirty) marks it dirty; it is re-integrated on its next use.
+//
+// Usage:
+//   int f = AcquireFlowField(goal, start);         // 0 if no field could cover start
+//   int n = SampleFlowField(f, start, out, 9);     // up to 8 steps, goal-to-start like FindPath
+//   ReleaseFlowField(f);
+
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "pathfinding.h"
+#include <stdbool.h>
+
+#define MAX_FLOW_FIELDS 16
+#define FLOW_FIELD_MARGIN_CHUNKS 1    // chunks added around goal/sources so detours fit
+#define FLOW_FIELD_MAX_CELLS (1 << 20) // largest box (w * h * depth) a field may cover
+#define FLOW_FIELD_MIN_MOVERS 4       // repath requests for one goal before a field is built
+#define FLOW_FIELD_DEMAND_WINDOW 120  // ticks a demand count stays alive without new requests
+#define FLOW_FIELD_LOOKAHEAD 8        // cells a mover pulls from its field per refill
+#define FLOW_COST_INF 0x3fffffff
+
+typedef struct {
+    bool active;
+    bool dirty;         // region changed or grew: re-integrate before next sample
+    Point goal;
+    int refCount;
+    int minX, minY, maxX, maxY;  // covered cells [min, max) on every z-level
+    int width, height, depth;
+    int* cost;          // cost to goal per covered cell, FLOW_COST_INF if unreachable
+    int* next;          // covered-cell index of the next step, -1 at the goal or unreachable
+    unsigned long lastUsed;  // use stamp for cache eviction
+} FlowField;
+
+// Field handles are 1-based so zero-initialized state means "no field"
+extern FlowField flowFields[MAX_FLOW_FIELDS];
+extern bool useFlowFields;      // Movers switch to a shared field once a goal is popular
+extern int flowFieldBuildCount; // integrations run (creation or re-integration after edits)
+
+// Find or create the field for goal and make sure it covers source.
+// Returns a handle with one reference taken, or 0 (goal unwalkable, box too big, all slots in use).
+int AcquireFlowField(Point goal, Point source);
+void ReleaseFlowField(int handle);
+int FindFlowField(Point goal);  // cached field for goal (may be unreferenced), 0 if none
+
+// Walk up to maxLen-1 steps down the field from `from`. Writes goal-to-start
+// like FindPath (out[len-1] = from). Returns 0 if from is outside the field,
+// unreachable, or already the goal.
+int SampleFlowField(int handle, Point from, Point* outPath, int maxLen);
+
+// Cost to the goal from p (FLOW_COST_INF if unreachable or outside the field)
+int GetFlowFieldCost(int handle, Point p);
+
+// Count a repath request for goal at tick; returns requests seen in the current window
+int NoteFlowFieldDemand(Point goal, unsigned long tick);
+
+// Mark fields whose box contains the edited cell for re-integration
+void MarkFlowFieldsDirty(int x, int y, int z);
+
+// Drop every field and demand count (grid re-init, mover reset)
+void ClearFlowFields(void);
+
+#endif // FLOW_FIELD_H
@@ -4,16 +4,27 @@
 #include "pathfinding.h"
 #include "../simulation/water.h"
 #include "../simulation/fire.h"
+#include "../simulation/smoke.h"
+#include "../simulation/steam.h"
+#include "../simulation/weather.h"
+#include "../simulation/floordirt.h"
+#include "designations.h"
 #include "../core/event_log.h"
 #include "../simulation/rooms.h"
+#include "../simulation/area_sums.h"
+#include "../simulation/groundwear.h"
+#include "flow_field.h"
+#include "reach_cache.h"
+#include "../core/sim_manager.h"
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 
-CellType grid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t cellFlags[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t vegetationGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t trackConnections[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t exploredGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(CellType, grid);
+DEFINE_WORLD_LAYER(uint8_t, cellFlags);
+DEFINE_WORLD_LAYER(uint8_t, vegetationGrid);
+DEFINE_WORLD_LAYER(uint8_t, trackConnections);
+DEFINE_WORLD_LAYER(uint8_t, exploredGrid);
 bool needsRebuild = false;
 bool hpaNeedsRebuild = false;
 bool jpsNeedsRebuild = false;
@@ -23,6 +34,88 @@ bool jpsNeedsRebuild = false;
 int gridWidth = MAX_GRID_WIDTH;
 int gridHeight = MAX_GRID_HEIGHT;
 int gridDepth = MAX_GRID_DEPTH;
+
+// --- World layer storage ---
+// Layers keep the MAX_GRID_* strides so layer[z][y][x] indexing is unchanged,
+// but live on the heap: calloc hands out untouched zero pages, so only the
+// cells a world actually uses become resident. Clears and fills stop at the
+// largest extent any world has used since startup (cells past it are still
+// zero from the reservation).
+static size_t worldLayerBytes = 0;
+static int layerExtentW = 0;
+static int layerExtentH = 0;
+
+void* AllocWorldBuffer(size_t bytes, const char* name) {
+    void* p = calloc(1, bytes);
+    if (!p) {
+        fprintf(stderr, "Out of memory reserving world layer %s (%zu bytes)\n", name, bytes);
+        abort();
+    }
+    worldLayerBytes += bytes;
+    return p;
+}
+
+void* AllocWorldLayer(size_t cellSize, const char* name) {
+    return AllocWorldBuffer((size_t)MAX_GRID_DEPTH * MAX_GRID_HEIGHT * MAX_GRID_WIDTH * cellSize, name);
+}
+
+size_t WorldLayerReservedBytes(void) {
+    return worldLayerBytes;
+}
+
+static void GrowLayerExtent(void) {
+    if (gridWidth > layerExtentW) layerExtentW = gridWidth;
+    if (gridHeight > layerExtentH) layerExtentH = gridHeight;
+    if (layerExtentW > MAX_GRID_WIDTH) layerExtentW = MAX_GRID_WIDTH;
+    if (layerExtentH > MAX_GRID_HEIGHT) layerExtentH = MAX_GRID_HEIGHT;
+}
+
+void ClearWorldLayer(void* layer, size_t cellSize) {
+    GrowLayerExtent();
+    size_t rowStride = (size_t)MAX_GRID_WIDTH * cellSize;
+    size_t rowBytes = (size_t)layerExtentW * cellSize;
+    char* base = (char*)layer;
+    for (int z = 0; z < MAX_GRID_DEPTH; z++) {
+        char* level = base + (size_t)z * MAX_GRID_HEIGHT * rowStride;
+        for (int y = 0; y < layerExtentH; y++) {
+            memset(level + (size_t)y * rowStride, 0, rowBytes);
+        }
+    }
+}
+
+void FillWorldLayer(void* layer, size_t cellSize, const void* cellValue) {
+    GrowLayerExtent();
+    size_t rowStride = (size_t)MAX_GRID_WIDTH * cellSize;
+    char* base = (char*)layer;
+    bool byteFill = true;
+    for (size_t i = 1; i < cellSize; i++) {
+        if (((const char*)cellValue)[i] != ((const char*)cellValue)[0]) byteFill = false;
+    }
+    for (int z = 0; z < MAX_GRID_DEPTH; z++) {
+        char* level = base + (size_t)z * MAX_GRID_HEIGHT * rowStride;
+        for (int y = 0; y < layerExtentH; y++) {
+            char* row = level + (size_t)y * rowStride;
+            if (byteFill) {
+                memset(row, ((const unsigned char*)cellValue)[0], (size_t)layerExtentW * cellSize);
+            } else {
+                for (int x = 0; x < layerExtentW; x++) {
+                    memcpy(row + (size_t)x * cellSize, cellValue, cellSize);
+                }
+            }
+        }
+    }
+}
+// Size every paged layer's page tables to the world just set up
+static void InitPagedLayers(void) {
+    InitPagedLayer(&designationLayer);
+    InitPagedLayer(&fireLayer);
+    InitPagedLayer(&smokeLayer);
+    InitPagedLayer(&steamLayer);
+    InitPagedLayer(&snowLayer);
+    InitPagedLayer(&snowAccumLayer);
+    InitPagedLayer(&floorDirtLayer);
+}
+
 int chunkWidth = DEFAULT_CHUNK_SIZE;
 int chunkHeight = DEFAULT_CHUNK_SIZE;
 int chunksX = MAX_GRID_WIDTH / DEFAULT_CHUNK_SIZE;
@@ -52,10 +145,12 @@ void InitGridWithSizeAndChunkSize(int width, int height, int chunkW, int chunkH)
     rampCount = 0;
 
     // Clear the grid (all z-levels), cell flags, vegetation, and materials
-    memset(cellFlags, 0, sizeof(cellFlags));
-    memset(vegetationGrid, 0, sizeof(vegetationGrid));
-    memset(exploredGrid, 1, sizeof(exploredGrid));  // Default: all explored (sandbox)
+    CLEAR_WORLD_LAYER(cellFlags);
+    CLEAR_WORLD_LAYER(vegetationGrid);
+    uint8_t explored = 1;
+    FILL_WORLD_LAYER(exploredGrid, &explored);  // Default: all explored (sandbox)
     InitMaterials();
+    InitPagedLayers();
     
     for (int z = 0; z < gridDepth; z++) {
         for (int y = 0; y < gridHeight; y++) {
@@ -68,6 +163,18 @@ void InitGridWithSizeAndChunkSize(int width, int height, int chunkW, int chunkH)
 
     needsRebuild = true;
     jpsNeedsRebuild = true;
+    InvalidateAreaSums();
+    InitRooms();
+    ClearFlowFields();
+    ClearReachCache();
+    RebuildChunkActivity();  // chunk size may have changed
+}
+
+void SetCellWetness(int x, int y, int z, int wetness) {
+    int old = GET_CELL_WETNESS(x, y, z);
+    cellFlags[z][y][x] = (cellFlags[z][y][x] & ~CELL_WETNESS_MASK) | (wetness << CELL_WETNESS_SHIFT);
+    if (old == 0 && wetness > 0) ChunkActivityAdd(ACTIVITY_WETNESS, x, y, z, 1);
+    if (old > 0 && wetness == 0) ChunkActivityAdd(ACTIVITY_WETNESS, x, y, z, -1);
 }
 
 void InitGridWithSize(int width, int height) {
@@ -512,6 +619,10 @@ void ClearCellCleanup(int x, int y, int z) {
     
     CellType current = grid[z][y][x];
     
+    // Wear belongs to the dirt being replaced; dropping it here keeps the
+    // worn-cell counts exact whatever the cell becomes
+    SetGroundWear(x, y, z, 0);
+    
     // Check for ramps
     if (CellIsDirectionalRamp(current)) {
         EraseRamp(x, y, z);
@@ -568,7 +679,7 @@ void PlaceCellFull(int x, int y, int z, CellPlacementSpec spec) {
     // Clear flags and mark dirty
     CLEAR_CELL_FLAG(x, y, z, CELL_FLAG_BURNED);
     MarkChunkDirty(x, y, z);
-    InvalidateRooms();
+    InvalidateRoomsAt(x, y, z);
 }
 
 int InitGridFromAscii(const char* ascii) {
@@ -723,7 +834,7 @@ static void CheckDiscoveriesAtCell(int x, int y, int z, RevealDiscoveries *d) {
     if (grid[z][y][x] == CELL_BUSH) {
         d->bushes++;
     }
-    if (fireGrid[z][y][x].fuel > 0) {
+    if (FireCellAt(x, y, z)->fuel > 0) {
         if (d->fires == 0) { d->firstFireX = x; d->firstFireY = y; d->firstFireZ = z; }
         d->fires++;
     }
@@ -3,14 +3,22 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
 
 // Note: CellPlacementSpec uses MaterialType and SurfaceFinish from material.h
 // Users of PlaceCellFull() should include "material.h" for full type definitions
 
-// Maximum grid dimensions (for static array allocation)
+// Maximum grid dimensions. Per-cell layers use them as row/level strides;
+// override at build time for bigger worlds (make WORLD_CAPS=...).
+#ifndef MAX_GRID_WIDTH
 #define MAX_GRID_WIDTH  512
+#endif
+#ifndef MAX_GRID_HEIGHT
 #define MAX_GRID_HEIGHT 512
+#endif
+#ifndef MAX_GRID_DEPTH
 #define MAX_GRID_DEPTH  16          // Z-levels
+#endif
 #define DEFAULT_CHUNK_SIZE  16
 
 // Runtime grid and chunk dimensions
@@ -27,6 +35,42 @@ extern int chunksY;
 #define MAX_CHUNKS_X (MAX_GRID_WIDTH / 8)   // minimum chunk size of 8
 #define MAX_CHUNKS_Y (MAX_GRID_HEIGHT / 8)
 
+// --- World layers ---
+// A per-cell layer is a heap pointer indexed layer[z][y][x] like a static
+// array, reserved at startup for the caps. Reserved pages cost nothing until
+// written, and layer clears only touch the rows of the largest world used so
+// far, so a small world's footprint scales with its size instead of the caps.
+//
+//   DEFINE_WORLD_LAYER(WaterCell, waterGrid);       // in water.c
+//   extern WORLD_LAYER(WaterCell, waterGrid);       // in water.h
+//   CLEAR_WORLD_LAYER(waterGrid);                   // instead of memset
+#define WORLD_LAYER(type, name) type (*name)[MAX_GRID_HEIGHT][MAX_GRID_WIDTH]
+
+// The reservation is made by a constructor before main. The trailing
+// assert takes the use site's semicolon and catches caps too large to reserve.
+#define WORLD_LAYER_STORAGE(storage, type, name) \
+    storage WORLD_LAYER(type, name); \
+    __attribute__((constructor)) static void AllocWorldLayer_##name(void) { \
+        name = AllocWorldLayer(sizeof(type), #name); \
+    } \
+    _Static_assert((size_t)MAX_GRID_DEPTH * MAX_GRID_HEIGHT * MAX_GRID_WIDTH <= SIZE_MAX / sizeof(type), \
+                   "world layer " #name " is too large to reserve")
+#define DEFINE_WORLD_LAYER(type, name) WORLD_LAYER_STORAGE(, type, name)
+#define DEFINE_STATIC_WORLD_LAYER(type, name) WORLD_LAYER_STORAGE(static, type, name)
+
+#define CLEAR_WORLD_LAYER(name) ClearWorldLayer((name), sizeof((name)[0][0][0]))
+#define FILL_WORLD_LAYER(name, cellValuePtr) FillWorldLayer((name), sizeof((name)[0][0][0]), (cellValuePtr))
+
+// Reserves MAX_GRID_DEPTH levels of zeroed cells (aborts if out of memory)
+void* AllocWorldLayer(size_t cellSize, const char* name);
+// Same for layers with their own shape (prefix sums with a border row)
+void* AllocWorldBuffer(size_t bytes, const char* name);
+// Zero / set every cell that any world so far could have written
+void ClearWorldLayer(void* layer, size_t cellSize);
+void FillWorldLayer(void* layer, size_t cellSize, const void* cellValue);
+// Bytes reserved for all layers (virtual; resident is what was written)
+size_t WorldLayerReservedBytes(void);
+
 typedef enum { 
     CELL_WALL, 
     CELL_AIR, 
@@ -63,10 +107,10 @@ static inline const char* CellTypeName(int type) {
     return (type >= 0 && type < CELL_TYPE_COUNT) ? names[type] : "?";
 }
 
-extern CellType grid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(CellType, grid);
 
 // Cell flags - per-cell terrain properties (burned, wetness, etc.)
-extern uint8_t cellFlags[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, cellFlags);
 
 // Cell flag bits
 #define CELL_FLAG_BURNED    (1 << 0)  // Bit 0: cell has been burned
@@ -99,14 +143,14 @@ typedef enum {
     VEG_REEDS,          // Reeds (waterside, harvestable)
 } VegetationType;
 
-extern uint8_t vegetationGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, vegetationGrid);
 
 #define GetVegetation(x,y,z)      ((VegetationType)vegetationGrid[z][y][x])
 #define SetVegetation(x,y,z,v)    (vegetationGrid[z][y][x] = (uint8_t)(v))
 
 // Track connections grid — 4-bit bitmask per cell: N=1, E=2, S=4, W=8
 // Stores which directions a track cell is connected to (intent-aware, not just adjacency)
-extern uint8_t trackConnections[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, trackConnections);
 
 #define TRACK_N 1
 #define TRACK_E 2
@@ -114,7 +158,7 @@ extern uint8_t trackConnections[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH]
 #define TRACK_W 8
 
 // Exploration grid — fog of war (0=unexplored, 1=explored)
-extern uint8_t exploredGrid[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, exploredGrid);
 
 #define DEFAULT_MOVER_VISION_RADIUS  10
 #define DEFAULT_SPAWN_VISION_RADIUS  12
@@ -140,12 +184,15 @@ static inline void SetExplored(int x, int y, int z) {
 // Reveal all cells within radius of a point, extending vertically through air
 void RevealAroundPoint(int cx, int cy, int cz, int radius);
 
+// Set cell wetness (0-3) and keep per-chunk wetness activity in sync (use via SET_CELL_WETNESS)
+void SetCellWetness(int x, int y, int z, int wetness);
+
 // Cell flag helpers
 #define HAS_CELL_FLAG(x,y,z,f)     (!!(cellFlags[z][y][x] & (f)))
 #define SET_CELL_FLAG(x,y,z,f)     (cellFlags[z][y][x] |= (f))
 #define CLEAR_CELL_FLAG(x,y,z,f)   (cellFlags[z][y][x] &= ~(f))
 #define GET_CELL_WETNESS(x,y,z)    ((cellFlags[z][y][x] & CELL_WETNESS_MASK) >> CELL_WETNESS_SHIFT)
-#define SET_CELL_WETNESS(x,y,z,w)  (cellFlags[z][y][x] = (cellFlags[z][y][x] & ~CELL_WETNESS_MASK) | ((w) << CELL_WETNESS_SHIFT))
+#define SET_CELL_WETNESS(x,y,z,w)  SetCellWetness((x), (y), (z), (w))
 #define GET_CELL_SURFACE(x,y,z)    ((cellFlags[z][y][x] & CELL_SURFACE_MASK) >> CELL_SURFACE_SHIFT)
 #define SET_CELL_SURFACE(x,y,z,s)  (cellFlags[z][y][x] = (cellFlags[z][y][x] & ~CELL_SURFACE_MASK) | ((s) << CELL_SURFACE_SHIFT))
 // Floor flag helpers (for constructed floors over empty space)
@@ -210,7 +257,7 @@ CellType AutoDetectRampDirection(int x, int y, int z);
 // Ramp placement - places ramp if valid, pushes movers/items out
 void PlaceRamp(int x, int y, int z, CellType rampType);
 
-// Clean up special cell types (ramps/ladders) before overwriting a cell
+// Clean up special cell types (ramps/ladders) and ground wear before overwriting a cell
 void ClearCellCleanup(int x, int y, int z);
 
 // Ramp erasure - removes ramp, replaces with walkable/air
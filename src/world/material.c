@@ -13,14 +13,14 @@
 static int spriteOverrides[CELL_TYPE_COUNT][MAT_COUNT];
 
 // Separate grids for wall and floor materials
-uint8_t wallMaterial[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t floorMaterial[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t wallNatural[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t floorNatural[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t wallFinish[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t floorFinish[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t wallSourceItem[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-uint8_t floorSourceItem[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(uint8_t, wallMaterial);
+DEFINE_WORLD_LAYER(uint8_t, floorMaterial);
+DEFINE_WORLD_LAYER(uint8_t, wallNatural);
+DEFINE_WORLD_LAYER(uint8_t, floorNatural);
+DEFINE_WORLD_LAYER(uint8_t, wallFinish);
+DEFINE_WORLD_LAYER(uint8_t, floorFinish);
+DEFINE_WORLD_LAYER(uint8_t, wallSourceItem);
+DEFINE_WORLD_LAYER(uint8_t, floorSourceItem);
 
 MaterialDef materialDefs[MAT_COUNT] = {
     //                 name       sprite                    flags         fuel  ignRes  dropsItem     insul                  burnsInto
@@ -91,14 +91,15 @@ int GetSpriteForCellMat(CellType cell, MaterialType mat) {
 void InitMaterials(void) {
     // All cells start with no material — SyncMaterialsToTerrain sets correct
     // materials after terrain generation. This avoids air cells having MAT_GRANITE.
-    memset(wallMaterial, MAT_NONE, sizeof(wallMaterial));
-    memset(floorMaterial, MAT_NONE, sizeof(floorMaterial));
-    memset(wallNatural, 0, sizeof(wallNatural));
-    memset(floorNatural, 0, sizeof(floorNatural));
-    memset(wallFinish, FINISH_ROUGH, sizeof(wallFinish));
-    memset(floorFinish, FINISH_ROUGH, sizeof(floorFinish));
-    memset(wallSourceItem, 0xFF, sizeof(wallSourceItem));
-    memset(floorSourceItem, 0xFF, sizeof(floorSourceItem));
+    uint8_t none = MAT_NONE, rough = FINISH_ROUGH, noSource = 0xFF;
+    FILL_WORLD_LAYER(wallMaterial, &none);
+    FILL_WORLD_LAYER(floorMaterial, &none);
+    CLEAR_WORLD_LAYER(wallNatural);
+    CLEAR_WORLD_LAYER(floorNatural);
+    FILL_WORLD_LAYER(wallFinish, &rough);
+    FILL_WORLD_LAYER(floorFinish, &rough);
+    FILL_WORLD_LAYER(wallSourceItem, &noSource);
+    FILL_WORLD_LAYER(floorSourceItem, &noSource);
     InitSpriteOverrides();
 }
 
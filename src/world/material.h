@@ -64,18 +64,18 @@ typedef struct {
 extern MaterialDef materialDefs[];
 
 // Separate grids for wall and floor materials (like Dwarf Fortress)
-extern uint8_t wallMaterial[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-extern uint8_t floorMaterial[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, wallMaterial);
+extern WORLD_LAYER(uint8_t, floorMaterial);
 // Natural flags for wall and floor materials
-extern uint8_t wallNatural[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-extern uint8_t floorNatural[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, wallNatural);
+extern WORLD_LAYER(uint8_t, floorNatural);
 // Finish grids for wall and floor surfaces
-extern uint8_t wallFinish[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-extern uint8_t floorFinish[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, wallFinish);
+extern WORLD_LAYER(uint8_t, floorFinish);
 // Source item grids: what item type was used to construct this wall/floor
 // 0xFF (ITEM_NONE as uint8_t) = natural terrain or unknown
-extern uint8_t wallSourceItem[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
-extern uint8_t floorSourceItem[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(uint8_t, wallSourceItem);
+extern WORLD_LAYER(uint8_t, floorSourceItem);
 
 // Wall material accessors
 #define GetWallMaterial(x,y,z)      (wallMaterial[z][y][x])
@@ -0,0 +1,219 @@
+// paged_layer.c - Chunk-paged storage for sparse per-cell layers
+#include "paged_layer.h"
+#include <stdlib.h>
+#include <string.h>
+
+static void* PageAlloc(const PagedLayer* layer, size_t bytes) {
+    void* p = malloc(bytes);
+    if (!p) {
+        fprintf(stderr, "Out of memory allocating a %s page\n", layer->name);
+        abort();
+    }
+    return p;
+}
+
+void InitPagedLayer(PagedLayer* layer) {
+    if (!layer->defaultPage) {
+        layer->defaultPage = PageAlloc(layer, PAGE_CELLS * layer->cellSize);
+        for (int i = 0; i < PAGE_CELLS; i++) {
+            memcpy(layer->defaultPage + (size_t)i * layer->cellSize, layer->defaultCell, layer->cellSize);
+        }
+    }
+    int pagesX = (gridWidth + PAGE_SIZE - 1) / PAGE_SIZE;
+    int pagesY = (gridHeight + PAGE_SIZE - 1) / PAGE_SIZE;
+    int pagesZ = gridDepth;
+    if (layer->pages && pagesX == layer->pagesX && pagesY == layer->pagesY && pagesZ == layer->pagesZ) return;
+
+    ClearPagedLayer(layer);
+    free(layer->pages);
+    free(layer->slot);
+    free(layer->allocated);
+    size_t count = (size_t)pagesX * pagesY * pagesZ;
+    layer->pagesX = pagesX;
+    layer->pagesY = pagesY;
+    layer->pagesZ = pagesZ;
+    layer->pages = PageAlloc(layer, count * sizeof(*layer->pages));
+    layer->slot = PageAlloc(layer, count * sizeof(*layer->slot));
+    layer->allocated = PageAlloc(layer, count * sizeof(*layer->allocated));
+    for (size_t i = 0; i < count; i++) {
+        layer->pages[i] = layer->defaultPage;
+        layer->slot[i] = -1;
+    }
+    layer->allocatedCount = 0;
+    layer->peakAllocated = 0;
+    layer->reclaimCursor = 0;
+}
+
+static void FreeLayerPage(PagedLayer* layer, int px, int py, int z) {
+    int index = PageIndex(layer, px, py, z);
+    int slot = layer->slot[index];
+    if (slot < 0) return;
+    free(layer->pages[index]);
+    layer->pages[index] = layer->defaultPage;
+    layer->slot[index] = -1;
+
+    // Swap-remove from the allocated list
+    int last = --layer->allocatedCount;
+    if (slot != last) {
+        int movedId = layer->allocated[last];
+        int mx, my, mz;
+        PageCoords(movedId, &mx, &my, &mz);
+        layer->allocated[slot] = movedId;
+        layer->slot[PageIndex(layer, mx, my, mz)] = slot;
+    }
+}
+
+void ClearPagedLayer(PagedLayer* layer) {
+    while (layer->allocatedCount > 0) {
+        int px, py, z;
+        PageCoords(layer->allocated[layer->allocatedCount - 1], &px, &py, &z);
+        FreeLayerPage(layer, px, py, z);
+    }
+    layer->reclaimCursor = 0;
+}
+
+uint8_t* AllocLayerPage(PagedLayer* layer, int px, int py, int z) {
+    int index = PageIndex(layer, px, py, z);
+    if (layer->slot[index] >= 0) return layer->pages[index];
+    size_t bytes = PAGE_CELLS * layer->cellSize;
+    uint8_t* page = PageAlloc(layer, bytes);
+    memcpy(page, layer->defaultPage, bytes);
+    layer->pages[index] = page;
+    layer->slot[index] = layer->allocatedCount;
+    layer->allocated[layer->allocatedCount++] = PageId(px, py, z);
+    if (layer->allocatedCount > layer->peakAllocated) layer->peakAllocated = layer->allocatedCount;
+    return page;
+}
+
+static bool PageIsDefault(const PagedLayer* layer, const uint8_t* page) {
+    for (int i = 0; i < PAGE_CELLS; i++) {
+        if (!layer->cellIsDefault(page + (size_t)i * layer->cellSize)) return false;
+    }
+    return true;
+}
+
+int ReclaimPagedLayer(PagedLayer* layer, int budget) {
+    int freed = 0;
+    for (int n = 0; n < budget && layer->allocatedCount > 0; n++) {
+        if (layer->reclaimCursor >= layer->allocatedCount) layer->reclaimCursor = 0;
+        int px, py, z;
+        PageCoords(layer->allocated[layer->reclaimCursor], &px, &py, &z);
+        if (PageIsDefault(layer, PagedLayerPage(layer, px, py, z))) {
+            // The last page moves into this slot; check it next
+            FreeLayerPage(layer, px, py, z);
+            freed++;
+        } else {
+            layer->reclaimCursor++;
+        }
+    }
+    return freed;
+}
+
+bool ReclaimLayerPageAt(PagedLayer* layer, int x, int y, int z) {
+    int px = x >> PAGE_SHIFT, py = y >> PAGE_SHIFT;
+    if (!PagedLayerHasPage(layer, px, py, z)) return false;
+    if (!PageIsDefault(layer, PagedLayerPage(layer, px, py, z))) return false;
+    FreeLayerPage(layer, px, py, z);
+    return true;
+}
+
+size_t PagedLayerBytes(const PagedLayer* layer) {
+    return (size_t)layer->allocatedCount * PAGE_CELLS * layer->cellSize;
+}
+
+// --- Save / load ---
+
+static bool PageInWorld(const PagedLayer* layer, int px, int py, int z) {
+    return px * PAGE_SIZE < gridWidth && py * PAGE_SIZE < gridHeight && z < gridDepth &&
+           px < layer->pagesX && py < layer->pagesY && z < layer->pagesZ;
+}
+
+void SavePagedLayer(FILE* f, const PagedLayer* layer) {
+    uint32_t count = 0;
+    for (int i = 0; i < layer->allocatedCount; i++) {
+        int px, py, z;
+        PageCoords(layer->allocated[i], &px, &py, &z);
+        if (PageInWorld(layer, px, py, z)) count++;
+    }
+    fwrite(&count, sizeof(count), 1, f);
+    // Ascending page order so the same world always saves to the same bytes
+    for (int z = 0; z < gridDepth && z < layer->pagesZ; z++) {
+        for (int py = 0; py * PAGE_SIZE < gridHeight && py < layer->pagesY; py++) {
+            for (int px = 0; px * PAGE_SIZE < gridWidth && px < layer->pagesX; px++) {
+                if (!PagedLayerHasPage(layer, px, py, z)) continue;
+                int16_t coords[3] = { (int16_t)px, (int16_t)py, (int16_t)z };
+                fwrite(coords, sizeof(coords), 1, f);
+                fwrite(PagedLayerPage(layer, px, py, z), layer->cellSize, PAGE_CELLS, f);
+            }
+        }
+    }
+}
+
+bool LoadPagedLayer(FILE* f, PagedLayer* layer) {
+    ClearPagedLayer(layer);
+    uint32_t count = 0;
+    if (fread(&count, sizeof(count), 1, f) != 1) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        int16_t coords[3];
+        if (fread(coords, sizeof(coords), 1, f) != 1) return false;
+        int px = coords[0], py = coords[1], z = coords[2];
+        if (px < 0 || py < 0 || z < 0 || !PageInWorld(layer, px, py, z)) {
+            if (fseek(f, (long)(layer->cellSize * PAGE_CELLS), SEEK_CUR) != 0) return false;
+            continue;
+        }
+        uint8_t* page = AllocLayerPage(layer, px, py, z);
+        if (fread(page, layer->cellSize, PAGE_CELLS, f) != PAGE_CELLS) return false;
+    }
+    return true;
+}
+
+void LoadDensePagedLayer(FILE* f, PagedLayer* layer) {
+    ClearPagedLayer(layer);
+    uint8_t* row = PageAlloc(layer, (size_t)gridWidth * layer->cellSize);
+    for (int z = 0; z < gridDepth; z++) {
+        for (int y = 0; y < gridHeight; y++) {
+            if (fread(row, layer->cellSize, gridWidth, f) != (size_t)gridWidth) {
+                free(row);
+                return;
+            }
+            for (int x = 0; x < gridWidth; x++) {
+                const uint8_t* cell = row + (size_t)x * layer->cellSize;
+                if (layer->cellIsDefault(cell)) continue;
+                memcpy(PagedLayerCellForWrite(layer, x, y, z), cell, layer->cellSize);
+            }
+        }
+    }
+    free(row);
+}
+
+bool SkipPagedLayer(FILE* f, size_t cellSize) {
+    uint32_t count = 0;
+    if (fread(&count, sizeof(count), 1, f) != 1) return false;
+    long pageBytes = (long)(sizeof(int16_t) * 3 + cellSize * PAGE_CELLS);
+    return fseek(f, pageBytes * (long)count, SEEK_CUR) == 0;
+}
+
+bool ReadPagedLayerDense(FILE* f, size_t cellSize, void* dense, int w, int h, int d) {
+    uint32_t count = 0;
+    if (fread(&count, sizeof(count), 1, f) != 1) return false;
+    uint8_t page[PAGE_CELLS * 64];
+    if (cellSize > 64) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        int16_t coords[3];
+        if (fread(coords, sizeof(coords), 1, f) != 1) return false;
+        if (fread(page, cellSize, PAGE_CELLS, f) != PAGE_CELLS) return false;
+        int z = coords[2];
+        if (z < 0 || z >= d) continue;
+        for (int ly = 0; ly < PAGE_SIZE; ly++) {
+            int y = coords[1] * PAGE_SIZE + ly;
+            if (y < 0 || y >= h) continue;
+            for (int lx = 0; lx < PAGE_SIZE; lx++) {
+                int x = coords[0] * PAGE_SIZE + lx;
+                if (x < 0 || x >= w) continue;
+                size_t idx = ((size_t)z * h + y) * w + x;
+                memcpy((uint8_t*)dense + idx * cellSize, page + (size_t)(ly * PAGE_SIZE + lx) * cellSize, cellSize);
+            }
+        }
+    }
+    return true;
+}
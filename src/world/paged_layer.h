@@ -0,0 +1,136 @@
+// paged_layer.h - Chunk-paged storage for sparse per-cell layers
+//
+// Smoke, steam, fire, snow, floor dirt and designations are empty almost
+// everywhere. A paged layer splits each z-level into 16x16-cell pages (one
+// default-size chunk) and only allocates a page once something is written
+// to it. Every unallocated page points at one shared page of default cells,
+// so reads never branch: an empty cell reads as the default.
+//
+// Pages are freed again by ReclaimPagedLayer once all their cells are back
+// to default (the owner's cellIsDefault says what counts), so memory
+// follows activity. Scans walk the allocated-page list or skip unallocated
+// pages in a row, and saves only write allocated pages.
+//
+// Rules:
+//   - Read through the const accessor, write through the ...ForWrite one.
+//     Writing through a read pointer would change every empty cell.
+//   - Only call ...ForWrite when a write will happen (it allocates).
+//
+// The page tables cover the current world, not the caps: grid init calls
+// InitPagedLayer for every layer, which sizes them from gridWidth, gridHeight
+// and gridDepth. Cells outside the world have no page.
+//
+// Usage:
+//   DEFINE_PAGED_LAYER(SmokeCell, smokeLayer, &emptySmoke, SmokeCellIsEmpty);
+//   InitPagedLayer(&smokeLayer);                            // from grid init
+//   const SmokeCell* c = PagedLayerCell(&smokeLayer, x, y, z);
+//   SmokeCell* w = PagedLayerCellForWrite(&smokeLayer, x, y, z);
+//   ReclaimPagedLayer(&smokeLayer, PAGED_RECLAIM_BUDGET);   // once per update
+
+#ifndef PAGED_LAYER_H
+#define PAGED_LAYER_H
+
+#include "grid.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define PAGE_SHIFT 4
+#define PAGE_SIZE  (1 << PAGE_SHIFT)        // cells per page side
+#define PAGE_MASK  (PAGE_SIZE - 1)
+#define PAGE_CELLS (PAGE_SIZE * PAGE_SIZE)
+#define MAX_PAGES_X ((MAX_GRID_WIDTH + PAGE_SIZE - 1) / PAGE_SIZE)   // page id packing
+#define MAX_PAGES_Y ((MAX_GRID_HEIGHT + PAGE_SIZE - 1) / PAGE_SIZE)
+
+#define PAGED_RECLAIM_BUDGET 16             // pages checked per ReclaimPagedLayer call
+
+typedef bool (*PagedCellIsDefault)(const void* cell);
+
+typedef struct {
+    const char* name;
+    size_t cellSize;
+    const void* defaultCell;
+    PagedCellIsDefault cellIsDefault;
+    uint8_t* defaultPage;                   // shared by every unallocated page, never written
+    int pagesX, pagesY, pagesZ;             // table shape, set by InitPagedLayer
+    uint8_t** pages;                        // [pagesZ][pagesY][pagesX]
+    int32_t* slot;                          // same shape: index in allocated[], -1 if none
+    int32_t* allocated;                     // packed page ids, unordered
+    int allocatedCount;
+    int peakAllocated;
+    int reclaimCursor;
+} PagedLayer;
+
+// Defines the layer; it has no pages until InitPagedLayer sizes it
+#define DEFINE_PAGED_LAYER(type, layerName, defaultCellPtr, isDefaultFn) \
+    PagedLayer layerName = { .name = #layerName, .cellSize = sizeof(type), \
+                             .defaultCell = (defaultCellPtr), .cellIsDefault = (isDefaultFn) }
+
+// Sizes the page tables to the current world. A layer already sized for
+// it keeps its pages; one whose shape changes starts out all default.
+void InitPagedLayer(PagedLayer* layer);
+
+// Frees every page (the layer reads as all default)
+void ClearPagedLayer(PagedLayer* layer);
+
+// Allocates page (px, py, z) as a copy of the default page
+uint8_t* AllocLayerPage(PagedLayer* layer, int px, int py, int z);
+
+// Checks up to `budget` allocated pages (round robin) and frees the ones
+// whose cells are all default. Returns the number freed.
+int ReclaimPagedLayer(PagedLayer* layer, int budget);
+
+// Frees the page holding cell (x, y, z) if all its cells are default.
+// For layers without a per-tick update: call when a cell returns to default.
+bool ReclaimLayerPageAt(PagedLayer* layer, int x, int y, int z);
+
+static inline int PageIndex(const PagedLayer* layer, int px, int py, int z) {
+    return (z * layer->pagesY + py) * layer->pagesX + px;
+}
+
+// Page (px, py, z): the default page if unallocated
+static inline uint8_t* PagedLayerPage(const PagedLayer* layer, int px, int py, int z) {
+    return layer->pages[PageIndex(layer, px, py, z)];
+}
+
+static inline const void* PagedLayerCell(const PagedLayer* layer, int x, int y, int z) {
+    const uint8_t* page = PagedLayerPage(layer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z);
+    return page + (size_t)(((y & PAGE_MASK) << PAGE_SHIFT) | (x & PAGE_MASK)) * layer->cellSize;
+}
+
+static inline void* PagedLayerCellForWrite(PagedLayer* layer, int x, int y, int z) {
+    uint8_t* page = PagedLayerPage(layer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z);
+    if (page == layer->defaultPage) page = AllocLayerPage(layer, x >> PAGE_SHIFT, y >> PAGE_SHIFT, z);
+    return page + (size_t)(((y & PAGE_MASK) << PAGE_SHIFT) | (x & PAGE_MASK)) * layer->cellSize;
+}
+
+static inline bool PagedLayerHasPage(const PagedLayer* layer, int px, int py, int z) {
+    return PagedLayerPage(layer, px, py, z) != layer->defaultPage;
+}
+
+// Page id <-> coordinates (ids in allocated[], packed at the caps so they
+// don't depend on the table shape)
+static inline int PageId(int px, int py, int z) {
+    return (z * MAX_PAGES_Y + py) * MAX_PAGES_X + px;
+}
+static inline void PageCoords(int id, int* px, int* py, int* z) {
+    *px = id % MAX_PAGES_X;
+    *py = (id / MAX_PAGES_X) % MAX_PAGES_Y;
+    *z = id / (MAX_PAGES_X * MAX_PAGES_Y);
+}
+
+// Bytes held by allocated pages
+size_t PagedLayerBytes(const PagedLayer* layer);
+
+// --- Save format (v94+) ---
+// uint32 page count, then per page: int16 px, py, z + PAGE_CELLS cells.
+// Pages outside the world are skipped on save and load.
+void SavePagedLayer(FILE* f, const PagedLayer* layer);
+bool LoadPagedLayer(FILE* f, PagedLayer* layer);
+// Pre-v94 dense rows (gridWidth cells per row): only non-default cells are stored
+void LoadDensePagedLayer(FILE* f, PagedLayer* layer);
+// Sparse block into a dense w*h*d array already filled with defaults (inspector)
+bool ReadPagedLayerDense(FILE* f, size_t cellSize, void* dense, int w, int h, int d);
+bool SkipPagedLayer(FILE* f, size_t cellSize);
+
+#endif // PAGED_LAYER_H
@@ -12,6 +12,13 @@
 #include "grid.h"
 #include "cell_defs.h"
 #include "../simulation/lighting.h"
+#include "../simulation/area_sums.h"
+#include "flow_field.h"
+#include "../entities/path_index.h"
+#include "reach_cache.h"
+#include "cell_edits.h"
+#include "../../shared/profiler.h"
+#include "../core/event_log.h"
 /*
  *
  * IMPORTANT: JPS/JPS+ LIMITATIONS
@@ -50,7 +57,14 @@
 
 #include "pathfinding.h"
 #include "../../vendor/raylib.h"
+#include "../core/sim_rng.h"
 #include <stdlib.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 #define COST_INF 999999
 
@@ -80,10 +94,12 @@ static inline bool HasLadderConnection(int x, int y, int z) {
 }
 
 // State
-Entrance entrances[MAX_ENTRANCES];
+Entrance* entrances = NULL;
 int entranceCount = 0;
-GraphEdge graphEdges[MAX_EDGES];
+int entranceCapacity = 0;
+GraphEdge* graphEdges = NULL;
 int graphEdgeCount = 0;
+int graphEdgeCapacity = 0;
 LadderLink ladderLinks[MAX_LADDERS];
 int ladderLinkCount = 0;
 RampLink rampLinks[MAX_RAMP_LINKS];
@@ -91,8 +107,8 @@ int rampLinkCount = 0;
 
 // Adjacency list for fast edge lookup: adjList[node][i] gives edge index
 // adjListCount[node] gives number of edges for that node
-static int adjList[MAX_ENTRANCES][MAX_EDGES_PER_NODE];
-static int adjListCount[MAX_ENTRANCES];
+static int (*adjList)[MAX_EDGES_PER_NODE] = NULL;
+static int* adjListCount = NULL;
 Point path[MAX_PATH];
 int pathLength = 0;
 int nodesExplored = 0;
@@ -110,18 +126,18 @@ double pathStatsAvgMs = 0.0;     // Average ms per path
 bool pathStatsUpdated = false;   // Flag set when stats are updated
 Point startPos = {-1, -1, 0};
 Point goalPos = {-1, -1, 0};
-AStarNode nodeData[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+DEFINE_WORLD_LAYER(AStarNode, nodeData);
 bool chunkDirty[MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
 
 // HPA* abstract graph search state
-AbstractNode abstractNodes[MAX_ABSTRACT_NODES];
-int abstractPath[MAX_ENTRANCES + 2];
+AbstractNode* abstractNodes = NULL;
+int* abstractPath = NULL;
 int abstractPathLength = 0;
 
 // ============================================================================
 // Hash table for O(1) entrance position lookup (used in incremental updates)
 // ============================================================================
-#define ENTRANCE_HASH_SIZE 32768  // Power of 2, should be > 2x max entrances (MAX_ENTRANCES=16384)
+// Power of 2, kept at least 2x entranceCapacity (resized with the entrance arrays)
 
 typedef struct {
     int x, y, z;    // Position (key)
@@ -129,19 +145,20 @@ typedef struct {
     bool isLadder;  // true if chunk1 == chunk2 (ladder/ramp entrance)
 } EntranceHashEntry;
 
-static EntranceHashEntry entranceHash[ENTRANCE_HASH_SIZE];
+static EntranceHashEntry* entranceHash = NULL;
+static int entranceHashSize = 0;
 static bool entranceHashBuilt = false;
 
 // Simple hash function for (x, y, z) coordinates
 static inline int HashPosition(int x, int y, int z) {
     // Combine x, y, z with prime multipliers, mask to table size
     unsigned int h = (unsigned int)(x * 73856093) ^ (unsigned int)(y * 19349663) ^ (unsigned int)(z * 83492791);
-    return (int)(h & (ENTRANCE_HASH_SIZE - 1));
+    return (int)(h & (unsigned int)(entranceHashSize - 1));
 }
 
 // Clear the hash table
 static void ClearEntranceHash(void) {
-    for (int i = 0; i < ENTRANCE_HASH_SIZE; i++) {
+    for (int i = 0; i < entranceHashSize; i++) {
         entranceHash[i].index = -1;
     }
     entranceHashBuilt = false;
@@ -154,7 +171,7 @@ static void BuildEntranceHash(void) {
         int h = HashPosition(entrances[i].x, entrances[i].y, entrances[i].z);
         // Linear probing for collision resolution
         while (entranceHash[h].index >= 0) {
-            h = (h + 1) & (ENTRANCE_HASH_SIZE - 1);
+            h = (h + 1) & (entranceHashSize - 1);
         }
         entranceHash[h].x = entrances[i].x;
         entranceHash[h].y = entrances[i].y;
@@ -174,14 +191,18 @@ static int HashLookupEntrance(int x, int y, int z, bool isLadder) {
             && entranceHash[h].isLadder == isLadder) {
             return entranceHash[h].index;
         }
-        h = (h + 1) & (ENTRANCE_HASH_SIZE - 1);
+        h = (h + 1) & (entranceHashSize - 1);
         if (h == start) break;  // Full loop, not found
     }
     return -1;
 }
 
 // Mapping from old entrance indices to new indices (built during incremental update)
-static int oldToNewEntranceIndex[MAX_ENTRANCES];
+static int* oldToNewEntranceIndex = NULL;
+
+// Storage for old entrances before rebuild (used for edge remapping)
+static Entrance* oldEntrances = NULL;
+static int oldEntranceCount = 0;
 
 // ============================================================================
 // Chunk → Entrances index for O(1) lookup of entrances per chunk
@@ -191,6 +212,14 @@ static int oldToNewEntranceIndex[MAX_ENTRANCES];
 static int chunkEntrances[MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X][MAX_ENTRANCES_PER_CHUNK];
 static int chunkEntranceCount[MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X];
 
+// Entrances per chunk, in entrance order (CSR, no per-chunk cap). Rebuilt by
+// BuildGraph and UpdateDirtyChunks; FindPathHPA reads it to gather the
+// start/goal chunk entrances without scanning every entrance.
+static int* buildChunkEntStart = NULL;
+static int* buildChunkEntList = NULL;
+static int buildChunkEntCapacity = 0;
+static bool buildChunkEntValid = false;
+
 // Build the chunk→entrances index from current entrances array
 static void BuildChunkEntranceIndex(void) {
     int totalChunks = gridDepth * chunksX * chunksY;
@@ -221,13 +250,89 @@ typedef struct {
 } BinaryHeap;
 
 static BinaryHeap heap;
-static int heapStorage[MAX_ABSTRACT_NODES];
-static int abstractHeapPos[MAX_ABSTRACT_NODES];  // Track position in heap for decrease-key
+static int* heapStorage = NULL;
+static int* abstractHeapPos = NULL;  // Track position in heap for decrease-key
+
+// ============================================================================
+// Growable entrance/edge storage
+// ============================================================================
+// Every per-entrance array grows together, doubling from HPA_INITIAL_ENTRANCES.
+// Abstract search arrays carry two extra slots for the temp start/goal nodes.
+#define HPA_INITIAL_ENTRANCES 4096
+#define HPA_INITIAL_EDGES 65536
+
+static bool GrowArray(void** ptr, size_t elemSize, int count) {
+    void* grown = realloc(*ptr, elemSize * (size_t)count);
+    if (!grown) return false;
+    *ptr = grown;
+    return true;
+}
+
+// Returns false (entrance not added) only if memory runs out
+static bool EnsureEntranceCapacity(int needed) {
+    if (needed <= entranceCapacity) return true;
+    int newCap = entranceCapacity > 0 ? entranceCapacity : HPA_INITIAL_ENTRANCES;
+    while (newCap < needed) newCap *= 2;
+
+    int hashSize = entranceHashSize > 0 ? entranceHashSize : 1;
+    while (hashSize < newCap * 2) hashSize *= 2;
+
+    bool ok = GrowArray((void**)&entrances, sizeof(Entrance), newCap)
+           && GrowArray((void**)&oldEntrances, sizeof(Entrance), newCap)
+           && GrowArray((void**)&oldToNewEntranceIndex, sizeof(int), newCap)
+           && GrowArray((void**)&adjList, sizeof(adjList[0]), newCap)
+           && GrowArray((void**)&adjListCount, sizeof(int), newCap)
+           && GrowArray((void**)&abstractNodes, sizeof(AbstractNode), newCap + 2)
+           && GrowArray((void**)&abstractPath, sizeof(int), newCap + 2)
+           && GrowArray((void**)&heapStorage, sizeof(int), newCap + 2)
+           && GrowArray((void**)&abstractHeapPos, sizeof(int), newCap + 2)
+           && GrowArray((void**)&entranceHash, sizeof(EntranceHashEntry), hashSize);
+    if (!ok) {
+        TraceLog(LOG_WARNING, "HPA*: out of memory growing entrances to %d - graph will be incomplete", newCap);
+        return false;
+    }
+    // Arrays that grew past the old capacity start empty
+    for (int i = entranceCapacity; i < newCap; i++) adjListCount[i] = 0;
+    if (hashSize != entranceHashSize) {
+        entranceHashSize = hashSize;
+        ClearEntranceHash();
+    }
+    entranceCapacity = newCap;
+    return true;
+}
+
+static bool EnsureGraphEdgeCapacity(int needed) {
+    if (needed <= graphEdgeCapacity) return true;
+    int newCap = graphEdgeCapacity > 0 ? graphEdgeCapacity : HPA_INITIAL_EDGES;
+    while (newCap < needed) newCap *= 2;
+    if (!GrowArray((void**)&graphEdges, sizeof(GraphEdge), newCap)) {
+        TraceLog(LOG_WARNING, "HPA*: out of memory growing graph edges to %d - graph will be incomplete", newCap);
+        return false;
+    }
+    graphEdgeCapacity = newCap;
+    return true;
+}
+
+// Append both directions of an edge and index them in adjList
+static void AddGraphEdgePair(int e1, int e2, int cost) {
+    if (!EnsureGraphEdgeCapacity(graphEdgeCount + 2)) return;
+    int edgeIdx1 = graphEdgeCount;
+    int edgeIdx2 = graphEdgeCount + 1;
+    graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
+    graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
+
+    if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
+        adjList[e1][adjListCount[e1]++] = edgeIdx1;
+    }
+    if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
+        adjList[e2][adjListCount[e2]++] = edgeIdx2;
+    }
+}
 
 static void HeapInit(int numNodes) {
     heap.nodes = heapStorage;
     heap.size = 0;
-    heap.capacity = MAX_ABSTRACT_NODES;
+    heap.capacity = entranceCapacity + 2;
     // Initialize all positions to -1 (not in heap)
     for (int i = 0; i < numNodes; i++) {
         abstractHeapPos[i] = -1;
@@ -451,29 +556,46 @@ static int Heuristic8Dir(int x1, int y1, int x2, int y2) {
     return MIN_CELL_COST * maxD + 3 * minD;
 }
 
+static void QueueJpsPlusEdit(int x, int y, int z);
+
+void MarkNavChunkDirty(int cellX, int cellY, int cellZ) {
+    int cx = cellX / chunkWidth;
+    int cy = cellY / chunkHeight;
+    chunkDirty[cellZ][cy][cx] = true;
+
+    // Mark any additional z-levels affected by this cell change
+    // (walkability model determines which levels are affected)
+    int additionalZ[4];
+    int count = GetAdditionalAffectedZLevels(cellZ, additionalZ);
+    for (int i = 0; i < count; i++) {
+        chunkDirty[additionalZ[i]][cy][cx] = true;
+    }
+
+    needsRebuild = true;
+    hpaNeedsRebuild = true;
+    InvalidateLighting();
+    MarkAreaSumsDirty(cellX, cellY, cellZ);
+}
+
+void NoteNavCellEdit(int cellX, int cellY, int cellZ) {
+    QueueJpsPlusEdit(cellX, cellY, cellZ);
+    MarkFlowFieldsDirty(cellX, cellY, cellZ);
+    NotePathCellEdit(cellX, cellY, cellZ);
+    NoteReachCellEdit(cellX, cellY, cellZ);
+}
+
 void MarkChunkDirty(int cellX, int cellY, int cellZ) {
     int cx = cellX / chunkWidth;
     int cy = cellY / chunkHeight;
     if (cx >= 0 && cx < chunksX && cy >= 0 && cy < chunksY && cellZ >= 0 && cellZ < gridDepth) {
-        chunkDirty[cellZ][cy][cx] = true;
-        
-        // Mark any additional z-levels affected by this cell change
-        // (walkability model determines which levels are affected)
-        int additionalZ[4];
-        int count = GetAdditionalAffectedZLevels(cellZ, additionalZ);
-        for (int i = 0; i < count; i++) {
-            chunkDirty[additionalZ[i]][cy][cx] = true;
-        }
-        
-        needsRebuild = true;
-        hpaNeedsRebuild = true;
-        jpsNeedsRebuild = true;
-        InvalidateLighting();
+        if (DeferCellEdit(cellX, cellY, cellZ, CELL_EDIT_NAV)) return;
+        MarkNavChunkDirty(cellX, cellY, cellZ);
+        NoteNavCellEdit(cellX, cellY, cellZ);
     }
 }
 
 static void AddEntrance(int x, int y, int z, int chunk1, int chunk2) {
-    if (entranceCount < MAX_ENTRANCES)
+    if (EnsureEntranceCapacity(entranceCount + 1))
         entrances[entranceCount++] = (Entrance){x, y, z, chunk1, chunk2};
 }
 
@@ -493,7 +615,7 @@ static void AddEntrancesForRun(int startX, int startY, int z, int length, int ho
 // Add a ladder entrance at given position connecting two z-levels
 // Returns the entrance index, or -1 if no room
 static int AddLadderEntrance(int x, int y, int z) {
-    if (entranceCount >= MAX_ENTRANCES) return -1;
+    if (!EnsureEntranceCapacity(entranceCount + 1)) return -1;
     
     // For ladder entrances, chunk1 and chunk2 are the same chunk
     // (the ladder connects vertically, not horizontally between chunks)
@@ -505,7 +627,7 @@ static int AddLadderEntrance(int x, int y, int z) {
 // Add a ramp entrance at given position (similar to ladder entrance)
 // Returns the entrance index, or -1 if no room
 static int AddRampEntrance(int x, int y, int z) {
-    if (entranceCount >= MAX_ENTRANCES) return -1;
+    if (!EnsureEntranceCapacity(entranceCount + 1)) return -1;
     
     int chunk = z * (chunksX * chunksY) + (y / chunkHeight) * chunksX + (x / chunkWidth);
     entrances[entranceCount] = (Entrance){x, y, z, chunk, chunk};
@@ -515,6 +637,8 @@ static int AddRampEntrance(int x, int y, int z) {
 
 void BuildEntrances(void) {
     entranceCount = 0;
+    ClearReachCache();
+    buildChunkEntValid = false;
     ladderLinkCount = 0;
     rampLinkCount = 0;
     rampCount = 0;  // Recount ramps when rebuilding entrances
@@ -817,6 +941,876 @@ int AStarChunkMultiTarget(int sx, int sy, int sz,
     return targetsFound;
 }
 
+// ============================================================================
+// Level-2 HPA*: super-chunk graph over the entrance graph
+// ============================================================================
+// A super-chunk is a hpaSuperChunkSize x hpaSuperChunkSize block of chunk
+// columns spanning every z-level, so ramps and ladders inside it stay local.
+// Level-2 nodes are entrances touching two super-chunks plus ladder/ramp
+// entrances whose partner lies in another one. Each super-chunk stores the
+// shortest entrance-graph cost between its nodes, found by Dijkstra through
+// entrances touching it. Every entrance-graph route between two points in
+// different super-chunks crosses their borders at level-2 nodes, so level-2
+// costs equal level-1 costs. Edits only recompute the super-chunks around
+// affected chunks; the rest are remapped through oldToNewEntranceIndex.
+
+#define MAX_SUPER_CHUNKS (MAX_CHUNKS_Y * MAX_CHUNKS_X)
+
+int hpaSuperChunkSize = 4;
+int hpaSuperNodeCount = 0;
+int hpaSuperEdgeCount = 0;
+
+typedef struct {
+    int to;         // entrance index
+    int cost;
+    int super;      // super-chunk whose interior the hop crosses, -1 = ladder/ramp link
+} SuperEdge;
+
+typedef struct {
+    int dist, parent;
+    int stamp;      // dist/parent/heapPos are valid only when stamp == superSearchStamp
+    int heapPos;
+} SuperSearchNode;
+
+typedef struct {
+    int stamp;      // abstractNodes entry belongs to this query when stamp == superQueryStamp
+    int via;        // how the node was reached: super-chunk, SUPER_VIA_LINK or SUPER_VIA_START
+    int goalCost;   // cost on to the goal (valid when goalStamp == superQueryStamp)
+    int goalStamp;
+} SuperQueryNode;
+
+#define SUPER_VIA_LINK -1
+#define SUPER_VIA_START -2
+
+// Per super-chunk edge lists (from/to are entrance indices)
+static GraphEdge* superChunkEdges[MAX_SUPER_CHUNKS];
+static int superChunkEdgeCount[MAX_SUPER_CHUNKS];
+static int superChunkEdgeCapacity[MAX_SUPER_CHUNKS];
+static bool superChunkDirty[MAX_SUPER_CHUNKS];
+static int superBuiltSize = 0, superBuiltChunksX = 0, superBuiltChunksY = 0;
+static bool superGraphStale = true;
+
+// Level-2 graph, rebuilt from the edge lists when stale
+static int* superNodeOf = NULL;          // entrance -> level-2 node id, -1 if not a node
+static int* superAdjStart = NULL;        // node id -> first edge in superAdj (CSR)
+static SuperEdge* superAdj = NULL;
+static int superMemberStart[MAX_SUPER_CHUNKS + 1];
+static int* superMembers = NULL;         // entrances that are level-2 nodes, grouped by super-chunk
+static int superAdjCapacity = 0;
+static int superMemberCapacity = 0;
+
+// Search scratch, indexed by entrance (superQuery has two extra slots for start/goal)
+static SuperSearchNode* superSearch = NULL;
+static SuperQueryNode* superQuery = NULL;
+static int* superHeap = NULL;
+static int superHeapSize = 0;
+static int superSearchStamp = 0;
+static int superQueryStamp = 0;
+static int superScratchCapacity = 0;
+
+static inline bool SuperGraphEnabled(void) {
+    return hpaSuperChunkSize >= 2;
+}
+
+static inline int SuperChunksX(void) {
+    return (chunksX + hpaSuperChunkSize - 1) / hpaSuperChunkSize;
+}
+
+static inline int SuperChunksY(void) {
+    return (chunksY + hpaSuperChunkSize - 1) / hpaSuperChunkSize;
+}
+
+static inline int SuperOfChunk(int chunk) {
+    int xyChunk = chunk % (chunksX * chunksY);
+    return (xyChunk / chunksX / hpaSuperChunkSize) * SuperChunksX() + (xyChunk % chunksX) / hpaSuperChunkSize;
+}
+
+static inline bool EntranceTouchesSuper(int e, int s) {
+    return SuperOfChunk(entrances[e].chunk1) == s || SuperOfChunk(entrances[e].chunk2) == s;
+}
+
+static bool EnsureSuperScratch(int entranceSlots) {
+    if (entranceSlots <= superScratchCapacity) return true;
+    int newCap = entranceCapacity > entranceSlots ? entranceCapacity : entranceSlots;
+    bool ok = GrowArray((void**)&superNodeOf, sizeof(int), newCap)
+           && GrowArray((void**)&superAdjStart, sizeof(int), newCap + 1)
+           && GrowArray((void**)&superSearch, sizeof(SuperSearchNode), newCap)
+           && GrowArray((void**)&superHeap, sizeof(int), newCap)
+           && GrowArray((void**)&superQuery, sizeof(SuperQueryNode), newCap + 2);
+    if (!ok) return false;
+    for (int i = superScratchCapacity; i < newCap; i++) superSearch[i].stamp = 0;
+    for (int i = superScratchCapacity; i < newCap + 2; i++) {
+        superQuery[i].stamp = 0;
+        superQuery[i].goalStamp = 0;
+    }
+    superScratchCapacity = newCap;
+    return true;
+}
+
+static void NextSuperSearchStamp(void) {
+    if (++superSearchStamp == INT_MAX) {
+        for (int i = 0; i < superScratchCapacity; i++) superSearch[i].stamp = 0;
+        superSearchStamp = 1;
+    }
+}
+
+static void NextSuperQueryStamp(void) {
+    if (++superQueryStamp == INT_MAX) {
+        for (int i = 0; i < superScratchCapacity + 2; i++) {
+            superQuery[i].stamp = 0;
+            superQuery[i].goalStamp = 0;
+        }
+        superQueryStamp = 1;
+    }
+}
+
+static void SuperHeapSwap(int i, int j) {
+    int a = superHeap[i];
+    int b = superHeap[j];
+    superHeap[i] = b;
+    superHeap[j] = a;
+    superSearch[a].heapPos = j;
+    superSearch[b].heapPos = i;
+}
+
+static void SuperHeapBubbleUp(int idx) {
+    while (idx > 0) {
+        int parent = (idx - 1) / 2;
+        if (superSearch[superHeap[idx]].dist >= superSearch[superHeap[parent]].dist) break;
+        SuperHeapSwap(idx, parent);
+        idx = parent;
+    }
+}
+
+static int SuperHeapPop(void) {
+    int result = superHeap[0];
+    superSearch[result].heapPos = -1;
+    superHeapSize--;
+    if (superHeapSize > 0) {
+        superHeap[0] = superHeap[superHeapSize];
+        superSearch[superHeap[0]].heapPos = 0;
+        int idx = 0;
+        while (1) {
+            int left = 2 * idx + 1;
+            int right = left + 1;
+            int smallest = idx;
+            if (left < superHeapSize && superSearch[superHeap[left]].dist < superSearch[superHeap[smallest]].dist) smallest = left;
+            if (right < superHeapSize && superSearch[superHeap[right]].dist < superSearch[superHeap[smallest]].dist) smallest = right;
+            if (smallest == idx) break;
+            SuperHeapSwap(idx, smallest);
+            idx = smallest;
+        }
+    }
+    return result;
+}
+
+static void RelaxSuperSearch(int e, int dist, int parent) {
+    SuperSearchNode* n = &superSearch[e];
+    if (n->stamp != superSearchStamp) {
+        n->stamp = superSearchStamp;
+        n->dist = COST_INF;
+        n->heapPos = -1;
+    }
+    if (dist >= n->dist) return;
+    n->dist = dist;
+    n->parent = parent;
+    if (n->heapPos < 0) {
+        superHeap[superHeapSize] = e;
+        n->heapPos = superHeapSize++;
+    }
+    SuperHeapBubbleUp(n->heapPos);
+}
+
+static inline int SuperSearchDist(int e) {
+    return superSearch[e].stamp == superSearchStamp ? superSearch[e].dist : COST_INF;
+}
+
+// Dijkstra over the entrance graph through entrances touching super-chunk s.
+// Seeds start with the given costs (parent -1). Stops once target is settled
+// (-1 = settle everything reachable).
+static void SearchSuperChunk(int s, const int* seeds, const int* seedCosts, int seedCount, int target) {
+    NextSuperSearchStamp();
+    superHeapSize = 0;
+    for (int i = 0; i < seedCount; i++) {
+        RelaxSuperSearch(seeds[i], seedCosts[i], -1);
+    }
+    while (superHeapSize > 0) {
+        int e = SuperHeapPop();
+        if (e == target) return;
+        int g = superSearch[e].dist;
+        for (int k = 0; k < adjListCount[e]; k++) {
+            GraphEdge* edge = &graphEdges[adjList[e][k]];
+            if (!EntranceTouchesSuper(edge->to, s)) continue;
+            RelaxSuperSearch(edge->to, g + edge->cost, e);
+        }
+    }
+}
+
+static void AppendSuperChunkEdge(int s, int from, int to, int cost) {
+    if (superChunkEdgeCount[s] >= superChunkEdgeCapacity[s]) {
+        int newCap = superChunkEdgeCapacity[s] ? superChunkEdgeCapacity[s] * 2 : 64;
+        if (!GrowArray((void**)&superChunkEdges[s], sizeof(GraphEdge), newCap)) return;
+        superChunkEdgeCapacity[s] = newCap;
+    }
+    superChunkEdges[s][superChunkEdgeCount[s]++] = (GraphEdge){from, to, cost};
+}
+
+// Costs are symmetric (every entrance edge is stored both ways), so each pair is searched once
+static void BuildSuperChunkEdges(int s) {
+    superChunkEdgeCount[s] = 0;
+    int first = superMemberStart[s];
+    int last = superMemberStart[s + 1];
+    for (int i = first; i < last - 1; i++) {
+        int from = superMembers[i];
+        int zero = 0;
+        SearchSuperChunk(s, &from, &zero, 1, -1);
+        for (int j = i + 1; j < last; j++) {
+            int to = superMembers[j];
+            int d = SuperSearchDist(to);
+            if (d >= COST_INF) continue;
+            AppendSuperChunkEdge(s, from, to, d);
+            AppendSuperChunkEdge(s, to, from, d);
+        }
+    }
+}
+
+static void MarkAllSuperChunksDirty(void) {
+    for (int s = 0; s < MAX_SUPER_CHUNKS; s++) superChunkDirty[s] = true;
+    superGraphStale = true;
+}
+
+static void MarkLinkSuperNodes(int e1, int e2) {
+    if (SuperOfChunk(entrances[e1].chunk1) == SuperOfChunk(entrances[e2].chunk1)) return;
+    superNodeOf[e1] = 0;
+    superNodeOf[e2] = 0;
+}
+
+// Append a ladder/ramp hop to the level-2 adjacency if it crosses super-chunks
+static void AddSuperLinkEdges(int e1, int e2, int cost, int* cursor) {
+    if (superNodeOf[e1] < 0 || superNodeOf[e2] < 0) return;
+    if (SuperOfChunk(entrances[e1].chunk1) == SuperOfChunk(entrances[e2].chunk1)) return;
+    if (cursor) {
+        superAdj[cursor[superNodeOf[e1]]++] = (SuperEdge){e2, cost, SUPER_VIA_LINK};
+        superAdj[cursor[superNodeOf[e2]]++] = (SuperEdge){e1, cost, SUPER_VIA_LINK};
+    } else {
+        superAdjStart[superNodeOf[e1] + 1]++;
+        superAdjStart[superNodeOf[e2] + 1]++;
+    }
+}
+
+static void AddAllSuperLinkEdges(int* cursor) {
+    for (int i = 0; i < ladderLinkCount; i++) {
+        AddSuperLinkEdges(ladderLinks[i].entranceLow, ladderLinks[i].entranceHigh, ladderLinks[i].cost, cursor);
+    }
+    for (int i = 0; i < rampLinkCount; i++) {
+        AddSuperLinkEdges(rampLinks[i].entranceRamp, rampLinks[i].entranceExit, rampLinks[i].cost, cursor);
+    }
+}
+
+void BuildHpaSuperGraph(void) {
+    if (!SuperGraphEnabled() || entranceCount == 0) return;
+    if (superBuiltSize != hpaSuperChunkSize || superBuiltChunksX != chunksX || superBuiltChunksY != chunksY) {
+        MarkAllSuperChunksDirty();
+        superBuiltSize = hpaSuperChunkSize;
+        superBuiltChunksX = chunksX;
+        superBuiltChunksY = chunksY;
+    }
+    if (!superGraphStale) return;
+    if (!EnsureSuperScratch(entranceCount)) {
+        TraceLog(LOG_WARNING, "HPA*: out of memory building the super-chunk graph");
+        return;
+    }
+    int numSupers = SuperChunksX() * SuperChunksY();
+
+    // Nodes: border entrances, then link entrances that leave their super-chunk
+    for (int e = 0; e < entranceCount; e++) {
+        superNodeOf[e] = SuperOfChunk(entrances[e].chunk1) != SuperOfChunk(entrances[e].chunk2) ? 0 : -1;
+    }
+    for (int i = 0; i < ladderLinkCount; i++) MarkLinkSuperNodes(ladderLinks[i].entranceLow, ladderLinks[i].entranceHigh);
+    for (int i = 0; i < rampLinkCount; i++) MarkLinkSuperNodes(rampLinks[i].entranceRamp, rampLinks[i].entranceExit);
+
+    hpaSuperNodeCount = 0;
+    for (int s = 0; s <= numSupers; s++) superMemberStart[s] = 0;
+    for (int e = 0; e < entranceCount; e++) {
+        if (superNodeOf[e] < 0) continue;
+        superNodeOf[e] = hpaSuperNodeCount++;
+        int s1 = SuperOfChunk(entrances[e].chunk1);
+        int s2 = SuperOfChunk(entrances[e].chunk2);
+        superMemberStart[s1 + 1]++;
+        if (s2 != s1) superMemberStart[s2 + 1]++;
+    }
+    for (int s = 0; s < numSupers; s++) superMemberStart[s + 1] += superMemberStart[s];
+    int memberCount = superMemberStart[numSupers];
+    if (memberCount > superMemberCapacity) {
+        if (!GrowArray((void**)&superMembers, sizeof(int), memberCount)) return;
+        superMemberCapacity = memberCount;
+    }
+    static int memberCursor[MAX_SUPER_CHUNKS];
+    for (int s = 0; s < numSupers; s++) memberCursor[s] = superMemberStart[s];
+    for (int e = 0; e < entranceCount; e++) {
+        if (superNodeOf[e] < 0) continue;
+        int s1 = SuperOfChunk(entrances[e].chunk1);
+        int s2 = SuperOfChunk(entrances[e].chunk2);
+        superMembers[memberCursor[s1]++] = e;
+        if (s2 != s1) superMembers[memberCursor[s2]++] = e;
+    }
+
+    for (int s = 0; s < numSupers; s++) {
+        if (!superChunkDirty[s]) continue;
+        BuildSuperChunkEdges(s);
+        superChunkDirty[s] = false;
+    }
+
+    // Adjacency by node: stored interior hops plus ladder/ramp links between super-chunks
+    for (int n = 0; n <= hpaSuperNodeCount; n++) superAdjStart[n] = 0;
+    for (int s = 0; s < numSupers; s++) {
+        for (int k = 0; k < superChunkEdgeCount[s]; k++) {
+            int from = superChunkEdges[s][k].from;
+            if (superNodeOf[from] >= 0 && superNodeOf[superChunkEdges[s][k].to] >= 0) {
+                superAdjStart[superNodeOf[from] + 1]++;
+            }
+        }
+    }
+    AddAllSuperLinkEdges(NULL);
+    for (int n = 0; n < hpaSuperNodeCount; n++) superAdjStart[n + 1] += superAdjStart[n];
+    hpaSuperEdgeCount = superAdjStart[hpaSuperNodeCount];
+    if (hpaSuperEdgeCount > superAdjCapacity) {
+        if (!GrowArray((void**)&superAdj, sizeof(SuperEdge), hpaSuperEdgeCount)) return;
+        superAdjCapacity = hpaSuperEdgeCount;
+    }
+    int* cursor = malloc(sizeof(int) * (hpaSuperNodeCount > 0 ? hpaSuperNodeCount : 1));
+    if (!cursor) return;
+    for (int n = 0; n < hpaSuperNodeCount; n++) cursor[n] = superAdjStart[n];
+    for (int s = 0; s < numSupers; s++) {
+        for (int k = 0; k < superChunkEdgeCount[s]; k++) {
+            GraphEdge* edge = &superChunkEdges[s][k];
+            if (superNodeOf[edge->from] < 0 || superNodeOf[edge->to] < 0) continue;
+            superAdj[cursor[superNodeOf[edge->from]]++] = (SuperEdge){edge->to, edge->cost, s};
+        }
+    }
+    AddAllSuperLinkEdges(cursor);
+    free(cursor);
+    superGraphStale = false;
+}
+
+// After an incremental update: super-chunks around affected chunks are
+// recomputed, the others keep their hops with remapped entrance indices
+static void UpdateSuperChunksAfterEdit(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X]) {
+    superGraphStale = true;
+    if (!SuperGraphEnabled() || superBuiltSize != hpaSuperChunkSize
+        || superBuiltChunksX != chunksX || superBuiltChunksY != chunksY) {
+        superBuiltSize = 0;  // next build starts over
+        return;
+    }
+    int superX = SuperChunksX();
+    int numSupers = superX * SuperChunksY();
+    static const int ndx[5] = {0, 1, -1, 0, 0};
+    static const int ndy[5] = {0, 0, 0, 1, -1};
+    for (int z = 0; z < gridDepth; z++) {
+        for (int cy = 0; cy < chunksY; cy++) {
+            for (int cx = 0; cx < chunksX; cx++) {
+                if (!affectedChunks[z][cy][cx]) continue;
+                // Border entrances of a neighbor chunk may belong to the next super-chunk
+                for (int d = 0; d < 5; d++) {
+                    int nx = cx + ndx[d], ny = cy + ndy[d];
+                    if (nx < 0 || nx >= chunksX || ny < 0 || ny >= chunksY) continue;
+                    superChunkDirty[(ny / hpaSuperChunkSize) * superX + nx / hpaSuperChunkSize] = true;
+                }
+            }
+        }
+    }
+    for (int s = 0; s < numSupers; s++) {
+        if (superChunkDirty[s]) continue;
+        for (int k = 0; k < superChunkEdgeCount[s]; k++) {
+            GraphEdge* edge = &superChunkEdges[s][k];
+            int from = edge->from < oldEntranceCount ? oldToNewEntranceIndex[edge->from] : -1;
+            int to = edge->to < oldEntranceCount ? oldToNewEntranceIndex[edge->to] : -1;
+            if (from < 0 || to < 0) {
+                superChunkDirty[s] = true;
+                break;
+            }
+            edge->from = from;
+            edge->to = to;
+        }
+    }
+}
+
+static void RelaxSuperQuery(int node, int g, int parent, int via, Point goal) {
+    if (superQuery[node].stamp != superQueryStamp) {
+        superQuery[node].stamp = superQueryStamp;
+        abstractNodes[node] = (AbstractNode){COST_INF, COST_INF, -1, false, false};
+        abstractHeapPos[node] = -1;
+    }
+    AbstractNode* n = &abstractNodes[node];
+    if (n->closed || g >= n->g) return;
+    bool wasOpen = n->open;
+    n->g = g;
+    n->f = (node < entranceCount) ? g + Heuristic(entrances[node].x, entrances[node].y, goal.x, goal.y) : g;
+    n->parent = parent;
+    n->open = true;
+    superQuery[node].via = via;
+    if (wasOpen) {
+        HeapDecreaseKey(node);
+    } else {
+        HeapPush(node);
+    }
+}
+
+static bool PushAbstractPathNode(int node) {
+    if (abstractPathLength >= entranceCapacity + 2) return false;
+    abstractPath[abstractPathLength++] = node;
+    return true;
+}
+
+// Append the search parents of `from` (excluding it) up to the seed
+static bool PushSuperSearchChain(int from) {
+    for (int e = superSearch[from].parent; e >= 0; e = superSearch[e].parent) {
+        if (!PushAbstractPathNode(e)) return false;
+    }
+    return true;
+}
+
+// Expand the level-2 route ending at goalNode into entrances, goal first
+static bool ExpandSuperPath(int startSuper, int goalSuper,
+                            const int* startTargets, const int* startCosts, int startCount,
+                            const int* goalTargets, const int* goalCosts, int goalCount) {
+    int startNode = entranceCount;
+    int goalNode = entranceCount + 1;
+    abstractPathLength = 0;
+    PushAbstractPathNode(goalNode);
+
+    // Goal hop: the goal-rooted chain runs node -> goal, so reverse it
+    int node = abstractNodes[goalNode].parent;
+    SearchSuperChunk(goalSuper, goalTargets, goalCosts, goalCount, node);
+    if (SuperSearchDist(node) >= COST_INF) return false;
+    int chainStart = abstractPathLength;
+    if (!PushAbstractPathNode(node) || !PushSuperSearchChain(node)) return false;
+    for (int i = chainStart, j = abstractPathLength - 1; i < j; i++, j--) {
+        int tmp = abstractPath[i];
+        abstractPath[i] = abstractPath[j];
+        abstractPath[j] = tmp;
+    }
+
+    while (node != startNode) {
+        int prev = abstractNodes[node].parent;
+        int via = superQuery[node].via;
+        if (via == SUPER_VIA_LINK) {
+            if (!PushAbstractPathNode(prev)) return false;
+        } else if (via == SUPER_VIA_START) {
+            SearchSuperChunk(startSuper, startTargets, startCosts, startCount, node);
+            if (SuperSearchDist(node) >= COST_INF || !PushSuperSearchChain(node)) return false;
+            if (!PushAbstractPathNode(startNode)) return false;
+        } else {
+            int zero = 0;
+            SearchSuperChunk(via, &prev, &zero, 1, node);
+            if (SuperSearchDist(node) >= COST_INF || !PushSuperSearchChain(node)) return false;
+        }
+        node = prev;
+    }
+    return true;
+}
+
+// Level-2 A* between different super-chunks. Start and goal join the level-2
+// nodes of their super-chunks through restricted searches seeded with the
+// connect-phase costs; the route is then expanded into abstractPath so the
+// usual cell refinement applies.
+static void SearchSuperGraph(Point start, Point goal, int startSuper, int goalSuper,
+                             const int* startTargets, const int* startCosts, int startCount,
+                             const int* goalTargets, const int* goalCosts, int goalCount) {
+    abstractPathLength = 0;
+    if (startCount == 0 || goalCount == 0) return;
+    int startNode = entranceCount;
+    int goalNode = entranceCount + 1;
+    NextSuperQueryStamp();
+
+    SearchSuperChunk(goalSuper, goalTargets, goalCosts, goalCount, -1);
+    for (int i = superMemberStart[goalSuper]; i < superMemberStart[goalSuper + 1]; i++) {
+        int e = superMembers[i];
+        int d = SuperSearchDist(e);
+        if (d >= COST_INF) continue;
+        superQuery[e].goalCost = d;
+        superQuery[e].goalStamp = superQueryStamp;
+    }
+
+    HeapInit(0);
+    RelaxSuperQuery(startNode, 0, -1, SUPER_VIA_START, goal);
+    abstractNodes[startNode].f = Heuristic(start.x, start.y, goal.x, goal.y);
+
+    while (heap.size > 0) {
+        int best = HeapPop();
+        if (best == goalNode) {
+            if (!ExpandSuperPath(startSuper, goalSuper, startTargets, startCosts, startCount,
+                                 goalTargets, goalCosts, goalCount)) {
+                abstractPathLength = 0;
+            }
+            return;
+        }
+        abstractNodes[best].open = false;
+        abstractNodes[best].closed = true;
+        nodesExplored++;
+        int g = abstractNodes[best].g;
+
+        if (best == startNode) {
+            SearchSuperChunk(startSuper, startTargets, startCosts, startCount, -1);
+            for (int i = superMemberStart[startSuper]; i < superMemberStart[startSuper + 1]; i++) {
+                int e = superMembers[i];
+                int d = SuperSearchDist(e);
+                if (d < COST_INF) RelaxSuperQuery(e, g + d, startNode, SUPER_VIA_START, goal);
+            }
+            continue;
+        }
+
+        int n = superNodeOf[best];
+        for (int k = superAdjStart[n]; k < superAdjStart[n + 1]; k++) {
+            RelaxSuperQuery(superAdj[k].to, g + superAdj[k].cost, best, superAdj[k].super, goal);
+        }
+        if (superQuery[best].goalStamp == superQueryStamp) {
+            RelaxSuperQuery(goalNode, g + superQuery[best].goalCost, best, goalSuper, goal);
+        }
+    }
+}
+
+// ============================================================================
+// Parallel intra-chunk edge building
+// ============================================================================
+// Each chunk's entrance-to-entrance costs only read the grid, so chunks are
+// independent jobs. Workers run a window-local Dijkstra with their own
+// scratch (no shared nodeData/heapPos), write edges into the job's own list,
+// and the lists are merged into graphEdges/adjList in chunk order afterwards,
+// so the result does not depend on thread count or scheduling.
+
+#define HPA_MAX_BUILD_THREADS 16
+#define HPA_MIN_JOBS_PER_THREAD 4        // below this, thread startup costs more than it saves
+#define MAX_BUILD_ENTRANCES_PER_CHUNK 128
+
+int hpaBuildThreads = 0;
+
+typedef struct {
+    int* g;
+    int* heap;
+    int* heapPos;
+    bool* closed;
+    int capacity;
+    int heapSize;
+} ChunkSearchScratch;
+
+typedef struct {
+    GraphEdge* edges;   // one direction per pair; merge adds the reverse
+    int count;
+    int capacity;
+} ChunkEdgeList;
+
+static ChunkSearchScratch chunkSearchScratch[HPA_MAX_BUILD_THREADS];
+static ChunkEdgeList chunkEdgeLists[MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X];
+static int chunkEdgeJobs[MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X];
+static int chunkEdgeJobCount = 0;
+static atomic_int chunkEdgeNextJob;
+
+// NULL: full build, every entrance searched. Otherwise only entrances touching affected chunks.
+static bool (*chunkEdgeAffected)[MAX_CHUNKS_Y][MAX_CHUNKS_X] = NULL;
+
+static bool NewEntranceTouchesAffected(int entranceIdx, bool affectedChunks[MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X]);
+
+static void EnsureChunkSearchScratch(ChunkSearchScratch* s, int cells) {
+    if (s->capacity >= cells) return;
+    free(s->g);
+    free(s->heap);
+    free(s->heapPos);
+    free(s->closed);
+    s->g = malloc(sizeof(int) * cells);
+    s->heap = malloc(sizeof(int) * cells);
+    s->heapPos = malloc(sizeof(int) * cells);
+    s->closed = malloc(sizeof(bool) * cells);
+    s->capacity = cells;
+}
+
+static void ScratchHeapSwap(ChunkSearchScratch* s, int i, int j) {
+    int a = s->heap[i];
+    int b = s->heap[j];
+    s->heap[i] = b;
+    s->heap[j] = a;
+    s->heapPos[a] = j;
+    s->heapPos[b] = i;
+}
+
+static void ScratchHeapBubbleUp(ChunkSearchScratch* s, int idx) {
+    while (idx > 0) {
+        int parent = (idx - 1) / 2;
+        if (s->g[s->heap[idx]] >= s->g[s->heap[parent]]) break;
+        ScratchHeapSwap(s, idx, parent);
+        idx = parent;
+    }
+}
+
+static int ScratchHeapPop(ChunkSearchScratch* s) {
+    int result = s->heap[0];
+    s->heapPos[result] = -1;
+    s->heapSize--;
+    if (s->heapSize > 0) {
+        s->heap[0] = s->heap[s->heapSize];
+        s->heapPos[s->heap[0]] = 0;
+        int idx = 0;
+        while (1) {
+            int left = 2 * idx + 1;
+            int right = left + 1;
+            int smallest = idx;
+            if (left < s->heapSize && s->g[s->heap[left]] < s->g[s->heap[smallest]]) smallest = left;
+            if (right < s->heapSize && s->g[s->heap[right]] < s->g[s->heap[smallest]]) smallest = right;
+            if (smallest == idx) break;
+            ScratchHeapSwap(s, idx, smallest);
+            idx = smallest;
+        }
+    }
+    return result;
+}
+
+// Same search as AStarChunkMultiTarget, but all state lives in the scratch
+// (window-local indices), so it is safe to run on several threads at once
+static void ChunkMultiTargetCosts(ChunkSearchScratch* s, int sx, int sy, int sz,
+                                  const int* targetX, const int* targetY, int* outCosts, int numTargets,
+                                  int minX, int minY, int maxX, int maxY) {
+    int w = maxX - minX;
+    int h = maxY - minY;
+    EnsureChunkSearchScratch(s, w * h);
+    for (int i = 0; i < w * h; i++) {
+        s->g[i] = COST_INF;
+        s->heapPos[i] = -1;
+        s->closed[i] = false;
+    }
+    for (int i = 0; i < numTargets; i++) outCosts[i] = -1;
+
+    static const int dx8[] = {0, 1, 1, 1, 0, -1, -1, -1};
+    static const int dy8[] = {-1, -1, 0, 1, 1, 1, 0, -1};
+    static const int dx4[] = {0, 1, 0, -1};
+    static const int dy4[] = {-1, 0, 1, 0};
+    const int* dx = use8Dir ? dx8 : dx4;
+    const int* dy = use8Dir ? dy8 : dy4;
+    int numDirs = use8Dir ? 8 : 4;
+
+    int start = (sy - minY) * w + (sx - minX);
+    s->g[start] = 0;
+    s->heap[0] = start;
+    s->heapPos[start] = 0;
+    s->heapSize = 1;
+
+    int targetsFound = 0;
+    while (s->heapSize > 0) {
+        int cur = ScratchHeapPop(s);
+        int bestX = minX + cur % w;
+        int bestY = minY + cur / w;
+        int curG = s->g[cur];
+
+        for (int t = 0; t < numTargets; t++) {
+            if (bestX == targetX[t] && bestY == targetY[t] && outCosts[t] < 0) {
+                outCosts[t] = curG;
+                if (++targetsFound == numTargets) return;
+            }
+        }
+        s->closed[cur] = true;
+
+        for (int i = 0; i < numDirs; i++) {
+            int nx = bestX + dx[i], ny = bestY + dy[i];
+            if (nx < minX || nx >= maxX || ny < minY || ny >= maxY) continue;
+            int next = (ny - minY) * w + (nx - minX);
+            if (s->closed[next] || !IsCellWalkableAt(sz, ny, nx)) continue;
+
+            // Prevent corner cutting for diagonal movement
+            if (use8Dir && dx[i] != 0 && dy[i] != 0) {
+                if (!IsCellWalkableAt(sz, bestY, nx) || !IsCellWalkableAt(sz, ny, bestX)) continue;
+            }
+
+            int baseCost = (dx[i] != 0 && dy[i] != 0) ? 14 : 10;
+            int ng = curG + (baseCost * GetCellMoveCost(nx, ny, sz)) / 10;
+            if (ng < s->g[next]) {
+                s->g[next] = ng;
+                if (s->heapPos[next] < 0) {
+                    s->heap[s->heapSize] = next;
+                    s->heapPos[next] = s->heapSize;
+                    s->heapSize++;
+                }
+                ScratchHeapBubbleUp(s, s->heapPos[next]);
+            }
+        }
+    }
+}
+
+static void AppendChunkEdge(ChunkEdgeList* list, int from, int to, int cost) {
+    if (list->count >= list->capacity) {
+        int newCap = list->capacity ? list->capacity * 2 : 64;
+        GraphEdge* grown = realloc(list->edges, sizeof(GraphEdge) * newCap);
+        if (!grown) return;
+        list->edges = grown;
+        list->capacity = newCap;
+    }
+    list->edges[list->count++] = (GraphEdge){from, to, cost};
+}
+
+static bool EdgeExists(int e1, int e2) {
+    for (int k = 0; k < adjListCount[e1]; k++) {
+        if (graphEdges[adjList[e1][k]].to == e2) return true;
+    }
+    return false;
+}
+
+static void ComputeChunkEdges(ChunkSearchScratch* s, int job) {
+    int chunk = chunkEdgeJobs[job];
+    ChunkEdgeList* out = &chunkEdgeLists[job];
+    out->count = 0;
+
+    int chunksPerLevel = chunksX * chunksY;
+    int z = chunk / chunksPerLevel;
+    int cx = (chunk % chunksPerLevel) % chunksX;
+    int cy = (chunk % chunksPerLevel) / chunksX;
+    int minX = cx * chunkWidth;
+    int minY = cy * chunkHeight;
+    int maxX = (cx + 1) * chunkWidth + 1;
+    int maxY = (cy + 1) * chunkHeight + 1;
+    if (maxX > gridWidth) maxX = gridWidth;
+    if (maxY > gridHeight) maxY = gridHeight;
+
+    const int* ents;
+    int numEnts;
+    if (chunkEdgeAffected) {
+        ents = chunkEntrances[chunk];
+        numEnts = chunkEntranceCount[chunk];
+    } else {
+        ents = &buildChunkEntList[buildChunkEntStart[chunk]];
+        numEnts = buildChunkEntStart[chunk + 1] - buildChunkEntStart[chunk];
+        if (numEnts > MAX_BUILD_ENTRANCES_PER_CHUNK) numEnts = MAX_BUILD_ENTRANCES_PER_CHUNK;
+    }
+
+    bool entAffected[MAX_BUILD_ENTRANCES_PER_CHUNK];
+    for (int i = 0; i < numEnts; i++) {
+        entAffected[i] = !chunkEdgeAffected || NewEntranceTouchesAffected(ents[i], chunkEdgeAffected);
+    }
+
+    int targetX[MAX_BUILD_ENTRANCES_PER_CHUNK];
+    int targetY[MAX_BUILD_ENTRANCES_PER_CHUNK];
+    int targetEnt[MAX_BUILD_ENTRANCES_PER_CHUNK];
+    int outCosts[MAX_BUILD_ENTRANCES_PER_CHUNK];
+
+    for (int i = 0; i < numEnts; i++) {
+        if (!entAffected[i]) continue;
+        int e1 = ents[i];
+
+        int numTargets = 0;
+        for (int j = 0; j < numEnts; j++) {
+            if (j == i) continue;
+            // Pairs with an earlier searched entrance were covered by its search
+            if (j < i && entAffected[j]) continue;
+            int e2 = ents[j];
+            // Kept edges (incremental); adjList is read-only while jobs run
+            if (EdgeExists(e1, e2)) continue;
+            targetX[numTargets] = entrances[e2].x;
+            targetY[numTargets] = entrances[e2].y;
+            targetEnt[numTargets] = e2;
+            numTargets++;
+        }
+        if (numTargets == 0) continue;
+
+        ChunkMultiTargetCosts(s, entrances[e1].x, entrances[e1].y, z,
+                              targetX, targetY, outCosts, numTargets,
+                              minX, minY, maxX, maxY);
+
+        for (int t = 0; t < numTargets; t++) {
+            if (outCosts[t] >= 0) AppendChunkEdge(out, e1, targetEnt[t], outCosts[t]);
+        }
+    }
+}
+
+static void* ChunkEdgeWorker(void* arg) {
+    ChunkSearchScratch* s = arg;
+    int job;
+    PROFILE_BEGIN(ChunkEdges);
+    while ((job = atomic_fetch_add(&chunkEdgeNextJob, 1)) < chunkEdgeJobCount) {
+        ComputeChunkEdges(s, job);
+    }
+    PROFILE_END(ChunkEdges);
+    return NULL;
+}
+
+static void* ChunkEdgeThread(void* arg) {
+    ProfileThreadName("hpa build");
+    ChunkEdgeWorker(arg);
+    ProfileThreadExit();
+    EventLogThreadExit();
+    return NULL;
+}
+
+static int GetHpaBuildWorkerCount(void) {
+    int n = hpaBuildThreads;
+    if (n <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        n = 4;
+#endif
+    }
+    if (n < 1) n = 1;
+    if (n > HPA_MAX_BUILD_THREADS) n = HPA_MAX_BUILD_THREADS;
+    return n;
+}
+
+// Run ComputeChunkEdges for every queued job; the calling thread works too
+static void RunChunkEdgeJobs(void) {
+    int workers = GetHpaBuildWorkerCount();
+    int maxUseful = chunkEdgeJobCount / HPA_MIN_JOBS_PER_THREAD;
+    if (workers > maxUseful) workers = maxUseful;
+    if (workers < 1) workers = 1;
+
+    atomic_store(&chunkEdgeNextJob, 0);
+    pthread_t threads[HPA_MAX_BUILD_THREADS];
+    int started = 0;
+    for (int i = 1; i < workers; i++) {
+        if (pthread_create(&threads[started], NULL, ChunkEdgeThread, &chunkSearchScratch[i]) != 0) break;
+        started++;
+    }
+    ChunkEdgeWorker(&chunkSearchScratch[0]);
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+static void BuildFullChunkEntranceLists(int totalChunks) {
+    int needed = entranceCount * 2;
+    if (buildChunkEntCapacity < needed || !buildChunkEntStart) {
+        free(buildChunkEntList);
+        buildChunkEntList = malloc(sizeof(int) * (needed > 0 ? needed : 1));
+        buildChunkEntCapacity = needed;
+        if (!buildChunkEntStart) {
+            buildChunkEntStart = malloc(sizeof(int) * (MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X + 1));
+        }
+    }
+    for (int c = 0; c <= totalChunks; c++) buildChunkEntStart[c] = 0;
+    for (int i = 0; i < entranceCount; i++) {
+        buildChunkEntStart[entrances[i].chunk1 + 1]++;
+        if (entrances[i].chunk2 != entrances[i].chunk1) buildChunkEntStart[entrances[i].chunk2 + 1]++;
+    }
+    for (int c = 0; c < totalChunks; c++) buildChunkEntStart[c + 1] += buildChunkEntStart[c];
+
+    static int cursor[MAX_GRID_DEPTH * MAX_CHUNKS_Y * MAX_CHUNKS_X];
+    for (int c = 0; c < totalChunks; c++) cursor[c] = buildChunkEntStart[c];
+    for (int i = 0; i < entranceCount; i++) {
+        buildChunkEntList[cursor[entrances[i].chunk1]++] = i;
+        if (entrances[i].chunk2 != entrances[i].chunk1) buildChunkEntList[cursor[entrances[i].chunk2]++] = i;
+    }
+    buildChunkEntValid = true;
+}
+
+// Append job edge lists (and their reverse) in chunk order, skipping pairs an
+// earlier chunk already produced (entrances on a shared border)
+static void MergeChunkEdgeLists(void) {
+    for (int job = 0; job < chunkEdgeJobCount; job++) {
+        ChunkEdgeList* list = &chunkEdgeLists[job];
+        for (int k = 0; k < list->count; k++) {
+            int e1 = list->edges[k].from;
+            int e2 = list->edges[k].to;
+            if (EdgeExists(e1, e2)) continue;
+            AddGraphEdgePair(e1, e2, list->edges[k].cost);
+        }
+    }
+}
+
 void BuildGraph(void) {
     graphEdgeCount = 0;
 
@@ -829,66 +1823,17 @@ void BuildGraph(void) {
     int chunksPerLevel = chunksX * chunksY;
     int totalChunks = gridDepth * chunksPerLevel;
     
-    // Build intra-level edges (within each z-level)
+    // Build intra-level edges (within each z-level), one job per chunk with entrances
+    BuildFullChunkEntranceLists(totalChunks);
+    chunkEdgeAffected = NULL;
+    chunkEdgeJobCount = 0;
     for (int chunk = 0; chunk < totalChunks; chunk++) {
-        // Decode chunk ID to get z, cx, cy
-        int z = chunk / chunksPerLevel;
-        int xyChunk = chunk % chunksPerLevel;
-        int cx = xyChunk % chunksX;
-        int cy = xyChunk / chunksX;
-        
-        int minX = cx * chunkWidth;
-        int minY = cy * chunkHeight;
-        int maxX = (cx + 1) * chunkWidth + 1;
-        int maxY = (cy + 1) * chunkHeight + 1;
-        if (maxX > gridWidth) maxX = gridWidth;
-        if (maxY > gridHeight) maxY = gridHeight;
-
-        int chunkEnts[128];
-        int numEnts = 0;
-        for (int i = 0; i < entranceCount && numEnts < 128; i++) {
-            // Only consider entrances on the same z-level
-            if (entrances[i].z != z) continue;
-            if (entrances[i].chunk1 == chunk || entrances[i].chunk2 == chunk)
-                chunkEnts[numEnts++] = i;
-        }
-        for (int i = 0; i < numEnts; i++) {
-            for (int j = i + 1; j < numEnts; j++) {
-                int e1 = chunkEnts[i], e2 = chunkEnts[j];
-
-                // Check if edge already exists (can happen when entrances share 2 chunks)
-                bool exists = false;
-                for (int k = 0; k < adjListCount[e1] && !exists; k++) {
-                    int edgeIdx = adjList[e1][k];
-                    if (graphEdges[edgeIdx].to == e2) exists = true;
-                }
-                if (exists) continue;
-
-                int cost = AStarChunk(entrances[e1].x, entrances[e1].y, z, entrances[e2].x, entrances[e2].y, minX, minY, maxX, maxY);
-                if (cost >= 0 && graphEdgeCount >= MAX_EDGES - 1) {
-                    static bool warned = false;
-                    if (!warned) {
-                        TraceLog(LOG_WARNING, "MAX_EDGES limit (%d) reached at chunk %d! Graph will be incomplete.", MAX_EDGES, chunk);
-                        warned = true;
-                    }
-                }
-                if (cost >= 0 && graphEdgeCount < MAX_EDGES - 1) {
-                    int edgeIdx1 = graphEdgeCount;
-                    int edgeIdx2 = graphEdgeCount + 1;
-                    graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
-                    graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
-
-                    // Add to adjacency list
-                    if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
-                        adjList[e1][adjListCount[e1]++] = edgeIdx1;
-                    }
-                    if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
-                        adjList[e2][adjListCount[e2]++] = edgeIdx2;
-                    }
-                }
-            }
+        if (buildChunkEntStart[chunk + 1] - buildChunkEntStart[chunk] >= 2) {
+            chunkEdgeJobs[chunkEdgeJobCount++] = chunk;
         }
     }
+    RunChunkEdgeJobs();
+    MergeChunkEdgeLists();
     
     // Add edges for ladder links (cross z-level connections)
     for (int i = 0; i < ladderLinkCount; i++) {
@@ -897,20 +1842,7 @@ void BuildGraph(void) {
         int e2 = link->entranceHigh;
         int cost = link->cost;
         
-        if (graphEdgeCount < MAX_EDGES - 1) {
-            int edgeIdx1 = graphEdgeCount;
-            int edgeIdx2 = graphEdgeCount + 1;
-            graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
-            graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
-            
-            // Add to adjacency list
-            if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
-                adjList[e1][adjListCount[e1]++] = edgeIdx1;
-            }
-            if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
-                adjList[e2][adjListCount[e2]++] = edgeIdx2;
-            }
-        }
+        AddGraphEdgePair(e1, e2, cost);
     }
     
     // Add edges for ramp links (cross z-level connections via directional ramps)
@@ -920,35 +1852,16 @@ void BuildGraph(void) {
         int e2 = link->entranceExit;  // Upper entrance (exit at z+1)
         int cost = link->cost;
         
-        if (graphEdgeCount < MAX_EDGES - 1) {
-            int edgeIdx1 = graphEdgeCount;
-            int edgeIdx2 = graphEdgeCount + 1;
-            // Bidirectional: can walk up and down the ramp
-            graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
-            graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
-            
-            // Add to adjacency list
-            if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
-                adjList[e1][adjListCount[e1]++] = edgeIdx1;
-            }
-            if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
-                adjList[e2][adjListCount[e2]++] = edgeIdx2;
-            }
-        }
+        AddGraphEdgePair(e1, e2, cost);
     }
     
+    MarkAllSuperChunksDirty();
+
     TraceLog(LOG_INFO, "Built graph: %d edges (%d ladder links, %d ramp links) in %.2fms", 
              graphEdgeCount, ladderLinkCount, rampLinkCount, (GetTime() - startTime) * 1000);
     
     // Warn if any limits were hit - these cause pathfinding failures
-    if (entranceCount >= MAX_ENTRANCES) {
-        TraceLog(LOG_WARNING, "HPA* LIMIT HIT: entranceCount=%d >= MAX_ENTRANCES=%d - pathfinding will fail!", 
-                 entranceCount, MAX_ENTRANCES);
-    }
-    if (graphEdgeCount >= MAX_EDGES) {
-        TraceLog(LOG_WARNING, "HPA* LIMIT HIT: graphEdgeCount=%d >= MAX_EDGES=%d - pathfinding will fail!", 
-                 graphEdgeCount, MAX_EDGES);
-    }
+    // (entrance and edge storage grows on demand)
     if (ladderLinkCount >= MAX_LADDERS) {
         TraceLog(LOG_WARNING, "HPA* LIMIT HIT: ladderLinkCount=%d >= MAX_LADDERS=%d - pathfinding will fail!", 
                  ladderLinkCount, MAX_LADDERS);
@@ -1074,7 +1987,7 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
                     else if (!open && runStart >= 0) {
                         int length = i - runStart;
                         int pos = 0;
-                        while (length > 0 && newCount < MAX_ENTRANCES) {
+                        while (length > 0 && EnsureEntranceCapacity(newCount + 1)) {
                             int segLen = (length > MAX_ENTRANCE_WIDTH) ? MAX_ENTRANCE_WIDTH : length;
                             int mid = pos + segLen / 2;
                             entrances[newCount++] = (Entrance){startX + runStart + mid, borderY, z, chunk1, chunk2};
@@ -1087,7 +2000,7 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
                 if (runStart >= 0) {
                     int length = chunkWidth - runStart;
                     int pos = 0;
-                    while (length > 0 && newCount < MAX_ENTRANCES) {
+                    while (length > 0 && EnsureEntranceCapacity(newCount + 1)) {
                         int segLen = (length > MAX_ENTRANCE_WIDTH) ? MAX_ENTRANCE_WIDTH : length;
                         int mid = pos + segLen / 2;
                         entrances[newCount++] = (Entrance){startX + runStart + mid, borderY, z, chunk1, chunk2};
@@ -1116,7 +2029,7 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
                     else if (!open && runStart >= 0) {
                         int length = i - runStart;
                         int pos = 0;
-                        while (length > 0 && newCount < MAX_ENTRANCES) {
+                        while (length > 0 && EnsureEntranceCapacity(newCount + 1)) {
                             int segLen = (length > MAX_ENTRANCE_WIDTH) ? MAX_ENTRANCE_WIDTH : length;
                             int mid = pos + segLen / 2;
                             entrances[newCount++] = (Entrance){borderX, startY + runStart + mid, z, chunk1, chunk2};
@@ -1129,7 +2042,7 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
                 if (runStart >= 0) {
                     int length = chunkHeight - runStart;
                     int pos = 0;
-                    while (length > 0 && newCount < MAX_ENTRANCES) {
+                    while (length > 0 && EnsureEntranceCapacity(newCount + 1)) {
                         int segLen = (length > MAX_ENTRANCE_WIDTH) ? MAX_ENTRANCE_WIDTH : length;
                         int mid = pos + segLen / 2;
                         entrances[newCount++] = (Entrance){borderX, startY + runStart + mid, z, chunk1, chunk2};
@@ -1163,7 +2076,7 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
                     
                     if (ladderAffected) {
                         // Ladder is in affected chunk - add new entrances
-                        if (ladderLinkCount < MAX_LADDERS && newCount + 2 <= MAX_ENTRANCES) {
+                        if (ladderLinkCount < MAX_LADDERS && EnsureEntranceCapacity(newCount + 2)) {
                             int chunkLow = z * (chunksX * chunksY) + cy * chunksX + cx;
                             int chunkHigh = (z + 1) * (chunksX * chunksY) + cy * chunksX + cx;
                             
@@ -1237,7 +2150,7 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
                     
                     if (rampAffected) {
                         // Ramp is in affected chunk - add new entrances
-                        if (rampLinkCount < MAX_RAMP_LINKS && newCount + 2 <= MAX_ENTRANCES) {
+                        if (rampLinkCount < MAX_RAMP_LINKS && EnsureEntranceCapacity(newCount + 2)) {
                             int chunkRamp = z * (chunksX * chunksY) + cyRamp * chunksX + cxRamp;
                             int chunkExit = (z + 1) * (chunksX * chunksY) + cyExit * chunksX + cxExit;
                             
@@ -1298,10 +2211,6 @@ static void RebuildAffectedEntrances(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHU
     entranceCount = newCount;
 }
 
-// Storage for old entrances before rebuild (used for edge remapping)
-static Entrance oldEntrances[MAX_ENTRANCES];
-static int oldEntranceCount = 0;
-
 // Save entrances before rebuilding (call before RebuildAffectedEntrances)
 static void SaveOldEntrances(void) {
     oldEntranceCount = entranceCount;
@@ -1373,15 +2282,18 @@ static void RebuildAffectedEdges(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHUNKS_
     }
 
     // Step 3: Rebuild edges using multi-target Dijkstra (one search per affected entrance)
-    // Instead of O(n²) A* calls per chunk, we do O(n) Dijkstra calls
+    // Instead of O(n²) A* calls per chunk, we do O(n) Dijkstra calls. Chunks run
+    // as parallel jobs against the kept edges, then merge in chunk order.
     int chunksPerLevel = chunksX * chunksY;
+    chunkEdgeAffected = affectedChunks;
+    chunkEdgeJobCount = 0;
 
     for (int z = 0; z < gridDepth; z++) {
         for (int cy = 0; cy < chunksY; cy++) {
             for (int cx = 0; cx < chunksX; cx++) {
                 int chunk = z * chunksPerLevel + cy * chunksX + cx;
                 int numEnts = chunkEntranceCount[chunk];
-                if (numEnts == 0) continue;
+                if (numEnts < 2) continue;
 
                 // Skip chunks that don't need processing
                 if (!affectedChunks[z][cy][cx]) {
@@ -1395,91 +2307,15 @@ static void RebuildAffectedEdges(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHUNKS_
                     }
                     if (!needsProcessing) continue;
                 }
-
-                int minX = cx * chunkWidth;
-                int minY = cy * chunkHeight;
-                int maxX = (cx + 1) * chunkWidth + 1;
-                int maxY = (cy + 1) * chunkHeight + 1;
-                if (maxX > gridWidth) maxX = gridWidth;
-                if (maxY > gridHeight) maxY = gridHeight;
-
-                // Collect which entrances in this chunk are affected
-                // and which need edges rebuilt
-                bool entAffected[MAX_ENTRANCES_PER_CHUNK];
-                for (int i = 0; i < numEnts; i++) {
-                    int entIdx = chunkEntrances[chunk][i];
-                    entAffected[i] = NewEntranceTouchesAffected(entIdx, affectedChunks);
-                }
-
-                // For each AFFECTED entrance, run ONE multi-target Dijkstra to find
-                // costs to ALL other entrances in the chunk (not just affected ones)
-                // This is more efficient because:
-                // - We only run Dijkstra from affected entrances (fewer calls)
-                // - Each call finds edges to both affected and unaffected entrances
-                int targetX[MAX_ENTRANCES_PER_CHUNK];
-                int targetY[MAX_ENTRANCES_PER_CHUNK];
-                int targetIdx[MAX_ENTRANCES_PER_CHUNK];
-                int outCosts[MAX_ENTRANCES_PER_CHUNK];
-
-                for (int i = 0; i < numEnts; i++) {
-                    if (!entAffected[i]) continue;  // Only run from affected entrances
-
-                    int e1 = chunkEntrances[chunk][i];
-
-                    // Build target list: all OTHER entrances that don't have edges yet
-                    int numTargets = 0;
-                    for (int j = 0; j < numEnts; j++) {
-                        if (j == i) continue;  // Skip self
-
-                        int e2 = chunkEntrances[chunk][j];
-
-                        // Check if edge already exists (from kept edges or earlier in this loop)
-                        bool exists = false;
-                        for (int k = 0; k < adjListCount[e1] && !exists; k++) {
-                            int edgeIdx = adjList[e1][k];
-                            if (graphEdges[edgeIdx].to == e2) exists = true;
-                        }
-                        if (exists) continue;
-
-                        targetX[numTargets] = entrances[e2].x;
-                        targetY[numTargets] = entrances[e2].y;
-                        targetIdx[numTargets] = j;  // Store chunk-local index
-                        numTargets++;
-                    }
-
-                    if (numTargets == 0) continue;
-
-                    // Run ONE multi-target Dijkstra from e1 to all targets
-                    AStarChunkMultiTarget(entrances[e1].x, entrances[e1].y, z,
-                                          targetX, targetY, outCosts, numTargets,
-                                          minX, minY, maxX, maxY);
-
-                    // Add edges for all reachable targets
-                    for (int t = 0; t < numTargets; t++) {
-                        int cost = outCosts[t];
-                        if (cost < 0) continue;  // Unreachable
-
-                        int e2 = chunkEntrances[chunk][targetIdx[t]];
-
-                        if (graphEdgeCount >= MAX_EDGES - 1) continue;
-
-                        int edgeIdx1 = graphEdgeCount;
-                        int edgeIdx2 = graphEdgeCount + 1;
-                        graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
-                        graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
-
-                        if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
-                            adjList[e1][adjListCount[e1]++] = edgeIdx1;
-                        }
-                        if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
-                            adjList[e2][adjListCount[e2]++] = edgeIdx2;
-                        }
-                    }
-                }
+                chunkEdgeJobs[chunkEdgeJobCount++] = chunk;
             }
         }
     }
 
+    RunChunkEdgeJobs();
+    MergeChunkEdgeLists();
+    chunkEdgeAffected = NULL;
+
     // Add edges for ladder links (cross z-level connections)
     for (int i = 0; i < ladderLinkCount; i++) {
         LadderLink* link = &ladderLinks[i];
@@ -1495,19 +2331,7 @@ static void RebuildAffectedEdges(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHUNKS_
         }
         if (exists) continue;
         
-        if (graphEdgeCount < MAX_EDGES - 1) {
-            int edgeIdx1 = graphEdgeCount;
-            int edgeIdx2 = graphEdgeCount + 1;
-            graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
-            graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
-            
-            if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
-                adjList[e1][adjListCount[e1]++] = edgeIdx1;
-            }
-            if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
-                adjList[e2][adjListCount[e2]++] = edgeIdx2;
-            }
-        }
+        AddGraphEdgePair(e1, e2, cost);
     }
     
     // Add edges for ramp links (cross z-level connections via directional ramps)
@@ -1525,19 +2349,7 @@ static void RebuildAffectedEdges(bool affectedChunks[MAX_GRID_DEPTH][MAX_CHUNKS_
         }
         if (exists) continue;
         
-        if (graphEdgeCount < MAX_EDGES - 1) {
-            int edgeIdx1 = graphEdgeCount;
-            int edgeIdx2 = graphEdgeCount + 1;
-            graphEdges[graphEdgeCount++] = (GraphEdge){e1, e2, cost};
-            graphEdges[graphEdgeCount++] = (GraphEdge){e2, e1, cost};
-            
-            if (adjListCount[e1] < MAX_EDGES_PER_NODE) {
-                adjList[e1][adjListCount[e1]++] = edgeIdx1;
-            }
-            if (adjListCount[e2] < MAX_EDGES_PER_NODE) {
-                adjList[e2][adjListCount[e2]++] = edgeIdx2;
-            }
-        }
+        AddGraphEdgePair(e1, e2, cost);
     }
 
 }
@@ -1567,6 +2379,8 @@ void UpdateDirtyChunks(void) {
 
     // Rebuild edges (keeps edges in unaffected chunks, rebuilds affected)
     RebuildAffectedEdges(affectedChunks);
+    BuildFullChunkEntranceLists(gridDepth * chunksX * chunksY);
+    UpdateSuperChunksAfterEdit(affectedChunks);
 
     // Clear dirty flags (all z-levels)
     for (int z = 0; z < gridDepth; z++)
@@ -1577,14 +2391,6 @@ void UpdateDirtyChunks(void) {
     hpaNeedsRebuild = false;
 
     // Warn if any limits were hit during incremental update
-    if (entranceCount >= MAX_ENTRANCES) {
-        TraceLog(LOG_WARNING, "HPA* LIMIT HIT: entranceCount=%d >= MAX_ENTRANCES=%d - pathfinding will fail!", 
-                 entranceCount, MAX_ENTRANCES);
-    }
-    if (graphEdgeCount >= MAX_EDGES) {
-        TraceLog(LOG_WARNING, "HPA* LIMIT HIT: graphEdgeCount=%d >= MAX_EDGES=%d - pathfinding will fail!", 
-                 graphEdgeCount, MAX_EDGES);
-    }
     if (ladderLinkCount >= MAX_LADDERS) {
         TraceLog(LOG_WARNING, "HPA* LIMIT HIT: ladderLinkCount=%d >= MAX_LADDERS=%d - pathfinding will fail!", 
                  ladderLinkCount, MAX_LADDERS);
@@ -1603,14 +2409,21 @@ static int Heuristic3D(int x0, int y0, int z0, int x1, int y1, int z1) {
     int dx = abs(x1 - x0);
     int dy = abs(y1 - y0);
     int dz = abs(z1 - z0);
+    int xy;
     if (use8Dir) {
         int maxXY = (dx > dy) ? dx : dy;
         int minXY = (dx < dy) ? dx : dy;
-        // Cardinal = 8, Diagonal = 11, z-transition = 8
-        return (maxXY - minXY) * MIN_CELL_COST + minXY * 11 + dz * MIN_CELL_COST;
+        // Cardinal = 8, Diagonal = 11
+        xy = (maxXY - minXY) * MIN_CELL_COST + minXY * 11;
     } else {
-        return (dx + dy + dz) * MIN_CELL_COST;
+        xy = (dx + dy) * MIN_CELL_COST;
     }
+    // A ramp step moves one cell and one z-level for 11, so charging a full
+    // 8 per level on top of the flat distance overestimates and A* can settle
+    // on a longer route. Ladders cost 8 per level with no flat movement.
+    int viaRamps = xy + dz * 3;
+    int viaLadders = dz * MIN_CELL_COST;
+    return viaRamps > viaLadders ? viaRamps : viaLadders;
 }
 
 void RunAStar(void) {
@@ -1985,6 +2798,30 @@ static int ReconstructLocalPath(int sx, int sy, int sz, int gx, int gy, int gz,
     return ReconstructLocalPathWithBounds(sx, sy, sz, gx, gy, expandedMinX, expandedMinY, expandedMaxX, expandedMaxY, outPath, maxLen);
 }
 
+// Entrances touching a chunk, in entrance order (capped at maxCount)
+static int GatherChunkEntrances(int chunk, int* outX, int* outY, int* outIdx, int maxCount) {
+    int count = 0;
+    if (buildChunkEntValid) {
+        for (int k = buildChunkEntStart[chunk]; k < buildChunkEntStart[chunk + 1] && count < maxCount; k++) {
+            int i = buildChunkEntList[k];
+            outX[count] = entrances[i].x;
+            outY[count] = entrances[i].y;
+            outIdx[count] = i;
+            count++;
+        }
+        return count;
+    }
+    for (int i = 0; i < entranceCount && count < maxCount; i++) {
+        if (entrances[i].chunk1 == chunk || entrances[i].chunk2 == chunk) {
+            outX[count] = entrances[i].x;
+            outY[count] = entrances[i].y;
+            outIdx[count] = i;
+            count++;
+        }
+    }
+    return count;
+}
+
 int FindPathHPA(Point start, Point goal, Point* outPath, int maxLen) {
     if (start.x < 0 || goal.x < 0) return 0;
     if (entranceCount == 0) return 0;  // Need to build entrances first
@@ -2020,11 +2857,6 @@ int FindPathHPA(Point start, Point goal, Point* outPath, int maxLen) {
     int goalNode = entranceCount + 1;   // Index for goal as temp node
     int totalNodes = entranceCount + 2;
 
-    // Initialize abstract nodes
-    for (int i = 0; i < totalNodes; i++) {
-        abstractNodes[i] = (AbstractNode){COST_INF, COST_INF, -1, false, false};
-    }
-
     // Build temporary edges from start to entrances in its chunk
     // and from goal to entrances in its chunk
     // We'll store these costs in arrays
@@ -2038,29 +2870,11 @@ int FindPathHPA(Point start, Point goal, Point* outPath, int maxLen) {
 
     int minX, minY, maxX, maxY;
 
-    // Gather entrances for start chunk
+    // Gather entrances for start and goal chunks
     int startTargetX[128], startTargetY[128], startTargetIdx[128];
-    int startTargetCount = 0;
-    for (int i = 0; i < entranceCount && startTargetCount < 128; i++) {
-        if (entrances[i].chunk1 == startChunk || entrances[i].chunk2 == startChunk) {
-            startTargetX[startTargetCount] = entrances[i].x;
-            startTargetY[startTargetCount] = entrances[i].y;
-            startTargetIdx[startTargetCount] = i;
-            startTargetCount++;
-        }
-    }
-
-    // Gather entrances for goal chunk
+    int startTargetCount = GatherChunkEntrances(startChunk, startTargetX, startTargetY, startTargetIdx, 128);
     int goalTargetX[128], goalTargetY[128], goalTargetIdx[128];
-    int goalTargetCount = 0;
-    for (int i = 0; i < entranceCount && goalTargetCount < 128; i++) {
-        if (entrances[i].chunk1 == goalChunk || entrances[i].chunk2 == goalChunk) {
-            goalTargetX[goalTargetCount] = entrances[i].x;
-            goalTargetY[goalTargetCount] = entrances[i].y;
-            goalTargetIdx[goalTargetCount] = i;
-            goalTargetCount++;
-        }
-    }
+    int goalTargetCount = GatherChunkEntrances(goalChunk, goalTargetX, goalTargetY, goalTargetIdx, 128);
 
     // Debug: report entrances found
     if (debugCrossZ) {
@@ -2168,83 +2982,84 @@ int FindPathHPA(Point start, Point goal, Point* outPath, int maxLen) {
                  goal.z, goalCrossZEdges, goalReachesUp, goalReachesDown);
     }
 
-    // A* on abstract graph using binary heap
-    double abstractStartTime = GetTime();
-    HeapInit(totalNodes);
-
-    abstractNodes[startNode].g = 0;
-    abstractNodes[startNode].f = Heuristic(start.x, start.y, goal.x, goal.y);
-    abstractNodes[startNode].open = true;
-    HeapPush(startNode);
-
-    while (heap.size > 0) {
-        // Pop best node from heap
-        int best = HeapPop();
-
-        if (best == goalNode) {
-            // Reconstruct abstract path
-            int current = goalNode;
-            while (current >= 0 && abstractPathLength < MAX_ENTRANCES + 2) {
-                abstractPath[abstractPathLength++] = current;
-                current = abstractNodes[current].parent;
-            }
-            break;
+    // Long queries (different super-chunks) search the level-2 graph instead
+    bool useSuperGraph = false;
+    int startSuper = -1, goalSuper = -1;
+    if (SuperGraphEnabled()) {
+        startSuper = SuperOfChunk(startChunk);
+        goalSuper = SuperOfChunk(goalChunk);
+        if (startSuper != goalSuper) {
+            BuildHpaSuperGraph();
+            useSuperGraph = !superGraphStale;
         }
+    }
 
-        abstractNodes[best].open = false;
-        abstractNodes[best].closed = true;
-        nodesExplored++;
-
-        // Expand neighbors
-        if (best == startNode) {
-            // Expand from start to its connected entrances
-            for (int i = 0; i < startEdgeCount; i++) {
-                int neighbor = startEdgeTargets[i];
-                if (abstractNodes[neighbor].closed) continue;
-                int ng = abstractNodes[best].g + startEdgeCosts[i];
-                if (ng < abstractNodes[neighbor].g) {
-                    bool wasOpen = abstractNodes[neighbor].open;
-                    abstractNodes[neighbor].g = ng;
-                    abstractNodes[neighbor].f = ng + Heuristic(entrances[neighbor].x, entrances[neighbor].y, goal.x, goal.y);
-                    abstractNodes[neighbor].parent = best;
-                    abstractNodes[neighbor].open = true;
-                    if (wasOpen) {
-                        HeapDecreaseKey(neighbor);
-                    } else {
-                        HeapPush(neighbor);
-                    }
+    double abstractStartTime = GetTime();
+    if (useSuperGraph) {
+        SearchSuperGraph(start, goal, startSuper, goalSuper,
+                         startEdgeTargets, startEdgeCosts, startEdgeCount,
+                         goalEdgeTargets, goalEdgeCosts, goalEdgeCount);
+    } else {
+        // A* on abstract graph using binary heap
+        for (int i = 0; i < totalNodes; i++) {
+            abstractNodes[i] = (AbstractNode){COST_INF, COST_INF, -1, false, false};
+        }
+        HeapInit(totalNodes);
+
+        abstractNodes[startNode].g = 0;
+        abstractNodes[startNode].f = Heuristic(start.x, start.y, goal.x, goal.y);
+        abstractNodes[startNode].open = true;
+        HeapPush(startNode);
+
+        while (heap.size > 0) {
+            // Pop best node from heap
+            int best = HeapPop();
+
+            if (best == goalNode) {
+                // Reconstruct abstract path
+                int current = goalNode;
+                while (current >= 0 && abstractPathLength < entranceCount + 2) {
+                    abstractPath[abstractPathLength++] = current;
+                    current = abstractNodes[current].parent;
                 }
+                break;
             }
-        } else if (best < entranceCount) {
-            // Expand from a regular entrance using adjacency list
-            for (int i = 0; i < adjListCount[best]; i++) {
-                int edgeIdx = adjList[best][i];
-                int neighbor = graphEdges[edgeIdx].to;
-                if (abstractNodes[neighbor].closed) continue;
-                int ng = abstractNodes[best].g + graphEdges[edgeIdx].cost;
-                if (ng < abstractNodes[neighbor].g) {
-                    bool wasOpen = abstractNodes[neighbor].open;
-                    abstractNodes[neighbor].g = ng;
-                    abstractNodes[neighbor].f = ng + Heuristic(entrances[neighbor].x, entrances[neighbor].y, goal.x, goal.y);
-                    abstractNodes[neighbor].parent = best;
-                    abstractNodes[neighbor].open = true;
-                    if (wasOpen) {
-                        HeapDecreaseKey(neighbor);
-                    } else {
-                        HeapPush(neighbor);
+
+            abstractNodes[best].open = false;
+            abstractNodes[best].closed = true;
+            nodesExplored++;
+
+            // Expand neighbors
+            if (best == startNode) {
+                // Expand from start to its connected entrances
+                for (int i = 0; i < startEdgeCount; i++) {
+                    int neighbor = startEdgeTargets[i];
+                    if (abstractNodes[neighbor].closed) continue;
+                    int ng = abstractNodes[best].g + startEdgeCosts[i];
+                    if (ng < abstractNodes[neighbor].g) {
+                        bool wasOpen = abstractNodes[neighbor].open;
+                        abstractNodes[neighbor].g = ng;
+                        abstractNodes[neighbor].f = ng + Heuristic(entrances[neighbor].x, entrances[neighbor].y, goal.x, goal.y);
+                        abstractNodes[neighbor].parent = best;
+                        abstractNodes[neighbor].open = true;
+                        if (wasOpen) {
+                            HeapDecreaseKey(neighbor);
+                        } else {
+                            HeapPush(neighbor);
+                        }
                     }
                 }
-            }
-            // Also check if this entrance can reach goal
-            for (int i = 0; i < goalEdgeCount; i++) {
-                if (goalEdgeTargets[i] == best) {
-                    int neighbor = goalNode;
+            } else if (best < entranceCount) {
+                // Expand from a regular entrance using adjacency list
+                for (int i = 0; i < adjListCount[best]; i++) {
+                    int edgeIdx = adjList[best][i];
+                    int neighbor = graphEdges[edgeIdx].to;
                     if (abstractNodes[neighbor].closed) continue;
-                    int ng = abstractNodes[best].g + goalEdgeCosts[i];
+                    int ng = abstractNodes[best].g + graphEdges[edgeIdx].cost;
                     if (ng < abstractNodes[neighbor].g) {
                         bool wasOpen = abstractNodes[neighbor].open;
                         abstractNodes[neighbor].g = ng;
-                        abstractNodes[neighbor].f = ng;  // h=0 at goal
+                        abstractNodes[neighbor].f = ng + Heuristic(entrances[neighbor].x, entrances[neighbor].y, goal.x, goal.y);
                         abstractNodes[neighbor].parent = best;
                         abstractNodes[neighbor].open = true;
                         if (wasOpen) {
@@ -2254,6 +3069,26 @@ int FindPathHPA(Point start, Point goal, Point* outPath, int maxLen) {
                         }
                     }
                 }
+                // Also check if this entrance can reach goal
+                for (int i = 0; i < goalEdgeCount; i++) {
+                    if (goalEdgeTargets[i] == best) {
+                        int neighbor = goalNode;
+                        if (abstractNodes[neighbor].closed) continue;
+                        int ng = abstractNodes[best].g + goalEdgeCosts[i];
+                        if (ng < abstractNodes[neighbor].g) {
+                            bool wasOpen = abstractNodes[neighbor].open;
+                            abstractNodes[neighbor].g = ng;
+                            abstractNodes[neighbor].f = ng;  // h=0 at goal
+                            abstractNodes[neighbor].parent = best;
+                            abstractNodes[neighbor].open = true;
+                            if (wasOpen) {
+                                HeapDecreaseKey(neighbor);
+                            } else {
+                                HeapPush(neighbor);
+                            }
+                        }
+                    }
+                }
             }
         }
     }
@@ -2700,12 +3535,30 @@ void RunJPS(void) {
 // Positive value: distance to wall (no jump point found)
 // Negative value: distance to jump point (negate to get actual distance)
 // 0: cell is a wall or immediately blocked
-static int16_t jpsDist[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH][8];
+typedef int16_t JpsCellDist[8];
+DEFINE_STATIC_WORLD_LAYER(JpsCellDist, jpsDist);
 static bool jpsPrecomputed = false;  // Set to false when needsRebuild triggers
 
+// Cell edits queued by MarkChunkDirty since the last JPS+ refresh
+#define JPS_MAX_PENDING_EDITS 1024
+static Point jpsPendingEdits[JPS_MAX_PENDING_EDITS];
+static int jpsPendingEditCount = 0;
+int jpsFullPrecomputeCount = 0;
+int jpsIncrementalUpdateCount = 0;
+
 // Ladder graph for JPS+ 3D cross-level queries
 JpsLadderGraph jpsLadderGraph;
 static bool jpsLadderGraphBuilt = false;
+static JpsLadderEdge ladderEdgeScratch[MAX_LADDER_EDGES];  // unsorted edges during build
+static int ladderEdgeCursor[MAX_LADDER_ENDPOINTS];
+
+// Per-query Dijkstra state over ladder endpoints
+static int ladderDist[MAX_LADDER_ENDPOINTS];
+static int ladderPrev[MAX_LADDER_ENDPOINTS];
+static int ladderGoalDist[MAX_LADDER_ENDPOINTS];
+static int ladderHeap[MAX_LADDER_ENDPOINTS];
+static int ladderHeapPos[MAX_LADDER_ENDPOINTS];
+static int ladderHeapSize = 0;
 
 // Direction indices: 0=N, 1=NE, 2=E, 3=SE, 4=S, 5=SW, 6=W, 7=NW
 static const int jpsDx[8] = {0, 1, 1, 1, 0, -1, -1, -1};
@@ -2789,119 +3642,108 @@ static bool HasForcedNeighborCardinal(int x, int y, int z, int dir) {
     }
 }
 
-// Precompute JPS+ data for a single z-level using efficient row/column sweeps
-// This is O(n²) instead of O(n² × avg_jump_dist)
-static void PrecomputeJpsPlusForLevel(int z) {
-    // Initialize all to 0 (walls)
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            for (int d = 0; d < 8; d++) jpsDist[z][y][x][d] = 0;
+// Sweep one row for E (dir=2) and W (dir=6), writing 0 for walls
+static void SweepJpsPlusRow(int z, int y) {
+    // East: scan right-to-left so each cell counts toward the next stop to its east
+    int distToJP = 0;  // positive = dist to wall, negative = dist to jump point
+    bool countingFromWall = true;
+    for (int x = gridWidth - 1; x >= 0; x--) {
+        if (!JpsPlusIsWalkable(x, y, z)) {
+            jpsDist[z][y][x][2] = 0;
+            distToJP = 0;
+            countingFromWall = true;
+            continue;
         }
-    }
-
-    // === CARDINAL DIRECTIONS (sweep-based) ===
-
-    // East (dir=2): sweep left-to-right per row
-    for (int y = 0; y < gridHeight; y++) {
-        int distToJP = 0;  // positive = dist to wall, negative = dist to jump point
-        bool countingFromWall = true;
 
-        for (int x = gridWidth - 1; x >= 0; x--) {
-            if (!JpsPlusIsWalkable(x, y, z)) {
-                distToJP = 0;
-                countingFromWall = true;
-                continue;
-            }
-
-            distToJP++;
+        distToJP++;
+        jpsDist[z][y][x][2] = countingFromWall ? distToJP : -distToJP;
 
-            if (HasForcedNeighborCardinal(x, y, z, 2)) {
-                // This cell is a jump point for westward travelers
-                jpsDist[z][y][x][2] = countingFromWall ? distToJP : -distToJP;
-                distToJP = 0;
-                countingFromWall = false;  // Next cells count toward this jump point
-            } else {
-                jpsDist[z][y][x][2] = countingFromWall ? distToJP : -distToJP;
-            }
+        if (HasForcedNeighborCardinal(x, y, z, 2)) {
+            // This cell is a jump point for westward travelers
+            distToJP = 0;
+            countingFromWall = false;  // Next cells count toward this jump point
         }
     }
 
-    // West (dir=6): sweep right-to-left per row
-    for (int y = 0; y < gridHeight; y++) {
-        int distToJP = 0;
-        bool countingFromWall = true;
-
-        for (int x = 0; x < gridWidth; x++) {
-            if (!JpsPlusIsWalkable(x, y, z)) {
-                distToJP = 0;
-                countingFromWall = true;
-                continue;
-            }
+    // West: scan left-to-right
+    distToJP = 0;
+    countingFromWall = true;
+    for (int x = 0; x < gridWidth; x++) {
+        if (!JpsPlusIsWalkable(x, y, z)) {
+            jpsDist[z][y][x][6] = 0;
+            distToJP = 0;
+            countingFromWall = true;
+            continue;
+        }
 
-            distToJP++;
+        distToJP++;
+        jpsDist[z][y][x][6] = countingFromWall ? distToJP : -distToJP;
 
-            if (HasForcedNeighborCardinal(x, y, z, 6)) {
-                jpsDist[z][y][x][6] = countingFromWall ? distToJP : -distToJP;
-                distToJP = 0;
-                countingFromWall = false;
-            } else {
-                jpsDist[z][y][x][6] = countingFromWall ? distToJP : -distToJP;
-            }
+        if (HasForcedNeighborCardinal(x, y, z, 6)) {
+            distToJP = 0;
+            countingFromWall = false;
         }
     }
+}
 
-    // South (dir=4): sweep top-to-bottom per column
-    for (int x = 0; x < gridWidth; x++) {
-        int distToJP = 0;
-        bool countingFromWall = true;
-
-        for (int y = gridHeight - 1; y >= 0; y--) {
-            if (!JpsPlusIsWalkable(x, y, z)) {
-                distToJP = 0;
-                countingFromWall = true;
-                continue;
-            }
+// Sweep one column for S (dir=4) and N (dir=0), writing 0 for walls
+static void SweepJpsPlusColumn(int z, int x) {
+    // South: scan bottom-to-top
+    int distToJP = 0;
+    bool countingFromWall = true;
+    for (int y = gridHeight - 1; y >= 0; y--) {
+        if (!JpsPlusIsWalkable(x, y, z)) {
+            jpsDist[z][y][x][4] = 0;
+            distToJP = 0;
+            countingFromWall = true;
+            continue;
+        }
 
-            distToJP++;
+        distToJP++;
+        jpsDist[z][y][x][4] = countingFromWall ? distToJP : -distToJP;
 
-            if (HasForcedNeighborCardinal(x, y, z, 4)) {
-                jpsDist[z][y][x][4] = countingFromWall ? distToJP : -distToJP;
-                distToJP = 0;
-                countingFromWall = false;
-            } else {
-                jpsDist[z][y][x][4] = countingFromWall ? distToJP : -distToJP;
-            }
+        if (HasForcedNeighborCardinal(x, y, z, 4)) {
+            distToJP = 0;
+            countingFromWall = false;
         }
     }
 
-    // North (dir=0): sweep bottom-to-top per column
-    for (int x = 0; x < gridWidth; x++) {
-        int distToJP = 0;
-        bool countingFromWall = true;
-
-        for (int y = 0; y < gridHeight; y++) {
-            if (!JpsPlusIsWalkable(x, y, z)) {
-                distToJP = 0;
-                countingFromWall = true;
-                continue;
-            }
+    // North: scan top-to-bottom
+    distToJP = 0;
+    countingFromWall = true;
+    for (int y = 0; y < gridHeight; y++) {
+        if (!JpsPlusIsWalkable(x, y, z)) {
+            jpsDist[z][y][x][0] = 0;
+            distToJP = 0;
+            countingFromWall = true;
+            continue;
+        }
 
-            distToJP++;
+        distToJP++;
+        jpsDist[z][y][x][0] = countingFromWall ? distToJP : -distToJP;
 
-            if (HasForcedNeighborCardinal(x, y, z, 0)) {
-                jpsDist[z][y][x][0] = countingFromWall ? distToJP : -distToJP;
-                distToJP = 0;
-                countingFromWall = false;
-            } else {
-                jpsDist[z][y][x][0] = countingFromWall ? distToJP : -distToJP;
-            }
+        if (HasForcedNeighborCardinal(x, y, z, 0)) {
+            distToJP = 0;
+            countingFromWall = false;
         }
     }
+}
+
+// Precompute JPS+ data for a single z-level using efficient row/column sweeps
+// This is O(n²) instead of O(n² × avg_jump_dist)
+static void PrecomputeJpsPlusForLevel(int z) {
+    // === CARDINAL DIRECTIONS (sweep-based, walls written as 0) ===
+    for (int y = 0; y < gridHeight; y++) SweepJpsPlusRow(z, y);
+    for (int x = 0; x < gridWidth; x++) SweepJpsPlusColumn(z, x);
 
     // === DIAGONAL DIRECTIONS (still need per-cell, but use precomputed cardinals) ===
     for (int y = 0; y < gridHeight; y++) {
         for (int x = 0; x < gridWidth; x++) {
-            if (!JpsPlusIsWalkable(x, y, z)) continue;
+            if (!JpsPlusIsWalkable(x, y, z)) {
+                jpsDist[z][y][x][1] = jpsDist[z][y][x][3] = 0;
+                jpsDist[z][y][x][5] = jpsDist[z][y][x][7] = 0;
+                continue;
+            }
             jpsDist[z][y][x][1] = ComputeDiagonalJumpDist(x, y, z, 1);
             jpsDist[z][y][x][3] = ComputeDiagonalJumpDist(x, y, z, 3);
             jpsDist[z][y][x][5] = ComputeDiagonalJumpDist(x, y, z, 5);
@@ -2911,8 +3753,9 @@ static void PrecomputeJpsPlusForLevel(int z) {
 }
 
 // Precompute JPS+ data for all z-levels
-// NOTE: JPS+ is optimized for STATIC maps. Preprocessing takes ~500ms on 512x512 per level.
-// For dynamic terrain (colony sims, etc.), use HPA* instead which supports incremental updates.
+// NOTE: Preprocessing takes ~500ms on 512x512 per level. After the first
+// precompute, MarkChunkDirty queues cell edits and only the affected lines
+// are refreshed (see ApplyJpsPlusEdits).
 void PrecomputeJpsPlus(void) {
     double startTime = GetTime();
     
@@ -2923,18 +3766,199 @@ void PrecomputeJpsPlus(void) {
     
     jpsPrecomputed = true;
     jpsNeedsRebuild = false;
+    jpsPendingEditCount = 0;
     jpsLadderGraphBuilt = false;  // Ladder graph needs rebuild after JPS+ precompute
+    jpsFullPrecomputeCount++;
     
     TraceLog(LOG_INFO, "JPS+ precomputed for %d z-levels in %.2fms", gridDepth, (GetTime() - startTime) * 1000.0);
 }
 
-// JPS+ search on a single z-level with bounded region
-// Returns cost to goal, or -1 if no path found
-static int JpsPlusChunk2D(int sx, int sy, int sz, int gx, int gy, int minX, int minY, int maxX, int maxY) {
+// ============== JPS+ Incremental Updates ==============
+//
+// A cell edit at (x,y,z) changes walkability at z and z+1 (support) and
+// ladder connections at z-1..z+2. Cardinal jump distances read only their own row/column plus the
+// two neighbouring lines, so rows y-1..y+1 and columns x-1..x+1 are re-swept.
+// Diagonal rays read the 3x3 around each ray cell and the sign of the cardinal
+// distances on it, so the 3x3 around the edit plus every cell whose cardinal
+// sign flipped seeds a backward walk along each diagonal. Along that walk a
+// cell's value follows from its successor's (DiagonalJumpDistFromNext), and
+// the walk stops once a value comes out unchanged.
+
+static bool jpsLevelDirty[MAX_GRID_DEPTH];
+static bool jpsRowDirty[MAX_GRID_DEPTH][MAX_GRID_HEIGHT];
+static bool jpsColDirty[MAX_GRID_DEPTH][MAX_GRID_WIDTH];
+static uint32_t jpsSeedStamp[MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+static uint32_t jpsSeedSerial = 0;
+static int jpsSeedCells[MAX_GRID_HEIGHT * MAX_GRID_WIDTH];  // y * gridWidth + x
+static int jpsSeedCount = 0;
+
+static void QueueJpsPlusEdit(int x, int y, int z) {
+    // A full precompute is pending anyway
+    if (!jpsPrecomputed || jpsNeedsRebuild) return;
+
+    if (jpsPendingEditCount > 0) {
+        Point* last = &jpsPendingEdits[jpsPendingEditCount - 1];
+        if (last->x == x && last->y == y && last->z == z) return;
+    }
+    if (jpsPendingEditCount >= JPS_MAX_PENDING_EDITS) {
+        // Bulk edit (terrain gen, big designation): a full sweep is cheaper
+        jpsNeedsRebuild = true;
+        jpsPendingEditCount = 0;
+        return;
+    }
+    jpsPendingEdits[jpsPendingEditCount++] = (Point){x, y, z};
+}
+
+static void AddJpsSeed(int x, int y) {
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight) return;
+    if (jpsSeedStamp[y][x] == jpsSeedSerial) return;
+    jpsSeedStamp[y][x] = jpsSeedSerial;
+    jpsSeedCells[jpsSeedCount++] = y * gridWidth + x;
+}
+
+// Bitmask of which cardinal distances at a cell point at a jump point
+static inline uint8_t JpsCardinalSigns(int z, int y, int x) {
+    const int16_t* d = jpsDist[z][y][x];
+    return (uint8_t)((d[0] < 0) | (d[2] < 0) << 1 | (d[4] < 0) << 2 | (d[6] < 0) << 3);
+}
+
+static void RefreshJpsPlusRow(int z, int y) {
+    uint8_t oldSigns[MAX_GRID_WIDTH];
+    for (int x = 0; x < gridWidth; x++) oldSigns[x] = JpsCardinalSigns(z, y, x);
+    SweepJpsPlusRow(z, y);
+    for (int x = 0; x < gridWidth; x++) {
+        if (JpsCardinalSigns(z, y, x) != oldSigns[x]) AddJpsSeed(x, y);
+    }
+}
+
+static void RefreshJpsPlusColumn(int z, int x) {
+    uint8_t oldSigns[MAX_GRID_HEIGHT];
+    for (int y = 0; y < gridHeight; y++) oldSigns[y] = JpsCardinalSigns(z, y, x);
+    SweepJpsPlusColumn(z, x);
+    for (int y = 0; y < gridHeight; y++) {
+        if (JpsCardinalSigns(z, y, x) != oldSigns[y]) AddJpsSeed(x, y);
+    }
+}
+
+// Diagonal jump distance at (x,y) given the (already final) value one step along dir.
+// Same result as ComputeDiagonalJumpDist: the ray from (x,y) is one step plus the ray from next.
+static int16_t DiagonalJumpDistFromNext(int x, int y, int z, int dir) {
+    int dx = jpsDx[dir];
+    int dy = jpsDy[dir];
+    int nx = x + dx;
+    int ny = y + dy;
+    if (!JpsPlusIsWalkable(x, y, z)) return 0;
+    if (!JpsPlusIsWalkable(nx, ny, z) || !JpsPlusDiagonalAllowed(x, y, z, dx, dy)) return 0;
+
+    if (JpsPlusIsLadder(nx, ny, z)) return -1;
+    if ((!JpsPlusIsWalkable(nx - dx, ny, z) && JpsPlusIsWalkable(nx - dx, ny + dy, z)) ||
+        (!JpsPlusIsWalkable(nx, ny - dy, z) && JpsPlusIsWalkable(nx + dx, ny - dy, z))) {
+        return -1;
+    }
+    int16_t hDist = jpsDist[z][ny][nx][(dx > 0) ? 2 : 6];
+    int16_t vDist = jpsDist[z][ny][nx][(dy > 0) ? 4 : 0];
+    if (hDist < 0 || vDist < 0) return -1;
+
+    int16_t next = jpsDist[z][ny][nx][dir];
+    return next < 0 ? next - 1 : next + 1;
+}
+
+static void RefreshJpsPlusDiagonalsFrom(int x, int y, int z) {
+    static const int diagonals[4] = {1, 3, 5, 7};
+    for (int i = 0; i < 4; i++) {
+        int dir = diagonals[i];
+        jpsDist[z][y][x][dir] = JpsPlusIsWalkable(x, y, z) ? ComputeDiagonalJumpDist(x, y, z, dir) : 0;
+
+        // Walk back against the ray; cells behind only see this one through their successor
+        int px = x - jpsDx[dir];
+        int py = y - jpsDy[dir];
+        while (px >= 0 && px < gridWidth && py >= 0 && py < gridHeight) {
+            int16_t value = DiagonalJumpDistFromNext(px, py, z, dir);
+            if (value == jpsDist[z][py][px][dir]) break;
+            jpsDist[z][py][px][dir] = value;
+            px -= jpsDx[dir];
+            py -= jpsDy[dir];
+        }
+    }
+}
+
+static void ApplyJpsPlusEdits(void) {
+    for (int i = 0; i < jpsPendingEditCount; i++) {
+        Point e = jpsPendingEdits[i];
+        for (int z = e.z - 1; z <= e.z + 2; z++) {
+            if (z < 0 || z >= gridDepth) continue;
+            jpsLevelDirty[z] = true;
+            for (int y = e.y - 1; y <= e.y + 1; y++) {
+                if (y >= 0 && y < gridHeight) jpsRowDirty[z][y] = true;
+            }
+            for (int x = e.x - 1; x <= e.x + 1; x++) {
+                if (x >= 0 && x < gridWidth) jpsColDirty[z][x] = true;
+            }
+        }
+    }
+
+    for (int z = 0; z < gridDepth; z++) {
+        if (!jpsLevelDirty[z]) continue;
+        jpsLevelDirty[z] = false;
+
+        if (++jpsSeedSerial == 0) {
+            memset(jpsSeedStamp, 0, sizeof(jpsSeedStamp));
+            jpsSeedSerial = 1;
+        }
+        jpsSeedCount = 0;
+
+        for (int i = 0; i < jpsPendingEditCount; i++) {
+            Point e = jpsPendingEdits[i];
+            if (z < e.z - 1 || z > e.z + 2) continue;
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) AddJpsSeed(e.x + dx, e.y + dy);
+            }
+        }
+
+        // Cardinals first: diagonals read them
+        for (int y = 0; y < gridHeight; y++) {
+            if (!jpsRowDirty[z][y]) continue;
+            jpsRowDirty[z][y] = false;
+            RefreshJpsPlusRow(z, y);
+        }
+        for (int x = 0; x < gridWidth; x++) {
+            if (!jpsColDirty[z][x]) continue;
+            jpsColDirty[z][x] = false;
+            RefreshJpsPlusColumn(z, x);
+        }
+
+        for (int i = 0; i < jpsSeedCount; i++) {
+            int cell = jpsSeedCells[i];
+            RefreshJpsPlusDiagonalsFrom(cell % gridWidth, cell / gridWidth, z);
+        }
+    }
+
+    jpsPendingEditCount = 0;
+    jpsLadderGraphBuilt = false;
+    jpsIncrementalUpdateCount++;
+}
+
+// Bring jump distances up to date: full precompute first time / after bulk edits,
+// otherwise just the lines touched since the last query
+static void EnsureJpsPlusCurrent(void) {
     if (!jpsPrecomputed || jpsNeedsRebuild) {
-        // Full recompute needed - jumps can span entire grid, so incremental updates are unsafe
         PrecomputeJpsPlus();
+    } else if (jpsPendingEditCount > 0) {
+        ApplyJpsPlusEdits();
     }
+}
+
+int GetJpsPlusJumpDist(int x, int y, int z, int dir) {
+    if (x < 0 || x >= gridWidth || y < 0 || y >= gridHeight || z < 0 || z >= gridDepth) return 0;
+    if (dir < 0 || dir >= 8) return 0;
+    EnsureJpsPlusCurrent();
+    return jpsDist[z][y][x][dir];
+}
+
+// JPS+ search on a single z-level with bounded region
+// Returns cost to goal, or -1 if no path found
+static int JpsPlusChunk2D(int sx, int sy, int sz, int gx, int gy, int minX, int minY, int maxX, int maxY) {
+    EnsureJpsPlusCurrent();
 
     if (!JpsPlusIsWalkable(sx, sy, sz) || !JpsPlusIsWalkable(gx, gy, sz)) return -1;
 
@@ -3179,9 +4203,7 @@ void RunJpsPlus(void) {
 // Build ladder graph for JPS+ 3D cross-level queries
 // This scans the grid for ladders (independent of HPA*'s ladderLinks)
 void BuildJpsLadderGraph(void) {
-    if (!jpsPrecomputed || jpsNeedsRebuild) {
-        PrecomputeJpsPlus();
-    }
+    EnsureJpsPlusCurrent();
     
     double startTime = GetTime();
     JpsLadderGraph* g = &jpsLadderGraph;
@@ -3279,19 +4301,12 @@ void BuildJpsLadderGraph(void) {
             }
         }
     }
-done_scanning:
-    
-    // Step 2: Initialize all-pairs to infinity and next matrix
-    for (int i = 0; i < g->endpointCount; i++) {
-        for (int j = 0; j < g->endpointCount; j++) {
-            g->allPairs[i][j] = (i == j) ? 0 : COST_INF;
-            g->next[i][j] = -1;  // No path yet
-        }
-    }
+done_scanning:;
     
-    // Step 3: Add vertical edges (climb cost between low/high of same connection)
+    // Step 2: Vertical edges (climb cost between low/high of same connection)
     // Ladders: same x,y on both levels, cost 10 (cardinal)
     // Ramps: different x,y (ramp to exit), cost 14 (diagonal)
+    int scratchCount = 0;
     for (int i = 0; i < g->endpointCount; i++) {
         LadderEndpoint* ep = &g->endpoints[i];
         if (ep->isLow) {
@@ -3300,20 +4315,16 @@ done_scanning:
             if (highIdx < g->endpointCount && 
                 g->endpoints[highIdx].ladderIndex == ep->ladderIndex &&
                 !g->endpoints[highIdx].isLow) {
-                // Determine cost: ladder (same x,y) = 10, ramp (different x,y) = 14
                 LadderEndpoint* highEp = &g->endpoints[highIdx];
                 int climbCost = (ep->x == highEp->x && ep->y == highEp->y) ? 10 : 14;
                 
-                // Add bidirectional edge
-                g->allPairs[i][highIdx] = climbCost;
-                g->allPairs[highIdx][i] = climbCost;
-                g->next[i][highIdx] = highIdx;  // Direct edge
-                g->next[highIdx][i] = i;        // Direct edge
+                ladderEdgeScratch[scratchCount++] = (JpsLadderEdge){i, highIdx, climbCost};
+                ladderEdgeScratch[scratchCount++] = (JpsLadderEdge){highIdx, i, climbCost};
             }
         }
     }
     
-    // Step 4: Compute same-level distances between ladder endpoints using JPS+
+    // Step 3: Same-level edges between ladder endpoints using JPS+
     for (int z = 0; z < gridDepth; z++) {
         int count = g->endpointsPerLevelCount[z];
         for (int i = 0; i < count; i++) {
@@ -3329,35 +4340,134 @@ done_scanning:
                                           0, 0, gridWidth, gridHeight);
                 
                 if (cost >= 0) {
-                    g->allPairs[fromIdx][toIdx] = cost;
-                    g->allPairs[toIdx][fromIdx] = cost;
-                    g->next[fromIdx][toIdx] = toIdx;  // Direct edge
-                    g->next[toIdx][fromIdx] = fromIdx;  // Direct edge
+                    ladderEdgeScratch[scratchCount++] = (JpsLadderEdge){fromIdx, toIdx, cost};
+                    ladderEdgeScratch[scratchCount++] = (JpsLadderEdge){toIdx, fromIdx, cost};
                 }
             }
         }
     }
     
-    // Step 5: Floyd-Warshall for all-pairs shortest paths through ladder graph
-    // Also track 'next' for path reconstruction
-    int n = g->endpointCount;
-    for (int k = 0; k < n; k++) {
-        for (int i = 0; i < n; i++) {
-            for (int j = 0; j < n; j++) {
-                if (g->allPairs[i][k] < COST_INF && g->allPairs[k][j] < COST_INF) {
-                    int through = g->allPairs[i][k] + g->allPairs[k][j];
-                    if (through < g->allPairs[i][j]) {
-                        g->allPairs[i][j] = through;
-                        g->next[i][j] = g->next[i][k];  // Go to k first
-                    }
-                }
-            }
-        }
+    // Step 4: Group edges by source endpoint (counting sort)
+    for (int i = 0; i <= g->endpointCount; i++) g->edgeStart[i] = 0;
+    for (int e = 0; e < scratchCount; e++) g->edgeStart[ladderEdgeScratch[e].from + 1]++;
+    for (int i = 0; i < g->endpointCount; i++) g->edgeStart[i + 1] += g->edgeStart[i];
+    for (int i = 0; i < g->endpointCount; i++) ladderEdgeCursor[i] = g->edgeStart[i];
+    for (int e = 0; e < scratchCount; e++) {
+        g->edges[ladderEdgeCursor[ladderEdgeScratch[e].from]++] = ladderEdgeScratch[e];
     }
+    g->edgeCount = scratchCount;
     
     jpsLadderGraphBuilt = true;
-    TraceLog(LOG_INFO, "JPS+ ladder graph: %d endpoints, built in %.2fms", 
-             g->endpointCount, (GetTime() - startTime) * 1000.0);
+    TraceLog(LOG_INFO, "JPS+ ladder graph: %d endpoints, %d edges, built in %.2fms", 
+             g->endpointCount, g->edgeCount, (GetTime() - startTime) * 1000.0);
+}
+
+// Binary heap over ladder endpoints keyed by ladderDist (for per-query Dijkstra)
+static void LadderHeapSwap(int i, int j) {
+    int a = ladderHeap[i];
+    int b = ladderHeap[j];
+    ladderHeap[i] = b;
+    ladderHeap[j] = a;
+    ladderHeapPos[a] = j;
+    ladderHeapPos[b] = i;
+}
+
+static void LadderHeapBubbleUp(int idx) {
+    while (idx > 0) {
+        int parent = (idx - 1) / 2;
+        if (ladderDist[ladderHeap[idx]] >= ladderDist[ladderHeap[parent]]) break;
+        LadderHeapSwap(idx, parent);
+        idx = parent;
+    }
+}
+
+static void LadderHeapPushOrDecrease(int ep) {
+    if (ladderHeapPos[ep] < 0) {
+        ladderHeap[ladderHeapSize] = ep;
+        ladderHeapPos[ep] = ladderHeapSize;
+        ladderHeapSize++;
+    }
+    LadderHeapBubbleUp(ladderHeapPos[ep]);
+}
+
+static int LadderHeapPop(void) {
+    int result = ladderHeap[0];
+    ladderHeapPos[result] = -1;
+    ladderHeapSize--;
+    if (ladderHeapSize > 0) {
+        ladderHeap[0] = ladderHeap[ladderHeapSize];
+        ladderHeapPos[ladderHeap[0]] = 0;
+        int idx = 0;
+        while (1) {
+            int left = 2 * idx + 1;
+            int right = left + 1;
+            int smallest = idx;
+            if (left < ladderHeapSize && ladderDist[ladderHeap[left]] < ladderDist[ladderHeap[smallest]]) smallest = left;
+            if (right < ladderHeapSize && ladderDist[ladderHeap[right]] < ladderDist[ladderHeap[smallest]]) smallest = right;
+            if (smallest == idx) break;
+            LadderHeapSwap(idx, smallest);
+            idx = smallest;
+        }
+    }
+    return result;
+}
+
+// Multi-source Dijkstra over the ladder graph: sources are start-level endpoints
+// seeded with their JPS+ distance from the start, targets are goal-level endpoints
+// with their distance to the goal. Fills ladderPrev (toward the sources) and
+// returns the best total cost, or COST_INF if the levels are not connected.
+static int SearchLadderGraph(const int* srcEP, const int* srcDist, int srcCount,
+                             const int* dstEP, const int* dstDist, int dstCount,
+                             int* outSrcEP, int* outDstEP) {
+    JpsLadderGraph* g = &jpsLadderGraph;
+    for (int i = 0; i < g->endpointCount; i++) {
+        ladderDist[i] = COST_INF;
+        ladderPrev[i] = -1;
+        ladderHeapPos[i] = -1;
+        ladderGoalDist[i] = COST_INF;
+    }
+    ladderHeapSize = 0;
+
+    for (int i = 0; i < dstCount; i++) {
+        if (dstDist[i] < ladderGoalDist[dstEP[i]]) ladderGoalDist[dstEP[i]] = dstDist[i];
+    }
+    for (int i = 0; i < srcCount; i++) {
+        if (srcDist[i] < ladderDist[srcEP[i]]) {
+            ladderDist[srcEP[i]] = srcDist[i];
+            LadderHeapPushOrDecrease(srcEP[i]);
+        }
+    }
+
+    int bestCost = COST_INF;
+    *outSrcEP = -1;
+    *outDstEP = -1;
+    while (ladderHeapSize > 0) {
+        int u = LadderHeapPop();
+        // Remaining nodes can only add cost; goal distances are non-negative
+        if (ladderDist[u] >= bestCost) break;
+
+        if (ladderGoalDist[u] < COST_INF && ladderDist[u] + ladderGoalDist[u] < bestCost) {
+            bestCost = ladderDist[u] + ladderGoalDist[u];
+            *outDstEP = u;
+        }
+
+        for (int e = g->edgeStart[u]; e < g->edgeStart[u + 1]; e++) {
+            int v = g->edges[e].to;
+            int nd = ladderDist[u] + g->edges[e].cost;
+            if (nd < ladderDist[v]) {
+                ladderDist[v] = nd;
+                ladderPrev[v] = u;
+                LadderHeapPushOrDecrease(v);
+            }
+        }
+    }
+
+    if (*outDstEP >= 0) {
+        int src = *outDstEP;
+        while (ladderPrev[src] >= 0) src = ladderPrev[src];
+        *outSrcEP = src;
+    }
+    return bestCost;
 }
 
 // Helper: Trace JPS+ path from goal back to start, filling intermediate cells
@@ -3397,9 +4507,7 @@ static bool TraceJpsPlusPath(int goalX, int goalY, int z, int stopX, int stopY,
 // JPS+ 3D pathfinding using ladder graph for cross-level queries
 // Returns path length, or 0 if no path found
 int FindPath3D_JpsPlus(Point start, Point goal, Point* outPath, int maxLen) {
-    if (!jpsPrecomputed || jpsNeedsRebuild) {
-        PrecomputeJpsPlus();
-    }
+    EnsureJpsPlusCurrent();
     if (!jpsLadderGraphBuilt) {
         BuildJpsLadderGraph();
     }
@@ -3453,23 +4561,10 @@ int FindPath3D_JpsPlus(Point start, Point goal, Point* outPath, int maxLen) {
     }
     
     // Step 3: Find best path through ladder graph
-    int bestCost = COST_INF;
     int bestStartEP = -1;
     int bestGoalEP = -1;
-    
-    for (int i = 0; i < startCount; i++) {
-        for (int j = 0; j < goalCount; j++) {
-            int ladderCost = g->allPairs[startEP[i]][goalEP[j]];
-            if (ladderCost < COST_INF) {
-                int totalCost = startDist[i] + ladderCost + goalDist[j];
-                if (totalCost < bestCost) {
-                    bestCost = totalCost;
-                    bestStartEP = startEP[i];
-                    bestGoalEP = goalEP[j];
-                }
-            }
-        }
-    }
+    SearchLadderGraph(startEP, startDist, startCount, goalEP, goalDist, goalCount,
+                      &bestStartEP, &bestGoalEP);
     
     if (bestStartEP < 0 || bestGoalEP < 0) {
         return 0;  // No path through ladder graph
@@ -3489,15 +4584,15 @@ int FindPath3D_JpsPlus(Point start, Point goal, Point* outPath, int maxLen) {
                      outPath, &len, maxLen);
     
     // Part B: Walk through ladder graph from goalLadder back to startLadder
-    // Use the 'next' matrix to find intermediate ladder endpoints
+    // Follow the Dijkstra predecessors to find intermediate ladder endpoints
     if (len < maxLen) outPath[len++] = (Point){goalLadder->x, goalLadder->y, goal.z};
     
     if (bestStartEP != bestGoalEP) {
-        // Different ladders - traverse through intermediate endpoints using next matrix
+        // Different ladders - traverse through intermediate endpoints via predecessors
         int current = bestGoalEP;
         int visited = 0;
         while (current != bestStartEP && visited < g->endpointCount) {
-            int nextEP = g->next[current][bestStartEP];
+            int nextEP = ladderPrev[current];
             if (nextEP < 0 || nextEP == current) break;
             
             LadderEndpoint* nextEndpoint = &g->endpoints[nextEP];
@@ -3571,8 +4666,10 @@ int FindPath3D_JpsPlus(Point start, Point goal, Point* outPath, int maxLen) {
     return len;
 }
 
+// Seeds both raylib's generator (worldgen) and the simulation streams
 void SeedRandom(unsigned int seed) {
     SetRandomSeed(seed);
+    SeedSimRng(seed);
 }
 
 // Check if a z-level has any ladder connections
@@ -3606,9 +4703,9 @@ Point GetRandomWalkableCell(void) {
     // Check z-level connectivity when vertical connections exist
     bool checkConnectivity = (ladderLinkCount > 0 || rampLinkCount > 0);
     for (int attempts = 0; attempts < 1000; attempts++) {
-        p.x = GetRandomValue(0, gridWidth - 1);
-        p.y = GetRandomValue(0, gridHeight - 1);
-        p.z = GetRandomValue(0, gridDepth - 1);
+        p.x = SimRandRange(RNG_MOVERS, 0, gridWidth - 1);
+        p.y = SimRandRange(RNG_MOVERS, 0, gridHeight - 1);
+        p.z = SimRandRange(RNG_MOVERS, 0, gridDepth - 1);
         // Skip z-levels with no vertical connections (stranded spawns)
         if (checkConnectivity && !ZLevelIsConnected(p.z)) continue;
         // Use IsValidDestination to filter wall-tops and other non-goal cells
@@ -3624,9 +4721,9 @@ Point GetRandomWalkableCellDifferentZ(int excludeZ) {
     // Check z-level connectivity when vertical connections exist
     bool checkConnectivity = (ladderLinkCount > 0 || rampLinkCount > 0);
     for (int attempts = 0; attempts < 1000; attempts++) {
-        p.x = GetRandomValue(0, gridWidth - 1);
-        p.y = GetRandomValue(0, gridHeight - 1);
-        p.z = GetRandomValue(0, gridDepth - 1);
+        p.x = SimRandRange(RNG_MOVERS, 0, gridWidth - 1);
+        p.y = SimRandRange(RNG_MOVERS, 0, gridHeight - 1);
+        p.z = SimRandRange(RNG_MOVERS, 0, gridDepth - 1);
         // Skip z-levels with no vertical connections (stranded spawns)
         if (checkConnectivity && !ZLevelIsConnected(p.z)) continue;
         if (p.z != excludeZ && IsValidDestination(p.z, p.y, p.x)) {
@@ -3643,8 +4740,8 @@ Point GetRandomWalkableCellOnZ(int z) {
     Point p;
     p.z = z;
     for (int attempts = 0; attempts < 1000; attempts++) {
-        p.x = GetRandomValue(0, gridWidth - 1);
-        p.y = GetRandomValue(0, gridHeight - 1);
+        p.x = SimRandRange(RNG_MOVERS, 0, gridWidth - 1);
+        p.y = SimRandRange(RNG_MOVERS, 0, gridHeight - 1);
         if (IsValidDestination(p.z, p.y, p.x)) {
             return p;
         }
@@ -3690,6 +4787,6 @@ Point GetRandomReachableCell(int startX, int startY, int startZ) {
 
     if (found <= 1) return (Point){startX, startY, startZ};
     // Pick random, but not the start cell
-    int pick = GetRandomValue(1, found - 1);
+    int pick = SimRandRange(RNG_MOVERS, 1, found - 1);
     return reachable[pick];
 }
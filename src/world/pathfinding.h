@@ -12,9 +12,7 @@ typedef enum {
 } PathAlgorithm;
 
 #define MAX_ENTRANCE_WIDTH 6
-#define MAX_ENTRANCES (4096*4)
 #define MAX_PATH 65536
-#define MAX_EDGES 65536*4
 #define MAX_EDGES_PER_NODE 64  // Max edges per entrance for adjacency list
 
 typedef struct { int x, y, z; } Point;
@@ -63,10 +61,13 @@ extern RampLink rampLinks[MAX_RAMP_LINKS];
 extern int rampLinkCount;
 
 // External state (defined in pathfinding.c)
-extern Entrance entrances[MAX_ENTRANCES];
+// Entrance and edge storage grows on demand (capacity = allocated slots)
+extern Entrance* entrances;
 extern int entranceCount;
-extern GraphEdge graphEdges[MAX_EDGES];
+extern int entranceCapacity;
+extern GraphEdge* graphEdges;
 extern int graphEdgeCount;
+extern int graphEdgeCapacity;
 extern Point path[MAX_PATH];
 extern int pathLength;
 extern int nodesExplored;
@@ -83,7 +84,7 @@ void UpdatePathStats(void);       // Call every frame
 void ResetPathStats(void);        // Call when switching algorithms
 extern Point startPos;
 extern Point goalPos;
-extern AStarNode nodeData[MAX_GRID_DEPTH][MAX_GRID_HEIGHT][MAX_GRID_WIDTH];
+extern WORLD_LAYER(AStarNode, nodeData);
 extern bool chunkDirty[MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
 
 // Abstract graph node for HPA* search
@@ -93,19 +94,34 @@ typedef struct {
     bool open, closed;
 } AbstractNode;
 
-#define MAX_ABSTRACT_NODES (MAX_ENTRANCES + 2)  // +2 for temp start/goal
-extern AbstractNode abstractNodes[MAX_ABSTRACT_NODES];
-extern int abstractPath[MAX_ENTRANCES + 2];  // path through entrance indices
+extern AbstractNode* abstractNodes;  // entranceCapacity + 2 (temp start/goal)
+extern int* abstractPath;            // path through entrance indices, entranceCapacity + 2
 extern int abstractPathLength;
 
+// Level-2 HPA*: super-chunks of hpaSuperChunkSize x hpaSuperChunkSize chunk
+// columns (all z-levels). Entrances on super-chunk borders and ladder/ramp
+// entrances whose partner lies in another super-chunk become level-2 nodes,
+// joined by the shortest entrance-graph route inside each super-chunk.
+// Queries whose start and goal lie in different super-chunks search this
+// graph and expand each hop back into entrances before cell refinement.
+extern int hpaSuperChunkSize;   // chunks per super-chunk side (< 2 = single level only)
+extern int hpaSuperNodeCount;   // level-2 nodes after the last BuildHpaSuperGraph
+extern int hpaSuperEdgeCount;   // level-2 directed edges after the last BuildHpaSuperGraph
+void BuildHpaSuperGraph(void);  // refresh stale super-chunks now (otherwise done by the next long query)
+
 // Movement direction mode
 extern bool use8Dir;  // false = 4-directional, true = 8-directional
 
 // Functions
 int Heuristic(int x1, int y1, int x2, int y2);
 void MarkChunkDirty(int cellX, int cellY, int cellZ);
+// The two halves of MarkChunkDirty, for CommitCellEdits (cell must be on the grid):
+// per chunk (HPA* flags, lighting, area sums) and per cell (JPS+, flow fields, path index, reach cache)
+void MarkNavChunkDirty(int cellX, int cellY, int cellZ);
+void NoteNavCellEdit(int cellX, int cellY, int cellZ);
 void BuildEntrances(void);
 void BuildGraph(void);
+extern int hpaBuildThreads;  // worker threads for BuildGraph/UpdateDirtyChunks edge costs (0 = one per core)
 void RunAStar(void);
 void RunHPAStar(void);
 int FindPathHPA(Point start, Point goal, Point* outPath, int maxLen);
@@ -118,6 +134,9 @@ int AStarChunkMultiTarget(int sx, int sy, int sz, int* targetX, int* targetY, in
 
 // JPS+ (Jump Point Search with preprocessing)
 void PrecomputeJpsPlus(void);
+int GetJpsPlusJumpDist(int x, int y, int z, int dir);  // refreshes pending edits first
+extern int jpsFullPrecomputeCount;     // full PrecomputeJpsPlus runs
+extern int jpsIncrementalUpdateCount;  // incremental refreshes from queued cell edits
 int JpsPlusChunk(int sx, int sy, int gx, int gy, int minX, int minY, int maxX, int maxY);
 
 // JPS+ 3D with ladder graph
@@ -125,8 +144,9 @@ int JpsPlusChunk(int sx, int sy, int gx, int gy, int minX, int minY, int maxX, i
 // We keep them separate so JPS+ doesn't depend on HPA* initialization.
 // Future refactor: extract shared BuildLadderLinks() function for both systems.
 #define MAX_LADDER_ENDPOINTS (MAX_LADDERS * 2)
-#define MAX_LADDER_EDGES (MAX_LADDER_ENDPOINTS * MAX_LADDER_ENDPOINTS / 4)  // Sparse, not all pairs connected
 #define MAX_ENDPOINTS_PER_LEVEL 128
+// Directed edges: every same-level endpoint pair plus both directions of each climb
+#define MAX_LADDER_EDGES (MAX_GRID_DEPTH * MAX_ENDPOINTS_PER_LEVEL * MAX_ENDPOINTS_PER_LEVEL + MAX_LADDER_ENDPOINTS)
 
 // Ladder endpoint - one per z-level that a ladder touches
 typedef struct {
@@ -147,17 +167,16 @@ typedef struct {
     LadderEndpoint endpoints[MAX_LADDER_ENDPOINTS];
     int endpointCount;
     
+    // Sparse adjacency grouped by source: edges of endpoint i are
+    // edges[edgeStart[i] .. edgeStart[i + 1]). Shortest routes through the
+    // graph are found per query with Dijkstra (no all-pairs table).
     JpsLadderEdge edges[MAX_LADDER_EDGES];
     int edgeCount;
+    int edgeStart[MAX_LADDER_ENDPOINTS + 1];
     
     // For fast lookup: which endpoints are on each z-level?
     int endpointsByLevel[MAX_GRID_DEPTH][MAX_ENDPOINTS_PER_LEVEL];
     int endpointsPerLevelCount[MAX_GRID_DEPTH];
-    
-    // All-pairs shortest paths through ladder graph
-    int allPairs[MAX_LADDER_ENDPOINTS][MAX_LADDER_ENDPOINTS];
-    // Next node in path from i to j (for path reconstruction through intermediate ladders)
-    int next[MAX_LADDER_ENDPOINTS][MAX_LADDER_ENDPOINTS];
 } JpsLadderGraph;
 
 extern JpsLadderGraph jpsLadderGraph;
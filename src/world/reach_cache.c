@@ -0,0 +1,235 @@
+// reach_cache.c - Cached reachability probes keyed by source region
+//
+// Entries live in an open-addressed table; a lookup tries REACH_CACHE_PROBE
+// consecutive slots and a store overwrites the stalest of them. Positive
+// entries are valid while closeEpoch is unchanged, negative ones while
+// openEpoch is unchanged. openEpoch is settled lazily from the queued edits
+// on the next probe, so the check sees the cell after the caller changed it.
+//
+// Source regions are labelled one chunk at a time; the last labelled chunk
+// is kept until the next edit.
+//
+// HPA* and JPS+ search precomputed graphs that only catch up with edits in
+// UpdateDirtyChunks/PrecomputeJpsPlus. A probe that runs between an edit and
+// that rebuild answers from the old graph, under epochs that already count
+// the edit, so its result is returned but not stored.
+
+#include "reach_cache.h"
+#include "grid.h"
+#include "cell_defs.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool useReachCache = true;
+int reachCacheHits = 0;
+int reachCacheMisses = 0;
+
+typedef struct {
+    uint32_t source;    // representative cell of the source region, + 1 (0 = empty slot)
+    uint32_t goal;      // goal cell index
+    uint8_t algo;
+    int length;         // 0 = unreachable
+    unsigned int epoch; // closeEpoch (length > 0) or openEpoch (length == 0) when stored
+    unsigned int age;   // store counter, for eviction
+} ReachEntry;
+
+static ReachEntry reachTable[REACH_CACHE_SIZE];
+static unsigned int closeEpoch = 1;
+static unsigned int openEpoch = 1;
+static unsigned int storeCounter = 0;
+
+static Point pendingOpenChecks[REACH_EDIT_QUEUE_MAX];
+static int pendingOpenCount = 0;
+
+// Region labels for one chunk: representative cell index per local cell
+static uint32_t* chunkLabels = NULL;
+static int* floodStack = NULL;
+static int labelCapacity = 0;
+static int labelledChunk = -1;
+static unsigned int labelledEpoch = 0;
+
+static inline uint32_t CellIndex(int x, int y, int z) {
+    return ((uint32_t)z * (uint32_t)gridHeight + (uint32_t)y) * (uint32_t)gridWidth + (uint32_t)x;
+}
+
+void ClearReachCache(void) {
+    memset(reachTable, 0, sizeof(reachTable));
+    closeEpoch++;
+    openEpoch++;
+    pendingOpenCount = 0;
+    labelledChunk = -1;
+}
+
+void NoteReachCellEdit(int x, int y, int z) {
+    closeEpoch++;
+    if (pendingOpenCount < REACH_EDIT_QUEUE_MAX) {
+        pendingOpenChecks[pendingOpenCount++] = (Point){x, y, z};
+    } else {
+        openEpoch++;  // too many to check: assume something opened
+        pendingOpenCount = 0;
+    }
+}
+
+// A walkable cell can only carry a path if something leads into it: a
+// walkable orthogonal neighbour, a ladder, or a ramp on either side of it.
+// (Diagonal steps need both orthogonals, so they never reach a lone cell.)
+static bool CellJoinsNeighbours(int x, int y, int z) {
+    if (!IsCellWalkableAt(z, y, x)) return false;
+    if (IsLadderCell(grid[z][y][x]) || CellIsDirectionalRamp(grid[z][y][x])) return true;
+    if (z > 0 && IsLadderCell(grid[z - 1][y][x])) return true;
+    static const int dx[4] = {1, -1, 0, 0};
+    static const int dy[4] = {0, 0, 1, -1};
+    for (int d = 0; d < 4; d++) {
+        int nx = x + dx[d], ny = y + dy[d];
+        if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
+        if (IsCellWalkableAt(z, ny, nx)) return true;
+        if (z > 0 && CellIsDirectionalRamp(grid[z - 1][ny][nx])) return true;
+    }
+    return false;
+}
+
+// An edit changes the walkability of the cell and of the one above it
+// (standing on top of solid cells)
+static bool CellCanOpenPaths(int x, int y, int z) {
+    if (CellJoinsNeighbours(x, y, z)) return true;
+    return z + 1 < gridDepth && CellJoinsNeighbours(x, y, z + 1);
+}
+
+static void SettleOpenChecks(void) {
+    for (int i = 0; i < pendingOpenCount; i++) {
+        Point p = pendingOpenChecks[i];
+        if (CellCanOpenPaths(p.x, p.y, p.z)) {
+            openEpoch++;
+            break;
+        }
+    }
+    pendingOpenCount = 0;
+}
+
+static inline bool IsRegionCell(int x, int y, int z) {
+    return IsCellWalkableAt(z, y, x) && !CellIsDirectionalRamp(grid[z][y][x]);
+}
+
+static bool EnsureLabelCapacity(int cells) {
+    if (cells <= labelCapacity) return true;
+    uint32_t* labels = realloc(chunkLabels, (size_t)cells * sizeof(uint32_t));
+    if (!labels) return false;
+    chunkLabels = labels;
+    int* stack = realloc(floodStack, (size_t)cells * sizeof(int));
+    if (!stack) return false;
+    floodStack = stack;
+    labelCapacity = cells;
+    return true;
+}
+
+// Label every 4-connected region of region cells in the chunk with its
+// first cell in scan order
+static void LabelChunk(int cx, int cy, int z) {
+    int x0 = cx * chunkWidth, y0 = cy * chunkHeight;
+    int w = chunkWidth, h = chunkHeight;
+    if (x0 + w > gridWidth) w = gridWidth - x0;
+    if (y0 + h > gridHeight) h = gridHeight - y0;
+
+    for (int i = 0; i < chunkWidth * chunkHeight; i++) chunkLabels[i] = UINT32_MAX;
+    for (int ly = 0; ly < h; ly++) {
+        for (int lx = 0; lx < w; lx++) {
+            int local = ly * chunkWidth + lx;
+            if (chunkLabels[local] != UINT32_MAX) continue;
+            if (!IsRegionCell(x0 + lx, y0 + ly, z)) continue;
+
+            uint32_t rep = CellIndex(x0 + lx, y0 + ly, z);
+            int top = 0;
+            chunkLabels[local] = rep;
+            floodStack[top++] = local;
+            while (top > 0) {
+                int cur = floodStack[--top];
+                int ux = cur % chunkWidth, uy = cur / chunkWidth;
+                static const int dx[4] = {1, -1, 0, 0};
+                static const int dy[4] = {0, 0, 1, -1};
+                for (int d = 0; d < 4; d++) {
+                    int nx = ux + dx[d], ny = uy + dy[d];
+                    if (nx < 0 || nx >= w || ny < 0 || ny >= h) continue;
+                    int n = ny * chunkWidth + nx;
+                    if (chunkLabels[n] != UINT32_MAX) continue;
+                    if (!IsRegionCell(x0 + nx, y0 + ny, z)) continue;
+                    chunkLabels[n] = rep;
+                    floodStack[top++] = n;
+                }
+            }
+        }
+    }
+}
+
+static uint32_t SourceRegion(Point p) {
+    if (!IsRegionCell(p.x, p.y, p.z)) return CellIndex(p.x, p.y, p.z);
+    if (!EnsureLabelCapacity(chunkWidth * chunkHeight)) return CellIndex(p.x, p.y, p.z);
+
+    int cx = p.x / chunkWidth, cy = p.y / chunkHeight;
+    int chunk = (p.z * chunksY + cy) * chunksX + cx;
+    if (chunk != labelledChunk || labelledEpoch != closeEpoch) {
+        LabelChunk(cx, cy, p.z);
+        labelledChunk = chunk;
+        labelledEpoch = closeEpoch;
+    }
+    return chunkLabels[(p.y - cy * chunkHeight) * chunkWidth + (p.x - cx * chunkWidth)];
+}
+
+static inline unsigned int HashKey(uint32_t source, uint32_t goal) {
+    uint32_t h = source * 0x9E3779B1u ^ (goal + 0x7F4A7C15u) * 0x85EBCA77u;
+    h ^= h >> 15;
+    return h & (REACH_CACHE_SIZE - 1);
+}
+
+static inline bool GraphIsStale(PathAlgorithm algo) {
+    if (algo == PATH_ALGO_HPA) return hpaNeedsRebuild;
+    if (algo == PATH_ALGO_JPS_PLUS) return jpsNeedsRebuild;
+    return false;
+}
+
+static inline bool EntryValid(const ReachEntry* e) {
+    return e->epoch == (e->length > 0 ? closeEpoch : openEpoch);
+}
+
+int ProbePathLength(PathAlgorithm algo, Point start, Point goal, Point* scratch, int maxLen) {
+    bool inGrid = start.x >= 0 && start.x < gridWidth && start.y >= 0 && start.y < gridHeight &&
+                  start.z >= 0 && start.z < gridDepth &&
+                  goal.x >= 0 && goal.x < gridWidth && goal.y >= 0 && goal.y < gridHeight &&
+                  goal.z >= 0 && goal.z < gridDepth;
+    if (!useReachCache || !inGrid) return FindPath(algo, start, goal, scratch, maxLen);
+
+    if (pendingOpenCount > 0) SettleOpenChecks();
+    uint32_t source = SourceRegion(start) + 1;
+    uint32_t goalIdx = CellIndex(goal.x, goal.y, goal.z);
+    unsigned int slot = HashKey(source, goalIdx);
+
+    int victim = -1;
+    for (int k = 0; k < REACH_CACHE_PROBE; k++) {
+        int s = (int)((slot + k) & (REACH_CACHE_SIZE - 1));
+        ReachEntry* e = &reachTable[s];
+        if (e->source == source && e->goal == goalIdx && e->algo == (uint8_t)algo) {
+            if (EntryValid(e)) {
+                reachCacheHits++;
+                return e->length;
+            }
+            victim = s;  // same key, stale: overwrite in place
+            break;
+        }
+        if (victim < 0 || e->source == 0 || !EntryValid(e) ||
+            (reachTable[victim].source != 0 && e->age < reachTable[victim].age)) {
+            if (victim < 0 || reachTable[victim].source != 0) victim = s;
+        }
+    }
+
+    reachCacheMisses++;
+    int len = FindPath(algo, start, goal, scratch, maxLen);
+    if (GraphIsStale(algo)) return len;
+    ReachEntry* e = &reachTable[victim];
+    e->source = source;
+    e->goal = goalIdx;
+    e->algo = (uint8_t)algo;
+    e->length = len;
+    e->epoch = len > 0 ? closeEpoch : openEpoch;
+    e->age = ++storeCounter;
+    return len;
+}
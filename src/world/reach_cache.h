@@ -0,0 +1,59 @@
+// reach_cache.h - Cached answers to "can I get from here to that cell?"
+//
+// WorkGivers check every candidate target with a full path search and throw
+// the path away; the mover searches again once the job is assigned. Most of
+// those probes repeat: every idle mover in the same room asks about the same
+// unreachable designation each AssignJobs pass. The cache remembers each
+// probe's result (reachable + path length as a cost estimate) keyed by the
+// source region and the target cell.
+//
+// A source region is a 4-connected set of walkable, non-ramp cells inside
+// one chunk on one z-level. Any two of its cells reach each other with
+// plain orthogonal steps, so they share every reachability answer. Ramp
+// cells (side entry is blocked) and unwalkable cells key on themselves.
+//
+// Invalidation is by cell edits (MarkChunkDirty). Any edit can close a
+// path, so every edit retires the cached "reachable" answers. An edit can
+// only open a path if it leaves the edited cell, or the one above it,
+// walkable and joined to a walkable neighbour, ladder or ramp. Only such
+// edits retire the cached "unreachable" answers, so building a wall (whose
+// top is an isolated walkable cell) does not make every mover re-prove the
+// same targets unreachable.
+//
+// Probes answered while the HPA*/JPS+ graph awaits a rebuild are returned
+// but not stored, so the cache never holds an answer from a stale graph.
+//
+// Scope: the cache only saves the repeated searches. The item and
+// designation unreachable cooldowns stay. They take a failed target out of
+// the candidate scan so the next-best one gets picked; the cache can't do
+// that because it answers per source region, not per target.
+//
+// Usage (drop-in for reachability-only FindPath calls):
+//   int len = ProbePathLength(moverPathAlgorithm, moverCell, target, tempPath, MAX_PATH);
+//   if (len == 0) ...unreachable...        // tempPath contents are not meaningful
+
+#ifndef REACH_CACHE_H
+#define REACH_CACHE_H
+
+#include "pathfinding.h"
+#include <stdbool.h>
+
+#define REACH_CACHE_SIZE 8192      // entries (power of two)
+#define REACH_CACHE_PROBE 4        // slots tried per key before evicting the oldest
+#define REACH_EDIT_QUEUE_MAX 1024  // cell edits held for the lazy "did it open?" check
+
+extern bool useReachCache;
+extern int reachCacheHits;
+extern int reachCacheMisses;
+
+// Path length from start to goal (0 = unreachable). Runs FindPath into
+// scratch on a miss; on a hit scratch is left untouched.
+int ProbePathLength(PathAlgorithm algo, Point start, Point goal, Point* scratch, int maxLen);
+
+// Record a cell edit (called from MarkChunkDirty)
+void NoteReachCellEdit(int x, int y, int z);
+
+// Forget everything (grid re-initialized, graph rebuilt from scratch)
+void ClearReachCache(void);
+
+#endif // REACH_CACHE_H
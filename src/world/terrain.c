@@ -16,9 +16,13 @@
 #include "../simulation/lighting.h"
 #include "../simulation/mood.h"
 #include "../game_state.h"
+#include "worldgen_tiles.h"
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Simple Perlin-like noise
 static int permutation[512];
@@ -1634,6 +1638,147 @@ float OctavePerlin(float x, float y, int octaves, float persistence) {
     return total / maxVal;
 }
 
+#if defined(__SSE2__)
+static inline __m128 FadeLanes4(__m128 t) {
+    __m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))),
+                              _mm_set1_ps(10.0f));
+    return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), inner);
+}
+
+static inline __m128 LerpLanes4(__m128 a, __m128 b, __m128 t) {
+    return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+static inline __m128 SelectLanes4(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Grad() lane-wise: h&2 picks (y, x) over (x, y), h&1 / h&2 negate them
+static inline __m128 GradLanes4(__m128i hash, __m128 x, __m128 y) {
+    __m128i bit1 = _mm_and_si128(hash, _mm_set1_epi32(1));
+    __m128i bit2 = _mm_and_si128(hash, _mm_set1_epi32(2));
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(bit2, _mm_set1_epi32(2)));
+    __m128 u = SelectLanes4(swap, y, x);
+    __m128 v = SelectLanes4(swap, x, y);
+    __m128 signU = _mm_castsi128_ps(_mm_slli_epi32(bit1, 31));
+    __m128 signV = _mm_castsi128_ps(_mm_slli_epi32(bit2, 30));
+    return _mm_add_ps(_mm_xor_ps(u, signU), _mm_xor_ps(v, signV));
+}
+
+// Perlin() for 4 points, same operation order so results are bit-identical
+static __m128 PerlinLanes4(__m128 x, __m128 y) {
+    // floorf via truncation, one lower for negative non-integers
+    __m128i xt = _mm_cvttps_epi32(x);
+    __m128i yt = _mm_cvttps_epi32(y);
+    __m128 xBelow = _mm_cmplt_ps(x, _mm_cvtepi32_ps(xt));
+    __m128 yBelow = _mm_cmplt_ps(y, _mm_cvtepi32_ps(yt));
+    xt = _mm_add_epi32(xt, _mm_castps_si128(xBelow));  // mask is -1 where below
+    yt = _mm_add_epi32(yt, _mm_castps_si128(yBelow));
+    __m128 xf = _mm_sub_ps(x, _mm_cvtepi32_ps(xt));
+    __m128 yf = _mm_sub_ps(y, _mm_cvtepi32_ps(yt));
+
+    int32_t xi[4], yi[4], aa[4], ab[4], ba[4], bb[4];
+    _mm_storeu_si128((__m128i*)xi, _mm_and_si128(xt, _mm_set1_epi32(255)));
+    _mm_storeu_si128((__m128i*)yi, _mm_and_si128(yt, _mm_set1_epi32(255)));
+    for (int l = 0; l < 4; l++) {
+        aa[l] = permutation[permutation[xi[l]] + yi[l]];
+        ab[l] = permutation[permutation[xi[l]] + yi[l] + 1];
+        ba[l] = permutation[permutation[xi[l] + 1] + yi[l]];
+        bb[l] = permutation[permutation[xi[l] + 1] + yi[l] + 1];
+    }
+
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 u = FadeLanes4(xf);
+    __m128 v = FadeLanes4(yf);
+    __m128 xf1 = _mm_sub_ps(xf, one);
+    __m128 yf1 = _mm_sub_ps(yf, one);
+    __m128 x1 = LerpLanes4(GradLanes4(_mm_loadu_si128((const __m128i*)aa), xf, yf),
+                           GradLanes4(_mm_loadu_si128((const __m128i*)ba), xf1, yf), u);
+    __m128 x2 = LerpLanes4(GradLanes4(_mm_loadu_si128((const __m128i*)ab), xf, yf1),
+                           GradLanes4(_mm_loadu_si128((const __m128i*)bb), xf1, yf1), u);
+    return _mm_div_ps(_mm_add_ps(LerpLanes4(x1, x2, v), one), _mm_set1_ps(2.0f));
+}
+#endif
+
+void OctavePerlin8(const float* xs, const float* ys, int octaves, float persistence, float* out) {
+#if defined(__SSE2__)
+    for (int half = 0; half < 8; half += 4) {
+        __m128 x = _mm_loadu_ps(xs + half);
+        __m128 y = _mm_loadu_ps(ys + half);
+        __m128 total = _mm_setzero_ps();
+        float freq = 1, amp = 1, maxVal = 0;
+        for (int i = 0; i < octaves; i++) {
+            __m128 f = _mm_set1_ps(freq);
+            __m128 p = PerlinLanes4(_mm_mul_ps(x, f), _mm_mul_ps(y, f));
+            total = _mm_add_ps(total, _mm_mul_ps(p, _mm_set1_ps(amp)));
+            maxVal += amp;
+            amp *= persistence;
+            freq *= 2;
+        }
+        _mm_storeu_ps(out + half, _mm_div_ps(total, _mm_set1_ps(maxVal)));
+    }
+#else
+    for (int l = 0; l < 8; l++) {
+        out[l] = OctavePerlin(xs[l], ys[l], octaves, persistence);
+    }
+#endif
+}
+
+void OctavePerlinBatch(const float* xs, const float* ys, int count, int octaves, float persistence, float* out) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        OctavePerlin8(xs + i, ys + i, octaves, persistence, out + i);
+    }
+    for (; i < count; i++) {
+        out[i] = OctavePerlin(xs[i], ys[i], octaves, persistence);
+    }
+}
+
+// ============================================================================
+// Hills heightmap tile pass (shared by the Hills generators)
+// Noise height per column, dirt up to it, stone below the soil band
+// ============================================================================
+
+typedef struct {
+    int* heightmap;
+    float scale;
+    int octaves;
+    float persistence;
+    int minHeight, maxHeight;
+    int soilDepth;              // dirt band kept on top of the stone
+    MaterialType stoneMat;
+    uint8_t topVegetation;      // VEG_NONE leaves the top bare
+} HillsHeightPass;
+
+static void HillsHeightTile(int x0, int y0, int x1, int y1, void* ctx) {
+    const HillsHeightPass* p = ctx;
+    // Zeroed so the compiler can see every lane the batch reads is set
+    float xs[WORLDGEN_TILE_SIZE] = {0}, ys[WORLDGEN_TILE_SIZE] = {0}, noise[WORLDGEN_TILE_SIZE];
+    int count = x1 - x0;
+    for (int y = y0; y < y1; y++) {
+        for (int i = 0; i < count; i++) {
+            xs[i] = (x0 + i) * p->scale;
+            ys[i] = y * p->scale;
+        }
+        OctavePerlinBatch(xs, ys, count, p->octaves, p->persistence, noise);
+
+        for (int i = 0; i < count; i++) {
+            int x = x0 + i;
+            int height = p->minHeight + (int)(noise[i] * (p->maxHeight - p->minHeight));
+            if (height < p->minHeight) height = p->minHeight;
+            if (height >= gridDepth) height = gridDepth - 1;
+            p->heightmap[y * gridWidth + x] = height;
+
+            int rockTopZ = (height < p->soilDepth) ? -1 : height - p->soilDepth;  // too shallow for rock
+            for (int z = 0; z <= height; z++) {
+                grid[z][y][x] = CELL_WALL;
+                SetWallMaterial(x, y, z, z <= rockTopZ ? p->stoneMat : MAT_DIRT);
+            }
+            if (p->topVegetation != VEG_NONE) SetVegetation(x, y, height, p->topVegetation);
+        }
+    }
+}
+
 // ============================================================================
 // Hills/Mountains Generator
 // Uses 2D Perlin noise for heightmap, fills with dirt up to that height
@@ -1666,43 +1811,13 @@ void GenerateHills(void) {
     // Store heightmap for ramp placement pass
     int* heightmap = (int*)malloc(gridWidth * gridHeight * sizeof(int));
     
-    // Generate heightmap using 2D Perlin noise
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            // Multi-octave noise for natural terrain
-            float n = OctavePerlin(x * scale, y * scale, octaves, persistence);
-            
-            // Map noise to height (0-1 -> minHeight to maxHeight)
-            int height = minHeight + (int)(n * (maxHeight - minHeight));
-            if (height < minHeight) height = minHeight;
-            if (height >= gridDepth) height = gridDepth - 1;
-            
-            heightmap[y * gridWidth + x] = height;
-            
-            // Fill with dirt from z=0 up to height
-            for (int z = 0; z <= height; z++) {
-                grid[z][y][x] = CELL_WALL;
-                SetWallMaterial(x, y, z, MAT_DIRT);
-            }
-            
-            // Add grass vegetation on top
-            SetVegetation(x, y, height, VEG_GRASS_TALLER);
-        }
-    }
-
-    // Rock layer: keep a soil band on top, rock below
-    const int soilDepth = 4;  // Topsoil + subsoil depth
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            int height = heightmap[y * gridWidth + x];
-            if (height < soilDepth) continue;  // too shallow for rock
-            int rockStartZ = height - soilDepth;
-            for (int z = 0; z <= rockStartZ; z++) {
-                grid[z][y][x] = CELL_WALL;
-                SetWallMaterial(x, y, z, MAT_GRANITE);
-            }
-        }
-    }
+    // Heightmap from 2D Perlin noise: dirt up to the height with grass on top,
+    // rock below a 4-deep soil band (topsoil + subsoil)
+    HillsHeightPass heightPass = {
+        heightmap, scale, octaves, persistence, minHeight, maxHeight,
+        4, MAT_GRANITE, VEG_GRASS_TALLER
+    };
+    RunWorldgenTiles(HillsHeightTile, &heightPass);
     
     // Second pass: Place ramps by carving into hillsides
     // For natural-looking hills, carve the ramp INTO the higher terrain.
@@ -1824,24 +1939,6 @@ void GenerateHillsSoils(void) {
 
     int* heightmap = (int*)malloc(gridWidth * gridHeight * sizeof(int));
 
-    // Generate heightmap and fill with dirt
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            float n = OctavePerlin(x * scale, y * scale, octaves, persistence);
-
-            int height = minHeight + (int)(n * (maxHeight - minHeight));
-            if (height < minHeight) height = minHeight;
-            if (height >= gridDepth) height = gridDepth - 1;
-
-            heightmap[y * gridWidth + x] = height;
-
-            for (int z = 0; z <= height; z++) {
-                grid[z][y][x] = CELL_WALL;
-                SetWallMaterial(x, y, z, MAT_DIRT);
-            }
-        }
-    }
-
     // Soil distribution parameters (tune as needed)
     float clayScale = 0.03f;
     float sandScale = 0.02f;
@@ -1855,18 +1952,12 @@ void GenerateHillsSoils(void) {
     int clayDepth = 2;
     int soilDepth = topsoilDepth + clayDepth;
 
-    // Rock layer: keep a soil band on top, rock below
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            int height = heightmap[y * gridWidth + x];
-            if (height < soilDepth) continue;  // too shallow for rock
-            int rockStartZ = height - soilDepth;
-            for (int z = 0; z <= rockStartZ; z++) {
-                grid[z][y][x] = CELL_WALL;
-                SetWallMaterial(x, y, z, MAT_GRANITE);
-            }
-        }
-    }
+    // Heightmap filled with dirt, rock below the soil band
+    HillsHeightPass heightPass = {
+        heightmap, scale, octaves, persistence, minHeight, maxHeight,
+        soilDepth, MAT_GRANITE, VEG_NONE
+    };
+    RunWorldgenTiles(HillsHeightTile, &heightPass);
 
     // Apply surface soils and subsoil clay blobs
     for (int y = 0; y < gridHeight; y++) {
@@ -2044,6 +2135,177 @@ static MaterialType PickTreeTypeForBiome(const BiomePreset* bp, MaterialType soi
     return MAT_OAK;
 }
 
+// ============================================================================
+// Hills + Soils + Water tile passes
+// ============================================================================
+
+#define HILLS_NEAR_WATER_RADIUS 3
+
+static int HeightmapSlopeAt(const int* heightmap, int x, int y) {
+    int height = heightmap[y * gridWidth + x];
+    int slope = 0;
+    if (x > 0) slope = (abs(height - heightmap[y * gridWidth + (x - 1)]) > slope) ? abs(height - heightmap[y * gridWidth + (x - 1)]) : slope;
+    if (x < gridWidth - 1) slope = (abs(height - heightmap[y * gridWidth + (x + 1)]) > slope) ? abs(height - heightmap[y * gridWidth + (x + 1)]) : slope;
+    if (y > 0) slope = (abs(height - heightmap[(y - 1) * gridWidth + x]) > slope) ? abs(height - heightmap[(y - 1) * gridWidth + x]) : slope;
+    if (y < gridHeight - 1) slope = (abs(height - heightmap[(y + 1) * gridWidth + x]) > slope) ? abs(height - heightmap[(y + 1) * gridWidth + x]) : slope;
+    return slope;
+}
+
+// Near water = any water cell in the (2r+1)^2 box, done as a row pass then a column pass
+typedef struct {
+    const bool* waterMask;
+    bool* rowNear;      // water within r cells along the row
+    bool* nearWater;
+} NearWaterPass;
+
+static void NearWaterRowTile(int x0, int y0, int x1, int y1, void* ctx) {
+    NearWaterPass* p = ctx;
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            bool near = false;
+            for (int nx = x - HILLS_NEAR_WATER_RADIUS; nx <= x + HILLS_NEAR_WATER_RADIUS && !near; nx++) {
+                if (nx >= 0 && nx < gridWidth && p->waterMask[y * gridWidth + nx]) near = true;
+            }
+            p->rowNear[y * gridWidth + x] = near;
+        }
+    }
+}
+
+static void NearWaterColumnTile(int x0, int y0, int x1, int y1, void* ctx) {
+    NearWaterPass* p = ctx;
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            bool near = false;
+            for (int ny = y - HILLS_NEAR_WATER_RADIUS; ny <= y + HILLS_NEAR_WATER_RADIUS && !near; ny++) {
+                if (ny >= 0 && ny < gridHeight && p->rowNear[ny * gridWidth + x]) near = true;
+            }
+            p->nearWater[y * gridWidth + x] = near;
+        }
+    }
+}
+
+// Surface soils, subsoil clay and grass; also fills the tree/bush noise
+// fields the sequential placement passes read later
+typedef struct {
+    const BiomePreset* bp;
+    const int* heightmap;
+    const bool* waterMask;
+    const bool* riverMask;
+    const bool* nearWater;
+    float* treeNoise;
+    float* bushNoise;
+    int minHeight, maxHeight;
+    int topsoilDepth, clayDepth;
+    float clayScale, gravelScale, clayThreshold;
+    float treeScale, bushScale, bushNoiseOffset;
+} HillsSoilPass;
+
+static void HillsSoilTile(int x0, int y0, int x1, int y1, void* ctx) {
+    const HillsSoilPass* p = ctx;
+    const BiomePreset* bp = p->bp;
+    float xs[WORLDGEN_TILE_SIZE] = {0}, ys[WORLDGEN_TILE_SIZE] = {0};
+    float gravelN[WORLDGEN_TILE_SIZE], soilN[WORLDGEN_TILE_SIZE], clayN[WORLDGEN_TILE_SIZE];
+    int count = x1 - x0;
+
+    for (int y = y0; y < y1; y++) {
+        int row = y * gridWidth;
+        for (int i = 0; i < count; i++) { xs[i] = (x0 + i) * p->gravelScale; ys[i] = y * p->gravelScale; }
+        OctavePerlinBatch(xs, ys, count, 3, 0.5f, gravelN);
+        // Per-cell noise as deterministic random for soil selection
+        for (int i = 0; i < count; i++) { xs[i] = (x0 + i) * 0.037f + 50.0f; ys[i] = y * 0.037f + 50.0f; }
+        OctavePerlinBatch(xs, ys, count, 2, 0.5f, soilN);
+        for (int i = 0; i < count; i++) { xs[i] = (x0 + i) * p->clayScale; ys[i] = y * p->clayScale; }
+        OctavePerlinBatch(xs, ys, count, 3, 0.5f, clayN);
+        for (int i = 0; i < count; i++) { xs[i] = (x0 + i) * p->treeScale; ys[i] = y * p->treeScale; }
+        OctavePerlinBatch(xs, ys, count, 3, 0.5f, p->treeNoise + row + x0);
+        for (int i = 0; i < count; i++) {
+            xs[i] = (x0 + i + p->bushNoiseOffset) * p->bushScale;
+            ys[i] = (y + p->bushNoiseOffset) * p->bushScale;
+        }
+        OctavePerlinBatch(xs, ys, count, 2, 0.5f, p->bushNoise + row + x0);
+
+        for (int i = 0; i < count; i++) {
+            int x = x0 + i;
+            int idx = row + x;
+            int height = p->heightmap[idx];
+            int slope = HeightmapSlopeAt(p->heightmap, x, y);
+            bool nearWater = p->nearWater[idx];
+
+            float heightNorm = (p->maxHeight == p->minHeight) ? 0.0f : (float)(height - p->minHeight) / (float)(p->maxHeight - p->minHeight);
+            float wetness = 1.0f - heightNorm;
+            if (nearWater) wetness += hillsWaterWetnessBias;
+            wetness = Clamp01(wetness);
+
+            MaterialType surfaceMat;
+            if (p->waterMask[idx]) {
+                // Riverbeds/lakebeds stay gravel/sand regardless of biome
+                surfaceMat = (p->riverMask[idx] || slope >= 2 || gravelN[i] > 0.55f) ? MAT_GRAVEL : MAT_SAND;
+            } else {
+                surfaceMat = PickSoilForBiome(bp, wetness, slope, nearWater, soilN[i]);
+            }
+
+            grid[height][y][x] = CELL_WALL;
+            SetWallMaterial(x, y, height, surfaceMat);
+            if (surfaceMat == MAT_DIRT && !nearWater) {
+                if (bp->grassDensity >= 1.0f || WorldgenRoll(worldSeed, x, y, WG_SALT_GRASS) < bp->grassDensity) {
+                    SetVegetation(x, y, height, VEG_GRASS_TALLER);
+                }
+            } else if (surfaceMat == MAT_DIRT) {
+                // Check if directly adjacent to water (cardinal neighbors)
+                bool adjacentWater = false;
+                if (x > 0 && p->waterMask[idx - 1]) adjacentWater = true;
+                if (x < gridWidth - 1 && p->waterMask[idx + 1]) adjacentWater = true;
+                if (y > 0 && p->waterMask[idx - gridWidth]) adjacentWater = true;
+                if (y < gridHeight - 1 && p->waterMask[idx + gridWidth]) adjacentWater = true;
+                SetVegetation(x, y, height, adjacentWater ? VEG_REEDS : VEG_GRASS);
+            }
+
+            if (clayN[i] > p->clayThreshold || (nearWater && wetness > 0.6f)) {
+                int bandEnd = height - p->topsoilDepth;
+                if (bandEnd > 0) {
+                    int bandStart = bandEnd - p->clayDepth + 1;
+                    if (bandStart < 0) bandStart = 0;
+                    for (int z = bandStart; z <= bandEnd && z < gridDepth; z++) {
+                        if (GetWallMaterial(x, y, z) == MAT_DIRT) {
+                            SetWallMaterial(x, y, z, MAT_CLAY);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+typedef struct {
+    int* surface;
+} SurfacePass;
+
+static void SurfaceTile(int x0, int y0, int x1, int y1, void* ctx) {
+    SurfacePass* p = ctx;
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            p->surface[y * gridWidth + x] = FindSurfaceZAt(x, y);
+        }
+    }
+}
+
+// Tall grass on every natural dirt cell that hasn't been worn
+static void NaturalGrassTile(int x0, int y0, int x1, int y1, void* ctx) {
+    (void)ctx;
+    for (int z = 0; z < gridDepth; z++) {
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                if (!CellIsSolid(grid[z][y][x])) continue;
+                if (!IsWallNatural(x, y, z)) continue;
+                if (GetWallMaterial(x, y, z) != MAT_DIRT) continue;
+                if (wearGrid[z][y][x] == 0) {
+                    SetVegetation(x, y, z, VEG_GRASS_TALLER);
+                }
+            }
+        }
+    }
+}
+
 // ============================================================================
 // Hills + Soils + Water (Rivers/Lakes) Generator
 // Adds rivers and shallow lakes, and biases clay/peat toward wetter areas
@@ -2112,25 +2374,6 @@ void GenerateHillsSoilsWater(void) {
         return;
     }
 
-    // Generate heightmap and fill with dirt
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            float n = OctavePerlin(x * scale, y * scale, octaves, persistence);
-
-            int height = minHeight + (int)(n * (maxHeight - minHeight));
-            if (height < minHeight) height = minHeight;
-            if (height >= gridDepth) height = gridDepth - 1;
-
-            int idx = y * gridWidth + x;
-            heightmap[idx] = height;
-
-            for (int z = 0; z <= height; z++) {
-                grid[z][y][x] = CELL_WALL;
-                SetWallMaterial(x, y, z, MAT_DIRT);
-            }
-        }
-    }
-
     // Soil distribution parameters
     float clayScale = 0.03f;
     float gravelScale = 0.02f;
@@ -2139,18 +2382,12 @@ void GenerateHillsSoilsWater(void) {
     int clayDepth = 2;
     int soilDepth = topsoilDepth + clayDepth;
 
-    // Rock layer: keep a soil band on top, rock below
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            int height = heightmap[y * gridWidth + x];
-            if (height < soilDepth) continue;
-            int rockStartZ = height - soilDepth;
-            for (int z = 0; z <= rockStartZ; z++) {
-                grid[z][y][x] = CELL_WALL;
-                SetWallMaterial(x, y, z, bp->stoneType);
-            }
-        }
-    }
+    // Heightmap filled with dirt, biome stone below the soil band
+    HillsHeightPass heightPass = {
+        heightmap, scale, octaves, persistence, minHeight, maxHeight,
+        soilDepth, bp->stoneType, VEG_NONE
+    };
+    RunWorldgenTiles(HillsHeightTile, &heightPass);
 
     // --------------------------------------------------------------------
     // Rivers (midpoint displacement + sine meander)
@@ -2469,82 +2706,33 @@ void GenerateHillsSoilsWater(void) {
     }
 
     // --------------------------------------------------------------------
-    // Apply surface soils + subsoil clay
+    // Apply surface soils + subsoil clay (tile passes)
     // --------------------------------------------------------------------
-    int nearWaterRadius = 3;
-    for (int y = 0; y < gridHeight; y++) {
-        for (int x = 0; x < gridWidth; x++) {
-            int idx = y * gridWidth + x;
-            int height = heightmap[idx];
-
-            int slope = 0;
-            if (x > 0) slope = (abs(height - heightmap[y * gridWidth + (x - 1)]) > slope) ? abs(height - heightmap[y * gridWidth + (x - 1)]) : slope;
-            if (x < gridWidth - 1) slope = (abs(height - heightmap[y * gridWidth + (x + 1)]) > slope) ? abs(height - heightmap[y * gridWidth + (x + 1)]) : slope;
-            if (y > 0) slope = (abs(height - heightmap[(y - 1) * gridWidth + x]) > slope) ? abs(height - heightmap[(y - 1) * gridWidth + x]) : slope;
-            if (y < gridHeight - 1) slope = (abs(height - heightmap[(y + 1) * gridWidth + x]) > slope) ? abs(height - heightmap[(y + 1) * gridWidth + x]) : slope;
-
-            bool nearWater = false;
-            for (int dy = -nearWaterRadius; dy <= nearWaterRadius && !nearWater; dy++) {
-                for (int dx = -nearWaterRadius; dx <= nearWaterRadius; dx++) {
-                    int nx = x + dx;
-                    int ny = y + dy;
-                    if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
-                    if (waterMask[ny * gridWidth + nx]) {
-                        nearWater = true;
-                        break;
-                    }
-                }
-            }
-
-            float heightNorm = (maxHeight == minHeight) ? 0.0f : (float)(height - minHeight) / (float)(maxHeight - minHeight);
-            float wetness = 1.0f - heightNorm;
-            if (nearWater) wetness += hillsWaterWetnessBias;
-            wetness = Clamp01(wetness);
-
-            float gravelN = OctavePerlin(x * gravelScale, y * gravelScale, 3, 0.5f);
-
-            // Use per-cell noise as deterministic random for soil selection
-            float soilNoise = OctavePerlin(x * 0.037f + 50.0f, y * 0.037f + 50.0f, 2, 0.5f);
-            MaterialType surfaceMat;
-            if (waterMask[idx]) {
-                // Riverbeds/lakebeds stay gravel/sand regardless of biome
-                surfaceMat = (riverMask[idx] || slope >= 2 || gravelN > 0.55f) ? MAT_GRAVEL : MAT_SAND;
-            } else {
-                surfaceMat = PickSoilForBiome(bp, wetness, slope, nearWater, soilNoise);
-            }
+    bool* nearWaterMask = (bool*)malloc(cellCount * sizeof(bool));
+    bool* rowNearWater = (bool*)malloc(cellCount * sizeof(bool));
+    float* treeNoise = (float*)malloc(cellCount * sizeof(float));
+    float* bushNoise = (float*)malloc(cellCount * sizeof(float));
+    if (!nearWaterMask || !rowNearWater || !treeNoise || !bushNoise) {
+        free(nearWaterMask); free(rowNearWater); free(treeNoise); free(bushNoise);
+        free(heightmap); free(waterMask); free(riverMask); free(lakeMask);
+        return;
+    }
 
-            grid[height][y][x] = CELL_WALL;
-            SetWallMaterial(x, y, height, surfaceMat);
-            if (surfaceMat == MAT_DIRT && !nearWater) {
-                if (bp->grassDensity >= 1.0f || (GetRandomValue(0, 999) / 1000.0f) < bp->grassDensity) {
-                    SetVegetation(x, y, height, VEG_GRASS_TALLER);
-                }
-            } else if (surfaceMat == MAT_DIRT) {
-                // Check if directly adjacent to water (cardinal neighbors)
-                bool adjacentWater = false;
-                int idx2 = y * gridWidth + x;
-                if (x > 0 && waterMask[idx2 - 1]) adjacentWater = true;
-                if (x < gridWidth - 1 && waterMask[idx2 + 1]) adjacentWater = true;
-                if (y > 0 && waterMask[idx2 - gridWidth]) adjacentWater = true;
-                if (y < gridHeight - 1 && waterMask[idx2 + gridWidth]) adjacentWater = true;
-                SetVegetation(x, y, height, adjacentWater ? VEG_REEDS : VEG_GRASS);
-            }
+    NearWaterPass nearPass = { waterMask, rowNearWater, nearWaterMask };
+    RunWorldgenTiles(NearWaterRowTile, &nearPass);
+    RunWorldgenTiles(NearWaterColumnTile, &nearPass);
+    free(rowNearWater);
 
-            float clayN = OctavePerlin(x * clayScale, y * clayScale, 3, 0.5f);
-            if (clayN > clayThreshold || (nearWater && wetness > 0.6f)) {
-                int bandEnd = height - topsoilDepth;
-                if (bandEnd > 0) {
-                    int bandStart = bandEnd - clayDepth + 1;
-                    if (bandStart < 0) bandStart = 0;
-                    for (int z = bandStart; z <= bandEnd && z < gridDepth; z++) {
-                        if (GetWallMaterial(x, y, z) == MAT_DIRT) {
-                            SetWallMaterial(x, y, z, MAT_CLAY);
-                        }
-                    }
-                }
-            }
-        }
-    }
+    float treeScale = 0.028f;
+    float bushScale = 0.045f;        // Different noise scale from trees
+    float bushNoiseOffset = 100.0f;  // Offset so noise differs from tree noise
+    HillsSoilPass soilPass = {
+        bp, heightmap, waterMask, riverMask, nearWaterMask, treeNoise, bushNoise,
+        minHeight, maxHeight, topsoilDepth, clayDepth,
+        clayScale, gravelScale, clayThreshold,
+        treeScale, bushScale, bushNoiseOffset
+    };
+    RunWorldgenTiles(HillsSoilTile, &soilPass);
 
     // --------------------------------------------------------------------
     // Ramp placement pass (same as GenerateHills)
@@ -2622,11 +2810,8 @@ void GenerateHillsSoilsWater(void) {
     // --------------------------------------------------------------------
     int* surface = (int*)malloc(cellCount * sizeof(int));
     if (surface) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                surface[y * gridWidth + x] = FindSurfaceZAt(x, y);
-            }
-        }
+        SurfacePass surfacePass = { surface };
+        RunWorldgenTiles(SurfaceTile, &surfacePass);
 
         int buildingAttempts = hillsSkipBuildings ? 0 : 60;
         int placed = 0;
@@ -2676,12 +2861,11 @@ void GenerateHillsSoilsWater(void) {
 
         // ----------------------------------------------------------------
         // Tree placement (typed, bias by wetness/slope/near-water)
+        // Sequential: a tree blocks its neighbours. Noise and rolls are per cell.
         // ----------------------------------------------------------------
         int treePlaced = 0;
         int treeSkipWater = 0, treeSkipCant = 0, treeSkipDensity = 0;
-        float treeScale = 0.028f;
         float nMin = 999.0f, nMax = -999.0f;
-        int nearWaterRadius = 3;
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
                 int idx = y * gridWidth + x;
@@ -2691,24 +2875,8 @@ void GenerateHillsSoilsWater(void) {
                 if (!CanPlaceWorldGenTreeAt(x, y, baseZ)) { treeSkipCant++; continue; }
 
                 int height = heightmap[idx];
-                int slope = 0;
-                if (x > 0) slope = (abs(height - heightmap[y * gridWidth + (x - 1)]) > slope) ? abs(height - heightmap[y * gridWidth + (x - 1)]) : slope;
-                if (x < gridWidth - 1) slope = (abs(height - heightmap[y * gridWidth + (x + 1)]) > slope) ? abs(height - heightmap[y * gridWidth + (x + 1)]) : slope;
-                if (y > 0) slope = (abs(height - heightmap[(y - 1) * gridWidth + x]) > slope) ? abs(height - heightmap[(y - 1) * gridWidth + x]) : slope;
-                if (y < gridHeight - 1) slope = (abs(height - heightmap[(y + 1) * gridWidth + x]) > slope) ? abs(height - heightmap[(y + 1) * gridWidth + x]) : slope;
-
-                bool nearWater = false;
-                for (int dy = -nearWaterRadius; dy <= nearWaterRadius && !nearWater; dy++) {
-                    for (int dx = -nearWaterRadius; dx <= nearWaterRadius; dx++) {
-                        int nx = x + dx;
-                        int ny = y + dy;
-                        if (nx < 0 || nx >= gridWidth || ny < 0 || ny >= gridHeight) continue;
-                        if (waterMask[ny * gridWidth + nx]) {
-                            nearWater = true;
-                            break;
-                        }
-                    }
-                }
+                int slope = HeightmapSlopeAt(heightmap, x, y);
+                bool nearWater = nearWaterMask[idx];
 
                 float heightNorm = (maxHeight == minHeight) ? 0.0f : (float)(height - minHeight) / (float)(maxHeight - minHeight);
                 float wetness = 1.0f - heightNorm;
@@ -2716,7 +2884,7 @@ void GenerateHillsSoilsWater(void) {
                 wetness = Clamp01(wetness);
 
                 // Noise controls forest clustering: low noise = dense forest, high = sparse
-                float n = OctavePerlin(x * treeScale, y * treeScale, 3, 0.5f);
+                float n = treeNoise[idx];
                 if (n < nMin) nMin = n;
                 if (n > nMax) nMax = n;
 
@@ -2736,7 +2904,7 @@ void GenerateHillsSoilsWater(void) {
                 // Apply biome tree density multiplier
                 chance *= bp->treeDensity;
 
-                if ((GetRandomValue(0, 999) / 1000.0f) > chance) { treeSkipDensity++; continue; }
+                if (WorldgenRoll(worldSeed, x, y, WG_SALT_TREE) > chance) { treeSkipDensity++; continue; }
 
                 MaterialType treeMat = PickTreeTypeForBiome(bp, GetWallMaterial(x, y, baseZ), wetness, slope, nearWater, n);
                 PlaceWorldGenTree(x, y, baseZ, treeMat, true);
@@ -2750,8 +2918,6 @@ void GenerateHillsSoilsWater(void) {
         // Berry bush placement (near forest edges, medium elevation)
         // ----------------------------------------------------------------
         int bushPlaced = 0;
-        float bushScale = 0.045f;  // Different noise scale from trees
-        float bushNoiseOffset = 100.0f;  // Offset so noise differs from tree noise
         for (int y = 0; y < gridHeight; y++) {
             for (int x = 0; x < gridWidth; x++) {
                 int idx = y * gridWidth + x;
@@ -2788,21 +2954,20 @@ void GenerateHillsSoilsWater(void) {
                 bushChance *= bp->bushDensity;
 
                 // Use noise for clustering (only place in low-noise patches)
-                float n = OctavePerlin((x + bushNoiseOffset) * bushScale, (y + bushNoiseOffset) * bushScale, 2, 0.5f);
-                if (n > 0.45f) continue;  // Only place in ~45% of area (clustered)
+                if (bushNoise[idx] > 0.45f) continue;  // Only place in ~45% of area (clustered)
 
-                if ((GetRandomValue(0, 999) / 1000.0f) > bushChance) continue;
+                if (WorldgenRoll(worldSeed, x, y, WG_SALT_BUSH) > bushChance) continue;
 
                 grid[walkZ][y][x] = CELL_BUSH;
                 int plantIdx = SpawnPlant(x, y, walkZ, PLANT_BERRY_BUSH);
                 if (plantIdx >= 0) {
                     // Start some bushes already ripe for early game food
-                    int roll = GetRandomValue(0, 2);
+                    int roll = WorldgenRange(worldSeed, x, y, WG_SALT_BUSH_STAGE, 0, 2);
                     if (roll == 0) {
                         plants[plantIdx].stage = PLANT_STAGE_RIPE;
                     } else if (roll == 1) {
                         plants[plantIdx].stage = PLANT_STAGE_BUDDING;
-                        plants[plantIdx].growthProgress = (float)GetRandomValue(0, 100) / 100.0f;
+                        plants[plantIdx].growthProgress = (float)WorldgenRange(worldSeed, x, y, WG_SALT_BUSH_GROWTH, 0, 100) / 100.0f;
                     }
                 }
                 bushPlaced++;
@@ -2842,17 +3007,7 @@ void GenerateHillsSoilsWater(void) {
                     wildType = PLANT_WILD_LENTILS;
                     chance = 0.01f;
                 } else if ((soilMat == MAT_DIRT || soilMat == MAT_PEAT)) {
-                    // Check near water
-                    bool nearWater = false;
-                    for (int dy2 = -3; dy2 <= 3 && !nearWater; dy2++) {
-                        for (int dx2 = -3; dx2 <= 3 && !nearWater; dx2++) {
-                            int nx2 = x + dx2, ny2 = y + dy2;
-                            if (nx2 >= 0 && nx2 < gridWidth && ny2 >= 0 && ny2 < gridHeight) {
-                                if (waterMask[ny2 * gridWidth + nx2]) nearWater = true;
-                            }
-                        }
-                    }
-                    if (nearWater) {
+                    if (nearWaterMask[idx]) {
                         wildType = PLANT_WILD_FLAX;
                         chance = 0.015f;
                     }
@@ -2860,7 +3015,7 @@ void GenerateHillsSoilsWater(void) {
 
                 if (wildType >= PLANT_TYPE_COUNT) continue;
                 chance *= bp->wildCropDensity;
-                if ((GetRandomValue(0, 999) / 1000.0f) > chance) continue;
+                if (WorldgenRoll(worldSeed, x, y, WG_SALT_WILD_CROP) > chance) continue;
 
                 int plantIdx = SpawnPlant(x, y, walkZ, wildType);
                 if (plantIdx >= 0) {
@@ -2903,7 +3058,7 @@ void GenerateHillsSoilsWater(void) {
                 if (heightmap[idx] > (maxHeight * 2 / 3)) boulderChance = 0.012f;
                 boulderChance *= bp->boulderDensity;
 
-                if ((GetRandomValue(0, 999) / 1000.0f) < boulderChance) {
+                if (WorldgenRoll(worldSeed, x, y, WG_SALT_BOULDER) < boulderChance) {
                     grid[walkZ][y][x] = CELL_WALL;
                     SetWallMaterial(x, y, walkZ, stoneMat);
                     bouldersPlaced++;
@@ -2938,7 +3093,7 @@ void GenerateHillsSoilsWater(void) {
                     }
                     if (stoneMat != MAT_NONE) {
                         float rockChance = 0.15f;
-                        if ((GetRandomValue(0, 999) / 1000.0f) < rockChance) {
+                        if (WorldgenRoll(worldSeed, x, y, WG_SALT_ROCK) < rockChance) {
                             SpawnItemWithMaterial(x * CELL_SIZE + CELL_SIZE / 2.0f,
                                                  y * CELL_SIZE + CELL_SIZE / 2.0f,
                                                  (float)walkZ, ITEM_ROCK, (uint8_t)stoneMat);
@@ -2963,7 +3118,7 @@ void GenerateHillsSoilsWater(void) {
                     }
                 }
                 if (nearTrees > 0) {
-                    float roll = GetRandomValue(0, 999) / 1000.0f;
+                    float roll = WorldgenRoll(worldSeed, x, y, WG_SALT_DEADFALL);
                     if (roll < 0.003f) {
                         // Loose logs: ~0.3% chance (deadfall)
                         SpawnItemWithMaterial(x * CELL_SIZE + CELL_SIZE / 2.0f,
@@ -2981,7 +3136,7 @@ void GenerateHillsSoilsWater(void) {
 
                 // Dried grass: ~0.5% on higher, drier ground (away from water)
                 if (nearTrees == 0 && heightmap[idx] > (maxHeight / 2)) {
-                    if ((GetRandomValue(0, 999) / 1000.0f) < 0.005f) {
+                    if (WorldgenRoll(worldSeed, x, y, WG_SALT_DRIED_GRASS) < 0.005f) {
                         SpawnItem(x * CELL_SIZE + CELL_SIZE / 2.0f,
                                   y * CELL_SIZE + CELL_SIZE / 2.0f,
                                   (float)walkZ, ITEM_DRIED_GRASS);
@@ -3109,18 +3264,7 @@ void GenerateHillsSoilsWater(void) {
     }
 
     // Initialize vegetation on all natural dirt cells (wear=0 → tall grass)
-    for (int z = 0; z < gridDepth; z++) {
-        for (int y = 0; y < gridHeight; y++) {
-            for (int x = 0; x < gridWidth; x++) {
-                if (!CellIsSolid(grid[z][y][x])) continue;
-                if (!IsWallNatural(x, y, z)) continue;
-                if (GetWallMaterial(x, y, z) != MAT_DIRT) continue;
-                if (wearGrid[z][y][x] == 0) {
-                    SetVegetation(x, y, z, VEG_GRASS_TALLER);
-                }
-            }
-        }
-    }
+    RunWorldgenTiles(NaturalGrassTile, NULL);
 
     ReportWalkableComponents("HillsSoilsWater");
 
@@ -3128,6 +3272,9 @@ void GenerateHillsSoilsWater(void) {
     free(waterMask);
     free(riverMask);
     free(lakeMask);
+    free(nearWaterMask);
+    free(treeNoise);
+    free(bushNoise);
 
     needsRebuild = true;
 }
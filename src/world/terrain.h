@@ -33,5 +33,9 @@ void GenerateMoodTest(void);       // Mood system showcase (comfort vs rough cam
 void InitPerlin(int seed);
 float Perlin(float x, float y);
 float OctavePerlin(float x, float y, int octaves, float persistence);
+// 8 OctavePerlin samples per call (SSE2 when available), bit-identical to OctavePerlin
+void OctavePerlin8(const float* xs, const float* ys, int octaves, float persistence, float* out);
+// Any number of samples, 8 at a time
+void OctavePerlinBatch(const float* xs, const float* ys, int count, int octaves, float persistence, float* out);
 
 #endif // TERRAIN_H
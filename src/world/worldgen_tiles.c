@@ -0,0 +1,94 @@
+// worldgen_tiles.c - Tile-parallel world generation helpers
+#include "worldgen_tiles.h"
+#include "grid.h"
+#include "../../shared/profiler.h"
+#include "../core/event_log.h"
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define WORLDGEN_MIN_TILES_PER_THREAD 2  // below this, thread startup costs more than it saves
+
+int worldgenThreads = 0;
+
+typedef struct {
+    WorldgenTileFn fn;
+    void* ctx;
+    int tilesX;
+    int tileCount;
+    atomic_int nextTile;
+} WorldgenTileJob;
+
+static void* WorldgenTileWorker(void* arg) {
+    WorldgenTileJob* job = arg;
+    int t;
+    PROFILE_BEGIN(WorldgenTiles);
+    while ((t = atomic_fetch_add(&job->nextTile, 1)) < job->tileCount) {
+        int x0 = (t % job->tilesX) * WORLDGEN_TILE_SIZE;
+        int y0 = (t / job->tilesX) * WORLDGEN_TILE_SIZE;
+        int x1 = x0 + WORLDGEN_TILE_SIZE < gridWidth ? x0 + WORLDGEN_TILE_SIZE : gridWidth;
+        int y1 = y0 + WORLDGEN_TILE_SIZE < gridHeight ? y0 + WORLDGEN_TILE_SIZE : gridHeight;
+        job->fn(x0, y0, x1, y1, job->ctx);
+    }
+    PROFILE_END(WorldgenTiles);
+    return NULL;
+}
+
+static void* WorldgenTileThread(void* arg) {
+    ProfileThreadName("worldgen");
+    WorldgenTileWorker(arg);
+    ProfileThreadExit();
+    EventLogThreadExit();
+    return NULL;
+}
+
+int GetWorldgenThreadCount(void) {
+    int n = worldgenThreads;
+    if (n <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        n = 4;
+#endif
+    }
+    if (n < 1) n = 1;
+    if (n > WORLDGEN_MAX_THREADS) n = WORLDGEN_MAX_THREADS;
+    return n;
+}
+
+// The calling thread works too
+void RunWorldgenTiles(WorldgenTileFn fn, void* ctx) {
+    WorldgenTileJob job;
+    job.fn = fn;
+    job.ctx = ctx;
+    job.tilesX = (gridWidth + WORLDGEN_TILE_SIZE - 1) / WORLDGEN_TILE_SIZE;
+    job.tileCount = job.tilesX * ((gridHeight + WORLDGEN_TILE_SIZE - 1) / WORLDGEN_TILE_SIZE);
+    atomic_init(&job.nextTile, 0);
+
+    int workers = GetWorldgenThreadCount();
+    int maxUseful = job.tileCount / WORLDGEN_MIN_TILES_PER_THREAD;
+    if (workers > maxUseful) workers = maxUseful;
+    if (workers < 1) workers = 1;
+
+    pthread_t threads[WORLDGEN_MAX_THREADS];
+    int started = 0;
+    for (int i = 1; i < workers; i++) {
+        if (pthread_create(&threads[started], NULL, WorldgenTileThread, &job) != 0) break;
+        started++;
+    }
+    WorldgenTileWorker(&job);
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+// SplitMix64 finalizer over the packed inputs
+uint32_t WorldgenHash(uint64_t seed, int x, int y, uint32_t salt) {
+    uint64_t z = seed ^ ((uint64_t)(uint32_t)x * 0x9E3779B97F4A7C15ULL)
+                      ^ ((uint64_t)(uint32_t)y * 0xC2B2AE3D27D4EB4FULL)
+                      ^ ((uint64_t)salt * 0x165667B19E3779F9ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return (uint32_t)(z >> 32);
+}
@@ -0,0 +1,66 @@
+// worldgen_tiles.h - Tile-parallel world generation helpers
+//
+// Per-cell worldgen passes (heightmap columns, soils, noise fields) are split
+// into square tiles and run on worker threads. A tile pass may read anything
+// that earlier passes finished, but only writes the cells of its own tile, so
+// the world comes out the same for any thread count or scheduling.
+//
+// Random decisions inside a tile pass must not draw from GetRandomValue
+// (one global sequence, consumed in scheduling order). They use counter-based
+// rolls instead: a hash of (worldSeed, x, y, salt), so every cell has its own
+// stream and a roll doesn't depend on which cells were visited before it.
+// Global features (rivers, lakes, buildings, caves) stay sequential on
+// GetRandomValue.
+//
+// Usage:
+//   static void SoilTile(int x0, int y0, int x1, int y1, void* ctx) { ... }
+//   RunWorldgenTiles(SoilTile, &soilCtx);
+//   if (WorldgenRoll(worldSeed, x, y, WG_SALT_GRASS) < density) ...
+
+#ifndef WORLDGEN_TILES_H
+#define WORLDGEN_TILES_H
+
+#include <stdint.h>
+
+#define WORLDGEN_TILE_SIZE 64
+#define WORLDGEN_MAX_THREADS 16
+
+extern int worldgenThreads;  // worker threads for tile passes (0 = one per core)
+
+// Salts: one per kind of per-cell roll
+typedef enum {
+    WG_SALT_GRASS = 1,
+    WG_SALT_TREE,
+    WG_SALT_BUSH,
+    WG_SALT_BUSH_STAGE,
+    WG_SALT_BUSH_GROWTH,
+    WG_SALT_WILD_CROP,
+    WG_SALT_BOULDER,
+    WG_SALT_ROCK,
+    WG_SALT_DEADFALL,
+    WG_SALT_DRIED_GRASS,
+} WorldgenSalt;
+
+// Cells x0 <= x < x1, y0 <= y < y1
+typedef void (*WorldgenTileFn)(int x0, int y0, int x1, int y1, void* ctx);
+
+// Runs fn over every tile of the gridWidth x gridHeight world; returns when all are done
+void RunWorldgenTiles(WorldgenTileFn fn, void* ctx);
+
+// Thread count the next RunWorldgenTiles call will use
+int GetWorldgenThreadCount(void);
+
+// Counter-based hash of (seed, x, y, salt)
+uint32_t WorldgenHash(uint64_t seed, int x, int y, uint32_t salt);
+
+// 0.000 .. 0.999 in steps of 0.001, the same range as GetRandomValue(0, 999) / 1000.0f
+static inline float WorldgenRoll(uint64_t seed, int x, int y, uint32_t salt) {
+    return (float)(WorldgenHash(seed, x, y, salt) % 1000u) / 1000.0f;
+}
+
+// min..max inclusive, like GetRandomValue
+static inline int WorldgenRange(uint64_t seed, int x, int y, uint32_t salt, int min, int max) {
+    return min + (int)(WorldgenHash(seed, x, y, salt) % (uint32_t)(max - min + 1));
+}
+
+#endif // WORLDGEN_TILES_H
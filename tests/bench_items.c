@@ -54,6 +54,8 @@
 #include "../src/entities/jobs.h"
 #include "../src/entities/stockpiles.h"
 #include "../src/entities/containers.h"
+#include "../src/entities/item_renumber.h"
+#include "../src/entities/workshops.h"
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
@@ -135,11 +137,10 @@ static void BenchItemLinearScan(void) {
         double start = GetBenchTime();
         for (int iter = 0; iter < numIterations; iter++) {
             for (int i = 0; i < itemHighWaterMark; i++) {
-                Item* item = &items[i];
-                if (!item->active) continue;
-                if (item->reservedBy != -1) continue;
-                if (item->state != ITEM_ON_GROUND) continue;
-                if (item->type == ITEM_RED) found++;
+                if (!itemActive[i]) continue;
+                if (itemReservedBy[i] != -1) continue;
+                if (itemState[i] != ITEM_ON_GROUND) continue;
+                if (items[i].type == ITEM_RED) found++;
             }
         }
         double elapsed = (GetBenchTime() - start) * 1000.0;
@@ -217,9 +218,9 @@ static void BenchAssignJobsHaul(void) {
                 movers[m].currentJobId = -1;
             }
             for (int i = 0; i < itemHighWaterMark; i++) {
-                if (items[i].active) {
-                    items[i].reservedBy = -1;
-                    items[i].unreachableCooldown = 0.0f;
+                if (itemActive[i]) {
+                    itemReservedBy[i] = -1;
+                    itemUnreachableCooldown[i] = 0.0f;
                 }
             }
             for (int m = 0; m < 10; m++) {
@@ -341,14 +342,13 @@ static void BenchCraftInputSearch(void) {
 
             // Simulate WorkGiver_Craft input search for ITEM_PLANKS
             for (int i = 0; i < itemHighWaterMark; i++) {
-                Item* item = &items[i];
-                if (!item->active) continue;
-                if (item->type != ITEM_PLANKS) continue;
-                if (item->reservedBy != -1) continue;
-                if (item->state != ITEM_ON_GROUND) continue;
-
-                int dx = (int)(item->x / CELL_SIZE) - (int)(wsX);
-                int dy = (int)(item->y / CELL_SIZE) - (int)(wsY);
+                if (!itemActive[i]) continue;
+                if (itemReservedBy[i] != -1) continue;
+                if (itemState[i] != ITEM_ON_GROUND) continue;
+                if (items[i].type != ITEM_PLANKS) continue;
+
+                int dx = (int)(itemPosX[i] / CELL_SIZE) - (int)(wsX);
+                int dy = (int)(itemPosY[i] / CELL_SIZE) - (int)(wsY);
                 int distSq = dx * dx + dy * dy;
                 if (distSq < bestDistSq) {
                     bestDistSq = distSq;
@@ -430,11 +430,11 @@ static void BenchContainerFilterScan(void) {
                 if (!IsSlotContainer(sp, s)) continue;
 
                 int containerIdx = spPtr->slots[s];
-                if (containerIdx < 0 || !items[containerIdx].active) continue;
+                if (containerIdx < 0 || !itemActive[containerIdx]) continue;
 
                 // Scan container contents for items that don't match filter
                 for (int j = 0; j < itemHighWaterMark; j++) {
-                    if (!items[j].active) continue;
+                    if (!itemActive[j]) continue;
                     if (items[j].containedIn != containerIdx) continue;
                     // Simulate filter check: ITEM_ROCK no longer accepted
                     if (items[j].type == ITEM_ROCK) {
@@ -454,6 +454,178 @@ static void BenchContainerFilterScan(void) {
     printf("\n");
 }
 
+// =============================================================================
+// 7. Item locality - radius queries and linear scans before/after renumbering
+//    Items spawned in random order and half deleted, so grid neighbours are
+//    scattered across the pool. RenumberItemsByCell packs them in cell order.
+// =============================================================================
+typedef struct {
+    int count;
+    int stacked;
+} LocalityQueryData;
+
+static void LocalityQueryCallback(int itemIndex, float distSq, void* userData) {
+    (void)distSq;
+    LocalityQueryData* d = (LocalityQueryData*)userData;
+    d->count++;
+    d->stacked += items[itemIndex].stackCount;
+}
+
+static void BenchItemLocality(void) {
+    printf("--- Item locality (spawn order vs RenumberItemsByCell) ---\n");
+
+    SetupBenchGrid();
+    ClearMovers();
+    ClearJobs();
+    ClearStockpiles();
+    ClearItems();
+    InitItemSpatialGrid(100, 100, 4);
+
+    SetRandomSeed(12345);
+    int spawnCount = 24000;
+    for (int i = 0; i < spawnCount; i++) {
+        float x = GetRandomValue(1, 98) * CELL_SIZE + CELL_SIZE * 0.5f;
+        float y = GetRandomValue(1, 98) * CELL_SIZE + CELL_SIZE * 0.5f;
+        SpawnItem(x, y, 0.0f, (ItemType)(i % 3));
+    }
+    for (int i = 0; i < spawnCount; i++) {
+        if (GetRandomValue(0, 1)) DeleteItem(i);
+    }
+    BuildItemSpatialGrid();
+
+    int numQueries = 20000;
+    int queryX[20000], queryY[20000];
+    for (int q = 0; q < numQueries; q++) {
+        queryX[q] = GetRandomValue(0, 99);
+        queryY[q] = GetRandomValue(0, 99);
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        double renumberMs = 0.0;
+        if (pass == 1) {
+            double start = GetBenchTime();
+            if (!RenumberItemsByCell()) printf("  renumber skipped: stale item reference\n");
+            renumberMs = (GetBenchTime() - start) * 1000.0;
+        }
+
+        LocalityQueryData data = {0, 0};
+        double start = GetBenchTime();
+        for (int q = 0; q < numQueries; q++) {
+            QueryItemsInRadius(queryX[q], queryY[q], 0, 6, LocalityQueryCallback, &data);
+        }
+        double queryMs = (GetBenchTime() - start) * 1000.0;
+
+        int numScans = 2000;
+        volatile int found = 0;
+        start = GetBenchTime();
+        for (int iter = 0; iter < numScans; iter++) {
+            for (int i = 0; i < itemHighWaterMark; i++) {
+                if (!itemActive[i] || itemState[i] != ITEM_ON_GROUND) continue;
+                if (items[i].type == ITEM_RED) found++;
+            }
+        }
+        double scanMs = (GetBenchTime() - start) * 1000.0;
+        (void)found;
+
+        printf("  %-10s %5d items (hwm=%5d): radius-6 query %.3fus, linear scan %.3fus",
+               pass ? "renumbered" : "spawned", itemCount, itemHighWaterMark,
+               queryMs * 1000.0 / numQueries, scanMs * 1000.0 / numScans);
+        if (pass) printf(", renumber %.3fms", renumberMs);
+        printf(" (%d hits)\n", data.count);
+    }
+
+    printf("\n");
+}
+
+// =============================================================================
+// 8. Stock count for BILL_DO_UNTIL_X: slot walk vs item ledger
+//    40 full 8x8 stockpiles; one query per "until X" bill evaluation.
+// =============================================================================
+static int CountStockpileSlotsByWalk(ItemType type) {
+    int count = 0;
+    for (int s = 0; s < MAX_STOCKPILES; s++) {
+        Stockpile* sp = &stockpiles[s];
+        if (!sp->active) continue;
+        for (int idx = 0; idx < sp->width * sp->height; idx++) {
+            if (sp->slotTypes[idx] == type) count += sp->slotCounts[idx];
+        }
+    }
+    return count;
+}
+
+static void BenchStockCount(void) {
+    printf("--- Stock count per bill check (40 stockpiles of 8x8) ---\n");
+
+    SetupBenchGrid();
+    ClearItems();
+    ClearStockpiles();
+
+    ItemType stored[] = {ITEM_ROCK, ITEM_LOG, ITEM_PLANKS, ITEM_BLOCKS};
+    for (int p = 0; p < 40; p++) {
+        int sx = (p % 10) * 10, sy = (p / 10) * 10;
+        int sp = CreateStockpile(sx, sy, 0, 8, 8);
+        ItemType type = stored[p % 4];
+        SetStockpileFilter(sp, type, true);
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 8; x++) {
+                int idx = SpawnItem((sx + x) * CELL_SIZE + CELL_SIZE * 0.5f, (sy + y) * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, type);
+                if (idx >= 0) PlaceItemInStockpile(sp, sx + x, sy + y, idx);
+            }
+        }
+    }
+
+    int queries = 20000;
+    volatile int sink = 0;
+    double start = GetBenchTime();
+    for (int q = 0; q < queries; q++) sink += CountStockpileSlotsByWalk(stored[q % 4]);
+    double walkMs = (GetBenchTime() - start) * 1000.0;
+
+    start = GetBenchTime();
+    for (int q = 0; q < queries; q++) sink += CountItemsInStockpiles(stored[q % 4]);
+    double ledgerMs = (GetBenchTime() - start) * 1000.0;
+    (void)sink;
+
+    printf("  Slot walk:  %8.3fms (%d queries, %.3fus each, %d planks stored)\n",
+           walkMs, queries, walkMs * 1000.0 / queries, CountStockpileSlotsByWalk(ITEM_PLANKS));
+    printf("  Ledger:     %8.3fms (%d queries, %.3fus each, %d planks stored)\n",
+           ledgerMs, queries, ledgerMs * 1000.0 / queries, CountItemsInStockpiles(ITEM_PLANKS));
+    printf("\n");
+}
+
+// =============================================================================
+// 9. ItemsTick - per-tick cooldown decay, spoilage and cooling
+//    20000 items, one in ten on an unreachable cooldown, one in eight berries
+//    (spoil). The cooldown check reads only the hot arrays.
+//    Hot/cold split: ~60us per tick before and after (spoilage still reads
+//    every item's cold struct, so the tick is bound by that, not cooldowns).
+// =============================================================================
+static void BenchItemsTick(void) {
+    printf("--- ItemsTick (20000 items) ---\n");
+
+    SetupBenchGrid();
+    ClearItems();
+
+    SetRandomSeed(12345);
+    int spawnCount = 20000;
+    for (int i = 0; i < spawnCount; i++) {
+        float x = GetRandomValue(1, 98) * CELL_SIZE + CELL_SIZE * 0.5f;
+        float y = GetRandomValue(1, 98) * CELL_SIZE + CELL_SIZE * 0.5f;
+        int idx = SpawnItem(x, y, 0.0f, (i % 8 == 0) ? ITEM_BERRIES : (ItemType)(i % 3));
+        if (idx >= 0 && i % 10 == 0) SetItemUnreachableCooldown(idx, 1.0e6f);
+    }
+
+    int numTicks = 2000;
+    double start = GetBenchTime();
+    for (int t = 0; t < numTicks; t++) {
+        ItemsTick(0.001f);
+    }
+    double elapsed = (GetBenchTime() - start) * 1000.0;
+
+    printf("  %5d items (hwm=%5d): %8.3fms (%d ticks, %.3fus each)\n",
+           itemCount, itemHighWaterMark, elapsed, numTicks, (elapsed / numTicks) * 1000.0);
+    printf("\n");
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -471,6 +643,9 @@ int main(int argc, char* argv[]) {
     BenchStockpileCache();
     BenchCraftInputSearch();
     BenchContainerFilterScan();
+    BenchItemLocality();
+    BenchStockCount();
+    BenchItemsTick();
 
     printf("Done.\n");
     return 0;
@@ -20,6 +20,7 @@
 #include "../src/world/cell_defs.h"
 #include <string.h>
 #include "../src/world/pathfinding.h"
+#include "../src/world/reach_cache.h"
 #include "../src/entities/mover.h"
 #include "../src/entities/items.h"
 #include "../src/entities/jobs.h"
@@ -98,13 +99,13 @@ static void BenchFindNearestItem(void) {
             if (naiveResult != spatialResult) {
                 float naiveDist = -1, spatialDist = -1;
                 if (naiveResult >= 0) {
-                    float dx = items[naiveResult].x - testX[t];
-                    float dy = items[naiveResult].y - testY[t];
+                    float dx = itemPosX[naiveResult] - testX[t];
+                    float dy = itemPosY[naiveResult] - testY[t];
                     naiveDist = dx*dx + dy*dy;
                 }
                 if (spatialResult >= 0) {
-                    float dx = items[spatialResult].x - testX[t];
-                    float dy = items[spatialResult].y - testY[t];
+                    float dx = itemPosX[spatialResult] - testX[t];
+                    float dy = itemPosY[spatialResult] - testY[t];
                     spatialDist = dx*dx + dy*dy;
                 }
                 if (naiveDist != spatialDist) {
@@ -143,7 +144,7 @@ static void BenchItemsTick(void) {
             float y = GetRandomValue(0, 99) * CELL_SIZE + CELL_SIZE * 0.5f;
             int idx = SpawnItem(x, y, 0.0f, GetRandomValue(0, 2));
             if (idx >= 0 && (i % 3) == 0) {
-                items[idx].unreachableCooldown = 5.0f;
+                itemUnreachableCooldown[idx] = 5.0f;
             }
         }
         
@@ -155,7 +156,7 @@ static void BenchItemsTick(void) {
         double naiveStart = GetBenchTime();
         for (int iter = 0; iter < numIterations; iter++) {
             ItemsTickNaive(dt);
-            naiveAccum += items[0].unreachableCooldown;
+            naiveAccum += itemUnreachableCooldown[0];
         }
         double naiveTime = (GetBenchTime() - naiveStart) * 1000.0;
         (void)naiveAccum;
@@ -163,7 +164,7 @@ static void BenchItemsTick(void) {
         // Reset cooldowns
         for (int i = 0; i < targetCount; i++) {
             if ((i % 3) == 0) {
-                items[i].unreachableCooldown = 5.0f;
+                itemUnreachableCooldown[i] = 5.0f;
             }
         }
         
@@ -172,7 +173,7 @@ static void BenchItemsTick(void) {
         double optStart = GetBenchTime();
         for (int iter = 0; iter < numIterations; iter++) {
             ItemsTick(dt);
-            optAccum += items[0].unreachableCooldown;
+            optAccum += itemUnreachableCooldown[0];
         }
         double optTime = (GetBenchTime() - optStart) * 1000.0;
         (void)optAccum;
@@ -224,7 +225,7 @@ static void BenchAssignJobsRehaul(void) {
             float x = slotX * CELL_SIZE + CELL_SIZE / 2;
             float y = slotY * CELL_SIZE + CELL_SIZE / 2;
             int idx = SpawnItem(x, y, 0, ITEM_RED);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
             PlaceItemInStockpile(spRed, slotX, slotY, idx);
             itemIdx++;
         }
@@ -237,7 +238,7 @@ static void BenchAssignJobsRehaul(void) {
             float x = slotX * CELL_SIZE + CELL_SIZE / 2;
             float y = slotY * CELL_SIZE + CELL_SIZE / 2;
             int idx = SpawnItem(x, y, 0, ITEM_GREEN);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
             PlaceItemInStockpile(spGreen, slotX, slotY, idx);
             itemIdx++;
         }
@@ -250,7 +251,7 @@ static void BenchAssignJobsRehaul(void) {
             float x = slotX * CELL_SIZE + CELL_SIZE / 2;
             float y = slotY * CELL_SIZE + CELL_SIZE / 2;
             int idx = SpawnItem(x, y, 0, ITEM_BLUE);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
             PlaceItemInStockpile(spBlue, slotX, slotY, idx);
             itemIdx++;
         }
@@ -296,7 +297,7 @@ static void BenchAssignJobsRehaul(void) {
             movers[i].currentJobId = -1;
         }
         for (int i = 0; i < MAX_ITEMS; i++) {
-            if (items[i].active) items[i].reservedBy = -1;
+            if (itemActive[i]) itemReservedBy[i] = -1;
         }
         
         // Simulate filter change
@@ -314,7 +315,7 @@ static void BenchAssignJobsRehaul(void) {
                 movers[m].currentJobId = -1;
             }
             for (int i = 0; i < 256; i++) {
-                if (items[i].active) {
+                if (itemActive[i]) {
                     ReleaseItemReservation(i);
                 }
             }
@@ -350,9 +351,13 @@ static void BenchAssignJobsRehaul(void) {
 static void BenchAssignJobsAlgorithms(void) {
     printf("--- AssignJobs (Cold vs Warm) ---\n");
     printf("  Cold: pathfind every item each iteration (worst case)\n");
+    printf("  Cold+reach cache: same, probes answered from the reach cache\n");
     printf("  Warm: skip items marked unreachable (steady state)\n\n");
     
     SetupBenchGrid();
+    moverPathAlgorithm = PATH_ALGO_HPA;  // game default (the rehaul bench leaves A* set)
+    BuildEntrances();
+    BuildGraph();
     ClearMovers();
     ClearItems();
     ClearStockpiles();
@@ -388,34 +393,40 @@ static void BenchAssignJobsAlgorithms(void) {
         
         int numIterations = 100;
         
-        // Cold: clear cooldowns each iteration (worst case - pathfind everything)
-        volatile int coldSum = 0;
-        for (int i = 0; i < targetMovers; i++) movers[i].currentJobId = -1;
-        for (int i = 0; i < MAX_ITEMS; i++) if (items[i].active) items[i].reservedBy = -1;
-        ClearJobs();
+        // Cold: clear cooldowns each iteration (worst case - pathfind everything),
+        // first with every probe searched, then with probes answered by the reach cache
+        double coldTimes[2];
+        for (int cached = 0; cached < 2; cached++) {
+            useReachCache = (cached == 1);
+            ClearReachCache();
+            volatile int coldSum = 0;
+            for (int i = 0; i < targetMovers; i++) movers[i].currentJobId = -1;
+            for (int i = 0; i < MAX_ITEMS; i++) if (itemActive[i]) itemReservedBy[i] = -1;
+            ClearJobs();
         
-        double coldStart = GetBenchTime();
-        for (int iter = 0; iter < numIterations; iter++) {
-            for (int m = 0; m < targetMovers; m++) {
-                if (movers[m].currentJobId >= 0) ReleaseJob(movers[m].currentJobId);
-                movers[m].currentJobId = -1;
-            }
-            for (int i = 0; i < 500; i++) {
-                if (items[i].active) {
-                    items[i].reservedBy = -1;
-                    items[i].unreachableCooldown = 0.0f;  // Force re-pathfind
+            double coldStart = GetBenchTime();
+            for (int iter = 0; iter < numIterations; iter++) {
+                for (int m = 0; m < targetMovers; m++) {
+                    if (movers[m].currentJobId >= 0) ReleaseJob(movers[m].currentJobId);
+                    movers[m].currentJobId = -1;
                 }
+                for (int i = 0; i < 500; i++) {
+                    if (itemActive[i]) {
+                        itemReservedBy[i] = -1;
+                        itemUnreachableCooldown[i] = 0.0f;  // Force re-pathfind
+                    }
+                }
+                AssignJobs();
+                coldSum += idleMoverCount;
             }
-            AssignJobs();
-            coldSum += idleMoverCount;
+            coldTimes[cached] = (GetBenchTime() - coldStart) * 1000.0;
+            (void)coldSum;
         }
-        double coldTime = (GetBenchTime() - coldStart) * 1000.0;
-        (void)coldSum;
         
         // Warm: keep cooldowns (steady state - skip unreachable items)
         volatile int warmSum = 0;
         for (int i = 0; i < targetMovers; i++) movers[i].currentJobId = -1;
-        for (int i = 0; i < MAX_ITEMS; i++) if (items[i].active) items[i].reservedBy = -1;
+        for (int i = 0; i < MAX_ITEMS; i++) if (itemActive[i]) itemReservedBy[i] = -1;
         ClearJobs();
         
         double warmStart = GetBenchTime();
@@ -424,15 +435,15 @@ static void BenchAssignJobsAlgorithms(void) {
                 if (movers[m].currentJobId >= 0) ReleaseJob(movers[m].currentJobId);
                 movers[m].currentJobId = -1;
             }
-            for (int i = 0; i < 500; i++) if (items[i].active) items[i].reservedBy = -1;
+            for (int i = 0; i < 500; i++) if (itemActive[i]) itemReservedBy[i] = -1;
             AssignJobs();
             warmSum += idleMoverCount;
         }
         double warmTime = (GetBenchTime() - warmStart) * 1000.0;
         (void)warmSum;
         
-        printf("  %3d movers: Cold=%.1fms  Warm=%.1fms\n",
-               targetMovers, coldTime, warmTime);
+        printf("  %3d movers: Cold=%.1fms  Cold+reach cache=%.1fms  Warm=%.1fms\n",
+               targetMovers, coldTimes[0], coldTimes[1], warmTime);
     }
     
     FreeItemSpatialGrid();
@@ -7,15 +7,29 @@
 #include "../src/world/grid.h"
 #include "../src/world/cell_defs.h"
 #include "../src/world/pathfinding.h"
+#include "../src/world/terrain.h"
+#include "../src/world/cell_edits.h"
+#include "../src/entities/items.h"
+#include "../src/entities/mover.h"
+#include "../src/simulation/rooms.h"
 #include "../src/simulation/water.h"
 #include "../src/simulation/weather.h"
+#include "../src/game_state.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
 
 static double GetBenchTime(void) {
     return (double)clock() / CLOCKS_PER_SEC;
 }
 
+// Wall-clock time (clock() sums CPU time over all threads)
+static double GetBenchWallTime(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
 // =============================================================================
 // A* variable cost vs uniform cost overhead
 // =============================================================================
@@ -195,6 +209,182 @@ static void BenchHPAStarVariableCost(void) {
            ((elapsed - elapsedUniform) / elapsedUniform) * 100.0);
 }
 
+// =============================================================================
+// HPA* graph build: single thread vs parallel chunk jobs
+// =============================================================================
+static void BenchHpaGraphBuild(void) {
+    printf("--- HPA* Graph Build (512x512x16 hills) ---\n");
+
+    InitGridWithSizeAndChunkSize(512, 512, 16, 16);
+    gridDepth = 16;
+    worldSeed = 12345;
+    SetRandomSeed(12345);
+    GenerateHills();
+    BuildEntrances();
+
+    int threadCounts[] = {1, 0};
+    for (int i = 0; i < 2; i++) {
+        hpaBuildThreads = threadCounts[i];
+        double start = GetBenchWallTime();
+        BuildGraph();
+        double fullMs = (GetBenchWallTime() - start) * 1000.0;
+
+        // Large edit: carve a 96x96 pit through the surface levels
+        for (int z = 1; z < gridDepth; z++)
+            for (int y = 200; y < 296; y++)
+                for (int x = 200; x < 296; x++)
+                    if (grid[z][y][x] != CELL_AIR) { grid[z][y][x] = CELL_AIR; MarkChunkDirty(x, y, z); }
+        start = GetBenchWallTime();
+        UpdateDirtyChunks();
+        double editMs = (GetBenchWallTime() - start) * 1000.0;
+
+        printf("  %-8s full build %.1f ms (%d edges), 96x96 pit update %.1f ms\n",
+               threadCounts[i] == 1 ? "1 thread" : "parallel", fullMs, graphEdgeCount, editMs);
+
+        // Restore terrain for the next run
+        SetRandomSeed(12345);
+        GenerateHills();
+        BuildEntrances();
+    }
+    hpaBuildThreads = 0;
+}
+
+// =============================================================================
+// HPA* single level vs level-2 super-chunks on long cross-map queries
+// =============================================================================
+static void BenchHpaMultiLevel(void) {
+    printf("--- HPA* Single vs Multi-Level Queries (512x512x16 hills) ---\n");
+
+    InitGridWithSizeAndChunkSize(512, 512, 16, 16);
+    gridDepth = 16;
+    worldSeed = 12345;
+    SetRandomSeed(12345);
+    GenerateHills();
+    BuildEntrances();
+    BuildGraph();
+
+    hpaSuperChunkSize = 4;
+    double start = GetBenchWallTime();
+    BuildHpaSuperGraph();
+    double superMs = (GetBenchWallTime() - start) * 1000.0;
+    printf("  entrance graph: %d nodes, %d edges\n", entranceCount, graphEdgeCount);
+    printf("  level-2 graph:  %d nodes, %d edges (built in %.1f ms)\n",
+           hpaSuperNodeCount, hpaSuperEdgeCount, superMs);
+
+    // Long queries only: endpoints at least 256 cells apart
+    enum { QUERIES = 100 };
+    Point starts[QUERIES], goals[QUERIES];
+    SeedRandom(4242);
+    int count = 0;
+    while (count < QUERIES) {
+        Point s = GetRandomWalkableCell();
+        Point g = GetRandomWalkableCell();
+        if (s.x < 0 || g.x < 0) continue;
+        if (abs(s.x - g.x) + abs(s.y - g.y) < 256) continue;
+        starts[count] = s;
+        goals[count] = g;
+        count++;
+    }
+
+    static Point tempPath[MAX_PATH];
+    int sizes[] = {0, 4};
+    for (int m = 0; m < 2; m++) {
+        hpaSuperChunkSize = sizes[m];
+        long explored = 0;
+        int found = 0;
+        start = GetBenchWallTime();
+        for (int i = 0; i < QUERIES; i++) {
+            if (FindPathHPA(starts[i], goals[i], tempPath, MAX_PATH) > 0) found++;
+            explored += nodesExplored;
+        }
+        double totalMs = (GetBenchWallTime() - start) * 1000.0;
+        printf("  %-12s %.3f ms/query (%ld abstract nodes explored), %d/%d found\n",
+               m == 0 ? "single-level" : "multi-level", totalMs / QUERIES, explored / QUERIES, found, QUERIES);
+    }
+    hpaSuperChunkSize = 4;
+}
+
+// =============================================================================
+// JPS+ incremental edit cost vs full precompute
+// =============================================================================
+static void BenchJpsPlusIncremental(void) {
+    printf("--- JPS+ Per-Edit Update vs Full Precompute ---\n");
+
+    int sizes[] = {128, 256, 512};
+    for (int s = 0; s < 3; s++) {
+        int size = sizes[s];
+        InitGridWithSizeAndChunkSize(size, size, 16, 16);
+        GenerateLabyrinth3D();
+
+        int fullIters = 3;
+        double start = GetBenchTime();
+        for (int i = 0; i < fullIters; i++) PrecomputeJpsPlus();
+        double fullMs = (GetBenchTime() - start) * 1000.0 / fullIters;
+
+        // Toggle one wall at a time and refresh before the next edit (worst case: no batching)
+        SeedRandom(99);
+        int edits = 500;
+        start = GetBenchTime();
+        for (int i = 0; i < edits; i++) {
+            int x = GetRandomValue(0, size - 1);
+            int y = GetRandomValue(0, size - 1);
+            int z = GetRandomValue(1, gridDepth - 1);
+            grid[z][y][x] = (grid[z][y][x] == CELL_WALL) ? CELL_AIR : CELL_WALL;
+            MarkChunkDirty(x, y, z);
+            (void)GetJpsPlusJumpDist(x, y, z, 0);
+        }
+        double editMs = (GetBenchTime() - start) * 1000.0 / edits;
+
+        printf("  %3dx%-3d x%d: full %.2f ms, per edit %.4f ms (%.0fx)\n",
+               size, size, gridDepth, fullMs, editMs, editMs > 0.0 ? fullMs / editMs : 0.0);
+    }
+}
+
+// =============================================================================
+// Mass cell edit: per-cell fan-out vs one transaction
+// =============================================================================
+static void FillFloorRect(int size, int z) {
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            grid[z][y][x] = CELL_WALL;
+            MarkChunkDirty(x, y, z);
+            InvalidateRoomsAt(x, y, z);
+            DestabilizeWater(x, y, z);
+            InvalidatePathsThroughCell(x, y, z);
+            ClearUnreachableCooldownsNearCell(x, y, z, 5);
+        }
+    }
+}
+
+static void BenchBulkCellEdits(void) {
+    printf("--- Mass Cell Edit: Per-Cell Fan-Out vs Transaction ---\n");
+
+    int sizes[] = {64, 128, 200};
+    for (int s = 0; s < 3; s++) {
+        int size = sizes[s];
+        double ms[2];
+        for (int batched = 0; batched < 2; batched++) {
+            InitGridWithSizeAndChunkSize(256, 256, 16, 16);
+            InitWater();
+            ClearItems();
+            SeedRandom(7);
+            for (int i = 0; i < 2000; i++) {
+                int idx = SpawnItem(GetRandomValue(0, 255) * CELL_SIZE, GetRandomValue(0, 255) * CELL_SIZE, 1, ITEM_ROCK);
+                if (idx >= 0) SetItemUnreachableCooldown(idx, 5.0f);
+            }
+
+            double start = GetBenchWallTime();
+            if (batched) BeginCellEdits();
+            FillFloorRect(size, 1);
+            if (batched) CommitCellEdits();
+            ms[batched] = (GetBenchWallTime() - start) * 1000.0;
+        }
+        printf("  %3dx%-3d (%5d cells, 2000 items): per cell %.2f ms, transaction %.2f ms (%.0fx)\n",
+               size, size, size * size, ms[0], ms[1], ms[1] > 0.0 ? ms[0] / ms[1] : 0.0);
+    }
+    ClearItems();
+}
+
 int main(void) {
     SetTraceLogLevel(LOG_NONE);
     printf("=== Pathfinding Benchmarks ===\n\n");
@@ -202,5 +392,13 @@ int main(void) {
     printf("\n");
     BenchHPAStarVariableCost();
     printf("\n");
+    BenchJpsPlusIncremental();
+    printf("\n");
+    BenchBulkCellEdits();
+    printf("\n");
+    BenchHpaGraphBuild();
+    printf("\n");
+    BenchHpaMultiLevel();
+    printf("\n");
     return 0;
 }
@@ -65,7 +65,7 @@ int main(void) {
             float x = slotX * CELL_SIZE + CELL_SIZE / 2;
             float y = slotY * CELL_SIZE + CELL_SIZE / 2;
             int idx = SpawnItem(x, y, 0, ITEM_RED);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
             PlaceItemInStockpile(spRed, slotX, slotY, idx);
             itemIdx++;
         }
@@ -77,7 +77,7 @@ int main(void) {
             float x = slotX * CELL_SIZE + CELL_SIZE / 2;
             float y = slotY * CELL_SIZE + CELL_SIZE / 2;
             int idx = SpawnItem(x, y, 0, ITEM_GREEN);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
             PlaceItemInStockpile(spGreen, slotX, slotY, idx);
             itemIdx++;
         }
@@ -89,7 +89,7 @@ int main(void) {
             float x = slotX * CELL_SIZE + CELL_SIZE / 2;
             float y = slotY * CELL_SIZE + CELL_SIZE / 2;
             int idx = SpawnItem(x, y, 0, ITEM_BLUE);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
             PlaceItemInStockpile(spBlue, slotX, slotY, idx);
             itemIdx++;
         }
@@ -117,7 +117,7 @@ int main(void) {
             movers[m].currentJobId = -1;
         }
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active) items[i].reservedBy = -1;
+            if (itemActive[i]) itemReservedBy[i] = -1;
         }
         for (int m = 0; m < 10; m++) ReleaseAllSlotsForMover(m);
         AssignJobs();
@@ -130,7 +130,7 @@ int main(void) {
         movers[m].currentJobId = -1;
     }
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (items[i].active) items[i].reservedBy = -1;
+        if (itemActive[i]) itemReservedBy[i] = -1;
     }
 
     // Simulate filter change
@@ -146,7 +146,7 @@ int main(void) {
             movers[m].currentJobId = -1;
         }
         for (int i = 0; i < 256; i++) {
-            if (items[i].active) ReleaseItemReservation(i);
+            if (itemActive[i]) ReleaseItemReservation(i);
         }
         for (int m = 0; m < 10; m++) ReleaseAllSlotsForMover(m);
         AssignJobs();
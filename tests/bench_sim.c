@@ -0,0 +1,532 @@
+// bench_sim.c - Whole-simulation tick benchmarks over a fixed scenario catalog
+//
+// Run with: make bench_sim
+// Or: ./bin/bench_sim [options]
+//
+// Each scenario builds its world from a seed (same seed, same world, same
+// movers), then runs the headless tick loop and times every tick on the
+// profiler's monotonic clock. Reports p50/p95/p99/max tick time plus the mean
+// per-tick cost of every profiler section (Tick/Water, JobsTick, ...).
+//
+//   hills_movers   256x256x16 hills, 2000 movers walking between random cells
+//   flood          hills with water sources spilling down from the high ground
+//   forest_fire    128x128 grassland, ~30% oak forest, lit at four points
+//   construction   600 dry stone wall blueprints, loose rocks, 150 builders
+//   farm_colony    40x40 farm designation, seeds, stockpile, 100 farmers
+//
+// Options:
+//   --scenario <name>     run one scenario (repeatable, default all)
+//   --ticks <n>           ticks per scenario (default per scenario)
+//   --seed <n>            override every scenario's seed
+//   --json <file>         write results as JSON (one scenario per line)
+//   --baseline <file>     compare p95 against a JSON file written by --json;
+//                         exits 1 if any scenario is slower than the tolerance
+//   --tolerance <pct>     allowed p95 slowdown for --baseline (default 15)
+//
+// Typical use:
+//   ./bin/bench_sim --json bench_base.json        # on the old commit
+//   ./bin/bench_sim --baseline bench_base.json    # on the new one
+
+// test_unity.o only has weak profiler stubs; this binary brings the real one
+#define PROFILER_IMPLEMENTATION
+#include "../shared/profiler.h"
+#include "../vendor/raylib.h"
+#include "../src/world/grid.h"
+#include "../src/world/cell_defs.h"
+#include "../src/world/material.h"
+#include "../src/world/terrain.h"
+#include "../src/world/pathfinding.h"
+#include "../src/world/designations.h"
+#include "../src/world/construction.h"
+#include "../src/entities/mover.h"
+#include "../src/entities/items.h"
+#include "../src/entities/jobs.h"
+#include "../src/entities/stockpiles.h"
+#include "../src/entities/workshops.h"
+#include "../src/entities/animals.h"
+#include "../src/entities/furniture.h"
+#include "../src/entities/trains.h"
+#include "../src/simulation/water.h"
+#include "../src/simulation/fire.h"
+#include "../src/simulation/smoke.h"
+#include "../src/simulation/steam.h"
+#include "../src/simulation/temperature.h"
+#include "../src/simulation/groundwear.h"
+#include "../src/simulation/floordirt.h"
+#include "../src/simulation/lighting.h"
+#include "../src/simulation/weather.h"
+#include "../src/simulation/trees.h"
+#include "../src/simulation/plants.h"
+#include "../src/simulation/farming.h"
+#include "../src/simulation/balance.h"
+#include "../src/simulation/needs.h"
+#include "../src/simulation/mood.h"
+#include "../src/core/sim_manager.h"
+#include "../src/core/time.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern uint64_t worldSeed;
+
+#define SIM_MAX_TICKS 100000
+#define SIM_MAX_RESULTS 16
+
+typedef struct {
+    const char* name;
+    uint64_t seed;
+    int ticks;
+    void (*setup)(void);
+    void (*beforeTick)(void);   // untimed per-tick driver (e.g. new goals), may be NULL
+} SimScenario;
+
+typedef struct {
+    const char* name;
+    uint64_t seed;
+    int ticks;
+    double p50, p95, p99, max, mean;
+    int sectionCount;
+    char sectionNames[PROFILER_MAX_SECTIONS][64];
+    double sectionMean[PROFILER_MAX_SECTIONS];
+    double sectionMax[PROFILER_MAX_SECTIONS];
+} SimResult;
+
+static double tickMs[SIM_MAX_TICKS];
+static SimResult results[SIM_MAX_RESULTS];
+static int resultCount = 0;
+
+// =============================================================================
+// World setup helpers
+// =============================================================================
+
+// Fresh world of the given size: every grid, entity pool and simulation layer
+// cleared, RNG seeded. Terrain is filled in by the scenario afterwards.
+static void ResetSimWorld(int width, int height, int depth, uint64_t seed) {
+    worldSeed = seed;
+    SeedRandom((unsigned int)seed);
+    InitGridWithSizeAndChunkSize(width, height, 16, 16);
+    gridDepth = depth;
+    ClearMovers();
+    ClearItems();
+    ClearJobs();
+    ClearStockpiles();
+    ClearWorkshops();
+    ClearAnimals();
+    ClearFurniture();
+    ClearTrains();
+    InitPlants();
+    ClearFarming();
+    InitWater();
+    InitDesignations();
+    InitJobSystem(MAX_MOVERS);
+    InitBalance();
+    InitTime();
+    repathBudgetMs = 0.0f;  // fixed repath count, as replays use
+}
+
+// Systems that size themselves to the terrain; call once the cells are final
+static void FinishSimWorld(void) {
+    InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+    InitItemSpatialGrid(gridWidth, gridHeight, gridDepth);
+    InitFire();
+    InitSmoke();
+    InitSteam();
+    InitTemperature();
+    InitGroundWear();
+    InitFloorDirt();
+    InitSnow();
+    InitLighting();
+    RebuildSimActivityCounts();
+    BuildEntrances();
+    BuildGraph();
+}
+
+// Solid natural dirt at z=0 with grass, air above
+static void FillFlatGround(void) {
+    for (int y = 0; y < gridHeight; y++) {
+        for (int x = 0; x < gridWidth; x++) {
+            grid[0][y][x] = CELL_WALL;
+            SetWallMaterial(x, y, 0, MAT_DIRT);
+            SetWallNatural(x, y, 0);
+            SetVegetation(x, y, 0, VEG_GRASS_TALLER);
+        }
+    }
+}
+
+static void SpawnSimMovers(int count) {
+    for (int i = 0; i < count && moverCount < MAX_MOVERS; i++) {
+        Point p = GetRandomWalkableCell();
+        if (p.x < 0) break;
+        Mover* m = &movers[moverCount];
+        InitMover(m, p.x * CELL_SIZE + CELL_SIZE * 0.5f, p.y * CELL_SIZE + CELL_SIZE * 0.5f,
+                  (float)p.z, p, balance.baseMoverSpeed);
+        moverCount++;
+    }
+    RebuildIdleMoverList();
+}
+
+static int SurfaceZ(int x, int y) {
+    for (int z = gridDepth - 2; z >= 0; z--) {
+        if (CellIsSolid(grid[z][y][x])) return z + 1;
+    }
+    return -1;
+}
+
+// =============================================================================
+// Scenarios
+// =============================================================================
+
+static void SetupHillsMovers(void) {
+    ResetSimWorld(256, 256, 16, worldSeed);
+    GenerateHills();
+    FinishSimWorld();
+    SpawnSimMovers(2000);
+    for (int i = 0; i < moverCount; i++) {
+        movers[i].goal = GetRandomWalkableCell();
+        moverNeedsRepath[i] = true;
+    }
+}
+
+// Movers that arrived (or gave up) get a new random goal between ticks
+static void RetargetIdleMovers(void) {
+    for (int i = 0; i < moverCount; i++) {
+        Mover* m = &movers[i];
+        if (!moverActive[i] || moverNeedsRepath[i] || moverPathLength[i] > 0 || m->currentJobId >= 0) continue;
+        Point goal = GetRandomWalkableCell();
+        if (goal.x < 0) continue;
+        m->goal = goal;
+        moverNeedsRepath[i] = true;
+    }
+}
+
+static void SetupFlood(void) {
+    ResetSimWorld(128, 128, 16, worldSeed);
+    GenerateHills();
+
+    // Sources on the highest ground found in a coarse scan
+    int placed = 0;
+    for (int topZ = gridDepth - 1; topZ > 1 && placed < 12; topZ--) {
+        for (int y = 4; y < gridHeight && placed < 12; y += 16) {
+            for (int x = 4; x < gridWidth && placed < 12; x += 16) {
+                if (SurfaceZ(x, y) != topZ) continue;
+                SetWaterSource(x, y, topZ, true);
+                SetWaterLevel(x, y, topZ, WATER_MAX_LEVEL);
+                placed++;
+            }
+        }
+    }
+    FinishSimWorld();
+    SpawnSimMovers(200);
+}
+
+static void SetupForestFire(void) {
+    ResetSimWorld(128, 128, 16, worldSeed);
+    FillFlatGround();
+    for (int y = 0; y < gridHeight; y++) {
+        for (int x = 0; x < gridWidth; x++) {
+            if (GetRandomValue(0, 99) < 30) TreeGrowFull(x, y, 1, MAT_OAK);
+        }
+    }
+    FinishSimWorld();
+    SpawnSimMovers(100);
+    int quarter = gridWidth / 4;
+    IgniteCell(quarter, quarter, 1);
+    IgniteCell(gridWidth - quarter, quarter, 1);
+    IgniteCell(quarter, gridHeight - quarter, 1);
+    IgniteCell(gridWidth - quarter, gridHeight - quarter, 1);
+}
+
+static void SetupConstruction(void) {
+    ResetSimWorld(128, 128, 8, worldSeed);
+    FillFlatGround();
+    FinishSimWorld();
+
+    // Rows of wall segments in the middle, rocks scattered around the edges
+    int blueprintsPlaced = 0;
+    for (int y = 32; y < 96 && blueprintsPlaced < 600; y += 3) {
+        for (int x = 24; x < 104 && blueprintsPlaced < 600; x++) {
+            if (CreateRecipeBlueprint(x, y, 1, CONSTRUCTION_DRY_STONE_WALL) >= 0) blueprintsPlaced++;
+        }
+    }
+    for (int i = 0; i < blueprintsPlaced * 3; i++) {
+        int x = GetRandomValue(0, gridWidth - 1);
+        int y = GetRandomValue(0, 1) ? GetRandomValue(0, 24) : GetRandomValue(100, gridHeight - 1);
+        int idx = SpawnItem(x * CELL_SIZE + CELL_SIZE * 0.5f, y * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_ROCK);
+        if (idx >= 0) items[idx].material = MAT_GRANITE;
+    }
+    SpawnSimMovers(150);
+}
+
+static void SetupFarmColony(void) {
+    ResetSimWorld(96, 96, 8, worldSeed);
+    FillFlatGround();
+    FinishSimWorld();
+
+    for (int y = 28; y < 68; y++) {
+        for (int x = 28; x < 68; x++) {
+            DesignateFarm(x, y, 1);
+        }
+    }
+    for (int i = 0; i < 400; i++) {
+        int x = GetRandomValue(10, 20);
+        int y = GetRandomValue(10, 20);
+        SpawnItem(x * CELL_SIZE + CELL_SIZE * 0.5f, y * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_WHEAT_SEEDS);
+    }
+    CreateStockpile(72, 28, 1, 16, 16);
+    SpawnSimMovers(100);
+}
+
+static const SimScenario scenarios[] = {
+    {"hills_movers", 1001, 600, SetupHillsMovers, RetargetIdleMovers},
+    {"flood", 2002, 600, SetupFlood, NULL},
+    {"forest_fire", 3003, 600, SetupForestFire, NULL},
+    {"construction", 4004, 600, SetupConstruction, NULL},
+    {"farm_colony", 5005, 600, SetupFarmColony, NULL},
+};
+static const int scenarioCount = sizeof(scenarios) / sizeof(scenarios[0]);
+
+// =============================================================================
+// Tick loop and statistics
+// =============================================================================
+
+static int CompareDouble(const void* a, const void* b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+// Nearest-rank percentile of a sorted array
+static double Percentile(const double* sorted, int n, double pct) {
+    if (n <= 0) return 0.0;
+    int rank = (int)(pct / 100.0 * n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return sorted[rank - 1];
+}
+
+// "Tick/Water" style path so nested sections with equal names stay apart
+static void SectionPath(int idx, char* out, size_t size) {
+    int chain[PROFILER_MAX_SECTIONS];
+    int depth = 0;
+    for (int i = idx; i >= 0 && depth < PROFILER_MAX_SECTIONS; i = profilerSections[i].parent) {
+        chain[depth++] = i;
+    }
+    size_t len = 0;
+    out[0] = '\0';
+    for (int d = depth - 1; d >= 0 && len + 1 < size; d--) {
+        int written = snprintf(out + len, size - len, "%s%s", len ? "/" : "", profilerSections[chain[d]].name);
+        if (written < 0) break;
+        len += (size_t)written;
+    }
+}
+
+static void RunScenario(const SimScenario* sc, int ticks, uint64_t seed) {
+    if (ticks > SIM_MAX_TICKS) ticks = SIM_MAX_TICKS;
+    if (resultCount >= SIM_MAX_RESULTS) return;
+
+    worldSeed = seed;
+    sc->setup();
+    ProfileReset();
+
+    static double sectionSum[PROFILER_MAX_SECTIONS];
+    static double sectionMax[PROFILER_MAX_SECTIONS];
+    memset(sectionSum, 0, sizeof(sectionSum));
+    memset(sectionMax, 0, sizeof(sectionMax));
+
+    double total = 0.0;
+    for (int t = 0; t < ticks; t++) {
+        if (sc->beforeTick) sc->beforeTick();
+        uint64_t start = ProfileNowNs();
+        RunSimTick(TICK_DT);
+        tickMs[t] = (double)(ProfileNowNs() - start) / 1e6;
+        PROFILE_FRAME_END();
+        total += tickMs[t];
+        for (int i = 0; i < profilerSectionCount; i++) {
+            double ms = ProfileGetLast(i);
+            sectionSum[i] += ms;
+            if (ms > sectionMax[i]) sectionMax[i] = ms;
+        }
+    }
+
+    SimResult* r = &results[resultCount++];
+    r->name = sc->name;
+    r->seed = seed;
+    r->ticks = ticks;
+    r->mean = ticks > 0 ? total / ticks : 0.0;
+    r->max = 0.0;
+    for (int t = 0; t < ticks; t++) {
+        if (tickMs[t] > r->max) r->max = tickMs[t];
+    }
+    qsort(tickMs, ticks, sizeof(double), CompareDouble);
+    r->p50 = Percentile(tickMs, ticks, 50.0);
+    r->p95 = Percentile(tickMs, ticks, 95.0);
+    r->p99 = Percentile(tickMs, ticks, 99.0);
+    r->sectionCount = profilerSectionCount;
+    for (int i = 0; i < profilerSectionCount; i++) {
+        SectionPath(i, r->sectionNames[i], sizeof(r->sectionNames[i]));
+        r->sectionMean[i] = ticks > 0 ? sectionSum[i] / ticks : 0.0;
+        r->sectionMax[i] = sectionMax[i];
+    }
+
+    printf("--- %s (seed %llu, %d ticks, %d movers, %d items) ---\n",
+           sc->name, (unsigned long long)seed, ticks, moverCount, itemCount);
+    printf("  tick ms: p50 %.3f  p95 %.3f  p99 %.3f  max %.3f  mean %.3f\n",
+           r->p50, r->p95, r->p99, r->max, r->mean);
+    for (int i = 0; i < r->sectionCount; i++) {
+        printf("    %-40s mean %8.3f ms  max %8.3f ms\n", r->sectionNames[i], r->sectionMean[i], r->sectionMax[i]);
+    }
+    printf("\n");
+}
+
+// =============================================================================
+// JSON output and baseline compare
+// =============================================================================
+
+static bool WriteResultsJson(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\"bench\":\"sim\",\"scenarios\":[\n");
+    for (int s = 0; s < resultCount; s++) {
+        SimResult* r = &results[s];
+        fprintf(f, "{\"scenario\":\"%s\",\"seed\":%llu,\"ticks\":%d,"
+                   "\"p50_ms\":%.4f,\"p95_ms\":%.4f,\"p99_ms\":%.4f,\"max_ms\":%.4f,\"mean_ms\":%.4f,\"sections\":{",
+                r->name, (unsigned long long)r->seed, r->ticks, r->p50, r->p95, r->p99, r->max, r->mean);
+        for (int i = 0; i < r->sectionCount; i++) {
+            fprintf(f, "%s\"%s\":{\"mean_ms\":%.4f,\"max_ms\":%.4f}",
+                    i ? "," : "", r->sectionNames[i], r->sectionMean[i], r->sectionMax[i]);
+        }
+        fprintf(f, "}}%s\n", s + 1 < resultCount ? "," : "");
+    }
+    fprintf(f, "]}\n");
+    fclose(f);
+    return true;
+}
+
+// Pull "<key>":<number> out of one scenario line written by WriteResultsJson
+static bool JsonLineNumber(const char* line, const char* key, double* out) {
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* p = strstr(line, pattern);
+    if (!p) return false;
+    *out = strtod(p + strlen(pattern), NULL);
+    return true;
+}
+
+// Returns the number of scenarios whose p95 regressed past the tolerance,
+// or -1 if the baseline could not be read
+static int CompareWithBaseline(const char* path, double tolerancePct) {
+    FILE* f = fopen(path, "r");
+    if (!f) return -1;
+
+    printf("--- Compare with %s (p95, tolerance %.0f%%) ---\n", path, tolerancePct);
+    int regressions = 0;
+    bool seen[SIM_MAX_RESULTS] = {false};
+    char line[8192];
+    while (fgets(line, sizeof(line), f)) {
+        for (int s = 0; s < resultCount; s++) {
+            char tag[96];
+            snprintf(tag, sizeof(tag), "\"scenario\":\"%s\"", results[s].name);
+            if (!strstr(line, tag)) continue;
+            double base50 = 0.0, base95 = 0.0, base99 = 0.0;
+            if (!JsonLineNumber(line, "p95_ms", &base95)) continue;
+            JsonLineNumber(line, "p50_ms", &base50);
+            JsonLineNumber(line, "p99_ms", &base99);
+            seen[s] = true;
+
+            double change = base95 > 0.0 ? (results[s].p95 - base95) / base95 * 100.0 : 0.0;
+            bool regressed = change > tolerancePct;
+            if (regressed) regressions++;
+            printf("  %-14s p50 %7.3f -> %7.3f  p95 %7.3f -> %7.3f (%+6.1f%%)  p99 %7.3f -> %7.3f  %s\n",
+                   results[s].name, base50, results[s].p50, base95, results[s].p95, change,
+                   base99, results[s].p99, regressed ? "REGRESSED" : "ok");
+        }
+    }
+    fclose(f);
+    for (int s = 0; s < resultCount; s++) {
+        if (!seen[s]) printf("  %-14s not in baseline\n", results[s].name);
+    }
+    printf("\n");
+    return regressions;
+}
+
+// =============================================================================
+// Main
+// =============================================================================
+int main(int argc, char* argv[]) {
+    const char* jsonPath = NULL;
+    const char* baselinePath = NULL;
+    double tolerancePct = 15.0;
+    int ticksOverride = 0;
+    bool seedOverride = false;
+    uint64_t seed = 0;
+    const char* only[SIM_MAX_RESULTS];
+    int onlyCount = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--json") == 0 && hasValue) {
+            jsonPath = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && hasValue) {
+            baselinePath = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && hasValue) {
+            tolerancePct = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            ticksOverride = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            seed = (uint64_t)strtoull(argv[++i], NULL, 10);
+            seedOverride = true;
+        } else if (strcmp(argv[i], "--scenario") == 0 && hasValue) {
+            if (onlyCount < SIM_MAX_RESULTS) only[onlyCount++] = argv[++i];
+        } else {
+            printf("Usage: %s [--scenario name] [--ticks n] [--seed n] [--json file]"
+                   " [--baseline file] [--tolerance pct]\n", argv[0]);
+            printf("Scenarios:");
+            for (int s = 0; s < scenarioCount; s++) printf(" %s", scenarios[s].name);
+            printf("\n");
+            return 2;
+        }
+    }
+
+    SetTraceLogLevel(LOG_NONE);
+
+    printf("\n=== SIMULATION BENCHMARKS ===\n\n");
+
+    for (int s = 0; s < scenarioCount; s++) {
+        bool selected = (onlyCount == 0);
+        for (int k = 0; k < onlyCount; k++) {
+            if (strcmp(only[k], scenarios[s].name) == 0) selected = true;
+        }
+        if (!selected) continue;
+        RunScenario(&scenarios[s], ticksOverride > 0 ? ticksOverride : scenarios[s].ticks,
+                    seedOverride ? seed : scenarios[s].seed);
+    }
+    if (resultCount == 0) {
+        printf("No matching scenario\n");
+        return 2;
+    }
+
+    if (jsonPath) {
+        if (!WriteResultsJson(jsonPath)) {
+            printf("Failed to write %s\n", jsonPath);
+            return 2;
+        }
+        printf("Wrote %s\n", jsonPath);
+    }
+
+    int status = 0;
+    if (baselinePath) {
+        int regressions = CompareWithBaseline(baselinePath, tolerancePct);
+        if (regressions < 0) {
+            printf("Failed to read baseline %s\n", baselinePath);
+            return 2;
+        }
+        if (regressions > 0) {
+            printf("%d scenario(s) regressed\n", regressions);
+            status = 1;
+        }
+    }
+
+    printf("Done.\n");
+    return status;
+}
@@ -0,0 +1,204 @@
+// bench_world.c - World startup time and memory footprint by world size
+//
+// Run with: make bench_world
+// Or: ./bin/bench_world [--size WxHxD ...]
+//
+// Each size runs in a fresh child process so the resident set of one world
+// doesn't carry over to the next. The child builds a flat world the way a
+// new game does (grid init, every simulation layer cleared, ground filled,
+// HPA* graph built) and reports:
+//
+//   init ms     InitGrid + layer clears + terrain fill + graph build
+//   RSS MB      resident set after init, minus the resident set at startup
+//   peak MB     VmHWM of the child (whole process, startup included)
+//
+// Sizes larger than the build's MAX_GRID_* caps are listed as skipped.
+
+#define PROFILER_IMPLEMENTATION
+#include "../shared/profiler.h"
+#include "../vendor/raylib.h"
+#include "../src/world/grid.h"
+#include "../src/world/cell_defs.h"
+#include "../src/world/material.h"
+#include "../src/world/pathfinding.h"
+#include "../src/world/designations.h"
+#include "../src/entities/mover.h"
+#include "../src/entities/items.h"
+#include "../src/entities/jobs.h"
+#include "../src/entities/stockpiles.h"
+#include "../src/entities/workshops.h"
+#include "../src/entities/animals.h"
+#include "../src/entities/furniture.h"
+#include "../src/entities/trains.h"
+#include "../src/simulation/water.h"
+#include "../src/simulation/fire.h"
+#include "../src/simulation/smoke.h"
+#include "../src/simulation/steam.h"
+#include "../src/simulation/temperature.h"
+#include "../src/simulation/groundwear.h"
+#include "../src/simulation/floordirt.h"
+#include "../src/simulation/lighting.h"
+#include "../src/simulation/weather.h"
+#include "../src/simulation/plants.h"
+#include "../src/simulation/farming.h"
+#include "../src/simulation/balance.h"
+#include "../src/core/sim_manager.h"
+#include "../src/core/time.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define MAX_SIZES 16
+
+typedef struct {
+    int width, height, depth;
+} WorldSize;
+
+typedef struct {
+    double initMs;
+    double rssMb;
+    double peakMb;
+} WorldResult;
+
+static const WorldSize defaultSizes[] = {
+    {64, 64, 8},
+    {128, 128, 16},
+    {256, 256, 16},
+    {512, 512, 16},
+    {1024, 1024, 32},
+};
+
+// "VmRSS:" / "VmHWM:" from /proc/self/status, in MB
+static double ReadStatusMb(const char* key) {
+    FILE* f = fopen("/proc/self/status", "r");
+    if (!f) return 0.0;
+    char line[256];
+    double mb = 0.0;
+    size_t keyLen = strlen(key);
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, key, keyLen) == 0) {
+            mb = atof(line + keyLen) / 1024.0;
+            break;
+        }
+    }
+    fclose(f);
+    return mb;
+}
+
+static void BuildFlatWorld(const WorldSize* size) {
+    InitGridWithSizeAndChunkSize(size->width, size->height, 16, 16);
+    gridDepth = size->depth;
+    ClearMovers();
+    ClearItems();
+    ClearJobs();
+    ClearStockpiles();
+    ClearWorkshops();
+    ClearAnimals();
+    ClearFurniture();
+    ClearTrains();
+    InitPlants();
+    ClearFarming();
+    InitWater();
+    InitDesignations();
+    InitBalance();
+    InitTime();
+
+    for (int y = 0; y < gridHeight; y++) {
+        for (int x = 0; x < gridWidth; x++) {
+            grid[0][y][x] = CELL_WALL;
+            SetWallMaterial(x, y, 0, MAT_DIRT);
+            SetWallNatural(x, y, 0);
+        }
+    }
+
+    InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+    InitItemSpatialGrid(gridWidth, gridHeight, gridDepth);
+    InitFire();
+    InitSmoke();
+    InitSteam();
+    InitTemperature();
+    InitGroundWear();
+    InitFloorDirt();
+    InitSnow();
+    InitLighting();
+    RebuildSimActivityCounts();
+    BuildEntrances();
+    BuildGraph();
+}
+
+static void RunChild(const WorldSize* size, int fd) {
+    double rssBefore = ReadStatusMb("VmRSS:");
+    uint64_t start = ProfileNowNs();
+    BuildFlatWorld(size);
+    WorldResult r;
+    r.initMs = (double)(ProfileNowNs() - start) / 1e6;
+    r.rssMb = ReadStatusMb("VmRSS:") - rssBefore;
+    r.peakMb = ReadStatusMb("VmHWM:");
+    ssize_t written = write(fd, &r, sizeof(r));
+    _exit(written == (ssize_t)sizeof(r) ? 0 : 1);
+}
+
+static bool RunSize(const WorldSize* size, WorldResult* out) {
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0) {
+        close(fds[0]);
+        RunChild(size, fds[1]);
+    }
+    close(fds[1]);
+    ssize_t got = read(fds[0], out, sizeof(*out));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return got == (ssize_t)sizeof(*out) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main(int argc, char* argv[]) {
+    WorldSize sizes[MAX_SIZES];
+    int sizeCount = 0;
+
+    for (int i = 1; i < argc; i++) {
+        WorldSize s;
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc &&
+            sscanf(argv[i + 1], "%dx%dx%d", &s.width, &s.height, &s.depth) == 3) {
+            if (sizeCount < MAX_SIZES) sizes[sizeCount++] = s;
+            i++;
+        } else {
+            printf("Usage: %s [--size WxHxD ...]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (sizeCount == 0) {
+        sizeCount = (int)(sizeof(defaultSizes) / sizeof(defaultSizes[0]));
+        memcpy(sizes, defaultSizes, sizeof(defaultSizes));
+    }
+
+    SetTraceLogLevel(LOG_NONE);
+
+    printf("\n=== WORLD STARTUP BENCHMARK (caps %dx%dx%d) ===\n\n",
+           MAX_GRID_WIDTH, MAX_GRID_HEIGHT, MAX_GRID_DEPTH);
+    printf("%-16s %10s %10s %10s\n", "world", "init ms", "RSS MB", "peak MB");
+
+    for (int i = 0; i < sizeCount; i++) {
+        const WorldSize* s = &sizes[i];
+        char label[32];
+        snprintf(label, sizeof(label), "%dx%dx%d", s->width, s->height, s->depth);
+        if (s->width > MAX_GRID_WIDTH || s->height > MAX_GRID_HEIGHT || s->depth > MAX_GRID_DEPTH) {
+            printf("%-16s %10s\n", label, "skipped (over caps)");
+            continue;
+        }
+        WorldResult r;
+        if (!RunSize(s, &r)) {
+            printf("%-16s %10s\n", label, "failed");
+            continue;
+        }
+        printf("%-16s %10.1f %10.1f %10.1f\n", label, r.initMs, r.rssMb, r.peakMb);
+    }
+    return 0;
+}
@@ -210,7 +210,7 @@ static float RunMoverForGameHours(float gameHours, float testDayLength) {
     float startX = 2 * CELL_SIZE + CELL_SIZE * 0.5f;
     float startY = 2 * CELL_SIZE + CELL_SIZE * 0.5f;
     InitMoverWithPath(m, startX, startY, 1.0f, path[0], 200.0f, path, pathLen);
-    m->active = true;
+    moverActive[0] = true;
     moverCount = 1;
 
     // Run for gameHours worth of ticks
@@ -223,8 +223,8 @@ static float RunMoverForGameHours(float gameHours, float testDayLength) {
         UpdateMovers();
     }
 
-    float dx = m->x - startX;
-    float dy = m->y - startY;
+    float dx = moverPosX[0] - startX;
+    float dy = moverPosY[0] - startY;
     return sqrtf(dx * dx + dy * dy);
 }
 
@@ -26,7 +26,7 @@ static bool test_verbose = false;
 static int CountItemsOfType(ItemType type) {
     int count = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type) count++;
+        if (itemActive[i] && items[i].type == type) count++;
     }
     return count;
 }
@@ -35,7 +35,7 @@ static int CountItemsOfType(ItemType type) {
 static int CountItemStacksOfType(ItemType type) {
     int count = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type) count += items[i].stackCount;
+        if (itemActive[i] && items[i].type == type) count += items[i].stackCount;
     }
     return count;
 }
@@ -43,7 +43,7 @@ static int CountItemStacksOfType(ItemType type) {
 // Helper: find first item of type
 static int FindFirstItemOfType(ItemType type) {
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type) return i;
+        if (itemActive[i] && items[i].type == type) return i;
     }
     return -1;
 }
@@ -202,10 +202,10 @@ describe(kill_animal) {
         // Carcass should be spawned
         int carcassIdx = FindFirstItemOfType(ITEM_CARCASS);
         expect(carcassIdx >= 0);
-        expect(items[carcassIdx].active);
+        expect(itemActive[carcassIdx]);
         // Position should match animal death position
-        expect(items[carcassIdx].x == ax);
-        expect(items[carcassIdx].y == ay);
+        expect(itemPosX[carcassIdx] == ax);
+        expect(itemPosY[carcassIdx] == ay);
     }
 
     it("KillAnimal on invalid index does nothing") {
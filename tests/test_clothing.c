@@ -167,7 +167,7 @@ describe(clothing) {
             expect(job->targetItem == clothIdx);
             expect(job->assignedMover == mi);
             expect(movers[mi].currentJobId == jobId);
-            expect(items[clothIdx].reservedBy == mi);
+            expect(itemReservedBy[clothIdx] == mi);
         }
 
         FreeJobSystem();
@@ -223,7 +223,7 @@ describe(clothing) {
         RebuildIdleMoverList();
 
         int clothIdx = SpawnItem(6 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_GRASS_TUNIC);
-        items[clothIdx].reservedBy = 99;  // reserved by someone else
+        itemReservedBy[clothIdx] = 99;  // reserved by someone else
 
         int jobId = WorkGiver_EquipClothing(mi);
         expect(jobId == -1);
@@ -241,8 +241,8 @@ describe(clothing) {
         RebuildIdleMoverList();
 
         // Spawn clothing at mover's exact position
-        float mx = movers[mi].x;
-        float my = movers[mi].y;
+        float mx = moverPosX[mi];
+        float my = moverPosY[mi];
         int clothIdx = SpawnItem(mx, my, 1.0f, ITEM_LEATHER_VEST);
 
         int jobId = WorkGiver_EquipClothing(mi);
@@ -254,8 +254,8 @@ describe(clothing) {
 
         expect(result == JOBRUN_DONE);
         expect(movers[mi].equippedClothing == clothIdx);
-        expect(items[clothIdx].state == ITEM_CARRIED);
-        expect(items[clothIdx].reservedBy == mi);
+        expect(itemState[clothIdx] == ITEM_CARRIED);
+        expect(itemReservedBy[clothIdx] == mi);
 
         FreeJobSystem();
     }
@@ -269,13 +269,13 @@ describe(clothing) {
         InitJobSystem(moverCount);
         RebuildIdleMoverList();
 
-        float mx = movers[mi].x;
-        float my = movers[mi].y;
+        float mx = moverPosX[mi];
+        float my = moverPosY[mi];
 
         // Manually equip a grass tunic
         int oldClothIdx = SpawnItem(mx, my, 1.0f, ITEM_GRASS_TUNIC);
-        items[oldClothIdx].state = ITEM_CARRIED;
-        items[oldClothIdx].reservedBy = mi;
+        itemState[oldClothIdx] = ITEM_CARRIED;
+        itemReservedBy[oldClothIdx] = mi;
         movers[mi].equippedClothing = oldClothIdx;
 
         // Spawn a better item at mover position
@@ -290,8 +290,8 @@ describe(clothing) {
         expect(result == JOBRUN_DONE);
         expect(movers[mi].equippedClothing == newClothIdx);
         // Old clothing should be dropped (on ground, unreserved)
-        expect(items[oldClothIdx].state == ITEM_ON_GROUND);
-        expect(items[oldClothIdx].reservedBy == -1);
+        expect(itemState[oldClothIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[oldClothIdx] == -1);
 
         FreeJobSystem();
     }
@@ -305,13 +305,13 @@ describe(clothing) {
         InitJobSystem(moverCount);
         RebuildIdleMoverList();
 
-        float mx = movers[mi].x;
-        float my = movers[mi].y;
+        float mx = moverPosX[mi];
+        float my = moverPosY[mi];
 
         // Equip flax tunic (0.40)
         int oldIdx = SpawnItem(mx, my, 1.0f, ITEM_FLAX_TUNIC);
-        items[oldIdx].state = ITEM_CARRIED;
-        items[oldIdx].reservedBy = mi;
+        itemState[oldIdx] = ITEM_CARRIED;
+        itemReservedBy[oldIdx] = mi;
         movers[mi].equippedClothing = oldIdx;
 
         // Spawn leather vest (0.50) — only 0.10 improvement, not > 0.1
@@ -329,13 +329,13 @@ describe(clothing) {
         InitJobSystem(moverCount);
         RebuildIdleMoverList();
 
-        float mx = movers[mi].x;
-        float my = movers[mi].y;
+        float mx = moverPosX[mi];
+        float my = moverPosY[mi];
 
         // Equip grass tunic (0.25)
         int oldIdx = SpawnItem(mx, my, 1.0f, ITEM_GRASS_TUNIC);
-        items[oldIdx].state = ITEM_CARRIED;
-        items[oldIdx].reservedBy = mi;
+        itemState[oldIdx] = ITEM_CARRIED;
+        itemReservedBy[oldIdx] = mi;
         movers[mi].equippedClothing = oldIdx;
 
         // Spawn leather vest (0.50) — 0.25 improvement, should upgrade
@@ -354,18 +354,18 @@ describe(clothing) {
         SetupClothingGrid();
         int mi = SetupMover(5, 5);
 
-        float mx = movers[mi].x;
-        float my = movers[mi].y;
+        float mx = moverPosX[mi];
+        float my = moverPosY[mi];
         int clothIdx = SpawnItem(mx, my, 1.0f, ITEM_GRASS_TUNIC);
-        items[clothIdx].state = ITEM_CARRIED;
-        items[clothIdx].reservedBy = mi;
+        itemState[clothIdx] = ITEM_CARRIED;
+        itemReservedBy[clothIdx] = mi;
         movers[mi].equippedClothing = clothIdx;
 
         DropEquippedClothing(mi);
 
         expect(movers[mi].equippedClothing == -1);
-        expect(items[clothIdx].state == ITEM_ON_GROUND);
-        expect(items[clothIdx].reservedBy == -1);
+        expect(itemState[clothIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[clothIdx] == -1);
     }
 
     it("DropEquippedClothing is no-op when no clothing") {
@@ -397,11 +397,11 @@ describe(clothing) {
         movers[clothedIdx].hunger = 0.0f;
 
         // Equip leather coat on clothed mover
-        float cx = movers[clothedIdx].x;
-        float cy = movers[clothedIdx].y;
+        float cx = moverPosX[clothedIdx];
+        float cy = moverPosY[clothedIdx];
         int clothIdx = SpawnItem(cx, cy, 1.0f, ITEM_LEATHER_COAT);
-        items[clothIdx].state = ITEM_CARRIED;
-        items[clothIdx].reservedBy = clothedIdx;
+        itemState[clothIdx] = ITEM_CARRIED;
+        itemReservedBy[clothIdx] = clothedIdx;
         movers[clothedIdx].equippedClothing = clothIdx;
 
         // Use moderate dt so movers cool but don't both hit the 20°C floor
@@ -433,11 +433,11 @@ describe(clothing) {
         movers[clothedIdx].bodyTemp = 30.0f;
 
         // Equip leather coat
-        float cx = movers[clothedIdx].x;
-        float cy = movers[clothedIdx].y;
+        float cx = moverPosX[clothedIdx];
+        float cy = moverPosY[clothedIdx];
         int clothIdx = SpawnItem(cx, cy, 1.0f, ITEM_LEATHER_COAT);
-        items[clothIdx].state = ITEM_CARRIED;
-        items[clothIdx].reservedBy = clothedIdx;
+        itemState[clothIdx] = ITEM_CARRIED;
+        itemReservedBy[clothIdx] = clothedIdx;
         movers[clothedIdx].equippedClothing = clothIdx;
 
         float savedDt = gameDeltaTime;
@@ -469,19 +469,19 @@ describe(clothing) {
         movers[coatIdx].hunger = 0.0f;
 
         // Equip grass tunic (0.25 reduction)
-        float tx = movers[tunicIdx].x;
-        float ty = movers[tunicIdx].y;
+        float tx = moverPosX[tunicIdx];
+        float ty = moverPosY[tunicIdx];
         int tunicItem = SpawnItem(tx, ty, 1.0f, ITEM_GRASS_TUNIC);
-        items[tunicItem].state = ITEM_CARRIED;
-        items[tunicItem].reservedBy = tunicIdx;
+        itemState[tunicItem] = ITEM_CARRIED;
+        itemReservedBy[tunicItem] = tunicIdx;
         movers[tunicIdx].equippedClothing = tunicItem;
 
         // Equip leather coat (0.65 reduction)
-        float cx = movers[coatIdx].x;
-        float cy = movers[coatIdx].y;
+        float cx = moverPosX[coatIdx];
+        float cy = moverPosY[coatIdx];
         int coatItem = SpawnItem(cx, cy, 1.0f, ITEM_LEATHER_COAT);
-        items[coatItem].state = ITEM_CARRIED;
-        items[coatItem].reservedBy = coatIdx;
+        itemState[coatItem] = ITEM_CARRIED;
+        itemReservedBy[coatItem] = coatIdx;
         movers[coatIdx].equippedClothing = coatItem;
 
         // Use moderate dt so movers cool but don't both hit the 20°C floor
@@ -594,13 +594,13 @@ describe(clothing) {
 
         int jobId = WorkGiver_EquipClothing(mi);
         expect(jobId >= 0);
-        expect(items[clothIdx].reservedBy == mi);
+        expect(itemReservedBy[clothIdx] == mi);
 
         // Cancel the job
         CancelJob(&movers[mi], mi);
 
         expect(movers[mi].currentJobId == -1);
-        expect(items[clothIdx].reservedBy == -1);
+        expect(itemReservedBy[clothIdx] == -1);
 
         FreeJobSystem();
     }
@@ -71,12 +71,12 @@ describe(put_item_in_container) {
         PutItemInContainer(item, container);
 
         expect(items[item].containedIn == container);
-        expect(items[item].state == ITEM_IN_CONTAINER);
+        expect(itemState[item] == ITEM_IN_CONTAINER);
         expect(items[container].contentCount == 1);
         expect(ContainerMightHaveType(container, ITEM_BLUE));
         // Item position mirrors container
-        expect(items[item].x == items[container].x);
-        expect(items[item].y == items[container].y);
+        expect(itemPosX[item] == itemPosX[container]);
+        expect(itemPosY[item] == itemPosY[container]);
     }
 
     it("should merge same type+material into existing stack") {
@@ -94,7 +94,7 @@ describe(put_item_in_container) {
         PutItemInContainer(b, container);
 
         // b should have been merged into a, contentCount unchanged
-        expect(!items[b].active);  // consumed by merge
+        expect(!itemActive[b]);  // consumed by merge
         expect(items[a].stackCount == 5);
         expect(items[container].contentCount == 1);
     }
@@ -176,9 +176,9 @@ describe(remove_from_container) {
         RemoveItemFromContainer(item);
 
         expect(items[item].containedIn == -1);
-        expect(items[item].state == ITEM_ON_GROUND);
+        expect(itemState[item] == ITEM_ON_GROUND);
         expect(items[container].contentCount == 0);
-        expect(items[item].active);
+        expect(itemActive[item]);
     }
 
     it("should remove from nested container at outermost position") {
@@ -200,7 +200,7 @@ describe(remove_from_container) {
 
         // Seed should be at chest's position (outermost), not bag's
         expect(items[seed].containedIn == -1);
-        expect(items[seed].state == ITEM_ON_GROUND);
+        expect(itemState[seed] == ITEM_ON_GROUND);
         expect(items[bag].contentCount == 0);
         // Bag stays in chest
         expect(items[bag].containedIn == chest);
@@ -211,7 +211,7 @@ describe(remove_from_container) {
         Setup();
         int item = SpawnItem(16, 16, 0, ITEM_RED);
         RemoveItemFromContainer(item);
-        expect(items[item].state == ITEM_ON_GROUND);
+        expect(itemState[item] == ITEM_ON_GROUND);
         expect(items[item].containedIn == -1);
     }
 }
@@ -284,7 +284,7 @@ describe(accessibility) {
         int item = SpawnItem(16, 16, 0, ITEM_BLUE);
         PutItemInContainer(item, container);
 
-        items[container].reservedBy = 0;  // reserved by mover 0
+        itemReservedBy[container] = 0;  // reserved by mover 0
         expect(!IsItemAccessible(item));
     }
 
@@ -295,7 +295,7 @@ describe(accessibility) {
         int item = SpawnItem(16, 16, 0, ITEM_BLUE);
         PutItemInContainer(item, container);
 
-        items[container].state = ITEM_CARRIED;
+        itemState[container] = ITEM_CARRIED;
         expect(!IsItemAccessible(item));
     }
 
@@ -313,7 +313,7 @@ describe(accessibility) {
         expect(IsItemAccessible(seed));
 
         // Reserve the chest — seed deep inside should be inaccessible
-        items[chest].reservedBy = 0;
+        itemReservedBy[chest] = 0;
         expect(!IsItemAccessible(seed));
     }
 
@@ -342,12 +342,12 @@ describe(move_container) {
         float newZ = 1;
         MoveContainer(container, newX, newY, newZ);
 
-        expect(items[container].x == newX);
-        expect(items[container].y == newY);
-        expect(items[a].x == newX);
-        expect(items[a].y == newY);
-        expect(items[b].x == newX);
-        expect(items[b].y == newY);
+        expect(itemPosX[container] == newX);
+        expect(itemPosY[container] == newY);
+        expect(itemPosX[a] == newX);
+        expect(itemPosY[a] == newY);
+        expect(itemPosX[b] == newX);
+        expect(itemPosY[b] == newY);
     }
 
     it("should handle nested containers") {
@@ -365,9 +365,9 @@ describe(move_container) {
         float newY = 4 * CELL_SIZE;
         MoveContainer(chest, newX, newY, 0);
 
-        expect(items[chest].x == newX);
-        expect(items[bag].x == newX);
-        expect(items[seed].x == newX);
+        expect(itemPosX[chest] == newX);
+        expect(itemPosX[bag] == newX);
+        expect(itemPosX[seed] == newX);
     }
 }
 
@@ -387,9 +387,9 @@ describe(spill_contents) {
         SpillContainerContents(container);
 
         expect(items[a].containedIn == -1);
-        expect(items[a].state == ITEM_ON_GROUND);
+        expect(itemState[a] == ITEM_ON_GROUND);
         expect(items[b].containedIn == -1);
-        expect(items[b].state == ITEM_ON_GROUND);
+        expect(itemState[b] == ITEM_ON_GROUND);
         expect(items[container].contentCount == 0);
         expect(items[container].contentTypeMask == 0);
     }
@@ -409,10 +409,10 @@ describe(spill_contents) {
 
         // Bag is spilled out of chest
         expect(items[bag].containedIn == -1);
-        expect(items[bag].state == ITEM_ON_GROUND);
+        expect(itemState[bag] == ITEM_ON_GROUND);
         // But seed stays inside bag
         expect(items[seed].containedIn == bag);
-        expect(items[seed].state == ITEM_IN_CONTAINER);
+        expect(itemState[seed] == ITEM_IN_CONTAINER);
         expect(items[bag].contentCount == 1);
     }
 }
@@ -430,10 +430,10 @@ describe(delete_container) {
 
         DeleteItem(container);
 
-        expect(!items[container].active);
-        expect(items[a].active);
+        expect(!itemActive[container]);
+        expect(itemActive[a]);
         expect(items[a].containedIn == -1);
-        expect(items[a].state == ITEM_ON_GROUND);
+        expect(itemState[a] == ITEM_ON_GROUND);
     }
 
     it("should decrement parent contentCount when contained item deleted") {
@@ -448,7 +448,7 @@ describe(delete_container) {
 
         DeleteItem(a);
 
-        expect(!items[a].active);
+        expect(!itemActive[a]);
         expect(items[container].contentCount == 1);
     }
 }
@@ -469,7 +469,7 @@ describe(split_in_container) {
         int split = SplitStack(item, 3);
         expect(split >= 0);
         expect(items[split].containedIn == container);
-        expect(items[split].state == ITEM_IN_CONTAINER);
+        expect(itemState[split] == ITEM_IN_CONTAINER);
         expect(items[split].stackCount == 3);
         expect(items[item].stackCount == 7);
         // contentCount increases — now 2 items inside
@@ -657,7 +657,7 @@ describe(container_item_types) {
         expect(CanPutItemInContainer(rock, basket));
         PutItemInContainer(rock, basket);
         expect(items[rock].containedIn == basket);
-        expect(items[rock].state == ITEM_IN_CONTAINER);
+        expect(itemState[rock] == ITEM_IN_CONTAINER);
         expect(items[basket].contentCount == 1);
     }
 
@@ -723,7 +723,7 @@ describe(stockpile_containers) {
         int basket = SpawnItem(0, 0, 0, ITEM_BASKET);
         PlaceItemInStockpile(sp, 0, 0, basket);
 
-        expect(items[basket].state == ITEM_IN_STOCKPILE);
+        expect(itemState[basket] == ITEM_IN_STOCKPILE);
         expect(IsSlotContainer(sp, 0));
         expect(CountInstalledContainers(sp) == 1);
         // slotCounts should be 0 (container is empty)
@@ -738,7 +738,7 @@ describe(stockpile_containers) {
         int basket = SpawnItem(0, 0, 0, ITEM_BASKET);
         PlaceItemInStockpile(sp, 0, 0, basket);
 
-        expect(items[basket].state == ITEM_IN_STOCKPILE);
+        expect(itemState[basket] == ITEM_IN_STOCKPILE);
         // Should be a normal slot, not a container slot
         expect(!IsSlotContainer(sp, 0));
         expect(CountInstalledContainers(sp) == 0);
@@ -760,7 +760,7 @@ describe(stockpile_containers) {
         PlaceItemInStockpile(sp, 0, 0, rock);
 
         expect(items[rock].containedIn == basket);
-        expect(items[rock].state == ITEM_IN_CONTAINER);
+        expect(itemState[rock] == ITEM_IN_CONTAINER);
         expect(items[basket].contentCount == 1);
         expect(stockpiles[sp].slotCounts[0] == 1);
     }
@@ -916,11 +916,11 @@ describe(stockpile_containers) {
 
         // Container contents should be spilled
         expect(items[rock].containedIn == -1);
-        expect(items[rock].state == ITEM_ON_GROUND);
+        expect(itemState[rock] == ITEM_ON_GROUND);
         expect(items[log].containedIn == -1);
-        expect(items[log].state == ITEM_ON_GROUND);
+        expect(itemState[log] == ITEM_ON_GROUND);
         // Basket itself should be on ground too
-        expect(items[basket].state == ITEM_ON_GROUND);
+        expect(itemState[basket] == ITEM_ON_GROUND);
         expect(items[basket].contentCount == 0);
     }
 
@@ -1076,7 +1076,7 @@ describe(container_search) {
         int basket = SpawnItemWithMaterial(3 * CELL_SIZE + 16, 3 * CELL_SIZE + 16, 0, ITEM_RED, MAT_NONE);
         int blue = SpawnItemWithMaterial(0, 0, 0, ITEM_BLUE, MAT_NONE);
         PutItemInContainer(blue, basket);
-        items[basket].reservedBy = 0;  // Container reserved by mover 0
+        itemReservedBy[basket] = 0;  // Container reserved by mover 0
 
         int containerIdx = -1;
         int found = FindItemInContainers(ITEM_BLUE, 0, 3, 3, 50, -1, NULL, NULL, &containerIdx);
@@ -1088,7 +1088,7 @@ describe(container_search) {
         int basket = SpawnItemWithMaterial(3 * CELL_SIZE + 16, 3 * CELL_SIZE + 16, 0, ITEM_RED, MAT_NONE);
         int blue = SpawnItemWithMaterial(0, 0, 0, ITEM_BLUE, MAT_NONE);
         PutItemInContainer(blue, basket);
-        items[basket].state = ITEM_CARRIED;
+        itemState[basket] = ITEM_CARRIED;
 
         int containerIdx = -1;
         int found = FindItemInContainers(ITEM_BLUE, 0, 3, 3, 50, -1, NULL, NULL, &containerIdx);
@@ -1100,7 +1100,7 @@ describe(container_search) {
         int basket = SpawnItemWithMaterial(3 * CELL_SIZE + 16, 3 * CELL_SIZE + 16, 0, ITEM_RED, MAT_NONE);
         int blue = SpawnItemWithMaterial(0, 0, 0, ITEM_BLUE, MAT_NONE);
         PutItemInContainer(blue, basket);
-        items[blue].reservedBy = 0;  // Item itself is reserved
+        itemReservedBy[blue] = 0;  // Item itself is reserved
 
         int containerIdx = -1;
         int found = FindItemInContainers(ITEM_BLUE, 0, 3, 3, 50, -1, NULL, NULL, &containerIdx);
@@ -1178,11 +1178,11 @@ describe(container_extraction) {
         int basket = SpawnItemWithMaterial(3 * CELL_SIZE + 16, 3 * CELL_SIZE + 16, 0, ITEM_RED, MAT_NONE);
         int blue = SpawnItemWithMaterial(0, 0, 0, ITEM_BLUE, MAT_NONE);
         PutItemInContainer(blue, basket);
-        expect(items[blue].state == ITEM_IN_CONTAINER);
+        expect(itemState[blue] == ITEM_IN_CONTAINER);
         expect(items[blue].containedIn == basket);
 
         RemoveItemFromContainer(blue);
-        expect(items[blue].state == ITEM_ON_GROUND);
+        expect(itemState[blue] == ITEM_ON_GROUND);
         expect(items[blue].containedIn == -1);
         expect(items[basket].contentCount == 0);
     }
@@ -1259,7 +1259,7 @@ describe(container_extraction) {
 
         // Extract the split portion
         RemoveItemFromContainer(split);
-        expect(items[split].state == ITEM_ON_GROUND);
+        expect(itemState[split] == ITEM_ON_GROUND);
         expect(items[split].containedIn == -1);
         expect(items[basket].contentCount == 1);  // original remains
     }
@@ -1279,16 +1279,16 @@ describe(container_hauling) {
         PutItemInContainer(b, container);
 
         // Simulate mover carrying: update container position, then MoveContainer
-        items[container].state = ITEM_CARRIED;
-        items[container].x = 48.0f;
-        items[container].y = 48.0f;
-        items[container].z = 0.0f;
+        itemState[container] = ITEM_CARRIED;
+        itemPosX[container] = 48.0f;
+        itemPosY[container] = 48.0f;
+        itemPosZ[container] = 0.0f;
         MoveContainer(container, 48.0f, 48.0f, 0.0f);
 
-        expect(items[a].x > 47.9f && items[a].x < 48.1f);
-        expect(items[a].y > 47.9f && items[a].y < 48.1f);
-        expect(items[b].x > 47.9f && items[b].x < 48.1f);
-        expect(items[b].y > 47.9f && items[b].y < 48.1f);
+        expect(itemPosX[a] > 47.9f && itemPosX[a] < 48.1f);
+        expect(itemPosY[a] > 47.9f && itemPosY[a] < 48.1f);
+        expect(itemPosX[b] > 47.9f && itemPosX[b] < 48.1f);
+        expect(itemPosY[b] > 47.9f && itemPosY[b] < 48.1f);
     }
 
     it("should move nested container contents recursively") {
@@ -1301,13 +1301,13 @@ describe(container_hauling) {
         PutItemInContainer(inner, outer);
         PutItemInContainer(seed, inner);
 
-        items[outer].state = ITEM_CARRIED;
-        items[outer].x = 48.0f;
-        items[outer].y = 48.0f;
+        itemState[outer] = ITEM_CARRIED;
+        itemPosX[outer] = 48.0f;
+        itemPosY[outer] = 48.0f;
         MoveContainer(outer, 48.0f, 48.0f, 0.0f);
 
-        expect(items[inner].x > 47.9f && items[inner].x < 48.1f);
-        expect(items[seed].x > 47.9f && items[seed].x < 48.1f);
+        expect(itemPosX[inner] > 47.9f && itemPosX[inner] < 48.1f);
+        expect(itemPosX[seed] > 47.9f && itemPosX[seed] < 48.1f);
     }
 
     it("should use total weight for carried container") {
@@ -1338,11 +1338,11 @@ describe(container_hauling) {
         expect(IsItemAccessible(a));
 
         // Mark as carried
-        items[container].state = ITEM_CARRIED;
+        itemState[container] = ITEM_CARRIED;
         expect(!IsItemAccessible(a));
 
         // Drop — accessible again
-        items[container].state = ITEM_ON_GROUND;
+        itemState[container] = ITEM_ON_GROUND;
         expect(IsItemAccessible(a));
     }
 
@@ -1353,10 +1353,10 @@ describe(container_hauling) {
         int a = SpawnItem(16, 16, 0, ITEM_LOG);
         PutItemInContainer(a, container);
 
-        items[container].reservedBy = 0;
+        itemReservedBy[container] = 0;
         expect(!IsItemAccessible(a));
 
-        items[container].reservedBy = -1;
+        itemReservedBy[container] = -1;
         expect(IsItemAccessible(a));
     }
 
@@ -1370,15 +1370,15 @@ describe(container_hauling) {
         PutItemInContainer(b, container);
 
         // Simulate carry
-        items[container].state = ITEM_CARRIED;
-        items[container].x = 48.0f;
-        items[container].y = 48.0f;
+        itemState[container] = ITEM_CARRIED;
+        itemPosX[container] = 48.0f;
+        itemPosY[container] = 48.0f;
         MoveContainer(container, 48.0f, 48.0f, 0.0f);
 
         // Safe drop the container
         SafeDropItem(container, 16.0f, 16.0f, 0);
-        MoveContainer(container, items[container].x, items[container].y, items[container].z);
-        items[container].state = ITEM_ON_GROUND;
+        MoveContainer(container, itemPosX[container], itemPosY[container], itemPosZ[container]);
+        itemState[container] = ITEM_ON_GROUND;
 
         // Contents still inside
         expect(items[a].containedIn == container);
@@ -1386,10 +1386,10 @@ describe(container_hauling) {
         expect(items[container].contentCount == 2);
 
         // Contents moved to container's new position
-        expect(items[a].x == items[container].x);
-        expect(items[a].y == items[container].y);
-        expect(items[b].x == items[container].x);
-        expect(items[b].y == items[container].y);
+        expect(itemPosX[a] == itemPosX[container]);
+        expect(itemPosY[a] == itemPosY[container]);
+        expect(itemPosX[b] == itemPosX[container]);
+        expect(itemPosY[b] == itemPosY[container]);
     }
 
     it("should install full container in stockpile with contents intact") {
@@ -1408,7 +1408,7 @@ describe(container_hauling) {
         PlaceItemInStockpile(sp, 0, 0, basket);
 
         // Basket installed as container slot
-        expect(items[basket].state == ITEM_IN_STOCKPILE);
+        expect(itemState[basket] == ITEM_IN_STOCKPILE);
         expect(IsSlotContainer(sp, 0));
 
         // Contents still inside
@@ -1464,7 +1464,7 @@ describe(container_filter_cleanup) {
 
         // Verify initial state
         expect(items[log].containedIn == basket);
-        expect(items[log].state == ITEM_IN_CONTAINER);
+        expect(itemState[log] == ITEM_IN_CONTAINER);
 
         // Disallow logs from this stockpile
         SetStockpileFilter(sp, ITEM_LOG, false);
@@ -1474,11 +1474,11 @@ describe(container_filter_cleanup) {
 
         // Log should be extracted from container
         expect(items[log].containedIn == -1);
-        expect(items[log].state != ITEM_IN_CONTAINER);
+        expect(itemState[log] != ITEM_IN_CONTAINER);
 
         // Basket should still be installed as container slot
         expect(IsSlotContainer(sp, 0));
-        expect(items[basket].state == ITEM_IN_STOCKPILE);
+        expect(itemState[basket] == ITEM_IN_STOCKPILE);
     }
 
     it("should leave legal items in container untouched") {
@@ -1504,7 +1504,7 @@ describe(container_filter_cleanup) {
         // Rock extracted, log stays
         expect(items[rock].containedIn == -1);
         expect(items[log].containedIn == basket);
-        expect(items[log].state == ITEM_IN_CONTAINER);
+        expect(itemState[log] == ITEM_IN_CONTAINER);
         expect(items[basket].contentCount == 1);
     }
 
@@ -1526,7 +1526,7 @@ describe(container_filter_cleanup) {
 
         // Log should remain in container
         expect(items[log].containedIn == basket);
-        expect(items[log].state == ITEM_IN_CONTAINER);
+        expect(itemState[log] == ITEM_IN_CONTAINER);
         expect(items[basket].contentCount == 1);
     }
 
@@ -1550,7 +1550,7 @@ describe(container_filter_cleanup) {
 
         // Container should still be installed even though empty now
         expect(IsSlotContainer(sp, 0));
-        expect(items[basket].state == ITEM_IN_STOCKPILE);
+        expect(itemState[basket] == ITEM_IN_STOCKPILE);
         expect(items[basket].contentCount == 0);
     }
 }
@@ -0,0 +1,202 @@
+#include "../vendor/c89spec.h"
+#include "../vendor/raylib.h"
+#include "../src/core/event_log.h"
+#include "../src/core/time.h"
+#include "test_helpers.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+static bool test_verbose = false;
+
+// Text after the "[Sea Dd HH:MM] " prefix
+static const char* EventText(int index) {
+    const char* line = EventLogGet(index);
+    if (!line) return "";
+    const char* body = strstr(line, "] ");
+    return body ? body + 2 : line;
+}
+
+static void* LogFromThread(void* arg) {
+    (void)arg;
+    EventLog("from worker %d", 7);
+    return NULL;
+}
+
+static void* LogAndExitThread(void* arg) {
+    EventLog("short-lived %d", *(int*)arg);
+    EventLogThreadExit();
+    return NULL;
+}
+
+// Reads a whole temp file into buf
+static void ReadBack(FILE* f, char* buf, size_t size) {
+    rewind(f);
+    size_t n = fread(buf, 1, size - 1, f);
+    buf[n] = '\0';
+}
+
+// =============================================================================
+// Ring and rendering
+// =============================================================================
+
+describe(event_log_rendering) {
+    it("renders the time prefix and message when read") {
+        EventLogClear();
+        timeOfDay = 8.25f;
+        EventLog("Job %d DONE type=%s mover=%d", 12, "HAUL", 4);
+        expect(EventLogCount() == 1);
+        expect(strstr(EventLogGet(0), " 08:15] ") != NULL);
+        expect(strcmp(EventText(0), "Job 12 DONE type=HAUL mover=4") == 0);
+    }
+
+    it("renders every conversion the way printf does") {
+        EventLogClear();
+        long long big = 1LL << 40;
+        size_t count = 42;
+        EventLog("%.1f %+.1f %.0f%% %5d|%-6s|%x %c", 3.14159, -2.0, 55.5, 42, "ab", 255, 'Z');
+        EventLog("%lld %zu %*d %.3s %u", big, count, 6, 9, "abcdef", 7u);
+
+        char expected[EVENT_LOG_MAX_LENGTH];
+        snprintf(expected, sizeof(expected), "%.1f %+.1f %.0f%% %5d|%-6s|%x %c", 3.14159, -2.0, 55.5, 42, "ab", 255, 'Z');
+        expect(strcmp(EventText(0), expected) == 0);
+        snprintf(expected, sizeof(expected), "%lld %zu %*d %.3s %u", big, count, 6, 9, "abcdef", 7u);
+        expect(strcmp(EventText(1), expected) == 0);
+    }
+
+    it("copies string arguments when logged") {
+        EventLogClear();
+        char name[16] = "alpha";
+        EventLog("Mover %s", name);
+        strcpy(name, "beta");
+        expect(strcmp(EventText(0), "Mover alpha") == 0);
+    }
+
+    it("marks arguments that did not fit with ?") {
+        EventLogClear();
+        char longName[EVENT_LOG_ARG_BYTES + 20];
+        memset(longName, 'x', sizeof(longName) - 1);
+        longName[sizeof(longName) - 1] = '\0';
+        EventLog("%s n=%d", longName, 5);
+        expect(strstr(EventText(0), " n=?") != NULL);
+    }
+
+    it("keeps the newest entries once the ring wraps") {
+        EventLogClear();
+        for (int i = 0; i < EVENT_LOG_MAX_ENTRIES + 10; i++) {
+            EventLog("event %d", i);
+        }
+        expect(EventLogCount() == EVENT_LOG_MAX_ENTRIES);
+        expect(strcmp(EventText(0), "event 10") == 0);
+        expect(EventLogGet(EVENT_LOG_MAX_ENTRIES) == NULL);
+    }
+
+    it("merges events from other threads in order") {
+        EventLogClear();
+        EventLog("before");
+        pthread_t thread;
+        pthread_create(&thread, NULL, LogFromThread, NULL);
+        pthread_join(thread, NULL);
+        EventLog("after");
+        expect(EventLogCount() == 3);
+        expect(strcmp(EventText(0), "before") == 0);
+        expect(strcmp(EventText(1), "from worker 7") == 0);
+        expect(strcmp(EventText(2), "after") == 0);
+    }
+
+    it("reuses the rings of exited threads") {
+        EventLogClear();
+        int threadCount = EVENT_LOG_MAX_THREADS * 2;
+        for (int i = 0; i < threadCount; i++) {
+            pthread_t thread;
+            pthread_create(&thread, NULL, LogAndExitThread, &i);
+            pthread_join(thread, NULL);
+        }
+        expect(EventLogCount() == threadCount);
+        expect(strcmp(EventText(0), "short-lived 0") == 0);
+        char last[32];
+        snprintf(last, sizeof(last), "short-lived %d", threadCount - 1);
+        expect(strcmp(EventText(threadCount - 1), last) == 0);
+    }
+}
+
+// =============================================================================
+// Binary stream
+// =============================================================================
+
+describe(event_log_stream) {
+    static char decoded[1 << 16];
+    static char dumped[1 << 16];
+    const char* streamPath = "/tmp/navkit_test_events.bin";
+    const char* dumpPath = "/tmp/navkit_test_events.log";
+
+    it("decodes to the same text as the dump") {
+        EventLogClear();
+        expect(EventLogStreamStart(streamPath));
+        EventLog("Stockpile %d created at (%d,%d,z%d) %dx%d", 3, 10, 12, 1, 4, 4);
+        EventLog("Weather: %s -> %s", "Clear", "Rain");
+        EventLogStreamFlush();
+        EventLog("Mover %d ate item %d (%s), hunger=%.0f%%", 2, 17, "Berries", 35.0f);
+        EventLogStreamStop();
+        EventLogDump(dumpPath);
+
+        FILE* out = tmpfile();
+        expect(EventLogDecodeFile(streamPath, out, NULL));
+        ReadBack(out, decoded, sizeof(decoded));
+        fclose(out);
+        FILE* dump = fopen(dumpPath, "r");
+        ReadBack(dump, dumped, sizeof(dumped));
+        fclose(dump);
+
+        if (test_verbose) printf("%s", decoded);
+        expect(strcmp(decoded, dumped) == 0);
+        expect(strstr(decoded, "hunger=35%") != NULL);
+    }
+
+    it("filters decoded lines") {
+        FILE* out = tmpfile();
+        expect(EventLogDecodeFile(streamPath, out, "Weather"));
+        ReadBack(out, decoded, sizeof(decoded));
+        fclose(out);
+        expect(strstr(decoded, "Weather: Clear -> Rain") != NULL);
+        expect(strstr(decoded, "Stockpile") == NULL);
+    }
+
+    it("notes events the ring overwrote before a flush") {
+        EventLogClear();
+        expect(EventLogStreamStart(streamPath));
+        for (int i = 0; i < EVENT_LOG_MAX_ENTRIES + 5; i++) {
+            EventLog("event %d", i);
+        }
+        EventLogStreamStop();
+
+        FILE* out = tmpfile();
+        expect(EventLogDecodeFile(streamPath, out, NULL));
+        ReadBack(out, decoded, sizeof(decoded));
+        fclose(out);
+        expect(strstr(decoded, "... 5 events dropped ...") != NULL);
+        expect(strstr(decoded, "] event 5\n") != NULL);
+        expect(strstr(decoded, "] event 4\n") == NULL);
+    }
+
+    it("rejects files that are not event streams") {
+        FILE* f = fopen(dumpPath, "w");
+        fprintf(f, "not a stream\n");
+        fclose(f);
+        FILE* out = tmpfile();
+        expect(!EventLogDecodeFile(dumpPath, out, NULL));
+        fclose(out);
+        remove(dumpPath);
+        remove(streamPath);
+    }
+}
+
+int main(int argc, char** argv) {
+    test_verbose = c89spec_parse_args(argc, argv);
+    if (!test_verbose) SetTraceLogLevel(LOG_NONE);
+
+    test(event_log_rendering);
+    test(event_log_stream);
+
+    return summary();
+}
@@ -426,7 +426,7 @@ describe(farming) {
         expect(fc->cropType == CROP_WHEAT);
         expect(fc->growthStage == CROP_STAGE_SPROUTED);
         // Seed should be consumed
-        expect(!items[seedIdx].active);
+        expect(!itemActive[seedIdx]);
     }
 
     // =========================================================================
@@ -507,7 +507,7 @@ describe(farming) {
         // Count spawned items
         int wheatCount = 0, seedCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type == ITEM_WHEAT) wheatCount++;
             if (items[i].type == ITEM_WHEAT_SEEDS) seedCount++;
         }
@@ -555,7 +555,7 @@ describe(farming) {
 
         int wheatCount = 0, seedCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type == ITEM_WHEAT) wheatCount++;
             if (items[i].type == ITEM_WHEAT_SEEDS) seedCount++;
         }
@@ -694,7 +694,7 @@ describe(farming) {
         // Find spawned item
         bool foundSeed = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_WHEAT_SEEDS) {
+            if (itemActive[i] && items[i].type == ITEM_WHEAT_SEEDS) {
                 foundSeed = true;
                 break;
             }
@@ -715,7 +715,7 @@ describe(farming) {
         expect(plants[idx].stage == PLANT_STAGE_BARE);
         bool foundSeed = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_LENTIL_SEEDS) {
+            if (itemActive[i] && items[i].type == ITEM_LENTIL_SEEDS) {
                 foundSeed = true;
                 break;
             }
@@ -736,7 +736,7 @@ describe(farming) {
         expect(plants[idx].stage == PLANT_STAGE_BARE);
         bool foundSeed = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_FLAX_SEEDS) {
+            if (itemActive[i] && items[i].type == ITEM_FLAX_SEEDS) {
                 foundSeed = true;
                 break;
             }
@@ -827,7 +827,7 @@ describe(farming) {
             // Find the stack
             int curStack = -1;
             for (int i = 0; i < itemHighWaterMark; i++) {
-                if (items[i].active && items[i].type == ITEM_WHEAT_SEEDS &&
+                if (itemActive[i] && items[i].type == ITEM_WHEAT_SEEDS &&
                     items[i].stackCount > 1) {
                     curStack = i;
                     break;
@@ -836,8 +836,8 @@ describe(farming) {
             // If no multi-stack, find single seed
             if (curStack < 0) {
                 for (int i = 0; i < itemHighWaterMark; i++) {
-                    if (items[i].active && items[i].type == ITEM_WHEAT_SEEDS &&
-                        items[i].reservedBy == -1) {
+                    if (itemActive[i] && items[i].type == ITEM_WHEAT_SEEDS &&
+                        itemReservedBy[i] == -1) {
                         curStack = i;
                         break;
                     }
@@ -870,10 +870,10 @@ describe(farming) {
                 if (job->step == STEP_CARRYING && job->carryingItem >= 0) {
                     float gx = x * CELL_SIZE + CELL_SIZE * 0.5f;
                     float gy = 5 * CELL_SIZE + CELL_SIZE * 0.5f;
-                    m->x = gx;
-                    m->y = gy;
-                    items[job->carryingItem].x = gx;
-                    items[job->carryingItem].y = gy;
+                    moverPosX[0] = gx;
+                    moverPosY[0] = gy;
+                    itemPosX[job->carryingItem] = gx;
+                    itemPosY[job->carryingItem] = gy;
                 }
             }
 
@@ -883,7 +883,7 @@ describe(farming) {
 
             // After split+plant: original stack should have lost 1
             if (prevStack > 1) {
-                expect(items[curStack].active);
+                expect(itemActive[curStack]);
                 expect(items[curStack].stackCount == prevStack - 1);
             }
         }
@@ -893,7 +893,7 @@ describe(farming) {
         // Original stack should have 7 remaining (10 - 3)
         int remainingSeeds = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_WHEAT_SEEDS) {
+            if (itemActive[i] && items[i].type == ITEM_WHEAT_SEEDS) {
                 remainingSeeds += items[i].stackCount;
             }
         }
@@ -944,7 +944,7 @@ describe(farming) {
         job->step = STEP_PLANTING;
         job->progress = 0.0f;
         job->carryingItem = waterIdx;
-        items[waterIdx].state = ITEM_CARRIED;
+        itemState[waterIdx] = ITEM_CARRIED;
 
         // Fast-forward to completion
         JobRunResult r = JOBRUN_RUNNING;
@@ -957,7 +957,7 @@ describe(farming) {
         expect(GET_CELL_WETNESS(5, 5, 0) == WATER_POUR_WETNESS);
 
         // Water item should be consumed
-        expect(!items[waterIdx].active);
+        expect(!itemActive[waterIdx]);
     }
 
     // =========================================================================
@@ -993,7 +993,7 @@ describe(farming) {
         expect(job->targetMineX == 5);
         expect(job->targetMineY == 5);
         expect(job->targetMineZ == 1);
-        expect(items[waterIdx].reservedBy == 0);
+        expect(itemReservedBy[waterIdx] == 0);
     }
 
     // =========================================================================
@@ -1104,10 +1104,10 @@ describe(farming) {
         RebuildFarmWorkCache();
         int jobId = WorkGiver_WaterCrop(0);
         expect(jobId >= 0);
-        expect(items[waterIdx].reservedBy == 0);
+        expect(itemReservedBy[waterIdx] == 0);
 
         CancelJob(m, 0);
-        expect(items[waterIdx].reservedBy == -1);
+        expect(itemReservedBy[waterIdx] == -1);
         expect(m->currentJobId == -1);
     }
 
@@ -1221,7 +1221,7 @@ describe(farming) {
         // Water item in stockpile state
         int waterIdx = SpawnItem(3.5f * CELL_SIZE, 3.5f * CELL_SIZE, 1, ITEM_WATER);
         expect(waterIdx >= 0);
-        items[waterIdx].state = ITEM_IN_STOCKPILE;
+        itemState[waterIdx] = ITEM_IN_STOCKPILE;
 
         Mover* m = &movers[0];
         Point goal = {3, 3, 1};
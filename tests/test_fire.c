@@ -11,6 +11,8 @@
 #include <string.h>
 #include <math.h>
 
+bool SaveWorld(const char* filename);
+bool LoadWorld(const char* filename);
 
 // Global flag for verbose output in tests
 static bool test_verbose = false;
@@ -1092,6 +1094,73 @@ describe(fire_edge_cases) {
     }
 }
 
+// =============================================================================
+// Paged storage (fire and smoke only hold pages where something burns)
+// =============================================================================
+
+describe(fire_paged_storage) {
+    it("should allocate pages on write only") {
+        InitTestGrid(64, 64);
+        InitFire();
+        InitSmoke();
+
+        expect(fireLayer.allocatedCount == 0);
+        expect(GetFireLevel(40, 40, 0) == 0);
+        expect(FireCellAt(63, 63, 0)->fuel == 0);
+        expect(fireLayer.allocatedCount == 0);
+
+        SetFireLevel(40, 40, 0, 3);
+        SetFireLevel(41, 40, 0, 3);  // same 16x16 page
+        expect(fireLayer.allocatedCount == 1);
+        expect(GetFireLevel(40, 40, 0) == 3);
+        expect(GetFireLevel(39, 40, 0) == 0);
+
+        // Setting a level that's already there doesn't allocate
+        SetFireLevel(5, 5, 0, 0);
+        expect(fireLayer.allocatedCount == 1);
+    }
+
+    it("should free pages once they are back to default") {
+        InitTestGrid(64, 64);
+        InitFire();
+
+        SetFireLevel(40, 40, 0, 3);
+        SetFireLevel(2, 2, 0, 3);
+        expect(fireLayer.allocatedCount == 2);
+
+        SetFireLevel(40, 40, 0, 0);
+        ReclaimPagedLayer(&fireLayer, PAGED_RECLAIM_BUDGET);
+        expect(fireLayer.allocatedCount == 1);
+        expect(GetFireLevel(2, 2, 0) == 3);
+        expect(GetFireLevel(40, 40, 0) == 0);
+    }
+
+    it("should save and load only allocated pages") {
+        InitTestGrid(64, 64);
+        InitFire();
+        InitSmoke();
+
+        SetFireLevel(40, 40, 0, 4);
+        FireCellForWrite(40, 40, 0)->fuel = 9;
+        SetFireSource(3, 60, 0, true);
+        SetSmokeLevel(20, 20, 1, 5);
+        SaveWorld("/tmp/test_fire_paged_save.bin");
+
+        InitFire();
+        InitSmoke();
+        SetSmokeLevel(50, 50, 0, 2);  // dropped by the load
+        LoadWorld("/tmp/test_fire_paged_save.bin");
+
+        expect(fireLayer.allocatedCount == 2);
+        expect(GetFireLevel(40, 40, 0) == 4);
+        expect(FireCellAt(40, 40, 0)->fuel == 9);
+        expect(FireCellAt(3, 60, 0)->isSource);
+        expect(smokeLayer.allocatedCount == 1);
+        expect(GetSmokeLevel(20, 20, 1) == 5);
+        expect(GetSmokeLevel(50, 50, 0) == 0);
+    }
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -1121,6 +1190,7 @@ int main(int argc, char* argv[]) {
     // Additional tests
     test(smoke_dissipation);
     test(fire_edge_cases);
+    test(fire_paged_storage);
     
     return summary();
 }
@@ -38,9 +38,9 @@ describe(floordirt_initialization) {
             "........\n");
         InitFloorDirt();
 
-        floorDirtGrid[0][0][2] = 100;
-        floorDirtGrid[0][1][4] = 200;
-        floorDirtGrid[1][0][3] = 150;
+        SetFloorDirt(2, 0, 0, 100);
+        SetFloorDirt(4, 1, 0, 200);
+        SetFloorDirt(3, 0, 1, 150);
 
         expect(GetFloorDirt(2, 0, 0) == 100);
         expect(GetFloorDirt(4, 1, 0) == 200);
@@ -278,7 +278,7 @@ describe(floordirt_tracking) {
         grid[1][1][3] = CELL_AIR;
 
         // Set dirt close to max
-        floorDirtGrid[1][1][3] = 254;
+        SetFloorDirt(3, 1, 1, 254);
 
         MoverTrackDirt(0, 2, 1, 1);
         MoverTrackDirt(0, 3, 1, 1);
@@ -82,7 +82,7 @@ describe(fog_explored) {
     it("sandbox mode always returns explored") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SANDBOX;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         expect(IsExplored(5, 5, 0));
 
@@ -92,7 +92,7 @@ describe(fog_explored) {
     it("survival mode respects exploredGrid") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SURVIVAL;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         expect(!IsExplored(5, 5, 0));
 
@@ -121,7 +121,7 @@ describe(fog_hunt) {
     it("hunt skips animals in unexplored cells") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SURVIVAL;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         // Explore mover area but NOT animal area
         SetExplored(2, 2, 0);
@@ -142,7 +142,7 @@ describe(fog_hunt) {
     it("hunt finds animals in explored cells") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SURVIVAL;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         // Explore everything
         for (int x = 0; x < 10; x++)
@@ -170,7 +170,7 @@ describe(fog_mine) {
     it("mine designation in unexplored area not in cache") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SURVIVAL;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         // Place a wall at (7,5,0)
         grid[0][5][7] = CELL_WALL;
@@ -178,9 +178,9 @@ describe(fog_mine) {
         SetWallMaterial(7, 5, 0, MAT_GRANITE);
 
         // Create mine designation
-        designations[0][5][7].type = DESIGNATION_MINE;
-        designations[0][5][7].assignedMover = -1;
-        designations[0][5][7].unreachableCooldown = 0.0f;
+        DesignationForWrite(7, 5, 0)->type = DESIGNATION_MINE;
+        DesignationForWrite(7, 5, 0)->assignedMover = -1;
+        DesignationForWrite(7, 5, 0)->unreachableCooldown = 0.0f;
         activeDesignationCount = 1;
 
         SetupMoverAt(2, 2, 0);
@@ -200,7 +200,7 @@ describe(fog_mine) {
     it("mine designation in explored area gets assigned") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SURVIVAL;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         // Explore relevant areas
         for (int x = 0; x < 10; x++)
@@ -213,9 +213,9 @@ describe(fog_mine) {
         SetWallMaterial(7, 5, 0, MAT_GRANITE);
 
         // Create mine designation
-        designations[0][5][7].type = DESIGNATION_MINE;
-        designations[0][5][7].assignedMover = -1;
-        designations[0][5][7].unreachableCooldown = 0.0f;
+        DesignationForWrite(7, 5, 0)->type = DESIGNATION_MINE;
+        DesignationForWrite(7, 5, 0)->assignedMover = -1;
+        DesignationForWrite(7, 5, 0)->unreachableCooldown = 0.0f;
         activeDesignationCount = 1;
 
         SetupMoverAt(2, 2, 0);
@@ -240,15 +240,15 @@ describe(fog_explore_exception) {
     it("explore designation works in survival mode on unexplored cells") {
         SetupFogTestGrid();
         gameMode = GAME_MODE_SURVIVAL;
-        memset(exploredGrid, 0, sizeof(exploredGrid));
+        CLEAR_WORLD_LAYER(exploredGrid);
 
         // Explore mover area
         SetExplored(2, 2, 0);
 
         // Create explore designation at unexplored (5,5,0)
-        designations[0][5][5].type = DESIGNATION_EXPLORE;
-        designations[0][5][5].assignedMover = -1;
-        designations[0][5][5].unreachableCooldown = 0.0f;
+        DesignationForWrite(5, 5, 0)->type = DESIGNATION_EXPLORE;
+        DesignationForWrite(5, 5, 0)->assignedMover = -1;
+        DesignationForWrite(5, 5, 0)->unreachableCooldown = 0.0f;
         activeDesignationCount = 1;
 
         SetupMoverAt(2, 2, 0);
@@ -5,7 +5,10 @@
 #include "../src/world/cell_defs.h"
 #include "../src/world/material.h"
 #include "../src/simulation/groundwear.h"
+#include "../src/simulation/water.h"
 #include "../src/core/sim_manager.h"
+#include "../src/world/designations.h"
+#include "../src/entities/items.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -316,9 +319,8 @@ describe(wear_decay) {
         InitGroundWear();
         groundWearEnabled = true;
         
-        // Set initial wear (manually, so also set active cell counter)
-        wearGrid[0][0][2] = 100;
-        wearActiveCells = 1;
+        // Set initial wear
+        SetGroundWear(2, 0, 0, 100);
 
         // Set decay interval to fast for testing
         float originalInterval = wearRecoveryInterval;
@@ -349,9 +351,8 @@ describe(wear_decay) {
         wearRecoveryInterval = 0.04f;
         wearDecayRate = 10;
         
-        // Set initial wear (manually, so also set active cell counter)
-        wearGrid[0][0][2] = 100;
-        wearActiveCells = 1;
+        // Set initial wear
+        SetGroundWear(2, 0, 0, 100);
 
         // First few ticks: no decay (accumulator < interval)
         for (int i = 0; i < 3; i++) {
@@ -385,9 +386,8 @@ describe(wear_decay) {
         wearDecayRate = 10;
         wearRecoveryInterval = 0.004f;
 
-        // Set wear lower than decay rate (manually, so also set active cell counter)
-        wearGrid[0][0][2] = 5;
-        wearActiveCells = 1;
+        // Set wear lower than decay rate
+        SetGroundWear(2, 0, 0, 5);
 
         UpdateGroundWear();
 
@@ -413,11 +413,10 @@ describe(wear_decay) {
         InitGroundWear();
         groundWearEnabled = true;
         
-        // Set wear at different z-levels (manually, so also set active cell counter)
-        wearGrid[0][0][2] = 100;
-        wearGrid[1][0][2] = 100;
-        wearGrid[2][0][2] = 100;
-        wearActiveCells = 3;
+        // Set wear at different z-levels
+        SetGroundWear(2, 0, 0, 100);
+        SetGroundWear(2, 0, 1, 100);
+        SetGroundWear(2, 0, 2, 100);
 
         wearDecayRate = 10;
         wearRecoveryInterval = 0.004f;
@@ -888,6 +887,142 @@ describe(groundwear_edge_cases) {
 // Main
 // =============================================================================
 
+// =============================================================================
+// Per-chunk activity
+// =============================================================================
+
+// 32x16 dirt field at z=0 split into 8x8 chunks (4 x 2 chunks)
+static void SetupChunkedDirt(void) {
+    InitGridWithSizeAndChunkSize(32, 16, 8, 8);
+    for (int y = 0; y < gridHeight; y++) {
+        for (int x = 0; x < gridWidth; x++) {
+            grid[0][y][x] = CELL_WALL; SetWallMaterial(x, y, 0, MAT_DIRT); SetWallNatural(x, y, 0);
+        }
+    }
+    InitGroundWear();
+    groundWearEnabled = true;
+    saplingRegrowthEnabled = false;
+    wearActiveCells = 0;
+    waterActiveCells = 0;
+}
+
+describe(wear_chunk_activity) {
+    it("should count worn cells per chunk") {
+        SetupChunkedDirt();
+
+        TrampleGround(20, 3, 1);  // standing at z=1 on dirt at z=0, chunk (2,0)
+
+        expect(wearActiveCells == 1);
+        expect(chunkActiveCells[ACTIVITY_WEAR][0][0][2] == 1);
+        expect(ChunkHasActivity(ACTIVITY_WEAR, 0, 2, 0));
+        expect(!ChunkHasActivity(ACTIVITY_WEAR, 0, 0, 0));
+        expect(chunkActiveTotal[ACTIVITY_WEAR] == 1);
+
+        SetGroundWear(20, 3, 0, 0);
+        expect(wearActiveCells == 0);
+        expect(!ChunkHasActivity(ACTIVITY_WEAR, 0, 2, 0));
+    }
+
+    it("should spread a recovery sweep over ticks by chunk budget") {
+        SetupChunkedDirt();
+        seasonalAmplitude = 0;
+        wearDecayRate = 10;
+        wearRecoveryInterval = 0.004f;
+        int originalBudget = wearRecoveryChunkBudget;
+        wearRecoveryChunkBudget = 1;
+
+        SetGroundWear(10, 2, 0, 100);   // chunk (1,0)
+        SetGroundWear(27, 12, 0, 100);  // chunk (3,1)
+
+        UpdateGroundWear();
+        expect(GetGroundWear(10, 2, 0) == 90);
+        expect(GetGroundWear(27, 12, 0) == 100);
+
+        // Next tick finishes the sweep; unworn chunks in between are skipped
+        UpdateGroundWear();
+        expect(GetGroundWear(10, 2, 0) == 90);
+        expect(GetGroundWear(27, 12, 0) == 90);
+
+        wearRecoveryChunkBudget = originalBudget;
+        wearDecayRate = WEAR_DECAY_RATE_DEFAULT;
+    }
+
+    it("should dry wet chunks even without wear") {
+        SetupChunkedDirt();
+        SetGroundWear(2, 2, 0, 100);  // keeps the recovery pass running
+        SET_CELL_WETNESS(25, 10, 0, 3);
+        expect(ChunkHasActivity(ACTIVITY_WETNESS, 0, 3, 1));
+        wearRecoveryInterval = 0.004f;
+
+        for (int i = 0; i < 200; i++) UpdateGroundWear();
+
+        expect(GET_CELL_WETNESS(25, 10, 0) == 0);
+        expect(!ChunkHasActivity(ACTIVITY_WETNESS, 0, 3, 1));
+    }
+
+    it("should regrow reeds beside water across a chunk edge") {
+        SetupChunkedDirt();
+        ClearWater();
+        wearRecoveryInterval = 0.004f;
+        SetWaterLevel(16, 5, 1, 4);       // over dirt in chunk (2,0)
+        SET_CELL_WETNESS(16, 5, 0, 2);    // as the water's wetness sync leaves it
+        SetVegetation(15, 5, 0, VEG_NONE);  // bare dirt in chunk (1,0)
+
+        for (int i = 0; i < 10; i++) UpdateGroundWear();
+
+        expect(GetVegetation(15, 5, 0) == VEG_REEDS);
+        ClearWater();
+    }
+
+    it("should not sweep every chunk just because water exists") {
+        SetupChunkedDirt();
+        ClearWater();
+        seasonalAmplitude = 0;
+        wearDecayRate = 10;
+        wearRecoveryInterval = 0.004f;
+        int originalBudget = wearRecoveryChunkBudget;
+        wearRecoveryChunkBudget = 1;
+
+        // Water on stone leaves no wet soil, so only the worn chunk has work
+        SetWallMaterial(2, 2, 0, MAT_GRANITE);
+        SetWaterLevel(2, 2, 1, 4);
+        SetGroundWear(27, 12, 0, 100);    // chunk (3,1), last in sweep order
+
+        UpdateGroundWear();
+        expect(GetGroundWear(27, 12, 0) == 90);
+
+        wearRecoveryChunkBudget = originalBudget;
+        wearDecayRate = WEAR_DECAY_RATE_DEFAULT;
+        ClearWater();
+    }
+
+    it("should detect and correct per-chunk drift on validate") {
+        SetupChunkedDirt();
+        ValidateSimActivityCounts();
+        expect(ValidateSimActivityCounts());
+
+        wearGrid[0][9][9] = 100;  // bypasses SetGroundWear
+        expect(!ValidateSimActivityCounts());
+        expect(chunkActiveCells[ACTIVITY_WEAR][0][1][1] == 1);
+        expect(ChunkHasActivity(ACTIVITY_WEAR, 0, 1, 1));
+        expect(ValidateSimActivityCounts());
+    }
+
+    it("should stop counting a worn cell once it is mined out") {
+        SetupChunkedDirt();
+        ClearItems();
+        SetGroundWear(10, 2, 0, 100);  // chunk (1,0)
+        expect(chunkActiveCells[ACTIVITY_WEAR][0][0][1] == 1);
+
+        CompleteMineDesignation(10, 2, 0);
+
+        expect(wearActiveCells == 0);
+        expect(chunkActiveCells[ACTIVITY_WEAR][0][0][1] == 0);
+        expect(!ChunkHasActivity(ACTIVITY_WEAR, 0, 1, 0));
+        expect(ValidateSimActivityCounts());
+    }
+}
+
 int main(int argc, char* argv[]) {
     test_verbose = c89spec_parse_args(argc, argv);
     if (!test_verbose) SetTraceLogLevel(LOG_NONE);
@@ -900,6 +1035,7 @@ int main(int argc, char* argv[]) {
     test(groundwear_full_cycle);
     test(groundwear_vegetation_init);
     test(groundwear_edge_cases);
+    test(wear_chunk_activity);
     
     return summary();
 }
@@ -158,9 +158,10 @@ static void SetupWalledGrid(void) {
 
 // Check if mover position is valid (not inside a wall)
 static bool IsMoverPositionValid(Mover* m) {
-    int cellX = (int)(m->x / CELL_SIZE);
-    int cellY = (int)(m->y / CELL_SIZE);
-    int cellZ = (int)m->z;
+    int moverIdx = (int)(m - movers);
+    int cellX = (int)(moverPosX[moverIdx] / CELL_SIZE);
+    int cellY = (int)(moverPosY[moverIdx] / CELL_SIZE);
+    int cellZ = (int)moverPosZ[moverIdx];
     
     // Use the proper DF-style walkability check
     return IsCellWalkableAt(cellZ, cellY, cellX);
@@ -246,7 +247,7 @@ describe(high_speed_movement) {
         RunGameSeconds(5.0f);
         
         // Mover should have reached goal and deactivated
-        expect(m->active == false);
+        expect(moverActive[0] == false);
         expect(IsMoverPositionValid(m));
         
         endlessMoverMode = true;
@@ -450,7 +451,7 @@ describe(extreme_speed_edge_cases) {
         
         gameSpeed = 1.0f;
         RunGameSeconds(0.5f);
-        float posAfterMove = m->x;
+        float posAfterMove = moverPosX[0];
         
         // Pause
         gameSpeed = 0.0f;
@@ -463,7 +464,7 @@ describe(extreme_speed_edge_cases) {
         
         // Time and position should not have changed
         expect(gameTime == timeBefore);
-        expect(m->x == posAfterMove);
+        expect(moverPosX[0] == posAfterMove);
         
         // Resume at high speed
         gameSpeed = 10.0f;
@@ -477,7 +478,7 @@ describe(extreme_speed_edge_cases) {
         
         // Mover should have moved (or reached goal)
         // Either it moved further, or it deactivated (reached goal)
-        expect(m->x > posAfterMove || m->active == false);
+        expect(moverPosX[0] > posAfterMove || moverActive[0] == false);
         
         endlessMoverMode = true;
     }
@@ -106,7 +106,7 @@ describe(hunger_drain) {
         SetupClean();
         int mi = SetupMover(1, 1);
         movers[mi].hunger = 1.0f;
-        movers[mi].active = false;
+        moverActive[mi] = false;
 
         for (int i = 0; i < 10000; i++) {
             NeedsTick();
@@ -356,7 +356,7 @@ describe(plant_harvest) {
         // Find the spawned berry item
         bool foundBerries = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_BERRIES) {
+            if (itemActive[i] && items[i].type == ITEM_BERRIES) {
                 foundBerries = true;
                 break;
             }
@@ -376,7 +376,7 @@ describe(plant_harvest) {
         // No berries spawned
         bool foundBerries = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_BERRIES) {
+            if (itemActive[i] && items[i].type == ITEM_BERRIES) {
                 foundBerries = true;
                 break;
             }
@@ -454,7 +454,7 @@ describe(harvest_designation) {
         // Berries should have spawned
         bool foundBerries = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_BERRIES) {
+            if (itemActive[i] && items[i].type == ITEM_BERRIES) {
                 foundBerries = true;
                 break;
             }
@@ -545,7 +545,7 @@ describe(eating_food_search) {
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                5 * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_BERRIES);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         ProcessFreetimeNeeds();
 
@@ -565,13 +565,13 @@ describe(eating_food_search) {
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                5 * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_BERRIES);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         ProcessFreetimeNeeds();
 
         expect(movers[mi].freetimeState == FREETIME_SEEKING_FOOD);
         expect(movers[mi].needTarget == itemIdx);
-        expect(items[itemIdx].reservedBy == mi);
+        expect(itemReservedBy[itemIdx] == mi);
     }
 
     it("cooldown prevents repeated searches") {
@@ -605,7 +605,7 @@ describe(eating_food_competition) {
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                5 * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_BERRIES);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         ProcessFreetimeNeeds();
 
@@ -617,10 +617,10 @@ describe(eating_food_competition) {
         expect(m1HasFood != m2HasFood);
 
         if (m1HasFood) {
-            expect(items[itemIdx].reservedBy == m1);
+            expect(itemReservedBy[itemIdx] == m1);
             expect(movers[m2].needSearchCooldown > 0.0f);
         } else {
-            expect(items[itemIdx].reservedBy == m2);
+            expect(itemReservedBy[itemIdx] == m2);
             expect(movers[m1].needSearchCooldown > 0.0f);
         }
     }
@@ -636,7 +636,7 @@ describe(eating_consumption) {
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                5 * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_BERRIES);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         movers[mi].hunger = 0.2f;
         movers[mi].currentJobId = -1;
@@ -669,7 +669,7 @@ describe(eating_consumption) {
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                5 * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_BERRIES);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         movers[mi].hunger = 0.1f;
         movers[mi].currentJobId = -1;
@@ -698,7 +698,7 @@ describe(eating_consumption) {
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                5 * CELL_SIZE + CELL_SIZE * 0.5f, 1.0f, ITEM_BERRIES);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         movers[mi].hunger = 0.0f; // Force hunger below threshold
         movers[mi].currentJobId = -1;
@@ -1009,7 +1009,7 @@ describe(drying_rack_berries) {
         // Check output: should be 2 units of ITEM_DRIED_BERRIES (1 item with stackCount=2)
         int driedCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_DRIED_BERRIES) {
+            if (itemActive[i] && items[i].type == ITEM_DRIED_BERRIES) {
                 driedCount += items[i].stackCount;
             }
         }
@@ -1032,7 +1032,7 @@ describe(starvation_survival) {
             NeedsTick();
         }
 
-        expect(movers[mi].active == true);
+        expect(moverActive[mi] == true);
         expect(movers[mi].hunger == 0.0f);
     }
 }
@@ -42,7 +42,7 @@ static int SetupAnimalAt(float x, float y, int z, AnimalType type) {
 static int CountItemsOfType(ItemType type) {
     int count = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type) count++;
+        if (itemActive[i] && items[i].type == type) count++;
     }
     return count;
 }
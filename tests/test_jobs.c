@@ -11,17 +11,27 @@
 #include "../src/entities/item_defs.h"
 #include "../src/entities/jobs.h"
 #include "../src/entities/stockpiles.h"
+#include "../src/entities/containers.h"
+#include "../src/entities/item_renumber.h"
+#include "../src/entities/item_ledger.h"
 #include "../src/entities/workshops.h"
+#include "../src/entities/furniture.h"
 #include "../src/world/designations.h"
+#include "../src/world/cell_edits.h"
 #include "../src/simulation/trees.h"
 #include "../src/simulation/balance.h"
 #include "../src/core/time.h"
+#include "../src/core/state_audit.h"
+#include "../src/entities/trains.h"
+#include "../src/core/save_migrations.h"
 
 #include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
 #include <math.h>
 
 // Helper: item was successfully stored (either merged into a stack and deleted, or placed as-is)
-#define ItemWasStored(idx) (!items[idx].active || items[idx].state == ITEM_IN_STOCKPILE)
+#define ItemWasStored(idx) (!itemActive[idx] || itemState[idx] == ITEM_IN_STOCKPILE)
 
 // From core/saveload.c
 void RebuildPostLoadState(void);
@@ -393,11 +403,11 @@ describe(pickup_behavior) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should be in stockpile
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect(MoverIsIdle(m));
         expect(MoverGetCarryingItem(m) == -1);
     }
@@ -536,7 +546,7 @@ describe(post_job_behavior) {
             JobsTick();
             storedCount = 0;
             for (int j = 0; j < MAX_ITEMS; j++) {
-                if (IsItemActive(j) && items[j].state == ITEM_IN_STOCKPILE) storedCount++;
+                if (IsItemActive(j) && itemState[j] == ITEM_IN_STOCKPILE) storedCount++;
             }
             if (storedCount == 1) break;
         }
@@ -595,10 +605,10 @@ describe(post_job_behavior) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect(MoverIsIdle(m));
         
         // Run a few more ticks - mover should get a new path (wandering)
@@ -729,11 +739,11 @@ describe(haul_happy_path) {
             JobsTick();
             
             // Check if item is in stockpile
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should be in stockpile at (2,2)
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect((int)(GetItemX(itemIdx) / CELL_SIZE) == 2);
         expect((int)(GetItemY(itemIdx) / CELL_SIZE) == 2);
         
@@ -789,17 +799,17 @@ describe(haul_happy_path) {
             JobsTick();
             
             // Check if both items are stored
-            if (items[redIdx].state == ITEM_IN_STOCKPILE && 
-                items[greenIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[redIdx] == ITEM_IN_STOCKPILE && 
+                itemState[greenIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Red should be in stockpile A (2,2)
-        expect(items[redIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[redIdx] == ITEM_IN_STOCKPILE);
         expect((int)(GetItemX(redIdx) / CELL_SIZE) == 2);
         expect((int)(GetItemY(redIdx) / CELL_SIZE) == 2);
         
         // Green should be in stockpile B (2,3)
-        expect(items[greenIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[greenIdx] == ITEM_IN_STOCKPILE);
         expect((int)(GetItemX(greenIdx) / CELL_SIZE) == 2);
         expect((int)(GetItemY(greenIdx) / CELL_SIZE) == 3);
     }
@@ -857,8 +867,8 @@ describe(stockpile_capacity) {
         
         // Other item should still be on ground
         int groundCount = 0;
-        if (items[item1].active && items[item1].state == ITEM_ON_GROUND) groundCount++;
-        if (items[item2].active && items[item2].state == ITEM_ON_GROUND) groundCount++;
+        if (itemActive[item1] && itemState[item1] == ITEM_ON_GROUND) groundCount++;
+        if (itemActive[item2] && itemState[item2] == ITEM_ON_GROUND) groundCount++;
         expect(groundCount == 1);
         
         // Slot should now be full (10/10)
@@ -1044,7 +1054,7 @@ describe(haul_cancellation) {
         
         expect(MoverIsCarrying(m));
         expect(MoverGetCarryingItem(m) == itemIdx);
-        expect(items[itemIdx].state == ITEM_CARRIED);
+        expect(itemState[itemIdx] == ITEM_CARRIED);
         
         // Delete stockpile while carrying
         DeleteStockpile(spIdx);
@@ -1061,7 +1071,7 @@ describe(haul_cancellation) {
         expect(MoverGetCarryingItem(m) == -1);
         
         // Item should be back on ground (not vanished, not stuck as "carried")
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
         expect(IsItemActive(itemIdx) == true);
     }
 }
@@ -1113,11 +1123,11 @@ describe(filter_change_mid_haul) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[greenItem].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[greenItem] == ITEM_IN_STOCKPILE) break;
         }
         
         // Green item should be in RGB stockpile
-        expect(items[greenItem].state == ITEM_IN_STOCKPILE);
+        expect(itemState[greenItem] == ITEM_IN_STOCKPILE);
         int itemTileX = (int)(GetItemX(greenItem) / CELL_SIZE);
         int itemTileY = (int)(GetItemY(greenItem) / CELL_SIZE);
         expect(itemTileX == 5);
@@ -1141,7 +1151,7 @@ describe(filter_change_mid_haul) {
         }
         
         // Green item should now be in green stockpile
-        expect(items[greenItem].state == ITEM_IN_STOCKPILE);
+        expect(itemState[greenItem] == ITEM_IN_STOCKPILE);
         itemTileX = (int)(GetItemX(greenItem) / CELL_SIZE);
         itemTileY = (int)(GetItemY(greenItem) / CELL_SIZE);
         expect(itemTileX == 8);
@@ -1207,7 +1217,7 @@ describe(filter_change_mid_haul) {
         expect(MoverGetCarryingItem(m) == -1);
         
         // Item should be back on ground
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
         expect(IsItemActive(itemIdx) == true);
     }
 }
@@ -1284,7 +1294,7 @@ describe(dynamic_obstacles) {
         
         // Also verify the item wasn't corrupted
         expect(IsItemActive(itemIdx) == true);
-        expect(items[itemIdx].state == ITEM_ON_GROUND || items[itemIdx].state == ITEM_CARRIED);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND || itemState[itemIdx] == ITEM_CARRIED);
     }
 
     it("should cancel job immediately when wall placed on item") {
@@ -1597,7 +1607,7 @@ describe(unreachable_item_cooldown) {
         expect(MoverIsIdle(m));
         
         // Item should still be on ground
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
         
         // Should NOT have tried to assign this item many times
         // With cooldown, should be at most a few attempts (initial + maybe 1 retry)
@@ -1605,7 +1615,7 @@ describe(unreachable_item_cooldown) {
         expect(assignAttempts < 10);
         
         // Item should have a cooldown set
-        expect(items[itemIdx].unreachableCooldown > 0.0f);
+        expect(itemUnreachableCooldown[itemIdx] > 0.0f);
     }
     
     it("should retry unreachable item after cooldown expires") {
@@ -1644,7 +1654,7 @@ describe(unreachable_item_cooldown) {
         JobsTick();
         
         // Manually set a short cooldown for testing (simulating time passed)
-        items[itemIdx].unreachableCooldown = 0.1f;
+        itemUnreachableCooldown[itemIdx] = 0.1f;
         
         // Run a few more ticks to expire the cooldown
         for (int i = 0; i < 10; i++) {
@@ -1660,7 +1670,7 @@ describe(unreachable_item_cooldown) {
         MarkChunkDirty(2, 3, 0);
         
         // Set cooldown to 0 to allow retry
-        items[itemIdx].unreachableCooldown = 0.0f;
+        itemUnreachableCooldown[itemIdx] = 0.0f;
         
         // Run simulation - item should now be hauled
         for (int i = 0; i < 1000; i++) {
@@ -1668,10 +1678,10 @@ describe(unreachable_item_cooldown) {
             ItemsTick(TICK_DT);
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
     }
 }
 
@@ -1723,8 +1733,8 @@ describe(gather_zones) {
         }
         
         // Only the inside item should be hauled
-        expect(items[insideIdx].state == ITEM_IN_STOCKPILE);
-        expect(items[outsideIdx].state == ITEM_ON_GROUND);
+        expect(itemState[insideIdx] == ITEM_IN_STOCKPILE);
+        expect(itemState[outsideIdx] == ITEM_ON_GROUND);
     }
     
     it("should haul all items when no gather zones exist") {
@@ -1859,10 +1869,10 @@ describe(stacking_merging) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         
         // Green should go to the second slot (6,5), not merge with red
         int redCount = GetStockpileSlotCount(spIdx, 5, 5);
@@ -1908,10 +1918,10 @@ describe(stacking_merging) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         
         // Should go to second slot since first is full
         int slot1Count = GetStockpileSlotCount(spIdx, 5, 5);
@@ -2072,13 +2082,13 @@ describe(stacking_merging) {
                 if (job && job->active && job->type == JOBTYPE_HAUL) {
                     // Check if it's a consolidation (source and dest in same stockpile)
                     int srcSp = -1, dstSp = -1;
-                    if (job->targetItem >= 0 && items[job->targetItem].active) {
-                        IsPositionInStockpile(items[job->targetItem].x, items[job->targetItem].y, 
-                                             (int)items[job->targetItem].z, &srcSp);
+                    if (job->targetItem >= 0 && itemActive[job->targetItem]) {
+                        IsPositionInStockpile(itemPosX[job->targetItem], itemPosY[job->targetItem], 
+                                             (int)itemPosZ[job->targetItem], &srcSp);
                     }
                     IsPositionInStockpile(job->targetSlotX * CELL_SIZE + CELL_SIZE * 0.5f,
                                          job->targetSlotY * CELL_SIZE + CELL_SIZE * 0.5f,
-                                         (int)m->z, &dstSp);
+                                         (int)moverPosZ[0], &dstSp);
                     if (srcSp == dstSp && srcSp == spIdx) {
                         consolidationJobCount++;
                     }
@@ -2134,13 +2144,13 @@ describe(stockpile_priority) {
         
         // Place item directly in the low-priority stockpile
         int itemIdx = SpawnItem(2 * CELL_SIZE + CELL_SIZE * 0.5f, 2 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         Stockpile* spL = &stockpiles[spLow];
         spL->slotCounts[0] = 1;
         spL->slotTypes[0] = ITEM_RED;
         spL->slotMaterials[0] = items[itemIdx].material;
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         int itemTileX = (int)(GetItemX(itemIdx) / CELL_SIZE);
         int itemTileY = (int)(GetItemY(itemIdx) / CELL_SIZE);
         expect(itemTileX == 2);
@@ -2202,10 +2212,10 @@ describe(stockpile_priority) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         int itemTileX = (int)(GetItemX(itemIdx) / CELL_SIZE);
         int itemTileY = (int)(GetItemY(itemIdx) / CELL_SIZE);
         
@@ -2268,10 +2278,10 @@ describe(stockpile_priority) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         
         // Record position
         int origX = (int)(GetItemX(itemIdx) / CELL_SIZE);
@@ -2353,7 +2363,7 @@ describe(stockpile_max_stack_size) {
         m->repathCooldown = 0;
         
         // Ensure mover is active and has no path (trigger the endless mover branch)
-        m->active = true;
+        moverActive[0] = true;
         expect(GetMoverPathLength(0) == 0);
         expect(GetMoverPathIndex(0) < 0);
         
@@ -2401,13 +2411,13 @@ describe(stockpile_max_stack_size) {
             ItemsTick(TICK_DT);
             AssignJobs();
             JobsTick();
-            if (items[item].state == ITEM_IN_STOCKPILE) break;
-            if (items[item].state == ITEM_ON_GROUND && MoverIsIdle(m)) break;
+            if (itemState[item] == ITEM_IN_STOCKPILE) break;
+            if (itemState[item] == ITEM_ON_GROUND && MoverIsIdle(m)) break;
         }
         
         // Item should be either in stockpile or dropped on ground (not carried aimlessly)
-        bool delivered = items[item].state == ITEM_IN_STOCKPILE;
-        bool dropped = items[item].state == ITEM_ON_GROUND && MoverGetCarryingItem(m) == -1;
+        bool delivered = itemState[item] == ITEM_IN_STOCKPILE;
+        bool dropped = itemState[item] == ITEM_ON_GROUND && MoverGetCarryingItem(m) == -1;
         expect(delivered || dropped);
         
         endlessMoverMode = oldEndlessMode;
@@ -2476,11 +2486,11 @@ describe(stockpile_max_stack_size) {
             ItemsTick(TICK_DT);
             AssignJobs();
             JobsTick();
-            if (items[item].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[item] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should be in stockpile
-        expect(items[item].state == ITEM_IN_STOCKPILE);
+        expect(itemState[item] == ITEM_IN_STOCKPILE);
         expect(MoverIsIdle(m));
         expect(MoverGetCarryingItem(m) == -1);
     }
@@ -2582,7 +2592,7 @@ describe(stockpile_max_stack_size) {
         }
         
         // Item should still be on ground (no room in stockpile)
-        expect(items[item].state == ITEM_ON_GROUND);
+        expect(itemState[item] == ITEM_ON_GROUND);
         expect(MoverIsIdle(m));
     }
     
@@ -2658,7 +2668,7 @@ describe(stockpile_max_stack_size) {
         float slotY = (2 + 0.5f) * CELL_SIZE;
         for (int i = 0; i < 5; i++) {
             itemIds[i] = SpawnItem(slotX, slotY, 0.0f, ITEM_RED);
-            items[itemIds[i]].state = ITEM_IN_STOCKPILE;
+            itemState[itemIds[i]] = ITEM_IN_STOCKPILE;
         }
         
         // Reduce max stack size to 2 - items should stay (overfull allowed)
@@ -2667,7 +2677,7 @@ describe(stockpile_max_stack_size) {
         // All items should still be in stockpile (no ejection)
         int inStockpile = 0;
         for (int i = 0; i < 5; i++) {
-            if (items[itemIds[i]].state == ITEM_IN_STOCKPILE) inStockpile++;
+            if (itemState[itemIds[i]] == ITEM_IN_STOCKPILE) inStockpile++;
         }
         
         expect(inStockpile == 5);   // all items remain
@@ -2705,8 +2715,8 @@ describe(stockpile_max_stack_size) {
         Stockpile* spPtr = &stockpiles[sp];
         int repIdx = spPtr->slots[0];
         expect(repIdx >= 0);
-        expect(items[repIdx].active);
-        expect(items[repIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemActive[repIdx]);
+        expect(itemState[repIdx] == ITEM_IN_STOCKPILE);
         expect(items[repIdx].stackCount == 3);
     }
 }
@@ -2826,11 +2836,11 @@ describe(stockpile_ground_item_blocking) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should now be IN_STOCKPILE (not ON_GROUND)
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         
         // Item should still be at same tile
         expect((int)(GetItemX(itemIdx) / CELL_SIZE) == 5);
@@ -2884,11 +2894,11 @@ describe(stockpile_ground_item_blocking) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should be in the GREEN stockpile
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect((int)(GetItemX(itemIdx) / CELL_SIZE) == 8);
         expect((int)(GetItemY(itemIdx) / CELL_SIZE) == 8);
     }
@@ -2937,7 +2947,7 @@ describe(stockpile_ground_item_blocking) {
         }
         
         // Item should be ON_GROUND but NOT on the stockpile tile anymore
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
         expect(IsItemActive(itemIdx) == true);
         
         // Item should NOT be on the stockpile (safe-dropped outside)
@@ -3043,11 +3053,11 @@ describe(stockpile_ground_item_blocking) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should be absorbed into stockpile A (same tile), not hauled to B
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect((int)(GetItemX(itemIdx) / CELL_SIZE) == 5);
         expect((int)(GetItemY(itemIdx) / CELL_SIZE) == 5);
     }
@@ -3206,11 +3216,11 @@ describe(clear_job_state) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_ON_GROUND && MoverIsIdle(m)) break;
+            if (itemState[itemIdx] == ITEM_ON_GROUND && MoverIsIdle(m)) break;
         }
         
         // Item should be on ground
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
         expect(IsItemActive(itemIdx) == true);
         
         // Item should NOT be on the stockpile anymore
@@ -3350,7 +3360,7 @@ describe(item_spatial_grid) {
         float itemX = 5 * CELL_SIZE + CELL_SIZE * 0.5f;
         float itemY = 3 * CELL_SIZE + CELL_SIZE * 0.5f;
         int itemIdx = SpawnItem(itemX, itemY, 0.0f, ITEM_RED);
-        items[itemIdx].state = ITEM_CARRIED;
+        itemState[itemIdx] = ITEM_CARRIED;
         
         BuildItemSpatialGrid();
         
@@ -3374,7 +3384,7 @@ describe(item_spatial_grid) {
         float itemX = 5 * CELL_SIZE + CELL_SIZE * 0.5f;
         float itemY = 3 * CELL_SIZE + CELL_SIZE * 0.5f;
         int itemIdx = SpawnItem(itemX, itemY, 0.0f, ITEM_RED);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         
         BuildItemSpatialGrid();
         
@@ -3452,10 +3462,10 @@ describe(item_spatial_grid) {
         SpawnItem(3 * CELL_SIZE, 3 * CELL_SIZE, 0.0f, ITEM_BLUE);
         
         int carried = SpawnItem(4 * CELL_SIZE, 4 * CELL_SIZE, 0.0f, ITEM_RED);
-        items[carried].state = ITEM_CARRIED;
+        itemState[carried] = ITEM_CARRIED;
         
         int stockpiled = SpawnItem(5 * CELL_SIZE, 4 * CELL_SIZE, 0.0f, ITEM_RED);
-        items[stockpiled].state = ITEM_IN_STOCKPILE;
+        itemState[stockpiled] = ITEM_IN_STOCKPILE;
         
         BuildItemSpatialGrid();
         
@@ -3475,6 +3485,424 @@ describe(item_spatial_grid) {
  * - Stockpile auto-deletion when all cells removed
  */
 
+describe(item_renumbering) {
+    it("should pack items into cell order and keep stockpile and container links") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        ClearMovers();
+        ClearItems();
+        ClearStockpiles();
+
+        // Spawn in reverse cell order, then punch holes in the pool
+        int spawned[64];
+        int n = 0;
+        for (int y = 7; y >= 0; y--) {
+            for (int x = 15; x >= 0; x -= 2) {
+                spawned[n++] = SpawnItem(x * CELL_SIZE + CELL_SIZE * 0.5f, y * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_ROCK);
+            }
+        }
+        for (int i = 0; i < n; i += 3) DeleteItem(spawned[i]);
+
+        // Stored item in a stockpile slot
+        int spIdx = CreateStockpile(1, 1, 0, 2, 1);
+        SetStockpileFilter(spIdx, ITEM_RED, true);
+        int stored = SpawnItem(2 * CELL_SIZE + CELL_SIZE * 0.5f, 1 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
+        PlaceItemInStockpile(spIdx, 2, 1, stored);
+
+        // Berries inside a basket
+        int basket = SpawnItem(12 * CELL_SIZE + CELL_SIZE * 0.5f, 6 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_BASKET);
+        int berries = SpawnItem(0.0f, 0.0f, 0.0f, ITEM_BERRIES);
+        expect(CanPutItemInContainer(berries, basket));
+        PutItemInContainer(berries, basket);
+
+        // A mover holding a tool
+        Mover* m = &movers[0];
+        Point goal = {0, 0, 0};
+        InitMover(m, CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+        moverCount = 1;
+        int tool = SpawnItem(CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, ITEM_STONE_AXE);
+        itemState[tool] = ITEM_CARRIED;
+        m->equippedTool = tool;
+
+        int activeBefore = itemCount;
+        expect(RenumberItemsByCell());
+        expect(itemHighWaterMark == activeBefore);
+        expect(itemCount == activeBefore);
+
+        // Dense, sorted by z then Morton code of the cell
+        uint64_t prevKey = 0;
+        for (int i = 0; i < itemHighWaterMark; i++) {
+            expect(itemActive[i]);
+            int cx = (int)(itemPosX[i] / CELL_SIZE), cy = (int)(itemPosY[i] / CELL_SIZE);
+            uint64_t key = 0;
+            for (int b = 0; b < 16; b++) {
+                key |= (uint64_t)((cx >> b) & 1) << (2 * b);
+                key |= (uint64_t)((cy >> b) & 1) << (2 * b + 1);
+            }
+            expect(key >= prevKey);
+            prevKey = key;
+        }
+
+        // References followed their items
+        int newStored = itemRenumberMap[stored];
+        int newBasket = itemRenumberMap[basket];
+        int newBerries = itemRenumberMap[berries];
+        int newTool = itemRenumberMap[tool];
+        expect(stockpiles[spIdx].slots[1] == newStored);
+        expect(items[newStored].type == ITEM_RED && itemState[newStored] == ITEM_IN_STOCKPILE);
+        expect(items[newBerries].containedIn == newBasket);
+        expect(items[newBasket].type == ITEM_BASKET && items[newBasket].contentCount == 1);
+        expect(m->equippedTool == newTool && items[newTool].type == ITEM_STONE_AXE);
+        expect(itemRenumberMap[spawned[63]] == -1);  // deleted before the pass, slot not reused
+
+        expect(AuditItemStockpileConsistency(false) == 0);
+        expect(AuditItemReservations(false) == 0);
+        expect(FindGroundItemAtTile(15, 6, 0) >= 0);
+        expect(items[FindGroundItemAtTile(15, 6, 0)].type == ITEM_ROCK);
+    }
+
+    it("should keep in-flight haul jobs working when renumbered every few ticks") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        ClearMovers();
+        ClearItems();
+        ClearStockpiles();
+        ClearJobs();
+
+        for (int i = 0; i < 3; i++) {
+            Point goal = {i, 0, 0};
+            InitMover(&movers[i], i * CELL_SIZE + CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+        }
+        moverCount = 3;
+
+        // Filler first so the haul targets start at high indices
+        for (int i = 0; i < 40; i++) {
+            SpawnItem((i % 16) * CELL_SIZE + CELL_SIZE * 0.5f, 7 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_ROCK);
+        }
+        for (int i = 0; i < 40; i += 2) DeleteItem(i);
+        for (int i = 0; i < 6; i++) {
+            SpawnItem((14 - i) * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
+        }
+
+        int spIdx = CreateStockpile(1, 2, 0, 6, 1);
+        SetStockpileFilter(spIdx, ITEM_RED, true);
+        SetStockpileMaxStackSize(spIdx, 1);
+
+        itemRenumberInterval = 5;
+        int passesBefore = itemRenumberCount;
+        int storedReds = 0;
+        for (int tick = 0; tick < 3000 && storedReds < 6; tick++) {
+            Tick();
+            AssignJobs();
+            JobsTick();
+            storedReds = 0;
+            for (int i = 0; i < itemHighWaterMark; i++) {
+                if (itemActive[i] && items[i].type == ITEM_RED && itemState[i] == ITEM_IN_STOCKPILE) storedReds++;
+            }
+        }
+        itemRenumberInterval = 0;
+
+        expect(storedReds == 6);
+        expect(itemRenumberCount > passesBefore);
+        expect(AuditItemStockpileConsistency(false) == 0);
+        expect(AuditItemReservations(false) == 0);
+        expect(AuditMoverJobConsistency(false) == 0);
+    }
+
+    it("should skip the pass when a reference points at a deleted item") {
+        InitTestGridFromAscii(
+            "........\n"
+            "........\n");
+
+        ClearMovers();
+        ClearItems();
+
+        int a = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, ITEM_ROCK);
+        int b = SpawnItem(1 * CELL_SIZE + CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, ITEM_ROCK);
+        Point goal = {0, 0, 0};
+        InitMover(&movers[0], CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+        moverCount = 1;
+        movers[0].equippedTool = 7;  // never spawned
+
+        int skippedBefore = itemRenumberSkipped;
+        expect(!RenumberItemsByCell());
+        expect(itemRenumberSkipped == skippedBefore + 1);
+        expect(itemPosX[a] > itemPosX[b]);  // untouched
+        expect(movers[0].equippedTool == 7);
+    }
+}
+
+describe(mover_renumbering) {
+    it("should pack movers into cell order and carry paths, references and handles") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        ClearMovers();
+        ClearItems();
+        ClearJobs();
+        ClearFurniture();
+
+        // Spawn in reverse cell order, then retire every third mover
+        int n = 0;
+        for (int y = 7; y >= 0; y -= 2) {
+            for (int x = 15; x >= 0; x -= 3) {
+                Point goal = {0, 0, 0};
+                InitMover(&movers[n], x * CELL_SIZE + CELL_SIZE * 0.5f, y * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+                movers[n].appearanceSeed = 1000 + n;
+                n++;
+            }
+        }
+        moverCount = n;
+        for (int i = 0; i < n; i += 3) moverActive[i] = false;
+
+        // Mover 1 has a path, reserves an item and sits in a chair
+        Point path[3] = {{0, 0, 0}, {8, 0, 0}, {12, 3, 0}};
+        moverPathLength[1] = 3;
+        moverPathIndex[1] = 2;
+        for (int k = 0; k < 3; k++) moverPaths[1][k] = path[k];
+        int rock = SpawnItem(3 * CELL_SIZE + CELL_SIZE * 0.5f, 3 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_ROCK);
+        itemReservedBy[rock] = 1;
+        int chair = SpawnFurniture(4, 4, 0, FURNITURE_CHAIR, MAT_OAK);
+        furniture[chair].occupant = 1;
+        int handle = MoverHandleFromIndex(1);
+        int activeBefore = CountActiveMovers();
+
+        expect(RenumberMoversByCell());
+        expect(moverCount == activeBefore);
+
+        // Dense, sorted by z then Morton code of the cell
+        uint64_t prevKey = 0;
+        for (int i = 0; i < moverCount; i++) {
+            expect(moverActive[i]);
+            int cx = (int)(moverPosX[i] / CELL_SIZE), cy = (int)(moverPosY[i] / CELL_SIZE);
+            uint64_t key = 0;
+            for (int b = 0; b < 16; b++) {
+                key |= (uint64_t)((cx >> b) & 1) << (2 * b);
+                key |= (uint64_t)((cy >> b) & 1) << (2 * b + 1);
+            }
+            expect(key >= prevKey);
+            prevKey = key;
+        }
+
+        int now = moverRenumberMap[1];
+        expect(now >= 0 && movers[now].appearanceSeed == 1001);
+        expect(moverRenumberMap[0] == -1);
+        expect(moverPathLength[now] == 3 && moverPaths[now][1].x == 8 && moverPaths[now][2].y == 3);
+        expect(itemReservedBy[rock] == now);
+        expect(furniture[chair].occupant == now);
+        expect(MoverIndexFromHandle(handle) == now);
+
+        // A second pass composes with the first; handles still resolve
+        moverPosX[now] = 15 * CELL_SIZE + CELL_SIZE * 0.5f;
+        moverPosY[now] = 7 * CELL_SIZE + CELL_SIZE * 0.5f;
+        expect(RenumberMoversByCell());
+        expect(moverRenumberMap[now] == moverCount - 1);
+        expect(MoverIndexFromHandle(handle) == moverCount - 1);
+        expect(movers[MoverIndexFromHandle(handle)].appearanceSeed == 1001);
+        for (int i = 0; i < moverCount; i++) {
+            expect(MoverIndexFromHandle(MoverHandleFromIndex(i)) == i);
+        }
+    }
+
+    it("should keep in-flight haul jobs working when renumbered every few ticks") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        ClearMovers();
+        ClearItems();
+        ClearStockpiles();
+        ClearJobs();
+
+        // Haulers spawned far corner first, with retired slots between them
+        for (int i = 0; i < 6; i++) {
+            Point goal = {15 - i, 7, 0};
+            InitMover(&movers[i], (15 - i * 2) * CELL_SIZE + CELL_SIZE * 0.5f, (7 - i) * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+        }
+        moverCount = 6;
+        moverActive[1] = false;
+        moverActive[4] = false;
+        RebuildIdleMoverList();
+
+        for (int i = 0; i < 8; i++) {
+            SpawnItem((14 - i) * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
+        }
+        int spIdx = CreateStockpile(1, 2, 0, 8, 1);
+        SetStockpileFilter(spIdx, ITEM_RED, true);
+        SetStockpileMaxStackSize(spIdx, 1);
+
+        moverRenumberInterval = 5;
+        int passesBefore = moverRenumberCount;
+        int skippedBefore = moverRenumberSkipped;
+        int mismatches = 0;
+        for (int tick = 0; tick < 3000 && CountItemsInStockpiles(ITEM_RED) < 8; tick++) {
+            Tick();
+            AssignJobs();
+            JobsTick();
+            if (AuditMoverJobConsistency(false) != 0 || AuditItemReservations(false) != 0) mismatches++;
+        }
+        moverRenumberInterval = 0;
+
+        expect(moverRenumberCount > passesBefore);
+        expect(moverRenumberSkipped == skippedBefore);
+        expect(moverCount == 4);
+        expect(mismatches == 0);
+        expect(CountItemsInStockpiles(ITEM_RED) == 8);
+        expect(AuditItemStockpileConsistency(false) == 0);
+    }
+
+    it("should skip the pass when a reference points at a retired mover") {
+        InitTestGridFromAscii(
+            "........\n"
+            "........\n");
+
+        ClearMovers();
+        ClearItems();
+
+        for (int i = 0; i < 2; i++) {
+            Point goal = {0, 0, 0};
+            InitMover(&movers[i], (5 - i * 4) * CELL_SIZE + CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+        }
+        moverCount = 2;
+        int rock = SpawnItem(CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, ITEM_ROCK);
+        itemReservedBy[rock] = 5;  // never spawned
+
+        int skippedBefore = moverRenumberSkipped;
+        expect(!RenumberMoversByCell());
+        expect(moverRenumberSkipped == skippedBefore + 1);
+        expect(moverPosX[0] > moverPosX[1]);  // untouched
+        expect(itemReservedBy[rock] == 5);
+    }
+}
+
+describe(item_ledger) {
+    it("should follow items through stockpiles, containers, stacks and deletes") {
+        InitTestGridFromAscii(
+            "........\n"
+            "........\n"
+            "........\n");
+
+        ClearMovers();
+        ClearItems();
+        ClearStockpiles();
+
+        int spIdx = CreateStockpile(0, 0, 0, 4, 1);
+        SetStockpileFilter(spIdx, ITEM_RED, true);
+        int reds[3];
+        for (int i = 0; i < 3; i++) {
+            reds[i] = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, 2 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
+        }
+        expect(LedgerItemCount(ITEM_RED, ITEM_ON_GROUND) == 3);
+        expect(CountItemsInStockpiles(ITEM_RED) == 0);
+
+        // Second red merges into the first's slot: 2 units, one item
+        PlaceItemInStockpile(spIdx, 0, 0, reds[0]);
+        PlaceItemInStockpile(spIdx, 0, 0, reds[1]);
+        expect(CountItemsInStockpiles(ITEM_RED) == 2);
+        expect(LedgerItemCount(ITEM_RED, ITEM_ON_GROUND) == 1);
+        expect(LedgerItemTotal(ITEM_RED) == 3);
+
+        int split = SplitStack(reds[0], 1);
+        expect(split >= 0);
+        expect(CountItemsInStockpiles(ITEM_RED) == 2);
+
+        int basket = SpawnItem(6 * CELL_SIZE + CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, ITEM_BASKET);
+        int berries = SpawnItem(0.0f, 0.0f, 0.0f, ITEM_BERRIES);
+        PutItemInContainer(berries, basket);
+        expect(LedgerItemCount(ITEM_BERRIES, ITEM_IN_CONTAINER) == 1);
+        expect(LedgerItemCount(ITEM_BERRIES, ITEM_ON_GROUND) == 0);
+
+        // Deleting the basket spills the berries back onto the ground
+        DeleteItem(basket);
+        expect(LedgerItemCount(ITEM_BASKET, ITEM_ON_GROUND) == 0);
+        expect(LedgerItemCount(ITEM_BERRIES, ITEM_ON_GROUND) == 1);
+
+        int wood = SpawnItemWithMaterial(CELL_SIZE * 0.5f, 2 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_PLANKS, MAT_OAK);
+        SetItemStackCount(wood, 4);
+        expect(LedgerItemCountOfMaterial(ITEM_PLANKS, MAT_OAK, ITEM_ON_GROUND) == 4);
+        expect(LedgerItemCountOfMaterial(ITEM_PLANKS, MAT_PINE, ITEM_ON_GROUND) == 0);
+
+        expect(AuditItemLedger(false) == 0);
+        ClearItems();
+        expect(LedgerItemTotal(ITEM_RED) == 0);
+    }
+
+    it("should stay in step with hauling and renumbering") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        ClearMovers();
+        ClearItems();
+        ClearStockpiles();
+        ClearJobs();
+
+        for (int i = 0; i < 2; i++) {
+            Point goal = {i, 0, 0};
+            InitMover(&movers[i], i * CELL_SIZE + CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
+        }
+        moverCount = 2;
+        for (int i = 0; i < 5; i++) {
+            SpawnItem((14 - i) * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
+        }
+        int spIdx = CreateStockpile(1, 2, 0, 5, 1);
+        SetStockpileFilter(spIdx, ITEM_RED, true);
+
+        itemRenumberInterval = 7;
+        int mismatches = 0;
+        for (int tick = 0; tick < 3000 && CountItemsInStockpiles(ITEM_RED) < 5; tick++) {
+            Tick();
+            AssignJobs();
+            JobsTick();
+            if (tick % 10 == 0 && AuditItemLedger(false) != 0) mismatches++;
+        }
+        itemRenumberInterval = 0;
+
+        expect(mismatches == 0);
+        expect(CountItemsInStockpiles(ITEM_RED) == 5);
+        expect(LedgerItemCount(ITEM_RED, ITEM_CARRIED) == 0);
+        expect(LedgerItemCount(ITEM_RED, ITEM_ON_GROUND) == 0);
+        expect(AuditItemLedger(false) == 0);
+    }
+}
+
 describe(stockpile_cell_operations) {
     it("should track active cells in a stockpile") {
         ClearStockpiles();
@@ -3576,7 +4004,7 @@ describe(stockpile_cell_operations) {
         float itemX = 6 * CELL_SIZE + CELL_SIZE / 2;
         float itemY = 6 * CELL_SIZE + CELL_SIZE / 2;
         int itemIdx = SpawnItem(itemX, itemY, 0, ITEM_RED);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         
         // Set slot data
         int lx = 1, ly = 1;  // local coords for (6,6)
@@ -3589,7 +4017,7 @@ describe(stockpile_cell_operations) {
         RemoveStockpileCells(spIdx, 6, 6, 6, 6);
         
         // Item should now be on ground
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
         expect(IsItemActive(itemIdx) == true);
         
         FreeItemSpatialGrid();
@@ -3879,7 +4307,7 @@ describe(mining_job_execution) {
                 expect(itemX == 1);
                 expect(itemY == 1);
                 expect(GetItemZ(i) == 0);
-                expect(items[i].state == ITEM_ON_GROUND);
+                expect(itemState[i] == ITEM_ON_GROUND);
                 break;
             }
         }
@@ -4142,6 +4570,32 @@ describe(channel_designation) {
         expect(HasChannelDesignation(2, 2, 1) == false);
         expect(CountChannelDesignations() == 0);
     }
+
+    it("should apply both levels of a channel as one cell-edit transaction") {
+        InitTestGridFromAscii(
+            ".....\n"
+            ".....\n"
+            ".....\n"
+            ".....\n"
+            ".....\n");
+        for (int x = 0; x < 5; x++) {
+            for (int y = 0; y < 5; y++) {
+                grid[0][y][x] = CELL_WALL;
+                grid[1][y][x] = CELL_AIR;
+                SET_FLOOR(x, y, 1);
+            }
+        }
+        InitDesignations();
+        DesignateChannel(2, 2, 1);
+
+        lastCellEditCommit = (CellEditStats){0};
+        CompleteChannelDesignation(2, 2, 1, -1);
+
+        expect(cellEditDepth == 0);
+        expect(lastCellEditCommit.cells >= 2);  // the channeled cell and the one below
+        expect(!HAS_FLOOR(2, 2, 1));
+        expect(!CellIsSolid(grid[0][2][2]));
+    }
 }
 
 describe(channel_ramp_detection) {
@@ -4478,7 +4932,7 @@ describe(channel_job_execution) {
         InitMover(m, 2 * CELL_SIZE + CELL_SIZE * 0.5f, 2 * CELL_SIZE + CELL_SIZE * 0.5f, (float)channelZ, goal, 100.0f);
         moverCount = 1;
         
-        float initialZ = m->z;
+        float initialZ = moverPosZ[0];
         expect(initialZ == (float)channelZ);
         
         bool designated = DesignateChannel(2, 2, channelZ);
@@ -4494,7 +4948,7 @@ describe(channel_job_execution) {
         }
         
         // Mover should have descended
-        expect(m->z == (float)descendZ);
+        expect(moverPosZ[0] == (float)descendZ);
     }
 }
 
@@ -4821,7 +5275,7 @@ describe(building_haul_job) {
         expect(MoverIsMovingToPickup(m));
         expect(MoverGetTargetItem(m) == itemIdx);
         expect(MoverGetTargetBlueprint(m) == bpIdx);
-        expect(items[itemIdx].reservedBy >= 0);
+        expect(itemReservedBy[itemIdx] >= 0);
     }
     
     it("should not assign haul job when no items available") {
@@ -4891,7 +5345,7 @@ describe(building_haul_job) {
 
         // Simulate item being deleted (e.g., merged into stack)
         DeleteItem(itemIdx);
-        expect(items[itemIdx].active == false);
+        expect(itemActive[itemIdx] == false);
 
         // Cancel job — reservedCount must still be decremented
         CancelJob(m, 0);
@@ -4951,7 +5405,7 @@ describe(building_haul_job) {
 
             // After first delivery trip of the stacked item, check the count
             // The stacked item of 5 should contribute 5 to deliveredCount, not 1
-            if (delivered > 0 && !items[grassIdx].active) break;
+            if (delivered > 0 && !itemActive[grassIdx]) break;
         }
 
         // BUG: without fix, delivered will be 1 (only counted 1 from the stack of 5)
@@ -5069,7 +5523,7 @@ describe(building_job_execution) {
         
         // Item should be on ground (not deleted)
         expect(IsItemActive(itemIdx) == true);
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
     }
 }
 
@@ -5419,7 +5873,7 @@ describe(job_drivers) {
         
         // Set mover goal to item location
         m->goal = (Point){3, 1, 0};
-        m->needsRepath = true;
+        moverNeedsRepath[0] = true;
         
         // Reserve item and slot
         ReserveItem(itemIdx, 0);
@@ -5429,11 +5883,11 @@ describe(job_drivers) {
         for (int i = 0; i < 600; i++) {
             Tick();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Verify haul completed
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect(m->currentJobId == -1);  // Job should be released
         expect(GetJob(jobId)->active == false);
     }
@@ -5490,7 +5944,7 @@ describe(job_drivers) {
         
         // Set mover goal to adjacent tile (2,1 is adjacent to wall at 3,1)
         m->goal = (Point){2, 1, mineZ};
-        m->needsRepath = true;
+        moverNeedsRepath[0] = true;
         
         // Reserve designation
         Designation* d = GetDesignation(3, 1, mineZ);
@@ -5548,7 +6002,7 @@ describe(job_drivers) {
         
         // Set mover goal to blueprint location
         m->goal = (Point){4, 1, 0};
-        m->needsRepath = true;
+        moverNeedsRepath[0] = true;
         
         // Run simulation using the new driver system
         for (int i = 0; i < 600; i++) {
@@ -5658,7 +6112,7 @@ describe(job_drivers) {
         
         // Set mover goal to item location (same as mover position for instant pickup)
         m->goal = (Point){0, 0, 0};
-        m->needsRepath = true;
+        moverNeedsRepath[0] = true;
         
         // Mover should not be in idle list while working
         RemoveMoverFromIdleList(0);
@@ -5719,7 +6173,7 @@ describe(job_game_speed) {
         Mover* m = &movers[0];
         Point goal = {2, 1, mineZ};
         InitMover(m, CELL_SIZE * 2.5f, CELL_SIZE * 1.5f, (float)mineZ, goal, 100.0f);
-        m->pathLength = 0;  // Already at destination
+        moverPathLength[0] = 0;  // Already at destination
         moverCount = 1;
         
         // Designate wall at (3,1) for digging
@@ -5824,7 +6278,7 @@ describe(job_game_speed) {
         Mover* m = &movers[0];
         Point goal = {4, 1, buildZ};
         InitMover(m, CELL_SIZE * 4.5f, CELL_SIZE * 1.5f, (float)buildZ, goal, 100.0f);
-        m->pathLength = 0;  // Already at destination
+        moverPathLength[0] = 0;  // Already at destination
         moverCount = 1;
         
         // Create blueprint at (4,1) - ready to build
@@ -6633,11 +7087,11 @@ describe(final_approach) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Item should be in stockpile (job completed successfully)
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect(MoverIsIdle(m));
     }
     
@@ -6829,11 +7283,11 @@ describe(final_approach) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Delivery should complete
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         expect(MoverIsIdle(m));
         expect(MoverGetCarryingItem(m) == -1);
     }
@@ -6881,19 +7335,19 @@ describe(final_approach) {
         
         // Artificially clear the path to simulate exhausted state while far
         ClearMoverPath(0);
-        m->pathIndex = -1;
+        moverPathIndex[0] = -1;
         
         // Record position
-        float startX = m->x;
-        float startY = m->y;
+        float startX = moverPosX[0];
+        float startY = moverPosY[0];
         
         // Run one JobsTick - final approach should NOT move mover (too far)
         JobsTick();
         
         // Mover position should be unchanged (final approach didn't activate)
         // The mover is in cell (1,1) and item is in cell (8,8) - not adjacent
-        expect(m->x == startX);
-        expect(m->y == startY);
+        expect(moverPosX[0] == startX);
+        expect(moverPosY[0] == startY);
     }
 }
 
@@ -6950,7 +7404,7 @@ describe(stockpile_strong_tests) {
         
         // Place log directly in low-priority stockpile
         int logIdx = SpawnItem(8 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_LOG);
-        items[logIdx].state = ITEM_IN_STOCKPILE;
+        itemState[logIdx] = ITEM_IN_STOCKPILE;
         Stockpile* spL = &stockpiles[spLow];
         spL->slotCounts[0] = 1;
         spL->slotTypes[0] = ITEM_LOG;
@@ -6958,7 +7412,7 @@ describe(stockpile_strong_tests) {
         
         // Verify it's in the low-priority stockpile
         int spIdx = -1;
-        IsPositionInStockpile(items[logIdx].x, items[logIdx].y, (int)items[logIdx].z, &spIdx);
+        IsPositionInStockpile(itemPosX[logIdx], itemPosY[logIdx], (int)itemPosZ[logIdx], &spIdx);
         expect(spIdx == spLow);
         
         // With idle time, should re-haul to high-priority
@@ -6968,12 +7422,12 @@ describe(stockpile_strong_tests) {
             JobsTick();
             
             // Check if moved to high priority
-            IsPositionInStockpile(items[logIdx].x, items[logIdx].y, (int)items[logIdx].z, &spIdx);
+            IsPositionInStockpile(itemPosX[logIdx], itemPosY[logIdx], (int)itemPosZ[logIdx], &spIdx);
             if (spIdx == spHigh) break;
         }
         
         // Should now be in high-priority stockpile
-        IsPositionInStockpile(items[logIdx].x, items[logIdx].y, (int)items[logIdx].z, &spIdx);
+        IsPositionInStockpile(itemPosX[logIdx], itemPosY[logIdx], (int)itemPosZ[logIdx], &spIdx);
         expect(spIdx == spHigh);
     }
     
@@ -7021,7 +7475,7 @@ describe(stockpile_strong_tests) {
             AssignJobs();
             JobsTick();
             // Check if the new item got placed in stockpile (may have been merged)
-            if (!items[newItem].active || items[newItem].state == ITEM_IN_STOCKPILE) break;
+            if (!itemActive[newItem] || itemState[newItem] == ITEM_IN_STOCKPILE) break;
         }
         
         // New item should have been placed in slot 1 (6,5) — either merged or as new slot item
@@ -7102,19 +7556,19 @@ describe(stockpile_strong_tests) {
             JobsTick();
             
             // Check if all non-red items are in stockpile
-            if (items[greenIdx].state == ITEM_IN_STOCKPILE &&
-                items[blueIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[greenIdx] == ITEM_IN_STOCKPILE &&
+                itemState[blueIdx] == ITEM_IN_STOCKPILE) break;
         }
         
         // Green and blue should be in the stockpile
-        expect(items[greenIdx].state == ITEM_IN_STOCKPILE);
-        expect(items[blueIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[greenIdx] == ITEM_IN_STOCKPILE);
+        expect(itemState[blueIdx] == ITEM_IN_STOCKPILE);
         
         // Red should NOT be in this stockpile (filter was disabled)
         // It should be on ground or in a different stockpile if one exists
-        if (items[redIdx].state == ITEM_IN_STOCKPILE) {
+        if (itemState[redIdx] == ITEM_IN_STOCKPILE) {
             int redSp = -1;
-            IsPositionInStockpile(items[redIdx].x, items[redIdx].y, (int)items[redIdx].z, &redSp);
+            IsPositionInStockpile(itemPosX[redIdx], itemPosY[redIdx], (int)itemPosZ[redIdx], &redSp);
             expect(redSp != spIdx);  // Not in the filtered stockpile
         }
     }
@@ -7168,7 +7622,7 @@ describe(stockpile_strong_tests) {
             
             bool allDone = true;
             for (int j = 0; j < 5; j++) {
-                if (items[items_spawned[j]].state != ITEM_IN_STOCKPILE) {
+                if (itemState[items_spawned[j]] != ITEM_IN_STOCKPILE) {
                     allDone = false;
                     break;
                 }
@@ -7184,9 +7638,9 @@ describe(stockpile_strong_tests) {
             // Count types in slot 0
             int redCount = 0, greenCount = 0, blueCount = 0;
             for (int j = 0; j < 5; j++) {
-                if (items[items_spawned[j]].state != ITEM_IN_STOCKPILE) continue;
-                int tileX = (int)(items[items_spawned[j]].x / CELL_SIZE);
-                int tileY = (int)(items[items_spawned[j]].y / CELL_SIZE);
+                if (itemState[items_spawned[j]] != ITEM_IN_STOCKPILE) continue;
+                int tileX = (int)(itemPosX[items_spawned[j]] / CELL_SIZE);
+                int tileY = (int)(itemPosY[items_spawned[j]] / CELL_SIZE);
                 if (tileX == 5 && tileY == 5) {
                     if (items[items_spawned[j]].type == ITEM_RED) redCount++;
                     if (items[items_spawned[j]].type == ITEM_GREEN) greenCount++;
@@ -7202,9 +7656,9 @@ describe(stockpile_strong_tests) {
             // Count types in slot 1
             int redCount = 0, greenCount = 0, blueCount = 0;
             for (int j = 0; j < 5; j++) {
-                if (items[items_spawned[j]].state != ITEM_IN_STOCKPILE) continue;
-                int tileX = (int)(items[items_spawned[j]].x / CELL_SIZE);
-                int tileY = (int)(items[items_spawned[j]].y / CELL_SIZE);
+                if (itemState[items_spawned[j]] != ITEM_IN_STOCKPILE) continue;
+                int tileX = (int)(itemPosX[items_spawned[j]] / CELL_SIZE);
+                int tileY = (int)(itemPosY[items_spawned[j]] / CELL_SIZE);
                 if (tileX == 5 && tileY == 6) {
                     if (items[items_spawned[j]].type == ITEM_RED) redCount++;
                     if (items[items_spawned[j]].type == ITEM_GREEN) greenCount++;
@@ -7266,16 +7720,16 @@ describe(stockpile_strong_tests) {
             AssignJobs();
             JobsTick();
 
-            bool allDone = (items[logIdx].state == ITEM_IN_STOCKPILE &&
-                           items[rockIdx].state == ITEM_IN_STOCKPILE &&
-                           items[dirtIdx].state == ITEM_IN_STOCKPILE);
+            bool allDone = (itemState[logIdx] == ITEM_IN_STOCKPILE &&
+                           itemState[rockIdx] == ITEM_IN_STOCKPILE &&
+                           itemState[dirtIdx] == ITEM_IN_STOCKPILE);
             if (allDone) break;
         }
 
         // All three different types should be in the stockpile
-        expect(items[logIdx].state == ITEM_IN_STOCKPILE);
-        expect(items[rockIdx].state == ITEM_IN_STOCKPILE);
-        expect(items[dirtIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[logIdx] == ITEM_IN_STOCKPILE);
+        expect(itemState[rockIdx] == ITEM_IN_STOCKPILE);
+        expect(itemState[dirtIdx] == ITEM_IN_STOCKPILE);
     }
 
     // =========================================================================
@@ -7394,8 +7848,8 @@ describe(stockpile_strong_tests) {
         }
 
         // Oak should be in stockpile, pine should still be on the ground
-        expect(items[oakIdx].state == ITEM_IN_STOCKPILE);
-        expect(items[pineIdx].state == ITEM_ON_GROUND);
+        expect(itemState[oakIdx] == ITEM_IN_STOCKPILE);
+        expect(itemState[pineIdx] == ITEM_ON_GROUND);
     }
 
     it("consolidation should never merge different materials of same type") {
@@ -7431,7 +7885,7 @@ describe(stockpile_strong_tests) {
         // Slot 0 (5,5): 3 oak logs
         for (int i = 0; i < 3; i++) {
             int idx = SpawnItemWithMaterial(5 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_LOG, MAT_OAK);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
         }
         int slot0Idx = 0; // local slot index
         stockpiles[spIdx].slotTypes[slot0Idx] = ITEM_LOG;
@@ -7441,7 +7895,7 @@ describe(stockpile_strong_tests) {
         // Slot 1 (6,5): 3 pine logs
         for (int i = 0; i < 3; i++) {
             int idx = SpawnItemWithMaterial(6 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_LOG, MAT_PINE);
-            items[idx].state = ITEM_IN_STOCKPILE;
+            itemState[idx] = ITEM_IN_STOCKPILE;
         }
         int slot1Idx = 1; // local slot index
         stockpiles[spIdx].slotTypes[slot1Idx] = ITEM_LOG;
@@ -7494,13 +7948,13 @@ describe(stockpile_strong_tests) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[oakIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[oakIdx] == ITEM_IN_STOCKPILE) break;
         }
-        expect(items[oakIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[oakIdx] == ITEM_IN_STOCKPILE);
 
         // Verify it's in sp1
         int currentSp = -1;
-        IsPositionInStockpile(items[oakIdx].x, items[oakIdx].y, (int)items[oakIdx].z, &currentSp);
+        IsPositionInStockpile(itemPosX[oakIdx], itemPosY[oakIdx], (int)itemPosZ[oakIdx], &currentSp);
         expect(currentSp == sp1);
 
         // Now disable oak material on sp1
@@ -7515,7 +7969,7 @@ describe(stockpile_strong_tests) {
 
         // Item should now be in sp2
         int newSp = -1;
-        IsPositionInStockpile(items[oakIdx].x, items[oakIdx].y, (int)items[oakIdx].z, &newSp);
+        IsPositionInStockpile(itemPosX[oakIdx], itemPosY[oakIdx], (int)itemPosZ[oakIdx], &newSp);
         expect(newSp == sp2);
     }
 
@@ -7659,14 +8113,14 @@ describe(stockpile_strong_tests) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         
         // Should be in the CLOSEST stockpile
         int spIdx = -1;
-        IsPositionInStockpile(items[itemIdx].x, items[itemIdx].y, (int)items[itemIdx].z, &spIdx);
+        IsPositionInStockpile(itemPosX[itemIdx], itemPosY[itemIdx], (int)itemPosZ[itemIdx], &spIdx);
         expect(spIdx == spClose);  // Should choose closest one
     }
 }
@@ -7702,7 +8156,7 @@ describe(item_lifecycle) {
         float slotX = 2 * CELL_SIZE + CELL_SIZE * 0.5f;
         float slotY = 2 * CELL_SIZE + CELL_SIZE * 0.5f;
         int itemIdx = SpawnItem(slotX, slotY, 0.0f, ITEM_LOG);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 2, 2, itemIdx);
 
         // Verify slot is occupied
@@ -7744,7 +8198,7 @@ describe(item_lifecycle) {
         float slotX = 3 * CELL_SIZE + CELL_SIZE * 0.5f;
         float slotY = 2 * CELL_SIZE + CELL_SIZE * 0.5f;
         int itemIdx = SpawnItem(slotX, slotY, 0.0f, ITEM_ROCK);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 3, 2, itemIdx);
 
         // Verify slot (1,0) in local coords is occupied
@@ -7756,7 +8210,7 @@ describe(item_lifecycle) {
         PushItemsOutOfCell(3, 2, 0);
 
         // Player expectation: item is now a ground item, not stuck in stockpile limbo
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
 
         // Player expectation: the stockpile slot should be freed
         expect(sp->slotCounts[idx] == 0);
@@ -7798,7 +8252,7 @@ describe(item_lifecycle) {
         float slotX = 3 * CELL_SIZE + CELL_SIZE * 0.5f;
         float slotY = 2 * CELL_SIZE + CELL_SIZE * 0.5f;
         int itemIdx = SpawnItem(slotX, slotY, 1.0f, ITEM_DIRT);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 3, 2, itemIdx);
 
         // Verify slot is occupied
@@ -7816,8 +8270,8 @@ describe(item_lifecycle) {
         DropItemsInCell(3, 2, 1);
 
         // Player expectation: item fell to z0, is now on ground
-        expect((int)items[itemIdx].z == 0);
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect((int)itemPosZ[itemIdx] == 0);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
 
         // Player expectation: stockpile slot at z1 is freed
         expect(sp->slotCounts[idx] == 0);
@@ -7993,14 +8447,14 @@ describe(mover_lifecycle) {
         // Simulate ladder descent: x/y stays same, z decreases
         m->lastX = cx;
         m->lastY = cy;
-        m->z = 2.0f;  // moved from z=3 to z=2 (real progress!)
+        moverPosZ[0] = 2.0f;  // moved from z=3 to z=2 (real progress!)
         m->timeWithoutProgress = 0.0f;
 
         // The stuck detection checks dx/dy. With no x/y change but z change,
         // it should still recognize progress.
-        float movedX = m->x - m->lastX;
-        float movedY = m->y - m->lastY;
-        float movedZ = m->z - 3.0f;  // original z was 3
+        float movedX = moverPosX[0] - m->lastX;
+        float movedY = moverPosY[0] - m->lastY;
+        float movedZ = moverPosZ[0] - 3.0f;  // original z was 3
         float movedDistSq = movedX * movedX + movedY * movedY;
 
         // Current code: only x/y. This test documents the expectation that
@@ -8039,8 +8493,8 @@ describe(mover_lifecycle) {
         moverCount = 1;
 
         int itemIdx = SpawnItem(mx, my, 0.0f, ITEM_LOG);
-        items[itemIdx].state = ITEM_CARRIED;
-        items[itemIdx].reservedBy = 0;
+        itemState[itemIdx] = ITEM_CARRIED;
+        itemReservedBy[itemIdx] = 0;
 
         // Give mover a haul job carrying the item
         int spIdx = CreateStockpile(7, 2, 0, 2, 1);
@@ -8070,13 +8524,13 @@ describe(mover_lifecycle) {
         JobsTick();
 
         // The item should exist and be on ground
-        expect(items[itemIdx].active == true);
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
+        expect(itemActive[itemIdx] == true);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
 
         // Player expectation: item should NOT be at an unwalkable position
-        int itemCellX = (int)(items[itemIdx].x / CELL_SIZE);
-        int itemCellY = (int)(items[itemIdx].y / CELL_SIZE);
-        int itemCellZ = (int)items[itemIdx].z;
+        int itemCellX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemCellY = (int)(itemPosY[itemIdx] / CELL_SIZE);
+        int itemCellZ = (int)itemPosZ[itemIdx];
         bool itemCellWalkable = IsCellWalkableAt(itemCellZ, itemCellY, itemCellX);
         expect(itemCellWalkable == true);
     }
@@ -8127,11 +8581,11 @@ describe(job_lifecycle) {
             BuildMoverSpatialGrid();
             AssignJobs();
             JobsTick();
-            if (!items[sapIdx].active) break;
+            if (!itemActive[sapIdx]) break;
         }
 
         // Sapling should be consumed
-        expect(items[sapIdx].active == false);
+        expect(itemActive[sapIdx] == false);
 
         // Player expectation: itemCount should have decremented
         expect(itemCount == countBefore - 1);
@@ -8191,8 +8645,8 @@ describe(job_lifecycle) {
                 Job* job = GetJob(m->currentJobId);
                 if (job && job->type == JOBTYPE_CRAFT && job->step == CRAFT_STEP_MOVING_TO_WORKSHOP) {
                     // The item should be following the mover
-                    float dx = items[job->carryingItem].x - m->x;
-                    float dy = items[job->carryingItem].y - m->y;
+                    float dx = itemPosX[job->carryingItem] - moverPosX[0];
+                    float dy = itemPosY[job->carryingItem] - moverPosY[0];
                     float distSq = dx * dx + dy * dy;
                     // Item should be close to mover (within a cell), not stuck at pickup
                     expect(distSq < CELL_SIZE * CELL_SIZE);
@@ -8229,12 +8683,12 @@ describe(job_lifecycle) {
 
         // Create a fuel item and make it carried
         int fuelIdx = SpawnItemWithMaterial(CELL_SIZE * 5.5f, CELL_SIZE * 3.5f, 0.0f, ITEM_LOG, MAT_OAK);
-        items[fuelIdx].state = ITEM_CARRIED;
-        items[fuelIdx].reservedBy = 0;
+        itemState[fuelIdx] = ITEM_CARRIED;
+        itemReservedBy[fuelIdx] = 0;
 
         // Create an input item (reserved but deposited at workshop)
         int inputIdx = SpawnItemWithMaterial(CELL_SIZE * 5.5f, CELL_SIZE * 3.5f, 0.0f, ITEM_CLAY, MAT_CLAY);
-        items[inputIdx].reservedBy = 0;
+        itemReservedBy[inputIdx] = 0;
 
         // Create a workshop
         int wsIdx = CreateWorkshop(5, 1, 0, WORKSHOP_KILN);
@@ -8260,13 +8714,13 @@ describe(job_lifecycle) {
         JobsTick();
 
         // The fuel item should be on the ground
-        expect(items[fuelIdx].active == true);
-        expect(items[fuelIdx].state == ITEM_ON_GROUND);
+        expect(itemActive[fuelIdx] == true);
+        expect(itemState[fuelIdx] == ITEM_ON_GROUND);
 
         // Player expectation: fuel should NOT be at an unwalkable position
-        int fuelCellX = (int)(items[fuelIdx].x / CELL_SIZE);
-        int fuelCellY = (int)(items[fuelIdx].y / CELL_SIZE);
-        int fuelCellZ = (int)items[fuelIdx].z;
+        int fuelCellX = (int)(itemPosX[fuelIdx] / CELL_SIZE);
+        int fuelCellY = (int)(itemPosY[fuelIdx] / CELL_SIZE);
+        int fuelCellZ = (int)itemPosZ[fuelIdx];
         bool fuelCellWalkable = IsCellWalkableAt(fuelCellZ, fuelCellY, fuelCellX);
         expect(fuelCellWalkable == true);
     }
@@ -8364,8 +8818,8 @@ describe(job_lifecycle) {
 
         // Spawn a log as the carried input (already picked up)
         int logIdx = SpawnItemWithMaterial(workX, workY, 0.0f, ITEM_LOG, MAT_OAK);
-        items[logIdx].state = ITEM_CARRIED;
-        items[logIdx].reservedBy = 0;
+        itemState[logIdx] = ITEM_CARRIED;
+        itemReservedBy[logIdx] = 0;
 
         int countBefore = itemCount;
 
@@ -8440,30 +8894,30 @@ describe(stockpile_lifecycle) {
         int item3 = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, 6 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
         
         // Manually set them as IN_STOCKPILE and place them
-        items[item1].state = ITEM_IN_STOCKPILE;
-        items[item2].state = ITEM_IN_STOCKPILE;
-        items[item3].state = ITEM_IN_STOCKPILE;
+        itemState[item1] = ITEM_IN_STOCKPILE;
+        itemState[item2] = ITEM_IN_STOCKPILE;
+        itemState[item3] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 5, 5, item1);
         PlaceItemInStockpile(spIdx, 6, 5, item2);
         PlaceItemInStockpile(spIdx, 5, 6, item3);
         
         // Verify items are in stockpile
-        expect(items[item1].state == ITEM_IN_STOCKPILE);
-        expect(items[item2].state == ITEM_IN_STOCKPILE);
-        expect(items[item3].state == ITEM_IN_STOCKPILE);
+        expect(itemState[item1] == ITEM_IN_STOCKPILE);
+        expect(itemState[item2] == ITEM_IN_STOCKPILE);
+        expect(itemState[item3] == ITEM_IN_STOCKPILE);
         
         // Now delete the stockpile
         DeleteStockpile(spIdx);
         
         // Player expectation: All items should be on ground now (accessible)
-        expect(items[item1].state == ITEM_ON_GROUND);
-        expect(items[item2].state == ITEM_ON_GROUND);
-        expect(items[item3].state == ITEM_ON_GROUND);
+        expect(itemState[item1] == ITEM_ON_GROUND);
+        expect(itemState[item2] == ITEM_ON_GROUND);
+        expect(itemState[item3] == ITEM_ON_GROUND);
         
         // Items should still exist at their original positions
-        expect(items[item1].active == true);
-        expect(items[item2].active == true);
-        expect(items[item3].active == true);
+        expect(itemActive[item1] == true);
+        expect(itemActive[item2] == true);
+        expect(itemActive[item3] == true);
     }
     
     it("placing item in inactive stockpile cell should not corrupt slot data") {
@@ -8507,10 +8961,10 @@ describe(stockpile_lifecycle) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_CARRIED) break;
+            if (itemState[itemIdx] == ITEM_CARRIED) break;
         }
         
-        expect(items[itemIdx].state == ITEM_CARRIED);
+        expect(itemState[itemIdx] == ITEM_CARRIED);
         
         // Now REMOVE the stockpile cell the mover is heading to
         // (Simulate player shrinking stockpile while mover is carrying)
@@ -8525,11 +8979,11 @@ describe(stockpile_lifecycle) {
         
         // Player expectation: Item should NOT enter corrupted state
         // Either it's safely on ground, or job was cancelled
-        expect(items[itemIdx].state != ITEM_IN_STOCKPILE);
-        expect(items[itemIdx].active == true);
+        expect(itemState[itemIdx] != ITEM_IN_STOCKPILE);
+        expect(itemActive[itemIdx] == true);
         
         // Item should be on ground (safe-dropped) or back in circulation
-        expect(items[itemIdx].state == ITEM_ON_GROUND || items[itemIdx].state == ITEM_CARRIED);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND || itemState[itemIdx] == ITEM_CARRIED);
     }
     
     it("removing stockpile cell should release slot reservations") {
@@ -8590,7 +9044,7 @@ describe(stockpile_lifecycle) {
         expect(reservedCount == 0);
         
         // Job should be cancelled (item unreserved)
-        expect(items[itemIdx].reservedBy == -1);
+        expect(itemReservedBy[itemIdx] == -1);
     }
     
     it("removing stockpile cell should clear item reservations") {
@@ -8622,19 +9076,19 @@ describe(stockpile_lifecycle) {
         
         // Spawn log in stockpile
         int logIdx = SpawnItemWithMaterial(5 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_LOG, MAT_OAK);
-        items[logIdx].state = ITEM_IN_STOCKPILE;
+        itemState[logIdx] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 5, 5, logIdx);
         
         // Reserve the item (simulating a craft job claiming it)
         ReserveItem(logIdx, 0);
-        expect(items[logIdx].reservedBy == 0);
+        expect(itemReservedBy[logIdx] == 0);
         
         // Now remove the stockpile cell
         RemoveStockpileCells(spIdx, 5, 5, 5, 5);
         
         // Player expectation: Item should be on ground AND unreserved
-        expect(items[logIdx].state == ITEM_ON_GROUND);
-        expect(items[logIdx].reservedBy == -1);
+        expect(itemState[logIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[logIdx] == -1);
     }
     
     it("placing mismatched item type in occupied slot should not corrupt slot data") {
@@ -8665,7 +9119,7 @@ describe(stockpile_lifecycle) {
         
         // Place a RED item in slot (5,5)
         int redItem = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
-        items[redItem].state = ITEM_IN_STOCKPILE;
+        itemState[redItem] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 5, 5, redItem);
         
         // Verify slot type is RED
@@ -8674,7 +9128,7 @@ describe(stockpile_lifecycle) {
         
         // Now try to place a GREEN item in the same slot (bug scenario)
         int greenItem = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_GREEN);
-        items[greenItem].state = ITEM_IN_STOCKPILE;
+        itemState[greenItem] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 5, 5, greenItem);
         
         // Player expectation: Slot should still be RED (mixed types not allowed)
@@ -8714,7 +9168,7 @@ describe(stockpile_lifecycle) {
         
         // Place item in stockpile A
         int itemIdx = SpawnItem(3 * CELL_SIZE + CELL_SIZE * 0.5f, 3 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spA, 3, 3, itemIdx);
         
         expect(stockpiles[spA].slotCounts[0] == 1);
@@ -8781,14 +9235,14 @@ describe(stockpile_lifecycle) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[itemIdx].state == ITEM_IN_STOCKPILE) break;
+            if (itemState[itemIdx] == ITEM_IN_STOCKPILE) break;
         }
         
-        expect(items[itemIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[itemIdx] == ITEM_IN_STOCKPILE);
         
         // Player expectation: Item should go to HIGH priority stockpile
-        int itemTileX = (int)(items[itemIdx].x / CELL_SIZE);
-        int itemTileY = (int)(items[itemIdx].y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[itemIdx] / CELL_SIZE);
         
         // Item should be at (3,3) high priority stockpile, NOT (3,1) low priority
         expect(itemTileX == 3);
@@ -8825,8 +9279,8 @@ describe(stockpile_lifecycle) {
         // Place items in some slots
         int item1 = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
         int item2 = SpawnItem(6 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
-        items[item1].state = ITEM_IN_STOCKPILE;
-        items[item2].state = ITEM_IN_STOCKPILE;
+        itemState[item1] = ITEM_IN_STOCKPILE;
+        itemState[item2] = ITEM_IN_STOCKPILE;
         PlaceItemInStockpile(spIdx, 5, 5, item1);
         PlaceItemInStockpile(spIdx, 6, 5, item2);
         
@@ -8848,16 +9302,16 @@ describe(stockpile_lifecycle) {
         
         // Player expectations:
         // 1. All items should be on ground or accessible
-        expect(items[item1].active == true);
-        expect(items[item2].active == true);
-        expect(items[item3].active == true);
-        expect(items[item1].state == ITEM_ON_GROUND);
-        expect(items[item2].state == ITEM_ON_GROUND);
+        expect(itemActive[item1] == true);
+        expect(itemActive[item2] == true);
+        expect(itemActive[item3] == true);
+        expect(itemState[item1] == ITEM_ON_GROUND);
+        expect(itemState[item2] == ITEM_ON_GROUND);
         
         // 2. All reservations cleared
-        expect(items[item1].reservedBy == -1);
-        expect(items[item2].reservedBy == -1);
-        expect(items[item3].reservedBy == -1);
+        expect(itemReservedBy[item1] == -1);
+        expect(itemReservedBy[item2] == -1);
+        expect(itemReservedBy[item3] == -1);
         
         // 3. Haul job cancelled
         expect(MoverIsIdle(m) || m->currentJobId < 0 || GetJob(m->currentJobId) == NULL || !GetJob(m->currentJobId)->active);
@@ -8899,10 +9353,10 @@ describe(workshop_lifecycle) {
         moverCount = 1;
         
         // Compute initial path (will go around workshop)
-        m->needsRepath = true;
-        Point moverCell = {(int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z};
-        m->pathLength = FindPath(moverPathAlgorithm, moverCell, m->goal, moverPaths[0], MAX_PATH);
-        int pathLengthWithWorkshop = m->pathLength;
+        moverNeedsRepath[0] = true;
+        Point moverCell = {(int)(moverPosX[0] / CELL_SIZE), (int)(moverPosY[0] / CELL_SIZE), (int)moverPosZ[0]};
+        moverPathLength[0] = FindPath(moverPathAlgorithm, moverCell, m->goal, moverPaths[0], MAX_PATH);
+        int pathLengthWithWorkshop = moverPathLength[0];
         
         // Now DELETE the workshop
         DeleteWorkshop(wsIdx);
@@ -8910,10 +9364,10 @@ describe(workshop_lifecycle) {
         // Player expectation: path should be invalidated immediately
         // (because CreateWorkshop calls InvalidatePathsThroughCell, DeleteWorkshop should too)
         // The mover should be marked for repath
-        expect(m->needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
         
         // After repath, the path should be shorter (can go through former workshop area)
-        Point moverCell2 = {(int)(m->x / CELL_SIZE), (int)(m->y / CELL_SIZE), (int)m->z};
+        Point moverCell2 = {(int)(moverPosX[0] / CELL_SIZE), (int)(moverPosY[0] / CELL_SIZE), (int)moverPosZ[0]};
         int newPathLength = FindPath(moverPathAlgorithm, moverCell2, m->goal, moverPaths[0], MAX_PATH);
         
         // With workshop: must detour around. Without: straight line possible.
@@ -8964,8 +9418,8 @@ describe(workshop_lifecycle) {
 
         // Create a craft job for bill #1 (Cut Sticks, recipe 1)
         int logIdx = SpawnItemWithMaterial(workX, workY, 0.0f, ITEM_LOG, MAT_OAK);
-        items[logIdx].state = ITEM_CARRIED;
-        items[logIdx].reservedBy = 0;
+        itemState[logIdx] = ITEM_CARRIED;
+        itemReservedBy[logIdx] = 0;
 
         int jobId = CreateJob(JOBTYPE_CRAFT);
         Job* job = GetJob(jobId);
@@ -9126,12 +9580,12 @@ describe(designation_lifecycle) {
         bool foundAtCorrectZ = false;
         bool foundAtWrongZ = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
-            int ix = (int)(items[i].x / CELL_SIZE);
-            int iy = (int)(items[i].y / CELL_SIZE);
+            if (!itemActive[i]) continue;
+            int ix = (int)(itemPosX[i] / CELL_SIZE);
+            int iy = (int)(itemPosY[i] / CELL_SIZE);
             if (ix == 2 && iy == 2) {
-                if ((int)items[i].z == 2) foundAtCorrectZ = true;
-                if ((int)items[i].z == 1) foundAtWrongZ = true;
+                if ((int)itemPosZ[i] == 2) foundAtCorrectZ = true;
+                if ((int)itemPosZ[i] == 1) foundAtWrongZ = true;
             }
         }
         expect(foundAtCorrectZ == true);
@@ -9158,15 +9612,14 @@ describe(designation_lifecycle) {
         InitMover(&movers[0], 0 * CELL_SIZE + CELL_SIZE * 0.5f,
                   0 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
         moverCount = 1;
-        Mover* m = &movers[0];
-        m->active = true;
+        moverActive[0] = true;
 
         // Give the mover a fake path through (5,2,0)
         moverPaths[0][0].x = 5; moverPaths[0][0].y = 2; moverPaths[0][0].z = 0;
         moverPaths[0][1].x = 6; moverPaths[0][1].y = 2; moverPaths[0][1].z = 0;
-        m->pathLength = 2;
-        m->pathIndex = 1;
-        m->needsRepath = false;
+        moverPathLength[0] = 2;
+        moverPathIndex[0] = 1;
+        moverNeedsRepath[0] = false;
 
         // Create and complete a wall blueprint at (5,2,0)
         int bpIdx = CreateRecipeBlueprint(5, 2, 0, CONSTRUCTION_DRY_STONE_WALL);
@@ -9176,7 +9629,7 @@ describe(designation_lifecycle) {
         CompleteBlueprint(bpIdx);
 
         // The mover's path should be invalidated
-        expect(m->needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
     }
 
     // Finding 5 (MEDIUM): CompleteBlueprint (RAMP) missing rampCount++
@@ -9246,7 +9699,7 @@ describe(designation_lifecycle) {
 
         int itemsBefore = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active) itemsBefore++;
+            if (itemActive[i]) itemsBefore++;
         }
 
         // Cancel the blueprint - materials should be refunded
@@ -9255,10 +9708,10 @@ describe(designation_lifecycle) {
         int itemsAfter = 0;
         bool foundRefund = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             itemsAfter++;
-            int ix = (int)(items[i].x / CELL_SIZE);
-            int iy = (int)(items[i].y / CELL_SIZE);
+            int ix = (int)(itemPosX[i] / CELL_SIZE);
+            int iy = (int)(itemPosY[i] / CELL_SIZE);
             if (ix == 2 && iy == 2 && items[i].type == ITEM_BLOCKS) {
                 foundRefund = true;
             }
@@ -9311,8 +9764,8 @@ describe(designation_lifecycle) {
         CompleteBlueprint(bpIdx);
 
         // Item should have been pushed out of (2,2)
-        int itemTileX = (int)(items[itemIdx].x / CELL_SIZE);
-        int itemTileY = (int)(items[itemIdx].y / CELL_SIZE);
+        int itemTileX = (int)(itemPosX[itemIdx] / CELL_SIZE);
+        int itemTileY = (int)(itemPosY[itemIdx] / CELL_SIZE);
         bool pushed = (itemTileX != 2 || itemTileY != 2);
         expect(pushed == true);
     }
@@ -9348,13 +9801,13 @@ describe(designation_lifecycle) {
             3 * CELL_SIZE + CELL_SIZE * 0.5f,
             2 * CELL_SIZE + CELL_SIZE * 0.5f,
             1.0f, ITEM_ROCK);
-        items[itemIdx].unreachableCooldown = 10.0f;
+        itemUnreachableCooldown[itemIdx] = 10.0f;
 
         // Dig the ramp at (2,2,0) - opens new paths
         CompleteDigRampDesignation(2, 2, 0, -1);
 
         // Nearby item's unreachable cooldown should be cleared
-        expect(items[itemIdx].unreachableCooldown == 0.0f);
+        expect(itemUnreachableCooldown[itemIdx] == 0.0f);
     }
 }
 
@@ -9425,15 +9878,15 @@ describe(unreachable_cooldown_poisoning) {
         // Verify setup: both movers idle, item on ground
         expect(MoverIsIdle(stranded));
         expect(MoverIsIdle(worker));
-        expect(items[itemIdx].state == ITEM_ON_GROUND);
-        expect(items[itemIdx].unreachableCooldown == 0.0f);
+        expect(itemState[itemIdx] == ITEM_ON_GROUND);
+        expect(itemUnreachableCooldown[itemIdx] == 0.0f);
 
         // Run AssignJobs — the stranded mover should NOT poison the item
         AssignJobs();
 
         // Player expectation: the item should NOT have an unreachable cooldown.
         // The z=1 worker mover can reach it, so it should get a haul job.
-        expect(items[itemIdx].unreachableCooldown == 0.0f);
+        expect(itemUnreachableCooldown[itemIdx] == 0.0f);
 
         // The worker mover (z=1) should have gotten the job
         expect(!MoverIsIdle(worker));
@@ -9476,7 +9929,7 @@ describe(unreachable_cooldown_poisoning) {
         AssignJobs();
 
         // Truly unreachable items should still get cooldown
-        expect(items[itemIdx].unreachableCooldown > 0.0f);
+        expect(itemUnreachableCooldown[itemIdx] > 0.0f);
         expect(MoverIsIdle(m));
     }
 
@@ -9547,7 +10000,7 @@ describe(unreachable_cooldown_poisoning) {
         // Count how many items got poisoned with unreachable cooldown
         int poisonedCount = 0;
         for (int i = 0; i < 5; i++) {
-            if (items[itemIds[i]].unreachableCooldown > 0.0f) poisonedCount++;
+            if (itemUnreachableCooldown[itemIds[i]] > 0.0f) poisonedCount++;
         }
 
         // The worker gets assigned to one item. The remaining items have no
@@ -9620,7 +10073,7 @@ describe(saveload_state_restoration) {
         // Count how many items are actually active
         int actualCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active) actualCount++;
+            if (itemActive[i]) actualCount++;
         }
         
         expect(itemCount == actualCount);
@@ -9740,7 +10193,7 @@ describe(saveload_state_restoration) {
         // Count actual active items
         int actualCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active) actualCount++;
+            if (itemActive[i]) actualCount++;
         }
         
         expect(itemCount == actualCount);
@@ -9931,7 +10384,7 @@ describe(saveload_state_restoration) {
         
         // Create an item and give it a stale reservation
         int itemIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f, 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
-        items[itemIdx].reservedBy = 42;  // Stale reservation from pre-load mover
+        itemReservedBy[itemIdx] = 42;  // Stale reservation from pre-load mover
         
         // Create a stockpile
         int spIdx = CreateStockpile(8, 8, 0, 1, 1);
@@ -10392,13 +10845,12 @@ describe(input_audit_soil_repath) {
         InitMover(&movers[0], 0 * CELL_SIZE + CELL_SIZE * 0.5f,
                   0 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
         moverCount = 1;
-        Mover* m = &movers[0];
-        m->active = true;
+        moverActive[0] = true;
         moverPaths[0][0].x = 5; moverPaths[0][0].y = 2; moverPaths[0][0].z = 0;
         moverPaths[0][1].x = 6; moverPaths[0][1].y = 2; moverPaths[0][1].z = 0;
-        m->pathLength = 2;
-        m->pathIndex = 1;
-        m->needsRepath = false;
+        moverPathLength[0] = 2;
+        moverPathIndex[0] = 1;
+        moverNeedsRepath[0] = false;
         
         // Simulate what ExecuteBuildSoil does: place solid soil
         // (ExecuteBuildSoil does NOT set needsRepath - that's the bug)
@@ -10407,7 +10859,7 @@ describe(input_audit_soil_repath) {
         InvalidatePathsThroughCell(5, 2, 0);
         
         // Player expectation: mover should need a repath
-        expect(m->needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
     }
 }
 
@@ -10464,13 +10916,12 @@ describe(input_audit_grass_placement) {
         InitMover(&movers[0], 0 * CELL_SIZE + CELL_SIZE * 0.5f,
                   0 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, 100.0f);
         moverCount = 1;
-        Mover* m = &movers[0];
-        m->active = true;
+        moverActive[0] = true;
         moverPaths[0][0].x = 5; moverPaths[0][0].y = 2; moverPaths[0][0].z = 0;
         moverPaths[0][1].x = 6; moverPaths[0][1].y = 2; moverPaths[0][1].z = 0;
-        m->pathLength = 2;
-        m->pathIndex = 1;
-        m->needsRepath = false;
+        moverPathLength[0] = 2;
+        moverPathIndex[0] = 1;
+        moverNeedsRepath[0] = false;
         
         // Simulate FIXED grass placement on air -> solid dirt
         PlaceCellFull(5, 2, 0, NaturalTerrainSpec(CELL_WALL, MAT_DIRT, SURFACE_BARE, true, false));
@@ -10478,7 +10929,7 @@ describe(input_audit_grass_placement) {
         SetVegetation(5, 2, 0, VEG_GRASS_TALL);
         
         // Player expectation: mover should need a repath
-        expect(m->needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
     }
 }
 
@@ -10508,7 +10959,7 @@ describe(input_audit_erase_designations) {
         SetWallMaterial(5, 3, 0, MAT_GRANITE);
         bool designated = DesignateMine(5, 3, 0);
         expect(designated == true);
-        expect(designations[0][3][5].type == DESIGNATION_MINE);
+        expect(DesignationAt(5, 3, 0)->type == DESIGNATION_MINE);
         
         // Simulate what the FIXED ExecuteErase does: cancel designation + erase
         CancelDesignation(5, 3, 0);
@@ -10518,7 +10969,7 @@ describe(input_audit_erase_designations) {
         MarkChunkDirty(5, 3, 0);
         
         // Player expectation: designation should be gone
-        expect(designations[0][3][5].type == DESIGNATION_NONE);
+        expect(DesignationAt(5, 3, 0)->type == DESIGNATION_NONE);
     }
     
     it("erasing cells under a stockpile should remove stockpile cells (Finding 6)") {
@@ -10578,7 +11029,7 @@ describe(input_audit_erase_designations) {
         // Designate it for chopping
         bool designated = DesignateChop(5, 3, 0);
         expect(designated == true);
-        expect(designations[0][3][5].type == DESIGNATION_CHOP);
+        expect(DesignationAt(5, 3, 0)->type == DESIGNATION_CHOP);
         
         // Simulate what the FIXED ExecuteRemoveTree does: cancel designation + clear
         CancelDesignation(5, 3, 0);
@@ -10587,7 +11038,7 @@ describe(input_audit_erase_designations) {
         MarkChunkDirty(5, 3, 0);
         
         // Player expectation: designation should be gone
-        expect(designations[0][3][5].type == DESIGNATION_NONE);
+        expect(DesignationAt(5, 3, 0)->type == DESIGNATION_NONE);
     }
 }
 
@@ -10675,7 +11126,7 @@ describe(passive_workshop) {
 
         int idx = SpawnItem(100.0f, 100.0f, 0.0f, ITEM_DRIED_GRASS);
         expect(idx >= 0);
-        expect(items[idx].active == true);
+        expect(itemActive[idx] == true);
         expect(items[idx].type == ITEM_DRIED_GRASS);
         expect(ItemIsStackable(ITEM_DRIED_GRASS));
         expect(DefaultMaterialForItemType(ITEM_DRIED_GRASS) == MAT_NONE);
@@ -10798,9 +11249,9 @@ describe(passive_workshop) {
             JobsTick();
 
             // Check if grass item is on the work tile
-            if (items[grassIdx].active && items[grassIdx].state == ITEM_ON_GROUND) {
-                int itemTileX = (int)(items[grassIdx].x / CELL_SIZE);
-                int itemTileY = (int)(items[grassIdx].y / CELL_SIZE);
+            if (itemActive[grassIdx] && itemState[grassIdx] == ITEM_ON_GROUND) {
+                int itemTileX = (int)(itemPosX[grassIdx] / CELL_SIZE);
+                int itemTileY = (int)(itemPosY[grassIdx] / CELL_SIZE);
                 if (itemTileX == ws->workTileX && itemTileY == ws->workTileY) {
                     delivered = true;
                     break;
@@ -10897,15 +11348,15 @@ describe(passive_workshop) {
         }
 
         // Grass should be consumed (slot may be reused by output item)
-        bool grassConsumed = !items[grassIdx].active || items[grassIdx].type != ITEM_GRASS;
+        bool grassConsumed = !itemActive[grassIdx] || items[grassIdx].type != ITEM_GRASS;
         expect(grassConsumed == true);
 
         // Dried grass should exist at output tile
         bool foundDriedGrass = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_DRIED_GRASS) {
-                int tileX = (int)(items[i].x / CELL_SIZE);
-                int tileY = (int)(items[i].y / CELL_SIZE);
+            if (itemActive[i] && items[i].type == ITEM_DRIED_GRASS) {
+                int tileX = (int)(itemPosX[i] / CELL_SIZE);
+                int tileY = (int)(itemPosY[i] / CELL_SIZE);
                 if (tileX == ws->outputTileX && tileY == ws->outputTileY) {
                     foundDriedGrass = true;
                     break;
@@ -10947,7 +11398,7 @@ describe(passive_workshop) {
         for (int i = 0; i < 800; i++) {
             PassiveWorkshopsTick(TICK_DT);
         }
-        bool grass1Consumed = !items[grass1].active || items[grass1].type != ITEM_GRASS;
+        bool grass1Consumed = !itemActive[grass1] || items[grass1].type != ITEM_GRASS;
         expect(grass1Consumed == true);
         expect(ws->bills[0].completedCount == 1);
 
@@ -10962,7 +11413,7 @@ describe(passive_workshop) {
         }
 
         // Second grass should still be there (not consumed)
-        expect(items[grass2].active == true);
+        expect(itemActive[grass2] == true);
     }
 
     it("passive workshop DO_FOREVER continues") {
@@ -11109,7 +11560,7 @@ describe(passive_workshop) {
         DeleteWorkshop(wsIdx);
 
         // Grass item should still exist
-        expect(items[grassIdx].active == true);
+        expect(itemActive[grassIdx] == true);
     }
 }
 
@@ -11169,9 +11620,9 @@ describe(semi_passive_workshop) {
             AssignJobs();
             JobsTick();
 
-            if (items[logIdx].active && items[logIdx].state == ITEM_ON_GROUND) {
-                int itemTileX = (int)(items[logIdx].x / CELL_SIZE);
-                int itemTileY = (int)(items[logIdx].y / CELL_SIZE);
+            if (itemActive[logIdx] && itemState[logIdx] == ITEM_ON_GROUND) {
+                int itemTileX = (int)(itemPosX[logIdx] / CELL_SIZE);
+                int itemTileY = (int)(itemPosY[logIdx] / CELL_SIZE);
                 if (itemTileX == ws->workTileX && itemTileY == ws->workTileY) {
                     delivered = true;
                     break;
@@ -11370,14 +11821,14 @@ describe(semi_passive_workshop) {
         }
 
         // Log should be consumed
-        expect(!items[logIdx].active || items[logIdx].type != ITEM_LOG);
+        expect(!itemActive[logIdx] || items[logIdx].type != ITEM_LOG);
 
         // Charcoal should exist at output tile
         bool foundCharcoal = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_CHARCOAL) {
-                int tx = (int)(items[i].x / CELL_SIZE);
-                int ty = (int)(items[i].y / CELL_SIZE);
+            if (itemActive[i] && items[i].type == ITEM_CHARCOAL) {
+                int tx = (int)(itemPosX[i] / CELL_SIZE);
+                int ty = (int)(itemPosY[i] / CELL_SIZE);
                 if (tx == ws->outputTileX && ty == ws->outputTileY) {
                     foundCharcoal = true;
                     break;
@@ -11473,11 +11924,11 @@ describe(semi_passive_workshop) {
         }
 
         // Grass should be consumed, dried grass should exist
-        expect(!items[grassIdx].active || items[grassIdx].type != ITEM_GRASS);
+        expect(!itemActive[grassIdx] || items[grassIdx].type != ITEM_GRASS);
 
         bool foundDriedGrass = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_DRIED_GRASS) {
+            if (itemActive[i] && items[i].type == ITEM_DRIED_GRASS) {
                 foundDriedGrass = true;
                 break;
             }
@@ -11618,7 +12069,7 @@ describe(semi_passive_workshop) {
         // Charcoal should exist
         bool foundCharcoal = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_CHARCOAL) {
+            if (itemActive[i] && items[i].type == ITEM_CHARCOAL) {
                 foundCharcoal = true;
                 break;
             }
@@ -11670,8 +12121,8 @@ describe(semi_passive_workshop) {
         expect(jobId == -1);
 
         // Item should still be on ground, unreserved
-        expect(items[grassIdx].state == ITEM_ON_GROUND);
-        expect(items[grassIdx].reservedBy == -1);
+        expect(itemState[grassIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[grassIdx] == -1);
     }
 
     it("delivered item stays on work tile and passive timer completes") {
@@ -11727,7 +12178,7 @@ describe(semi_passive_workshop) {
         // Output item should exist
         bool foundOutput = false;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_DRIED_GRASS) {
+            if (itemActive[i] && items[i].type == ITEM_DRIED_GRASS) {
                 foundOutput = true;
                 break;
             }
@@ -11799,7 +12250,7 @@ describe(semi_passive_workshop) {
         // Each burn spawns 1 item with stackCount=2, so sum stackCounts
         charcoalCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_CHARCOAL) {
+            if (itemActive[i] && items[i].type == ITEM_CHARCOAL) {
                 charcoalCount += items[i].stackCount;
             }
         }
@@ -11852,8 +12303,8 @@ describe(semi_passive_workshop) {
         expect(jobId == -1);
 
         // The log should still be on the work tile, unreserved
-        expect(items[logIdx].active == true);
-        expect(items[logIdx].reservedBy == -1);
+        expect(itemActive[logIdx] == true);
+        expect(itemReservedBy[logIdx] == -1);
     }
 }
 
@@ -11921,8 +12372,8 @@ describe(chop_felled_transition) {
         // FellTree clears the trunk and CHOP designation, places CELL_TREE_FELLED
         // at the SAME cell. Crucially, FellTree does NOT invalidate the chop cache.
         grid[1][3][5] = CELL_AIR;  // Trunk removed
-        designations[1][3][5].type = DESIGNATION_NONE;  // CHOP designation cleared
-        designations[1][3][5].assignedMover = -1;
+        DesignationForWrite(5, 3, 1)->type = DESIGNATION_NONE;  // CHOP designation cleared
+        DesignationForWrite(5, 3, 1)->assignedMover = -1;
         activeDesignationCount--;
 
         // Felled trunk lands at same cell (this is what FellTree does)
@@ -11937,8 +12388,8 @@ describe(chop_felled_transition) {
         // Step 3: Player designates CHOP_FELLED on the felled trunk
         bool designated = DesignateChopFelled(5, 3, 1);
         expect(designated == true);
-        expect(designations[1][3][5].type == DESIGNATION_CHOP_FELLED);
-        expect(designations[1][3][5].assignedMover == -1);
+        expect(DesignationAt(5, 3, 1)->type == DESIGNATION_CHOP_FELLED);
+        expect(DesignationAt(5, 3, 1)->assignedMover == -1);
 
         // Step 4: Run AssignJobs — mover should get a CHOP_FELLED job, not
         // have the CHOP_FELLED designation stolen by WorkGiver_Chop
@@ -11947,7 +12398,7 @@ describe(chop_felled_transition) {
         AssignJobs();
 
         // The designation should be assigned to mover 0
-        expect(designations[1][3][5].assignedMover == 0);
+        expect(DesignationAt(5, 3, 1)->assignedMover == 0);
 
         // Mover 0 should have a CHOP_FELLED job, NOT a CHOP job
         expect(m->currentJobId >= 0);
@@ -12200,7 +12651,7 @@ describe(construction_recipe_delivery) {
         // First job assignment should reserve one rock
         AssignJobs();
         expect(MoverHasHaulToBlueprintJob(m));
-        expect(items[rock1].reservedBy >= 0);
+        expect(itemReservedBy[rock1] >= 0);
 
         Blueprint* bp = &blueprints[bpIdx];
         // After assignment, slot should track the reservation
@@ -12610,7 +13061,7 @@ describe(construction_wattle_parallel) {
         AssignJobs();
 
         // Only one blueprint should get the cordage reserved
-        expect(items[cordageIdx].reservedBy >= 0);
+        expect(itemReservedBy[cordageIdx] >= 0);
         int targetBp = MoverGetTargetBlueprint(m);
         expect(targetBp == bp1 || targetBp == bp2);
 
@@ -14331,8 +14782,8 @@ describe(construction_cancellation) {
         for (int i = 0; i < MAX_ITEMS; i++) {
             if (!IsItemActive(i)) continue;
             itemsAfter++;
-            int ix = (int)(items[i].x / CELL_SIZE);
-            int iy = (int)(items[i].y / CELL_SIZE);
+            int ix = (int)(itemPosX[i] / CELL_SIZE);
+            int iy = (int)(itemPosY[i] / CELL_SIZE);
             if (ix == 4 && iy == 4 && items[i].type == ITEM_ROCK && items[i].material == MAT_GRANITE) {
                 rocksAtBp++;
             }
@@ -14504,7 +14955,7 @@ describe(construction_cancellation) {
         moverCount = 1;
 
         // Simulate: item reserved, mover has haul-to-blueprint job
-        items[r1].reservedBy = 0;
+        itemReservedBy[r1] = 0;
         bp->stageDeliveries[0].reservedCount = 1;
 
         int jobId = CreateJob(JOBTYPE_HAUL_TO_BLUEPRINT);
@@ -14520,9 +14971,9 @@ describe(construction_cancellation) {
         // Mover should be idle with no job
         expect(m->currentJobId == -1);
         // Item reservation should be released
-        expect(items[r1].reservedBy == -1);
+        expect(itemReservedBy[r1] == -1);
         // Item should still be active (it was just reserved, not consumed)
-        expect(items[r1].active == true);
+        expect(itemActive[r1] == true);
         expect(bp->active == false);
     }
 
@@ -14572,7 +15023,7 @@ describe(construction_cancellation) {
         RebuildBlueprintWorkCache();
         int jobId = WorkGiver_BlueprintHaul(0);
         expect(jobId >= 0);
-        expect(items[r1].reservedBy == 0 || items[r2].reservedBy == 0 || items[r3].reservedBy == 0);
+        expect(itemReservedBy[r1] == 0 || itemReservedBy[r2] == 0 || itemReservedBy[r3] == 0);
         expect(bp->stageDeliveries[0].reservedCount == 1);
 
         // Cancel the blueprint while mover is hauling
@@ -14581,13 +15032,192 @@ describe(construction_cancellation) {
         // Mover's job should be cancelled
         expect(m->currentJobId == -1);
         // All items unreserved
-        expect(items[r1].reservedBy == -1);
-        expect(items[r2].reservedBy == -1);
-        expect(items[r3].reservedBy == -1);
+        expect(itemReservedBy[r1] == -1);
+        expect(itemReservedBy[r2] == -1);
+        expect(itemReservedBy[r3] == -1);
         expect(bp->active == false);
     }
 }
 
+// Items and movers live in hot arrays plus cold structs; saves still hold
+// one ItemRecord/MoverRecord each, in the layout saves have always had
+static long ReadSaveFile(const char* path, unsigned char** out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    *out = (unsigned char*)malloc(size);
+    if (fread(*out, 1, size, f) != (size_t)size) size = -1;
+    fclose(f);
+    return size;
+}
+
+describe(item_save_records) {
+    it("should keep the on-disk item layout") {
+        // Same offsets as the v91 record, plus temperature on the end
+        expect(offsetof(ItemRecord, x) == offsetof(ItemV91, x));
+        expect(offsetof(ItemRecord, state) == offsetof(ItemV91, state));
+        expect(offsetof(ItemRecord, active) == offsetof(ItemV91, active));
+        expect(offsetof(ItemRecord, reservedBy) == offsetof(ItemV91, reservedBy));
+        expect(offsetof(ItemRecord, unreachableCooldown) == offsetof(ItemV91, unreachableCooldown));
+        expect(offsetof(ItemRecord, contentTypeMask) == offsetof(ItemV91, contentTypeMask));
+        expect(offsetof(ItemRecord, condition) == offsetof(ItemV91, condition));
+        expect(offsetof(ItemRecord, temperature) == sizeof(ItemV91));
+    }
+
+    it("should round-trip hot and cold item fields through a save") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        ClearMovers();
+        ClearItems();
+        ClearJobs();
+        ClearStockpiles();
+        InitDesignations();
+
+        int rock = SpawnItemWithMaterial(3 * CELL_SIZE + 5.0f, 2 * CELL_SIZE + 7.0f, 0.0f, ITEM_ROCK, MAT_GRANITE);
+        int gone = SpawnItem(CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, ITEM_LOG);
+        int basket = SpawnItem(9 * CELL_SIZE + CELL_SIZE * 0.5f, 1 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_BASKET);
+        int berries = SpawnItem(0.0f, 0.0f, 0.0f, ITEM_BERRIES);
+        PutItemInContainer(berries, basket);
+        int spIdx = CreateStockpile(12, 2, 0, 2, 1);
+        SetStockpileFilter(spIdx, ITEM_RED, true);
+        int stored = SpawnItem(12 * CELL_SIZE + CELL_SIZE * 0.5f, 2 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, ITEM_RED);
+        PlaceItemInStockpile(spIdx, 12, 2, stored);
+        DeleteItem(gone);
+
+        itemReservedBy[rock] = 3;
+        SetItemUnreachableCooldown(rock, 7.5f);
+        items[rock].stackCount = 4;
+        items[berries].spoilageTimer = 42.0f;
+        items[berries].temperature = 61.0f;
+        items[rock].natural = true;
+
+        int hwm = itemHighWaterMark;
+        ItemRecord before[8];
+        for (int i = 0; i < hwm; i++) PackItemRecord(i, &before[i]);
+        expect(before[rock].reservedBy == 3);
+        expect(before[rock].unreachableCooldown == 7.5f);
+        expect(before[stored].state == ITEM_IN_STOCKPILE);
+        expect(before[berries].containedIn == basket);
+        expect(!before[gone].active);
+
+        expect(SaveWorld("/tmp/test_item_records_a.bin"));
+        ClearItems();
+        expect(LoadWorld("/tmp/test_item_records_a.bin"));
+
+        // Every field comes back except the reservation, which loading drops
+        expect(itemHighWaterMark == hwm);
+        expect(itemReservedBy[rock] == -1);
+        before[rock].reservedBy = -1;
+        for (int i = 0; i < hwm; i++) {
+            ItemRecord after;
+            PackItemRecord(i, &after);
+            expect(memcmp(&after, &before[i], sizeof(ItemRecord)) == 0);
+        }
+        expect(itemPosX[rock] == 3 * CELL_SIZE + 5.0f);
+        expect(itemState[berries] == ITEM_IN_CONTAINER);
+        expect(items[rock].material == MAT_GRANITE);
+
+        // With the reservation put back, saving writes the same bytes
+        itemReservedBy[rock] = 3;
+        expect(SaveWorld("/tmp/test_item_records_b.bin"));
+        unsigned char* a = NULL;
+        unsigned char* b = NULL;
+        long sizeA = ReadSaveFile("/tmp/test_item_records_a.bin", &a);
+        long sizeB = ReadSaveFile("/tmp/test_item_records_b.bin", &b);
+        expect(sizeA > 0 && sizeA == sizeB && memcmp(a, b, sizeA) == 0);
+        free(a);
+        free(b);
+        remove("/tmp/test_item_records_a.bin");
+        remove("/tmp/test_item_records_b.bin");
+    }
+}
+
+describe(mover_save_records) {
+    it("should keep the on-disk mover layout") {
+        // Same offsets as the v89 record up to the mood fields, bladder last
+        expect(offsetof(MoverRecord, x) == offsetof(MoverV89, x));
+        expect(offsetof(MoverRecord, pathLength) == offsetof(MoverV89, pathLength));
+        expect(offsetof(MoverRecord, pathIndex) == offsetof(MoverV89, pathIndex));
+        expect(offsetof(MoverRecord, active) == offsetof(MoverV89, active));
+        expect(offsetof(MoverRecord, needsRepath) == offsetof(MoverV89, needsRepath));
+        expect(offsetof(MoverRecord, avoidX) == offsetof(MoverV89, avoidX));
+        expect(offsetof(MoverRecord, currentJobId) == offsetof(MoverV89, currentJobId));
+        expect(offsetof(MoverRecord, isDrafted) == offsetof(MoverV89, isDrafted));
+        expect(offsetof(MoverRecord, bladder) + sizeof(float) == sizeof(MoverRecord));
+    }
+
+    it("should round-trip hot and cold mover fields through a save") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+
+        ClearMovers();
+        ClearItems();
+        ClearJobs();
+        ClearStockpiles();
+        InitDesignations();
+
+        Point path[] = {{9, 3, 0}, {6, 2, 0}, {2, 1, 0}};
+        InitMoverWithPath(&movers[0], 2 * CELL_SIZE + 5.0f, 1 * CELL_SIZE + 9.0f, 0.0f, (Point){9, 3, 0}, 100.0f, path, 3);
+        InitMover(&movers[1], 12 * CELL_SIZE + 16.0f, 2 * CELL_SIZE + 16.0f, 0.0f, (Point){0, 0, 0}, 90.0f);
+        InitMover(&movers[2], CELL_SIZE * 0.5f, CELL_SIZE * 0.5f, 0.0f, (Point){1, 1, 0}, 100.0f);
+        moverCount = 3;
+        moverActive[2] = false;
+
+        moverPathIndex[0] = 1;
+        moverAvoidX[0] = 0.25f;
+        moverAvoidY[0] = -0.5f;
+        moverNeedsRepath[1] = true;
+        movers[0].hunger = 0.4f;
+        movers[0].bladder = 0.3f;
+        movers[1].isDrafted = true;
+        strcpy(movers[1].name, "Ada");
+        AddMoodlet(&movers[1], MOODLET_ATE_GOOD_FOOD);
+
+        MoverRecord before[3];
+        for (int i = 0; i < moverCount; i++) PackMoverRecord(i, &before[i]);
+        expect(before[0].pathIndex == 1 && before[0].pathLength == 3);
+        expect(before[0].avoidY == -0.5f);
+        expect(before[1].needsRepath);
+        expect(before[1].moodletCount == 1);
+        expect(!before[2].active);
+
+        expect(SaveWorld("/tmp/test_mover_records_a.bin"));
+        ClearMovers();
+        expect(LoadWorld("/tmp/test_mover_records_a.bin"));
+
+        expect(moverCount == 3);
+        for (int i = 0; i < moverCount; i++) {
+            MoverRecord after;
+            PackMoverRecord(i, &after);
+            expect(memcmp(&after, &before[i], sizeof(MoverRecord)) == 0);
+        }
+        expect(moverPosX[0] == 2 * CELL_SIZE + 5.0f);
+        expect(moverPaths[0][1].x == 6);
+        expect(strcmp(movers[1].name, "Ada") == 0);
+
+        // Saving the loaded world writes the same bytes
+        expect(SaveWorld("/tmp/test_mover_records_b.bin"));
+        unsigned char* a = NULL;
+        unsigned char* b = NULL;
+        long sizeA = ReadSaveFile("/tmp/test_mover_records_a.bin", &a);
+        long sizeB = ReadSaveFile("/tmp/test_mover_records_b.bin", &b);
+        expect(sizeA > 0 && sizeA == sizeB && memcmp(a, b, sizeA) == 0);
+        free(a);
+        free(b);
+        remove("/tmp/test_mover_records_a.bin");
+        remove("/tmp/test_mover_records_b.bin");
+    }
+}
+
 int main(int argc, char* argv[]) {
     test_verbose = c89spec_parse_args(argc, argv);
     if (!test_verbose) SetTraceLogLevel(LOG_NONE);
@@ -14630,6 +15260,9 @@ int main(int argc, char* argv[]) {
     
     // Item spatial grid (optimization)
     test(item_spatial_grid);
+    test(item_renumbering);
+    test(mover_renumbering);
+    test(item_ledger);
     
     // Cell-based stockpile operations
     test(stockpile_cell_operations);
@@ -14747,6 +15380,8 @@ int main(int argc, char* argv[]) {
 
     // Construction recipe system (Phase 6 - cancellation + lossy refund)
     test(construction_cancellation);
+    test(item_save_records);
+    test(mover_save_records);
     
     return summary();
 }
@@ -33,7 +33,7 @@ static bool test_verbose = false;
 static int CountItemsOfType(ItemType type) {
     int count = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type) {
+        if (itemActive[i] && items[i].type == type) {
             count++;
         }
     }
@@ -43,7 +43,7 @@ static int CountItemsOfType(ItemType type) {
 static int CountItemsOfTypeWithMaterial(ItemType type, MaterialType mat) {
     int count = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type && items[i].material == (uint8_t)mat) {
+        if (itemActive[i] && items[i].type == type && items[i].material == (uint8_t)mat) {
             count++;
         }
     }
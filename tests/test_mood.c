@@ -509,7 +509,7 @@ static int PlaceFoodInStockpile(int cx, int cy, ItemType foodType) {
     float py = cy * CELL_SIZE + CELL_SIZE * 0.5f;
     int itemIdx = SpawnItem(px, py, 1.0f, foodType);
     PlaceItemInStockpile(spIdx, cx, cy, itemIdx);
-    items[itemIdx].state = ITEM_IN_STOCKPILE;
+    itemState[itemIdx] = ITEM_IN_STOCKPILE;
     return itemIdx;
 }
 
@@ -543,7 +543,7 @@ describe(mood_eating_triggers) {
 
         // Food consumed, moodlet should be active
         expect(m->freetimeState == FREETIME_NONE);
-        expect(!items[itemIdx].active); // item consumed
+        expect(!itemActive[itemIdx]); // item consumed
         expect(HasMoodlet(m, MOODLET_ATE_GOOD_FOOD));
         expect(!HasMoodlet(m, MOODLET_ATE_RAW_FOOD));
     }
@@ -811,7 +811,7 @@ describe(mood_drink_triggers) {
         float py = 5 * CELL_SIZE + CELL_SIZE * 0.5f;
         int itemIdx = SpawnItem(px, py, 1.0f, ITEM_HERBAL_TEA);
         PlaceItemInStockpile(spIdx, 5, 5, itemIdx);
-        items[itemIdx].state = ITEM_IN_STOCKPILE;
+        itemState[itemIdx] = ITEM_IN_STOCKPILE;
 
         // Tick until mover starts drinking
         for (int i = 0; i < 300 && m->freetimeState != FREETIME_DRINKING; i++) SimNeedsTick();
@@ -1082,6 +1082,44 @@ describe(scenery_beauty_count) {
         int count = CountBeautySources(15, 15, 1, 6);
         expect(count == 4);
     }
+
+    it("count follows cell changes once the chunk is marked dirty") {
+        SetupSceneryGrid();
+        expect(CountBeautySources(15, 15, 1, 6) == 0);
+
+        grid[1][15][14] = CELL_TREE_TRUNK;
+        SetWallMaterial(14, 15, 1, MAT_OAK);
+        MarkChunkDirty(14, 15, 1);
+        expect(CountBeautySources(15, 15, 1, 6) == 1);
+
+        SetWaterLevel(16, 16, 1, 3);
+        expect(CountBeautySources(15, 15, 1, 6) == 2);
+
+        int pi = SpawnPlant(15, 13, 1, PLANT_BERRY_BUSH);
+        expect(CountBeautySources(15, 15, 1, 6) == 3);
+        DeletePlant(pi);
+        expect(CountBeautySources(15, 15, 1, 6) == 2);
+    }
+
+    it("summed-area count matches a brute-force scan near grid edges") {
+        SetupSceneryGrid();
+        for (int i = 0; i < 60; i++) {
+            int x = (i * 7) % 30, y = (i * 13) % 30;
+            grid[(i % 3 == 0) ? 2 : 1][y][x] = CELL_TREE_LEAVES;
+        }
+        for (int cy = 0; cy < 30; cy += 4) {
+            for (int cx = 0; cx < 30; cx += 4) {
+                int expected = 0;
+                for (int y = cy - 6; y <= cy + 6; y++) {
+                    for (int x = cx - 6; x <= cx + 6; x++) {
+                        if (x < 0 || x >= 30 || y < 0 || y >= 30) continue;
+                        if (grid[1][y][x] == CELL_TREE_LEAVES || grid[2][y][x] == CELL_TREE_LEAVES) expected++;
+                    }
+                }
+                expect(CountBeautySources(cx, cy, 1, 6) == expected);
+            }
+        }
+    }
 }
 
 describe(scenery_moodlets) {
@@ -1178,6 +1216,7 @@ describe(scenery_moodlets) {
         for (int i = 0; i < 5; i++) {
             grid[1][14][13 + i] = CELL_TREE_TRUNK;
             SetWallMaterial(13 + i, 14, 1, MAT_OAK);
+            MarkChunkDirty(13 + i, 14, 1);
         }
 
         // Next check should trigger pleasant view + reset bleak
@@ -1188,6 +1227,7 @@ describe(scenery_moodlets) {
         // Remove trees again, bleak should take full threshold again (accumulator was reset)
         for (int i = 0; i < 5; i++) {
             grid[1][14][13 + i] = CELL_AIR;
+            MarkChunkDirty(13 + i, 14, 1);
         }
         // 2 more checks — not enough for bleak yet (accumulator was reset to 0)
         for (int c = 0; c < 2; c++) {
@@ -1246,6 +1286,7 @@ describe(scenery_moodlets) {
         for (int i = 0; i < 5; i++) {
             grid[1][14][13 + i] = CELL_TREE_TRUNK;
             SetWallMaterial(13 + i, 14, 1, MAT_OAK);
+            MarkChunkDirty(13 + i, 14, 1);
         }
         TickMood(3000);
         expect(m->mood > baseline);
@@ -7,6 +7,11 @@
 #include "../src/world/pathfinding.h"
 #include "../src/entities/mover.h"
 #include "../src/entities/workshops.h"
+#include "../src/entities/animals.h"
+#include "../src/entities/trains.h"
+#include "../src/entities/jobs.h"
+#include "../src/entities/path_index.h"
+#include "../src/simulation/water.h"
 #include "../src/world/terrain.h"
 #include <stdlib.h>
 #include <string.h>
@@ -35,11 +40,11 @@ describe(mover_initialization) {
         InitMover(m, 16.0f, 16.0f, 0.0f, goal, 100.0f);
         moverCount = 1;
 
-        expect(m->x == 16.0f);
-        expect(m->y == 16.0f);
+        expect(moverPosX[0] == 16.0f);
+        expect(moverPosY[0] == 16.0f);
         expect(m->goal.x == 7 && m->goal.y == 3);
         expect(m->speed == 100.0f);
-        expect(m->active == true);
+        expect(moverActive[0] == true);
     }
 
     it("should initialize mover with path") {
@@ -82,13 +87,13 @@ describe(fixed_timestep_movement) {
         InitMoverWithPath(m, startX, startY, 0.0f, goal, 100.0f, testPath, 2);
         moverCount = 1;
 
-        float initialX = m->x;
+        float initialX = moverPosX[0];
 
         // Run 1 tick
         Tick();
 
         // Mover should have moved right (toward goal at x=4)
-        expect(m->x > initialX);
+        expect(moverPosX[0] > initialX);
     }
 
     it("should produce same result for same number of ticks") {
@@ -109,8 +114,8 @@ describe(fixed_timestep_movement) {
         moverCount = 1;
 
         RunTicks(60);  // 1 second of simulation
-        float firstRunX = m->x;
-        float firstRunY = m->y;
+        float firstRunX = moverPosX[0];
+        float firstRunY = moverPosY[0];
 
         // Second run - same setup
         ClearMovers();
@@ -119,8 +124,8 @@ describe(fixed_timestep_movement) {
         moverCount = 1;
 
         RunTicks(60);
-        float secondRunX = m->x;
-        float secondRunY = m->y;
+        float secondRunX = moverPosX[0];
+        float secondRunY = moverPosY[0];
 
         // Should be identical (combine into single expect)
         expect(firstRunX == secondRunX && firstRunY == secondRunY);
@@ -149,7 +154,7 @@ describe(fixed_timestep_movement) {
         // At 60 ticks/sec, 1 tick = ~1.67 pixels. Need ~19 ticks for 1 cell.
         RunTicks(60);  // Should be more than enough
 
-        expect(m->active == false);
+        expect(moverActive[0] == false);
         
         endlessMoverMode = true;  // Restore default
     }
@@ -183,8 +188,8 @@ describe(wall_collision) {
         Tick();
 
         // Mover should have moved to a neighbor cell and need repath
-        int cellX = (int)(m->x / CELL_SIZE);
-        int cellY = (int)(m->y / CELL_SIZE);
+        int cellX = (int)(moverPosX[0] / CELL_SIZE);
+        int cellY = (int)(moverPosY[0] / CELL_SIZE);
         expect(!(cellX == 1 && cellY == 1) && GetMoverNeedsRepath(0) == true);
     }
 
@@ -212,7 +217,7 @@ describe(wall_collision) {
         Tick();
 
         // Mover should be deactivated (no escape)
-        expect(m->active == false);
+        expect(moverActive[0] == false);
     }
 }
 
@@ -298,7 +303,7 @@ describe(count_active_movers) {
         expect(CountActiveMovers() == 3);
 
         // Deactivate one
-        movers[1].active = false;
+        moverActive[1] = false;
 
         expect(CountActiveMovers() == 2);
     }
@@ -335,7 +340,7 @@ describe(endless_mode) {
         RunTicks(60);
 
         // In endless mode, mover should still be active with a new goal
-        expect(m->active == true);
+        expect(moverActive[0] == true);
 
         endlessMoverMode = false;  // Reset
     }
@@ -379,7 +384,7 @@ describe(endless_mode) {
         RunTicks(600);  // 10 seconds of simulation
 
         // Mover should still be active after all this time
-        expect(m->active == true);
+        expect(moverActive[0] == true);
 
         endlessMoverMode = false;
     }
@@ -409,8 +414,8 @@ describe(endless_mode) {
         moverCount = 1;
 
         RunTicks(300);
-        float firstX = m->x;
-        float firstY = m->y;
+        float firstX = moverPosX[0];
+        float firstY = moverPosY[0];
         Point firstGoal = m->goal;
 
         // Second run - same seed
@@ -421,8 +426,8 @@ describe(endless_mode) {
         moverCount = 1;
 
         RunTicks(300);
-        float secondX = m->x;
-        float secondY = m->y;
+        float secondX = moverPosX[0];
+        float secondY = moverPosY[0];
         Point secondGoal = m->goal;
 
         // Should be identical
@@ -597,7 +602,7 @@ describe(refinement_after_wall_changes) {
         int stuckMovers = 0;
         for (int i = 0; i < moverCount; i++) {
             Mover* m = &movers[i];
-            if (m->active && GetMoverPathLength(i) == 0 && m->repathCooldown == 0) {
+            if (moverActive[i] && GetMoverPathLength(i) == 0 && m->repathCooldown == 0) {
                 stuckMovers++;
             }
         }
@@ -714,7 +719,7 @@ describe(refinement_after_wall_changes) {
         int stuckMovers = 0;
         for (int i = 0; i < moverCount; i++) {
             Mover* m = &movers[i];
-            if (m->active && GetMoverPathLength(i) == 0 && !GetMoverNeedsRepath(i) && m->repathCooldown == 0) {
+            if (moverActive[i] && GetMoverPathLength(i) == 0 && !GetMoverNeedsRepath(i) && m->repathCooldown == 0) {
                 stuckMovers++;
             }
         }
@@ -801,7 +806,7 @@ describe(string_pulling_narrow_gaps) {
         // int stuckYellow = 0;
         // for (int i = 0; i < moverCount; i++) {
         //     Mover* m = &movers[i];
-        //     if (m->active && m->needsRepath && m->repathCooldown == 0) {
+        //     if (moverActive[i] && moverNeedsRepath[i] && m->repathCooldown == 0) {
         //         stuckYellow++;
         //     }
         // }
@@ -882,11 +887,11 @@ describe(chunk_boundary_paths) {
         // Run until mover reaches goal or times out
         for (int tick = 0; tick < 600; tick++) {
             Tick();
-            if (!m->active) break;  // Reached goal
+            if (!moverActive[0]) break;  // Reached goal
         }
         
         // Mover should have reached the goal (inactive)
-        expect(m->active == false);
+        expect(moverActive[0] == false);
     }
 }
 
@@ -961,13 +966,13 @@ describe(mover_falling) {
         InitMover(m, startX, startY, 1.0f, goal, 100.0f);
         moverCount = 1;
         
-        expect((int)m->z == 1);  // Starts at z=1 (in air)
+        expect((int)moverPosZ[0] == 1);  // Starts at z=1 (in air)
         
         // Run one tick - falling should happen
         Tick();
         
         // Mover should have fallen to z=0
-        expect((int)m->z == 0);
+        expect((int)moverPosZ[0] == 0);
     }
     
     it("should not fall when walking on walkable cells") {
@@ -999,13 +1004,13 @@ describe(mover_falling) {
         InitMoverWithPath(m, startX, startY, 1.0f, goal, 100.0f, testPath, 2);
         moverCount = 1;
         
-        expect(m->z == 1.0f);
+        expect(moverPosZ[0] == 1.0f);
         
         // Run for a while
         RunTicks(60);
         
         // Mover should still be at z=1 (no falling)
-        expect(m->z == 1.0f);
+        expect(moverPosZ[0] == 1.0f);
     }
     
     it("should stop falling when hitting a wall below") {
@@ -1042,7 +1047,7 @@ describe(mover_falling) {
         RunTicks(60);
         
         // Mover should NOT have fallen through the wall
-        expect(m->z >= 0.0f);
+        expect(moverPosZ[0] >= 0.0f);
     }
 }
 
@@ -1076,11 +1081,11 @@ describe(mover_z_level_collision) {
         // Run until mover reaches goal or times out
         for (int tick = 0; tick < 300; tick++) {
             Tick();
-            if (!m->active) break;
+            if (!moverActive[0]) break;
         }
         
         // Mover should have reached the goal (passed through the "wall" area on z=1)
-        expect(m->active == false);
+        expect(moverActive[0] == false);
     }
     
     it("should be blocked by walls on current z-level") {
@@ -1123,7 +1128,7 @@ describe(mover_z_level_collision) {
         
         // Mover should NOT have passed the wall (x should be less than wall position)
         float wallX = 2 * CELL_SIZE;
-        expect(m->x < wallX + CELL_SIZE);  // Shouldn't be past the wall
+        expect(moverPosX[0] < wallX + CELL_SIZE);  // Shouldn't be past the wall
     }
 }
 
@@ -1171,17 +1176,17 @@ describe(mover_ladder_transitions) {
         InitMoverWithPath(m, startX, startY, (float)startZ, goal, 100.0f, testPath, 4);
         moverCount = 1;
 
-        expect((int)m->z == startZ);
+        expect((int)moverPosZ[0] == startZ);
 
         // Run until mover reaches goal or times out
         int maxTicks = 600;
         for (int tick = 0; tick < maxTicks; tick++) {
             Tick();
-            if (!m->active) break;
+            if (!moverActive[0]) break;
         }
 
         // Mover should have reached the goal
-        expect(m->active == false);
+        expect(moverActive[0] == false);
     }
 
     it("should climb ladder when path goes through ladder cell") {
@@ -1221,16 +1226,16 @@ describe(mover_ladder_transitions) {
         InitMoverWithPath(m, startX, startY, (float)startZ, goal, 100.0f, testPath, 4);
         moverCount = 1;
 
-        expect((int)m->z == startZ);
+        expect((int)moverPosZ[0] == startZ);
 
         // Run simulation
         for (int tick = 0; tick < 300; tick++) {
             Tick();
-            if (!m->active) break;
+            if (!moverActive[0]) break;
         }
 
         // Mover should have reached goal
-        expect(m->active == false);
+        expect(moverActive[0] == false);
     }
 
     it("should handle JPS+ 3D path through Labyrinth3D") {
@@ -1322,11 +1327,11 @@ describe(mover_ladder_transitions) {
             // Run simulation - long paths across z-levels need more time
             for (int tick = 0; tick < 3000; tick++) {
                 Tick();
-                if (!m->active) break;
+                if (!moverActive[0]) break;
             }
 
             // Mover should have reached goal
-            expect(m->active == false);
+            expect(moverActive[0] == false);
         }
     }
 
@@ -1462,16 +1467,16 @@ describe(mover_ladder_transitions) {
                 // Run simulation - 10000 ticks allows traversing long labyrinth paths
                 for (int tick = 0; tick < 10000; tick++) {
                     Tick();
-                    if (!m->active) break;
+                    if (!moverActive[0]) break;
                 }
 
-                if (!m->active) {
+                if (!moverActive[0]) {
                     moversReachedGoal++;
                 } else {
                     // Debug: mover got stuck
-                    int stuckX = (int)(m->x / CELL_SIZE);
-                    int stuckY = (int)(m->y / CELL_SIZE);
-                    int stuckZ = (int)m->z;
+                    int stuckX = (int)(moverPosX[0] / CELL_SIZE);
+                    int stuckY = (int)(moverPosY[0] / CELL_SIZE);
+                    int stuckZ = (int)moverPosZ[0];
                     printf("STUCK: test %d, start=(%d,%d,%d) goal=(%d,%d,%d) stuck at cell=(%d,%d,%d) pathIndex=%d/%d\n",
                            test, start.x, start.y, start.z, goal.x, goal.y, goal.z,
                            stuckX, stuckY, stuckZ, GetMoverPathIndex(0), GetMoverPathLength(0));
@@ -1525,14 +1530,14 @@ describe(sparse_level_pathfinding) {
 
                 for (int tick = 0; tick < 5000; tick++) {
                     Tick();
-                    if (!m->active) break;
+                    if (!moverActive[0]) break;
                 }
 
-                if (!m->active) {
+                if (!moverActive[0]) {
                     moversReachedGoal++;
                 } else {
-                    int stuckX = (int)(m->x / CELL_SIZE);
-                    int stuckY = (int)(m->y / CELL_SIZE);
+                    int stuckX = (int)(moverPosX[0] / CELL_SIZE);
+                    int stuckY = (int)(moverPosY[0] / CELL_SIZE);
                     printf("JPS STUCK: test %d, start=(%d,%d) goal=(%d,%d) stuck at cell=(%d,%d) pathIndex=%d/%d\n",
                            test, start.x, start.y, goal.x, goal.y,
                            stuckX, stuckY, GetMoverPathIndex(0), GetMoverPathLength(0));
@@ -1582,14 +1587,14 @@ describe(sparse_level_pathfinding) {
 
                 for (int tick = 0; tick < 5000; tick++) {
                     Tick();
-                    if (!m->active) break;
+                    if (!moverActive[0]) break;
                 }
 
-                if (!m->active) {
+                if (!moverActive[0]) {
                     moversReachedGoal++;
                 } else {
-                    int stuckX = (int)(m->x / CELL_SIZE);
-                    int stuckY = (int)(m->y / CELL_SIZE);
+                    int stuckX = (int)(moverPosX[0] / CELL_SIZE);
+                    int stuckY = (int)(moverPosY[0] / CELL_SIZE);
                     printf("JPS+ STUCK: test %d, start=(%d,%d) goal=(%d,%d) stuck at cell=(%d,%d) pathIndex=%d/%d\n",
                            test, start.x, start.y, goal.x, goal.y,
                            stuckX, stuckY, GetMoverPathIndex(0), GetMoverPathLength(0));
@@ -1658,7 +1663,7 @@ describe(staggered_updates) {
         // Count how many reached their goal
         int reached = 0;
         for (int i = 0; i < moverCount; i++) {
-            if (!movers[i].active) reached++;  // Inactive means reached goal
+            if (!moverActive[i]) reached++;  // Inactive means reached goal
         }
         
         // At least 90% should reach their goals
@@ -1717,11 +1722,10 @@ describe(staggered_updates) {
             
             // Check no mover is inside a wall
             for (int i = 0; i < moverCount; i++) {
-                Mover* m = &movers[i];
-                if (!m->active) continue;
-                int cx = (int)(m->x / CELL_SIZE);
-                int cy = (int)(m->y / CELL_SIZE);
-                int cz = (int)m->z;
+                if (!moverActive[i]) continue;
+                int cx = (int)(moverPosX[i] / CELL_SIZE);
+                int cy = (int)(moverPosY[i] / CELL_SIZE);
+                int cz = (int)moverPosZ[i];
                 if (cx >= 0 && cx < gridWidth && cy >= 0 && cy < gridHeight) {
                     expect(grid[cz][cy][cx] != CELL_WALL);
                 }
@@ -1731,7 +1735,7 @@ describe(staggered_updates) {
         // Most should complete
         int reached = 0;
         for (int i = 0; i < moverCount; i++) {
-            if (!movers[i].active) reached++;
+            if (!moverActive[i]) reached++;
         }
         float completionRate = (float)reached / spawned;
         expect(completionRate >= 0.8f);
@@ -1768,8 +1772,8 @@ describe(workshop_mover_collision) {
         moverCount = 1;
         
         // Verify mover is at (1,1)
-        int cellX = (int)(m->x / CELL_SIZE);
-        int cellY = (int)(m->y / CELL_SIZE);
+        int cellX = (int)(moverPosX[0] / CELL_SIZE);
+        int cellY = (int)(moverPosY[0] / CELL_SIZE);
         expect(cellX == 1 && cellY == 1);
         
         // Place workshop at (0,0) - stonecutter is 3x3 with blocked tiles at (0,0), (1,0), (0,1), (1,1)
@@ -1778,8 +1782,8 @@ describe(workshop_mover_collision) {
         expect(wsIdx >= 0);
         
         // Mover should have been pushed out of the blocked cell
-        cellX = (int)(m->x / CELL_SIZE);
-        cellY = (int)(m->y / CELL_SIZE);
+        cellX = (int)(moverPosX[0] / CELL_SIZE);
+        cellY = (int)(moverPosY[0] / CELL_SIZE);
         
         // Check if mover was on a blocked tile - template row 1 col 1 is 'X' (work tile, not blocked)
         // Actually (1,1) relative to workshop at (0,0) is template[1*3+1] = 'X' which is walkable
@@ -1821,8 +1825,8 @@ describe(workshop_mover_collision) {
         moverCount = 1;
         
         // Verify mover is at (2,3)
-        int cellX = (int)(m->x / CELL_SIZE);
-        int cellY = (int)(m->y / CELL_SIZE);
+        int cellX = (int)(moverPosX[0] / CELL_SIZE);
+        int cellY = (int)(moverPosY[0] / CELL_SIZE);
         expect(cellX == 2 && cellY == 3);
         
         // Place workshop at (2,2) - tile (2,3) relative is row 1 col 0 = '#' (blocked)
@@ -1831,10 +1835,10 @@ describe(workshop_mover_collision) {
         expect(IsWorkshopBlocking(2, 3, 0));  // Verify (2,3) is blocked
         
         // Mover should have been pushed to adjacent walkable cell
-        cellX = (int)(m->x / CELL_SIZE);
-        cellY = (int)(m->y / CELL_SIZE);
+        cellX = (int)(moverPosX[0] / CELL_SIZE);
+        cellY = (int)(moverPosY[0] / CELL_SIZE);
         expect(!(cellX == 2 && cellY == 3));  // Should NOT be at (2,3) anymore
-        expect(m->needsRepath == true);  // Should need repath after being pushed
+        expect(moverNeedsRepath[0] == true);  // Should need repath after being pushed
         
         DeleteWorkshop(wsIdx);
     }
@@ -1864,7 +1868,7 @@ describe(workshop_mover_collision) {
         InitMoverWithPath(m, startX, startY, 0.0f, goal, 100.0f, testPath, 3);
         moverCount = 1;
         
-        expect(m->needsRepath == false);  // Path is valid initially
+        expect(moverNeedsRepath[0] == false);  // Path is valid initially
         
         // Place workshop at (0,0) - this blocks (1,0) which is in the path
         int wsIdx = CreateWorkshop(0, 0, 0, WORKSHOP_STONECUTTER);
@@ -1872,7 +1876,7 @@ describe(workshop_mover_collision) {
         expect(IsWorkshopBlocking(1, 0, 0));  // (1,0) should be blocked
         
         // Mover's path goes through (1,0), so it should need repath
-        expect(m->needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
         
         DeleteWorkshop(wsIdx);
     }
@@ -1998,8 +2002,8 @@ describe(workshop_mover_collision) {
         RunTicks(300);
         
         // Mover should NOT be inside a blocked workshop tile
-        int cellX = (int)(m->x / CELL_SIZE);
-        int cellY = (int)(m->y / CELL_SIZE);
+        int cellX = (int)(moverPosX[0] / CELL_SIZE);
+        int cellY = (int)(moverPosY[0] / CELL_SIZE);
         expect(!IsWorkshopBlocking(cellX, cellY, 0));
         
         DeleteWorkshop(wsIdx);
@@ -2073,12 +2077,11 @@ describe(workshop_mover_collision) {
         // Check that NO movers are stuck inside workshop-blocked tiles
         int stuckInWorkshop = 0;
         for (int i = 0; i < moverCount; i++) {
-            Mover* m = &movers[i];
-            if (!m->active) continue;
+            if (!moverActive[i]) continue;
             
-            int cellX = (int)(m->x / CELL_SIZE);
-            int cellY = (int)(m->y / CELL_SIZE);
-            int cellZ = (int)m->z;
+            int cellX = (int)(moverPosX[i] / CELL_SIZE);
+            int cellY = (int)(moverPosY[i] / CELL_SIZE);
+            int cellZ = (int)moverPosZ[i];
             
             if (IsWorkshopBlocking(cellX, cellY, cellZ)) {
                 stuckInWorkshop++;
@@ -2126,21 +2129,21 @@ describe(mover_ramp_transitions) {
         InitMoverWithPath(m, startX, startY, 0.0f, goal, 100.0f, testPath, 3);
         moverCount = 1;
 
-        expect((int)m->z == 0);
+        expect((int)moverPosZ[0] == 0);
 
         // Tick until mover reaches z=1 or times out
         int maxTicks = 500;
         bool reachedZ1 = false;
         for (int t = 0; t < maxTicks; t++) {
             Tick();
-            if ((int)m->z == 1) {
+            if ((int)moverPosZ[0] == 1) {
                 reachedZ1 = true;
                 break;
             }
         }
 
         expect(reachedZ1);
-        expect((int)m->z == 1);
+        expect((int)moverPosZ[0] == 1);
     }
 
     it("should transition z-level DOWN when walking onto ramp from above") {
@@ -2171,21 +2174,21 @@ describe(mover_ramp_transitions) {
         InitMoverWithPath(m, startX, startY, 1.0f, goal, 100.0f, testPath, 3);
         moverCount = 1;
 
-        expect((int)m->z == 1);
+        expect((int)moverPosZ[0] == 1);
 
         // Tick until mover reaches z=0 or times out
         int maxTicks = 500;
         bool reachedZ0 = false;
         for (int t = 0; t < maxTicks; t++) {
             Tick();
-            if ((int)m->z == 0) {
+            if ((int)moverPosZ[0] == 0) {
                 reachedZ0 = true;
                 break;
             }
         }
 
         expect(reachedZ0);
-        expect((int)m->z == 0);
+        expect((int)moverPosZ[0] == 0);
     }
 
     it("should find path using ramp to reach upper floor") {
@@ -2256,20 +2259,20 @@ describe(mover_ramp_transitions) {
         expect(len > 0);
 
         // Set the path
-        m->pathLength = len;
+        moverPathLength[0] = len;
         for (int i = 0; i < len; i++) {
             moverPaths[0][i] = path[i];
         }
-        m->pathIndex = len - 1;
+        moverPathIndex[0] = len - 1;
 
         // Tick until mover reaches goal or times out
         int maxTicks = 1000;
         bool reachedGoal = false;
         for (int t = 0; t < maxTicks; t++) {
             Tick();
-            int mx = (int)(m->x / CELL_SIZE);
-            int my = (int)(m->y / CELL_SIZE);
-            int mz = (int)m->z;
+            int mx = (int)(moverPosX[0] / CELL_SIZE);
+            int my = (int)(moverPosY[0] / CELL_SIZE);
+            int mz = (int)moverPosZ[0];
             if (mx == goal.x && my == goal.y && mz == goal.z) {
                 reachedGoal = true;
                 break;
@@ -2363,9 +2366,9 @@ describe(z_climb_timing) {
         moverCount = 1;
 
         bool sawFractional = false;
-        for (int tick = 0; tick < 600 && m->active; tick++) {
+        for (int tick = 0; tick < 600 && moverActive[0]; tick++) {
             Tick();
-            float frac = m->z - (float)(int)m->z;
+            float frac = moverPosZ[0] - (float)(int)moverPosZ[0];
             if (frac > 0.05f && frac < 0.95f) { sawFractional = true; break; }
         }
         expect(sawFractional == true);
@@ -2384,11 +2387,11 @@ describe(z_climb_timing) {
         moverCount = 1;
 
         double climbStartTime = -1.0, climbEndTime = -1.0;
-        for (int tick = 0; tick < 600 && m->active; tick++) {
+        for (int tick = 0; tick < 600 && moverActive[0]; tick++) {
             Tick();
-            if (climbStartTime < 0.0 && m->z > (float)startZ + 0.05f)
+            if (climbStartTime < 0.0 && moverPosZ[0] > (float)startZ + 0.05f)
                 climbStartTime = gameTime;
-            if (climbStartTime >= 0.0 && m->z >= (float)goalZ - 0.05f && climbEndTime < 0.0)
+            if (climbStartTime >= 0.0 && moverPosZ[0] >= (float)goalZ - 0.05f && climbEndTime < 0.0)
                 climbEndTime = gameTime;
         }
         expect(climbStartTime >= 0.0);
@@ -2410,9 +2413,9 @@ describe(z_climb_timing) {
             (float)startZ, (Point){4,1,goalZ}, CLIMB_SPEED, path, 4);
         moverCount = 1;
 
-        for (int tick = 0; tick < 600 && m->active; tick++) Tick();
-        expect(m->z == (float)goalZ);
-        expect(m->active == false);
+        for (int tick = 0; tick < 600 && moverActive[0]; tick++) Tick();
+        expect(moverPosZ[0] == (float)goalZ);
+        expect(moverActive[0] == false);
     }
 
     it("z should be fractional while traversing a ramp upward") {
@@ -2436,9 +2439,9 @@ describe(z_climb_timing) {
         moverCount = 1;
 
         bool sawFractional = false;
-        for (int tick = 0; tick < 500 && m->active; tick++) {
+        for (int tick = 0; tick < 500 && moverActive[0]; tick++) {
             Tick();
-            float frac = m->z - (float)(int)m->z;
+            float frac = moverPosZ[0] - (float)(int)moverPosZ[0];
             if (frac > 0.05f && frac < 0.95f) { sawFractional = true; break; }
         }
         expect(sawFractional == true);
@@ -2465,11 +2468,11 @@ describe(z_climb_timing) {
         moverCount = 1;
 
         double climbStartTime = -1.0, climbEndTime = -1.0;
-        for (int tick = 0; tick < 500 && m->active; tick++) {
+        for (int tick = 0; tick < 500 && moverActive[0]; tick++) {
             Tick();
-            if (climbStartTime < 0.0 && m->z > 0.05f)
+            if (climbStartTime < 0.0 && moverPosZ[0] > 0.05f)
                 climbStartTime = gameTime;
-            if (climbStartTime >= 0.0 && m->z >= 1.0f - 0.05f && climbEndTime < 0.0)
+            if (climbStartTime >= 0.0 && moverPosZ[0] >= 1.0f - 0.05f && climbEndTime < 0.0)
                 climbEndTime = gameTime;
         }
         expect(climbStartTime >= 0.0);
@@ -2484,6 +2487,560 @@ describe(z_climb_timing) {
 #undef CLIMB_GRID_SETUP
 }
 
+describe(flow_field_movers) {
+    it("should send a crowd to one goal through a shared flow field") {
+        InitTestGridFromAscii(
+            "........................\n"
+            "........................\n"
+            "...........#............\n"
+            "...........#............\n"
+            "...........#............\n"
+            "...........#............\n"
+            "...........#............\n"
+            "...........#............\n"
+            "...........#............\n"
+            "...........#............\n"
+            "........................\n"
+            "........................\n");
+        BuildEntrances();
+        BuildGraph();
+        endlessMoverMode = false;
+        ClearMovers();
+
+        Point goal = {20, 6, 0};
+        int crowd = 12;
+        for (int i = 0; i < crowd; i++) {
+            float x = (1 + (i % 4) * 2) * CELL_SIZE + CELL_SIZE * 0.5f;
+            float y = (2 + (i / 4) * 3) * CELL_SIZE + CELL_SIZE * 0.5f;
+            InitMover(&movers[i], x, y, 0.0f, goal, 100.0f);
+            moverNeedsRepath[i] = true;
+        }
+        moverCount = crowd;
+
+        int buildsBefore = flowFieldBuildCount;
+        Tick();
+
+        // The first few requests plan their own path; the rest follow the field
+        int following = 0;
+        for (int i = 0; i < crowd; i++) {
+            if (moverFlowField[i] != 0) following++;
+        }
+        int handle = FindFlowField(goal);
+        expect(handle != 0);
+        expect(following == crowd - (FLOW_FIELD_MIN_MOVERS - 1));
+        expect(flowFields[handle - 1].refCount == following);
+        expect(flowFieldBuildCount == buildsBefore + 1);
+
+        RunTicks(60 * 20);
+
+        int arrived = 0;
+        for (int i = 0; i < crowd; i++) {
+            int cx = (int)(moverPosX[i] / CELL_SIZE);
+            int cy = (int)(moverPosY[i] / CELL_SIZE);
+            if (!moverActive[i] && abs(cx - goal.x) <= 1 && abs(cy - goal.y) <= 1) arrived++;
+        }
+        expect(arrived == crowd);
+        expect(flowFieldBuildCount == buildsBefore + 1);
+        expect(flowFields[handle - 1].refCount == 0);
+
+        endlessMoverMode = true;
+    }
+
+    it("should re-route field followers around a new wall") {
+        InitTestGridFromAscii(
+            "........................\n"
+            "........................\n"
+            "........................\n"
+            "........................\n"
+            "........................\n"
+            "........................\n");
+        BuildEntrances();
+        BuildGraph();
+        endlessMoverMode = false;
+        ClearMovers();
+
+        Point goal = {22, 2, 0};
+        int crowd = 6;
+        for (int i = 0; i < crowd; i++) {
+            InitMover(&movers[i], 1 * CELL_SIZE + CELL_SIZE * 0.5f, (i % 6) * CELL_SIZE + CELL_SIZE * 0.5f,
+                      0.0f, goal, 100.0f);
+            moverNeedsRepath[i] = true;
+        }
+        moverCount = crowd;
+        RunTicks(30);
+        int handle = FindFlowField(goal);
+        expect(handle != 0);
+
+        // Wall across the map with a gap on the bottom row
+        for (int y = 0; y < 5; y++) {
+            grid[0][y][12] = CELL_WALL;
+            MarkChunkDirty(12, y, 0);
+        }
+        expect(flowFields[handle - 1].dirty);
+
+        RunTicks(60 * 20);
+
+        int arrived = 0;
+        for (int i = 0; i < crowd; i++) {
+            int cx = (int)(moverPosX[i] / CELL_SIZE);
+            int cy = (int)(moverPosY[i] / CELL_SIZE);
+            if (!moverActive[i] && abs(cx - goal.x) <= 1 && abs(cy - goal.y) <= 1) arrived++;
+        }
+        expect(arrived == crowd);
+        expect(!flowFields[handle - 1].dirty);
+
+        endlessMoverMode = true;
+    }
+}
+
+static bool IsTestGrazer(AgentKind kind, int idx, void* userData) {
+    (void)kind;
+    (void)userData;
+    return animals[idx].active && animals[idx].type == ANIMAL_GRAZER;
+}
+
+describe(agent_spatial_grid) {
+    it("should only avoid agents on the same z-level") {
+        InitTestGridFromAscii(
+            "..........\n"
+            "..........\n"
+            "..........\n"
+            "..........\n");
+        gridDepth = 3;
+        ClearMovers();
+        ClearAnimals();
+        InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+
+        Point goal = {5, 1, 0};
+        InitMover(&movers[0], 3 * CELL_SIZE, 1.5f * CELL_SIZE, 0.0f, goal, 100.0f);
+        InitMover(&movers[1], 3 * CELL_SIZE + 10.0f, 1.5f * CELL_SIZE, 1.0f, goal, 100.0f);
+        moverCount = 2;
+        BuildMoverSpatialGrid();
+
+        Vec2 v = ComputeMoverAvoidance(0);
+        expect(v.x == 0.0f && v.y == 0.0f);
+        // Neighbor queries stay cross-level (idle mover search)
+        expect(QueryMoverNeighbors(moverPosX[0], moverPosY[0], MOVER_AVOID_RADIUS, 0, NULL, NULL) == 1);
+
+        moverPosZ[1] = 0.0f;
+        BuildMoverSpatialGrid();
+        v = ComputeMoverAvoidance(0);
+        expect(v.x < 0.0f);
+
+        FreeMoverSpatialGrid();
+    }
+
+    it("should avoid animals and train cars indexed in the grid") {
+        InitTestGridFromAscii(
+            "..........\n"
+            "..........\n"
+            "..........\n"
+            "..........\n");
+        ClearMovers();
+        ClearAnimals();
+        InitTrains();
+        InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+
+        Point goal = {5, 1, 0};
+        InitMover(&movers[0], 3 * CELL_SIZE, 1.5f * CELL_SIZE, 0.0f, goal, 100.0f);
+        moverCount = 1;
+
+        Animal* a = &animals[0];
+        memset(a, 0, sizeof(Animal));
+        a->x = 3 * CELL_SIZE + 10.0f;
+        a->y = 1.5f * CELL_SIZE;
+        a->active = true;
+        animalCount = 1;
+        BuildMoverSpatialGrid();
+        Vec2 fromAnimal = ComputeMoverAvoidance(0);
+        expect(fromAnimal.x < 0.0f);
+
+        a->active = false;
+        Train* t = &trains[0];
+        t->active = true;
+        t->x = 3 * CELL_SIZE + 30.0f;
+        t->y = 1.5f * CELL_SIZE;
+        t->z = 0;
+        t->trailCount = 1;
+        t->trailCellX[0] = 2;
+        t->trailCellY[0] = 1;
+        BuildMoverSpatialGrid();
+        expect(QueryAgentNeighbors(moverPosX[0], moverPosY[0], 0, MOVER_AVOID_RADIUS,
+                                   AGENT_MASK(AGENT_TRAIN_CAR), NULL, NULL) == 2);
+        Vec2 fromTrain = ComputeMoverAvoidance(0);
+        expect(fromTrain.x != 0.0f);
+
+        movers[0].transportState = TRANSPORT_WAITING;
+        Vec2 waiting = ComputeMoverAvoidance(0);
+        expect(waiting.x == 0.0f && waiting.y == 0.0f);
+
+        InitTrains();
+        FreeMoverSpatialGrid();
+    }
+
+    it("should give bit-identical avoidance per mover, in lanes and batched by cell") {
+        InitTestGridFromAscii(
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n");
+        ClearMovers();
+        ClearAnimals();
+        InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+
+        // Dense enough that the scan and neighbor caps are hit mid-batch
+        SetRandomSeed(99);
+        Point goal = {0, 0, 0};
+        for (int i = 0; i < 400; i++) {
+            float x = GetRandomValue(0, gridWidth * CELL_SIZE * 4 - 1) * 0.25f;
+            float y = GetRandomValue(0, gridHeight * CELL_SIZE * 4 - 1) * 0.25f;
+            InitMover(&movers[i], x, y, 0.0f, goal, 100.0f);
+        }
+        moverCount = 400;
+        for (int i = 0; i < 8; i++) {
+            Animal* a = &animals[i];
+            memset(a, 0, sizeof(Animal));
+            a->x = moverPosX[i * 7] + 5.0f;
+            a->y = moverPosY[i * 7];
+            a->active = true;
+        }
+        animalCount = 8;
+        BuildMoverSpatialGrid();
+
+        static bool wanted[MAX_MOVERS];
+        static Vec2 batch[MAX_MOVERS];
+        for (int i = 0; i < moverCount; i++) wanted[i] = (i % 3 != 1);
+        ComputeMoverAvoidanceBatch(wanted, batch);
+
+        int differing = 0, nonZero = 0;
+        for (int i = 0; i < moverCount; i++) {
+            useSimdAvoidance = false;
+            Vec2 scalar = ComputeMoverAvoidance(i);
+            useSimdAvoidance = true;
+            Vec2 lanes = ComputeMoverAvoidance(i);
+            if (memcmp(&scalar, &lanes, sizeof(Vec2)) != 0) differing++;
+            if (wanted[i] && memcmp(&scalar, &batch[i], sizeof(Vec2)) != 0) differing++;
+            if (scalar.x != 0.0f || scalar.y != 0.0f) nonZero++;
+        }
+        expect(differing == 0);
+        expect(nonZero > moverCount / 2);
+
+        ClearAnimals();
+        FreeMoverSpatialGrid();
+    }
+
+    it("should find the same nearest animal as a linear scan") {
+        InitTestGridFromAscii(
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n"
+            "................................................\n");
+        gridDepth = 2;
+        ClearMovers();
+        ClearAnimals();
+        InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+
+        SetRandomSeed(77);
+        for (int i = 0; i < 60; i++) {
+            Animal* a = &animals[i];
+            memset(a, 0, sizeof(Animal));
+            // Whole-cell centers so some distances tie exactly
+            a->x = GetRandomValue(0, gridWidth - 1) * CELL_SIZE + CELL_SIZE * 0.5f;
+            a->y = GetRandomValue(0, gridHeight - 1) * CELL_SIZE + CELL_SIZE * 0.5f;
+            a->z = (float)GetRandomValue(0, 1);
+            a->type = (i % 3 == 0) ? ANIMAL_PREDATOR : ANIMAL_GRAZER;
+            a->active = (i % 7 != 0);
+        }
+        animalCount = 60;
+        BuildMoverSpatialGrid();
+        expect(AgentGridHasCurrentAnimals());
+
+        int mismatches = 0;
+        for (int q = 0; q < 200; q++) {
+            float qx = GetRandomValue(0, gridWidth * CELL_SIZE - 1) + 0.5f;
+            float qy = GetRandomValue(0, gridHeight * CELL_SIZE - 1) + 0.5f;
+            int qz = q % 2;
+            float maxDist = (q % 4 < 2) ? 0.0f : 200.0f;
+
+            int expectIdx = -1;
+            float best = maxDist > 0.0f ? maxDist * maxDist : 1e30f;
+            for (int i = 0; i < animalCount; i++) {
+                Animal* a = &animals[i];
+                if (!a->active || a->type != ANIMAL_GRAZER || (int)a->z != qz) continue;
+                float dx = a->x - qx, dy = a->y - qy;
+                float d = dx * dx + dy * dy;
+                if (d < best) { best = d; expectIdx = i; }
+            }
+            int got = FindNearestAgent(qx, qy, qz, maxDist, AGENT_MASK(AGENT_ANIMAL),
+                                       IsTestGrazer, NULL, NULL);
+            if (got != expectIdx) mismatches++;
+        }
+        expect(mismatches == 0);
+
+        // Spawning or clearing animals invalidates the snapshot
+        ClearAnimals();
+        expect(!AgentGridHasCurrentAnimals());
+
+        FreeMoverSpatialGrid();
+    }
+}
+
+static void SpawnRepathMovers(int count) {
+    ClearMovers();
+    for (int i = 0; i < count; i++) {
+        Point goal = {15, i % 16, 0};
+        InitMover(&movers[i], 0.5f * CELL_SIZE, (i % 16 + 0.5f) * CELL_SIZE, 0.0f, goal, 100.0f);
+        moverNeedsRepath[i] = true;
+    }
+    moverCount = count;
+}
+
+describe(repath_scheduler) {
+    it("should serve carrying and job movers before idle ones") {
+        InitGridWithSizeAndChunkSize(16, 16, 8, 8);
+        PathAlgorithm savedAlgo = moverPathAlgorithm;
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        repathBudgetMs = 0.0f;  // fixed MAX_REPATHS_PER_FRAME per tick
+
+        SpawnRepathMovers(14);
+        int haul = CreateJob(JOBTYPE_HAUL);
+        GetJob(haul)->carryingItem = 0;
+        movers[13].currentJobId = haul;
+        movers[12].currentJobId = CreateJob(JOBTYPE_MINE);
+        expect(GetRepathPriority(13) == REPATH_PRIORITY_CARRYING);
+        expect(GetRepathPriority(12) == REPATH_PRIORITY_JOB);
+        expect(GetRepathPriority(0) == REPATH_PRIORITY_IDLE);
+
+        ProcessMoverRepaths();
+        expect(!moverNeedsRepath[13] && moverPathLength[13] > 0);
+        expect(!moverNeedsRepath[12]);
+        expect(!moverNeedsRepath[7]);
+        expect(moverNeedsRepath[8] && moverNeedsRepath[11]);
+        expect(repathStats.searchesLastTick == MAX_REPATHS_PER_FRAME);
+        expect(repathStats.queueDepth == 4);
+
+        moverPathAlgorithm = savedAlgo;
+        repathBudgetMs = 0.0f;
+    }
+
+    it("should rank a mover standing in deep water as in danger") {
+        InitGridWithSizeAndChunkSize(16, 16, 8, 8);
+        SpawnRepathMovers(2);
+        movers[1].currentJobId = CreateJob(JOBTYPE_MINE);
+        SetWaterLevel(0, 0, 0, WATER_MAX_LEVEL);
+        expect(GetRepathPriority(0) == REPATH_PRIORITY_DANGER);
+        expect(GetRepathPriority(1) == REPATH_PRIORITY_JOB);
+        SetWaterLevel(0, 0, 0, 0);
+    }
+
+    it("should record how many ticks requests waited") {
+        InitGridWithSizeAndChunkSize(16, 16, 8, 8);
+        PathAlgorithm savedAlgo = moverPathAlgorithm;
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        repathBudgetMs = 0.0f;
+
+        // 25 requests at 10 per tick: 10 wait 0 ticks, 10 wait 1, 5 wait 2
+        SpawnRepathMovers(25);
+        for (int t = 0; t < 3; t++) {
+            ProcessMoverRepaths();
+            currentTick++;
+        }
+        expect(repathStats.queueDepth == 0);
+        expect(GetRepathWaitPercentile(40) == 0);
+        expect(GetRepathWaitPercentile(50) == 1);
+        expect(GetRepathWaitPercentile(95) == 2);
+
+        moverPathAlgorithm = savedAlgo;
+        repathBudgetMs = 0.0f;
+    }
+
+    it("should run every pending search in one tick when the budget allows") {
+        InitGridWithSizeAndChunkSize(16, 16, 8, 8);
+        PathAlgorithm savedAlgo = moverPathAlgorithm;
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        repathBudgetMs = 1000.0f;
+
+        SpawnRepathMovers(25);
+        ProcessMoverRepaths();
+        expect(repathStats.searchesLastTick == 25);
+        expect(repathStats.queueDepth == 0);
+        expect(repathStats.overruns == 0);
+        for (int i = 0; i < moverCount; i++) {
+            expect(!moverNeedsRepath[i]);
+        }
+
+        moverPathAlgorithm = savedAlgo;
+        repathBudgetMs = 0.0f;
+    }
+}
+
+// Mover i walks row y from fromX to toX on a cell-by-cell A* path
+static void PlaceRowMover(int i, int y, int fromX, int toX) {
+    static Point rowPath[MAX_PATH];
+    Point start = {fromX, y, 0};
+    Point goal = {toX, y, 0};
+    int len = FindPath(PATH_ALGO_ASTAR, start, goal, rowPath, MAX_PATH);
+    InitMoverWithPath(&movers[i], (fromX + 0.5f) * CELL_SIZE, (y + 0.5f) * CELL_SIZE, 0.0f,
+                      goal, 100.0f, rowPath, len);
+}
+
+describe(path_index) {
+    it("should mark only the mover whose path crosses a new wall") {
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        ClearMovers();
+        PlaceRowMover(0, 2, 1, 30);
+        PlaceRowMover(1, 20, 1, 30);
+        moverCount = 2;
+        SyncPathIndex();
+
+        // Mid-segment cell: with string pulling it is not a waypoint
+        grid[0][2][15] = CELL_WALL;
+        MarkChunkDirty(15, 2, 0);
+        ApplyPathCellEdits();
+        expect(moverNeedsRepath[0]);
+        expect(!moverNeedsRepath[1]);
+    }
+
+    it("should ignore edits that leave the cell walkable") {
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        ClearMovers();
+        PlaceRowMover(0, 2, 1, 30);
+        moverCount = 1;
+        SyncPathIndex();
+
+        MarkChunkDirty(15, 2, 0);
+        ApplyPathCellEdits();
+        expect(!moverNeedsRepath[0]);
+
+        // Explicit invalidation (furniture) marks regardless
+        expect(MarkPathsThroughCell(15, 2, 0) == 1);
+        expect(moverNeedsRepath[0]);
+    }
+
+    it("should drop chunks the mover has walked past") {
+        bool savedPulling = useStringPulling;
+        useStringPulling = false;
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        ClearMovers();
+        PlaceRowMover(0, 2, 1, 30);
+        moverCount = 1;
+        SyncPathIndex();
+
+        // Walk to x=20: path[k] is x=30-k, so the next waypoint x=21 is index 9
+        moverPosX[0] = 20.5f * CELL_SIZE;
+        moverPathIndex[0] = 9;
+        SyncPathIndex();
+
+        grid[0][2][5] = CELL_WALL;
+        MarkChunkDirty(5, 2, 0);
+        ApplyPathCellEdits();
+        expect(!moverNeedsRepath[0]);
+
+        grid[0][2][25] = CELL_WALL;
+        MarkChunkDirty(25, 2, 0);
+        ApplyPathCellEdits();
+        expect(moverNeedsRepath[0]);
+        useStringPulling = savedPulling;
+    }
+
+    it("should mark a path whose horizon reaches a chunk edited earlier") {
+        bool savedPulling = useStringPulling;
+        useStringPulling = false;
+        InitGridWithSizeAndChunkSize(400, 16, 8, 8);
+        ClearMovers();
+        PlaceRowMover(0, 4, 1, 398);
+        moverCount = 1;
+        SyncPathIndex();
+
+        // x=350 is past the first PATH_INDEX_SLOTS chunks
+        grid[0][4][350] = CELL_WALL;
+        MarkChunkDirty(350, 4, 0);
+        ApplyPathCellEdits();
+        expect(!moverNeedsRepath[0]);
+
+        // path[k] is x=398-k: next waypoint x=301 is index 97
+        moverPosX[0] = 300.5f * CELL_SIZE;
+        moverPathIndex[0] = 97;
+        SyncPathIndex();
+        expect(moverNeedsRepath[0]);
+        useStringPulling = savedPulling;
+    }
+
+    it("should repair only the broken stretch and keep the goal end") {
+        bool savedPulling = useStringPulling;
+        PathAlgorithm savedAlgo = moverPathAlgorithm;
+        useStringPulling = false;
+        moverPathAlgorithm = PATH_ALGO_ASTAR;
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        ClearMovers();
+        PlaceRowMover(0, 2, 1, 30);
+        moverCount = 1;
+        SyncPathIndex();
+
+        Point goalEnd[10];
+        memcpy(goalEnd, moverPaths[0], sizeof(goalEnd));
+
+        grid[0][2][15] = CELL_WALL;
+        MarkChunkDirty(15, 2, 0);
+        ApplyPathCellEdits();
+        expect(moverNeedsRepath[0]);
+
+        int repairsBefore = pathRepairCount;
+        ProcessMoverRepaths();
+        expect(!moverNeedsRepath[0]);
+        expect(pathRepairCount == repairsBefore + 1);
+        expect(memcmp(goalEnd, moverPaths[0], sizeof(goalEnd)) == 0);
+
+        // Spliced path is still a connected walk around the wall
+        int gaps = 0;
+        for (int k = 0; k < moverPathLength[0]; k++) {
+            Point p = moverPaths[0][k];
+            if (!IsCellWalkableAt(p.z, p.y, p.x)) gaps++;
+            if (k > 0 && (abs(p.x - moverPaths[0][k - 1].x) > 1 || abs(p.y - moverPaths[0][k - 1].y) > 1)) gaps++;
+        }
+        expect(gaps == 0);
+        expect(moverPathIndex[0] == moverPathLength[0] - 1);
+
+        useStringPulling = savedPulling;
+        moverPathAlgorithm = savedAlgo;
+    }
+
+    it("should fall back to a full repath when repair is off") {
+        bool savedPulling = useStringPulling;
+        useStringPulling = false;
+        usePathRepair = false;
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        ClearMovers();
+        PlaceRowMover(0, 2, 1, 30);
+        moverCount = 1;
+        SyncPathIndex();
+
+        grid[0][2][15] = CELL_WALL;
+        MarkChunkDirty(15, 2, 0);
+        ApplyPathCellEdits();
+
+        int repairsBefore = pathRepairCount;
+        ProcessMoverRepaths();
+        expect(!moverNeedsRepath[0] && moverPathLength[0] > 0);
+        expect(pathRepairCount == repairsBefore);
+
+        usePathRepair = true;
+        useStringPulling = savedPulling;
+    }
+}
+
 int main(int argc, char* argv[]) {
     test_verbose = c89spec_parse_args(argc, argv);
     if (!test_verbose) SetTraceLogLevel(LOG_NONE);
@@ -2508,5 +3065,9 @@ int main(int argc, char* argv[]) {
     test(sparse_level_pathfinding);
     test(staggered_updates);
     test(workshop_mover_collision);
+    test(flow_field_movers);
+    test(agent_spatial_grid);
+    test(repath_scheduler);
+    test(path_index);
     return summary();
 }
@@ -9,8 +9,14 @@
 #include "../src/world/material.h"
 #include "../src/world/terrain.h"
 #include "../src/world/pathfinding.h"
+#include "../src/world/flow_field.h"
+#include "../src/world/reach_cache.h"
+#include "../src/world/cell_edits.h"
+#include "../src/entities/items.h"
+#include "../src/simulation/rooms.h"
 #include "../src/entities/mover.h"
 #include "../src/simulation/weather.h"
+#include "../src/game_state.h"
 
 // Global flag for verbose output in tests
 static bool test_verbose = false;
@@ -459,14 +465,6 @@ describe(incremental_graph_updates) {
         UpdateDirtyChunks();
         int incrementalEdgeCount = graphEdgeCount;
 
-        // Save edges from incremental update
-        int incrementalEdges[MAX_EDGES][3];  // from, to, cost
-        for (int i = 0; i < graphEdgeCount && i < MAX_EDGES; i++) {
-            incrementalEdges[i][0] = GetGraphEdgeFrom(i);
-            incrementalEdges[i][1] = GetGraphEdgeTo(i);
-            incrementalEdges[i][2] = GetGraphEdgeCost(i);
-        }
-
         // Now do full rebuild
         BuildEntrances();
         BuildGraph();
@@ -576,6 +574,43 @@ describe(astar_pathfinding) {
         RunAStar();
         expect(pathLength == 0);
     }
+
+    it("should take the cheaper ramp even when it starts away from the goal") {
+        // The ramp at (0,2) is a step away from the goal; the one at (3,2)
+        // is on the way but the route through it costs more. Charging a
+        // full level on top of the flat distance overestimates ramp routes,
+        // and A* used to settle for the (3,2) one.
+        const char* map =
+            "floor:0\n"
+            ".....\n"
+            ".E...\n"
+            "E..E.\n"
+            "floor:1\n"
+            ".....\n"
+            ".....\n"
+            "...#.\n";
+        InitMultiFloorGridFromAscii(map, 8, 8);
+        bool saved8Dir = use8Dir;
+        use8Dir = false;
+        startPos = (Point){1, 2, 0};
+        goalPos = (Point){3, 1, 1};
+        RunAStar();
+        expect(pathLength > 0);
+        bool viaWestRamp = false;
+        for (int i = 0; i < pathLength; i++) {
+            if (path[i].x == 0 && path[i].y == 2 && path[i].z == 0) viaWestRamp = true;
+        }
+        expect(viaWestRamp);
+
+        // Same cost as an exhaustive search
+        ClearFlowFields();
+        int handle = AcquireFlowField(goalPos, (Point){0, 0, 1});
+        expect(AcquireFlowField(goalPos, (Point){gridWidth - 1, gridHeight - 1, 1}) == handle);
+        expect(nodeData[1][1][3].g == GetFlowFieldCost(handle, startPos));
+        ReleaseFlowField(handle);
+        ReleaseFlowField(handle);
+        use8Dir = saved8Dir;
+    }
 }
 
 describe(hpa_star_pathfinding) {
@@ -3120,11 +3155,649 @@ describe(jps_plus_vs_astar_consistency) {
         
         expect(failures == 0);
     }
+
+    it("JPS+ 3D should match A* reachability across z-levels on Labyrinth3D") {
+        InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        PrecomputeJpsPlus();
+        BuildJpsLadderGraph();
+
+        // Ladder graph edges are grouped per endpoint
+        expect(jpsLadderGraph.edgeCount > 0);
+        expect(jpsLadderGraph.edgeStart[jpsLadderGraph.endpointCount] == jpsLadderGraph.edgeCount);
+
+        SeedRandom(2468);
+        int failures = 0;
+        int crossLevelFound = 0;
+        for (int i = 0; i < 20; i++) {
+            int sz = 1 + i % 4;
+            int gz = 1 + (i + 1 + i / 4) % 4;
+            if (sz == gz) gz = (gz % 4) + 1;
+            Point start = GetRandomWalkableCellOnZ(sz);
+            Point goal = GetRandomWalkableCellOnZ(gz);
+            if (start.x < 0 || goal.x < 0) continue;
+
+            startPos = start;
+            goalPos = goal;
+            RunAStar();
+            int astarLen = pathLength;
+            RunJpsPlus();
+            int jpsPlusLen = pathLength;
+
+            if ((astarLen > 0) != (jpsPlusLen > 0)) failures++;
+            if (jpsPlusLen > 0) {
+                crossLevelFound++;
+                // Path is reversed: path[0] is the goal
+                if (path[0].x != goal.x || path[0].y != goal.y || path[0].z != goal.z) failures++;
+                if (path[jpsPlusLen - 1].z != start.z) failures++;
+            }
+        }
+
+        expect(failures == 0);
+        expect(crossLevelFound > 0);
+    }
+}
+
+// ============== PARALLEL HPA* GRAPH BUILD TESTS ==============
+
+static GraphEdge* parallelBuildEdges = NULL;
+
+static void SnapshotGraphEdges(int* outCount) {
+    *outCount = graphEdgeCount;
+    parallelBuildEdges = realloc(parallelBuildEdges, sizeof(GraphEdge) * (graphEdgeCount > 0 ? graphEdgeCount : 1));
+    for (int i = 0; i < graphEdgeCount; i++) parallelBuildEdges[i] = graphEdges[i];
+}
+
+static bool GraphEdgesMatchSnapshot(int count) {
+    if (graphEdgeCount != count) return false;
+    for (int i = 0; i < count; i++) {
+        if (graphEdges[i].from != parallelBuildEdges[i].from ||
+            graphEdges[i].to != parallelBuildEdges[i].to ||
+            graphEdges[i].cost != parallelBuildEdges[i].cost) return false;
+    }
+    return true;
+}
+
+describe(parallel_graph_build) {
+    it("should build the same graph on one thread and many") {
+        InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        BuildEntrances();
+
+        hpaBuildThreads = 1;
+        BuildGraph();
+        int serialCount;
+        SnapshotGraphEdges(&serialCount);
+
+        hpaBuildThreads = 8;
+        BuildGraph();
+        hpaBuildThreads = 0;
+
+        expect(serialCount > 0);
+        expect(GraphEdgesMatchSnapshot(serialCount));
+    }
+
+    it("should match single-threaded incremental updates") {
+        SeedRandom(1357);
+        int editX[40], editY[40], editZ[40];
+        for (int i = 0; i < 40; i++) {
+            editX[i] = GetRandomValue(0, 63);
+            editY[i] = GetRandomValue(0, 63);
+            editZ[i] = GetRandomValue(1, 4);
+        }
+
+        int counts[2];
+        for (int pass = 0; pass < 2; pass++) {
+            InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+            gridDepth = 5;
+            GenerateLabyrinth3D();
+            BuildEntrances();
+            BuildGraph();
+
+            hpaBuildThreads = (pass == 0) ? 1 : 8;
+            for (int i = 0; i < 40; i++) {
+                int x = editX[i], y = editY[i], z = editZ[i];
+                grid[z][y][x] = (grid[z][y][x] == CELL_WALL) ? CELL_AIR : CELL_WALL;
+                MarkChunkDirty(x, y, z);
+            }
+            UpdateDirtyChunks();
+            hpaBuildThreads = 0;
+
+            if (pass == 0) SnapshotGraphEdges(&counts[0]);
+            else counts[1] = graphEdgeCount;
+        }
+
+        expect(counts[0] > 0);
+        expect(counts[1] == counts[0]);
+        expect(GraphEdgesMatchSnapshot(counts[0]));
+    }
+
+    it("should still find the same HPA* paths after a parallel build") {
+        InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        BuildEntrances();
+        hpaBuildThreads = 8;
+        BuildGraph();
+        hpaBuildThreads = 0;
+
+        SeedRandom(97531);
+        int mismatches = 0;
+        for (int i = 0; i < 15; i++) {
+            Point start = GetRandomWalkableCellOnZ(2);
+            Point goal = GetRandomWalkableCellOnZ(2);
+            if (start.x < 0 || goal.x < 0) continue;
+            startPos = start;
+            goalPos = goal;
+            RunAStar();
+            int astarLen = pathLength;
+            RunHPAStar();
+            int hpaLen = pathLength;
+            if ((astarLen > 0) != (hpaLen > 0)) mismatches++;
+        }
+        expect(mismatches == 0);
+    }
+}
+
+// ============== MULTI-LEVEL HPA* TESTS ==============
+
+static Point superTestPath[MAX_PATH];
+
+// HPA* with the given super-chunk size; returns the abstract route cost (-1 = no path)
+static int HpaRouteCost(Point start, Point goal, int superSize, int* outLen) {
+    hpaSuperChunkSize = superSize;
+    *outLen = FindPathHPA(start, goal, superTestPath, MAX_PATH);
+    return *outLen > 0 ? abstractNodes[entranceCount + 1].g : -1;
+}
+
+static bool PathEndsAt(int len, Point start, Point goal) {
+    Point first = superTestPath[len - 1];
+    Point last = superTestPath[0];
+    return first.x == start.x && first.y == start.y && first.z == start.z
+        && last.x == goal.x && last.y == goal.y && last.z == goal.z;
+}
+
+// Random pairs in different super-chunks: level-2 must agree with single-level HPA*
+static int CountSuperGraphMismatches(int pairs, int* outCompared) {
+    int mismatches = 0;
+    int superCells = 4 * chunkWidth;
+    *outCompared = 0;
+    for (int i = 0; i < pairs; i++) {
+        Point start = GetRandomWalkableCell();
+        Point goal = GetRandomWalkableCell();
+        if (start.x < 0 || goal.x < 0) continue;
+        if (start.x / superCells == goal.x / superCells && start.y / superCells == goal.y / superCells) continue;
+
+        int singleLen, multiLen;
+        int singleCost = HpaRouteCost(start, goal, 0, &singleLen);
+        int multiCost = HpaRouteCost(start, goal, 4, &multiLen);
+        if (singleCost != multiCost) mismatches++;
+        if (multiLen > 0 && !PathEndsAt(multiLen, start, goal)) mismatches++;
+        (*outCompared)++;
+    }
+    hpaSuperChunkSize = 4;
+    return mismatches;
+}
+
+describe(hpa_super_graph) {
+    it("should match single-level HPA* costs and reachability across super-chunks") {
+        InitGridWithSizeAndChunkSize(128, 128, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        BuildEntrances();
+        BuildGraph();
+        hpaSuperChunkSize = 4;
+        BuildHpaSuperGraph();
+
+        SeedRandom(24680);
+        int compared;
+        int mismatches = CountSuperGraphMismatches(60, &compared);
+
+        expect(hpaSuperNodeCount > 0);
+        expect(hpaSuperNodeCount < entranceCount / 2);
+        expect(compared > 20);
+        expect(mismatches == 0);
+    }
+
+    it("should stay consistent after incremental updates") {
+        InitGridWithSizeAndChunkSize(128, 128, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        BuildEntrances();
+        BuildGraph();
+        hpaSuperChunkSize = 4;
+        BuildHpaSuperGraph();
+
+        SeedRandom(8642);
+        int totalMismatches = 0;
+        for (int round = 0; round < 3; round++) {
+            for (int i = 0; i < 30; i++) {
+                int x = GetRandomValue(0, 127), y = GetRandomValue(0, 127), z = GetRandomValue(1, 4);
+                grid[z][y][x] = (grid[z][y][x] == CELL_WALL) ? CELL_AIR : CELL_WALL;
+                MarkChunkDirty(x, y, z);
+            }
+            UpdateDirtyChunks();
+            int compared;
+            totalMismatches += CountSuperGraphMismatches(25, &compared);
+        }
+
+        expect(totalMismatches == 0);
+    }
+
+    it("should grow entrance and edge storage past its initial size") {
+        InitGridWithSizeAndChunkSize(256, 256, 8, 8);
+        gridDepth = 4;
+        GenerateLabyrinth3D();
+        BuildEntrances();
+        BuildGraph();
+
+        expect(entranceCount > 4096);
+        expect(entranceCapacity >= entranceCount);
+        expect(graphEdgeCapacity >= graphEdgeCount);
+
+        SeedRandom(1122);
+        int compared;
+        expect(CountSuperGraphMismatches(10, &compared) == 0);
+        expect(compared > 0);
+    }
+}
+
+// ============== FLOW FIELD TESTS ==============
+
+// Cost of RunAStar's path from start to goal, -1 if none
+static int AStarRouteCost(Point start, Point goal) {
+    startPos = start;
+    goalPos = goal;
+    RunAStar();
+    return pathLength > 0 ? nodeData[goal.z][goal.y][goal.x].g : -1;
+}
+
+static bool HasRamps(void) {
+    for (int z = 0; z < gridDepth; z++)
+        for (int y = 0; y < gridHeight; y++)
+            for (int x = 0; x < gridWidth; x++)
+                if (CellIsDirectionalRamp(grid[z][y][x])) return true;
+    return false;
+}
+
+describe(flow_fields) {
+    it("should match A* costs and reachability on hills with ramps") {
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        gridDepth = 8;
+        worldSeed = 777;
+        SetRandomSeed(777);
+        GenerateHills();
+        BuildEntrances();  // ramp links decide which z-levels GetRandomWalkableCell may pick
+        SeedRandom(13579);
+        Point goal = GetRandomWalkableCell();
+        expect(HasRamps());
+
+        ClearFlowFields();
+        int handle = AcquireFlowField(goal, (Point){0, 0, goal.z});
+        expect(handle != 0);
+        // Grow the box to the whole map
+        expect(AcquireFlowField(goal, (Point){gridWidth - 1, gridHeight - 1, goal.z}) == handle);
+        expect(flowFields[handle - 1].refCount == 2);
+        expect(flowFields[handle - 1].width == gridWidth && flowFields[handle - 1].height == gridHeight);
+
+        int compared = 0, reachable = 0, mismatches = 0;
+        for (int i = 0; i < 24; i++) {
+            Point start = GetRandomWalkableCell();
+            if (start.x < 0) continue;
+            int astar = AStarRouteCost(start, goal);
+            int field = GetFlowFieldCost(handle, start);
+            if (astar < 0 ? field != FLOW_COST_INF : field != astar) mismatches++;
+            if (astar >= 0) reachable++;
+            compared++;
+        }
+        expect(compared > 20);
+        expect(reachable > 10);
+        expect(mismatches == 0);
+
+        ReleaseFlowField(handle);
+        ReleaseFlowField(handle);
+        expect(flowFields[handle - 1].refCount == 0);
+    }
+
+    it("should route through ladders like A*") {
+        const char* map =
+            "floor:0\n"
+            "........\n"
+            ".L......\n"
+            "......L.\n"
+            "floor:1\n"
+            "........\n"
+            ".L......\n"
+            "......L.\n";
+        InitMultiFloorGridFromAscii(map, 8, 8);
+        ClearFlowFields();
+        Point goal = {7, 0, 1};
+        int handle = AcquireFlowField(goal, (Point){0, 0, 0});
+        expect(handle != 0);
+        int mismatches = 0;
+        for (int z = 0; z < 2; z++)
+            for (int y = 0; y < 3; y++)
+                for (int x = 0; x < 8; x++) {
+                    Point p = {x, y, z};
+                    if (!IsCellWalkableAt(z, y, x)) continue;
+                    int astar = AStarRouteCost(p, goal);
+                    int field = GetFlowFieldCost(handle, p);
+                    if ((astar < 0 ? FLOW_COST_INF : astar) != field) mismatches++;
+                }
+        expect(mismatches == 0);
+        expect(GetFlowFieldCost(handle, (Point){0, 0, 0}) < FLOW_COST_INF);
+        ReleaseFlowField(handle);
+    }
+
+    it("should sample adjacent steps ending at the goal") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "......#.........\n"
+            "......#.........\n"
+            "......#.........\n"
+            "................\n");
+        ClearFlowFields();
+        Point goal = {12, 3, 0};
+        Point start = {1, 3, 0};
+        int handle = AcquireFlowField(goal, start);
+        expect(handle != 0);
+
+        Point steps[64];
+        int len = SampleFlowField(handle, start, steps, 64);
+        expect(len > 1);
+        expect(steps[len - 1].x == start.x && steps[len - 1].y == start.y);
+        expect(steps[0].x == goal.x && steps[0].y == goal.y);
+        bool adjacent = true;
+        for (int i = 0; i + 1 < len; i++) {
+            if (abs(steps[i].x - steps[i + 1].x) > 1 || abs(steps[i].y - steps[i + 1].y) > 1) adjacent = false;
+            if (grid[0][steps[i].y][steps[i].x] == CELL_WALL) adjacent = false;
+        }
+        expect(adjacent);
+
+        // Lookahead-limited sample stops early, still starting at `from`
+        int shortLen = SampleFlowField(handle, start, steps, FLOW_FIELD_LOOKAHEAD + 1);
+        expect(shortLen == FLOW_FIELD_LOOKAHEAD + 1);
+        expect(steps[shortLen - 1].x == start.x && steps[shortLen - 1].y == start.y);
+
+        // Already at the goal: nothing to follow
+        expect(SampleFlowField(handle, goal, steps, 64) == 0);
+        ReleaseFlowField(handle);
+    }
+
+    it("should re-integrate after a cell edit inside its box") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+        ClearFlowFields();
+        Point goal = {14, 1, 0};
+        Point start = {1, 1, 0};
+        int handle = AcquireFlowField(goal, start);
+        int before = GetFlowFieldCost(handle, start);
+        int builds = flowFieldBuildCount;
+        expect(before == 130);
+
+        // Wall off column 7 except one gap at the bottom
+        for (int y = 0; y < 3; y++) {
+            grid[0][y][7] = CELL_WALL;
+            MarkChunkDirty(7, y, 0);
+        }
+        expect(flowFields[handle - 1].dirty);
+        int after = GetFlowFieldCost(handle, start);
+        expect(flowFieldBuildCount == builds + 1);
+        expect(after > before);
+        expect(after == AStarRouteCost(start, goal));
+
+        // Unrelated sample does not rebuild again
+        GetFlowFieldCost(handle, goal);
+        expect(flowFieldBuildCount == builds + 1);
+        ReleaseFlowField(handle);
+    }
+
+    it("should reuse cached fields and evict only unreferenced ones") {
+        InitTestGridFromAscii(
+            "................\n"
+            "................\n"
+            "................\n"
+            "................\n");
+        ClearFlowFields();
+        int handles[MAX_FLOW_FIELDS];
+        for (int i = 0; i < MAX_FLOW_FIELDS; i++) {
+            handles[i] = AcquireFlowField((Point){i, 0, 0}, (Point){0, 3, 0});
+            expect(handles[i] != 0);
+        }
+        // All slots referenced: a new goal cannot get a field
+        expect(AcquireFlowField((Point){0, 2, 0}, (Point){0, 3, 0}) == 0);
+
+        // Releasing one lets the next goal take its slot; the rest stay cached
+        ReleaseFlowField(handles[5]);
+        int reused = AcquireFlowField((Point){0, 2, 0}, (Point){0, 3, 0});
+        expect(reused == handles[5]);
+        expect(FindFlowField((Point){5, 0, 0}) == 0);
+        expect(FindFlowField((Point){6, 0, 0}) == handles[6]);
+
+        // Unwalkable goals never get a field
+        grid[0][1][1] = CELL_WALL;
+        expect(AcquireFlowField((Point){1, 1, 0}, (Point){0, 3, 0}) == 0);
+        ClearFlowFields();
+    }
+}
+
+// ============== JPS+ INCREMENTAL UPDATE TESTS ==============
+
+static int16_t jpsIncrementalSnapshot[5][64][64][8];
+
+// Read every jump distance (applying queued edits), then full-precompute and count differences
+static int CountJpsIncrementalMismatches(void) {
+    for (int z = 0; z < gridDepth; z++)
+        for (int y = 0; y < gridHeight; y++)
+            for (int x = 0; x < gridWidth; x++)
+                for (int d = 0; d < 8; d++)
+                    jpsIncrementalSnapshot[z][y][x][d] = (int16_t)GetJpsPlusJumpDist(x, y, z, d);
+
+    PrecomputeJpsPlus();
+
+    int mismatches = 0;
+    for (int z = 0; z < gridDepth; z++)
+        for (int y = 0; y < gridHeight; y++)
+            for (int x = 0; x < gridWidth; x++)
+                for (int d = 0; d < 8; d++)
+                    if (jpsIncrementalSnapshot[z][y][x][d] != GetJpsPlusJumpDist(x, y, z, d)) mismatches++;
+    return mismatches;
+}
+
+static void EditCellForJps(int x, int y, int z, CellType cell) {
+    grid[z][y][x] = cell;
+    MarkChunkDirty(x, y, z);
+}
+
+describe(jps_plus_incremental) {
+    it("should match a full precompute after scattered wall edits") {
+        InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        PrecomputeJpsPlus();
+        int fullBefore = jpsFullPrecomputeCount;
+
+        SeedRandom(4242);
+        for (int batch = 0; batch < 20; batch++) {
+            for (int i = 0; i < 10; i++) {
+                int x = GetRandomValue(0, 63);
+                int y = GetRandomValue(0, 63);
+                int z = GetRandomValue(1, 4);
+                EditCellForJps(x, y, z, grid[z][y][x] == CELL_WALL ? CELL_AIR : CELL_WALL);
+            }
+            // Query between batches so edits land on an already-updated table
+            (void)GetJpsPlusJumpDist(0, 0, 1, 0);
+        }
+
+        expect(jpsFullPrecomputeCount == fullBefore);
+        expect(CountJpsIncrementalMismatches() == 0);
+    }
+
+    it("should match a full precompute after opening a long corridor wall") {
+        // Removing one wall cell flips cardinal distances along the whole row and column
+        const char* map =
+            "floor:0\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "################################\n"
+            "................................\n"
+            "................................\n"
+            "..........#.....................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n"
+            "................................\n";
+        InitMultiFloorGridFromAscii(map, 8, 8);
+        PrecomputeJpsPlus();
+        int fullBefore = jpsFullPrecomputeCount;
+
+        EditCellForJps(16, 5, 0, CELL_AIR);
+        EditCellForJps(10, 8, 0, CELL_AIR);
+        EditCellForJps(3, 12, 0, CELL_WALL);
+
+        expect(CountJpsIncrementalMismatches() == 0);
+        expect(jpsFullPrecomputeCount == fullBefore + 1);  // only the comparison precompute
+    }
+
+    it("should match a full precompute after placing and erasing ladders") {
+        InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        PrecomputeJpsPlus();
+
+        SeedRandom(777);
+        for (int i = 0; i < 30; i++) {
+            int x = GetRandomValue(1, 62);
+            int y = GetRandomValue(1, 62);
+            int z = GetRandomValue(1, 3);
+            EditCellForJps(x, y, z, CELL_LADDER_BOTH);
+            EditCellForJps(x, y, z + 1, CELL_LADDER_BOTH);
+            if (i % 3 == 0) EditCellForJps(x, y, z + 1, CELL_AIR);
+        }
+
+        expect(CountJpsIncrementalMismatches() == 0);
+    }
+
+    it("should fall back to a full precompute for bulk edits") {
+        InitGridWithSizeAndChunkSize(64, 64, 8, 8);
+        gridDepth = 5;
+        GenerateLabyrinth3D();
+        PrecomputeJpsPlus();
+        int fullBefore = jpsFullPrecomputeCount;
+
+        for (int y = 0; y < 64; y++)
+            for (int x = 0; x < 64; x++)
+                EditCellForJps(x, y, 2, CELL_AIR);
+
+        (void)GetJpsPlusJumpDist(0, 0, 2, 0);
+        expect(jpsFullPrecomputeCount == fullBefore + 1);
+    }
 }
 
 // ============== LADDER PLACEMENT AND ERASE TESTS ==============
 // Legend: U = LADDER_UP, D = LADDER_DOWN, B = LADDER_BOTH
 
+describe(reach_cache) {
+    // Two rooms split by a wall at x=5; the left room is one source region
+    const char* rooms =
+        "############\n"
+        "#....#.....#\n"
+        "#....#.....#\n"
+        "#....#.....#\n"
+        "#....#.....#\n"
+        "############\n";
+    static Point scratch[MAX_PATH];
+
+    it("should answer repeated probes from one room from the cache") {
+        InitTestGridFromAscii(rooms);
+        int hits = reachCacheHits, misses = reachCacheMisses;
+        Point target = {8, 2, 0};
+        expect(ProbePathLength(PATH_ALGO_ASTAR, (Point){1, 1, 0}, target, scratch, MAX_PATH) == 0);
+        expect(ProbePathLength(PATH_ALGO_ASTAR, (Point){4, 4, 0}, target, scratch, MAX_PATH) == 0);
+        expect(ProbePathLength(PATH_ALGO_ASTAR, (Point){2, 3, 0}, target, scratch, MAX_PATH) == 0);
+        expect(reachCacheMisses - misses == 1);
+        expect(reachCacheHits - hits == 2);
+
+        // Same room on the other side: its own region, its own answer
+        expect(ProbePathLength(PATH_ALGO_ASTAR, (Point){6, 1, 0}, target, scratch, MAX_PATH) > 0);
+        expect(reachCacheMisses - misses == 2);
+    }
+
+    it("should keep unreachable answers across edits that cannot open a path") {
+        InitTestGridFromAscii(rooms);
+        Point start = {1, 1, 0}, target = {8, 2, 0};
+        expect(ProbePathLength(PATH_ALGO_ASTAR, start, target, scratch, MAX_PATH) == 0);
+
+        grid[0][3][8] = CELL_WALL;
+        MarkChunkDirty(8, 3, 0);
+        int misses = reachCacheMisses;
+        expect(ProbePathLength(PATH_ALGO_ASTAR, start, target, scratch, MAX_PATH) == 0);
+        expect(reachCacheMisses == misses);
+    }
+
+    it("should re-search unreachable answers when a wall is removed") {
+        InitTestGridFromAscii(rooms);
+        Point start = {1, 1, 0}, target = {8, 2, 0};
+        expect(ProbePathLength(PATH_ALGO_ASTAR, start, target, scratch, MAX_PATH) == 0);
+
+        grid[0][2][5] = CELL_AIR;
+        MarkChunkDirty(5, 2, 0);
+        int misses = reachCacheMisses;
+        expect(ProbePathLength(PATH_ALGO_ASTAR, start, target, scratch, MAX_PATH) > 0);
+        expect(reachCacheMisses == misses + 1);
+    }
+
+    it("should re-search reachable answers when a wall is built") {
+        InitTestGridFromAscii(rooms);
+        grid[0][2][5] = CELL_AIR;
+        Point start = {1, 1, 0}, target = {8, 2, 0};
+        expect(ProbePathLength(PATH_ALGO_ASTAR, start, target, scratch, MAX_PATH) > 0);
+
+        grid[0][2][5] = CELL_WALL;
+        MarkChunkDirty(5, 2, 0);
+        expect(ProbePathLength(PATH_ALGO_ASTAR, start, target, scratch, MAX_PATH) == 0);
+    }
+
+    it("should not cache HPA* answers from a graph that predates an edit") {
+        InitGridFromAsciiWithChunkSize(rooms, 4, 6);  // rooms in different chunks
+        BuildEntrances();
+        BuildGraph();
+        Point start = {1, 1, 0}, target = {8, 2, 0};
+        expect(ProbePathLength(PATH_ALGO_HPA, start, target, scratch, MAX_PATH) == 0);
+
+        // Open the wall and probe in the same tick, before the graph catches up
+        grid[0][2][5] = CELL_AIR;
+        MarkChunkDirty(5, 2, 0);
+        expect(hpaNeedsRebuild);
+        ProbePathLength(PATH_ALGO_HPA, start, target, scratch, MAX_PATH);
+
+        UpdateDirtyChunks();
+        expect(!hpaNeedsRebuild);
+        expect(ProbePathLength(PATH_ALGO_HPA, start, target, scratch, MAX_PATH) > 0);
+    }
+
+    it("should match FindPath when disabled") {
+        InitTestGridFromAscii(rooms);
+        useReachCache = false;
+        int hits = reachCacheHits, misses = reachCacheMisses;
+        expect(ProbePathLength(PATH_ALGO_ASTAR, (Point){6, 1, 0}, (Point){8, 2, 0}, scratch, MAX_PATH) > 0);
+        expect(reachCacheHits == hits && reachCacheMisses == misses);
+        useReachCache = true;
+    }
+}
+
 describe(ladder_placement) {
     it("place_basic - Place ladder on empty ground creates UP and DOWN") {
         // z=1:  .            D
@@ -4747,6 +5420,78 @@ describe(variable_terrain_cost) {
 
 }
 
+// Builds walls over a rect with the fan-out a cell edit does
+static void EditWallRect(int x0, int y0, int x1, int y1, int z) {
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            grid[z][y][x] = CELL_WALL;
+            MarkChunkDirty(x, y, z);
+            InvalidateRoomsAt(x, y, z);
+            ClearUnreachableCooldownsNearCell(x, y, z, 5);
+        }
+    }
+}
+
+describe(cell_edit_transactions) {
+    static bool expectedDirty[MAX_GRID_DEPTH][MAX_CHUNKS_Y][MAX_CHUNKS_X];
+
+    it("should dirty the same chunks as editing cell by cell") {
+        InitGridWithSizeAndChunkSize(TEST_GRID_SIZE, TEST_GRID_SIZE, 16, 16);
+        memset(chunkDirty, 0, sizeof(chunkDirty));
+        EditWallRect(5, 7, 60, 40, 1);
+        memcpy(expectedDirty, chunkDirty, sizeof(chunkDirty));
+
+        InitGridWithSizeAndChunkSize(TEST_GRID_SIZE, TEST_GRID_SIZE, 16, 16);
+        memset(chunkDirty, 0, sizeof(chunkDirty));
+        BeginCellEdits();
+        EditWallRect(5, 7, 60, 40, 1);
+        expect(!chunkDirty[1][0][0]);
+        CommitCellEdits();
+
+        expect(memcmp(expectedDirty, chunkDirty, sizeof(chunkDirty)) == 0);
+        expect(lastCellEditCommit.cells == 56 * 34);
+        expect(lastCellEditCommit.chunks == 4 * 3);
+    }
+
+    it("should only flush at the outermost commit") {
+        InitGridWithSizeAndChunkSize(TEST_GRID_SIZE, TEST_GRID_SIZE, 16, 16);
+        memset(chunkDirty, 0, sizeof(chunkDirty));
+        BeginCellEdits();
+        BeginCellEdits();
+        grid[1][40][40] = CELL_WALL;
+        MarkChunkDirty(40, 40, 1);
+        CommitCellEdits();
+        expect(!chunkDirty[1][2][2]);
+        CommitCellEdits();
+        expect(chunkDirty[1][2][2]);
+        expect(lastCellEditCommit.cells == 1);
+        expect(cellEditDepth == 0);
+
+        // Outside a transaction the fan-out runs right away
+        grid[1][70][70] = CELL_WALL;
+        MarkChunkDirty(70, 70, 1);
+        expect(chunkDirty[1][4][4]);
+    }
+
+    it("should clear item cooldowns near edited cells across chunk edges") {
+        InitGridWithSizeAndChunkSize(TEST_GRID_SIZE, TEST_GRID_SIZE, 16, 16);
+        ClearItems();
+        int near = SpawnItem(17 * CELL_SIZE + CELL_SIZE * 0.5f, 10 * CELL_SIZE + CELL_SIZE * 0.5f, 1, ITEM_ROCK);
+        int far = SpawnItem(60 * CELL_SIZE + CELL_SIZE * 0.5f, 60 * CELL_SIZE + CELL_SIZE * 0.5f, 1, ITEM_ROCK);
+        SetItemUnreachableCooldown(near, 5.0f);
+        SetItemUnreachableCooldown(far, 5.0f);
+
+        BeginCellEdits();
+        EditWallRect(12, 10, 14, 10, 1);
+        expect(itemUnreachableCooldown[near] > 0.0f);
+        CommitCellEdits();
+
+        expect(itemUnreachableCooldown[near] == 0.0f);
+        expect(itemUnreachableCooldown[far] > 0.0f);
+        ClearItems();
+    }
+}
+
 static void run_all_tests(void) {
     test(grid_initialization);
     test(entrance_building);
@@ -4765,6 +5510,11 @@ static void run_all_tests(void) {
     test(hpa_ramp_pathfinding);
     test(jps_plus_3d_pathfinding);
     test(jps_plus_vs_astar_consistency);
+    test(jps_plus_incremental);
+    test(parallel_graph_build);
+    test(hpa_super_graph);
+    test(flow_fields);
+    test(reach_cache);
     test(ladder_placement);
     test(ladder_erase);
     test(df_walkability);
@@ -4772,6 +5522,7 @@ static void run_all_tests(void) {
     test(df_basics);
     test(pathfinding_multi_z_correctness);
     test(variable_terrain_cost);
+    test(cell_edit_transactions);
 }
 
 int main(int argc, char* argv[]) {
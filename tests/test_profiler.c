@@ -0,0 +1,207 @@
+// Profiler trace tests - standalone, no game code
+#define PROFILER_IMPLEMENTATION
+#include "../vendor/c89spec.h"
+#include "../shared/profiler.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool test_verbose = false;
+
+static const char* tracePath = "/tmp/navkit_test_trace.json";
+static char traceText[1 << 22];
+
+// Reads the finished trace into traceText
+static bool ReadTrace(void) {
+    FILE* f = fopen(tracePath, "r");
+    if (!f) return false;
+    size_t n = fread(traceText, 1, sizeof(traceText) - 1, f);
+    traceText[n] = '\0';
+    fclose(f);
+    return true;
+}
+
+// Every event sits on its own line between the header and "]}"
+static bool TraceIsWellFormed(void) {
+    const char* header = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    if (strncmp(traceText, header, strlen(header)) != 0) return false;
+    size_t len = strlen(traceText);
+    if (len < 4 || strcmp(traceText + len - 4, "\n]}\n") != 0) return false;
+    const char* line = strchr(traceText, '\n') + 1;
+    while (strncmp(line, "]}", 2) != 0) {
+        const char* end = strchr(line, '\n');
+        if (!end || line[0] != '{') return false;
+        const char* close = end - 1;
+        if (*close == ',') close--;
+        if (*close != '}') return false;
+        line = end + 1;
+    }
+    return true;
+}
+
+// Counts "X" span events with this name; stores the tid of the last one
+static int CountSpans(const char* name, int* tid) {
+    char key[128];
+    snprintf(key, sizeof(key), "{\"name\":\"%s\",\"cat\":\"section\",\"ph\":\"X\",\"pid\":1,\"tid\":", name);
+    int count = 0;
+    for (const char* p = strstr(traceText, key); p; p = strstr(p + 1, key)) {
+        if (tid) *tid = atoi(p + strlen(key));
+        count++;
+    }
+    return count;
+}
+
+// Counts "X" span events with this name on a given tid
+static int CountSpansOnTid(const char* name, int tid) {
+    char key[160];
+    snprintf(key, sizeof(key), "{\"name\":\"%s\",\"cat\":\"section\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,", name, tid);
+    int count = 0;
+    for (const char* p = strstr(traceText, key); p; p = strstr(p + 1, key)) count++;
+    return count;
+}
+
+static bool HasThreadName(int tid, const char* name) {
+    char key[160];
+    snprintf(key, sizeof(key),
+             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", tid, name);
+    return strstr(traceText, key) != NULL;
+}
+
+static void* NamedWorker(void* arg) {
+    (void)arg;
+    ProfileThreadName("pathing");
+    PROFILE_BEGIN(WorkerBuild);
+    PROFILE_BEGIN(WorkerChunk);
+    PROFILE_END(WorkerChunk);
+    PROFILE_END(WorkerBuild);
+    ProfileThreadExit();
+    return NULL;
+}
+
+static void* ShortLivedWorker(void* arg) {
+    (void)arg;
+    PROFILE_BEGIN(ShortLived);
+    PROFILE_END(ShortLived);
+    ProfileThreadExit();
+    return NULL;
+}
+
+// =============================================================================
+// Export
+// =============================================================================
+
+describe(profiler_trace_export) {
+    it("writes spans from the main thread and a worker on their own lanes") {
+        expect(ProfileTraceStart(tracePath));
+        PROFILE_BEGIN(MainTick);
+        pthread_t thread;
+        pthread_create(&thread, NULL, NamedWorker, NULL);
+        pthread_join(thread, NULL);
+        PROFILE_END(MainTick);
+        PROFILE_FRAME_END();
+        ProfileTraceStop();
+
+        expect(ReadTrace());
+        if (test_verbose) printf("%s", traceText);
+        expect(TraceIsWellFormed());
+
+        int mainTid = -1, workerTid = -1, chunkTid = -1;
+        expect(CountSpans("MainTick", &mainTid) == 1);
+        expect(CountSpans("WorkerBuild", &workerTid) == 1);
+        expect(CountSpans("WorkerChunk", &chunkTid) == 1);
+        expect(mainTid == 0);
+        expect(workerTid > 0);
+        expect(chunkTid == workerTid);
+        expect(HasThreadName(0, "main"));
+        expect(HasThreadName(workerTid, "pathing"));
+    }
+
+    it("nests a worker span inside its parent's time range") {
+        expect(ProfileTraceStart(tracePath));
+        pthread_t thread;
+        pthread_create(&thread, NULL, NamedWorker, NULL);
+        pthread_join(thread, NULL);
+        ProfileTraceStop();
+        expect(ReadTrace());
+
+        double buildTs = 0, buildDur = 0, chunkTs = 0, chunkDur = 0;
+        const char* build = strstr(traceText, "\"name\":\"WorkerBuild\"");
+        const char* chunk = strstr(traceText, "\"name\":\"WorkerChunk\"");
+        expect(build && chunk);
+        if (build && chunk) {
+            sscanf(strstr(build, "\"ts\":"), "\"ts\":%lf,\"dur\":%lf", &buildTs, &buildDur);
+            sscanf(strstr(chunk, "\"ts\":"), "\"ts\":%lf,\"dur\":%lf", &chunkTs, &chunkDur);
+            expect(chunkTs >= buildTs);
+            expect(chunkTs + chunkDur <= buildTs + buildDur + 0.001);
+        }
+    }
+}
+
+// =============================================================================
+// Rings and lanes
+// =============================================================================
+
+describe(profiler_trace_rings) {
+    it("keeps the newest spans and counts the rest as dropped when a ring wraps") {
+        expect(ProfileTraceStart(tracePath));
+        int extra = 100;
+        for (int i = 0; i < PROFILER_TRACE_RING + extra; i++) {
+            PROFILE_BEGIN(Wrapped);
+            PROFILE_END(Wrapped);
+        }
+        ProfileTraceStop();
+
+        expect(profilerTraceDropped == (uint64_t)extra);
+        expect(ReadTrace());
+        expect(TraceIsWellFormed());
+        expect(CountSpansOnTid("Wrapped", 0) == PROFILER_TRACE_RING);
+    }
+
+    it("drains every frame so a frame-ended run drops nothing") {
+        expect(ProfileTraceStart(tracePath));
+        int frames = 4;
+        for (int f = 0; f < frames; f++) {
+            for (int i = 0; i < PROFILER_TRACE_RING / 2; i++) {
+                PROFILE_BEGIN(Drained);
+                PROFILE_END(Drained);
+            }
+            PROFILE_FRAME_END();
+        }
+        ProfileTraceStop();
+
+        expect(profilerTraceDropped == 0);
+        expect(ReadTrace());
+        expect(CountSpansOnTid("Drained", 0) == frames * (PROFILER_TRACE_RING / 2));
+    }
+
+    it("hands an exited worker's lane to the next worker") {
+        expect(ProfileTraceStart(tracePath));
+        int workers = PROFILER_MAX_THREADS * 2;
+        for (int i = 0; i < workers; i++) {
+            pthread_t thread;
+            pthread_create(&thread, NULL, ShortLivedWorker, NULL);
+            pthread_join(thread, NULL);
+        }
+        ProfileTraceStop();
+
+        expect(ReadTrace());
+        expect(TraceIsWellFormed());
+        int tid = -1;
+        // More workers than lanes, yet none lost: they all took the same one
+        expect(CountSpans("ShortLived", &tid) == workers);
+        expect(tid > 0);
+        expect(CountSpansOnTid("ShortLived", tid) == workers);
+        remove(tracePath);
+    }
+}
+
+int main(int argc, char** argv) {
+    test_verbose = c89spec_parse_args(argc, argv);
+    ProfileThreadName("main");  // the main thread takes lane 0
+
+    test(profiler_trace_export);
+    test(profiler_trace_rings);
+
+    return summary();
+}
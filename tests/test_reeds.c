@@ -205,7 +205,7 @@ describe(reeds_gather) {
         // Find the spawned item
         bool foundReeds = false;
         for (int i = 0; i < itemCount; i++) {
-            if (items[i].active && items[i].type == ITEM_REEDS) {
+            if (itemActive[i] && items[i].type == ITEM_REEDS) {
                 foundReeds = true;
                 break;
             }
@@ -0,0 +1,203 @@
+#include "../vendor/c89spec.h"
+#include "../vendor/raylib.h"
+#include "../src/world/grid.h"
+#include "test_helpers.h"
+#include "../src/world/cell_defs.h"
+#include "../src/world/pathfinding.h"
+#include "../src/world/designations.h"
+#include "../src/world/cell_edits.h"
+#include "../src/entities/mover.h"
+#include "../src/entities/items.h"
+#include "../src/entities/jobs.h"
+#include "../src/entities/stockpiles.h"
+#include "../src/core/sim_manager.h"
+#include "../src/core/sim_rng.h"
+#include "../src/core/time.h"
+#include "../src/core/input_mode.h"
+#include "../src/game_state.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+// The recorder and the real console command path. test_unity.o leaves both
+// out: they call into input.c and the UI, stubbed below.
+#include "../src/core/replay.c"
+#include "../src/ui/console.c"
+
+static bool test_verbose = false;
+
+// --- Stubs for what console.c reads from main.c and the UI ---
+bool showGraph, showEntrances, showChunkBoundaries, showMovers, showMoverPaths;
+bool showJobLines, showNeighborCounts, showOpenArea, showKnotDetection;
+bool showStuckDetection, showItems, showSimSources, showTemperatureOverlay;
+bool cullDrawing, usePixelPerfectMovers;
+int currentTerrain = 0;
+const char* terrainNames[] = { "Flat" };
+Vector2 ScreenToGrid(Vector2 screen) { return screen; }
+void GenerateCurrentTerrain(void) {}
+void DrawTextShadow(const char* text, int x, int y, int size, Color col) {
+    (void)text; (void)x; (void)y; (void)size; (void)col;
+}
+int MeasureTextUI(const char* text, int size) { (void)text; return size; }
+
+// input.c's drag path (it needs the whole UI): records the command, then
+// runs the mine designation the way ACTION_WORK_MINE does
+void ExecuteDragCommand(const DragCommand* cmd) {
+    ReplayRecordDrag(cmd);
+    BeginCellEdits();
+    for (int y = cmd->y1; y <= cmd->y2; y++)
+        for (int x = cmd->x1; x <= cmd->x2; x++)
+            DesignateMine(x, y, cmd->z1);
+    CommitCellEdits();
+}
+
+// What the console does when the player presses enter
+static void SubmitConsole(const char* line, int x, int y, int z) {
+    ReplayRecordConsole(line, x, y, z);
+    Console_ExecuteAt(line, x, y, z);
+}
+
+static const char* replayPath = "/tmp/navkit_test_replay.nvr";
+static const char* replaySavePath = "/tmp/navkit_test_replay.nvr.sav";
+
+// Open field, a stone block to mine and a few wandering movers
+static void SetupReplayWorld(void) {
+    InitTestGridFromAscii(
+        "................\n"
+        "................\n"
+        "....######......\n"
+        "....######......\n"
+        "................\n"
+        "................\n"
+        "................\n"
+        "................\n"
+        "................\n"
+        "................\n");
+    SeedRandom(4242);
+    InitTime();
+    moverPathAlgorithm = PATH_ALGO_ASTAR;
+    ClearMovers();
+    ClearItems();
+    ClearJobs();
+    ClearStockpiles();
+    InitDesignations();
+    InitMoverSpatialGrid(gridWidth * CELL_SIZE, gridHeight * CELL_SIZE);
+    for (int i = 0; i < 4; i++) {
+        Point goal = {i * 3, 8, 0};
+        InitMover(&movers[i], (i * 3 + 0.5f) * CELL_SIZE, 6.5f * CELL_SIZE, 0.0f, goal, 100.0f);
+    }
+    moverCount = 4;
+    Console_Init();
+}
+
+static DragCommand MineDrag(int x1, int y1, int x2, int y2) {
+    DragCommand cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.action = ACTION_WORK_MINE;
+    cmd.x1 = (int16_t)x1; cmd.y1 = (int16_t)y1;
+    cmd.x2 = (int16_t)x2; cmd.y2 = (int16_t)y2;
+    cmd.leftClick = 1;
+    return cmd;
+}
+
+// Issue this tick's player commands, as the game does between ticks
+static void IssueCommands(int tick) {
+    if (tick == 10) {
+        DragCommand cmd = MineDrag(4, 2, 6, 3);
+        ExecuteDragCommand(&cmd);
+    }
+    if (tick == 40) SubmitConsole("spawn 3 rock", 10, 8, 0);
+    if (tick == 90) {
+        DragCommand cmd = MineDrag(7, 2, 9, 2);
+        ExecuteDragCommand(&cmd);
+    }
+    if (tick == 150) SubmitConsole("spawn 2 log", 2, 1, 0);
+}
+
+// Replays the recording; returns the number of ticks run
+static int RunReplay(void) {
+    SetupReplayWorld();  // replay loads over whatever state is live
+    expect(ReplayOpen(replayPath));
+    int ticks = 0;
+    float dt = TICK_DT;
+    while (ReplayApplyTick(&dt)) {
+        RunSimTick(dt);
+        ReplayEndTick();
+        ticks++;
+    }
+    ReplayClose();
+    return ticks;
+}
+
+describe(replay_round_trip) {
+    const int tickCount = 1500;
+
+    it("should reproduce the recorded state hash") {
+        SetupReplayWorld();
+        expect(ReplayStartRecording(replayPath, 4242));
+        for (int t = 0; t < tickCount; t++) {
+            IssueCommands(t);
+            ReplayBeginTick(TICK_DT);
+            RunSimTick(TICK_DT);
+            ReplayEndTick();
+        }
+        uint64_t recorded = ComputeSimStateHash();
+        int mined = 0;
+        for (int x = 4; x <= 9; x++) {
+            if (grid[0][2][x] != CELL_WALL) mined++;
+        }
+        ReplayStopRecording();
+        if (test_verbose) printf("recorded hash %016llx, %d cells mined\n", (unsigned long long)recorded, mined);
+        expect(mined > 0);  // the commands changed the world
+
+        int replayed = RunReplay();
+        expect(replayed == tickCount);
+        expect(ReplayHasEndHash());
+        expect(ReplayGetEndTick() == (uint32_t)tickCount);
+        expect(ReplayGetEndHash() == recorded);
+        expect(ComputeSimStateHash() == recorded);
+    }
+
+    it("should replay the same way twice") {
+        RunReplay();
+        uint64_t first = ComputeSimStateHash();
+        RunReplay();
+        expect(ComputeSimStateHash() == first);
+        expect(first == ReplayGetEndHash());
+    }
+
+    it("should diverge when a command is left out of the live run") {
+        SetupReplayWorld();
+        expect(ReplayStartRecording(replayPath, 4242));
+        for (int t = 0; t < tickCount; t++) {
+            ReplayBeginTick(TICK_DT);
+            RunSimTick(TICK_DT);
+            ReplayEndTick();
+        }
+        uint64_t idle = ComputeSimStateHash();
+        ReplayStopRecording();
+
+        // Same start, now with the commands: the hash tracks them
+        SetupReplayWorld();
+        expect(ReplayStartRecording(replayPath, 4242));
+        for (int t = 0; t < tickCount; t++) {
+            IssueCommands(t);
+            ReplayBeginTick(TICK_DT);
+            RunSimTick(TICK_DT);
+            ReplayEndTick();
+        }
+        ReplayStopRecording();
+        expect(ComputeSimStateHash() != idle);
+        remove(replayPath);
+        remove(replaySavePath);
+    }
+}
+
+int main(int argc, char** argv) {
+    test_verbose = c89spec_parse_args(argc, argv);
+    if (!test_verbose) SetTraceLogLevel(LOG_NONE);
+
+    test(replay_round_trip);
+
+    return summary();
+}
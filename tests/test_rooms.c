@@ -23,6 +23,9 @@ static bool test_verbose = false;
 #include "test_helpers.h"
 #include <string.h>
 
+bool SaveWorld(const char* filename);
+bool LoadWorld(const char* filename);
+
 // Build a flat ground: z=0 solid dirt, z=1 walkable air with floor
 static void SetupFlatGround(int w, int h) {
     InitTestGrid(w, h);
@@ -83,6 +86,23 @@ static void PlaceConstructedFloor(int x, int y) {
     ClearFloorNatural(x, y, 1);
 }
 
+// True if two room grids at z describe the same partition (ids may differ)
+static uint16_t partitionMap[MAX_DETECTED_ROOMS];
+static bool SamePartition(uint16_t (*a)[512], uint16_t (*b)[512], int w, int h) {
+    memset(partitionMap, 0, sizeof(partitionMap));
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            if ((a[y][x] == ROOM_NONE) != (b[y][x] == ROOM_NONE)) return false;
+            if (a[y][x] == ROOM_NONE) continue;
+            if (partitionMap[a[y][x]] == 0) partitionMap[a[y][x]] = b[y][x];
+            else if (partitionMap[a[y][x]] != b[y][x]) return false;
+        }
+    }
+    return true;
+}
+
+static uint16_t roomSnapshot[512][512];
+
 describe(test_rooms) {
 
     // --- Detection basics ---
@@ -467,6 +487,160 @@ describe(test_rooms) {
         expect(ridZ2 != ROOM_NONE);
         expect(ridZ1 != ridZ2);
     }
+
+    // --- Incremental updates ---
+
+    it("building a wall inside a room splits it without a full recompute") {
+        SetupFlatGround(16, 16);
+        BuildWalledRoom(2, 2, 12, 8);
+        PlaceDoor(4, 8);
+        UpdateRooms();
+        uint16_t before = GetRoomAt(5, 5, 1);
+        expect(before != ROOM_NONE);
+
+        int fullBefore = roomsFullRecomputeCount;
+        int incBefore = roomsIncrementalUpdateCount;
+        for (int y = 3; y <= 7; y++) {
+            grid[1][y][7] = CELL_WALL;
+            SetWallMaterial(7, y, 1, MAT_GRANITE);
+            InvalidateRoomsAt(7, y, 1);
+        }
+        UpdateRooms();
+
+        expect(roomsFullRecomputeCount == fullBefore);
+        expect(roomsIncrementalUpdateCount == incBefore + 1);
+        uint16_t left = GetRoomAt(4, 5, 1);
+        uint16_t right = GetRoomAt(10, 5, 1);
+        expect(left != ROOM_NONE);
+        expect(right != ROOM_NONE);
+        expect(left != right);
+        expect(GetRoomAt(7, 5, 1) == ROOM_NONE);
+        expect(GetRoom(right)->cellCount == 4 * 5);
+    }
+
+    it("removing a shared wall merges two rooms") {
+        SetupFlatGround(16, 16);
+        BuildWalledRoom(2, 2, 7, 7);
+        BuildWalledRoom(7, 2, 12, 7);
+        UpdateRooms();
+        expect(GetRoomAt(4, 4, 1) != GetRoomAt(10, 4, 1));
+
+        int fullBefore = roomsFullRecomputeCount;
+        for (int y = 3; y <= 6; y++) {
+            grid[1][y][7] = CELL_AIR;
+            InvalidateRoomsAt(7, y, 1);
+        }
+        UpdateRooms();
+
+        expect(roomsFullRecomputeCount == fullBefore);
+        uint16_t rid = GetRoomAt(4, 4, 1);
+        expect(rid != ROOM_NONE);
+        expect(GetRoomAt(10, 4, 1) == rid);
+        expect(GetRoom(rid)->cellCount == 4 * 9);
+    }
+
+    it("untouched rooms keep their id across local edits") {
+        SetupFlatGround(20, 16);
+        BuildWalledRoom(1, 1, 5, 5);
+        BuildWalledRoom(10, 1, 16, 7);
+        UpdateRooms();
+        uint16_t far = GetRoomAt(3, 3, 1);
+        int farCells = GetRoom(far)->cellCount;
+
+        grid[1][4][13] = CELL_WALL;
+        SetWallMaterial(13, 4, 1, MAT_GRANITE);
+        InvalidateRoomsAt(13, 4, 1);
+        UpdateRooms();
+
+        expect(GetRoomAt(3, 3, 1) == far);
+        expect(GetRoom(far)->cellCount == farCells);
+        expect(GetRoom(GetRoomAt(12, 3, 1))->cellCount == 5 * 5 - 1);
+    }
+
+    it("opening a room to the outside removes it") {
+        SetupFlatGround(16, 16);
+        BuildWalledRoom(3, 3, 7, 7);
+        UpdateRooms();
+        expect(GetRoomAt(5, 5, 1) != ROOM_NONE);
+
+        grid[1][7][5] = CELL_AIR;
+        InvalidateRoomsAt(5, 7, 1);
+        UpdateRooms();
+
+        expect(GetRoomAt(5, 5, 1) == ROOM_NONE);
+    }
+
+    it("spawning furniture reclassifies only its room") {
+        SetupFlatGround(20, 16);
+        BuildWalledRoom(1, 1, 5, 5);
+        BuildWalledRoom(10, 1, 14, 5);
+        UpdateRooms();
+        uint16_t a = GetRoomAt(3, 3, 1);
+
+        int fullBefore = roomsFullRecomputeCount;
+        SpawnFurniture(12, 3, 1, FURNITURE_PLANK_BED, MAT_NONE);
+        UpdateRooms();
+
+        expect(roomsFullRecomputeCount == fullBefore);
+        expect(GetRoomAt(3, 3, 1) == a);
+        expect(GetRoom(a)->type == ROOM_TYPE_GENERIC);
+        uint16_t bed = GetRoomAt(12, 2, 1);
+        expect(bed != ROOM_NONE);
+        expect(GetRoom(bed)->type == ROOM_TYPE_BEDROOM);
+    }
+
+    it("incremental updates match a full recompute") {
+        SetupFlatGround(32, 32);
+        BuildWalledRoom(1, 1, 10, 10);
+        BuildWalledRoom(10, 1, 20, 12);
+        BuildWalledRoom(4, 14, 28, 28);
+        PlaceDoor(10, 5);
+        UpdateRooms();
+
+        // Scatter wall toggles across rooms and outdoors
+        unsigned int seed = 12345;
+        for (int step = 0; step < 60; step++) {
+            seed = seed * 1103515245u + 12345u;
+            int x = 1 + (int)((seed >> 8) % 30);
+            int y = 1 + (int)((seed >> 16) % 30);
+            if (grid[1][y][x] == CELL_WALL) {
+                grid[1][y][x] = CELL_AIR;
+            } else {
+                grid[1][y][x] = CELL_WALL;
+                SetWallMaterial(x, y, 1, MAT_GRANITE);
+            }
+            InvalidateRoomsAt(x, y, 1);
+            if (step % 3 == 0) UpdateRooms();
+        }
+        UpdateRooms();
+        memcpy(roomSnapshot, roomGrid[1], sizeof(roomSnapshot));
+
+        InvalidateRooms();
+        UpdateRooms();
+        expect(SamePartition(roomSnapshot, roomGrid[1], 32, 32));
+    }
+
+    it("loading a save drops the rooms of the world it replaces") {
+        SetupFlatGround(16, 16);
+        BuildWalledRoom(1, 1, 6, 6);
+        PlaceDoor(3, 6);
+        UpdateRooms();
+        expect(GetRoomAt(3, 3, 1) != ROOM_NONE);
+        SaveWorld("/tmp/test_rooms_save.bin");
+
+        // A different world: the first room is gone, another one stands
+        SetupFlatGround(16, 16);
+        BuildWalledRoom(8, 8, 14, 14);
+        PlaceDoor(10, 14);
+        UpdateRooms();
+        expect(GetRoomAt(3, 3, 1) == ROOM_NONE);
+        expect(GetRoomAt(11, 11, 1) != ROOM_NONE);
+
+        LoadWorld("/tmp/test_rooms_save.bin");
+        UpdateRooms();
+        expect(GetRoomAt(3, 3, 1) != ROOM_NONE);
+        expect(GetRoomAt(11, 11, 1) == ROOM_NONE);
+    }
 }
 
 int main(int argc, char *argv[]) {
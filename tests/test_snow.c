@@ -11,6 +11,7 @@
 #include "../src/world/cell_defs.h"
 #include "../src/world/material.h"
 #include "../src/entities/mover.h"
+#include "../src/core/sim_manager.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -259,6 +260,27 @@ describe(snow_melting) {
         // Snow should not melt
         expect(GetSnowLevel(5, 5, 0) == 2);
     }
+
+    it("melts snow in a far chunk and clears its snow activity") {
+        InitGridWithSizeAndChunkSize(32, 32, 8, 8);
+        InitSnow();
+        InitWeather();
+
+        grid[0][28][27] = CELL_WALL; SetWallMaterial(27, 28, 0, MAT_DIRT);
+        SetSnowLevel(27, 28, 0, 1);
+        expect(ChunkHasActivity(ACTIVITY_SNOW, 0, 3, 3));
+        expect(chunkActiveTotal[ACTIVITY_SNOW] == 1);
+
+        SetTestTemperature(5);
+        for (int i = 0; i < 250; i++) {
+            gameDeltaTime = 0.1f; UpdateSnow();
+        }
+
+        expect(GetSnowLevel(27, 28, 0) == 0);
+        expect(!ChunkHasActivity(ACTIVITY_SNOW, 0, 3, 3));
+        expect(chunkActiveTotal[ACTIVITY_SNOW] == 0);
+        expect(GET_CELL_WETNESS(27, 28, 0) > 0);
+    }
 }
 
 // ========== Snow Movement Penalty ==========
@@ -307,7 +329,7 @@ describe(snow_fire_interaction) {
         // Flammable cell with fire
         grid[0][5][5] = CELL_WALL; SetWallMaterial(5, 5, 0, MAT_DIRT);
         SetFireLevel(5, 5, 0, 5);
-        fireGrid[0][5][5].fuel = 100;  // Give it fuel so it doesn't die on its own
+        FireCellForWrite(5, 5, 0)->fuel = 100;  // Give it fuel so it doesn't die on its own
         
         // Add moderate snow
         SetSnowLevel(5, 5, 0, 2);
@@ -326,7 +348,7 @@ describe(snow_fire_interaction) {
         
         grid[0][5][5] = CELL_WALL; SetWallMaterial(5, 5, 0, MAT_DIRT);
         SetFireLevel(5, 5, 0, 5);
-        fireGrid[0][5][5].fuel = 100;  // Give it fuel
+        FireCellForWrite(5, 5, 0)->fuel = 100;  // Give it fuel
         SetSnowLevel(5, 5, 0, 1);  // Light snow (< 2, shouldn't extinguish)
         
         // Run fire update
@@ -101,7 +101,7 @@ describe(spoilage_condition) {
         ClearItems();
         int idx = SpawnItem(0, 0, 1, ITEM_BERRIES);
         TickSpoilage(480.0f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].type == ITEM_BERRIES);
         expect(items[idx].condition == CONDITION_ROTTEN);
     }
@@ -139,7 +139,7 @@ describe(spoilage_timer) {
         int idx = SpawnItem(0, 0, 1, ITEM_ROCK);
         expect(idx >= 0);
         TickSpoilage(1000.0f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].spoilageTimer == 0.0f);
     }
 
@@ -149,7 +149,7 @@ describe(spoilage_timer) {
         int idx = SpawnItem(0, 0, 1, ITEM_BERRIES);
         expect(idx >= 0);
         TickSpoilage(100.0f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].spoilageTimer >= 99.0f);
         expect(items[idx].spoilageTimer <= 101.0f);
     }
@@ -178,7 +178,7 @@ describe(spoilage_timer) {
         int idx = SpawnItem(0, 0, 1, ITEM_BERRIES);
         items[idx].spoilageTimer = 479.0f;
         ItemsTick(0.5f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].type == ITEM_BERRIES);
         expect(items[idx].condition != CONDITION_ROTTEN);
     }
@@ -187,9 +187,9 @@ describe(spoilage_timer) {
         InitTestGridFromAscii("....\n....\n");
         ClearItems();
         int idx = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
-        items[idx].state = ITEM_CARRIED;
+        itemState[idx] = ITEM_CARRIED;
         TickSpoilage(200.0f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].spoilageTimer == 0.0f);
     }
 
@@ -197,7 +197,7 @@ describe(spoilage_timer) {
         InitTestGridFromAscii("....\n....\n");
         ClearItems();
         int idx = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
-        items[idx].reservedBy = 0;
+        itemReservedBy[idx] = 0;
         TickSpoilage(120.0f);
         expect(items[idx].condition == CONDITION_ROTTEN);
     }
@@ -218,7 +218,7 @@ describe(spoilage_timer) {
         ClearItems();
         int idx = SpawnItem(0, 0, 1, ITEM_CARCASS);
         TickSpoilage(59.0f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].condition != CONDITION_ROTTEN);
         TickSpoilage(2.0f);
         expect(items[idx].condition == CONDITION_ROTTEN);
@@ -230,7 +230,7 @@ describe(spoilage_timer) {
         ClearItems();
         int idx = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
         TickSpoilage(119.0f);
-        expect(items[idx].active);
+        expect(itemActive[idx]);
         expect(items[idx].condition != CONDITION_ROTTEN);
         TickSpoilage(2.0f);
         expect(items[idx].condition == CONDITION_ROTTEN);
@@ -249,11 +249,11 @@ describe(spoilage_containers) {
         int pot = SpawnItem(0, 0, 1, ITEM_CLAY_POT);
         int berries = SpawnItem(0, 0, 1, ITEM_BERRIES);
         items[berries].containedIn = pot;
-        items[berries].state = ITEM_IN_CONTAINER;
+        itemState[berries] = ITEM_IN_CONTAINER;
         items[pot].contentCount = 1;
         // Tick past normal limit (480s) — should still be alive with 0.5x modifier
         TickSpoilage(480.0f);
-        expect(items[berries].active);
+        expect(itemActive[berries]);
         expect(items[berries].type == ITEM_BERRIES);
         expect(items[berries].condition != CONDITION_ROTTEN);
         // Tick to effective limit (960s)
@@ -268,7 +268,7 @@ describe(spoilage_containers) {
         int basket = SpawnItem(0, 0, 1, ITEM_BASKET);
         int berries = SpawnItem(0, 0, 1, ITEM_BERRIES);
         items[berries].containedIn = basket;
-        items[berries].state = ITEM_IN_CONTAINER;
+        itemState[berries] = ITEM_IN_CONTAINER;
         items[basket].contentCount = 1;
         TickSpoilage(480.0f);
         expect(items[berries].condition == CONDITION_ROTTEN);
@@ -281,14 +281,14 @@ describe(spoilage_containers) {
         int basket = SpawnItem(0, 0, 1, ITEM_BASKET);
         int berries = SpawnItem(0, 0, 1, ITEM_BERRIES);
         items[basket].containedIn = chest;
-        items[basket].state = ITEM_IN_CONTAINER;
+        itemState[basket] = ITEM_IN_CONTAINER;
         items[chest].contentCount = 1;
         items[berries].containedIn = basket;
-        items[berries].state = ITEM_IN_CONTAINER;
+        itemState[berries] = ITEM_IN_CONTAINER;
         items[basket].contentCount = 1;
         // Effective limit = 480 / 0.7 ≈ 685.7s
         TickSpoilage(480.0f);
-        expect(items[berries].active);
+        expect(itemActive[berries]);
         expect(items[berries].condition != CONDITION_ROTTEN);
         TickSpoilage(210.0f); // total ~690s, past effective limit
         expect(items[berries].condition == CONDITION_ROTTEN);
@@ -300,11 +300,11 @@ describe(spoilage_containers) {
         int basket = SpawnItem(0, 0, 1, ITEM_BASKET);
         int meat = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
         items[meat].containedIn = basket;
-        items[meat].state = ITEM_IN_CONTAINER;
+        itemState[meat] = ITEM_IN_CONTAINER;
         items[basket].contentCount = 1;
-        items[basket].state = ITEM_CARRIED;
+        itemState[basket] = ITEM_CARRIED;
         TickSpoilage(200.0f);
-        expect(items[meat].active);
+        expect(itemActive[meat]);
         expect(items[meat].spoilageTimer == 0.0f);
     }
 }
@@ -407,7 +407,7 @@ describe(spoilage_e2e) {
         ClearItems();
         int dried = SpawnItem(0, 0, 1, ITEM_DRIED_BERRIES);
         TickSpoilage(1000.0f);
-        expect(items[dried].active);
+        expect(itemActive[dried]);
         expect(items[dried].type == ITEM_DRIED_BERRIES);
         expect(items[dried].condition == CONDITION_FRESH);
     }
@@ -420,7 +420,7 @@ describe(spoilage_e2e) {
         // After 120s, raw should be rotten, cooked still alive
         TickSpoilage(120.0f);
         expect(items[raw].condition == CONDITION_ROTTEN);
-        expect(items[cooked].active);
+        expect(itemActive[cooked]);
         expect(items[cooked].condition != CONDITION_ROTTEN);
         // After 300s total, cooked should also be rotten
         TickSpoilage(180.0f);
@@ -434,19 +434,19 @@ describe(spoilage_e2e) {
         int basket = SpawnItem(0, 0, 1, ITEM_BASKET);
         int inBasket = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
         items[inBasket].containedIn = basket;
-        items[inBasket].state = ITEM_IN_CONTAINER;
+        itemState[inBasket] = ITEM_IN_CONTAINER;
         items[basket].contentCount = 1;
 
         int chest = SpawnItem(0, 0, 1, ITEM_CHEST);
         int inChest = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
         items[inChest].containedIn = chest;
-        items[inChest].state = ITEM_IN_CONTAINER;
+        itemState[inChest] = ITEM_IN_CONTAINER;
         items[chest].contentCount = 1;
 
         int pot = SpawnItem(0, 0, 1, ITEM_CLAY_POT);
         int inPot = SpawnItem(0, 0, 1, ITEM_RAW_MEAT);
         items[inPot].containedIn = pot;
-        items[inPot].state = ITEM_IN_CONTAINER;
+        itemState[inPot] = ITEM_IN_CONTAINER;
         items[pot].contentCount = 1;
 
         // At 120s: ground=rotten (1.0x), basket=rotten (1.0x)
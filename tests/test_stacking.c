@@ -34,7 +34,7 @@ describe(merge_into_stack) {
 
         expect(merged == 2);
         expect(items[a].stackCount == 5);
-        expect(!items[b].active);  // incoming item deleted
+        expect(!itemActive[b]);  // incoming item deleted
     }
 
     it("should partially merge when exceeding max stack") {
@@ -49,7 +49,7 @@ describe(merge_into_stack) {
 
         expect(merged == 2);
         expect(items[a].stackCount == maxStack);
-        expect(items[b].active);  // incoming kept with remainder
+        expect(itemActive[b]);  // incoming kept with remainder
         expect(items[b].stackCount == 3);
     }
 
@@ -65,7 +65,7 @@ describe(merge_into_stack) {
 
         expect(merged == 0);
         expect(items[a].stackCount == maxStack);
-        expect(items[b].active);
+        expect(itemActive[b]);
         expect(items[b].stackCount == 1);
     }
 
@@ -91,7 +91,7 @@ describe(merge_into_stack) {
         Setup();
         int a = SpawnItem(16, 16, 0, ITEM_RED);
         int b = SpawnItem(16, 16, 0, ITEM_RED);
-        items[b].active = false;
+        itemActive[b] = false;
 
         expect(MergeItemIntoStack(a, b) == 0);
     }
@@ -111,7 +111,7 @@ describe(split_stack) {
         expect(b >= 0);
         expect(items[a].stackCount == 3);
         expect(items[b].stackCount == 2);
-        expect(items[b].active);
+        expect(itemActive[b]);
         expect(items[b].type == ITEM_RED);
     }
 
@@ -124,9 +124,9 @@ describe(split_stack) {
         int b = SplitStack(a, 1);
 
         expect(b >= 0);
-        expect(items[b].x == items[a].x);
-        expect(items[b].y == items[a].y);
-        expect(items[b].z == items[a].z);
+        expect(itemPosX[b] == itemPosX[a]);
+        expect(itemPosY[b] == itemPosY[a]);
+        expect(itemPosZ[b] == itemPosZ[a]);
         expect(items[b].material == MAT_OAK);
     }
 
@@ -134,12 +134,12 @@ describe(split_stack) {
         Setup();
         int a = SpawnItem(16, 16, 0, ITEM_RED);
         items[a].stackCount = 3;
-        items[a].state = ITEM_IN_STOCKPILE;
+        itemState[a] = ITEM_IN_STOCKPILE;
 
         int b = SplitStack(a, 1);
 
         expect(b >= 0);
-        expect(items[b].state == ITEM_IN_STOCKPILE);
+        expect(itemState[b] == ITEM_IN_STOCKPILE);
     }
 
     it("should fail when count is 0") {
@@ -179,7 +179,7 @@ describe(split_stack) {
         Setup();
         int a = SpawnItem(16, 16, 0, ITEM_RED);
         items[a].stackCount = 3;
-        items[a].active = false;
+        itemActive[a] = false;
 
         expect(SplitStack(a, 1) == -1);
     }
@@ -228,7 +228,7 @@ describe(stockpile_stacking) {
         PlaceItemInStockpile(sp, 1, 1, b);
 
         expect(GetStockpileSlotCount(sp, 1, 1) == 5);
-        expect(!items[b].active);  // merged into a
+        expect(!itemActive[b]);  // merged into a
         expect(items[a].stackCount == 5);
     }
 
@@ -247,7 +247,7 @@ describe(stockpile_stacking) {
 
         // Should not merge — material mismatch
         expect(GetStockpileSlotCount(sp, 1, 1) == 2);  // still just a's count
-        expect(items[b].active);  // b not deleted
+        expect(itemActive[b]);  // b not deleted
     }
 
     it("should report overfull when slot exceeds max") {
@@ -280,10 +280,10 @@ describe(stockpile_stacking) {
         Stockpile* s = &stockpiles[sp];
         int repIdx = s->slots[0];
         expect(repIdx >= 0);
-        expect(items[repIdx].active);
+        expect(itemActive[repIdx]);
         expect(items[repIdx].stackCount == 4);
         expect(items[repIdx].type == ITEM_RED);
-        expect(items[repIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[repIdx] == ITEM_IN_STOCKPILE);
     }
 }
 
@@ -303,7 +303,7 @@ describe(roundtrip) {
         int merged = MergeItemIntoStack(a, b);
         expect(merged == 3);
         expect(items[a].stackCount == 8);
-        expect(!items[b].active);
+        expect(!itemActive[b]);
     }
 }
 
@@ -384,15 +384,15 @@ describe(craft_pickup_split) {
         // Mover should be carrying 4 planks (recipe inputCount)
         int carriedIdx = job->carryingItem;
         expect(carriedIdx >= 0);
-        expect(items[carriedIdx].active == true);
+        expect(itemActive[carriedIdx] == true);
         expect(items[carriedIdx].type == ITEM_PLANKS);
         expect(items[carriedIdx].stackCount == 4);
-        expect(items[carriedIdx].state == ITEM_CARRIED);
+        expect(itemState[carriedIdx] == ITEM_CARRIED);
 
         // Stockpile should still have 6 planks remaining
         expect(spPtr->slots[slotIdx] >= 0);
         int remainIdx = spPtr->slots[slotIdx];
-        expect(items[remainIdx].active == true);
+        expect(itemActive[remainIdx] == true);
         expect(items[remainIdx].stackCount == 6);
         expect(spPtr->slotCounts[slotIdx] == 6);
     }
@@ -497,12 +497,12 @@ describe(take_from_stockpile_slot) {
         expect(taken != berryIdx);
         expect(items[taken].type == ITEM_BERRIES);
         expect(items[taken].stackCount == 3);
-        expect(items[taken].state == ITEM_ON_GROUND);
+        expect(itemState[taken] == ITEM_ON_GROUND);
 
         // Original stays in stockpile with reduced count
-        expect(items[berryIdx].active == true);
+        expect(itemActive[berryIdx] == true);
         expect(items[berryIdx].stackCount == 7);
-        expect(items[berryIdx].state == ITEM_IN_STOCKPILE);
+        expect(itemState[berryIdx] == ITEM_IN_STOCKPILE);
         expect(spPtr->slots[slotIdx] == berryIdx);
         expect(spPtr->slotCounts[slotIdx] == 7);
     }
@@ -556,16 +556,16 @@ describe(take_from_stockpile_slot) {
         float slotY = freeY * CELL_SIZE + CELL_SIZE * 0.5f;
         int berryIdx = SpawnItemWithMaterial(slotX, slotY, 0.0f, ITEM_BERRIES, MAT_NONE);
         items[berryIdx].stackCount = 10;
-        items[berryIdx].reservedBy = 3; // reserved by mover 3
+        itemReservedBy[berryIdx] = 3; // reserved by mover 3
         PlaceItemInStockpile(sp, freeX, freeY, berryIdx);
 
         int taken = TakeFromStockpileSlot(berryIdx, 2);
 
         // Split-off gets the reservation
         expect(taken >= 0);
-        expect(items[taken].reservedBy == 3);
+        expect(itemReservedBy[taken] == 3);
         // Original is now unreserved (available for other jobs)
-        expect(items[berryIdx].reservedBy == -1);
+        expect(itemReservedBy[berryIdx] == -1);
     }
 
     it("should pass through non-stockpile items unchanged") {
@@ -655,7 +655,7 @@ describe(deliver_to_workshop_split) {
         expect(items[berryIdx].stackCount == 9);
         expect(spPtr->slotCounts[slotIdx] == 9);
         // Original should be unreserved (available for more deliveries)
-        expect(items[berryIdx].reservedBy == -1);
+        expect(itemReservedBy[berryIdx] == -1);
     }
 }
 
@@ -699,7 +699,7 @@ describe(passive_consumption_stacks) {
         int berriesRemaining = 0;
         int driedBerriesCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type == ITEM_BERRIES) berriesRemaining += items[i].stackCount;
             if (items[i].type == ITEM_DRIED_BERRIES) driedBerriesCount += items[i].stackCount;
         }
@@ -738,7 +738,7 @@ describe(passive_consumption_stacks) {
         int berriesRemaining = 0;
         int driedBerriesCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type == ITEM_BERRIES) berriesRemaining += items[i].stackCount;
             if (items[i].type == ITEM_DRIED_BERRIES) driedBerriesCount += items[i].stackCount;
         }
@@ -779,7 +779,7 @@ describe(passive_consumption_stacks) {
         int berriesRemaining = 0;
         int driedBerriesCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type == ITEM_BERRIES) berriesRemaining += items[i].stackCount;
             if (items[i].type == ITEM_DRIED_BERRIES) driedBerriesCount += items[i].stackCount;
         }
@@ -879,7 +879,7 @@ describe(active_craft_split) {
         int carriedIdx = job->carryingItem;
         expect(carriedIdx >= 0);
         expect(items[carriedIdx].stackCount == 4);
-        expect(items[carriedIdx].state == ITEM_CARRIED);
+        expect(itemState[carriedIdx] == ITEM_CARRIED);
 
         // Stockpile keeps 6
         Stockpile* spPtr = &stockpiles[sp];
@@ -996,7 +996,7 @@ describe(semi_passive_consumption_stacks) {
         int sticksRemaining = 0;
         int charcoalCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (!items[i].active) continue;
+            if (!itemActive[i]) continue;
             if (items[i].type == ITEM_STICKS) sticksRemaining += items[i].stackCount;
             if (items[i].type == ITEM_CHARCOAL) charcoalCount += items[i].stackCount;
         }
@@ -1141,7 +1141,7 @@ describe(e2e_craft_chest_from_stack) {
 
             // Check if a chest exists
             for (int i = 0; i < itemHighWaterMark; i++) {
-                if (items[i].active && items[i].type == ITEM_CHEST) {
+                if (itemActive[i] && items[i].type == ITEM_CHEST) {
                     chestFound = true;
                     break;
                 }
@@ -1154,7 +1154,7 @@ describe(e2e_craft_chest_from_stack) {
         // Count remaining plank units
         int plankUnits = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_PLANKS) {
+            if (itemActive[i] && items[i].type == ITEM_PLANKS) {
                 plankUnits += items[i].stackCount;
             }
         }
@@ -1164,7 +1164,7 @@ describe(e2e_craft_chest_from_stack) {
         // Count chests
         int chestCount = 0;
         for (int i = 0; i < itemHighWaterMark; i++) {
-            if (items[i].active && items[i].type == ITEM_CHEST) {
+            if (itemActive[i] && items[i].type == ITEM_CHEST) {
                 chestCount++;
             }
         }
@@ -1210,7 +1210,7 @@ static void SpawnE2EMover(int tileX, int tileY, int z) {
 static int CountItemUnits(ItemType type) {
     int total = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type)
+        if (itemActive[i] && items[i].type == type)
             total += items[i].stackCount;
     }
     return total;
@@ -1439,8 +1439,8 @@ describe(e2e_rehaul_after_drop) {
         // Delete stockpile 1 — items should drop to ground
         RemoveStockpileCells(sp1, 4, 4, 4, 4);
 
-        expect(items[plankIdx].active);
-        expect(items[plankIdx].state == ITEM_ON_GROUND);
+        expect(itemActive[plankIdx]);
+        expect(itemState[plankIdx] == ITEM_ON_GROUND);
         expect(items[plankIdx].stackCount == 5);
 
         // Run simulation — mover should haul the dropped stack to sp2
@@ -1449,7 +1449,7 @@ describe(e2e_rehaul_after_drop) {
             Tick();
             AssignJobs();
             JobsTick();
-            if (items[plankIdx].state == ITEM_IN_STOCKPILE) {
+            if (itemState[plankIdx] == ITEM_IN_STOCKPILE) {
                 hauled = true;
                 break;
             }
@@ -1551,8 +1551,8 @@ describe(free_slot_count_after_remove) {
         expect(!stockpiles[sp].active);
 
         // Item should be on ground
-        expect(items[a].active);
-        expect(items[a].state == ITEM_ON_GROUND);
+        expect(itemActive[a]);
+        expect(itemState[a] == ITEM_ON_GROUND);
         expect(items[a].stackCount == 3);
     }
 }
@@ -1570,15 +1570,15 @@ describe(remove_stockpile_cell_drops_stack) {
         items[a].stackCount = 3;
         PlaceItemInStockpile(sp, 1, 1, a);
 
-        expect(items[a].state == ITEM_IN_STOCKPILE);
+        expect(itemState[a] == ITEM_IN_STOCKPILE);
         expect(items[a].stackCount == 3);
 
         // Remove the cell
         RemoveStockpileCells(sp, 1, 1, 1, 1);
 
         // Item should be dropped to ground with full stack intact
-        expect(items[a].active);
-        expect(items[a].state == ITEM_ON_GROUND);
+        expect(itemActive[a]);
+        expect(itemState[a] == ITEM_ON_GROUND);
         expect(items[a].stackCount == 3);
     }
 }
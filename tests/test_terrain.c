@@ -4,6 +4,7 @@
 #include "../src/world/cell_defs.h"
 #include "../src/world/material.h"
 #include "../src/world/terrain.h"
+#include "../src/world/worldgen_tiles.h"
 #include "../src/game_state.h"
 #include "../src/simulation/water.h"
 #include "../src/entities/items.h"
@@ -364,6 +365,83 @@ describe(connectivity_fix_preserves_largest) {
     }
 }
 
+// =============================================================================
+// Tile-parallel worldgen: same world for any thread count
+// =============================================================================
+
+static uint64_t HashWorldCells(void) {
+    uint64_t h = 1469598103934665603ULL;
+    for (int z = 0; z < gridDepth; z++) {
+        for (int y = 0; y < gridHeight; y++) {
+            for (int x = 0; x < gridWidth; x++) {
+                uint8_t bytes[4] = { (uint8_t)grid[z][y][x], (uint8_t)GetWallMaterial(x, y, z),
+                                     (uint8_t)GetVegetation(x, y, z), (uint8_t)GetWaterLevel(x, y, z) };
+                for (int i = 0; i < 4; i++) {
+                    h ^= bytes[i];
+                    h *= 1099511628211ULL;
+                }
+            }
+        }
+    }
+    return h;
+}
+
+describe(worldgen_tiles) {
+    it("should batch octave noise bit-identically to OctavePerlin") {
+        InitPerlin(4242);
+        float xs[37], ys[37], out[37];
+        bool allEqual = true;
+        for (int round = 0; round < 50; round++) {
+            for (int i = 0; i < 37; i++) {
+                xs[i] = (float)((round * 37 + i) * 13 % 997) * 0.173f - 40.0f;
+                ys[i] = (float)((round * 37 + i) * 29 % 991) * 0.091f + 3.5f;
+            }
+            int octaves = 1 + round % 6;
+            OctavePerlinBatch(xs, ys, 37, octaves, 0.45f, out);
+            for (int i = 0; i < 37; i++) {
+                if (out[i] != OctavePerlin(xs[i], ys[i], octaves, 0.45f)) allEqual = false;
+            }
+        }
+        expect(allEqual);
+    }
+
+    it("should generate the same biome world with 1 and N threads") {
+        bool origReport = hillsWaterConnectivityReport;
+        int origThreads = worldgenThreads;
+        uint64_t origSeed = worldSeed;
+        hillsWaterConnectivityReport = false;
+
+        // 5x4 tiles, partial on the right and bottom edges. Enough tiles that
+        // WORLDGEN_MIN_TILES_PER_THREAD doesn't clamp the 4-thread run.
+        InitGridWithSizeAndChunkSize(300, 200, 16, 16);
+        gridDepth = 16;
+        worldSeed = 987654321ULL;
+
+        worldgenThreads = 1;
+        GenerateHillsSoilsWater();
+        uint64_t single = HashWorldCells();
+
+        worldgenThreads = 4;
+        GenerateHillsSoilsWater();
+        uint64_t four = HashWorldCells();
+
+        worldgenThreads = 3;
+        GenerateHillsSoilsWater();
+        uint64_t three = HashWorldCells();
+
+        if (test_verbose) {
+            printf("worldgen hashes: 1=%016llx 4=%016llx 3=%016llx\n",
+                   (unsigned long long)single, (unsigned long long)four, (unsigned long long)three);
+        }
+        expect(single == four);
+        expect(single == three);
+
+        worldSeed = origSeed;
+        worldgenThreads = origThreads;
+        hillsWaterConnectivityReport = origReport;
+    }
+}
+
 // =============================================================================
 // Main
 // =============================================================================
@@ -377,6 +455,7 @@ int main(int argc, char* argv[]) {
     test(terrain_regen_clears_water);
     test(ramp_north_duplicate_prevention);
     test(connectivity_fix_preserves_largest);
+    test(worldgen_tiles);
 
     return summary();
 }
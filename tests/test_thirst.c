@@ -116,7 +116,7 @@ describe(thirst_drain) {
         SetupClean();
         int mi = SetupMover(1, 1);
         movers[mi].thirst = 1.0f;
-        movers[mi].active = false;
+        moverActive[mi] = false;
 
         for (int i = 0; i < 10000; i++) {
             NeedsTick();
@@ -179,7 +179,7 @@ describe(dehydration_death) {
             NeedsTick();
         }
 
-        expect(movers[mi].active == false);
+        expect(moverActive[mi] == false);
     }
 
     it("mover does not die in sandbox mode") {
@@ -194,7 +194,7 @@ describe(dehydration_death) {
             NeedsTick();
         }
 
-        expect(movers[mi].active == true);
+        expect(moverActive[mi] == true);
     }
 }
 
@@ -279,7 +279,7 @@ describe(drink_from_stockpile) {
 
         expect(movers[mi].freetimeState == FREETIME_SEEKING_DRINK);
         expect(movers[mi].needTarget == waterIdx);
-        expect(items[waterIdx].reservedBy == mi);
+        expect(itemReservedBy[waterIdx] == mi);
     }
 
     it("mover drinks and restores thirst") {
@@ -290,13 +290,13 @@ describe(drink_from_stockpile) {
         // Spawn water right next to mover (so arrival is immediate)
         int waterIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_WATER);
         expect(waterIdx >= 0);
-        items[waterIdx].state = ITEM_IN_STOCKPILE;
+        itemState[waterIdx] = ITEM_IN_STOCKPILE;
 
         // Set up seeking state manually
         movers[mi].freetimeState = FREETIME_SEEKING_DRINK;
         movers[mi].needTarget = waterIdx;
         movers[mi].needProgress = 0.0f;
-        items[waterIdx].reservedBy = mi;
+        itemReservedBy[waterIdx] = mi;
 
         // Process — should detect arrival and transition to DRINKING
         ProcessFreetimeNeeds();
@@ -314,7 +314,7 @@ describe(drink_from_stockpile) {
         expect(movers[mi].thirst > 0.3f);
         expect(movers[mi].freetimeState == FREETIME_NONE);
         // Water item should be consumed
-        expect(!items[waterIdx].active);
+        expect(!itemActive[waterIdx]);
     }
 }
 
@@ -331,7 +331,7 @@ describe(drink_from_container) {
 
         // Spawn pot with water inside
         int potIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_CLAY_POT);
-        items[potIdx].state = ITEM_ON_GROUND;
+        itemState[potIdx] = ITEM_ON_GROUND;
 
         int waterIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_WATER);
         PutItemInContainer(waterIdx, potIdx);
@@ -349,7 +349,7 @@ describe(drink_from_container) {
 
         // Spawn pot with water at mover position
         int potIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_CLAY_POT);
-        items[potIdx].state = ITEM_ON_GROUND;
+        itemState[potIdx] = ITEM_ON_GROUND;
 
         int waterIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_WATER);
         PutItemInContainer(waterIdx, potIdx);
@@ -358,7 +358,7 @@ describe(drink_from_container) {
         movers[mi].freetimeState = FREETIME_DRINKING;
         movers[mi].needTarget = waterIdx;
         movers[mi].needProgress = 0.0f;
-        items[waterIdx].reservedBy = mi;
+        itemReservedBy[waterIdx] = mi;
 
         float drinkTime = GameHoursToGameSeconds(balance.drinkingDurationGH);
         int ticks = (int)(drinkTime / TICK_DT) + 10;
@@ -368,8 +368,8 @@ describe(drink_from_container) {
         }
 
         // Water consumed, pot remains
-        expect(!items[waterIdx].active);
-        expect(items[potIdx].active);
+        expect(!itemActive[waterIdx]);
+        expect(itemActive[potIdx]);
         expect(movers[mi].thirst > 0.3f);
     }
 }
@@ -387,11 +387,11 @@ describe(drink_priority) {
 
         // Spawn all three at same distance
         int waterIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_WATER);
-        items[waterIdx].state = ITEM_ON_GROUND;
+        itemState[waterIdx] = ITEM_ON_GROUND;
         int juiceIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_BERRY_JUICE);
-        items[juiceIdx].state = ITEM_ON_GROUND;
+        itemState[juiceIdx] = ITEM_ON_GROUND;
         int teaIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_HERBAL_TEA);
-        items[teaIdx].state = ITEM_ON_GROUND;
+        itemState[teaIdx] = ITEM_ON_GROUND;
 
         ProcessFreetimeNeeds();
 
@@ -465,7 +465,7 @@ describe(fill_water_pot) {
 
         // Spawn empty pot
         int potIdx = SpawnItem(3 * CELL_SIZE + 4, 3 * CELL_SIZE + 4, 1.0f, ITEM_CLAY_POT);
-        items[potIdx].state = ITEM_ON_GROUND;
+        itemState[potIdx] = ITEM_ON_GROUND;
 
         // Place water on grid
         waterGrid[1][7][7].level = 5;
@@ -473,7 +473,7 @@ describe(fill_water_pot) {
         int jobId = WorkGiver_FillWaterPot(mi);
         expect(jobId >= 0);
         expect(jobs[jobId].type == JOBTYPE_FILL_WATER_POT);
-        expect(items[potIdx].reservedBy == mi);
+        expect(itemReservedBy[potIdx] == mi);
     }
 
     it("no job when no empty pots exist") {
@@ -497,7 +497,7 @@ describe(fill_water_pot) {
         RebuildIdleMoverList();
 
         int potIdx = SpawnItem(3 * CELL_SIZE + 4, 3 * CELL_SIZE + 4, 1.0f, ITEM_CLAY_POT);
-        items[potIdx].state = ITEM_ON_GROUND;
+        itemState[potIdx] = ITEM_ON_GROUND;
 
         int jobId = WorkGiver_FillWaterPot(mi);
         expect(jobId < 0);
@@ -512,7 +512,7 @@ describe(fill_water_pot) {
         RebuildIdleMoverList();
 
         int potIdx = SpawnItem(3 * CELL_SIZE + 4, 3 * CELL_SIZE + 4, 1.0f, ITEM_CLAY_POT);
-        items[potIdx].state = ITEM_ON_GROUND;
+        itemState[potIdx] = ITEM_ON_GROUND;
         waterGrid[1][7][7].level = 5;
 
         int jobId = WorkGiver_FillWaterPot(mi);
@@ -528,7 +528,7 @@ describe(fill_water_pot) {
 
         // Spawn pot with water already inside
         int potIdx = SpawnItem(3 * CELL_SIZE + 4, 3 * CELL_SIZE + 4, 1.0f, ITEM_CLAY_POT);
-        items[potIdx].state = ITEM_ON_GROUND;
+        itemState[potIdx] = ITEM_ON_GROUND;
         int w = SpawnItem(3 * CELL_SIZE + 4, 3 * CELL_SIZE + 4, 1.0f, ITEM_WATER);
         PutItemInContainer(w, potIdx);
 
@@ -630,8 +630,8 @@ describe(cancel_drink_seeking) {
         int mi = SetupMover(1, 1);
 
         int waterIdx = SpawnItem(5 * CELL_SIZE + 4, 5 * CELL_SIZE + 4, 1.0f, ITEM_WATER);
-        items[waterIdx].state = ITEM_ON_GROUND;
-        items[waterIdx].reservedBy = mi;
+        itemState[waterIdx] = ITEM_ON_GROUND;
+        itemReservedBy[waterIdx] = mi;
 
         movers[mi].freetimeState = FREETIME_SEEKING_DRINK;
         movers[mi].needTarget = waterIdx;
@@ -641,7 +641,7 @@ describe(cancel_drink_seeking) {
         ProcessFreetimeNeeds();
 
         expect(movers[mi].freetimeState == FREETIME_NONE);
-        expect(items[waterIdx].reservedBy == -1);
+        expect(itemReservedBy[waterIdx] == -1);
     }
 }
 
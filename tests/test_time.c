@@ -1,6 +1,7 @@
 #include "../vendor/c89spec.h"
 #include "../vendor/raylib.h"
 #include "../src/core/time.h"
+#include "../src/core/sim_rng.h"
 #include "../src/entities/mover.h"
 #include "../src/world/grid.h"
 #include "test_helpers.h"
@@ -202,6 +203,63 @@ describe(time_ResetTestState) {
         expect(gameTime == 0.0);
         expect(dayNumber == 1);
     }
+
+    it("should seed the simulation streams") {
+        ResetTestState(12345);
+        uint32_t a = SimRandU32(RNG_FIRE);
+
+        ResetTestState(12345);
+        uint32_t b = SimRandU32(RNG_FIRE);
+
+        expect(a == b);
+        expect(GetSimRngSeed() == 12345);
+    }
+}
+
+// =============================================================================
+// Simulation random streams
+// =============================================================================
+
+describe(sim_rng) {
+    it("should repeat a stream for the same seed") {
+        uint32_t first[16], second[16];
+        SeedSimRng(777);
+        for (int i = 0; i < 16; i++) first[i] = SimRandU32(RNG_WEATHER);
+        SeedSimRng(777);
+        for (int i = 0; i < 16; i++) second[i] = SimRandU32(RNG_WEATHER);
+        expect(memcmp(first, second, sizeof(first)) == 0);
+
+        SeedSimRng(778);
+        expect(SimRandU32(RNG_WEATHER) != first[0]);
+    }
+
+    it("should not let one stream's draws shift another") {
+        SeedSimRng(42);
+        uint32_t untouched = SimRandU32(RNG_MOVERS);
+
+        SeedSimRng(42);
+        for (int i = 0; i < 1000; i++) SimRandU32(RNG_FIRE);
+        expect(SimRandU32(RNG_MOVERS) == untouched);
+    }
+
+    it("should give different sequences per stream") {
+        SeedSimRng(42);
+        expect(SimRandU32(RNG_FIRE) != SimRandU32(RNG_SMOKE));
+    }
+
+    it("should keep SimRandRange inclusive and in bounds") {
+        SeedSimRng(9);
+        bool sawMin = false, sawMax = false, outOfRange = false;
+        for (int i = 0; i < 2000; i++) {
+            int v = SimRandRange(RNG_JOBS, 3, 7);
+            if (v == 3) sawMin = true;
+            if (v == 7) sawMax = true;
+            if (v < 3 || v > 7) outOfRange = true;
+        }
+        expect(sawMin && sawMax && !outOfRange);
+        expect(SimRandRange(RNG_JOBS, 5, 5) == 5);
+        expect(SimRand(RNG_JOBS) >= 0);
+    }
 }
 
 // =============================================================================
@@ -291,6 +349,7 @@ int main(int argc, char* argv[]) {
     test(time_day_cycle);
     test(time_RunGameSeconds);
     test(time_ResetTestState);
+    test(sim_rng);
     
     // Integration
     test(time_tick_integration);
@@ -464,7 +464,7 @@ describe(spec_ground_wear) {
         // Set up bare worn dirt
         grid[0][4][8] = CELL_WALL; SetWallMaterial(8, 4, 0, MAT_DIRT); SetWallNatural(8, 4, 0);
         SET_CELL_SURFACE(8, 4, 0, SURFACE_BARE);
-        wearGrid[0][4][8] = 150;  // Above threshold (3D array now)
+        SetGroundWear(8, 4, 0, 150);  // Above threshold
         
         wearTallToNormal = 20;
         wearNormalToTrampled = 60;
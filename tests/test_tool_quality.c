@@ -962,8 +962,8 @@ describe(find_nearest_tool) {
 
         int axeIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_SHARP_STONE);
         expect(axeIdx >= 0);
-        items[axeIdx].state = ITEM_ON_GROUND;
-        items[axeIdx].reservedBy = -1;
+        itemState[axeIdx] = ITEM_ON_GROUND;
+        itemReservedBy[axeIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == axeIdx);
@@ -974,8 +974,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int axeIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 1, ITEM_SHARP_STONE);
-        items[axeIdx].state = ITEM_ON_GROUND;
-        items[axeIdx].reservedBy = -1;
+        itemState[axeIdx] = ITEM_ON_GROUND;
+        itemReservedBy[axeIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == -1);
@@ -986,8 +986,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int axeIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[axeIdx].state = ITEM_ON_GROUND;
-        items[axeIdx].reservedBy = 0;  // reserved
+        itemState[axeIdx] = ITEM_ON_GROUND;
+        itemReservedBy[axeIdx] = 0;  // reserved
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == -1);
@@ -999,8 +999,8 @@ describe(find_nearest_tool) {
 
         // Rock has hammering:1 but no cutting
         int rockIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_ROCK);
-        items[rockIdx].state = ITEM_ON_GROUND;
-        items[rockIdx].reservedBy = -1;
+        itemState[rockIdx] = ITEM_ON_GROUND;
+        itemReservedBy[rockIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == -1);
@@ -1011,12 +1011,12 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int farIdx = SpawnItem(10 * CELL_SIZE, 10 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[farIdx].state = ITEM_ON_GROUND;
-        items[farIdx].reservedBy = -1;
+        itemState[farIdx] = ITEM_ON_GROUND;
+        itemReservedBy[farIdx] = -1;
 
         int nearIdx = SpawnItem(4 * CELL_SIZE, 4 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[nearIdx].state = ITEM_ON_GROUND;
-        items[nearIdx].reservedBy = -1;
+        itemState[nearIdx] = ITEM_ON_GROUND;
+        itemReservedBy[nearIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == nearIdx);
@@ -1027,8 +1027,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int onlyIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[onlyIdx].state = ITEM_ON_GROUND;
-        items[onlyIdx].reservedBy = -1;
+        itemState[onlyIdx] = ITEM_ON_GROUND;
+        itemReservedBy[onlyIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, onlyIdx);
         expect(found == -1);
@@ -1039,8 +1039,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int toolIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[toolIdx].state = ITEM_IN_STOCKPILE;
-        items[toolIdx].reservedBy = -1;
+        itemState[toolIdx] = ITEM_IN_STOCKPILE;
+        itemReservedBy[toolIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == toolIdx);
@@ -1051,8 +1051,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int toolIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[toolIdx].state = ITEM_CARRIED;
-        items[toolIdx].reservedBy = 0;
+        itemState[toolIdx] = ITEM_CARRIED;
+        itemReservedBy[toolIdx] = 0;
 
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 3, 3, 0, 50, -1);
         expect(found == -1);
@@ -1063,8 +1063,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int toolIdx = SpawnItem(14 * CELL_SIZE, 14 * CELL_SIZE, 0, ITEM_SHARP_STONE);
-        items[toolIdx].state = ITEM_ON_GROUND;
-        items[toolIdx].reservedBy = -1;
+        itemState[toolIdx] = ITEM_ON_GROUND;
+        itemReservedBy[toolIdx] = -1;
 
         // Search radius 5 tiles from (1,1) — tool at (14,14) is way out of range
         int found = FindNearestToolForQuality(QUALITY_CUTTING, 1, 1, 1, 0, 5, -1);
@@ -1076,8 +1076,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int hammerIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_STONE_HAMMER);
-        items[hammerIdx].state = ITEM_ON_GROUND;
-        items[hammerIdx].reservedBy = -1;
+        itemState[hammerIdx] = ITEM_ON_GROUND;
+        itemReservedBy[hammerIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_HAMMERING, 2, 3, 3, 0, 50, -1);
         expect(found == hammerIdx);
@@ -1088,8 +1088,8 @@ describe(find_nearest_tool) {
         ClearItems();
 
         int rockIdx = SpawnItem(5 * CELL_SIZE, 5 * CELL_SIZE, 0, ITEM_ROCK);
-        items[rockIdx].state = ITEM_ON_GROUND;
-        items[rockIdx].reservedBy = -1;
+        itemState[rockIdx] = ITEM_ON_GROUND;
+        itemReservedBy[rockIdx] = -1;
 
         int found = FindNearestToolForQuality(QUALITY_HAMMERING, 2, 3, 3, 0, 50, -1);
         expect(found == -1);
@@ -1110,16 +1110,16 @@ describe(drop_equipped_tool) {
                   4 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, MOVER_SPEED);
         moverCount = 1;
 
-        int toolIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_SHARP_STONE);
-        items[toolIdx].state = ITEM_CARRIED;
-        items[toolIdx].reservedBy = 0;
+        int toolIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_SHARP_STONE);
+        itemState[toolIdx] = ITEM_CARRIED;
+        itemReservedBy[toolIdx] = 0;
         movers[0].equippedTool = toolIdx;
 
         DropEquippedTool(0);
 
         expect(movers[0].equippedTool == -1);
-        expect(items[toolIdx].state == ITEM_ON_GROUND);
-        expect(items[toolIdx].reservedBy == -1);
+        expect(itemState[toolIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[toolIdx] == -1);
     }
 
     it("should be no-op when equippedTool is -1") {
@@ -1155,9 +1155,9 @@ describe(story2_digging_stick_soil_mining) {
 
         // Second: measure with digging stick equipped (dig:1 → 1.0x)
         SetupMiningTest(5, 3, MAT_DIRT, 4, 3);
-        int stickIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_DIGGING_STICK);
-        items[stickIdx].state = ITEM_CARRIED;
-        items[stickIdx].reservedBy = 0;
+        int stickIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_DIGGING_STICK);
+        itemState[stickIdx] = ITEM_CARRIED;
+        itemReservedBy[stickIdx] = 0;
         movers[0].equippedTool = stickIdx;
         DesignateMine(5, 3, 0);
         int ticksWithStick = RunSimUntil(WallIsGone, 2000);
@@ -1173,7 +1173,7 @@ describe(story2_digging_stick_soil_mining) {
 
         // Mover still holds the digging stick
         expect(movers[0].equippedTool == stickIdx);
-        expect(items[stickIdx].state == ITEM_CARRIED);
+        expect(itemState[stickIdx] == ITEM_CARRIED);
     }
 }
 
@@ -1186,9 +1186,9 @@ describe(story4_stone_hammer_mines_rock) {
 
         // Measure with stone hammer (hammer:2 meets hard gate → 1.0x)
         SetupMiningTest(5, 3, MAT_GRANITE, 4, 3);
-        int hammerIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_STONE_HAMMER);
-        items[hammerIdx].state = ITEM_CARRIED;
-        items[hammerIdx].reservedBy = 0;
+        int hammerIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_STONE_HAMMER);
+        itemState[hammerIdx] = ITEM_CARRIED;
+        itemReservedBy[hammerIdx] = 0;
         movers[0].equippedTool = hammerIdx;
         DesignateMine(5, 3, 0);
         g_wallCheckX = 5; g_wallCheckY = 3;
@@ -1197,7 +1197,7 @@ describe(story4_stone_hammer_mines_rock) {
 
         // Mover still holds the hammer (check before second setup clears items)
         expect(movers[0].equippedTool == hammerIdx);
-        expect(items[hammerIdx].state == ITEM_CARRIED);
+        expect(itemState[hammerIdx] == ITEM_CARRIED);
 
         // Compare with toggle-off baseline (1.0x, no tools needed)
         SetupMiningTest(5, 3, MAT_GRANITE, 4, 3);
@@ -1234,9 +1234,9 @@ describe(story11_rock_hammer1_building_not_mining) {
         SetupMiningTest(5, 3, MAT_GRANITE, 4, 3);
 
         // Give mover a rock as "tool" (hammer:1)
-        int rockIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_ROCK);
-        items[rockIdx].state = ITEM_CARRIED;
-        items[rockIdx].reservedBy = 0;
+        int rockIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_ROCK);
+        itemState[rockIdx] = ITEM_CARRIED;
+        itemReservedBy[rockIdx] = 0;
         movers[0].equippedTool = rockIdx;
 
         DesignateMine(5, 3, 0);
@@ -1295,8 +1295,8 @@ describe(story6_seek_tool_for_chop) {
         // Sharp stone at (3,3)
         int ssIdx = SpawnItem(3 * CELL_SIZE + CELL_SIZE * 0.5f,
                               3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_ON_GROUND;
-        items[ssIdx].reservedBy = -1;
+        itemState[ssIdx] = ITEM_ON_GROUND;
+        itemReservedBy[ssIdx] = -1;
 
         // Designate chop
         bool desig = DesignateChop(7, 3, 0);
@@ -1326,7 +1326,7 @@ describe(story6_seek_tool_for_chop) {
         expect(pickedUpTool == true);
         expect(chopDone == true);
         expect(movers[0].equippedTool == ssIdx);
-        expect(items[ssIdx].state == ITEM_CARRIED);
+        expect(itemState[ssIdx] == ITEM_CARRIED);
     }
 }
 
@@ -1367,9 +1367,9 @@ describe(story7_keep_tool_across_jobs) {
                   3 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, MOVER_SPEED);
         moverCount = 1;
 
-        int ssIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_CARRIED;
-        items[ssIdx].reservedBy = 0;
+        int ssIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_SHARP_STONE);
+        itemState[ssIdx] = ITEM_CARRIED;
+        itemReservedBy[ssIdx] = 0;
         movers[0].equippedTool = ssIdx;
 
         // Designate both trees
@@ -1392,8 +1392,8 @@ describe(story7_keep_tool_across_jobs) {
         expect(treesChopped == 2);
         // Mover still holds the same tool
         expect(movers[0].equippedTool == ssIdx);
-        expect(items[ssIdx].state == ITEM_CARRIED);
-        expect(items[ssIdx].reservedBy == 0);
+        expect(itemState[ssIdx] == ITEM_CARRIED);
+        expect(itemReservedBy[ssIdx] == 0);
     }
 }
 
@@ -1435,16 +1435,16 @@ describe(story8_tool_swap) {
                   3 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, MOVER_SPEED);
         moverCount = 1;
 
-        int ssIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_CARRIED;
-        items[ssIdx].reservedBy = 0;
+        int ssIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_SHARP_STONE);
+        itemState[ssIdx] = ITEM_CARRIED;
+        itemReservedBy[ssIdx] = 0;
         movers[0].equippedTool = ssIdx;
 
         // Stone hammer at (3,3)
         int hammerIdx = SpawnItem(3 * CELL_SIZE + CELL_SIZE * 0.5f,
                                   3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_STONE_HAMMER);
-        items[hammerIdx].state = ITEM_ON_GROUND;
-        items[hammerIdx].reservedBy = -1;
+        itemState[hammerIdx] = ITEM_ON_GROUND;
+        itemReservedBy[hammerIdx] = -1;
 
         // Designate mine on stone wall
         DesignateMine(7, 3, 0);
@@ -1455,10 +1455,10 @@ describe(story8_tool_swap) {
 
         expect(grid[0][3][7] != CELL_WALL);  // Wall mined
         expect(movers[0].equippedTool == hammerIdx);  // Now holds hammer
-        expect(items[hammerIdx].state == ITEM_CARRIED);
+        expect(itemState[hammerIdx] == ITEM_CARRIED);
         // Sharp stone was dropped
-        expect(items[ssIdx].state == ITEM_ON_GROUND);
-        expect(items[ssIdx].reservedBy == -1);
+        expect(itemState[ssIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[ssIdx] == -1);
     }
 }
 
@@ -1489,9 +1489,9 @@ describe(story12_death_drops_tool) {
                   4 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal, MOVER_SPEED);
         moverCount = 1;
 
-        int pickIdx = SpawnItem(movers[0].x, movers[0].y, 0, ITEM_STONE_PICK);
-        items[pickIdx].state = ITEM_CARRIED;
-        items[pickIdx].reservedBy = 0;
+        int pickIdx = SpawnItem(moverPosX[0], moverPosY[0], 0, ITEM_STONE_PICK);
+        itemState[pickIdx] = ITEM_CARRIED;
+        itemReservedBy[pickIdx] = 0;
         movers[0].equippedTool = pickIdx;
 
         // Set mover to starving, push past threshold
@@ -1501,10 +1501,10 @@ describe(story12_death_drops_tool) {
         // Tick to trigger death
         NeedsTick();
 
-        expect(movers[0].active == false);
-        expect(items[pickIdx].active == true);
-        expect(items[pickIdx].state == ITEM_ON_GROUND);
-        expect(items[pickIdx].reservedBy == -1);
+        expect(moverActive[0] == false);
+        expect(itemActive[pickIdx] == true);
+        expect(itemState[pickIdx] == ITEM_ON_GROUND);
+        expect(itemReservedBy[pickIdx] == -1);
 
         gameMode = savedMode;
         hungerEnabled = savedHunger;
@@ -1551,8 +1551,8 @@ describe(cancel_mid_fetch) {
         // Sharp stone at (4,3)
         int ssIdx = SpawnItem(4 * CELL_SIZE + CELL_SIZE * 0.5f,
                               3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_ON_GROUND;
-        items[ssIdx].reservedBy = -1;
+        itemState[ssIdx] = ITEM_ON_GROUND;
+        itemReservedBy[ssIdx] = -1;
 
         DesignateChop(7, 3, 0);
 
@@ -1567,7 +1567,7 @@ describe(cancel_mid_fetch) {
         int jobId = movers[0].currentJobId;
         if (jobId >= 0) {
             // Tool should be reserved
-            expect(items[ssIdx].reservedBy == 0);
+            expect(itemReservedBy[ssIdx] == 0);
 
             // Cancel the job
             CancelJob(&movers[0], 0);
@@ -1575,7 +1575,7 @@ describe(cancel_mid_fetch) {
             expect(movers[0].currentJobId < 0);
             // If mover hasn't picked up the tool yet, reservation should be released
             if (movers[0].equippedTool != ssIdx) {
-                expect(items[ssIdx].reservedBy == -1);
+                expect(itemReservedBy[ssIdx] == -1);
             }
         }
     }
@@ -1641,7 +1641,7 @@ static int g_sharpStoneIdx = -1;
 
 static bool SharpStoneExists(void) {
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (items[i].active && items[i].type == ITEM_SHARP_STONE) {
+        if (itemActive[i] && items[i].type == ITEM_SHARP_STONE) {
             g_sharpStoneFound = true;
             g_sharpStoneIdx = i;
             return true;
@@ -1655,7 +1655,7 @@ static int g_diggingStickIdx = -1;
 
 static bool DiggingStickExists(void) {
     for (int i = 0; i < MAX_ITEMS; i++) {
-        if (items[i].active && items[i].type == ITEM_DIGGING_STICK) {
+        if (itemActive[i] && items[i].type == ITEM_DIGGING_STICK) {
             g_diggingStickFound = true;
             g_diggingStickIdx = i;
             return true;
@@ -1721,14 +1721,14 @@ describe(story10_full_bootstrap) {
         // Rock on ground at (2,5) — knapping input
         int rockIdx = SpawnItem(2 * CELL_SIZE + CELL_SIZE * 0.5f,
                                 5 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_ROCK);
-        items[rockIdx].state = ITEM_ON_GROUND;
-        items[rockIdx].reservedBy = -1;
+        itemState[rockIdx] = ITEM_ON_GROUND;
+        itemReservedBy[rockIdx] = -1;
 
         // Sticks on ground at (7,2) — crafting input
         int sticksIdx = SpawnItem(7 * CELL_SIZE + CELL_SIZE * 0.5f,
                                   2 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_STICKS);
-        items[sticksIdx].state = ITEM_ON_GROUND;
-        items[sticksIdx].reservedBy = -1;
+        itemState[sticksIdx] = ITEM_ON_GROUND;
+        itemReservedBy[sticksIdx] = -1;
 
         // Mover at (1,5), no tool
         Point goal = {1, 5, 0};
@@ -1804,9 +1804,9 @@ describe(edge_soft_job_no_tool_available) {
                   3 * CELL_SIZE + CELL_SIZE * 0.5f, 0.0f, goal2, MOVER_SPEED);
         moverCount = 2;
 
-        int stickIdx = SpawnItem(movers[1].x, movers[1].y, 0, ITEM_DIGGING_STICK);
-        items[stickIdx].state = ITEM_CARRIED;
-        items[stickIdx].reservedBy = 1;
+        int stickIdx = SpawnItem(moverPosX[1], moverPosY[1], 0, ITEM_DIGGING_STICK);
+        itemState[stickIdx] = ITEM_CARRIED;
+        itemReservedBy[stickIdx] = 1;
         movers[1].equippedTool = stickIdx;
 
         // First mover has no tool
@@ -1875,8 +1875,8 @@ describe(edge_tool_contention) {
         // Only one sharp stone
         int ssIdx = SpawnItem(3 * CELL_SIZE + CELL_SIZE * 0.5f,
                               3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_ON_GROUND;
-        items[ssIdx].reservedBy = -1;
+        itemState[ssIdx] = ITEM_ON_GROUND;
+        itemReservedBy[ssIdx] = -1;
 
         // Designate both trees for chopping (hard-gated: needs cutting:1)
         DesignateChop(5, 3, 0);
@@ -1923,7 +1923,7 @@ static bool g_stoneHammerFound;
 static int g_stoneHammerIdx;
 static bool StoneHammerExists(void) {
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == ITEM_STONE_HAMMER) {
+        if (itemActive[i] && items[i].type == ITEM_STONE_HAMMER) {
             g_stoneHammerFound = true;
             g_stoneHammerIdx = i;
             return true;
@@ -1977,24 +1977,24 @@ describe(tri_input_craft_stone_hammer) {
         // Input items on ground near workshop
         int rockIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                 3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_ROCK);
-        items[rockIdx].state = ITEM_ON_GROUND;
-        items[rockIdx].reservedBy = -1;
+        itemState[rockIdx] = ITEM_ON_GROUND;
+        itemReservedBy[rockIdx] = -1;
 
         int sticksIdx = SpawnItem(6 * CELL_SIZE + CELL_SIZE * 0.5f,
                                   2 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_STICKS);
-        items[sticksIdx].state = ITEM_ON_GROUND;
-        items[sticksIdx].reservedBy = -1;
+        itemState[sticksIdx] = ITEM_ON_GROUND;
+        itemReservedBy[sticksIdx] = -1;
 
         int cordageIdx = SpawnItem(9 * CELL_SIZE + CELL_SIZE * 0.5f,
                                    3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_CORDAGE);
-        items[cordageIdx].state = ITEM_ON_GROUND;
-        items[cordageIdx].reservedBy = -1;
+        itemState[cordageIdx] = ITEM_ON_GROUND;
+        itemReservedBy[cordageIdx] = -1;
 
         // Sharp stone for the cutting:1 requirement
         int ssIdx = SpawnItem(4 * CELL_SIZE + CELL_SIZE * 0.5f,
                               4 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_ON_GROUND;
-        items[ssIdx].reservedBy = -1;
+        itemState[ssIdx] = ITEM_ON_GROUND;
+        itemReservedBy[ssIdx] = -1;
 
         // Mover at (2,3), no tool
         Point goal = {2, 3, 0};
@@ -2014,9 +2014,9 @@ describe(tri_input_craft_stone_hammer) {
 
         // All 3 inputs should be consumed (slots may be reused by SpawnItem, so
         // check that the original item type is gone or the slot was reused)
-        expect(!items[rockIdx].active || items[rockIdx].type != ITEM_ROCK);
-        expect(!items[sticksIdx].active || items[sticksIdx].type != ITEM_STICKS);
-        expect(!items[cordageIdx].active || items[cordageIdx].type != ITEM_CORDAGE);
+        expect(!itemActive[rockIdx] || items[rockIdx].type != ITEM_ROCK);
+        expect(!itemActive[sticksIdx] || items[sticksIdx].type != ITEM_STICKS);
+        expect(!itemActive[cordageIdx] || items[cordageIdx].type != ITEM_CORDAGE);
     }
 
     it("cancel craft releases all 3 input reservations") {
@@ -2063,24 +2063,24 @@ describe(tri_input_craft_stone_hammer) {
         // Input items
         int rockIdx = SpawnItem(5 * CELL_SIZE + CELL_SIZE * 0.5f,
                                 3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_ROCK);
-        items[rockIdx].state = ITEM_ON_GROUND;
-        items[rockIdx].reservedBy = -1;
+        itemState[rockIdx] = ITEM_ON_GROUND;
+        itemReservedBy[rockIdx] = -1;
 
         int sticksIdx = SpawnItem(6 * CELL_SIZE + CELL_SIZE * 0.5f,
                                   2 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_STICKS);
-        items[sticksIdx].state = ITEM_ON_GROUND;
-        items[sticksIdx].reservedBy = -1;
+        itemState[sticksIdx] = ITEM_ON_GROUND;
+        itemReservedBy[sticksIdx] = -1;
 
         int cordageIdx = SpawnItem(9 * CELL_SIZE + CELL_SIZE * 0.5f,
                                    3 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_CORDAGE);
-        items[cordageIdx].state = ITEM_ON_GROUND;
-        items[cordageIdx].reservedBy = -1;
+        itemState[cordageIdx] = ITEM_ON_GROUND;
+        itemReservedBy[cordageIdx] = -1;
 
         // Sharp stone tool
         int ssIdx = SpawnItem(4 * CELL_SIZE + CELL_SIZE * 0.5f,
                               4 * CELL_SIZE + CELL_SIZE * 0.5f, 0, ITEM_SHARP_STONE);
-        items[ssIdx].state = ITEM_ON_GROUND;
-        items[ssIdx].reservedBy = -1;
+        itemState[ssIdx] = ITEM_ON_GROUND;
+        itemReservedBy[ssIdx] = -1;
 
         // Mover
         Point goal = {2, 3, 0};
@@ -2106,9 +2106,9 @@ describe(tri_input_craft_stone_hammer) {
         CancelJob(&movers[0], 0);
 
         // All items should be unreserved
-        expect(items[rockIdx].reservedBy == -1);
-        expect(items[sticksIdx].reservedBy == -1);
-        expect(items[cordageIdx].reservedBy == -1);
+        expect(itemReservedBy[rockIdx] == -1);
+        expect(itemReservedBy[sticksIdx] == -1);
+        expect(itemReservedBy[cordageIdx] == -1);
     }
 }
 
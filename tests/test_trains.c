@@ -404,11 +404,11 @@ describe(boarding_exiting) {
         expect(movers[0].transportState == TRANSPORT_NONE);
         expect(movers[0].goal.x == 25);
         expect(movers[0].goal.y == 25);
-        expect(movers[0].needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
         float expectedX = 21 * CELL_SIZE + CELL_SIZE * 0.5f;
         float expectedY = 15 * CELL_SIZE + CELL_SIZE * 0.5f;
-        expect(fabsf(movers[0].x - expectedX) < 1.0f);
-        expect(fabsf(movers[0].y - expectedY) < 1.0f);
+        expect(fabsf(moverPosX[0] - expectedX) < 1.0f);
+        expect(fabsf(moverPosY[0] - expectedY) < 1.0f);
     }
 
     it("DismountAllRiders removes all riders") {
@@ -435,7 +435,7 @@ describe(boarding_exiting) {
         expect(trains[trainIdx].ridingCount == 0);
         for (int i = 0; i < 3; i++) {
             expect(movers[i].transportState == TRANSPORT_NONE);
-            expect(movers[i].needsRepath == true);
+            expect(moverNeedsRepath[i] == true);
         }
     }
 
@@ -602,8 +602,8 @@ describe(mover_transport_state) {
         movers[0].transportStation = 0;
         movers[0].transportExitStation = -1;
         movers[0].transportFinalGoal = (Point){30, 30, 1};
-        movers[0].pathLength = 0;
-        movers[0].pathIndex = -1;
+        moverPathLength[0] = 0;
+        moverPathIndex[0] = -1;
 
         UpdateMovers();
 
@@ -690,7 +690,7 @@ describe(transport_haul_integration) {
         job->targetSlotY = 5;
         job->step = STEP_MOVING_TO_PICKUP;
         job->assignedMover = 0;
-        items[itemIdx].reservedBy = 0;
+        itemReservedBy[itemIdx] = 0;
 
         // Verify the scenario would normally trigger transport (distance and stations match)
         // but should NOT because this is the pickup leg (step 0)
@@ -711,7 +711,7 @@ describe(transport_haul_integration) {
 
         int itemIdx = SpawnItem(5 * CELL_SIZE + 16, 5 * CELL_SIZE + 16, 1.0f, ITEM_ROCK);
         items[itemIdx].material = MAT_GRANITE;
-        items[itemIdx].state = ITEM_CARRIED;
+        itemState[itemIdx] = ITEM_CARRIED;
 
         CreateStockpile(75, 5, 1, 2, 2);
 
@@ -731,7 +731,7 @@ describe(transport_haul_integration) {
         job->targetSlotY = 5;
         job->step = STEP_CARRYING;
         job->assignedMover = 0;
-        items[itemIdx].reservedBy = 0;
+        itemReservedBy[itemIdx] = 0;
 
         expect(ShouldUseTrain(0) == true);
     }
@@ -779,7 +779,7 @@ describe(transport_haul_integration) {
         // Item near station A
         int itemIdx = SpawnItem(6 * CELL_SIZE + 16, 5 * CELL_SIZE + 16, 1.0f, ITEM_ROCK);
         items[itemIdx].material = MAT_GRANITE;
-        items[itemIdx].reservedBy = 0;
+        itemReservedBy[itemIdx] = 0;
 
         // Stockpile near station B
         int spIdx = CreateStockpile(75, 5, 1, 2, 2);
@@ -789,8 +789,8 @@ describe(transport_haul_integration) {
         moverCount = 1;
         InitMover(&movers[0], 6 * CELL_SIZE + 16, 5 * CELL_SIZE + 16, 1.0f,
                    (Point){6, 5, 1}, MOVER_SPEED);
-        movers[0].pathLength = 0;
-        movers[0].pathIndex = -1;
+        moverPathLength[0] = 0;
+        moverPathIndex[0] = -1;
 
         // Haul job at step 0 — mover is at the item
         int jobId = CreateJob(JOBTYPE_HAUL);
@@ -810,8 +810,8 @@ describe(transport_haul_integration) {
         movers[0].transportFinalGoal = (Point){6, 5, 1}; // stale: item location, not stockpile
 
         // Verify item is in pickup range
-        float dx = movers[0].x - items[itemIdx].x;
-        float dy = movers[0].y - items[itemIdx].y;
+        float dx = moverPosX[0] - itemPosX[itemIdx];
+        float dy = moverPosY[0] - itemPosY[itemIdx];
         float distSq = dx*dx + dy*dy;
         float pickupR = CELL_SIZE * 0.75f;
         expect(distSq < pickupR * pickupR);
@@ -907,7 +907,7 @@ describe(platform_destroyed) {
         expect(stationCount == 0);
         expect(movers[0].transportState == TRANSPORT_NONE);
         expect(movers[0].goal.x == 30);
-        expect(movers[0].needsRepath == true);
+        expect(moverNeedsRepath[0] == true);
     }
 }
 
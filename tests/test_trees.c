@@ -65,7 +65,7 @@ static int CountCellType(CellType type) {
 static int CountItemType(ItemType type) {
     int count = 0;
     for (int i = 0; i < itemCount; i++) {
-        if (items[i].active && items[i].type == type) count++;
+        if (itemActive[i] && items[i].type == type) count++;
     }
     return count;
 }
@@ -87,7 +87,7 @@ static int CountStandingTrunks(void) {
 static int CountSaplingItems(void) {
     int count = 0;
     for (int i = 0; i < itemCount; i++) {
-        if (items[i].active && IsSaplingItem(items[i].type)) count++;
+        if (itemActive[i] && IsSaplingItem(items[i].type)) count++;
     }
     return count;
 }
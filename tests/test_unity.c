@@ -4,28 +4,37 @@
 // Tests include this file instead of listing individual source files.
 
 #include "../vendor/raylib.h"
+#include "../shared/profiler.h"
 
 // Stub prototypes (satisfy -Wmissing-prototypes)
-void ProfileBegin(const char* name);
-void ProfileEnd(const char* name);
-void ProfileAccumBegin(const char* name);
-void ProfileAccumEnd(const char* name);
-void ProfileFrameEnd(void);
-void ProfileReset(void);
-void ProfileCount(const char* name, int n);
-void ProfileCountSet(const char* name, int n);
 void AddMessage(const char* text, Color color);
 void TriggerScreenShake(float intensity, float duration);
 
-// Stub profiler functions - tests don't need real profiling
-void ProfileBegin(const char* name) { (void)name; }
-void ProfileEnd(const char* name) { (void)name; }
-void ProfileAccumBegin(const char* name) { (void)name; }
-void ProfileAccumEnd(const char* name) { (void)name; }
-void ProfileFrameEnd(void) {}
-void ProfileReset(void) {}
-void ProfileCount(const char* name, int n) { (void)name; (void)n; }
-void ProfileCountSet(const char* name, int n) { (void)name; (void)n; }
+// Stub profiler functions - tests don't need real profiling.
+// Weak so a benchmark can link the real profiler (PROFILER_IMPLEMENTATION)
+// against this object, e.g. bench_sim's per-section breakdown.
+#define PROFILER_STUB __attribute__((weak))
+PROFILER_STUB void ProfileBegin(const char* name) { (void)name; }
+PROFILER_STUB void ProfileEnd(const char* name) { (void)name; }
+PROFILER_STUB void ProfileAccumBegin(const char* name) { (void)name; }
+PROFILER_STUB void ProfileAccumEnd(const char* name) { (void)name; }
+PROFILER_STUB void ProfileFrameEnd(void) {}
+PROFILER_STUB void ProfileReset(void) {}
+PROFILER_STUB void ProfileCount(const char* name, int n) { (void)name; (void)n; }
+PROFILER_STUB void ProfileCountSet(const char* name, int n) { (void)name; (void)n; }
+PROFILER_STUB void ProfileBeginSite(ProfileSite* site) { (void)site; }
+PROFILER_STUB void ProfileEndSite(ProfileSite* site) { (void)site; }
+PROFILER_STUB void ProfileAccumBeginSite(ProfileSite* site) { (void)site; }
+PROFILER_STUB void ProfileAccumEndSite(ProfileSite* site) { (void)site; }
+PROFILER_STUB void ProfileCountSite(ProfileSite* site, int n) { (void)site; (void)n; }
+PROFILER_STUB void ProfileCountSetSite(ProfileSite* site, int n) { (void)site; (void)n; }
+PROFILER_STUB void ProfileThreadName(const char* name) { (void)name; }
+PROFILER_STUB void ProfileThreadExit(void) {}
+PROFILER_STUB uint64_t ProfileNowNs(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
 
 // Stub UI functions - tests don't need real UI
 void AddMessage(const char* text, Color color) { (void)text; (void)color; }
@@ -68,12 +77,18 @@ bool thirstEnabled = false;
 bool bladderEnabled = false;
 
 // World systems
+#include "../src/core/sim_rng.c"
 #include "../src/world/cell_defs.c"
 #include "../src/world/material.c"
 #include "../src/world/grid.c"
+#include "../src/world/paged_layer.c"
 #include "../src/world/biome.c"
 #include "../src/world/terrain.c"
+#include "../src/world/worldgen_tiles.c"
+#include "../src/world/cell_edits.c"
 #include "../src/world/pathfinding.c"
+#include "../src/world/flow_field.c"
+#include "../src/world/reach_cache.c"
 #include "../src/world/designations.c"
 #include "../src/world/construction.c"
 
@@ -91,6 +106,7 @@ bool bladderEnabled = false;
 #include "../src/simulation/trees.c"
 #include "../src/simulation/lighting.c"
 #include "../src/simulation/plants.c"
+#include "../src/simulation/area_sums.c"
 #include "../src/simulation/farming.c"
 #include "../src/simulation/balance.c"
 #include "../src/simulation/mood.c"
@@ -110,6 +126,9 @@ bool bladderEnabled = false;
 #include "../src/entities/stacking.c"
 #include "../src/entities/containers.c"
 #include "../src/entities/stockpiles.c"
+#include "../src/entities/item_renumber.c"
+#include "../src/entities/path_index.c"
+#include "../src/entities/item_ledger.c"
 #include "../src/entities/animals.c"
 #include "../src/entities/trains.c"
 #include "../src/entities/mover.c"
@@ -1,6 +1,7 @@
 #include "../vendor/c89spec.h"
 #include "../vendor/raylib.h"
 #include "../src/core/time.h"
+#include "../src/core/sim_rng.h"
 #include "../src/entities/mover.h"
 #include "../src/simulation/weather.h"
 #include "../src/simulation/water.h"
@@ -81,7 +82,7 @@ describe(weather_initialization) {
 describe(weather_transitions) {
     it("should not transition before timer expires") {
         SetupWeatherGrid();
-        srand(42);
+        SeedSimRng(42);
         weatherState.transitionTimer = 100.0f;
         WeatherType before = weatherState.current;
         // Advance 50 game-seconds (not enough to expire)
@@ -94,7 +95,7 @@ describe(weather_transitions) {
 
     it("should transition after timer expires") {
         SetupWeatherGrid();
-        srand(42);
+        SeedSimRng(42);
         weatherState.transitionTimer = 0.5f;  // About to expire
         // Advance past the timer
         for (int i = 0; i < 120; i++) {  // ~2s at TICK_DT
@@ -109,7 +110,7 @@ describe(weather_transitions) {
     it("should never transition to SNOW outside winter") {
         SetupWeatherGrid();
         dayNumber = 11;  // Summer
-        srand(123);
+        SeedSimRng(123);
         int snowCount = 0;
         for (int i = 0; i < 1000; i++) {
             weatherState.transitionTimer = 0.0f;
@@ -123,7 +124,7 @@ describe(weather_transitions) {
     it("should allow SNOW transitions in winter") {
         SetupWeatherGrid();
         dayNumber = 25;  // Winter
-        srand(456);
+        SeedSimRng(456);
         int snowCount = 0;
         for (int i = 0; i < 2000; i++) {
             // Force to CLOUDY (can transition to SNOW)
@@ -139,7 +140,7 @@ describe(weather_transitions) {
     it("should never produce THUNDERSTORM outside summer") {
         SetupWeatherGrid();
         dayNumber = 25;  // Winter
-        srand(789);
+        SeedSimRng(789);
         int thunderCount = 0;
         for (int i = 0; i < 2000; i++) {
             weatherState.current = WEATHER_HEAVY_RAIN;
@@ -154,7 +155,7 @@ describe(weather_transitions) {
     it("should allow THUNDERSTORM in summer from HEAVY_RAIN") {
         SetupWeatherGrid();
         dayNumber = 11;  // Summer
-        srand(101);
+        SeedSimRng(101);
         int thunderCount = 0;
         for (int i = 0; i < 2000; i++) {
             weatherState.current = WEATHER_HEAVY_RAIN;
@@ -168,7 +169,7 @@ describe(weather_transitions) {
 
     it("should track previous weather type") {
         SetupWeatherGrid();
-        srand(42);
+        SeedSimRng(42);
         ForceWeather(WEATHER_CLOUDY);
         weatherState.transitionTimer = 0.0f;
         gameDeltaTime = TICK_DT;
@@ -186,7 +187,7 @@ describe(weather_transition_probabilities) {
     it("should favor CLOUDY from CLEAR") {
         SetupWeatherGrid();
         dayNumber = 4;  // Spring
-        srand(42);
+        SeedSimRng(42);
         int counts[WEATHER_COUNT];
         memset(counts, 0, sizeof(counts));
         for (int i = 0; i < 1000; i++) {
@@ -209,7 +210,7 @@ describe(weather_transition_probabilities) {
 describe(weather_intensity) {
     it("should ramp intensity up from 0 after transition") {
         SetupWeatherGrid();
-        srand(42);
+        SeedSimRng(42);
         ForceWeather(WEATHER_CLOUDY);
         weatherState.transitionTimer = 0.0f;
         gameDeltaTime = TICK_DT;
@@ -221,7 +222,7 @@ describe(weather_intensity) {
 
     it("should reach 1.0 after ramp-up period") {
         SetupWeatherGrid();
-        srand(42);
+        SeedSimRng(42);
         weatherState.intensity = 0.1f;
         // Run for a while, intensity should reach 1.0
         for (int i = 0; i < 600; i++) {  // 10s at TICK_DT
@@ -439,7 +440,7 @@ describe(weather_wind_basics) {
 
     it("should have normalized wind direction") {
         SetupWeatherGrid();
-        srand(42);
+        SeedSimRng(42);
         ForceWeather(WEATHER_RAIN);
         weatherState.windDirX = 0.7f;
         weatherState.windDirY = 0.7f;
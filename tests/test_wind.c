@@ -1,6 +1,7 @@
 #include "../vendor/c89spec.h"
 #include "../vendor/raylib.h"
 #include "../src/core/time.h"
+#include "../src/core/sim_rng.h"
 #include "../src/entities/mover.h"
 #include "../src/simulation/weather.h"
 #include "../src/simulation/smoke.h"
@@ -113,7 +114,7 @@ describe(wind_smoke_bias) {
 
         for (int trial = 0; trial < 50; trial++) {
             SetupWindGrid();
-            srand(trial * 17 + 42);
+            SeedSimRng(trial * 17 + 42);
             SetWind(1.0f, 0.0f, 3.0f);  // Strong east wind
 
             // Continuously add smoke at center to maintain spreading
@@ -172,7 +173,7 @@ describe(wind_smoke_bias) {
 
         for (int trial = 0; trial < 100; trial++) {
             SetupWindGrid();
-            srand(trial * 31 + 7);
+            SeedSimRng(trial * 31 + 7);
             SetWind(0.0f, 0.0f, 0.0f);  // No wind
 
             int cx = 8, cy = 8;
@@ -217,7 +218,7 @@ describe(wind_fire_spread) {
 
         for (int trial = 0; trial < 200; trial++) {
             SetupWindGrid();
-            srand(trial * 13 + 99);
+            SeedSimRng(trial * 13 + 99);
             SetWind(1.0f, 0.0f, 3.0f);  // Strong east wind
 
             int cx = 8, cy = 8;
@@ -232,7 +233,7 @@ describe(wind_fire_spread) {
 
             // Ignite center at LOW level so spread is marginal
             SetFireLevel(cx, cy, 0, 2);  // Low fire level = low spread chance
-            fireGrid[0][cy][cx].fuel = 100;
+            FireCellForWrite(cx, cy, 0)->fuel = 100;
 
             // Run fire spread for fewer ticks
             fireSpreadInterval = TICK_DT * 0.4f;  // Spread every tick
@@ -242,8 +243,8 @@ describe(wind_fire_spread) {
             }
 
             // Check east vs west ignitions
-            if (fireGrid[0][cy][cx + 1].level > 0) downwindIgnitions++;
-            if (fireGrid[0][cy][cx - 1].level > 0) upwindIgnitions++;
+            if (FireCellAt(cx + 1, cy, 0)->level > 0) downwindIgnitions++;
+            if (FireCellAt(cx - 1, cy, 0)->level > 0) upwindIgnitions++;
         }
 
         // Downwind should have more ignitions
@@ -261,7 +262,7 @@ describe(wind_fire_spread) {
 
         for (int trial = 0; trial < 200; trial++) {
             SetupWindGrid();
-            srand(trial * 7 + 55);
+            SeedSimRng(trial * 7 + 55);
             SetWind(0.0f, 0.0f, 0.0f);  // No wind
 
             int cx = 8, cy = 8;
@@ -274,7 +275,7 @@ describe(wind_fire_spread) {
             }
 
             SetFireLevel(cx, cy, 0, 5);
-            fireGrid[0][cy][cx].fuel = 100;
+            FireCellForWrite(cx, cy, 0)->fuel = 100;
 
             fireSpreadInterval = TICK_DT * 0.4f;
             for (int i = 0; i < 30; i++) {
@@ -282,8 +283,8 @@ describe(wind_fire_spread) {
                 UpdateFire();
             }
 
-            if (fireGrid[0][cy][cx + 1].level > 0) eastIgnitions++;
-            if (fireGrid[0][cy][cx - 1].level > 0) westIgnitions++;
+            if (FireCellAt(cx + 1, cy, 0)->level > 0) eastIgnitions++;
+            if (FireCellAt(cx - 1, cy, 0)->level > 0) westIgnitions++;
         }
 
         // Should be roughly equal (within 40%)
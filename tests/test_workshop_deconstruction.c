@@ -37,7 +37,7 @@ static bool MoverIsIdle(Mover* m) {
 static int CountItemsOfType(ItemType type) {
     int count = 0;
     for (int i = 0; i < itemHighWaterMark; i++) {
-        if (items[i].active && items[i].type == type) count++;
+        if (itemActive[i] && items[i].type == type) count++;
     }
     return count;
 }